@@ -65,6 +65,7 @@ private:
 	std::map<std::string, PFrameBufferInstance> m_Instances;
 
 	void checkIdentifier(const std::string & sIdentifier);
+	void checkIdentifierIsUnused(const std::string & sIdentifier);
 
 public:
 
@@ -128,8 +128,13 @@ CFrameBufferDeviceInstance::CFrameBufferDeviceInstance(const std::string& sIdent
     if (m_bDoubleBufferingEnabled) {
         m_nCurrentBufferIndex = 1;
         setDrawBuffer(m_pFramebufferPtr + ((uint64_t)m_nScanLineLength * nScreenHeight), m_nScanLineLength);
+
+        // Both buffers need to start out identical, so that flips only have to copy the dirty region
+        clearScreen(black);
     }
 
+    resetDirtyRegion();
+
 #else
     throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_DEVICENOTSUPPORTEDONPLATFORM);
 #endif
@@ -164,6 +169,8 @@ void CFrameBufferDeviceInstance::flip()
         vinfo.yoffset = m_nCurrentBufferIndex * nScreenHeight;
         ioctl(m_nFBDeviceHandle, FBIOPAN_DISPLAY, &vinfo);
 
+        uint8_t* pDisplayedBuffer = m_pFramebufferPtr + ((uint64_t)m_nScanLineLength * nScreenHeight) * m_nCurrentBufferIndex;
+
         if (m_nCurrentBufferIndex == 0) {
             m_nCurrentBufferIndex = 1;
             setDrawBuffer(m_pFramebufferPtr + ((uint64_t)m_nScanLineLength * nScreenHeight), m_nScanLineLength);
@@ -174,12 +181,17 @@ void CFrameBufferDeviceInstance::flip()
 
         }
 
+        // The new draw buffer still holds the frame before the last one
+        copyDirtyRegion(pDisplayedBuffer, m_pFramebufferPtr + ((uint64_t)m_nScanLineLength * nScreenHeight) * m_nCurrentBufferIndex);
+
 #endif
     }
     else {
         setDrawBuffer(m_pFramebufferPtr, m_nScanLineLength);
     }
 
+    resetDirtyRegion();
+
 }
 
 bool CFrameBufferDeviceInstance::usesDoubleBuffering()
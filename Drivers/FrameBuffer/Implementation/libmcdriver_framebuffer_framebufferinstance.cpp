@@ -34,6 +34,9 @@ Abstract: This is a stub class definition of CFrameBufferAccess
 #include "libmcdriver_framebuffer_framebufferinstance.hpp"
 #include "libmcdriver_framebuffer_interfaceexception.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 using namespace LibMCDriver_FrameBuffer::Impl;
 
 CFrameBufferInstance::CFrameBufferInstance(const std::string& sIdentifier)
@@ -42,7 +45,12 @@ CFrameBufferInstance::CFrameBufferInstance(const std::string& sIdentifier)
     m_nScreenHeight(0),
     m_BitDepth(LibMCDriver_FrameBuffer::eFrameBufferBitDepth::Unknown),
     m_pDrawbufferPtr(nullptr),
-    m_nLineLength (0)
+    m_nLineLength (0),
+    m_bHasDirtyRegion (false),
+    m_nDirtyMinX (0),
+    m_nDirtyMinY (0),
+    m_nDirtyMaxX (0),
+    m_nDirtyMaxY (0)
 
 {
 
@@ -72,6 +80,106 @@ LibMCDriver_FrameBuffer::eFrameBufferBitDepth CFrameBufferInstance::bitDepth()
 }
 
 
+uint32_t CFrameBufferInstance::getBytesPerPixel()
+{
+    switch (m_BitDepth) {
+        case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565:
+            return 2;
+        case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888:
+            return 3;
+        case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGBA8888:
+            return 4;
+        default:
+            throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDPIXELFORMAT);
+    }
+}
+
+uint32_t CFrameBufferInstance::encodeColor(const LibMCDriver_FrameBuffer::sColor RGBColor, uint8_t* pPixel)
+{
+    switch (m_BitDepth) {
+        case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565: {
+
+            uint32_t nRed = RGBColor.m_Red;
+            uint32_t nGreen = RGBColor.m_Green;
+            uint32_t nBlue = RGBColor.m_Blue;
+
+            uint16_t rawColor = ((nBlue & 0xF8) << 8) | ((nGreen & 0xFC) << 3) | (nRed >> 3);
+            memcpy(pPixel, &rawColor, sizeof(rawColor));
+
+            return 2;
+        }
+
+        case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888:
+            pPixel[0] = RGBColor.m_Red;
+            pPixel[1] = RGBColor.m_Green;
+            pPixel[2] = RGBColor.m_Blue;
+            return 3;
+
+        case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGBA8888:
+            pPixel[0] = RGBColor.m_Red;
+            pPixel[1] = RGBColor.m_Green;
+            pPixel[2] = RGBColor.m_Blue;
+            pPixel[3] = 255; // Hardcoded alpha value (fully opaque)
+            return 4;
+
+        default:
+            throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDPIXELFORMAT);
+    }
+}
+
+void CFrameBufferInstance::markDirty(uint32_t nMinX, uint32_t nMinY, uint32_t nMaxX, uint32_t nMaxY)
+{
+    if (m_bHasDirtyRegion) {
+        m_nDirtyMinX = std::min(m_nDirtyMinX, nMinX);
+        m_nDirtyMinY = std::min(m_nDirtyMinY, nMinY);
+        m_nDirtyMaxX = std::max(m_nDirtyMaxX, nMaxX);
+        m_nDirtyMaxY = std::max(m_nDirtyMaxY, nMaxY);
+    }
+    else {
+        m_bHasDirtyRegion = true;
+        m_nDirtyMinX = nMinX;
+        m_nDirtyMinY = nMinY;
+        m_nDirtyMaxX = nMaxX;
+        m_nDirtyMaxY = nMaxY;
+    }
+}
+
+bool CFrameBufferInstance::getDirtyRegion(uint32_t& nMinX, uint32_t& nMinY, uint32_t& nMaxX, uint32_t& nMaxY)
+{
+    nMinX = m_nDirtyMinX;
+    nMinY = m_nDirtyMinY;
+    nMaxX = m_nDirtyMaxX;
+    nMaxY = m_nDirtyMaxY;
+    return m_bHasDirtyRegion;
+}
+
+void CFrameBufferInstance::resetDirtyRegion()
+{
+    m_bHasDirtyRegion = false;
+    m_nDirtyMinX = 0;
+    m_nDirtyMinY = 0;
+    m_nDirtyMaxX = 0;
+    m_nDirtyMaxY = 0;
+}
+
+void CFrameBufferInstance::copyDirtyRegion(const uint8_t* pSourceBuffer, uint8_t* pTargetBuffer)
+{
+    if ((pSourceBuffer == nullptr) || (pTargetBuffer == nullptr))
+        throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDDRAWBUFFER);
+
+    if (!m_bHasDirtyRegion || (pSourceBuffer == pTargetBuffer))
+        return;
+
+    size_t nBytesPerPixel = getBytesPerPixel();
+    size_t nRowOffset = (size_t)m_nDirtyMinX * nBytesPerPixel;
+    size_t nRowBytes = ((size_t)m_nDirtyMaxX - m_nDirtyMinX + 1) * nBytesPerPixel;
+
+    for (uint32_t nY = m_nDirtyMinY; nY <= m_nDirtyMaxY; nY++) {
+        size_t nAddress = (size_t)m_nLineLength * nY + nRowOffset;
+        memcpy(pTargetBuffer + nAddress, pSourceBuffer + nAddress, nRowBytes);
+    }
+}
+
 void CFrameBufferInstance::setPixel(const LibMCDriver_FrameBuffer_int32 nX, const LibMCDriver_FrameBuffer_int32 nY, const LibMCDriver_FrameBuffer::sColor RGBColor)
 {
     if ((nX >= 0) && (nY >= 0)) {
@@ -79,44 +187,10 @@ void CFrameBufferInstance::setPixel(const LibMCDriver_FrameBuffer_int32 nX, cons
         uint32_t nPositiveY = (uint32_t)nY;
 
         if ((nPositiveX < m_nScreenWidth) && (nPositiveY < m_nScreenHeight)) {
-            switch (m_BitDepth) {
-                case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565: {
-
-                    uint32_t nRed = RGBColor.m_Red;
-                    uint32_t nGreen = RGBColor.m_Green;
-                    uint32_t nBlue = RGBColor.m_Blue;
-
-                    uint16_t rawColor = ((nBlue & 0xF8) << 8) | ((nGreen & 0xFC) << 3) | (nRed >> 3);
-
-                    uint16_t* pPixelPtr = (uint16_t*)(m_pDrawbufferPtr + (uint64_t)m_nLineLength * ((uint64_t)nPositiveY)) + nPositiveX;
-                    *pPixelPtr = rawColor;
-
-                    break;
-                }
-
-                case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888: {
-                    uint8_t* pPixelPtr = m_pDrawbufferPtr + (uint64_t)m_nLineLength * ((uint64_t)nPositiveY) + (uint64_t)nPositiveX * 3;
-                    *pPixelPtr = RGBColor.m_Red;
-                    pPixelPtr++;
-                    *pPixelPtr = RGBColor.m_Green;
-                    pPixelPtr++;
-                    *pPixelPtr = RGBColor.m_Blue;
-                    break;
-                }
-
-                case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGBA8888: {
-                    uint8_t* pPixelPtr = m_pDrawbufferPtr + (uint64_t)m_nLineLength * ((uint64_t)nPositiveY) + (uint64_t)nPositiveX * 4;
-                    *pPixelPtr = RGBColor.m_Red;
-                    pPixelPtr++;
-                    *pPixelPtr = RGBColor.m_Green;
-                    pPixelPtr++;
-                    *pPixelPtr = RGBColor.m_Blue;
-                    pPixelPtr++;
-                    *pPixelPtr = 255;
-                    break;
-                }
-
-            }
+            uint8_t* pPixelPtr = m_pDrawbufferPtr + (uint64_t)m_nLineLength * ((uint64_t)nPositiveY) + (uint64_t)nPositiveX * getBytesPerPixel();
+            encodeColor(RGBColor, pPixelPtr);
+
+            markDirty(nPositiveX, nPositiveY, nPositiveX, nPositiveY);
         }
     }
 }
@@ -180,80 +254,23 @@ void CFrameBufferInstance::fillRectangle(const LibMCDriver_FrameBuffer_int32 nX1
     uint32_t nCountX = (uint32_t) ((nMaxX - nMinX) + 1);
     uint32_t nCountY = (uint32_t) ((nMaxY - nMinY) + 1);
 
-    // Fill the rectangle based on the framebuffer's bit depth
-    switch (m_BitDepth) {
-    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565: {
-
-        // Convert the RGB color to RGB565 format
-        uint32_t nRed = RGBColor.m_Red;
-        uint32_t nGreen = RGBColor.m_Green;
-        uint32_t nBlue = RGBColor.m_Blue;
-
-        uint16_t rawColor = ((nBlue & 0xF8) << 8) | ((nGreen & 0xFC) << 3) | (nRed >> 3);
-
-        // Fill the rectangle row by row
-        for (uint32_t nY = 0; nY < nCountY; nY++) {
-
-            uint16_t* pPixelPtr = (uint16_t*)(m_pDrawbufferPtr + (uint64_t)m_nLineLength * ((uint64_t)nY + nMinY)) + nMinX;
-
-            for (uint32_t nX = 0; nX < nCountX; nX++) {
-                *pPixelPtr = rawColor;
-                pPixelPtr++;
-            }
-        }
-
-        break;
-    }
-
-    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888: {
-
-        // Fill the rectangle row by row with 24-bit RGB values
-        for (uint32_t nY = 0; nY < nCountY; nY++) {
-
-            uint8_t* pPixelPtr = m_pDrawbufferPtr + (uint64_t)m_nLineLength * ((uint64_t)nY + nMinY) + (uint64_t) nMinX * 3;
-
-            for (uint32_t nX = 0; nX < nCountX; nX++) {
-                *pPixelPtr = RGBColor.m_Red;
-                pPixelPtr++;
-                *pPixelPtr = RGBColor.m_Green;
-                pPixelPtr++;
-                *pPixelPtr = RGBColor.m_Blue;
-                pPixelPtr++;
-            }
-        }
-
-        break;
-    }
-
-    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGBA8888: {
-
-        // Fill the rectangle row by row with 32-bit RGBA values
-
-        for (uint32_t nY = 0; nY < nCountY; nY++) {
-
-            uint8_t* pPixelPtr = m_pDrawbufferPtr + (uint64_t)m_nLineLength * ((uint64_t)nY + nMinY) + (uint64_t)nMinX * 4;
-
-            for (uint32_t nX = 0; nX < nCountX; nX++) {
-                *pPixelPtr = RGBColor.m_Red;
-                pPixelPtr++;
-                *pPixelPtr = RGBColor.m_Green;
-                pPixelPtr++;
-                *pPixelPtr = RGBColor.m_Blue;
-                pPixelPtr++;
-                *pPixelPtr = 255; // Hardcoded alpha value (fully opaque)
-                pPixelPtr++;
-            }
-        }
-
-        break;
-    }
-
-    default:
-        throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_INVALIDPIXELFORMAT);
+    // Encode the color once and fill the first row by doubling copies of the pixel pattern
+    size_t nBytesPerPixel = getBytesPerPixel();
+    size_t nRowBytes = (size_t)nCountX * nBytesPerPixel;
+    uint8_t* pFirstRowPtr = m_pDrawbufferPtr + (uint64_t)m_nLineLength * (uint64_t)nMinY + (uint64_t)nMinX * nBytesPerPixel;
 
+    size_t nFilledBytes = encodeColor(RGBColor, pFirstRowPtr);
+    while (nFilledBytes < nRowBytes) {
+        size_t nCopyBytes = std::min(nFilledBytes, nRowBytes - nFilledBytes);
+        memcpy(pFirstRowPtr + nFilledBytes, pFirstRowPtr, nCopyBytes);
+        nFilledBytes += nCopyBytes;
     }
 
+    // All other rows are copies of the first row
+    for (uint32_t nY = 1; nY < nCountY; nY++)
+        memcpy(pFirstRowPtr + (uint64_t)m_nLineLength * nY, pFirstRowPtr, nRowBytes);
 
+    markDirty((uint32_t)nMinX, (uint32_t)nMinY, (uint32_t)nMaxX, (uint32_t)nMaxY);
 
 }
 
@@ -347,6 +364,8 @@ void CFrameBufferInstance::drawImage(const LibMCDriver_FrameBuffer_int32 nX, con
     // Write the relevant section of the image directly to the framebuffer memory
     pImage->WriteToRawMemory(nImageSectionStartX, nImageSectionStartY, nImageSectionCountX, nImageSectionCountY, imagePixelFormat, (LibMCEnv_pvoid)pTargetPtr, m_nLineLength);
 
+    markDirty(nFrameBufferCoordStartX, nFrameBufferCoordStartY, nFrameBufferCoordStartX + nImageSectionCountX - 1, nFrameBufferCoordStartY + nImageSectionCountY - 1);
+
 }
 
 void CFrameBufferInstance::setScreenResolution(uint32_t nScreenWidth, uint32_t nScreenHeight, LibMCDriver_FrameBuffer::eFrameBufferBitDepth bitDepth)
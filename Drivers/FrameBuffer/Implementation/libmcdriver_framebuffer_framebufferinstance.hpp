@@ -61,11 +61,30 @@ private:
 
 	LibMCDriver_FrameBuffer::eFrameBufferBitDepth m_BitDepth;
 
+	// Bounding box of all pixels that have been drawn since the last flip
+	bool m_bHasDirtyRegion;
+	uint32_t m_nDirtyMinX;
+	uint32_t m_nDirtyMinY;
+	uint32_t m_nDirtyMaxX;
+	uint32_t m_nDirtyMaxY;
+
+	void markDirty(uint32_t nMinX, uint32_t nMinY, uint32_t nMaxX, uint32_t nMaxY);
+
+	// Writes the raw pixel value of a color in the format of the bit depth. Returns the number of bytes written.
+	uint32_t encodeColor(const LibMCDriver_FrameBuffer::sColor RGBColor, uint8_t* pPixel);
+
 protected:
 
 	void setScreenResolution (uint32_t nScreenWidth, uint32_t nScreenHeight, LibMCDriver_FrameBuffer::eFrameBufferBitDepth bitDepth);
 	void setDrawBuffer (uint8_t* pDrawBuffer, uint32_t nLineLength);
 
+	// Copies the dirty region from one buffer with the layout of the draw buffer to another.
+	// Double buffered instances call this after a flip, so that the new draw buffer matches the displayed one
+	// without copying the whole screen.
+	void copyDirtyRegion(const uint8_t* pSourceBuffer, uint8_t* pTargetBuffer);
+
+	void resetDirtyRegion();
+
 public:
 
 	CFrameBufferInstance (const std::string & sIdentifier);
@@ -78,6 +97,11 @@ public:
 
 	LibMCDriver_FrameBuffer::eFrameBufferBitDepth bitDepth();
 
+	uint32_t getBytesPerPixel();
+
+	// Returns false if nothing has been drawn since the last flip.
+	bool getDirtyRegion(uint32_t& nMinX, uint32_t& nMinY, uint32_t& nMaxX, uint32_t& nMaxY);
+
 	virtual bool usesDoubleBuffering() = 0;
 
 	virtual void flip() = 0;
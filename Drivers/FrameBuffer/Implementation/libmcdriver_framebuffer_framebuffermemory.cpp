@@ -0,0 +1,103 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class definition of CFrameBufferMemoryInstance
+
+*/
+
+#include "libmcdriver_framebuffer_framebuffermemory.hpp"
+#include "libmcdriver_framebuffer_interfaceexception.hpp"
+
+using namespace LibMCDriver_FrameBuffer::Impl;
+
+/*************************************************************************************************************************
+ Class definition of CFrameBufferMemoryInstance 
+**************************************************************************************************************************/
+
+CFrameBufferMemoryInstance::CFrameBufferMemoryInstance(const std::string& sIdentifier, uint32_t nScreenWidth, uint32_t nScreenHeight, LibMCDriver_FrameBuffer::eFrameBufferBitDepth bitDepth)
+:   CFrameBufferInstance (sIdentifier),
+    m_nLineLength (0),
+    m_nDisplayedBufferIndex (0)
+{
+    switch (bitDepth) {
+    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB565:
+    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGB888:
+    case LibMCDriver_FrameBuffer::eFrameBufferBitDepth::RGBA8888:
+        break;
+    default:
+        throw ELibMCDriver_FrameBufferInterfaceException(LIBMCDRIVER_FRAMEBUFFER_ERROR_UNKNOWNFRAMEBUFFERBITDEPTH);
+    }
+
+    setScreenResolution(nScreenWidth, nScreenHeight, bitDepth);
+
+    // Rows are padded to 4 bytes, like most framebuffer devices do
+    m_nLineLength = ((nScreenWidth * getBytesPerPixel()) + 3) & ~3UL;
+    m_BufferMemory.resize((size_t)m_nLineLength * nScreenHeight * 2);
+
+    // Both buffers start out black
+    m_nDisplayedBufferIndex = 0;
+    setDrawBuffer(getBuffer(1), m_nLineLength);
+}
+
+CFrameBufferMemoryInstance::~CFrameBufferMemoryInstance()
+{
+}
+
+uint8_t* CFrameBufferMemoryInstance::getBuffer(uint32_t nBufferIndex)
+{
+    return m_BufferMemory.data() + (size_t)m_nLineLength * getScreenHeight() * nBufferIndex;
+}
+
+void CFrameBufferMemoryInstance::flip()
+{
+    uint8_t* pDisplayedBuffer = getBuffer(1 - m_nDisplayedBufferIndex);
+    uint8_t* pDrawBuffer = getBuffer(m_nDisplayedBufferIndex);
+
+    m_nDisplayedBufferIndex = 1 - m_nDisplayedBufferIndex;
+    setDrawBuffer(pDrawBuffer, m_nLineLength);
+
+    // The new draw buffer still holds the frame before the last one
+    copyDirtyRegion(pDisplayedBuffer, pDrawBuffer);
+    resetDirtyRegion();
+}
+
+bool CFrameBufferMemoryInstance::usesDoubleBuffering()
+{
+    return true;
+}
+
+const uint8_t* CFrameBufferMemoryInstance::getDisplayedBuffer()
+{
+    return getBuffer(m_nDisplayedBufferIndex);
+}
+
+uint32_t CFrameBufferMemoryInstance::getLineLength()
+{
+    return m_nLineLength;
+}
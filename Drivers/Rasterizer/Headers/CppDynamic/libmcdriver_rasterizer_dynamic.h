@@ -306,6 +306,44 @@ typedef LibMCDriver_RasterizerResult (*PLibMCDriver_RasterizerRasterizer_SetSamp
 */
 typedef LibMCDriver_RasterizerResult (*PLibMCDriver_RasterizerRasterizer_GetSamplingParametersPtr) (LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 * pUnitsPerSubpixel, LibMCDriver_Rasterizer_uint32 * pPixelsPerBlock);
 
+/**
+* Sets the number of worker threads that are used to calculate the image. Block rows are distributed over the threads.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[in] nThreadCount - Number of threads. 0 uses the number of hardware threads, 1 calculates the image on the calling thread. Maximum 256.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_RasterizerResult (*PLibMCDriver_RasterizerRasterizer_SetThreadCountPtr) (LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 nThreadCount);
+
+/**
+* Returns the number of worker threads that are used to calculate the image.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[out] pThreadCount - Number of threads. 0 uses the number of hardware threads.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_RasterizerResult (*PLibMCDriver_RasterizerRasterizer_GetThreadCountPtr) (LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 * pThreadCount);
+
+/**
+* Enables or disables the vectorized span kernels. If disabled, the scalar reference kernels are used. Both produce identical images.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[in] bEnabled - If true, the fastest kernels supported by the CPU are selected at runtime. Default is true.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_RasterizerResult (*PLibMCDriver_RasterizerRasterizer_SetSIMDKernelsEnabledPtr) (LibMCDriver_Rasterizer_Rasterizer pRasterizer, bool bEnabled);
+
+/**
+* Returns the name of the span kernels that are used to calculate the image.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[in] nKernelNameBufferSize - size of the buffer (including trailing 0)
+* @param[out] pKernelNameNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pKernelNameBuffer -  buffer of One of scalar, sse2 or avx2., may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_RasterizerResult (*PLibMCDriver_RasterizerRasterizer_GetSIMDKernelNamePtr) (LibMCDriver_Rasterizer_Rasterizer pRasterizer, const LibMCDriver_Rasterizer_uint32 nKernelNameBufferSize, LibMCDriver_Rasterizer_uint32* pKernelNameNeededChars, char * pKernelNameBuffer);
+
 /**
 * Adds a layer object to subsample.
 *
@@ -315,6 +353,45 @@ typedef LibMCDriver_RasterizerResult (*PLibMCDriver_RasterizerRasterizer_GetSamp
 */
 typedef LibMCDriver_RasterizerResult (*PLibMCDriver_RasterizerRasterizer_AddLayerPtr) (LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_LayerObject pLayerObject);
 
+/**
+* Adds the closed loops of a toolpath layer. The loop points are streamed into the rasterization when the image is calculated, without copying them into a layer object.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[in] pToolpathLayer - Toolpath layer instance. Polylines and hatches are ignored.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_RasterizerResult (*PLibMCDriver_RasterizerRasterizer_AddToolpathLayerPtr) (LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCEnv_ToolpathLayer pToolpathLayer);
+
+/**
+* Adds a layer of a slice stack without creating an intermediate layer object.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[in] pSliceStack - Slice stack instance.
+* @param[in] nLayerIndex - Index of the layer. Must be smaller than the layer count of the slice stack.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_RasterizerResult (*PLibMCDriver_RasterizerRasterizer_AddSliceStackLayerPtr) (LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_SliceStack pSliceStack, LibMCDriver_Rasterizer_uint32 nLayerIndex);
+
+/**
+* Removes all layers from the rasterizer. The line buffers of the previous calculation are kept and reused for the next image.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_RasterizerResult (*PLibMCDriver_RasterizerRasterizer_ClearLayersPtr) (LibMCDriver_Rasterizer_Rasterizer pRasterizer);
+
+/**
+* Returns statistics of the last image calculation.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[out] pLayerCount - Number of layers that have been rasterized.
+* @param[out] pLineCount - Number of lines that have been added to the rasterization.
+* @param[out] pAllocationCount - Number of line and block buffer allocations. Buffers that could be reused from the previous calculation are not counted.
+* @param[out] pDurationInMicroseconds - Duration of the calculation in microseconds.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_RasterizerResult (*PLibMCDriver_RasterizerRasterizer_GetCalculationStatisticsPtr) (LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 * pLayerCount, LibMCDriver_Rasterizer_uint64 * pLineCount, LibMCDriver_Rasterizer_uint32 * pAllocationCount, LibMCDriver_Rasterizer_uint64 * pDurationInMicroseconds);
+
 /**
 * Calculates the image.
 *
@@ -543,7 +620,15 @@ typedef struct {
 	PLibMCDriver_RasterizerRasterizer_GetSubsamplingPtr m_Rasterizer_GetSubsampling;
 	PLibMCDriver_RasterizerRasterizer_SetSamplingParametersPtr m_Rasterizer_SetSamplingParameters;
 	PLibMCDriver_RasterizerRasterizer_GetSamplingParametersPtr m_Rasterizer_GetSamplingParameters;
+	PLibMCDriver_RasterizerRasterizer_SetThreadCountPtr m_Rasterizer_SetThreadCount;
+	PLibMCDriver_RasterizerRasterizer_GetThreadCountPtr m_Rasterizer_GetThreadCount;
+	PLibMCDriver_RasterizerRasterizer_SetSIMDKernelsEnabledPtr m_Rasterizer_SetSIMDKernelsEnabled;
+	PLibMCDriver_RasterizerRasterizer_GetSIMDKernelNamePtr m_Rasterizer_GetSIMDKernelName;
 	PLibMCDriver_RasterizerRasterizer_AddLayerPtr m_Rasterizer_AddLayer;
+	PLibMCDriver_RasterizerRasterizer_AddToolpathLayerPtr m_Rasterizer_AddToolpathLayer;
+	PLibMCDriver_RasterizerRasterizer_AddSliceStackLayerPtr m_Rasterizer_AddSliceStackLayer;
+	PLibMCDriver_RasterizerRasterizer_ClearLayersPtr m_Rasterizer_ClearLayers;
+	PLibMCDriver_RasterizerRasterizer_GetCalculationStatisticsPtr m_Rasterizer_GetCalculationStatistics;
 	PLibMCDriver_RasterizerRasterizer_CalculateImagePtr m_Rasterizer_CalculateImage;
 	PLibMCDriver_RasterizerSliceStack_GetLayerCountPtr m_SliceStack_GetLayerCount;
 	PLibMCDriver_RasterizerSliceStack_GetLayerThicknessPtr m_SliceStack_GetLayerThickness;
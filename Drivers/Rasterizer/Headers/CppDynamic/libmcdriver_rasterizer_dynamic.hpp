@@ -213,6 +213,8 @@ public:
 			case LIBMCDRIVER_RASTERIZER_ERROR_TOOMANYLINESINLAYER: return "TOOMANYLINESINLAYER";
 			case LIBMCDRIVER_RASTERIZER_ERROR_INVALIDHATCHCOUNT: return "INVALIDHATCHCOUNT";
 			case LIBMCDRIVER_RASTERIZER_ERROR_RASTERIZATIONNOTINITIALIZED: return "RASTERIZATIONNOTINITIALIZED";
+			case LIBMCDRIVER_RASTERIZER_ERROR_INVALIDTHREADCOUNT: return "INVALIDTHREADCOUNT";
+			case LIBMCDRIVER_RASTERIZER_ERROR_INVALIDLAYERINDEX: return "INVALIDLAYERINDEX";
 		}
 		return "UNKNOWN";
 	}
@@ -256,6 +258,8 @@ public:
 			case LIBMCDRIVER_RASTERIZER_ERROR_TOOMANYLINESINLAYER: return "too many lines in layer";
 			case LIBMCDRIVER_RASTERIZER_ERROR_INVALIDHATCHCOUNT: return "invalid hatch count";
 			case LIBMCDRIVER_RASTERIZER_ERROR_RASTERIZATIONNOTINITIALIZED: return "rasterization not initialized";
+			case LIBMCDRIVER_RASTERIZER_ERROR_INVALIDTHREADCOUNT: return "invalid thread count";
+			case LIBMCDRIVER_RASTERIZER_ERROR_INVALIDLAYERINDEX: return "invalid layer index";
 		}
 		return "unknown error";
 	}
@@ -513,7 +517,15 @@ public:
 	inline void GetSubsampling(LibMCDriver_Rasterizer_uint32 & nSubsamplingX, LibMCDriver_Rasterizer_uint32 & nSubsamplingY);
 	inline void SetSamplingParameters(const LibMCDriver_Rasterizer_uint32 nUnitsPerSubpixel, const LibMCDriver_Rasterizer_uint32 nPixelsPerBlock);
 	inline void GetSamplingParameters(LibMCDriver_Rasterizer_uint32 & nUnitsPerSubpixel, LibMCDriver_Rasterizer_uint32 & nPixelsPerBlock);
+	inline void SetThreadCount(const LibMCDriver_Rasterizer_uint32 nThreadCount);
+	inline LibMCDriver_Rasterizer_uint32 GetThreadCount();
+	inline void SetSIMDKernelsEnabled(const bool bEnabled);
+	inline std::string GetSIMDKernelName();
 	inline void AddLayer(classParam<CLayerObject> pLayerObject);
+	inline void AddToolpathLayer(classParam<LibMCEnv::CToolpathLayer> pToolpathLayer);
+	inline void AddSliceStackLayer(classParam<CSliceStack> pSliceStack, const LibMCDriver_Rasterizer_uint32 nLayerIndex);
+	inline void ClearLayers();
+	inline void GetCalculationStatistics(LibMCDriver_Rasterizer_uint32 & nLayerCount, LibMCDriver_Rasterizer_uint64 & nLineCount, LibMCDriver_Rasterizer_uint32 & nAllocationCount, LibMCDriver_Rasterizer_uint64 & nDurationInMicroseconds);
 	inline void CalculateImage(classParam<LibMCEnv::CImageData> pImageObject, const bool bAntialiased);
 };
 	
@@ -706,7 +718,15 @@ public:
 		pWrapperTable->m_Rasterizer_GetSubsampling = nullptr;
 		pWrapperTable->m_Rasterizer_SetSamplingParameters = nullptr;
 		pWrapperTable->m_Rasterizer_GetSamplingParameters = nullptr;
+		pWrapperTable->m_Rasterizer_SetThreadCount = nullptr;
+		pWrapperTable->m_Rasterizer_GetThreadCount = nullptr;
+		pWrapperTable->m_Rasterizer_SetSIMDKernelsEnabled = nullptr;
+		pWrapperTable->m_Rasterizer_GetSIMDKernelName = nullptr;
 		pWrapperTable->m_Rasterizer_AddLayer = nullptr;
+		pWrapperTable->m_Rasterizer_AddToolpathLayer = nullptr;
+		pWrapperTable->m_Rasterizer_AddSliceStackLayer = nullptr;
+		pWrapperTable->m_Rasterizer_ClearLayers = nullptr;
+		pWrapperTable->m_Rasterizer_GetCalculationStatistics = nullptr;
 		pWrapperTable->m_Rasterizer_CalculateImage = nullptr;
 		pWrapperTable->m_SliceStack_GetLayerCount = nullptr;
 		pWrapperTable->m_SliceStack_GetLayerThickness = nullptr;
@@ -992,6 +1012,42 @@ public:
 		if (pWrapperTable->m_Rasterizer_GetSamplingParameters == nullptr)
 			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Rasterizer_SetThreadCount = (PLibMCDriver_RasterizerRasterizer_SetThreadCountPtr) GetProcAddress(hLibrary, "libmcdriver_rasterizer_rasterizer_setthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Rasterizer_SetThreadCount = (PLibMCDriver_RasterizerRasterizer_SetThreadCountPtr) dlsym(hLibrary, "libmcdriver_rasterizer_rasterizer_setthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Rasterizer_SetThreadCount == nullptr)
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Rasterizer_GetThreadCount = (PLibMCDriver_RasterizerRasterizer_GetThreadCountPtr) GetProcAddress(hLibrary, "libmcdriver_rasterizer_rasterizer_getthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Rasterizer_GetThreadCount = (PLibMCDriver_RasterizerRasterizer_GetThreadCountPtr) dlsym(hLibrary, "libmcdriver_rasterizer_rasterizer_getthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Rasterizer_GetThreadCount == nullptr)
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Rasterizer_SetSIMDKernelsEnabled = (PLibMCDriver_RasterizerRasterizer_SetSIMDKernelsEnabledPtr) GetProcAddress(hLibrary, "libmcdriver_rasterizer_rasterizer_setsimdkernelsenabled");
+		#else // _WIN32
+		pWrapperTable->m_Rasterizer_SetSIMDKernelsEnabled = (PLibMCDriver_RasterizerRasterizer_SetSIMDKernelsEnabledPtr) dlsym(hLibrary, "libmcdriver_rasterizer_rasterizer_setsimdkernelsenabled");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Rasterizer_SetSIMDKernelsEnabled == nullptr)
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Rasterizer_GetSIMDKernelName = (PLibMCDriver_RasterizerRasterizer_GetSIMDKernelNamePtr) GetProcAddress(hLibrary, "libmcdriver_rasterizer_rasterizer_getsimdkernelname");
+		#else // _WIN32
+		pWrapperTable->m_Rasterizer_GetSIMDKernelName = (PLibMCDriver_RasterizerRasterizer_GetSIMDKernelNamePtr) dlsym(hLibrary, "libmcdriver_rasterizer_rasterizer_getsimdkernelname");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Rasterizer_GetSIMDKernelName == nullptr)
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Rasterizer_AddLayer = (PLibMCDriver_RasterizerRasterizer_AddLayerPtr) GetProcAddress(hLibrary, "libmcdriver_rasterizer_rasterizer_addlayer");
 		#else // _WIN32
@@ -1001,6 +1057,42 @@ public:
 		if (pWrapperTable->m_Rasterizer_AddLayer == nullptr)
 			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Rasterizer_AddToolpathLayer = (PLibMCDriver_RasterizerRasterizer_AddToolpathLayerPtr) GetProcAddress(hLibrary, "libmcdriver_rasterizer_rasterizer_addtoolpathlayer");
+		#else // _WIN32
+		pWrapperTable->m_Rasterizer_AddToolpathLayer = (PLibMCDriver_RasterizerRasterizer_AddToolpathLayerPtr) dlsym(hLibrary, "libmcdriver_rasterizer_rasterizer_addtoolpathlayer");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Rasterizer_AddToolpathLayer == nullptr)
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Rasterizer_AddSliceStackLayer = (PLibMCDriver_RasterizerRasterizer_AddSliceStackLayerPtr) GetProcAddress(hLibrary, "libmcdriver_rasterizer_rasterizer_addslicestacklayer");
+		#else // _WIN32
+		pWrapperTable->m_Rasterizer_AddSliceStackLayer = (PLibMCDriver_RasterizerRasterizer_AddSliceStackLayerPtr) dlsym(hLibrary, "libmcdriver_rasterizer_rasterizer_addslicestacklayer");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Rasterizer_AddSliceStackLayer == nullptr)
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Rasterizer_ClearLayers = (PLibMCDriver_RasterizerRasterizer_ClearLayersPtr) GetProcAddress(hLibrary, "libmcdriver_rasterizer_rasterizer_clearlayers");
+		#else // _WIN32
+		pWrapperTable->m_Rasterizer_ClearLayers = (PLibMCDriver_RasterizerRasterizer_ClearLayersPtr) dlsym(hLibrary, "libmcdriver_rasterizer_rasterizer_clearlayers");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Rasterizer_ClearLayers == nullptr)
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Rasterizer_GetCalculationStatistics = (PLibMCDriver_RasterizerRasterizer_GetCalculationStatisticsPtr) GetProcAddress(hLibrary, "libmcdriver_rasterizer_rasterizer_getcalculationstatistics");
+		#else // _WIN32
+		pWrapperTable->m_Rasterizer_GetCalculationStatistics = (PLibMCDriver_RasterizerRasterizer_GetCalculationStatisticsPtr) dlsym(hLibrary, "libmcdriver_rasterizer_rasterizer_getcalculationstatistics");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Rasterizer_GetCalculationStatistics == nullptr)
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Rasterizer_CalculateImage = (PLibMCDriver_RasterizerRasterizer_CalculateImagePtr) GetProcAddress(hLibrary, "libmcdriver_rasterizer_rasterizer_calculateimage");
 		#else // _WIN32
@@ -1284,10 +1376,42 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_Rasterizer_GetSamplingParameters == nullptr) )
 			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_rasterizer_rasterizer_setthreadcount", (void**)&(pWrapperTable->m_Rasterizer_SetThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Rasterizer_SetThreadCount == nullptr) )
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_rasterizer_rasterizer_getthreadcount", (void**)&(pWrapperTable->m_Rasterizer_GetThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Rasterizer_GetThreadCount == nullptr) )
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_rasterizer_rasterizer_setsimdkernelsenabled", (void**)&(pWrapperTable->m_Rasterizer_SetSIMDKernelsEnabled));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Rasterizer_SetSIMDKernelsEnabled == nullptr) )
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_rasterizer_rasterizer_getsimdkernelname", (void**)&(pWrapperTable->m_Rasterizer_GetSIMDKernelName));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Rasterizer_GetSIMDKernelName == nullptr) )
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_rasterizer_rasterizer_addlayer", (void**)&(pWrapperTable->m_Rasterizer_AddLayer));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Rasterizer_AddLayer == nullptr) )
 			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_rasterizer_rasterizer_addtoolpathlayer", (void**)&(pWrapperTable->m_Rasterizer_AddToolpathLayer));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Rasterizer_AddToolpathLayer == nullptr) )
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_rasterizer_rasterizer_addslicestacklayer", (void**)&(pWrapperTable->m_Rasterizer_AddSliceStackLayer));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Rasterizer_AddSliceStackLayer == nullptr) )
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_rasterizer_rasterizer_clearlayers", (void**)&(pWrapperTable->m_Rasterizer_ClearLayers));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Rasterizer_ClearLayers == nullptr) )
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_rasterizer_rasterizer_getcalculationstatistics", (void**)&(pWrapperTable->m_Rasterizer_GetCalculationStatistics));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Rasterizer_GetCalculationStatistics == nullptr) )
+			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_rasterizer_rasterizer_calculateimage", (void**)&(pWrapperTable->m_Rasterizer_CalculateImage));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Rasterizer_CalculateImage == nullptr) )
 			return LIBMCDRIVER_RASTERIZER_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -1681,6 +1805,51 @@ public:
 		CheckError(m_pWrapper->m_WrapperTable.m_Rasterizer_GetSamplingParameters(m_pHandle, &nUnitsPerSubpixel, &nPixelsPerBlock));
 	}
 	
+	/**
+	* CRasterizer::SetThreadCount - Sets the number of worker threads that are used to calculate the image. Block rows are distributed over the threads.
+	* @param[in] nThreadCount - Number of threads. 0 uses the number of hardware threads, 1 calculates the image on the calling thread. Maximum 256.
+	*/
+	void CRasterizer::SetThreadCount(const LibMCDriver_Rasterizer_uint32 nThreadCount)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Rasterizer_SetThreadCount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CRasterizer::GetThreadCount - Returns the number of worker threads that are used to calculate the image.
+	* @return Number of threads. 0 uses the number of hardware threads.
+	*/
+	LibMCDriver_Rasterizer_uint32 CRasterizer::GetThreadCount()
+	{
+		LibMCDriver_Rasterizer_uint32 resultThreadCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Rasterizer_GetThreadCount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
+	/**
+	* CRasterizer::SetSIMDKernelsEnabled - Enables or disables the vectorized span kernels. If disabled, the scalar reference kernels are used. Both produce identical images.
+	* @param[in] bEnabled - If true, the fastest kernels supported by the CPU are selected at runtime. Default is true.
+	*/
+	void CRasterizer::SetSIMDKernelsEnabled(const bool bEnabled)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Rasterizer_SetSIMDKernelsEnabled(m_pHandle, bEnabled));
+	}
+	
+	/**
+	* CRasterizer::GetSIMDKernelName - Returns the name of the span kernels that are used to calculate the image.
+	* @return One of scalar, sse2 or avx2.
+	*/
+	std::string CRasterizer::GetSIMDKernelName()
+	{
+		LibMCDriver_Rasterizer_uint32 bytesNeededKernelName = 0;
+		LibMCDriver_Rasterizer_uint32 bytesWrittenKernelName = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Rasterizer_GetSIMDKernelName(m_pHandle, 0, &bytesNeededKernelName, nullptr));
+		std::vector<char> bufferKernelName(bytesNeededKernelName);
+		CheckError(m_pWrapper->m_WrapperTable.m_Rasterizer_GetSIMDKernelName(m_pHandle, bytesNeededKernelName, &bytesWrittenKernelName, &bufferKernelName[0]));
+		
+		return std::string(&bufferKernelName[0]);
+	}
+	
 	/**
 	* CRasterizer::AddLayer - Adds a layer object to subsample.
 	* @param[in] pLayerObject - Layer object instance.
@@ -1691,6 +1860,47 @@ public:
 		CheckError(m_pWrapper->m_WrapperTable.m_Rasterizer_AddLayer(m_pHandle, hLayerObject));
 	}
 	
+	/**
+	* CRasterizer::AddToolpathLayer - Adds the closed loops of a toolpath layer. The loop points are streamed into the rasterization when the image is calculated, without copying them into a layer object.
+	* @param[in] pToolpathLayer - Toolpath layer instance. Polylines and hatches are ignored.
+	*/
+	void CRasterizer::AddToolpathLayer(classParam<LibMCEnv::CToolpathLayer> pToolpathLayer)
+	{
+		LibMCEnvHandle hToolpathLayer = pToolpathLayer.GetHandle();
+		CheckError(m_pWrapper->m_WrapperTable.m_Rasterizer_AddToolpathLayer(m_pHandle, hToolpathLayer));
+	}
+	
+	/**
+	* CRasterizer::AddSliceStackLayer - Adds a layer of a slice stack without creating an intermediate layer object.
+	* @param[in] pSliceStack - Slice stack instance.
+	* @param[in] nLayerIndex - Index of the layer. Must be smaller than the layer count of the slice stack.
+	*/
+	void CRasterizer::AddSliceStackLayer(classParam<CSliceStack> pSliceStack, const LibMCDriver_Rasterizer_uint32 nLayerIndex)
+	{
+		LibMCDriver_RasterizerHandle hSliceStack = pSliceStack.GetHandle();
+		CheckError(m_pWrapper->m_WrapperTable.m_Rasterizer_AddSliceStackLayer(m_pHandle, hSliceStack, nLayerIndex));
+	}
+	
+	/**
+	* CRasterizer::ClearLayers - Removes all layers from the rasterizer. The line buffers of the previous calculation are kept and reused for the next image.
+	*/
+	void CRasterizer::ClearLayers()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Rasterizer_ClearLayers(m_pHandle));
+	}
+	
+	/**
+	* CRasterizer::GetCalculationStatistics - Returns statistics of the last image calculation.
+	* @param[out] nLayerCount - Number of layers that have been rasterized.
+	* @param[out] nLineCount - Number of lines that have been added to the rasterization.
+	* @param[out] nAllocationCount - Number of line and block buffer allocations. Buffers that could be reused from the previous calculation are not counted.
+	* @param[out] nDurationInMicroseconds - Duration of the calculation in microseconds.
+	*/
+	void CRasterizer::GetCalculationStatistics(LibMCDriver_Rasterizer_uint32 & nLayerCount, LibMCDriver_Rasterizer_uint64 & nLineCount, LibMCDriver_Rasterizer_uint32 & nAllocationCount, LibMCDriver_Rasterizer_uint64 & nDurationInMicroseconds)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Rasterizer_GetCalculationStatistics(m_pHandle, &nLayerCount, &nLineCount, &nAllocationCount, &nDurationInMicroseconds));
+	}
+	
 	/**
 	* CRasterizer::CalculateImage - Calculates the image.
 	* @param[in] pImageObject - ImageObject Instance to render into
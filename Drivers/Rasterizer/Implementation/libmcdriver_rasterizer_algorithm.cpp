@@ -31,10 +31,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "libmcdriver_rasterizer_algorithm.hpp"
 #include "libmcdriver_rasterizer_interfaceexception.hpp"
+#include "common_parallelblocks.hpp"
 
 #include <cmath>
 #include <string>
 #include <map>
+#include <thread>
 
 using namespace LibMCDriver_Rasterizer::Impl;
 
@@ -141,8 +143,8 @@ CRasterizationAlgorithm::CRasterizationAlgorithm(uint32_t nUnitsPerSubPixel, uin
     m_nDisregardedLineCount (0),
     m_LineItemBufferCapacity (0),
     m_LineItemBufferIndex (0),
-    m_nCurrentDrawLineBufferIndex (0),
-    m_nBlocksInUse (0)
+    m_nBlocksInUse (0),
+    m_nBufferAllocationCount (0)
 
 {
     if ((nUnitsPerSubPixel < RASTERALGORITHM_MINUNITSPERSUBPIXEL) || (nUnitsPerSubPixel > RASTERALGORITHM_MAXUNITSPERSUBPIXEL) || ((nUnitsPerSubPixel % 2) != 0))
@@ -173,7 +175,10 @@ CRasterizationAlgorithm::CRasterizationAlgorithm(uint32_t nUnitsPerSubPixel, uin
 
     m_Blocks.resize((uint64_t)nBlockCountX * (uint64_t)nBlockCountY);
     m_ScanSeedValueBuffer.resize(m_Blocks.size() * m_nScanLinesPerBlock);
-    m_DrawLineBuffer.resize(1024 * 1024 * 16);
+    m_DrawLineBuffers.resize(1);
+
+    // Block and seed value buffers, and the reserved lines
+    m_nBufferAllocationCount = (m_nExpectedLineCount > 0) ? 3 : 2;
 
     int32_t* pCurrentSeedValueBuffer = m_ScanSeedValueBuffer.data ();
     for (auto& value : m_ScanSeedValueBuffer) 
@@ -197,6 +202,52 @@ CRasterizationAlgorithm::~CRasterizationAlgorithm()
 
 }
 
+void CRasterizationAlgorithm::reset(uint32_t nExpectedLineCount)
+{
+    m_nExpectedLineCount = nExpectedLineCount;
+    m_nNegativeHalfPlaneLineCount = 0;
+    m_nDisregardedLineCount = 0;
+    m_LineItemBufferCapacity = 0;
+    m_LineItemBufferIndex = 0;
+    m_nBufferAllocationCount = 0;
+
+    m_Lines.clear();
+    if (m_Lines.capacity() < nExpectedLineCount) {
+        m_Lines.reserve(nExpectedLineCount);
+        m_nBufferAllocationCount++;
+    }
+
+    for (auto& value : m_ScanSeedValueBuffer)
+        value = 0;
+
+    for (auto& block : m_Blocks) {
+        block.m_pFirstItem = nullptr;
+        block.m_nLineCount = 0;
+        block.m_Type = eBlockType::btUnknown;
+        block.m_pDrawLineRoot = nullptr;
+    }
+    m_nBlocksInUse = 0;
+
+    for (auto& drawLineBuffer : m_DrawLineBuffers)
+        drawLineBuffer.clear();
+}
+
+bool CRasterizationAlgorithm::hasConfiguration(uint32_t nUnitsPerSubPixel, uint32_t nSubPixelsPerPixelX, uint32_t nSubPixelsPerPixelY, uint32_t nPixelsPerBlock, uint32_t nBlockCountX, uint32_t nBlockCountY)
+{
+    return (m_nUnitsPerSubPixel == nUnitsPerSubPixel) && (m_nSubPixelsPerPixelX == nSubPixelsPerPixelX) && (m_nSubPixelsPerPixelY == nSubPixelsPerPixelY)
+        && (m_nPixelsPerBlock == nPixelsPerBlock) && (m_nBlockCountX == nBlockCountX) && (m_nBlockCountY == nBlockCountY);
+}
+
+uint64_t CRasterizationAlgorithm::getLineCount()
+{
+    return m_Lines.size();
+}
+
+uint32_t CRasterizationAlgorithm::getBufferAllocationCount()
+{
+    return m_nBufferAllocationCount;
+}
+
 bool CRasterizationAlgorithm::isOnScanLineX(int32_t nXunits)
 {
     return ((nXunits % m_nUnitsPerHalfSubPixel) == 0);
@@ -265,6 +316,8 @@ void CRasterizationAlgorithm::addLineInternal(int32_t nX1units, int32_t nY1units
     sLine.m_nY2 = nY2units;
     sLine.m_nMetaData = nMetaData;
 
+    if (m_Lines.size() == m_Lines.capacity())
+        m_nBufferAllocationCount++;
     m_Lines.push_back(sLine);
 
     uint32_t nDeltaX = abs (nX1units - nX2units);
@@ -287,8 +340,11 @@ void CRasterizationAlgorithm::buildBlocks()
         block.m_Type = eBlockType::btUnknown;
     }
     m_nBlocksInUse = 0;
-    m_nCurrentDrawLineBufferIndex = 0;
+    for (auto& drawLineBuffer : m_DrawLineBuffers)
+        drawLineBuffer.clear();
 
+    if (m_LineListItemBuffer.capacity() < m_LineItemBufferCapacity)
+        m_nBufferAllocationCount++;
     m_LineListItemBuffer.resize(m_LineItemBufferCapacity);
     m_LineItemBufferIndex = 0;
 
@@ -350,7 +406,7 @@ eBlockType CRasterizationAlgorithm::getBlockInfo(int32_t nBlockX, int32_t nBlock
 
 }
 
-void CRasterizationAlgorithm::addBlockToBuffer(int32_t nBlockX, int32_t nBlockY, std::vector<uint32_t>& buffer)
+void CRasterizationAlgorithm::addBlockToBuffer(int32_t nBlockX, int32_t nBlockY, std::vector<uint32_t>& buffer, eSpanKernelType kernelType)
 {
     __RASTERASSERT(buffer.size () == ((size_t)m_nPixelsPerBlock * m_nPixelsPerBlock), "invalid buffer block size");
 
@@ -381,8 +437,8 @@ void CRasterizationAlgorithm::addBlockToBuffer(int32_t nBlockX, int32_t nBlockY,
             __RASTERASSERT((nStartXInPixels >= 0) && (nStartXInPixels < (int32_t)m_nPixelsPerBlock), "invalid draw line start x pixel value");
             __RASTERASSERT((nEndXInPixels >= 0) && (nEndXInPixels < (int32_t)m_nPixelsPerBlock), "invalid draw line end x pixel value");
 
-            for (int nX = nStartXInPixels; nX <= (int32_t) nEndXInPixels; nX++)
-                buffer[(size_t)nX + nYInPixels * (size_t)m_nPixelsPerBlock] = 255;
+            if (nStartXInPixels <= nEndXInPixels)
+                CSpanKernels::fillSpan(kernelType, &buffer[(size_t)nStartXInPixels + nYInPixels * (size_t)m_nPixelsPerBlock], nEndXInPixels - nStartXInPixels + 1, 255);
 
             pDrawLine = pDrawLine->m_pNext;
         }
@@ -618,6 +674,56 @@ bool lineIsOnScanline (int32_t nYValue, sRasterLine * pLine, double & dXValue)
 }
 
 void CRasterizationAlgorithm::buildBlockScanLines(uint32_t nBlockIndexX, uint32_t nBlockIndexY)
+{
+    buildBlockScanLinesInternal(nBlockIndexX, nBlockIndexY, m_DrawLineBuffers.at(0));
+}
+
+void CRasterizationAlgorithm::buildAllBlockScanLines(uint32_t nThreadCount)
+{
+    nThreadCount = resolveThreadCount(nThreadCount);
+    if (nThreadCount > m_nBlockCountY)
+        nThreadCount = m_nBlockCountY;
+
+    if (m_DrawLineBuffers.size() < nThreadCount)
+        m_DrawLineBuffers.resize(nThreadCount);
+
+    AMCCommon::CParallelBlocks::processBlocks(nThreadCount, m_nBlockCountY, 1, [this](uint32_t nThreadIndex, size_t nFirstBlockY, size_t nBlockRowCount) {
+        auto& drawLineBuffer = m_DrawLineBuffers.at(nThreadIndex);
+        for (uint32_t nBlockIndexY = (uint32_t)nFirstBlockY; nBlockIndexY < (uint32_t)(nFirstBlockY + nBlockRowCount); nBlockIndexY++) {
+            // Blocks of a row must be processed from left to right, as each block seeds the winding numbers of its right neighbour.
+            for (uint32_t nBlockIndexX = 0; nBlockIndexX < m_nBlockCountX; nBlockIndexX++)
+                buildBlockScanLinesInternal(nBlockIndexX, nBlockIndexY, drawLineBuffer);
+        }
+    });
+}
+
+uint32_t CRasterizationAlgorithm::getBlockCountX()
+{
+    return m_nBlockCountX;
+}
+
+uint32_t CRasterizationAlgorithm::getBlockCountY()
+{
+    return m_nBlockCountY;
+}
+
+uint32_t CRasterizationAlgorithm::resolveThreadCount(uint32_t nThreadCount)
+{
+    if (nThreadCount > RASTERALGORITHM_MAXTHREADCOUNT)
+        throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDTHREADCOUNT);
+
+    if (nThreadCount == 0) {
+        nThreadCount = std::thread::hardware_concurrency();
+        if (nThreadCount == 0)
+            nThreadCount = 1;
+        if (nThreadCount > RASTERALGORITHM_MAXTHREADCOUNT)
+            nThreadCount = RASTERALGORITHM_MAXTHREADCOUNT;
+    }
+
+    return nThreadCount;
+}
+
+void CRasterizationAlgorithm::buildBlockScanLinesInternal(uint32_t nBlockIndexX, uint32_t nBlockIndexY, std::deque<sRasterBlockDrawLine>& drawLineBuffer)
 {
     auto pBlock = getBlock(nBlockIndexX, nBlockIndexY);
     if (pBlock == nullptr)
@@ -668,13 +774,13 @@ void CRasterizationAlgorithm::buildBlockScanLines(uint32_t nBlockIndexX, uint32_
             if (bIsOldInside && !bIsInside) {
                 dEndX = iIter.first;
 
-                addDrawLineToBlock (pBlock, (int32_t) round(dStartX), (int32_t) round(dEndX), nYRelativeToBlock);
+                addDrawLineToBlock (pBlock, (int32_t) round(dStartX), (int32_t) round(dEndX), nYRelativeToBlock, drawLineBuffer);
             }
 
         }
 
         if (bIsInside) {
-            addDrawLineToBlock(pBlock, (int32_t)round(dStartX), m_nUnitsPerBlockX - 1, nYRelativeToBlock);
+            addDrawLineToBlock(pBlock, (int32_t)round(dStartX), m_nUnitsPerBlockX - 1, nYRelativeToBlock, drawLineBuffer);
         }
 
         if (pNextBlock != nullptr) {
@@ -687,14 +793,12 @@ void CRasterizationAlgorithm::buildBlockScanLines(uint32_t nBlockIndexX, uint32_
 
 }
 
-void CRasterizationAlgorithm::addDrawLineToBlock(_sRasterBlockStructure* pBlock, int32_t nStartXInUnits, int32_t nEndXInUnits, int32_t nYValueInUnits)
+void CRasterizationAlgorithm::addDrawLineToBlock(_sRasterBlockStructure* pBlock, int32_t nStartXInUnits, int32_t nEndXInUnits, int32_t nYValueInUnits, std::deque<sRasterBlockDrawLine>& drawLineBuffer)
 {
     __RASTERASSERT(pBlock != nullptr, "invalid block parameter");
-    if (m_nCurrentDrawLineBufferIndex >= m_DrawLineBuffer.size())
-        throw std::runtime_error("draw line buffer overflow!");
 
-    sRasterBlockDrawLine* pDrawLine = &m_DrawLineBuffer.at(m_nCurrentDrawLineBufferIndex);
-    m_nCurrentDrawLineBufferIndex++;
+    drawLineBuffer.emplace_back();
+    sRasterBlockDrawLine* pDrawLine = &drawLineBuffer.back();
 
     pDrawLine->m_nStartXInUnits = nStartXInUnits;
     pDrawLine->m_nEndXInUnits = nEndXInUnits;
@@ -705,3 +809,44 @@ void CRasterizationAlgorithm::addDrawLineToBlock(_sRasterBlockStructure* pBlock,
 }
 
 
+
+
+CRasterizationArena::CRasterizationArena()
+{
+
+}
+
+CRasterizationArena::~CRasterizationArena()
+{
+
+}
+
+PRasterizationAlgorithm CRasterizationArena::acquireAlgorithm(uint32_t nUnitsPerSubPixel, uint32_t nSubPixelsPerPixelX, uint32_t nSubPixelsPerPixelY, uint32_t nPixelsPerBlock, uint32_t nBlockCountX, uint32_t nBlockCountY, uint32_t nExpectedLineCount)
+{
+    while (!m_FreeAlgorithms.empty()) {
+        PRasterizationAlgorithm pAlgorithm = m_FreeAlgorithms.back();
+        m_FreeAlgorithms.pop_back();
+
+        // Algorithms with a different configuration cannot be reused, as their block structure differs.
+        if (pAlgorithm->hasConfiguration(nUnitsPerSubPixel, nSubPixelsPerPixelX, nSubPixelsPerPixelY, nPixelsPerBlock, nBlockCountX, nBlockCountY)) {
+            pAlgorithm->reset(nExpectedLineCount);
+            return pAlgorithm;
+        }
+    }
+
+    return std::make_shared<CRasterizationAlgorithm>(nUnitsPerSubPixel, nSubPixelsPerPixelX, nSubPixelsPerPixelY, nPixelsPerBlock, nBlockCountX, nBlockCountY, nExpectedLineCount);
+}
+
+void CRasterizationArena::releaseAlgorithms(std::vector<PRasterizationAlgorithm>& algorithms)
+{
+    // Algorithms are acquired from the back, so the first layer gets its previous buffers again
+    for (auto iIter = algorithms.rbegin(); iIter != algorithms.rend(); iIter++)
+        m_FreeAlgorithms.push_back(*iIter);
+
+    algorithms.clear();
+}
+
+void CRasterizationArena::clear()
+{
+    m_FreeAlgorithms.clear();
+}
@@ -34,8 +34,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define __LIBMCDRIVER_RASTERIZER_ALGORITHM
 
 #include <vector>
+#include <deque>
 #include <memory>
 
+#include "libmcdriver_rasterizer_spankernels.hpp"
+
 #define RASTERALGORITHM_MINUNITSPERSUBPIXEL 4
 #define RASTERALGORITHM_MAXUNITSPERSUBPIXEL (1024 * 1024)
 #define RASTERALGORITHM_DEFAULTUNITSPERSUBPIXEL 256
@@ -47,6 +50,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define RASTERALGORITHM_MAXPIXELSPERBLOCK 1024
 #define RASTERALGORITHM_DEFAULTPIXELSPERBLOCK 32
 
+// A thread count of 0 uses the number of hardware threads
+#define RASTERALGORITHM_MAXTHREADCOUNT 256
+#define RASTERALGORITHM_DEFAULTTHREADCOUNT 1
+
 namespace LibMCDriver_Rasterizer {
     namespace Impl {
 
@@ -142,8 +149,12 @@ namespace LibMCDriver_Rasterizer {
                 std::vector<sRasterLine> m_Lines;
                 std::vector<int32_t> m_ScanSeedValueBuffer;
 
-                uint64_t m_nCurrentDrawLineBufferIndex;
-                std::vector<sRasterBlockDrawLine> m_DrawLineBuffer;
+                // Number of buffer (re-)allocations since construction or the last reset
+                uint32_t m_nBufferAllocationCount;
+
+                // One draw line buffer per worker thread. Deques do not move their elements when growing,
+                // so the draw line lists of the blocks may point into them.
+                std::vector<std::deque<sRasterBlockDrawLine>> m_DrawLineBuffers;
 
                 bool isOnScanLineX(int32_t nXunits);
                 bool isOnScanLineY(int32_t nYunits);
@@ -155,23 +166,43 @@ namespace LibMCDriver_Rasterizer {
                 void buildBlocksRational (sRasterLine* pLine);
 
                 void addLineToBlock(sRasterLine* pLine, _sRasterBlockStructure* pBlock);
-                void addDrawLineToBlock(_sRasterBlockStructure* pBlock, int32_t nStartXInUnits, int32_t nEndXInUnits, int32_t nYValueInUnits);
+                void addDrawLineToBlock(_sRasterBlockStructure* pBlock, int32_t nStartXInUnits, int32_t nEndXInUnits, int32_t nYValueInUnits, std::deque<sRasterBlockDrawLine> & drawLineBuffer);
+
+                void buildBlockScanLinesInternal(uint32_t nBlockIndexX, uint32_t nBlockIndexY, std::deque<sRasterBlockDrawLine>& drawLineBuffer);
 
             public:
 
                 CRasterizationAlgorithm(uint32_t nUnitsPerSubPixel, uint32_t nSubPixelsPerPixelX, uint32_t nSubPixelsPerPixelY, uint32_t nPixelsPerBlock, uint32_t nBlockCountX, uint32_t nBlockCountY, uint32_t nExpectedLineCount);
                 ~CRasterizationAlgorithm();
 
+                // Prepares the algorithm for a new layer. All buffers keep their capacity.
+                void reset(uint32_t nExpectedLineCount);
+
+                bool hasConfiguration(uint32_t nUnitsPerSubPixel, uint32_t nSubPixelsPerPixelX, uint32_t nSubPixelsPerPixelY, uint32_t nPixelsPerBlock, uint32_t nBlockCountX, uint32_t nBlockCountY);
+
+                uint64_t getLineCount();
+                uint32_t getBufferAllocationCount();
+
                 void addLine(int32_t nX1units, int32_t nY1units, int32_t nX2units, int32_t nY2units, int32_t nMetaData);
 
                 void buildBlocks();
                 void buildBlockScanLines(uint32_t nBlockIndexX, uint32_t nBlockIndexY);
 
+                // Builds the scan lines of all blocks. Block rows are independent of each other
+                // (the winding number is only passed on in X), so they are distributed over nThreadCount threads.
+                void buildAllBlockScanLines(uint32_t nThreadCount);
+
+                uint32_t getBlockCountX();
+                uint32_t getBlockCountY();
+
+                // Returns the effective thread count (resolves 0 to the number of hardware threads).
+                static uint32_t resolveThreadCount(uint32_t nThreadCount);
+
                 sRasterBlockStructure* getBlock(uint32_t nBlockIndexX, uint32_t nBlockIndexY);
                 eBlockType getBlockInfoAtXY (int32_t nXunits, int32_t nYunits);
                 eBlockType getBlockInfo(int32_t nBlockX, int32_t nBlockY);
 
-                void addBlockToBuffer (int32_t nBlockX, int32_t nBlockY, std::vector<uint32_t> & buffer);
+                void addBlockToBuffer (int32_t nBlockX, int32_t nBlockY, std::vector<uint32_t> & buffer, eSpanKernelType kernelType);
 
                 
 
@@ -179,6 +210,31 @@ namespace LibMCDriver_Rasterizer {
 
         typedef std::shared_ptr<CRasterizationAlgorithm> PRasterizationAlgorithm;
 
+
+        // Keeps the algorithms of the previous image calculation, so that consecutive layers
+        // with the same rasterization parameters do not need to allocate their line and block buffers again.
+        class CRasterizationArena {
+            private:
+
+                std::vector<PRasterizationAlgorithm> m_FreeAlgorithms;
+
+            public:
+
+                CRasterizationArena();
+                ~CRasterizationArena();
+
+                // Returns a recycled algorithm if one with the same configuration is available, or creates a new one.
+                // An expected line count of 0 keeps the line capacity of the previous layer.
+                PRasterizationAlgorithm acquireAlgorithm(uint32_t nUnitsPerSubPixel, uint32_t nSubPixelsPerPixelX, uint32_t nSubPixelsPerPixelY, uint32_t nPixelsPerBlock, uint32_t nBlockCountX, uint32_t nBlockCountY, uint32_t nExpectedLineCount);
+
+                void releaseAlgorithms(std::vector<PRasterizationAlgorithm>& algorithms);
+
+                void clear();
+
+        };
+
+        typedef std::shared_ptr<CRasterizationArena> PRasterizationArena;
+
     }
 
 }
@@ -33,9 +33,12 @@ Abstract: This is a stub class definition of CImageObject
 
 #include "libmcdriver_rasterizer_imageobject.hpp"
 #include "libmcdriver_rasterizer_interfaceexception.hpp"
+#include "common_parallelblocks.hpp"
 
 // Include custom headers here.
 #include <cmath>
+#include <cstring>
+#include <algorithm>
 
 
 using namespace LibMCDriver_Rasterizer::Impl;
@@ -47,7 +50,8 @@ using namespace LibMCDriver_Rasterizer::Impl;
 CImageObject::CImageObject(const uint32_t nPixelCountX, const uint32_t nPixelCountY, const double dDPIValueX, const double dDPIValueY)
 	: m_nPixelCountX(nPixelCountX), m_nPixelCountY(nPixelCountY), m_dDPIValueX(dDPIValueX), m_dDPIValueY(dDPIValueY),
 	m_dPositionX(0.0), m_dPositionY(0.0), m_nBlockCountX(0), m_nBlockCountY(0), m_nUnitsPerSubPixel(0),
-	m_nSubSamplingX (0), m_nSubSamplingY (0), m_dUnitsX (0.0), m_dUnitsY (0.0), m_nPixelsPerBlock (0)
+	m_nSubSamplingX (0), m_nSubSamplingY (0), m_dUnitsX (0.0), m_dUnitsY (0.0), m_nPixelsPerBlock (0), m_nThreadCount (RASTERALGORITHM_DEFAULTTHREADCOUNT), m_SpanKernelType (eSpanKernelType::skScalar),
+	m_nRasterizedLineCount (0), m_nBufferAllocationCount (0)
 {
 	if (nPixelCountX <= 0)
 		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPIXELCOUNT);
@@ -195,7 +199,7 @@ std::vector<uint8_t>& CImageObject::getBuffer()
 }
 
 
-void CImageObject::initRasterizationAlgorithms(uint32_t nUnitsPerSubPixel, uint32_t nPixelsPerBlock, uint32_t nSubSamplingX, uint32_t nSubSamplingY)
+void CImageObject::initRasterizationAlgorithms(uint32_t nUnitsPerSubPixel, uint32_t nPixelsPerBlock, uint32_t nSubSamplingX, uint32_t nSubSamplingY, uint32_t nThreadCount, eSpanKernelType spanKernelType, PRasterizationArena pArena)
 {
 	if (nSubSamplingX < RASTERER_MINSUBSAMPLING)
 		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDSUBSAMPLING);
@@ -216,12 +220,21 @@ void CImageObject::initRasterizationAlgorithms(uint32_t nUnitsPerSubPixel, uint3
 
 	m_nSubSamplingX = nSubSamplingX;
 	m_nSubSamplingY = nSubSamplingY;
+	m_nThreadCount = CRasterizationAlgorithm::resolveThreadCount(nThreadCount);
+	m_SpanKernelType = spanKernelType;
+
+	if (pArena.get() != nullptr)
+		m_pArena = pArena;
+	else
+		m_pArena = std::make_shared<CRasterizationArena>();
 
 	m_Algorithms.clear();
+	m_nRasterizedLineCount = 0;
+	m_nBufferAllocationCount = 0;
 
 }
 
-void CImageObject::addRasterizationLayer(CLayerDataObject* pLayer)
+void CImageObject::addRasterizationLayer(CRasterizationLayerSource* pLayer)
 {
 	if (pLayer == nullptr)
 		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
@@ -230,16 +243,14 @@ void CImageObject::addRasterizationLayer(CLayerDataObject* pLayer)
 		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_RASTERIZATIONNOTINITIALIZED);
 
 	uint32_t nExpectedLineCount = (uint32_t) pLayer->calculateClosedPolygonLineCount();
-	auto pAlgorithm = std::make_shared<CRasterizationAlgorithm>(m_nUnitsPerSubPixel, m_nSubSamplingX, m_nSubSamplingY, m_nPixelsPerBlock, m_nBlockCountX, m_nBlockCountY, nExpectedLineCount);
+	auto pAlgorithm = m_pArena->acquireAlgorithm(m_nUnitsPerSubPixel, m_nSubSamplingX, m_nSubSamplingY, m_nPixelsPerBlock, m_nBlockCountX, m_nBlockCountY, nExpectedLineCount);
 
 	pLayer->addClosedPolygonsToAlgorithm(pAlgorithm.get(), m_dUnitsX, m_dUnitsY);
 	pAlgorithm->buildBlocks();
-	for (uint32_t nBlockY = 0; nBlockY < m_nBlockCountY; nBlockY++) {
-		for (uint32_t nBlockX = 0; nBlockX < m_nBlockCountX; nBlockX++) {
-			pAlgorithm->buildBlockScanLines (nBlockX, nBlockY);
-		}
-	}
-			
+	pAlgorithm->buildAllBlockScanLines(m_nThreadCount);
+
+	m_nRasterizedLineCount += pAlgorithm->getLineCount();
+	m_nBufferAllocationCount += pAlgorithm->getBufferAllocationCount();
 
 	m_Algorithms.push_back(pAlgorithm);
 
@@ -256,23 +267,43 @@ void CImageObject::calculateRasterizationImage(bool bAntiAliased)
 	uint32_t nValueRange = 255;
 	uint32_t nValueBWThreshold = nValueRange / 2;
 
-	std::vector<CRasterizationAlgorithm*> m_ActiveAlgorithms;
-	m_ActiveAlgorithms.resize (nNumberOfZSamples);
+	// Every thread works on complete block rows and writes them directly into the pixel buffer.
+	// Block rows do not overlap, so no synchronisation is necessary.
+	uint32_t nThreadCount = m_nThreadCount;
+	if (nThreadCount > m_nBlockCountY)
+		nThreadCount = m_nBlockCountY;
+
+	std::vector<std::vector<CRasterizationAlgorithm*>> activeAlgorithmsPerThread;
+	std::vector<std::vector<uint32_t>> blockBufferPerThread;
+	activeAlgorithmsPerThread.resize(nThreadCount);
+	blockBufferPerThread.resize(nThreadCount);
+	for (uint32_t nThreadIndex = 0; nThreadIndex < nThreadCount; nThreadIndex++) {
+		activeAlgorithmsPerThread[nThreadIndex].resize(nNumberOfZSamples);
+		blockBufferPerThread[nThreadIndex].resize((size_t)m_nPixelsPerBlock * (size_t)m_nPixelsPerBlock);
+	}
+
+	auto renderBlockRow = [&](uint32_t nThreadIndex, uint32_t nBlockY) {
+
+		auto& activeAlgorithms = activeAlgorithmsPerThread[nThreadIndex];
+		auto& blockBuffer = blockBufferPerThread[nThreadIndex];
+
+		// Blocks at the right and bottom border may extend beyond the image
+		uint32_t nBlockStartY = nBlockY * m_nPixelsPerBlock;
+		uint32_t nBlockPixelCountY = std::min(m_nPixelsPerBlock, m_nPixelCountY - nBlockStartY);
+
+		for (uint32_t nBlockX = 0; nBlockX < m_nBlockCountX; nBlockX++) {
 
-	std::vector<uint32_t> m_BlockBuffer;
-	m_BlockBuffer.resize((size_t)m_nPixelsPerBlock * (size_t)m_nPixelsPerBlock);
+			uint32_t nBlockStartX = nBlockX * m_nPixelsPerBlock;
+			uint32_t nBlockPixelCountX = std::min(m_nPixelsPerBlock, m_nPixelCountX - nBlockStartX);
 
-	for (uint32_t nBlockX = 0; nBlockX < m_nBlockCountX; nBlockX++) {
-		for (uint32_t nBlockY = 0; nBlockY < m_nBlockCountY; nBlockY++) {
-			
 			uint32_t nBaseValue = 0;
 			uint32_t nActiveLayerCount = 0;
-			for (auto algorithm : m_Algorithms) {
+			for (auto& algorithm : m_Algorithms) {
 				auto blockInfo = algorithm->getBlockInfo(nBlockX, nBlockY);
 				if (blockInfo == eBlockType::btCompleteInside)
 					nBaseValue += nValueRange;
 				if (blockInfo == eBlockType::btBorder) {
-					m_ActiveAlgorithms[nActiveLayerCount] = algorithm.get();
+					activeAlgorithms[nActiveLayerCount] = algorithm.get();
 					nActiveLayerCount++;
 				}
 			}
@@ -286,48 +317,46 @@ void CImageObject::calculateRasterizationImage(bool bAntiAliased)
 						nValueNormalized = 0;
 				}
 
-				for (uint32_t dY = 0; dY < m_nPixelsPerBlock; dY++) {
-					uint32_t nY = nBlockY * m_nPixelsPerBlock + dY;
-					uint32_t nX = nBlockX * m_nPixelsPerBlock;
-					for (uint32_t dX = 0; dX < m_nPixelsPerBlock; dX++) {
-						setPixel(nX, nY, (uint8_t)nValueNormalized);
-						nX++;
-					}
+				for (uint32_t dY = 0; dY < nBlockPixelCountY; dY++) {
+					uint8_t* pTarget = &m_PixelData[(size_t)nBlockStartX + (size_t)(nBlockStartY + dY) * (size_t)m_nPixelCountX];
+					memset(pTarget, (uint8_t)nValueNormalized, nBlockPixelCountX);
 				}
 			}
 			else {
-				for (auto it = m_BlockBuffer.begin(); it != m_BlockBuffer.end(); it++)
-					*it = nBaseValue;
+				CSpanKernels::fillSpan(m_SpanKernelType, blockBuffer.data(), (uint32_t)blockBuffer.size(), nBaseValue);
 
 				for (uint32_t nSampleIndex = 0; nSampleIndex < nActiveLayerCount; nSampleIndex++) {
-					m_ActiveAlgorithms[nSampleIndex]->addBlockToBuffer (nBlockX, nBlockY, m_BlockBuffer);
+					activeAlgorithms[nSampleIndex]->addBlockToBuffer (nBlockX, nBlockY, blockBuffer, m_SpanKernelType);
 				}
 
-				for (uint32_t dY = 0; dY < m_nPixelsPerBlock; dY++) {
-					uint32_t nY = nBlockY * m_nPixelsPerBlock + dY;
-					uint32_t nX = nBlockX * m_nPixelsPerBlock;
-					for (uint32_t dX = 0; dX < m_nPixelsPerBlock; dX++) {
-						uint32_t nValueNormalized = m_BlockBuffer[(size_t)dX + (size_t)dY * m_nPixelsPerBlock] / nNumberOfZSamples;
-						if (!bAntiAliased) {
-							if (nValueNormalized > nValueBWThreshold)
-								nValueNormalized = nValueRange;
-							else
-								nValueNormalized = 0;
-						}
-
-						setPixel(nX, nY, (uint8_t)nValueNormalized);
-						nX++;
-					}
+				for (uint32_t dY = 0; dY < nBlockPixelCountY; dY++) {
+					uint8_t* pTarget = &m_PixelData[(size_t)nBlockStartX + (size_t)(nBlockStartY + dY) * (size_t)m_nPixelCountX];
+					CSpanKernels::reduceSpan(m_SpanKernelType, &blockBuffer[(size_t)dY * m_nPixelsPerBlock], pTarget, nBlockPixelCountX, nNumberOfZSamples, !bAntiAliased, nValueBWThreshold);
 				}
 
 			}
 
 		}
-	}
+	};
+
+	AMCCommon::CParallelBlocks::processBlocks(nThreadCount, m_nBlockCountY, 1, [&](uint32_t nThreadIndex, size_t nFirstBlockY, size_t nBlockRowCount) {
+		for (size_t nBlockY = nFirstBlockY; nBlockY < nFirstBlockY + nBlockRowCount; nBlockY++)
+			renderBlockRow(nThreadIndex, (uint32_t)nBlockY);
+	});
 
 	m_nBlockCountX = 0;
 	m_nBlockCountY = 0;
-	m_Algorithms.clear();
+	m_pArena->releaseAlgorithms(m_Algorithms);
+
+}
 
+uint64_t CImageObject::getRasterizedLineCount()
+{
+	return m_nRasterizedLineCount;
+}
+
+uint32_t CImageObject::getBufferAllocationCount()
+{
+	return m_nBufferAllocationCount;
 }
 
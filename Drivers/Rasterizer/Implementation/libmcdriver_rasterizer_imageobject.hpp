@@ -73,12 +73,17 @@ protected:
 
 	// Data for rasterization algorithm
 	std::vector<PRasterizationAlgorithm> m_Algorithms;
+	PRasterizationArena m_pArena;
 	uint32_t m_nBlockCountX;
 	uint32_t m_nBlockCountY;
 	uint32_t m_nUnitsPerSubPixel;
 	uint32_t m_nSubSamplingX;
 	uint32_t m_nSubSamplingY;
 	uint32_t m_nPixelsPerBlock;
+	uint32_t m_nThreadCount;
+	eSpanKernelType m_SpanKernelType;
+	uint64_t m_nRasterizedLineCount;
+	uint32_t m_nBufferAllocationCount;
 	double m_dUnitsX;
 	double m_dUnitsY;
 
@@ -103,12 +108,16 @@ public:
 
 	std::vector<uint8_t> & getBuffer();
 
-	void initRasterizationAlgorithms(uint32_t nUnitsPerSubPixel, uint32_t nPixelsPerBlock, uint32_t nSubSamplingX, uint32_t nSubSamplingY);
+	void initRasterizationAlgorithms(uint32_t nUnitsPerSubPixel, uint32_t nPixelsPerBlock, uint32_t nSubSamplingX, uint32_t nSubSamplingY, uint32_t nThreadCount, eSpanKernelType spanKernelType, PRasterizationArena pArena);
 
-	void addRasterizationLayer(CLayerDataObject * pLayer);
+	void addRasterizationLayer(CRasterizationLayerSource * pLayer);
 
 	void calculateRasterizationImage(bool bAntiAliased);
 
+	uint64_t getRasterizedLineCount();
+
+	uint32_t getBufferAllocationCount();
+
 };
 
 } // namespace Impl
@@ -57,6 +57,20 @@ typedef std::shared_ptr<ClipperLib::Paths> PClipperPaths;
 #define RASTERER_MINSUBSAMPLING 1
 #define RASTERER_MAXSUBSAMPLING 32
 
+// Source of closed polygons for the rasterization algorithm.
+class CRasterizationLayerSource {
+public:
+	virtual ~CRasterizationLayerSource() {}
+
+	// Returns the number of lines that will be added to the algorithm, or 0 if it is not known in advance.
+	virtual uint64_t calculateClosedPolygonLineCount() = 0;
+
+	virtual void addClosedPolygonsToAlgorithm(CRasterizationAlgorithm* pAlgorithm, double dUnitsX, double dUnitsY) = 0;
+};
+
+typedef std::shared_ptr<CRasterizationLayerSource> PRasterizationLayerSource;
+
+
 class CLayerDataEntity {
 private:
 	eGeometryType m_GeometryType;
@@ -73,7 +87,7 @@ public:
 };
 
 
-class CLayerDataObject {
+class CLayerDataObject : public CRasterizationLayerSource {
 private:
 	std::vector<CLayerDataEntity> m_Entities;
 
@@ -92,9 +106,9 @@ public:
 
 	void mergeInto(CLayerDataObject* pOtherDataObject);
 
-	uint64_t calculateClosedPolygonLineCount();
+	uint64_t calculateClosedPolygonLineCount() override;
 
-	void addClosedPolygonsToAlgorithm(CRasterizationAlgorithm * pAlgorithm, double dUnitsX, double dUnitsY);
+	void addClosedPolygonsToAlgorithm(CRasterizationAlgorithm * pAlgorithm, double dUnitsX, double dUnitsY) override;
 };
 
 
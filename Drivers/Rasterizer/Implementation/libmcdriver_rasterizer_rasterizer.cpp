@@ -35,8 +35,11 @@ Abstract: This is a stub class definition of CRasterizer
 #include "libmcdriver_rasterizer_interfaceexception.hpp"
 #include "libmcdriver_rasterizer_imageobject.hpp"
 #include "libmcdriver_rasterizer_algorithm.hpp"
+#include "libmcdriver_rasterizer_slicestack.hpp"
+#include "libmcdriver_rasterizer_toolpathsource.hpp"
 
 // Include custom headers here.
+#include <chrono>
 
 
 using namespace LibMCDriver_Rasterizer::Impl;
@@ -51,7 +54,12 @@ CRasterizerInstance::CRasterizerInstance(const uint32_t nPixelCountX, const uint
 	m_nSubSamplingX(1), 
 	m_nSubSamplingY(1),
 	m_nPixelsPerBlock (RASTERALGORITHM_DEFAULTPIXELSPERBLOCK),
-	m_nUnitsPerSubPixel (RASTERALGORITHM_DEFAULTUNITSPERSUBPIXEL)
+	m_nUnitsPerSubPixel (RASTERALGORITHM_DEFAULTUNITSPERSUBPIXEL),
+	m_pArena (std::make_shared<CRasterizationArena> ()),
+	m_nLastLayerCount (0),
+	m_nLastLineCount (0),
+	m_nLastAllocationCount (0),
+	m_nLastDurationInMicroseconds (0)
 {
 	if (nPixelCountX <= 0)
 		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPIXELCOUNT);
@@ -134,7 +142,40 @@ void CRasterizerInstance::AddLayer(ILayerObject* pLayerObject)
 	m_Layers.push_back(pLayerObjectInstance->getDataObject());
 }
 
-void CRasterizerInstance::CalculateImage(LibMCEnv::CImageData* pImageData, const bool bAntialiased, uint32_t nUnitsPerSubPixel, uint32_t nPixelsPerBlock)
+void CRasterizerInstance::AddToolpathLayer(LibMCEnv::PToolpathLayer pToolpathLayer)
+{
+	if (pToolpathLayer.get() == nullptr)
+		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
+
+	m_Layers.push_back(std::make_shared<CToolpathLayerSource>(pToolpathLayer));
+}
+
+void CRasterizerInstance::AddSliceStackLayer(ISliceStack* pSliceStack, const uint32_t nLayerIndex)
+{
+	if (pSliceStack == nullptr)
+		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
+
+	CSliceStack* pSliceStackInstance = dynamic_cast <CSliceStack*> (pSliceStack);
+	if (pSliceStackInstance == nullptr)
+		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDCAST);
+
+	m_Layers.push_back(pSliceStackInstance->getLayerDataObject(nLayerIndex));
+}
+
+void CRasterizerInstance::ClearLayers()
+{
+	m_Layers.clear();
+}
+
+void CRasterizerInstance::GetCalculationStatistics(uint32_t& nLayerCount, uint64_t& nLineCount, uint32_t& nAllocationCount, uint64_t& nDurationInMicroseconds)
+{
+	nLayerCount = m_nLastLayerCount;
+	nLineCount = m_nLastLineCount;
+	nAllocationCount = m_nLastAllocationCount;
+	nDurationInMicroseconds = m_nLastDurationInMicroseconds;
+}
+
+void CRasterizerInstance::CalculateImage(LibMCEnv::CImageData* pImageData, const bool bAntialiased, uint32_t nUnitsPerSubPixel, uint32_t nPixelsPerBlock, uint32_t nThreadCount, eSpanKernelType spanKernelType)
 {
 	if (pImageData == nullptr)
 		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
@@ -146,6 +187,8 @@ void CRasterizerInstance::CalculateImage(LibMCEnv::CImageData* pImageData, const
 		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDUNITSPERSUBPIXEL);
 	if ((nPixelsPerBlock < RASTERALGORITHM_MINPIXELSPERBLOCK) || (nPixelsPerBlock > RASTERALGORITHM_MAXPIXELSPERBLOCK))
 		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPIXELSPERBLOCK);
+	if (nThreadCount > RASTERALGORITHM_MAXTHREADCOUNT)
+		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDTHREADCOUNT);
 
 	uint32_t nPixelSizeX = 0;
 	uint32_t nPixelSizeY = 0;
@@ -158,19 +201,33 @@ void CRasterizerInstance::CalculateImage(LibMCEnv::CImageData* pImageData, const
 
 	pImageData->SetDPI(m_dDPIX, m_dDPIY);
 
+	auto startTime = std::chrono::high_resolution_clock::now();
+
 	auto pImage = std::make_unique<CImageObject>(m_nPixelCountX, m_nPixelCountY, m_dDPIX, m_dDPIY);
 
+	m_nLastLayerCount = 0;
+	m_nLastLineCount = 0;
+	m_nLastAllocationCount = 0;
+
 	if (!m_Layers.empty()) {
 
-		pImage->initRasterizationAlgorithms(nUnitsPerSubPixel, nPixelsPerBlock, m_nSubSamplingX, m_nSubSamplingY);
+		pImage->initRasterizationAlgorithms(nUnitsPerSubPixel, nPixelsPerBlock, m_nSubSamplingX, m_nSubSamplingY, nThreadCount, spanKernelType, m_pArena);
 		for (auto pLayer : m_Layers)
 			pImage->addRasterizationLayer (pLayer.get());
+
+		m_nLastLayerCount = (uint32_t)m_Layers.size();
+		m_nLastLineCount = pImage->getRasterizedLineCount();
+		m_nLastAllocationCount = pImage->getBufferAllocationCount();
+
 		pImage->calculateRasterizationImage (bAntialiased);
 
 	}
 
 
 	pImageData->SetPixelRange(0, 0, m_nPixelCountX - 1, m_nPixelCountY - 1, pImage->getBuffer ());
+
+	auto endTime = std::chrono::high_resolution_clock::now();
+	m_nLastDurationInMicroseconds = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count();
 }
 
 
@@ -182,7 +239,9 @@ void CRasterizerInstance::CalculateImage(LibMCEnv::CImageData* pImageData, const
 CRasterizer::CRasterizer(PRasterizerInstance pRasterizerInstance)
 	: m_pRasterizerInstance (pRasterizerInstance),
 	m_nUnitsPerSubPixel (RASTERALGORITHM_DEFAULTUNITSPERSUBPIXEL),
-	m_nPixelsPerBlock (RASTERALGORITHM_DEFAULTPIXELSPERBLOCK)
+	m_nPixelsPerBlock (RASTERALGORITHM_DEFAULTPIXELSPERBLOCK),
+	m_nThreadCount (RASTERALGORITHM_DEFAULTTHREADCOUNT),
+	m_bSIMDKernelsEnabled (true)
 {
 	if (pRasterizerInstance.get() == nullptr)
 		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
@@ -234,9 +293,29 @@ void CRasterizer::AddLayer(ILayerObject* pLayerObject)
 	m_pRasterizerInstance->AddLayer(pLayerObject);
 }
 
+void CRasterizer::AddToolpathLayer(LibMCEnv::PToolpathLayer pToolpathLayer)
+{
+	m_pRasterizerInstance->AddToolpathLayer(pToolpathLayer);
+}
+
+void CRasterizer::AddSliceStackLayer(ISliceStack* pSliceStack, const LibMCDriver_Rasterizer_uint32 nLayerIndex)
+{
+	m_pRasterizerInstance->AddSliceStackLayer(pSliceStack, nLayerIndex);
+}
+
+void CRasterizer::ClearLayers()
+{
+	m_pRasterizerInstance->ClearLayers();
+}
+
+void CRasterizer::GetCalculationStatistics(LibMCDriver_Rasterizer_uint32 & nLayerCount, LibMCDriver_Rasterizer_uint64 & nLineCount, LibMCDriver_Rasterizer_uint32 & nAllocationCount, LibMCDriver_Rasterizer_uint64 & nDurationInMicroseconds)
+{
+	m_pRasterizerInstance->GetCalculationStatistics(nLayerCount, nLineCount, nAllocationCount, nDurationInMicroseconds);
+}
+
 void CRasterizer::CalculateImage(LibMCEnv::PImageData pImageObject, const bool bAntialiased)
 {
-	m_pRasterizerInstance->CalculateImage(pImageObject.get(), bAntialiased, m_nUnitsPerSubPixel, m_nPixelsPerBlock);
+	m_pRasterizerInstance->CalculateImage(pImageObject.get(), bAntialiased, m_nUnitsPerSubPixel, m_nPixelsPerBlock, m_nThreadCount, getSpanKernelType());
 }
 
 void CRasterizer::SetSamplingParameters(const LibMCDriver_Rasterizer_uint32 nUnitsPerSubpixel, const LibMCDriver_Rasterizer_uint32 nPixelsPerBlock)
@@ -257,3 +336,33 @@ void CRasterizer::GetSamplingParameters(LibMCDriver_Rasterizer_uint32& nUnitsPer
 	nPixelsPerBlock = m_nPixelsPerBlock;
 }
 
+void CRasterizer::SetThreadCount(const LibMCDriver_Rasterizer_uint32 nThreadCount)
+{
+	if (nThreadCount > RASTERALGORITHM_MAXTHREADCOUNT)
+		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDTHREADCOUNT);
+
+	m_nThreadCount = nThreadCount;
+}
+
+LibMCDriver_Rasterizer_uint32 CRasterizer::GetThreadCount()
+{
+	return m_nThreadCount;
+}
+
+void CRasterizer::SetSIMDKernelsEnabled(const bool bEnabled)
+{
+	m_bSIMDKernelsEnabled = bEnabled;
+}
+
+std::string CRasterizer::GetSIMDKernelName()
+{
+	return CSpanKernels::getKernelTypeName(getSpanKernelType());
+}
+
+eSpanKernelType CRasterizer::getSpanKernelType()
+{
+	if (m_bSIMDKernelsEnabled)
+		return CSpanKernels::detectKernelType();
+
+	return eSpanKernelType::skScalar;
+}
@@ -69,7 +69,15 @@ private:
 	uint32_t m_nUnitsPerSubPixel;
 	uint32_t m_nPixelsPerBlock;
 
-	std::vector<PLayerDataObject> m_Layers;
+	std::vector<PRasterizationLayerSource> m_Layers;
+
+	// Line and block buffers of the previous calculation
+	PRasterizationArena m_pArena;
+
+	uint32_t m_nLastLayerCount;
+	uint64_t m_nLastLineCount;
+	uint32_t m_nLastAllocationCount;
+	uint64_t m_nLastDurationInMicroseconds;
 
 protected:
 
@@ -94,7 +102,15 @@ public:
 
 	void AddLayer(ILayerObject* pLayerObject);
 
-	void CalculateImage(LibMCEnv::CImageData * pImageData, const bool bAntialiased, uint32_t nUnitsPerSubPixel, uint32_t nPixelsPerBlock);
+	void AddToolpathLayer(LibMCEnv::PToolpathLayer pToolpathLayer);
+
+	void AddSliceStackLayer(ISliceStack* pSliceStack, const uint32_t nLayerIndex);
+
+	void ClearLayers();
+
+	void GetCalculationStatistics(uint32_t& nLayerCount, uint64_t& nLineCount, uint32_t& nAllocationCount, uint64_t& nDurationInMicroseconds);
+
+	void CalculateImage(LibMCEnv::CImageData * pImageData, const bool bAntialiased, uint32_t nUnitsPerSubPixel, uint32_t nPixelsPerBlock, uint32_t nThreadCount, eSpanKernelType spanKernelType);
 
 
 };
@@ -113,6 +129,10 @@ protected:
 
 	uint32_t m_nUnitsPerSubPixel;
 	uint32_t m_nPixelsPerBlock;
+	uint32_t m_nThreadCount;
+	bool m_bSIMDKernelsEnabled;
+
+	eSpanKernelType getSpanKernelType();
 
 public:
 
@@ -136,12 +156,28 @@ public:
 
 	void AddLayer(ILayerObject* pLayerObject) override;
 
+	void AddToolpathLayer(LibMCEnv::PToolpathLayer pToolpathLayer) override;
+
+	void AddSliceStackLayer(ISliceStack* pSliceStack, const LibMCDriver_Rasterizer_uint32 nLayerIndex) override;
+
+	void ClearLayers() override;
+
+	void GetCalculationStatistics(LibMCDriver_Rasterizer_uint32 & nLayerCount, LibMCDriver_Rasterizer_uint64 & nLineCount, LibMCDriver_Rasterizer_uint32 & nAllocationCount, LibMCDriver_Rasterizer_uint64 & nDurationInMicroseconds) override;
+
 	void CalculateImage(LibMCEnv::PImageData pImageObject, const bool bAntialiased);
 
 	void SetSamplingParameters(const LibMCDriver_Rasterizer_uint32 nUnitsPerSubpixel, const LibMCDriver_Rasterizer_uint32 nPixelsPerBlock) override;
 
 	void GetSamplingParameters(LibMCDriver_Rasterizer_uint32& nUnitsPerSubpixel, LibMCDriver_Rasterizer_uint32& nPixelsPerBlock) override;
 
+	void SetThreadCount(const LibMCDriver_Rasterizer_uint32 nThreadCount) override;
+
+	LibMCDriver_Rasterizer_uint32 GetThreadCount() override;
+
+	void SetSIMDKernelsEnabled(const bool bEnabled) override;
+
+	std::string GetSIMDKernelName() override;
+
 };
 
 } // namespace Impl
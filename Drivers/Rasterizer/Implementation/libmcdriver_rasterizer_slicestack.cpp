@@ -84,6 +84,14 @@ LibMCDriver_Rasterizer_double CSliceStack::GetTopZ()
 
 ILayerObject* CSliceStack::GetLayer(const LibMCDriver_Rasterizer_uint32 nLayerIndex)
 {
-    return new CLayerObject(m_Layers[nLayerIndex]);
+    return new CLayerObject(getLayerDataObject(nLayerIndex));
+}
+
+PLayerDataObject CSliceStack::getLayerDataObject(uint32_t nLayerIndex)
+{
+    if (nLayerIndex >= m_Layers.size())
+        throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDLAYERINDEX);
+
+    return m_Layers[nLayerIndex];
 }
 
@@ -82,6 +82,8 @@ public:
 
 	ILayerObject * GetLayer(const LibMCDriver_Rasterizer_uint32 nLayerIndex) override;
 
+	PLayerDataObject getLayerDataObject(uint32_t nLayerIndex);
+
 };
 
 } // namespace Impl
@@ -0,0 +1,250 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+*/
+
+#include "libmcdriver_rasterizer_spankernels.hpp"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SPANKERNELS_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define SPANKERNELS_TARGET_AVX2
+#define SPANKERNELS_TARGET_SSE2
+#else
+#define SPANKERNELS_TARGET_AVX2 __attribute__((target("avx2")))
+#define SPANKERNELS_TARGET_SSE2 __attribute__((target("sse2")))
+#endif
+#endif
+
+using namespace LibMCDriver_Rasterizer::Impl;
+
+
+static void fillSpanScalar(uint32_t* pTarget, uint32_t nCount, uint32_t nValue)
+{
+    for (uint32_t nIndex = 0; nIndex < nCount; nIndex++)
+        pTarget[nIndex] = nValue;
+}
+
+static void reduceSpanScalar(const uint32_t* pSource, uint8_t* pTarget, uint32_t nCount, uint32_t nSampleCount, bool bThreshold, uint32_t nThreshold)
+{
+    for (uint32_t nIndex = 0; nIndex < nCount; nIndex++) {
+        uint32_t nValueNormalized = pSource[nIndex] / nSampleCount;
+        if (bThreshold) {
+            if (nValueNormalized > nThreshold)
+                nValueNormalized = 255;
+            else
+                nValueNormalized = 0;
+        }
+
+        pTarget[nIndex] = (uint8_t)nValueNormalized;
+    }
+}
+
+#ifdef SPANKERNELS_X86
+
+SPANKERNELS_TARGET_SSE2 static __m128i reduceQuadSSE2(__m128i values, __m128 sampleCount, bool bDivide, bool bThreshold, __m128i threshold)
+{
+    // Truncating float division is exact here, as the quotient is at most 255 and
+    // the distance to the next integer is at least 1 / nSampleCount.
+    if (bDivide)
+        values = _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(values), sampleCount));
+
+    if (bThreshold)
+        values = _mm_cmpgt_epi32(values, threshold);
+
+    return _mm_and_si128(values, _mm_set1_epi32(0xff));
+}
+
+SPANKERNELS_TARGET_SSE2 static void fillSpanSSE2(uint32_t* pTarget, uint32_t nCount, uint32_t nValue)
+{
+    __m128i value = _mm_set1_epi32((int32_t)nValue);
+
+    uint32_t nIndex = 0;
+    for (; nIndex + 4 <= nCount; nIndex += 4)
+        _mm_storeu_si128((__m128i*) &pTarget[nIndex], value);
+
+    fillSpanScalar(&pTarget[nIndex], nCount - nIndex, nValue);
+}
+
+SPANKERNELS_TARGET_SSE2 static void reduceSpanSSE2(const uint32_t* pSource, uint8_t* pTarget, uint32_t nCount, uint32_t nSampleCount, bool bThreshold, uint32_t nThreshold)
+{
+    bool bDivide = (nSampleCount != 1);
+    __m128 sampleCount = _mm_set1_ps((float)nSampleCount);
+    __m128i threshold = _mm_set1_epi32((int32_t)nThreshold);
+
+    uint32_t nIndex = 0;
+    for (; nIndex + 16 <= nCount; nIndex += 16) {
+        __m128i values0 = reduceQuadSSE2(_mm_loadu_si128((const __m128i*) &pSource[nIndex]), sampleCount, bDivide, bThreshold, threshold);
+        __m128i values1 = reduceQuadSSE2(_mm_loadu_si128((const __m128i*) &pSource[nIndex + 4]), sampleCount, bDivide, bThreshold, threshold);
+        __m128i values2 = reduceQuadSSE2(_mm_loadu_si128((const __m128i*) &pSource[nIndex + 8]), sampleCount, bDivide, bThreshold, threshold);
+        __m128i values3 = reduceQuadSSE2(_mm_loadu_si128((const __m128i*) &pSource[nIndex + 12]), sampleCount, bDivide, bThreshold, threshold);
+
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(values0, values1), _mm_packs_epi32(values2, values3));
+        _mm_storeu_si128((__m128i*) &pTarget[nIndex], packed);
+    }
+
+    reduceSpanScalar(&pSource[nIndex], &pTarget[nIndex], nCount - nIndex, nSampleCount, bThreshold, nThreshold);
+}
+
+SPANKERNELS_TARGET_AVX2 static __m256i reduceOctAVX2(__m256i values, __m256 sampleCount, bool bDivide, bool bThreshold, __m256i threshold)
+{
+    if (bDivide)
+        values = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(values), sampleCount));
+
+    if (bThreshold)
+        values = _mm256_cmpgt_epi32(values, threshold);
+
+    return _mm256_and_si256(values, _mm256_set1_epi32(0xff));
+}
+
+SPANKERNELS_TARGET_AVX2 static void fillSpanAVX2(uint32_t* pTarget, uint32_t nCount, uint32_t nValue)
+{
+    __m256i value = _mm256_set1_epi32((int32_t)nValue);
+
+    uint32_t nIndex = 0;
+    for (; nIndex + 8 <= nCount; nIndex += 8)
+        _mm256_storeu_si256((__m256i*) &pTarget[nIndex], value);
+
+    fillSpanScalar(&pTarget[nIndex], nCount - nIndex, nValue);
+}
+
+SPANKERNELS_TARGET_AVX2 static void reduceSpanAVX2(const uint32_t* pSource, uint8_t* pTarget, uint32_t nCount, uint32_t nSampleCount, bool bThreshold, uint32_t nThreshold)
+{
+    bool bDivide = (nSampleCount != 1);
+    __m256 sampleCount = _mm256_set1_ps((float)nSampleCount);
+    __m256i threshold = _mm256_set1_epi32((int32_t)nThreshold);
+
+    uint32_t nIndex = 0;
+    for (; nIndex + 16 <= nCount; nIndex += 16) {
+        __m256i values0 = reduceOctAVX2(_mm256_loadu_si256((const __m256i*) &pSource[nIndex]), sampleCount, bDivide, bThreshold, threshold);
+        __m256i values1 = reduceOctAVX2(_mm256_loadu_si256((const __m256i*) &pSource[nIndex + 8]), sampleCount, bDivide, bThreshold, threshold);
+
+        // AVX2 packs within 128 bit lanes, so the result needs to be put back in order.
+        __m256i packed16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(values0, values1), 0xd8);
+        __m128i packed8 = _mm_packus_epi16(_mm256_castsi256_si128(packed16), _mm256_extracti128_si256(packed16, 1));
+        _mm_storeu_si128((__m128i*) &pTarget[nIndex], packed8);
+    }
+
+    reduceSpanScalar(&pSource[nIndex], &pTarget[nIndex], nCount - nIndex, nSampleCount, bThreshold, nThreshold);
+}
+
+static eSpanKernelType detectKernelTypeX86()
+{
+#ifdef _MSC_VER
+    int cpuInfo[4];
+    __cpuid(cpuInfo, 0);
+    int nMaxFunctionID = cpuInfo[0];
+
+    __cpuid(cpuInfo, 1);
+    bool bHasSSE2 = (cpuInfo[3] & (1 << 26)) != 0;
+    bool bHasOSXSave = (cpuInfo[2] & (1 << 27)) != 0;
+    bool bHasAVX = (cpuInfo[2] & (1 << 28)) != 0;
+
+    bool bHasAVX2 = false;
+    // AVX registers must also be saved by the operating system
+    if (bHasOSXSave && bHasAVX && (nMaxFunctionID >= 7)) {
+        if ((_xgetbv(0) & 0x6) == 0x6) {
+            __cpuidex(cpuInfo, 7, 0);
+            bHasAVX2 = (cpuInfo[1] & (1 << 5)) != 0;
+        }
+    }
+#else
+    __builtin_cpu_init();
+    bool bHasSSE2 = __builtin_cpu_supports("sse2");
+    bool bHasAVX2 = __builtin_cpu_supports("avx2");
+#endif
+
+    if (bHasAVX2)
+        return eSpanKernelType::skAVX2;
+    if (bHasSSE2)
+        return eSpanKernelType::skSSE2;
+
+    return eSpanKernelType::skScalar;
+}
+
+#endif // SPANKERNELS_X86
+
+
+eSpanKernelType CSpanKernels::detectKernelType()
+{
+#ifdef SPANKERNELS_X86
+    static const eSpanKernelType detectedKernelType = detectKernelTypeX86();
+    return detectedKernelType;
+#else
+    return eSpanKernelType::skScalar;
+#endif
+}
+
+std::string CSpanKernels::getKernelTypeName(eSpanKernelType kernelType)
+{
+    switch (kernelType) {
+        case eSpanKernelType::skSSE2: return "sse2";
+        case eSpanKernelType::skAVX2: return "avx2";
+        default: return "scalar";
+    }
+}
+
+void CSpanKernels::fillSpan(eSpanKernelType kernelType, uint32_t* pTarget, uint32_t nCount, uint32_t nValue)
+{
+    switch (kernelType) {
+#ifdef SPANKERNELS_X86
+        case eSpanKernelType::skSSE2:
+            fillSpanSSE2(pTarget, nCount, nValue);
+            break;
+        case eSpanKernelType::skAVX2:
+            fillSpanAVX2(pTarget, nCount, nValue);
+            break;
+#endif
+        default:
+            fillSpanScalar(pTarget, nCount, nValue);
+            break;
+    }
+}
+
+void CSpanKernels::reduceSpan(eSpanKernelType kernelType, const uint32_t* pSource, uint8_t* pTarget, uint32_t nCount, uint32_t nSampleCount, bool bThreshold, uint32_t nThreshold)
+{
+    if (nSampleCount > SPANKERNELS_MAXVECTORIZEDSAMPLECOUNT)
+        kernelType = eSpanKernelType::skScalar;
+
+    switch (kernelType) {
+#ifdef SPANKERNELS_X86
+        case eSpanKernelType::skSSE2:
+            reduceSpanSSE2(pSource, pTarget, nCount, nSampleCount, bThreshold, nThreshold);
+            break;
+        case eSpanKernelType::skAVX2:
+            reduceSpanAVX2(pSource, pTarget, nCount, nSampleCount, bThreshold, nThreshold);
+            break;
+#endif
+        default:
+            reduceSpanScalar(pSource, pTarget, nCount, nSampleCount, bThreshold, nThreshold);
+            break;
+    }
+}
@@ -0,0 +1,75 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+*/
+
+
+#ifndef __LIBMCDRIVER_RASTERIZER_SPANKERNELS
+#define __LIBMCDRIVER_RASTERIZER_SPANKERNELS
+
+#include <cstdint>
+#include <string>
+
+// The vectorized reduction is only bit exact as long as all coverage sums fit into the float mantissa.
+#define SPANKERNELS_MAXVECTORIZEDSAMPLECOUNT 65535
+
+namespace LibMCDriver_Rasterizer {
+    namespace Impl {
+
+        enum class eSpanKernelType : int32_t {
+            skScalar = 0,
+            skSSE2 = 1,
+            skAVX2 = 2
+        };
+
+        // Inner loops of the block rasterization. All kernel types return bit-identical results,
+        // the scalar kernels are the reference implementation.
+        class CSpanKernels {
+            public:
+
+                // Returns the fastest kernel type that is supported by the current CPU.
+                static eSpanKernelType detectKernelType();
+
+                static std::string getKernelTypeName(eSpanKernelType kernelType);
+
+                // Sets nCount coverage values to nValue.
+                static void fillSpan(eSpanKernelType kernelType, uint32_t* pTarget, uint32_t nCount, uint32_t nValue);
+
+                // Divides nCount accumulated coverage values by nSampleCount and stores them as 8 bit greyscale.
+                // If bThreshold is set, values above nThreshold are written as 255 and all others as 0.
+                // Source values must not exceed 255 * nSampleCount.
+                static void reduceSpan(eSpanKernelType kernelType, const uint32_t* pSource, uint8_t* pTarget, uint32_t nCount, uint32_t nSampleCount, bool bThreshold, uint32_t nThreshold);
+
+        };
+
+    }
+
+}
+
+#endif // __LIBMCDRIVER_RASTERIZER_SPANKERNELS
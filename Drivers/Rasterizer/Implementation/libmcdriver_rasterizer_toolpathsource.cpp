@@ -0,0 +1,126 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is a class definition of CToolpathLayerSource
+
+*/
+
+#include "libmcdriver_rasterizer_toolpathsource.hpp"
+#include "libmcdriver_rasterizer_interfaceexception.hpp"
+
+#include <cmath>
+
+using namespace LibMCDriver_Rasterizer::Impl;
+
+/*************************************************************************************************************************
+ Class definition of CToolpathLayerSource
+**************************************************************************************************************************/
+
+CToolpathLayerSource::CToolpathLayerSource(LibMCEnv::PToolpathLayer pToolpathLayer)
+	: m_pToolpathLayer(pToolpathLayer)
+{
+	if (pToolpathLayer.get() == nullptr)
+		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
+}
+
+CToolpathLayerSource::~CToolpathLayerSource()
+{
+
+}
+
+uint64_t CToolpathLayerSource::calculateClosedPolygonLineCount()
+{
+	// Only the segment infos are queried, the point data is not copied.
+	// Every loop is closed, so it adds at most as many lines as it has points.
+	uint64_t nLineCount = 0;
+
+	uint32_t nSegmentCount = m_pToolpathLayer->GetSegmentCount();
+	for (uint32_t nSegmentIndex = 0; nSegmentIndex < nSegmentCount; nSegmentIndex++) {
+
+		LibMCEnv::eToolpathSegmentType segmentType = LibMCEnv::eToolpathSegmentType::Unknown;
+		uint32_t nPointCount = 0;
+		m_pToolpathLayer->GetSegmentInfo(nSegmentIndex, segmentType, nPointCount);
+
+		if ((segmentType == LibMCEnv::eToolpathSegmentType::Loop) && (nPointCount >= 2))
+			nLineCount += nPointCount;
+	}
+
+	return nLineCount;
+}
+
+void CToolpathLayerSource::addClosedPolygonsToAlgorithm(CRasterizationAlgorithm* pAlgorithm, double dUnitsX, double dUnitsY)
+{
+	if (dUnitsX <= 0.0)
+		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
+	if (dUnitsY <= 0.0)
+		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
+	if (pAlgorithm == nullptr)
+		throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
+
+	// Toolpath coordinates are integers in toolpath units. They are converted to mm first and then divided
+	// by the raster units, in the same order as for layer objects, so that both paths round identically.
+	double dToolpathUnits = m_pToolpathLayer->GetUnits();
+
+	uint32_t nSegmentCount = m_pToolpathLayer->GetSegmentCount();
+	for (uint32_t nSegmentIndex = 0; nSegmentIndex < nSegmentCount; nSegmentIndex++) {
+
+		LibMCEnv::eToolpathSegmentType segmentType = LibMCEnv::eToolpathSegmentType::Unknown;
+		uint32_t nPointCount = 0;
+		m_pToolpathLayer->GetSegmentInfo(nSegmentIndex, segmentType, nPointCount);
+
+		if ((segmentType != LibMCEnv::eToolpathSegmentType::Loop) || (nPointCount < 2))
+			continue;
+
+		m_pToolpathLayer->GetSegmentPointData(nSegmentIndex, m_PointBuffer);
+
+		auto iIter = m_PointBuffer.begin();
+		int32_t nFirstX = (int32_t)round((iIter->m_Coordinates[0] * dToolpathUnits) / dUnitsX);
+		int32_t nFirstY = (int32_t)round((iIter->m_Coordinates[1] * dToolpathUnits) / dUnitsY);
+
+		int32_t nX1 = nFirstX;
+		int32_t nY1 = nFirstY;
+
+		iIter++;
+		while (iIter != m_PointBuffer.end()) {
+			int32_t nX2 = (int32_t)round((iIter->m_Coordinates[0] * dToolpathUnits) / dUnitsX);
+			int32_t nY2 = (int32_t)round((iIter->m_Coordinates[1] * dToolpathUnits) / dUnitsY);
+			iIter++;
+
+			pAlgorithm->addLine(nX1, nY1, nX2, nY2, 0);
+
+			nX1 = nX2;
+			nY1 = nY2;
+		}
+
+		if ((nX1 != nFirstX) || (nY1 != nFirstY))
+			pAlgorithm->addLine(nX1, nY1, nFirstX, nFirstY, 0);
+
+	}
+
+}
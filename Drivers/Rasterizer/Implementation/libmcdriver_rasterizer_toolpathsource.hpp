@@ -0,0 +1,73 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class declaration of CToolpathLayerSource
+
+*/
+
+
+#ifndef __LIBMCDRIVER_RASTERIZER_TOOLPATHSOURCE
+#define __LIBMCDRIVER_RASTERIZER_TOOLPATHSOURCE
+
+#include "libmcdriver_rasterizer_interfaces.hpp"
+#include "libmcdriver_rasterizer_layerobject.hpp"
+
+namespace LibMCDriver_Rasterizer {
+namespace Impl {
+
+
+/*************************************************************************************************************************
+ Class declaration of CToolpathLayerSource
+**************************************************************************************************************************/
+
+// Streams the loops of a toolpath layer directly into the rasterization algorithm.
+class CToolpathLayerSource : public CRasterizationLayerSource {
+private:
+
+	LibMCEnv::PToolpathLayer m_pToolpathLayer;
+
+	// Reused for all loops of the layer
+	std::vector<LibMCEnv::sPosition2D> m_PointBuffer;
+
+public:
+
+	CToolpathLayerSource(LibMCEnv::PToolpathLayer pToolpathLayer);
+
+	virtual ~CToolpathLayerSource();
+
+	uint64_t calculateClosedPolygonLineCount() override;
+
+	void addClosedPolygonsToAlgorithm(CRasterizationAlgorithm* pAlgorithm, double dUnitsX, double dUnitsY) override;
+
+};
+
+} // namespace Impl
+} // namespace LibMCDriver_Rasterizer
+
+#endif // __LIBMCDRIVER_RASTERIZER_TOOLPATHSOURCE
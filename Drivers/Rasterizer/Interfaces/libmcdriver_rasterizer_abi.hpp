@@ -319,6 +319,44 @@ LIBMCDRIVER_RASTERIZER_DECLSPEC LibMCDriver_RasterizerResult libmcdriver_rasteri
 */
 LIBMCDRIVER_RASTERIZER_DECLSPEC LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_getsamplingparameters(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 * pUnitsPerSubpixel, LibMCDriver_Rasterizer_uint32 * pPixelsPerBlock);
 
+/**
+* Sets the number of worker threads that are used to calculate the image. Block rows are distributed over the threads.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[in] nThreadCount - Number of threads. 0 uses the number of hardware threads, 1 calculates the image on the calling thread. Maximum 256.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_RASTERIZER_DECLSPEC LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_setthreadcount(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 nThreadCount);
+
+/**
+* Returns the number of worker threads that are used to calculate the image.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[out] pThreadCount - Number of threads. 0 uses the number of hardware threads.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_RASTERIZER_DECLSPEC LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_getthreadcount(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 * pThreadCount);
+
+/**
+* Enables or disables the vectorized span kernels. If disabled, the scalar reference kernels are used. Both produce identical images.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[in] bEnabled - If true, the fastest kernels supported by the CPU are selected at runtime. Default is true.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_RASTERIZER_DECLSPEC LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_setsimdkernelsenabled(LibMCDriver_Rasterizer_Rasterizer pRasterizer, bool bEnabled);
+
+/**
+* Returns the name of the span kernels that are used to calculate the image.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[in] nKernelNameBufferSize - size of the buffer (including trailing 0)
+* @param[out] pKernelNameNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pKernelNameBuffer -  buffer of One of scalar, sse2 or avx2., may be NULL
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_RASTERIZER_DECLSPEC LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_getsimdkernelname(LibMCDriver_Rasterizer_Rasterizer pRasterizer, const LibMCDriver_Rasterizer_uint32 nKernelNameBufferSize, LibMCDriver_Rasterizer_uint32* pKernelNameNeededChars, char * pKernelNameBuffer);
+
 /**
 * Adds a layer object to subsample.
 *
@@ -328,6 +366,45 @@ LIBMCDRIVER_RASTERIZER_DECLSPEC LibMCDriver_RasterizerResult libmcdriver_rasteri
 */
 LIBMCDRIVER_RASTERIZER_DECLSPEC LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_addlayer(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_LayerObject pLayerObject);
 
+/**
+* Adds the closed loops of a toolpath layer. The loop points are streamed into the rasterization when the image is calculated, without copying them into a layer object.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[in] pToolpathLayer - Toolpath layer instance. Polylines and hatches are ignored.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_RASTERIZER_DECLSPEC LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_addtoolpathlayer(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCEnv_ToolpathLayer pToolpathLayer);
+
+/**
+* Adds a layer of a slice stack without creating an intermediate layer object.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[in] pSliceStack - Slice stack instance.
+* @param[in] nLayerIndex - Index of the layer. Must be smaller than the layer count of the slice stack.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_RASTERIZER_DECLSPEC LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_addslicestacklayer(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_SliceStack pSliceStack, LibMCDriver_Rasterizer_uint32 nLayerIndex);
+
+/**
+* Removes all layers from the rasterizer. The line buffers of the previous calculation are kept and reused for the next image.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_RASTERIZER_DECLSPEC LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_clearlayers(LibMCDriver_Rasterizer_Rasterizer pRasterizer);
+
+/**
+* Returns statistics of the last image calculation.
+*
+* @param[in] pRasterizer - Rasterizer instance.
+* @param[out] pLayerCount - Number of layers that have been rasterized.
+* @param[out] pLineCount - Number of lines that have been added to the rasterization.
+* @param[out] pAllocationCount - Number of line and block buffer allocations. Buffers that could be reused from the previous calculation are not counted.
+* @param[out] pDurationInMicroseconds - Duration of the calculation in microseconds.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_RASTERIZER_DECLSPEC LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_getcalculationstatistics(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 * pLayerCount, LibMCDriver_Rasterizer_uint64 * pLineCount, LibMCDriver_Rasterizer_uint32 * pAllocationCount, LibMCDriver_Rasterizer_uint64 * pDurationInMicroseconds);
+
 /**
 * Calculates the image.
 *
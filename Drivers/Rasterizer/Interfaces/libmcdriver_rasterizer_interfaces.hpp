@@ -458,12 +458,63 @@ public:
 	*/
 	virtual void GetSamplingParameters(LibMCDriver_Rasterizer_uint32 & nUnitsPerSubpixel, LibMCDriver_Rasterizer_uint32 & nPixelsPerBlock) = 0;
 
+	/**
+	* IRasterizer::SetThreadCount - Sets the number of worker threads that are used to calculate the image. Block rows are distributed over the threads.
+	* @param[in] nThreadCount - Number of threads. 0 uses the number of hardware threads, 1 calculates the image on the calling thread. Maximum 256.
+	*/
+	virtual void SetThreadCount(const LibMCDriver_Rasterizer_uint32 nThreadCount) = 0;
+
+	/**
+	* IRasterizer::GetThreadCount - Returns the number of worker threads that are used to calculate the image.
+	* @return Number of threads. 0 uses the number of hardware threads.
+	*/
+	virtual LibMCDriver_Rasterizer_uint32 GetThreadCount() = 0;
+
+	/**
+	* IRasterizer::SetSIMDKernelsEnabled - Enables or disables the vectorized span kernels. If disabled, the scalar reference kernels are used. Both produce identical images.
+	* @param[in] bEnabled - If true, the fastest kernels supported by the CPU are selected at runtime. Default is true.
+	*/
+	virtual void SetSIMDKernelsEnabled(const bool bEnabled) = 0;
+
+	/**
+	* IRasterizer::GetSIMDKernelName - Returns the name of the span kernels that are used to calculate the image.
+	* @return One of scalar, sse2 or avx2.
+	*/
+	virtual std::string GetSIMDKernelName() = 0;
+
 	/**
 	* IRasterizer::AddLayer - Adds a layer object to subsample.
 	* @param[in] pLayerObject - Layer object instance.
 	*/
 	virtual void AddLayer(ILayerObject* pLayerObject) = 0;
 
+	/**
+	* IRasterizer::AddToolpathLayer - Adds the closed loops of a toolpath layer. The loop points are streamed into the rasterization when the image is calculated, without copying them into a layer object.
+	* @param[in] pToolpathLayer - Toolpath layer instance. Polylines and hatches are ignored.
+	*/
+	virtual void AddToolpathLayer(LibMCEnv::PToolpathLayer pToolpathLayer) = 0;
+
+	/**
+	* IRasterizer::AddSliceStackLayer - Adds a layer of a slice stack without creating an intermediate layer object.
+	* @param[in] pSliceStack - Slice stack instance.
+	* @param[in] nLayerIndex - Index of the layer. Must be smaller than the layer count of the slice stack.
+	*/
+	virtual void AddSliceStackLayer(ISliceStack* pSliceStack, const LibMCDriver_Rasterizer_uint32 nLayerIndex) = 0;
+
+	/**
+	* IRasterizer::ClearLayers - Removes all layers from the rasterizer. The line buffers of the previous calculation are kept and reused for the next image.
+	*/
+	virtual void ClearLayers() = 0;
+
+	/**
+	* IRasterizer::GetCalculationStatistics - Returns statistics of the last image calculation.
+	* @param[out] nLayerCount - Number of layers that have been rasterized.
+	* @param[out] nLineCount - Number of lines that have been added to the rasterization.
+	* @param[out] nAllocationCount - Number of line and block buffer allocations. Buffers that could be reused from the previous calculation are not counted.
+	* @param[out] nDurationInMicroseconds - Duration of the calculation in microseconds.
+	*/
+	virtual void GetCalculationStatistics(LibMCDriver_Rasterizer_uint32 & nLayerCount, LibMCDriver_Rasterizer_uint64 & nLineCount, LibMCDriver_Rasterizer_uint32 & nAllocationCount, LibMCDriver_Rasterizer_uint64 & nDurationInMicroseconds) = 0;
+
 	/**
 	* IRasterizer::CalculateImage - Calculates the image.
 	* @param[in] pImageObject - ImageObject Instance to render into
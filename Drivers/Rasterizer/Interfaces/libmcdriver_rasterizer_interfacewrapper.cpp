@@ -812,6 +812,128 @@ LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_getsamplingparame
 	}
 }
 
+LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_setthreadcount(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 nThreadCount)
+{
+	IBase* pIBaseClass = (IBase *)pRasterizer;
+
+	try {
+		IRasterizer* pIRasterizer = dynamic_cast<IRasterizer*>(pIBaseClass);
+		if (!pIRasterizer)
+			throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDCAST);
+		
+		pIRasterizer->SetThreadCount(nThreadCount);
+
+		return LIBMCDRIVER_RASTERIZER_SUCCESS;
+	}
+	catch (ELibMCDriver_RasterizerInterfaceException & Exception) {
+		return handleLibMCDriver_RasterizerException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_getthreadcount(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 * pThreadCount)
+{
+	IBase* pIBaseClass = (IBase *)pRasterizer;
+
+	try {
+		if (pThreadCount == nullptr)
+			throw ELibMCDriver_RasterizerInterfaceException (LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
+		IRasterizer* pIRasterizer = dynamic_cast<IRasterizer*>(pIBaseClass);
+		if (!pIRasterizer)
+			throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDCAST);
+		
+		*pThreadCount = pIRasterizer->GetThreadCount();
+
+		return LIBMCDRIVER_RASTERIZER_SUCCESS;
+	}
+	catch (ELibMCDriver_RasterizerInterfaceException & Exception) {
+		return handleLibMCDriver_RasterizerException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_setsimdkernelsenabled(LibMCDriver_Rasterizer_Rasterizer pRasterizer, bool bEnabled)
+{
+	IBase* pIBaseClass = (IBase *)pRasterizer;
+
+	try {
+		IRasterizer* pIRasterizer = dynamic_cast<IRasterizer*>(pIBaseClass);
+		if (!pIRasterizer)
+			throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDCAST);
+		
+		pIRasterizer->SetSIMDKernelsEnabled(bEnabled);
+
+		return LIBMCDRIVER_RASTERIZER_SUCCESS;
+	}
+	catch (ELibMCDriver_RasterizerInterfaceException & Exception) {
+		return handleLibMCDriver_RasterizerException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_getsimdkernelname(LibMCDriver_Rasterizer_Rasterizer pRasterizer, const LibMCDriver_Rasterizer_uint32 nKernelNameBufferSize, LibMCDriver_Rasterizer_uint32* pKernelNameNeededChars, char * pKernelNameBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pRasterizer;
+
+	try {
+		if ( (!pKernelNameBuffer) && !(pKernelNameNeededChars) )
+			throw ELibMCDriver_RasterizerInterfaceException (LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
+		std::string sKernelName("");
+		IRasterizer* pIRasterizer = dynamic_cast<IRasterizer*>(pIBaseClass);
+		if (!pIRasterizer)
+			throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pKernelNameBuffer == nullptr);
+		if (isCacheCall) {
+			sKernelName = pIRasterizer->GetSIMDKernelName();
+
+			pIRasterizer->_setCache (new ParameterCache_1<std::string> (sKernelName));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIRasterizer->_getCache ());
+			if (cache == nullptr)
+				throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDCAST);
+			cache->retrieveData (sKernelName);
+			pIRasterizer->_setCache (nullptr);
+		}
+		
+		if (pKernelNameNeededChars)
+			*pKernelNameNeededChars = (LibMCDriver_Rasterizer_uint32) (sKernelName.size()+1);
+		if (pKernelNameBuffer) {
+			if (sKernelName.size() >= nKernelNameBufferSize)
+				throw ELibMCDriver_RasterizerInterfaceException (LIBMCDRIVER_RASTERIZER_ERROR_BUFFERTOOSMALL);
+			for (size_t iKernelName = 0; iKernelName < sKernelName.size(); iKernelName++)
+				pKernelNameBuffer[iKernelName] = sKernelName[iKernelName];
+			pKernelNameBuffer[sKernelName.size()] = 0;
+		}
+		return LIBMCDRIVER_RASTERIZER_SUCCESS;
+	}
+	catch (ELibMCDriver_RasterizerInterfaceException & Exception) {
+		return handleLibMCDriver_RasterizerException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_addlayer(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_LayerObject pLayerObject)
 {
 	IBase* pIBaseClass = (IBase *)pRasterizer;
@@ -841,6 +963,120 @@ LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_addlayer(LibMCDri
 	}
 }
 
+LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_addtoolpathlayer(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCEnv_ToolpathLayer pToolpathLayer)
+{
+	IBase* pIBaseClass = (IBase *)pRasterizer;
+
+	try {
+		LibMCEnv::PToolpathLayer pIToolpathLayer = std::make_shared<LibMCEnv::CToolpathLayer>(CWrapper::sPLibMCEnvWrapper.get(), pToolpathLayer);
+		CWrapper::sPLibMCEnvWrapper->AcquireInstance(pIToolpathLayer.get());
+		if (!pIToolpathLayer)
+			throw ELibMCDriver_RasterizerInterfaceException (LIBMCDRIVER_RASTERIZER_ERROR_INVALIDCAST);
+		
+		IRasterizer* pIRasterizer = dynamic_cast<IRasterizer*>(pIBaseClass);
+		if (!pIRasterizer)
+			throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDCAST);
+		
+		pIRasterizer->AddToolpathLayer(pIToolpathLayer);
+
+		return LIBMCDRIVER_RASTERIZER_SUCCESS;
+	}
+	catch (ELibMCDriver_RasterizerInterfaceException & Exception) {
+		return handleLibMCDriver_RasterizerException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_addslicestacklayer(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_SliceStack pSliceStack, LibMCDriver_Rasterizer_uint32 nLayerIndex)
+{
+	IBase* pIBaseClass = (IBase *)pRasterizer;
+
+	try {
+		IBase* pIBaseClassSliceStack = (IBase *)pSliceStack;
+		ISliceStack* pISliceStack = dynamic_cast<ISliceStack*>(pIBaseClassSliceStack);
+		if (!pISliceStack)
+			throw ELibMCDriver_RasterizerInterfaceException (LIBMCDRIVER_RASTERIZER_ERROR_INVALIDCAST);
+		
+		IRasterizer* pIRasterizer = dynamic_cast<IRasterizer*>(pIBaseClass);
+		if (!pIRasterizer)
+			throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDCAST);
+		
+		pIRasterizer->AddSliceStackLayer(pISliceStack, nLayerIndex);
+
+		return LIBMCDRIVER_RASTERIZER_SUCCESS;
+	}
+	catch (ELibMCDriver_RasterizerInterfaceException & Exception) {
+		return handleLibMCDriver_RasterizerException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_clearlayers(LibMCDriver_Rasterizer_Rasterizer pRasterizer)
+{
+	IBase* pIBaseClass = (IBase *)pRasterizer;
+
+	try {
+		IRasterizer* pIRasterizer = dynamic_cast<IRasterizer*>(pIBaseClass);
+		if (!pIRasterizer)
+			throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDCAST);
+		
+		pIRasterizer->ClearLayers();
+
+		return LIBMCDRIVER_RASTERIZER_SUCCESS;
+	}
+	catch (ELibMCDriver_RasterizerInterfaceException & Exception) {
+		return handleLibMCDriver_RasterizerException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_getcalculationstatistics(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCDriver_Rasterizer_uint32 * pLayerCount, LibMCDriver_Rasterizer_uint64 * pLineCount, LibMCDriver_Rasterizer_uint32 * pAllocationCount, LibMCDriver_Rasterizer_uint64 * pDurationInMicroseconds)
+{
+	IBase* pIBaseClass = (IBase *)pRasterizer;
+
+	try {
+		if (!pLayerCount)
+			throw ELibMCDriver_RasterizerInterfaceException (LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
+		if (!pLineCount)
+			throw ELibMCDriver_RasterizerInterfaceException (LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
+		if (!pAllocationCount)
+			throw ELibMCDriver_RasterizerInterfaceException (LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
+		if (!pDurationInMicroseconds)
+			throw ELibMCDriver_RasterizerInterfaceException (LIBMCDRIVER_RASTERIZER_ERROR_INVALIDPARAM);
+		IRasterizer* pIRasterizer = dynamic_cast<IRasterizer*>(pIBaseClass);
+		if (!pIRasterizer)
+			throw ELibMCDriver_RasterizerInterfaceException(LIBMCDRIVER_RASTERIZER_ERROR_INVALIDCAST);
+		
+		pIRasterizer->GetCalculationStatistics(*pLayerCount, *pLineCount, *pAllocationCount, *pDurationInMicroseconds);
+
+		return LIBMCDRIVER_RASTERIZER_SUCCESS;
+	}
+	catch (ELibMCDriver_RasterizerInterfaceException & Exception) {
+		return handleLibMCDriver_RasterizerException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 LibMCDriver_RasterizerResult libmcdriver_rasterizer_rasterizer_calculateimage(LibMCDriver_Rasterizer_Rasterizer pRasterizer, LibMCEnv_ImageData pImageObject, bool bAntialiased)
 {
 	IBase* pIBaseClass = (IBase *)pRasterizer;
@@ -1247,8 +1483,24 @@ LibMCDriver_RasterizerResult LibMCDriver_Rasterizer::Impl::LibMCDriver_Rasterize
 		*ppProcAddress = (void*) &libmcdriver_rasterizer_rasterizer_setsamplingparameters;
 	if (sProcName == "libmcdriver_rasterizer_rasterizer_getsamplingparameters") 
 		*ppProcAddress = (void*) &libmcdriver_rasterizer_rasterizer_getsamplingparameters;
+	if (sProcName == "libmcdriver_rasterizer_rasterizer_setthreadcount") 
+		*ppProcAddress = (void*) &libmcdriver_rasterizer_rasterizer_setthreadcount;
+	if (sProcName == "libmcdriver_rasterizer_rasterizer_getthreadcount") 
+		*ppProcAddress = (void*) &libmcdriver_rasterizer_rasterizer_getthreadcount;
+	if (sProcName == "libmcdriver_rasterizer_rasterizer_setsimdkernelsenabled") 
+		*ppProcAddress = (void*) &libmcdriver_rasterizer_rasterizer_setsimdkernelsenabled;
+	if (sProcName == "libmcdriver_rasterizer_rasterizer_getsimdkernelname") 
+		*ppProcAddress = (void*) &libmcdriver_rasterizer_rasterizer_getsimdkernelname;
 	if (sProcName == "libmcdriver_rasterizer_rasterizer_addlayer") 
 		*ppProcAddress = (void*) &libmcdriver_rasterizer_rasterizer_addlayer;
+	if (sProcName == "libmcdriver_rasterizer_rasterizer_addtoolpathlayer") 
+		*ppProcAddress = (void*) &libmcdriver_rasterizer_rasterizer_addtoolpathlayer;
+	if (sProcName == "libmcdriver_rasterizer_rasterizer_addslicestacklayer") 
+		*ppProcAddress = (void*) &libmcdriver_rasterizer_rasterizer_addslicestacklayer;
+	if (sProcName == "libmcdriver_rasterizer_rasterizer_clearlayers") 
+		*ppProcAddress = (void*) &libmcdriver_rasterizer_rasterizer_clearlayers;
+	if (sProcName == "libmcdriver_rasterizer_rasterizer_getcalculationstatistics") 
+		*ppProcAddress = (void*) &libmcdriver_rasterizer_rasterizer_getcalculationstatistics;
 	if (sProcName == "libmcdriver_rasterizer_rasterizer_calculateimage") 
 		*ppProcAddress = (void*) &libmcdriver_rasterizer_rasterizer_calculateimage;
 	if (sProcName == "libmcdriver_rasterizer_slicestack_getlayercount") 
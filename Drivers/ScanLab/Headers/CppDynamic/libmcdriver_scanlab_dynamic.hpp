@@ -351,6 +351,15 @@ public:
 			case LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELYNOTRECORDED: return "RTCCHANNELYNOTRECORDED";
 			case LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELZNOTRECORDED: return "RTCCHANNELZNOTRECORDED";
 			case LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELXANDYRECORDCOUNTMISMATCH: return "RTCCHANNELXANDYRECORDCOUNTMISMATCH";
+			case LIBMCDRIVER_SCANLAB_ERROR_INVALIDLISTSTREAMINGCHUNKSIZE: return "INVALIDLISTSTREAMINGCHUNKSIZE";
+			case LIBMCDRIVER_SCANLAB_ERROR_LISTSTREAMINGALREADYACTIVE: return "LISTSTREAMINGALREADYACTIVE";
+			case LIBMCDRIVER_SCANLAB_ERROR_LISTSTREAMINGNOTACTIVE: return "LISTSTREAMINGNOTACTIVE";
+			case LIBMCDRIVER_SCANLAB_ERROR_INVALIDSTATUSMONITORINTERVAL: return "INVALIDSTATUSMONITORINTERVAL";
+			case LIBMCDRIVER_SCANLAB_ERROR_INVALIDCOMMANDSTREAMCONFIGURATION: return "INVALIDCOMMANDSTREAMCONFIGURATION";
+			case LIBMCDRIVER_SCANLAB_ERROR_COMMANDSTREAMCOMPILATIONNOTENABLED: return "COMMANDSTREAMCOMPILATIONNOTENABLED";
+			case LIBMCDRIVER_SCANLAB_ERROR_NOLAYERDISPATCHSTATISTICS: return "NOLAYERDISPATCHSTATISTICS";
+			case LIBMCDRIVER_SCANLAB_ERROR_SDKISNOTEMULATED: return "SDKISNOTEMULATED";
+			case LIBMCDRIVER_SCANLAB_ERROR_INVALIDEMULATIONTIMEFACTOR: return "INVALIDEMULATIONTIMEFACTOR";
 		}
 		return "UNKNOWN";
 	}
@@ -508,6 +517,15 @@ public:
 			case LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELYNOTRECORDED: return "RTC Channel Y not recorded.";
 			case LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELZNOTRECORDED: return "RTC Channel Z not recorded.";
 			case LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELXANDYRECORDCOUNTMISMATCH: return "RTC X and Y record count mismatch.";
+			case LIBMCDRIVER_SCANLAB_ERROR_INVALIDLISTSTREAMINGCHUNKSIZE: return "Invalid list streaming chunk size.";
+			case LIBMCDRIVER_SCANLAB_ERROR_LISTSTREAMINGALREADYACTIVE: return "List streaming is already active.";
+			case LIBMCDRIVER_SCANLAB_ERROR_LISTSTREAMINGNOTACTIVE: return "List streaming is not active.";
+			case LIBMCDRIVER_SCANLAB_ERROR_INVALIDSTATUSMONITORINTERVAL: return "Invalid status monitor interval.";
+			case LIBMCDRIVER_SCANLAB_ERROR_INVALIDCOMMANDSTREAMCONFIGURATION: return "Invalid command stream configuration.";
+			case LIBMCDRIVER_SCANLAB_ERROR_COMMANDSTREAMCOMPILATIONNOTENABLED: return "Command stream compilation is not enabled.";
+			case LIBMCDRIVER_SCANLAB_ERROR_NOLAYERDISPATCHSTATISTICS: return "No layer dispatch statistics available.";
+			case LIBMCDRIVER_SCANLAB_ERROR_SDKISNOTEMULATED: return "SDK is not emulated.";
+			case LIBMCDRIVER_SCANLAB_ERROR_INVALIDEMULATIONTIMEFACTOR: return "Invalid emulation time factor.";
 		}
 		return "unknown error";
 	}
@@ -995,6 +1013,13 @@ public:
 	inline void DisablePowerModulation();
 	inline void EnableLineSubdivision(const LibMCDriver_ScanLab_double dLengthThreshold);
 	inline void DisableLineSubdivision();
+	inline void EnableCommandStreamCompilation(const LibMCDriver_ScanLab_uint32 nThreadCount, const LibMCDriver_ScanLab_uint32 nMaxCachedLayers);
+	inline void DisableCommandStreamCompilation();
+	inline bool CommandStreamCompilationIsEnabled();
+	inline void ClearCompiledLayerCache();
+	inline void GetCommandStreamStatistics(LibMCDriver_ScanLab_uint32 & nCompiledLayerCount, LibMCDriver_ScanLab_uint32 & nCacheHitCount, LibMCDriver_ScanLab_uint64 & nLastCommandCount, LibMCDriver_ScanLab_double & dLastCompileTime);
+	inline void ResetEmulationStatistics();
+	inline void GetEmulationStatistics(LibMCDriver_ScanLab_uint64 & nListCommandCount, LibMCDriver_ScanLab_uint64 & nListCommandHash, LibMCDriver_ScanLab_double & dMarkTime, LibMCDriver_ScanLab_double & dJumpTime, LibMCDriver_ScanLab_double & dExecutionTime);
 	inline LibMCDriver_ScanLab_int32 ReadMultiMCBSP(const LibMCDriver_ScanLab_uint32 nRegisterNo);
 	inline PUARTConnection CreateUARTConnection(const LibMCDriver_ScanLab_uint32 nDesiredBaudRate);
 	inline void EnableScanAhead(const LibMCDriver_ScanLab_uint32 nHeadNo, const LibMCDriver_ScanLab_uint32 nTableNo);
@@ -1047,6 +1072,9 @@ public:
 	
 	inline void LoadSDK(const std::string & sResourceName);
 	inline void LoadCustomSDK(const CInputVector<LibMCDriver_ScanLab_uint8> & ScanlabDLLBuffer);
+	inline void LoadEmulatedSDK(const LibMCDriver_ScanLab_uint32 nSerialNumber);
+	inline bool IsSDKEmulated();
+	inline void SetEmulationTimeFactor(const LibMCDriver_ScanLab_double dTimeFactor);
 	inline PRTCSelector CreateRTCSelector();
 	inline void EnableJournaling();
 	inline void SetFirmware(const std::string & sFirmwareResource, const std::string & sFPGAResource, const std::string & sAuxiliaryResource);
@@ -1087,6 +1115,11 @@ public:
 	inline eOIERecordingMode GetOIERecordingMode();
 	inline void EnableAttributeFilter(const std::string & sNameSpace, const std::string & sAttributeName, const LibMCDriver_ScanLab_int64 nAttributeValue);
 	inline void DisableAttributeFilter();
+	inline void EnableListStreaming(const LibMCDriver_ScanLab_uint32 nChunkSize);
+	inline void DisableListStreaming();
+	inline bool ListStreamingIsEnabled();
+	inline void SetStatusMonitorIntervals(const LibMCDriver_ScanLab_uint32 nMinPollIntervalInMicroseconds, const LibMCDriver_ScanLab_uint32 nMaxPollIntervalInMicroseconds, const LibMCDriver_ScanLab_uint32 nStatusUpdateIntervalInMilliseconds);
+	inline void GetStatusMonitorIntervals(LibMCDriver_ScanLab_uint32 & nMinPollIntervalInMicroseconds, LibMCDriver_ScanLab_uint32 & nMaxPollIntervalInMicroseconds, LibMCDriver_ScanLab_uint32 & nStatusUpdateIntervalInMilliseconds);
 	inline void DrawLayer(const std::string & sStreamUUID, const LibMCDriver_ScanLab_uint32 nLayerIndex);
 	inline void GetCommunicationTimeouts(LibMCDriver_ScanLab_double & dInitialTimeout, LibMCDriver_ScanLab_double & dMaxTimeout, LibMCDriver_ScanLab_double & dMultiplier);
 	inline void GetDefaultCommunicationTimeouts(LibMCDriver_ScanLab_double & dInitialTimeout, LibMCDriver_ScanLab_double & dMaxTimeout, LibMCDriver_ScanLab_double & dMultiplier);
@@ -1131,6 +1164,9 @@ public:
 	inline void EnableAttributeFilter(const std::string & sNameSpace, const std::string & sAttributeName, const LibMCDriver_ScanLab_int64 nAttributeValue);
 	inline void DisableAttributeFilter();
 	inline void DrawLayer(const std::string & sStreamUUID, const LibMCDriver_ScanLab_uint32 nLayerIndex, const bool bFailIfNonAssignedDataExists);
+	inline void DrawLayerParallel(const std::string & sStreamUUID, const LibMCDriver_ScanLab_uint32 nLayerIndex, const bool bFailIfNonAssignedDataExists);
+	inline void GetLayerDispatchStatistics(LibMCDriver_ScanLab_double & dLayerLatency, LibMCDriver_ScanLab_double & dStartSkew);
+	inline void GetScannerDispatchStatistics(const LibMCDriver_ScanLab_uint32 nScannerIndex, LibMCDriver_ScanLab_double & dListBuildTime, LibMCDriver_ScanLab_double & dStartDelay, LibMCDriver_ScanLab_double & dExecutionTime);
 	inline void SetAllCommunicationTimeouts(const LibMCDriver_ScanLab_double dInitialTimeout, const LibMCDriver_ScanLab_double dMaxTimeout, const LibMCDriver_ScanLab_double dMultiplier);
 	inline void SetCommunicationTimeouts(const LibMCDriver_ScanLab_uint32 nScannerIndex, const LibMCDriver_ScanLab_double dInitialTimeout, const LibMCDriver_ScanLab_double dMaxTimeout, const LibMCDriver_ScanLab_double dMultiplier);
 	inline void GetCommunicationTimeouts(const LibMCDriver_ScanLab_uint32 nScannerIndex, LibMCDriver_ScanLab_double & dInitialTimeout, LibMCDriver_ScanLab_double & dMaxTimeout, LibMCDriver_ScanLab_double & dMultiplier);
@@ -1445,6 +1481,13 @@ public:
 		pWrapperTable->m_RTCContext_DisablePowerModulation = nullptr;
 		pWrapperTable->m_RTCContext_EnableLineSubdivision = nullptr;
 		pWrapperTable->m_RTCContext_DisableLineSubdivision = nullptr;
+		pWrapperTable->m_RTCContext_EnableCommandStreamCompilation = nullptr;
+		pWrapperTable->m_RTCContext_DisableCommandStreamCompilation = nullptr;
+		pWrapperTable->m_RTCContext_CommandStreamCompilationIsEnabled = nullptr;
+		pWrapperTable->m_RTCContext_ClearCompiledLayerCache = nullptr;
+		pWrapperTable->m_RTCContext_GetCommandStreamStatistics = nullptr;
+		pWrapperTable->m_RTCContext_ResetEmulationStatistics = nullptr;
+		pWrapperTable->m_RTCContext_GetEmulationStatistics = nullptr;
 		pWrapperTable->m_RTCContext_ReadMultiMCBSP = nullptr;
 		pWrapperTable->m_RTCContext_CreateUARTConnection = nullptr;
 		pWrapperTable->m_RTCContext_EnableScanAhead = nullptr;
@@ -1465,6 +1508,9 @@ public:
 		pWrapperTable->m_RTCSelector_AcquireEthernetCardBySerial = nullptr;
 		pWrapperTable->m_Driver_ScanLab_LoadSDK = nullptr;
 		pWrapperTable->m_Driver_ScanLab_LoadCustomSDK = nullptr;
+		pWrapperTable->m_Driver_ScanLab_LoadEmulatedSDK = nullptr;
+		pWrapperTable->m_Driver_ScanLab_IsSDKEmulated = nullptr;
+		pWrapperTable->m_Driver_ScanLab_SetEmulationTimeFactor = nullptr;
 		pWrapperTable->m_Driver_ScanLab_CreateRTCSelector = nullptr;
 		pWrapperTable->m_Driver_ScanLab_EnableJournaling = nullptr;
 		pWrapperTable->m_Driver_ScanLab_SetFirmware = nullptr;
@@ -1489,6 +1535,11 @@ public:
 		pWrapperTable->m_Driver_ScanLab_RTC6_GetOIERecordingMode = nullptr;
 		pWrapperTable->m_Driver_ScanLab_RTC6_EnableAttributeFilter = nullptr;
 		pWrapperTable->m_Driver_ScanLab_RTC6_DisableAttributeFilter = nullptr;
+		pWrapperTable->m_Driver_ScanLab_RTC6_EnableListStreaming = nullptr;
+		pWrapperTable->m_Driver_ScanLab_RTC6_DisableListStreaming = nullptr;
+		pWrapperTable->m_Driver_ScanLab_RTC6_ListStreamingIsEnabled = nullptr;
+		pWrapperTable->m_Driver_ScanLab_RTC6_SetStatusMonitorIntervals = nullptr;
+		pWrapperTable->m_Driver_ScanLab_RTC6_GetStatusMonitorIntervals = nullptr;
 		pWrapperTable->m_Driver_ScanLab_RTC6_DrawLayer = nullptr;
 		pWrapperTable->m_Driver_ScanLab_RTC6_GetCommunicationTimeouts = nullptr;
 		pWrapperTable->m_Driver_ScanLab_RTC6_GetDefaultCommunicationTimeouts = nullptr;
@@ -1517,6 +1568,9 @@ public:
 		pWrapperTable->m_Driver_ScanLab_RTC6xN_EnableAttributeFilter = nullptr;
 		pWrapperTable->m_Driver_ScanLab_RTC6xN_DisableAttributeFilter = nullptr;
 		pWrapperTable->m_Driver_ScanLab_RTC6xN_DrawLayer = nullptr;
+		pWrapperTable->m_Driver_ScanLab_RTC6xN_DrawLayerParallel = nullptr;
+		pWrapperTable->m_Driver_ScanLab_RTC6xN_GetLayerDispatchStatistics = nullptr;
+		pWrapperTable->m_Driver_ScanLab_RTC6xN_GetScannerDispatchStatistics = nullptr;
 		pWrapperTable->m_Driver_ScanLab_RTC6xN_SetAllCommunicationTimeouts = nullptr;
 		pWrapperTable->m_Driver_ScanLab_RTC6xN_SetCommunicationTimeouts = nullptr;
 		pWrapperTable->m_Driver_ScanLab_RTC6xN_GetCommunicationTimeouts = nullptr;
@@ -3236,6 +3290,69 @@ public:
 		if (pWrapperTable->m_RTCContext_DisableLineSubdivision == nullptr)
 			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_RTCContext_EnableCommandStreamCompilation = (PLibMCDriver_ScanLabRTCContext_EnableCommandStreamCompilationPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_rtccontext_enablecommandstreamcompilation");
+		#else // _WIN32
+		pWrapperTable->m_RTCContext_EnableCommandStreamCompilation = (PLibMCDriver_ScanLabRTCContext_EnableCommandStreamCompilationPtr) dlsym(hLibrary, "libmcdriver_scanlab_rtccontext_enablecommandstreamcompilation");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_RTCContext_EnableCommandStreamCompilation == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_RTCContext_DisableCommandStreamCompilation = (PLibMCDriver_ScanLabRTCContext_DisableCommandStreamCompilationPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_rtccontext_disablecommandstreamcompilation");
+		#else // _WIN32
+		pWrapperTable->m_RTCContext_DisableCommandStreamCompilation = (PLibMCDriver_ScanLabRTCContext_DisableCommandStreamCompilationPtr) dlsym(hLibrary, "libmcdriver_scanlab_rtccontext_disablecommandstreamcompilation");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_RTCContext_DisableCommandStreamCompilation == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_RTCContext_CommandStreamCompilationIsEnabled = (PLibMCDriver_ScanLabRTCContext_CommandStreamCompilationIsEnabledPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_rtccontext_commandstreamcompilationisenabled");
+		#else // _WIN32
+		pWrapperTable->m_RTCContext_CommandStreamCompilationIsEnabled = (PLibMCDriver_ScanLabRTCContext_CommandStreamCompilationIsEnabledPtr) dlsym(hLibrary, "libmcdriver_scanlab_rtccontext_commandstreamcompilationisenabled");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_RTCContext_CommandStreamCompilationIsEnabled == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_RTCContext_ClearCompiledLayerCache = (PLibMCDriver_ScanLabRTCContext_ClearCompiledLayerCachePtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_rtccontext_clearcompiledlayercache");
+		#else // _WIN32
+		pWrapperTable->m_RTCContext_ClearCompiledLayerCache = (PLibMCDriver_ScanLabRTCContext_ClearCompiledLayerCachePtr) dlsym(hLibrary, "libmcdriver_scanlab_rtccontext_clearcompiledlayercache");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_RTCContext_ClearCompiledLayerCache == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_RTCContext_GetCommandStreamStatistics = (PLibMCDriver_ScanLabRTCContext_GetCommandStreamStatisticsPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_rtccontext_getcommandstreamstatistics");
+		#else // _WIN32
+		pWrapperTable->m_RTCContext_GetCommandStreamStatistics = (PLibMCDriver_ScanLabRTCContext_GetCommandStreamStatisticsPtr) dlsym(hLibrary, "libmcdriver_scanlab_rtccontext_getcommandstreamstatistics");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_RTCContext_GetCommandStreamStatistics == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_RTCContext_ResetEmulationStatistics = (PLibMCDriver_ScanLabRTCContext_ResetEmulationStatisticsPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_rtccontext_resetemulationstatistics");
+		#else // _WIN32
+		pWrapperTable->m_RTCContext_ResetEmulationStatistics = (PLibMCDriver_ScanLabRTCContext_ResetEmulationStatisticsPtr) dlsym(hLibrary, "libmcdriver_scanlab_rtccontext_resetemulationstatistics");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_RTCContext_ResetEmulationStatistics == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_RTCContext_GetEmulationStatistics = (PLibMCDriver_ScanLabRTCContext_GetEmulationStatisticsPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_rtccontext_getemulationstatistics");
+		#else // _WIN32
+		pWrapperTable->m_RTCContext_GetEmulationStatistics = (PLibMCDriver_ScanLabRTCContext_GetEmulationStatisticsPtr) dlsym(hLibrary, "libmcdriver_scanlab_rtccontext_getemulationstatistics");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_RTCContext_GetEmulationStatistics == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_RTCContext_ReadMultiMCBSP = (PLibMCDriver_ScanLabRTCContext_ReadMultiMCBSPPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_rtccontext_readmultimcbsp");
 		#else // _WIN32
@@ -3416,6 +3533,33 @@ public:
 		if (pWrapperTable->m_Driver_ScanLab_LoadCustomSDK == nullptr)
 			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_ScanLab_LoadEmulatedSDK = (PLibMCDriver_ScanLabDriver_ScanLab_LoadEmulatedSDKPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_driver_scanlab_loademulatedsdk");
+		#else // _WIN32
+		pWrapperTable->m_Driver_ScanLab_LoadEmulatedSDK = (PLibMCDriver_ScanLabDriver_ScanLab_LoadEmulatedSDKPtr) dlsym(hLibrary, "libmcdriver_scanlab_driver_scanlab_loademulatedsdk");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_ScanLab_LoadEmulatedSDK == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_ScanLab_IsSDKEmulated = (PLibMCDriver_ScanLabDriver_ScanLab_IsSDKEmulatedPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_driver_scanlab_issdkemulated");
+		#else // _WIN32
+		pWrapperTable->m_Driver_ScanLab_IsSDKEmulated = (PLibMCDriver_ScanLabDriver_ScanLab_IsSDKEmulatedPtr) dlsym(hLibrary, "libmcdriver_scanlab_driver_scanlab_issdkemulated");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_ScanLab_IsSDKEmulated == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_ScanLab_SetEmulationTimeFactor = (PLibMCDriver_ScanLabDriver_ScanLab_SetEmulationTimeFactorPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_driver_scanlab_setemulationtimefactor");
+		#else // _WIN32
+		pWrapperTable->m_Driver_ScanLab_SetEmulationTimeFactor = (PLibMCDriver_ScanLabDriver_ScanLab_SetEmulationTimeFactorPtr) dlsym(hLibrary, "libmcdriver_scanlab_driver_scanlab_setemulationtimefactor");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_ScanLab_SetEmulationTimeFactor == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Driver_ScanLab_CreateRTCSelector = (PLibMCDriver_ScanLabDriver_ScanLab_CreateRTCSelectorPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_driver_scanlab_creatertcselector");
 		#else // _WIN32
@@ -3632,6 +3776,51 @@ public:
 		if (pWrapperTable->m_Driver_ScanLab_RTC6_DisableAttributeFilter == nullptr)
 			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_ScanLab_RTC6_EnableListStreaming = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6_EnableListStreamingPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6_enableliststreaming");
+		#else // _WIN32
+		pWrapperTable->m_Driver_ScanLab_RTC6_EnableListStreaming = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6_EnableListStreamingPtr) dlsym(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6_enableliststreaming");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_ScanLab_RTC6_EnableListStreaming == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_ScanLab_RTC6_DisableListStreaming = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6_DisableListStreamingPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6_disableliststreaming");
+		#else // _WIN32
+		pWrapperTable->m_Driver_ScanLab_RTC6_DisableListStreaming = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6_DisableListStreamingPtr) dlsym(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6_disableliststreaming");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_ScanLab_RTC6_DisableListStreaming == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_ScanLab_RTC6_ListStreamingIsEnabled = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6_ListStreamingIsEnabledPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6_liststreamingisenabled");
+		#else // _WIN32
+		pWrapperTable->m_Driver_ScanLab_RTC6_ListStreamingIsEnabled = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6_ListStreamingIsEnabledPtr) dlsym(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6_liststreamingisenabled");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_ScanLab_RTC6_ListStreamingIsEnabled == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_ScanLab_RTC6_SetStatusMonitorIntervals = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6_SetStatusMonitorIntervalsPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6_setstatusmonitorintervals");
+		#else // _WIN32
+		pWrapperTable->m_Driver_ScanLab_RTC6_SetStatusMonitorIntervals = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6_SetStatusMonitorIntervalsPtr) dlsym(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6_setstatusmonitorintervals");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_ScanLab_RTC6_SetStatusMonitorIntervals == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_ScanLab_RTC6_GetStatusMonitorIntervals = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6_GetStatusMonitorIntervalsPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6_getstatusmonitorintervals");
+		#else // _WIN32
+		pWrapperTable->m_Driver_ScanLab_RTC6_GetStatusMonitorIntervals = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6_GetStatusMonitorIntervalsPtr) dlsym(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6_getstatusmonitorintervals");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_ScanLab_RTC6_GetStatusMonitorIntervals == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Driver_ScanLab_RTC6_DrawLayer = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6_DrawLayerPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6_drawlayer");
 		#else // _WIN32
@@ -3884,6 +4073,33 @@ public:
 		if (pWrapperTable->m_Driver_ScanLab_RTC6xN_DrawLayer == nullptr)
 			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_ScanLab_RTC6xN_DrawLayerParallel = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6xN_DrawLayerParallelPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6xn_drawlayerparallel");
+		#else // _WIN32
+		pWrapperTable->m_Driver_ScanLab_RTC6xN_DrawLayerParallel = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6xN_DrawLayerParallelPtr) dlsym(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6xn_drawlayerparallel");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_ScanLab_RTC6xN_DrawLayerParallel == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_ScanLab_RTC6xN_GetLayerDispatchStatistics = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6xN_GetLayerDispatchStatisticsPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6xn_getlayerdispatchstatistics");
+		#else // _WIN32
+		pWrapperTable->m_Driver_ScanLab_RTC6xN_GetLayerDispatchStatistics = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6xN_GetLayerDispatchStatisticsPtr) dlsym(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6xn_getlayerdispatchstatistics");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_ScanLab_RTC6xN_GetLayerDispatchStatistics == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_ScanLab_RTC6xN_GetScannerDispatchStatistics = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6xN_GetScannerDispatchStatisticsPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6xn_getscannerdispatchstatistics");
+		#else // _WIN32
+		pWrapperTable->m_Driver_ScanLab_RTC6xN_GetScannerDispatchStatistics = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6xN_GetScannerDispatchStatisticsPtr) dlsym(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6xn_getscannerdispatchstatistics");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_ScanLab_RTC6xN_GetScannerDispatchStatistics == nullptr)
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Driver_ScanLab_RTC6xN_SetAllCommunicationTimeouts = (PLibMCDriver_ScanLabDriver_ScanLab_RTC6xN_SetAllCommunicationTimeoutsPtr) GetProcAddress(hLibrary, "libmcdriver_scanlab_driver_scanlab_rtc6xn_setallcommunicationtimeouts");
 		#else // _WIN32
@@ -4753,6 +4969,34 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_RTCContext_DisableLineSubdivision == nullptr) )
 			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_rtccontext_enablecommandstreamcompilation", (void**)&(pWrapperTable->m_RTCContext_EnableCommandStreamCompilation));
+		if ( (eLookupError != 0) || (pWrapperTable->m_RTCContext_EnableCommandStreamCompilation == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_rtccontext_disablecommandstreamcompilation", (void**)&(pWrapperTable->m_RTCContext_DisableCommandStreamCompilation));
+		if ( (eLookupError != 0) || (pWrapperTable->m_RTCContext_DisableCommandStreamCompilation == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_rtccontext_commandstreamcompilationisenabled", (void**)&(pWrapperTable->m_RTCContext_CommandStreamCompilationIsEnabled));
+		if ( (eLookupError != 0) || (pWrapperTable->m_RTCContext_CommandStreamCompilationIsEnabled == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_rtccontext_clearcompiledlayercache", (void**)&(pWrapperTable->m_RTCContext_ClearCompiledLayerCache));
+		if ( (eLookupError != 0) || (pWrapperTable->m_RTCContext_ClearCompiledLayerCache == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_rtccontext_getcommandstreamstatistics", (void**)&(pWrapperTable->m_RTCContext_GetCommandStreamStatistics));
+		if ( (eLookupError != 0) || (pWrapperTable->m_RTCContext_GetCommandStreamStatistics == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_rtccontext_resetemulationstatistics", (void**)&(pWrapperTable->m_RTCContext_ResetEmulationStatistics));
+		if ( (eLookupError != 0) || (pWrapperTable->m_RTCContext_ResetEmulationStatistics == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_rtccontext_getemulationstatistics", (void**)&(pWrapperTable->m_RTCContext_GetEmulationStatistics));
+		if ( (eLookupError != 0) || (pWrapperTable->m_RTCContext_GetEmulationStatistics == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_scanlab_rtccontext_readmultimcbsp", (void**)&(pWrapperTable->m_RTCContext_ReadMultiMCBSP));
 		if ( (eLookupError != 0) || (pWrapperTable->m_RTCContext_ReadMultiMCBSP == nullptr) )
 			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -4833,6 +5077,18 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLab_LoadCustomSDK == nullptr) )
 			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_driver_scanlab_loademulatedsdk", (void**)&(pWrapperTable->m_Driver_ScanLab_LoadEmulatedSDK));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLab_LoadEmulatedSDK == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_driver_scanlab_issdkemulated", (void**)&(pWrapperTable->m_Driver_ScanLab_IsSDKEmulated));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLab_IsSDKEmulated == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_driver_scanlab_setemulationtimefactor", (void**)&(pWrapperTable->m_Driver_ScanLab_SetEmulationTimeFactor));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLab_SetEmulationTimeFactor == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_scanlab_driver_scanlab_creatertcselector", (void**)&(pWrapperTable->m_Driver_ScanLab_CreateRTCSelector));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLab_CreateRTCSelector == nullptr) )
 			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -4929,6 +5185,26 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLab_RTC6_DisableAttributeFilter == nullptr) )
 			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_driver_scanlab_rtc6_enableliststreaming", (void**)&(pWrapperTable->m_Driver_ScanLab_RTC6_EnableListStreaming));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLab_RTC6_EnableListStreaming == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_driver_scanlab_rtc6_disableliststreaming", (void**)&(pWrapperTable->m_Driver_ScanLab_RTC6_DisableListStreaming));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLab_RTC6_DisableListStreaming == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_driver_scanlab_rtc6_liststreamingisenabled", (void**)&(pWrapperTable->m_Driver_ScanLab_RTC6_ListStreamingIsEnabled));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLab_RTC6_ListStreamingIsEnabled == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_driver_scanlab_rtc6_setstatusmonitorintervals", (void**)&(pWrapperTable->m_Driver_ScanLab_RTC6_SetStatusMonitorIntervals));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLab_RTC6_SetStatusMonitorIntervals == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_driver_scanlab_rtc6_getstatusmonitorintervals", (void**)&(pWrapperTable->m_Driver_ScanLab_RTC6_GetStatusMonitorIntervals));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLab_RTC6_GetStatusMonitorIntervals == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_scanlab_driver_scanlab_rtc6_drawlayer", (void**)&(pWrapperTable->m_Driver_ScanLab_RTC6_DrawLayer));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLab_RTC6_DrawLayer == nullptr) )
 			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -5041,6 +5317,18 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLab_RTC6xN_DrawLayer == nullptr) )
 			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_driver_scanlab_rtc6xn_drawlayerparallel", (void**)&(pWrapperTable->m_Driver_ScanLab_RTC6xN_DrawLayerParallel));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLab_RTC6xN_DrawLayerParallel == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_driver_scanlab_rtc6xn_getlayerdispatchstatistics", (void**)&(pWrapperTable->m_Driver_ScanLab_RTC6xN_GetLayerDispatchStatistics));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLab_RTC6xN_GetLayerDispatchStatistics == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlab_driver_scanlab_rtc6xn_getscannerdispatchstatistics", (void**)&(pWrapperTable->m_Driver_ScanLab_RTC6xN_GetScannerDispatchStatistics));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLab_RTC6xN_GetScannerDispatchStatistics == nullptr) )
+			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_scanlab_driver_scanlab_rtc6xn_setallcommunicationtimeouts", (void**)&(pWrapperTable->m_Driver_ScanLab_RTC6xN_SetAllCommunicationTimeouts));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLab_RTC6xN_SetAllCommunicationTimeouts == nullptr) )
 			return LIBMCDRIVER_SCANLAB_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -7123,6 +7411,77 @@ public:
 		CheckError(m_pWrapper->m_WrapperTable.m_RTCContext_DisableLineSubdivision(m_pHandle));
 	}
 	
+	/**
+	* CRTCContext::EnableCommandStreamCompilation - Enables the compilation of layers in AddLayerToList. Layers are converted into list commands in parallel before they are written to the list. Compiled layers are cached, so that repeated layers are not compiled again. Layers are written directly if a power modulation callback or a laser power calibration is set.
+	* @param[in] nThreadCount - Number of compile threads. 0 uses the number of hardware threads. Maximum is 64.
+	* @param[in] nMaxCachedLayers - Maximum number of compiled layers that are kept. 0 disables the cache. Maximum is 4096.
+	*/
+	void CRTCContext::EnableCommandStreamCompilation(const LibMCDriver_ScanLab_uint32 nThreadCount, const LibMCDriver_ScanLab_uint32 nMaxCachedLayers)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_RTCContext_EnableCommandStreamCompilation(m_pHandle, nThreadCount, nMaxCachedLayers));
+	}
+	
+	/**
+	* CRTCContext::DisableCommandStreamCompilation - Disables the compilation of layers and releases all cached layers. This is the default.
+	*/
+	void CRTCContext::DisableCommandStreamCompilation()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_RTCContext_DisableCommandStreamCompilation(m_pHandle));
+	}
+	
+	/**
+	* CRTCContext::CommandStreamCompilationIsEnabled - Returns if layers are compiled in AddLayerToList.
+	* @return True if command stream compilation is enabled.
+	*/
+	bool CRTCContext::CommandStreamCompilationIsEnabled()
+	{
+		bool resultIsEnabled = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_RTCContext_CommandStreamCompilationIsEnabled(m_pHandle, &resultIsEnabled));
+		
+		return resultIsEnabled;
+	}
+	
+	/**
+	* CRTCContext::ClearCompiledLayerCache - Releases all cached compiled layers.
+	*/
+	void CRTCContext::ClearCompiledLayerCache()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_RTCContext_ClearCompiledLayerCache(m_pHandle));
+	}
+	
+	/**
+	* CRTCContext::GetCommandStreamStatistics - Returns statistics of the command stream compilation. Fails if command stream compilation is not enabled.
+	* @param[out] nCompiledLayerCount - Number of compiled layers.
+	* @param[out] nCacheHitCount - Number of layers that have been taken from the cache.
+	* @param[out] nLastCommandCount - Number of list commands of the last layer.
+	* @param[out] dLastCompileTime - Compile time of the last layer in milliseconds, including the cache lookup.
+	*/
+	void CRTCContext::GetCommandStreamStatistics(LibMCDriver_ScanLab_uint32 & nCompiledLayerCount, LibMCDriver_ScanLab_uint32 & nCacheHitCount, LibMCDriver_ScanLab_uint64 & nLastCommandCount, LibMCDriver_ScanLab_double & dLastCompileTime)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_RTCContext_GetCommandStreamStatistics(m_pHandle, &nCompiledLayerCount, &nCacheHitCount, &nLastCommandCount, &dLastCompileTime));
+	}
+	
+	/**
+	* CRTCContext::ResetEmulationStatistics - Resets the statistics of the emulated card. Fails if the SDK is not emulated.
+	*/
+	void CRTCContext::ResetEmulationStatistics()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_RTCContext_ResetEmulationStatistics(m_pHandle));
+	}
+	
+	/**
+	* CRTCContext::GetEmulationStatistics - Returns the statistics of the emulated card since the last reset. Fails if the SDK is not emulated.
+	* @param[out] nListCommandCount - Number of accepted list commands.
+	* @param[out] nListCommandHash - Order dependent hash of all accepted list commands and their parameters.
+	* @param[out] dMarkTime - Emulated mark time in ms.
+	* @param[out] dJumpTime - Emulated jump time in ms.
+	* @param[out] dExecutionTime - Emulated execution time including delays in ms.
+	*/
+	void CRTCContext::GetEmulationStatistics(LibMCDriver_ScanLab_uint64 & nListCommandCount, LibMCDriver_ScanLab_uint64 & nListCommandHash, LibMCDriver_ScanLab_double & dMarkTime, LibMCDriver_ScanLab_double & dJumpTime, LibMCDriver_ScanLab_double & dExecutionTime)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_RTCContext_GetEmulationStatistics(m_pHandle, &nListCommandCount, &nListCommandHash, &dMarkTime, &dJumpTime, &dExecutionTime));
+	}
+	
 	/**
 	* CRTCContext::ReadMultiMCBSP - Reads a multi MCBSP register from the RTC Card. Should be used only for debugging purposes.
 	* @param[in] nRegisterNo - Number of the register to read.
@@ -7373,6 +7732,36 @@ public:
 		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ScanLab_LoadCustomSDK(m_pHandle, (LibMCDriver_ScanLab_uint64)ScanlabDLLBuffer.size(), ScanlabDLLBuffer.data()));
 	}
 	
+	/**
+	* CDriver_ScanLab::LoadEmulatedSDK - Initializes the ScanLab SDK with a built-in RTC6 card emulation instead of the RTC DLL. The emulated card executes lists in virtual time and allows to benchmark list generation without hardware.
+	* @param[in] nSerialNumber - Serial number of the first emulated card. Card N reports SerialNumber + N - 1.
+	*/
+	void CDriver_ScanLab::LoadEmulatedSDK(const LibMCDriver_ScanLab_uint32 nSerialNumber)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ScanLab_LoadEmulatedSDK(m_pHandle, nSerialNumber));
+	}
+	
+	/**
+	* CDriver_ScanLab::IsSDKEmulated - Returns if the loaded ScanLab SDK is the built-in card emulation.
+	* @return True if LoadEmulatedSDK has been called.
+	*/
+	bool CDriver_ScanLab::IsSDKEmulated()
+	{
+		bool resultIsEmulated = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ScanLab_IsSDKEmulated(m_pHandle, &resultIsEmulated));
+		
+		return resultIsEmulated;
+	}
+	
+	/**
+	* CDriver_ScanLab::SetEmulationTimeFactor - Sets how fast emulated cards report their lists as busy, relative to the virtual execution time of the list. Applies to all emulated cards. Fails if the SDK is not emulated.
+	* @param[in] dTimeFactor - Wall clock time per virtual time. 1.0 is real time, 0.0 finishes every list immediately. MUST not be negative.
+	*/
+	void CDriver_ScanLab::SetEmulationTimeFactor(const LibMCDriver_ScanLab_double dTimeFactor)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ScanLab_SetEmulationTimeFactor(m_pHandle, dTimeFactor));
+	}
+	
 	/**
 	* CDriver_ScanLab::CreateRTCSelector - Creates and initializes a new RTC selector singleton. Should only be called once per Process.
 	* @return New Selector instance
@@ -7663,6 +8052,57 @@ public:
 		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ScanLab_RTC6_DisableAttributeFilter(m_pHandle));
 	}
 	
+	/**
+	* CDriver_ScanLab_RTC6::EnableListStreaming - Enables double buffered list streaming for DrawLayer. The layer is split into chunks that are alternately loaded into list 1 and list 2, so marking starts as soon as the first chunk is loaded. Needs lists that are larger than the chunk size plus a reserve of 16384 positions.
+	* @param[in] nChunkSize - Number of list positions per chunk. Minimum is 1024.
+	*/
+	void CDriver_ScanLab_RTC6::EnableListStreaming(const LibMCDriver_ScanLab_uint32 nChunkSize)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ScanLab_RTC6_EnableListStreaming(m_pHandle, nChunkSize));
+	}
+	
+	/**
+	* CDriver_ScanLab_RTC6::DisableListStreaming - Disables list streaming. DrawLayer loads the complete layer into list 1 before execution. This is the default.
+	*/
+	void CDriver_ScanLab_RTC6::DisableListStreaming()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ScanLab_RTC6_DisableListStreaming(m_pHandle));
+	}
+	
+	/**
+	* CDriver_ScanLab_RTC6::ListStreamingIsEnabled - Returns if list streaming is enabled for DrawLayer.
+	* @return Flag if list streaming is enabled.
+	*/
+	bool CDriver_ScanLab_RTC6::ListStreamingIsEnabled()
+	{
+		bool resultStreamingIsEnabled = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ScanLab_RTC6_ListStreamingIsEnabled(m_pHandle, &resultStreamingIsEnabled));
+		
+		return resultStreamingIsEnabled;
+	}
+	
+	/**
+	* CDriver_ScanLab_RTC6::SetStatusMonitorIntervals - Configures how DrawLayer waits for the end of list execution. A monitor thread polls the card adaptively between the minimum and maximum poll interval, depending on the estimated remaining list execution time. Status parameters are published at the status update interval, and only if their values have changed.
+	* @param[in] nMinPollIntervalInMicroseconds - Poll interval close to the end of the list, in microseconds. Minimum is 50, default is 250.
+	* @param[in] nMaxPollIntervalInMicroseconds - Poll interval far from the end of the list, in microseconds. MUST be at least MinPollIntervalInMicroseconds. Maximum is 1000000, default is 10000.
+	* @param[in] nStatusUpdateIntervalInMilliseconds - Interval of status parameter updates while drawing, in milliseconds. Minimum is 1, maximum is 60000, default is 100.
+	*/
+	void CDriver_ScanLab_RTC6::SetStatusMonitorIntervals(const LibMCDriver_ScanLab_uint32 nMinPollIntervalInMicroseconds, const LibMCDriver_ScanLab_uint32 nMaxPollIntervalInMicroseconds, const LibMCDriver_ScanLab_uint32 nStatusUpdateIntervalInMilliseconds)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ScanLab_RTC6_SetStatusMonitorIntervals(m_pHandle, nMinPollIntervalInMicroseconds, nMaxPollIntervalInMicroseconds, nStatusUpdateIntervalInMilliseconds));
+	}
+	
+	/**
+	* CDriver_ScanLab_RTC6::GetStatusMonitorIntervals - Returns the status monitor intervals of DrawLayer.
+	* @param[out] nMinPollIntervalInMicroseconds - Poll interval close to the end of the list, in microseconds.
+	* @param[out] nMaxPollIntervalInMicroseconds - Poll interval far from the end of the list, in microseconds.
+	* @param[out] nStatusUpdateIntervalInMilliseconds - Interval of status parameter updates while drawing, in milliseconds.
+	*/
+	void CDriver_ScanLab_RTC6::GetStatusMonitorIntervals(LibMCDriver_ScanLab_uint32 & nMinPollIntervalInMicroseconds, LibMCDriver_ScanLab_uint32 & nMaxPollIntervalInMicroseconds, LibMCDriver_ScanLab_uint32 & nStatusUpdateIntervalInMilliseconds)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ScanLab_RTC6_GetStatusMonitorIntervals(m_pHandle, &nMinPollIntervalInMicroseconds, &nMaxPollIntervalInMicroseconds, &nStatusUpdateIntervalInMilliseconds));
+	}
+	
 	/**
 	* CDriver_ScanLab_RTC6::DrawLayer - Draws a layer of a build stream. Blocks until the layer is drawn.
 	* @param[in] sStreamUUID - UUID of the build stream. Must have been loaded in memory by the system.
@@ -8008,6 +8448,39 @@ public:
 		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ScanLab_RTC6xN_DrawLayer(m_pHandle, sStreamUUID.c_str(), nLayerIndex, bFailIfNonAssignedDataExists));
 	}
 	
+	/**
+	* CDriver_ScanLab_RTC6xN::DrawLayerParallel - Draws a layer of a build stream on List 1 of all scanners. Every scanner builds its list in its own worker thread. All scanners are started together as soon as every list is complete. Blocks until the layer is drawn.
+	* @param[in] sStreamUUID - UUID of the build stream. Must have been loaded in memory by the system.
+	* @param[in] nLayerIndex - Layer index of the build file.
+	* @param[in] bFailIfNonAssignedDataExists - If true, the call will fail in case a layer contains data that is not assigned to any defined scanner card.
+	*/
+	void CDriver_ScanLab_RTC6xN::DrawLayerParallel(const std::string & sStreamUUID, const LibMCDriver_ScanLab_uint32 nLayerIndex, const bool bFailIfNonAssignedDataExists)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ScanLab_RTC6xN_DrawLayerParallel(m_pHandle, sStreamUUID.c_str(), nLayerIndex, bFailIfNonAssignedDataExists));
+	}
+	
+	/**
+	* CDriver_ScanLab_RTC6xN::GetLayerDispatchStatistics - Returns the timing of the last call of DrawLayerParallel. Fails if DrawLayerParallel has not been called yet.
+	* @param[out] dLayerLatency - Time in milliseconds from the call until all scanners have finished.
+	* @param[out] dStartSkew - Time in milliseconds between the start of the first and the last scanner.
+	*/
+	void CDriver_ScanLab_RTC6xN::GetLayerDispatchStatistics(LibMCDriver_ScanLab_double & dLayerLatency, LibMCDriver_ScanLab_double & dStartSkew)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ScanLab_RTC6xN_GetLayerDispatchStatistics(m_pHandle, &dLayerLatency, &dStartSkew));
+	}
+	
+	/**
+	* CDriver_ScanLab_RTC6xN::GetScannerDispatchStatistics - Returns the timing of a scanner during the last call of DrawLayerParallel. Fails if DrawLayerParallel has not been called yet.
+	* @param[in] nScannerIndex - Index of the scanner (1-based). MUST be between 1 and ScannerCount
+	* @param[out] dListBuildTime - Time in milliseconds to build the list of the scanner.
+	* @param[out] dStartDelay - Time in milliseconds from the call until the scanner has been started.
+	* @param[out] dExecutionTime - Time in milliseconds from the start until the scanner has finished.
+	*/
+	void CDriver_ScanLab_RTC6xN::GetScannerDispatchStatistics(const LibMCDriver_ScanLab_uint32 nScannerIndex, LibMCDriver_ScanLab_double & dListBuildTime, LibMCDriver_ScanLab_double & dStartDelay, LibMCDriver_ScanLab_double & dExecutionTime)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ScanLab_RTC6xN_GetScannerDispatchStatistics(m_pHandle, nScannerIndex, &dListBuildTime, &dStartDelay, &dExecutionTime));
+	}
+	
 	/**
 	* CDriver_ScanLab_RTC6xN::SetAllCommunicationTimeouts - Set RTC Ethernet communication timeouts for all existing and future connections.
 	* @param[in] dInitialTimeout - Initial timeout in ms
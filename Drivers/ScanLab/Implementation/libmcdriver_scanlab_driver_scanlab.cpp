@@ -137,6 +137,46 @@ void CDriver_ScanLab::LoadCustomSDK(const LibMCDriver_ScanLab_uint64 nScanlabDLL
 
 }
 
+void CDriver_ScanLab::LoadEmulatedSDK(const LibMCDriver_ScanLab_uint32 nSerialNumber)
+{
+    if (m_pScanLabSDK.get() != nullptr)
+        throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_SCANLABSDKALREADYLOADED);
+
+    m_pScanLabSDK = std::make_shared<CScanLabSDK>(nSerialNumber);
+    m_pOwnerData->setScanLabSDK(m_pScanLabSDK);
+
+    if (m_bEnableJournaling) {
+        m_pWorkingDirectory = m_pDriverEnvironment->CreateWorkingDirectory();
+
+        std::string sJournalFileName = "journal.txt";
+        m_pJournalFile = m_pWorkingDirectory->AddManagedFile(sJournalFileName);
+        m_pScanLabSDK->setJournal(std::make_shared<CScanLabSDKJournal>(m_pJournalFile->GetAbsoluteFileName()));
+    }
+
+    m_nDLLVersion = m_pScanLabSDK->get_dll_version();
+
+    updateDLLVersionParameter(m_nDLLVersion);
+
+}
+
+bool CDriver_ScanLab::IsSDKEmulated()
+{
+    if (m_pScanLabSDK.get() == nullptr)
+        return false;
+
+    return m_pScanLabSDK->isEmulated();
+}
+
+void CDriver_ScanLab::SetEmulationTimeFactor(const LibMCDriver_ScanLab_double dTimeFactor)
+{
+    if (!IsSDKEmulated())
+        throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_SDKISNOTEMULATED);
+    if (!(dTimeFactor >= 0.0))
+        throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDEMULATIONTIMEFACTOR);
+
+    m_pScanLabSDK->setEmulationTimeFactor(dTimeFactor);
+}
+
 uint32_t CDriver_ScanLab::getDLLVersion()
 {
     return m_nDLLVersion;
@@ -62,6 +62,10 @@ Abstract: This is the class declaration of CDriver_ScanLab
 #define RTC6_MIN_POLYGON_DELAY 0.0
 #define RTC6_MAX_POLYGON_DELAY 1000000.0f
 
+#define RTC6_MIN_STATUSUPDATEINTERVAL 1
+#define RTC6_MAX_STATUSUPDATEINTERVAL 60000
+#define RTC6_DEFAULT_STATUSUPDATEINTERVAL 100
+
 
 #define SCANLAB_CONFIGURATIONSCHEMA "http://schemas.autodesk.com/amc/scanlab/2023/03"
 #define SCANLAB_MAX_VERSIONVALUE 1024
@@ -115,6 +119,12 @@ public:
 
     void LoadCustomSDK(const LibMCDriver_ScanLab_uint64 nScanlabDLLBufferSize, const LibMCDriver_ScanLab_uint8* pScanlabDLLBuffer) override;
 
+    void LoadEmulatedSDK(const LibMCDriver_ScanLab_uint32 nSerialNumber) override;
+
+    bool IsSDKEmulated() override;
+
+    void SetEmulationTimeFactor(const LibMCDriver_ScanLab_double dTimeFactor) override;
+
     void EnableJournaling() override;
 
     uint32_t getDLLVersion();
@@ -33,6 +33,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "libmcdriver_scanlab_configurationpreset.hpp"
 
 #include <cmath>
+#include <chrono>
 
 // Include custom headers here.
 
@@ -43,7 +44,8 @@ using namespace LibMCDriver_ScanLab::Impl;
 **************************************************************************************************************************/
 
 CDriver_ScanLab_RTC6::CDriver_ScanLab_RTC6(const std::string& sName, const std::string& sType, LibMCEnv::PDriverEnvironment pDriverEnvironment)
-	: CDriver_ScanLab (pDriverEnvironment), m_sName (sName), m_sType (sType), m_SimulationMode (false)    
+	: CDriver_ScanLab (pDriverEnvironment), m_sName (sName), m_sType (sType), m_SimulationMode (false), m_nListStreamingChunkSize (0),
+	m_nMinStatusPollIntervalInMicroseconds (RTCSTATUSMONITOR_DEFAULTMINPOLLINTERVAL), m_nMaxStatusPollIntervalInMicroseconds (RTCSTATUSMONITOR_DEFAULTMAXPOLLINTERVAL), m_nStatusUpdateIntervalInMilliseconds (RTC6_DEFAULT_STATUSUPDATEINTERVAL)
 {
 }
 
@@ -113,6 +115,16 @@ void CDriver_ScanLab_RTC6::Configure(const std::string& sConfigurationString)
     m_pDriverEnvironment->RegisterIntegerParameter("bios_version", "Scanlab BIOS Version", 0);
     m_pDriverEnvironment->RegisterIntegerParameter("encoder_position_x", "Encoder Position X", 0);
     m_pDriverEnvironment->RegisterIntegerParameter("encoder_position_y", "Encoder Position Y", 0);
+    m_pDriverEnvironment->RegisterIntegerParameter("list_streaming_chunks", "Number of list chunks of the last layer", 0);
+    m_pDriverEnvironment->RegisterIntegerParameter("list_streaming_starvations", "Number of times the scanner ran out of list commands in the last layer", 0);
+    m_pDriverEnvironment->RegisterDoubleParameter("layer_first_mark_latency", "Time until list execution started in the last layer (in ms)", 0.0);
+    m_pDriverEnvironment->RegisterDoubleParameter("layer_idle_time", "Time the scanner waited for list commands in the last layer (in ms)", 0.0);
+    m_pDriverEnvironment->RegisterDoubleParameter("layer_load_time", "Time to load the last layer into the lists (in ms)", 0.0);
+    m_pDriverEnvironment->RegisterIntegerParameter("emulation_list_commands", "Number of list commands of the last layer on the emulated card", 0);
+    m_pDriverEnvironment->RegisterDoubleParameter("emulation_commands_per_second", "List commands per second of load time in the last layer on the emulated card", 0.0);
+    m_pDriverEnvironment->RegisterDoubleParameter("emulation_mark_time", "Emulated mark time of the last layer (in ms)", 0.0);
+    m_pDriverEnvironment->RegisterDoubleParameter("emulation_jump_time", "Emulated jump time of the last layer (in ms)", 0.0);
+    m_pDriverEnvironment->RegisterDoubleParameter("emulation_execution_time", "Emulated execution time of the last layer including delays (in ms)", 0.0);
 }
 
 std::string CDriver_ScanLab_RTC6::GetName()
@@ -179,6 +191,7 @@ void CDriver_ScanLab_RTC6::Initialise(const std::string& sIP, const std::string&
             try {
 
                 m_pRTCContext = nullptr;
+                m_PublishedStatusValues.clear();
 
                 m_pRTCSelector = act_managed_ptr<IRTCSelector>(CreateRTCSelector());
 
@@ -467,44 +480,149 @@ void CDriver_ScanLab_RTC6::DrawLayer(const std::string& sStreamUUID, const LibMC
         if ((m_pOwnerData->getMaxLaserPower () < RTC6_MIN_MAXLASERPOWER) || (m_pOwnerData->getMaxLaserPower() > RTC6_MAX_MAXLASERPOWER))
             throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDMAXLASERPOWER);
 
-        m_pRTCContext->SetStartList(1, 0);
+        auto pContextInstance = dynamic_cast<CRTCContext*> (m_pRTCContext.get());
+        if (pContextInstance == nullptr)
+            throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_CARDNOTINITIALIZED);
 
-        auto pToolpathAccessor = m_pDriverEnvironment->CreateToolpathAccessor(sStreamUUID);
+        bool bEmulated = pContextInstance->isEmulated();
+        if (bEmulated)
+            pContextInstance->resetEmulationStatistics();
 
-        if (GetOIERecordingMode() != LibMCDriver_ScanLab::eOIERecordingMode::OIERecordingDisabled) {
-            pToolpathAccessor->RegisterCustomSegmentAttribute("http://schemas.scanlab.com/oie/2023/08", "pidindex", LibMCEnv::eToolpathAttributeType::Integer);
-            pToolpathAccessor->RegisterCustomSegmentAttribute("http://schemas.scanlab.com/oie/2023/08", "measurementid", LibMCEnv::eToolpathAttributeType::Integer);
-        }
+        auto startTime = std::chrono::steady_clock::now();
+        bool bStreaming = (m_nListStreamingChunkSize != 0);
 
-        auto pLayer = pToolpathAccessor->LoadLayer(nLayerIndex);
+        if (bStreaming)
+            pContextInstance->beginListStreaming(m_nListStreamingChunkSize);
+        else
+            m_pRTCContext->SetStartList(1, 0);
 
-        m_pRTCContext->AddLayerToList(pLayer, false);
+        try {
+            auto pToolpathAccessor = m_pDriverEnvironment->CreateToolpathAccessor(sStreamUUID);
 
-        if ((m_pOwnerData->getOIERecordingMode() != eOIERecordingMode::OIERecordingDisabled))
-            m_pRTCContext->StopOIEMeasurement();
+            if (GetOIERecordingMode() != LibMCDriver_ScanLab::eOIERecordingMode::OIERecordingDisabled) {
+                pToolpathAccessor->RegisterCustomSegmentAttribute("http://schemas.scanlab.com/oie/2023/08", "pidindex", LibMCEnv::eToolpathAttributeType::Integer);
+                pToolpathAccessor->RegisterCustomSegmentAttribute("http://schemas.scanlab.com/oie/2023/08", "measurementid", LibMCEnv::eToolpathAttributeType::Integer);
+            }
 
-        m_pRTCContext->SetEndOfList();
+            auto pLayer = pToolpathAccessor->LoadLayer(nLayerIndex);
 
-        m_pRTCContext->ExecuteList(1, 0);
+            m_pRTCContext->AddLayerToList(pLayer, false);
 
-        auto pDriverUpdateInstance = m_pDriverEnvironment->CreateStatusUpdateSession();
+            if ((m_pOwnerData->getOIERecordingMode() != eOIERecordingMode::OIERecordingDisabled))
+                m_pRTCContext->StopOIEMeasurement();
 
-        bool Busy = true;
-        uint32_t Pos = 0;
+            if (bStreaming)
+                pContextInstance->finishListStreaming();
+        }
+        catch (...) {
+            // Do not leave a half streamed layer running on the card.
+            pContextInstance->abortListStreaming();
+            throw;
+        }
+
+        sListStreamingStatistics statistics;
+        if (bStreaming) {
+            statistics = pContextInstance->getListStreamingStatistics();
+        }
+        else {
+            m_pRTCContext->SetEndOfList();
+
+            m_pRTCContext->ExecuteList(1, 0);
 
-        while (Busy) {
-            m_pRTCContext->GetStatus(Busy, Pos);
-            pDriverUpdateInstance->Sleep(10);
+            // Without streaming, the scanner idles for the complete load time of the layer.
+            double dLoadTimeInMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+            statistics.m_nChunkCount = 1;
+            statistics.m_nStarvationCount = 0;
+            statistics.m_dFirstListStartInMilliseconds = dLoadTimeInMilliseconds;
+            statistics.m_dIdleTimeInMilliseconds = dLoadTimeInMilliseconds;
+            statistics.m_dLoadTimeInMilliseconds = dLoadTimeInMilliseconds;
+        }
+
+        auto pDriverUpdateInstance = m_pDriverEnvironment->CreateStatusUpdateSession();
+        updateListStreamingStatistics(pDriverUpdateInstance, statistics);
+
+        // The monitor thread detects the end of the list, status parameters are published in between.
+        auto pStatusMonitor = pContextInstance->createStatusMonitor(m_nMinStatusPollIntervalInMicroseconds, m_nMaxStatusPollIntervalInMicroseconds);
+        pStatusMonitor->startMonitoring(m_pRTCContext->GetInputPointer());
 
+        while (!pStatusMonitor->waitForCompletion(m_nStatusUpdateIntervalInMilliseconds)) {
+            auto cardLock = pStatusMonitor->lockCardAccess();
             updateCardStatus(pDriverUpdateInstance);
         }
 
+        pStatusMonitor->stopMonitoring();
+        updateCardStatus(pDriverUpdateInstance);
+
+        if (bEmulated)
+            updateEmulationStatistics(pDriverUpdateInstance, pContextInstance->getEmulationStatistics(), statistics.m_dLoadTimeInMilliseconds);
+
     }
 }
 
+void CDriver_ScanLab_RTC6::EnableListStreaming(const LibMCDriver_ScanLab_uint32 nChunkSize)
+{
+    if (nChunkSize == 0)
+        throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDLISTSTREAMINGCHUNKSIZE);
+
+    m_nListStreamingChunkSize = nChunkSize;
+}
+
+void CDriver_ScanLab_RTC6::DisableListStreaming()
+{
+    m_nListStreamingChunkSize = 0;
+}
+
+bool CDriver_ScanLab_RTC6::ListStreamingIsEnabled()
+{
+    return (m_nListStreamingChunkSize != 0);
+}
+
+void CDriver_ScanLab_RTC6::SetStatusMonitorIntervals(const LibMCDriver_ScanLab_uint32 nMinPollIntervalInMicroseconds, const LibMCDriver_ScanLab_uint32 nMaxPollIntervalInMicroseconds, const LibMCDriver_ScanLab_uint32 nStatusUpdateIntervalInMilliseconds)
+{
+    if ((nMinPollIntervalInMicroseconds < RTCSTATUSMONITOR_MINPOLLINTERVAL) || (nMaxPollIntervalInMicroseconds > RTCSTATUSMONITOR_MAXPOLLINTERVAL) || (nMinPollIntervalInMicroseconds > nMaxPollIntervalInMicroseconds))
+        throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDSTATUSMONITORINTERVAL, "Invalid status poll interval: " + std::to_string(nMinPollIntervalInMicroseconds) + " - " + std::to_string(nMaxPollIntervalInMicroseconds));
+    if ((nStatusUpdateIntervalInMilliseconds < RTC6_MIN_STATUSUPDATEINTERVAL) || (nStatusUpdateIntervalInMilliseconds > RTC6_MAX_STATUSUPDATEINTERVAL))
+        throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDSTATUSMONITORINTERVAL, "Invalid status update interval: " + std::to_string(nStatusUpdateIntervalInMilliseconds));
+
+    m_nMinStatusPollIntervalInMicroseconds = nMinPollIntervalInMicroseconds;
+    m_nMaxStatusPollIntervalInMicroseconds = nMaxPollIntervalInMicroseconds;
+    m_nStatusUpdateIntervalInMilliseconds = nStatusUpdateIntervalInMilliseconds;
+}
+
+void CDriver_ScanLab_RTC6::GetStatusMonitorIntervals(LibMCDriver_ScanLab_uint32& nMinPollIntervalInMicroseconds, LibMCDriver_ScanLab_uint32& nMaxPollIntervalInMicroseconds, LibMCDriver_ScanLab_uint32& nStatusUpdateIntervalInMilliseconds)
+{
+    nMinPollIntervalInMicroseconds = m_nMinStatusPollIntervalInMicroseconds;
+    nMaxPollIntervalInMicroseconds = m_nMaxStatusPollIntervalInMicroseconds;
+    nStatusUpdateIntervalInMilliseconds = m_nStatusUpdateIntervalInMilliseconds;
+}
+
+void CDriver_ScanLab_RTC6::updateListStreamingStatistics(LibMCEnv::PDriverStatusUpdateSession pDriverUpdateInstance, const sListStreamingStatistics& statistics)
+{
+    if (pDriverUpdateInstance.get() == nullptr)
+        return;
+
+    pDriverUpdateInstance->SetIntegerParameter("list_streaming_chunks", statistics.m_nChunkCount);
+    pDriverUpdateInstance->SetIntegerParameter("list_streaming_starvations", statistics.m_nStarvationCount);
+    pDriverUpdateInstance->SetDoubleParameter("layer_first_mark_latency", statistics.m_dFirstListStartInMilliseconds);
+    pDriverUpdateInstance->SetDoubleParameter("layer_idle_time", statistics.m_dIdleTimeInMilliseconds);
+    pDriverUpdateInstance->SetDoubleParameter("layer_load_time", statistics.m_dLoadTimeInMilliseconds);
+}
 
+void CDriver_ScanLab_RTC6::updateEmulationStatistics(LibMCEnv::PDriverStatusUpdateSession pDriverUpdateInstance, const sScanLabEmulationStatistics& statistics, double dLoadTimeInMilliseconds)
+{
+    if (pDriverUpdateInstance.get() == nullptr)
+        return;
 
+    double dCommandsPerSecond = 0.0;
+    if (dLoadTimeInMilliseconds > 0.0)
+        dCommandsPerSecond = statistics.m_nListCommandCount / (dLoadTimeInMilliseconds / 1000.0);
 
+    pDriverUpdateInstance->SetIntegerParameter("emulation_list_commands", (int64_t)statistics.m_nListCommandCount);
+    pDriverUpdateInstance->SetDoubleParameter("emulation_commands_per_second", dCommandsPerSecond);
+    pDriverUpdateInstance->SetDoubleParameter("emulation_mark_time", statistics.m_dMarkTimeInMicroseconds / 1000.0);
+    pDriverUpdateInstance->SetDoubleParameter("emulation_jump_time", statistics.m_dJumpTimeInMicroseconds / 1000.0);
+    pDriverUpdateInstance->SetDoubleParameter("emulation_execution_time", statistics.m_dExecutionTimeInMicroseconds / 1000.0);
+}
 
 void CDriver_ScanLab_RTC6::updateCardStatus(LibMCEnv::PDriverStatusUpdateSession pDriverUpdateInstance)
 {
@@ -524,15 +642,15 @@ void CDriver_ScanLab_RTC6::updateCardStatus(LibMCEnv::PDriverStatusUpdateSession
         int32_t nAnalogOut1 = m_pRTCContext->GetRTCChannel(eRTCChannelType::ChannelAnalogOut1);
         int32_t nAnalogOut2 = m_pRTCContext->GetRTCChannel(eRTCChannelType::ChannelAnalogOut2);
 
-        pDriverUpdateInstance->SetBoolParameter("position_x_ok", bPositionXisOK);
-        pDriverUpdateInstance->SetBoolParameter("position_y_ok", bPositionYisOK);
-        pDriverUpdateInstance->SetBoolParameter("temperature_ok", bTemperatureisOK);
-        pDriverUpdateInstance->SetBoolParameter("power_ok", bPowerisOK);
-        pDriverUpdateInstance->SetIntegerParameter("analogout1", nAnalogOut1);
-        pDriverUpdateInstance->SetIntegerParameter("analogout2", nAnalogOut2);
+        publishBoolStatus(pDriverUpdateInstance, "position_x_ok", bPositionXisOK);
+        publishBoolStatus(pDriverUpdateInstance, "position_y_ok", bPositionYisOK);
+        publishBoolStatus(pDriverUpdateInstance, "temperature_ok", bTemperatureisOK);
+        publishBoolStatus(pDriverUpdateInstance, "power_ok", bPowerisOK);
+        publishIntegerStatus(pDriverUpdateInstance, "analogout1", nAnalogOut1);
+        publishIntegerStatus(pDriverUpdateInstance, "analogout2", nAnalogOut2);
 
-        pDriverUpdateInstance->SetIntegerParameter("list_position", ListPosition);
-        pDriverUpdateInstance->SetBoolParameter("card_busy", Busy);
+        publishIntegerStatus(pDriverUpdateInstance, "list_position", ListPosition);
+        publishBoolStatus(pDriverUpdateInstance, "card_busy", Busy);
 
         bool bLaserIsOn;
         int32_t nPositionX, nPositionY, nPositionZ;
@@ -543,22 +661,42 @@ void CDriver_ScanLab_RTC6::updateCardStatus(LibMCEnv::PDriverStatusUpdateSession
         m_pRTCContext->GetStateValues(bLaserIsOn, nPositionX, nPositionY, nPositionZ, nCorrectedPositionX, nCorrectedPositionY, nCorrectedPositionZ, nFocusShift, nMarkSpeed);
         m_pRTCContext->Get2DMarkOnTheFlyPosition(nEncoderPositionX, nEncoderPositionY);
 
-        pDriverUpdateInstance->SetBoolParameter("laser_on", bLaserIsOn);
-        pDriverUpdateInstance->SetIntegerParameter("position_x", nPositionX);
-        pDriverUpdateInstance->SetIntegerParameter("position_y", nPositionY);
-        pDriverUpdateInstance->SetIntegerParameter("position_z", nPositionZ);
-        pDriverUpdateInstance->SetIntegerParameter("position_x_corrected", nCorrectedPositionX);
-        pDriverUpdateInstance->SetIntegerParameter("position_y_corrected", nCorrectedPositionY);
-        pDriverUpdateInstance->SetIntegerParameter("position_z_corrected", nCorrectedPositionZ);
-        pDriverUpdateInstance->SetIntegerParameter("focus_shift", nFocusShift);
-        pDriverUpdateInstance->SetIntegerParameter("mark_speed", nMarkSpeed);
-        pDriverUpdateInstance->SetIntegerParameter("encoder_position_x", nEncoderPositionX);
-        pDriverUpdateInstance->SetIntegerParameter("encoder_position_y", nEncoderPositionY);
+        publishBoolStatus(pDriverUpdateInstance, "laser_on", bLaserIsOn);
+        publishIntegerStatus(pDriverUpdateInstance, "position_x", nPositionX);
+        publishIntegerStatus(pDriverUpdateInstance, "position_y", nPositionY);
+        publishIntegerStatus(pDriverUpdateInstance, "position_z", nPositionZ);
+        publishIntegerStatus(pDriverUpdateInstance, "position_x_corrected", nCorrectedPositionX);
+        publishIntegerStatus(pDriverUpdateInstance, "position_y_corrected", nCorrectedPositionY);
+        publishIntegerStatus(pDriverUpdateInstance, "position_z_corrected", nCorrectedPositionZ);
+        publishIntegerStatus(pDriverUpdateInstance, "focus_shift", nFocusShift);
+        publishIntegerStatus(pDriverUpdateInstance, "mark_speed", nMarkSpeed);
+        publishIntegerStatus(pDriverUpdateInstance, "encoder_position_x", nEncoderPositionX);
+        publishIntegerStatus(pDriverUpdateInstance, "encoder_position_y", nEncoderPositionY);
 
     }
 
 }
 
+void CDriver_ScanLab_RTC6::publishIntegerStatus(LibMCEnv::PDriverStatusUpdateSession pDriverUpdateInstance, const std::string& sParameterName, int64_t nValue)
+{
+    auto iIter = m_PublishedStatusValues.find(sParameterName);
+    if ((iIter != m_PublishedStatusValues.end()) && (iIter->second == nValue))
+        return;
+
+    pDriverUpdateInstance->SetIntegerParameter(sParameterName, nValue);
+    m_PublishedStatusValues[sParameterName] = nValue;
+}
+
+void CDriver_ScanLab_RTC6::publishBoolStatus(LibMCEnv::PDriverStatusUpdateSession pDriverUpdateInstance, const std::string& sParameterName, bool bValue)
+{
+    auto iIter = m_PublishedStatusValues.find(sParameterName);
+    if ((iIter != m_PublishedStatusValues.end()) && (iIter->second == (int64_t)bValue))
+        return;
+
+    pDriverUpdateInstance->SetBoolParameter(sParameterName, bValue);
+    m_PublishedStatusValues[sParameterName] = (int64_t)bValue;
+}
+
 void CDriver_ScanLab_RTC6::SetCommunicationTimeouts(const LibMCDriver_ScanLab_double dInitialTimeout, const LibMCDriver_ScanLab_double dMaxTimeout, const LibMCDriver_ScanLab_double dMultiplier)
 {
     m_dDefaultInitialTimeout = dInitialTimeout;
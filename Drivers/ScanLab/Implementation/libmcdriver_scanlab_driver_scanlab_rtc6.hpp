@@ -45,6 +45,17 @@ private:
 
 	bool m_SimulationMode;
 
+	// Chunk size of DrawLayer list streaming. 0 if streaming is disabled.
+	uint32_t m_nListStreamingChunkSize;
+
+	// Status monitoring of DrawLayer
+	uint32_t m_nMinStatusPollIntervalInMicroseconds;
+	uint32_t m_nMaxStatusPollIntervalInMicroseconds;
+	uint32_t m_nStatusUpdateIntervalInMilliseconds;
+
+	// Last published card status values, so that only changes are written.
+	std::map<std::string, int64_t> m_PublishedStatusValues;
+
 
 	act_managed_ptr<IRTCSelector> m_pRTCSelector;
 	act_managed_ptr<IRTCContext> m_pRTCContext;
@@ -55,6 +66,14 @@ private:
 
 	void updateCardStatus(LibMCEnv::PDriverStatusUpdateSession pDriverUpdateInstance);
 
+	void publishIntegerStatus(LibMCEnv::PDriverStatusUpdateSession pDriverUpdateInstance, const std::string& sParameterName, int64_t nValue);
+
+	void publishBoolStatus(LibMCEnv::PDriverStatusUpdateSession pDriverUpdateInstance, const std::string& sParameterName, bool bValue);
+
+	void updateListStreamingStatistics(LibMCEnv::PDriverStatusUpdateSession pDriverUpdateInstance, const sListStreamingStatistics& statistics);
+
+	void updateEmulationStatistics(LibMCEnv::PDriverStatusUpdateSession pDriverUpdateInstance, const sScanLabEmulationStatistics& statistics, double dLoadTimeInMilliseconds);
+
 
 protected:
 
@@ -114,6 +133,16 @@ public:
 
 	void DisableAttributeFilter() override;
 
+	void EnableListStreaming(const LibMCDriver_ScanLab_uint32 nChunkSize) override;
+
+	void DisableListStreaming() override;
+
+	bool ListStreamingIsEnabled() override;
+
+	void SetStatusMonitorIntervals(const LibMCDriver_ScanLab_uint32 nMinPollIntervalInMicroseconds, const LibMCDriver_ScanLab_uint32 nMaxPollIntervalInMicroseconds, const LibMCDriver_ScanLab_uint32 nStatusUpdateIntervalInMilliseconds) override;
+
+	void GetStatusMonitorIntervals(LibMCDriver_ScanLab_uint32& nMinPollIntervalInMicroseconds, LibMCDriver_ScanLab_uint32& nMaxPollIntervalInMicroseconds, LibMCDriver_ScanLab_uint32& nStatusUpdateIntervalInMilliseconds) override;
+
 	void DrawLayer(const std::string& sStreamUUID, const LibMCDriver_ScanLab_uint32 nLayerIndex) override;
 
 	void SetCommunicationTimeouts(const LibMCDriver_ScanLab_double dInitialTimeout, const LibMCDriver_ScanLab_double dMaxTimeout, const LibMCDriver_ScanLab_double dMultiplier) override;
@@ -47,7 +47,8 @@ using namespace LibMCDriver_ScanLab::Impl;
 **************************************************************************************************************************/
 
 CDriver_ScanLab_RTC6xN::CDriver_ScanLab_RTC6xN(const std::string& sName, const std::string& sType, uint32_t nScannerCount, LibMCEnv::PDriverEnvironment pDriverEnvironment)
-	: CDriver_ScanLab(pDriverEnvironment), m_sName(sName), m_sType(sType), m_nScannerCount (nScannerCount), m_SimulationMode (false)
+	: CDriver_ScanLab(pDriverEnvironment), m_sName(sName), m_sType(sType), m_nScannerCount (nScannerCount), m_SimulationMode (false),
+	m_bHasLayerDispatchStatistics (false), m_dLayerDispatchLatencyInMilliseconds (0.0), m_dLayerDispatchStartSkewInMilliseconds (0.0)
 
 {
 	if ((nScannerCount < RTC6_MINLASERCOUNT) || (nScannerCount > RTC6_MAXLASERCOUNT))
@@ -228,10 +229,14 @@ void CDriver_ScanLab_RTC6xN::InitialiseScanner(const LibMCDriver_ScanLab_uint32
 			auto pContextInstance = dynamic_cast<CRTCContext*> (pContext);
 			if (pContextInstance != nullptr)
 				pContextInstance->setIPAddress(sIP, sNetmask);
-
-			pContextInstance->setLaserIndex(nLaserIndex);
 		}
 
+		// Local cards need the laser index as well, DrawLayer assigns the toolpath segments by it.
+		auto pContextInstance = dynamic_cast<CRTCContext*> (pRTCContext.get());
+		if (pContextInstance == nullptr)
+			throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDCAST);
+		pContextInstance->setLaserIndex(nLaserIndex);
+
 		uint32_t nRTCVersion = 0;
 		uint32_t nRTCType = 0;
 		uint32_t nDLLVersion = 0;
@@ -507,6 +512,76 @@ void CDriver_ScanLab_RTC6xN::DrawLayer(const std::string & sStreamUUID, const Li
 	}
 }
 
+void CDriver_ScanLab_RTC6xN::DrawLayerParallel(const std::string& sStreamUUID, const LibMCDriver_ScanLab_uint32 nLayerIndex, const bool bFailIfNonAssignedDataExists)
+{
+	if (!m_SimulationMode) {
+
+		m_bHasLayerDispatchStatistics = false;
+		m_ScannerDispatchStatistics.clear();
+
+		auto pToolpathAccessor = m_pDriverEnvironment->CreateToolpathAccessor(sStreamUUID);
+		if (GetOIERecordingMode() != LibMCDriver_ScanLab::eOIERecordingMode::OIERecordingDisabled) {
+			pToolpathAccessor->RegisterCustomSegmentAttribute("http://schemas.scanlab.com/oie/2023/08", "pidindex", LibMCEnv::eToolpathAttributeType::Integer);
+			pToolpathAccessor->RegisterCustomSegmentAttribute("http://schemas.scanlab.com/oie/2023/08", "measurementtag", LibMCEnv::eToolpathAttributeType::Integer);
+		}
+
+		if ((m_pOwnerData->getMaxLaserPower() < RTC6_MIN_MAXLASERPOWER) || (m_pOwnerData->getMaxLaserPower() > RTC6_MAX_MAXLASERPOWER))
+			throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDMAXLASERPOWER);
+
+		// The layer is only read while the lists are built, so all cards share one instance.
+		// Its wrapper is created and released in this thread.
+		auto pLayer = pToolpathAccessor->LoadLayer(nLayerIndex);
+
+		CRTCLayerDispatcher layerDispatcher;
+		for (uint32_t nScannerIndex = 1; nScannerIndex <= m_nScannerCount; nScannerIndex++) {
+			auto pRTCContext = getRTCContextForScannerIndex(nScannerIndex, true);
+			layerDispatcher.addCard(pRTCContext, pLayer);
+		}
+
+		layerDispatcher.buildAndStartLists(bFailIfNonAssignedDataExists);
+
+		// Execution is monitored from the calling thread only.
+		auto pDriverUpdateInstance = m_pDriverEnvironment->CreateStatusUpdateSession();
+
+		while (layerDispatcher.updateExecutionStatus()) {
+			pDriverUpdateInstance->Sleep(10);
+
+			updateCardStatus(pDriverUpdateInstance);
+		}
+
+		for (uint32_t nCardIndex = 0; nCardIndex < layerDispatcher.getCardCount(); nCardIndex++)
+			m_ScannerDispatchStatistics.push_back(layerDispatcher.getCardStatistics(nCardIndex));
+
+		m_dLayerDispatchLatencyInMilliseconds = layerDispatcher.getLayerLatencyInMilliseconds();
+		m_dLayerDispatchStartSkewInMilliseconds = layerDispatcher.getStartSkewInMilliseconds();
+		m_bHasLayerDispatchStatistics = true;
+
+	}
+}
+
+void CDriver_ScanLab_RTC6xN::GetLayerDispatchStatistics(LibMCDriver_ScanLab_double& dLayerLatency, LibMCDriver_ScanLab_double& dStartSkew)
+{
+	if (!m_bHasLayerDispatchStatistics)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_NOLAYERDISPATCHSTATISTICS);
+
+	dLayerLatency = m_dLayerDispatchLatencyInMilliseconds;
+	dStartSkew = m_dLayerDispatchStartSkewInMilliseconds;
+}
+
+void CDriver_ScanLab_RTC6xN::GetScannerDispatchStatistics(const LibMCDriver_ScanLab_uint32 nScannerIndex, LibMCDriver_ScanLab_double& dListBuildTime, LibMCDriver_ScanLab_double& dStartDelay, LibMCDriver_ScanLab_double& dExecutionTime)
+{
+	if ((nScannerIndex < 1) || (nScannerIndex > m_nScannerCount))
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDSCANNERINDEX);
+
+	if (!m_bHasLayerDispatchStatistics)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_NOLAYERDISPATCHSTATISTICS);
+
+	auto& statistics = m_ScannerDispatchStatistics.at(nScannerIndex - 1);
+	dListBuildTime = statistics.m_dListBuildTimeInMilliseconds;
+	dStartDelay = statistics.m_dStartDelayInMilliseconds;
+	dExecutionTime = statistics.m_dExecutionTimeInMilliseconds;
+}
+
 void CDriver_ScanLab_RTC6xN::SetAllCommunicationTimeouts(const LibMCDriver_ScanLab_double dInitialTimeout, const LibMCDriver_ScanLab_double dMaxTimeout, const LibMCDriver_ScanLab_double dMultiplier)
 {
 	for (uint32_t nScannerIndex = 1; nScannerIndex <= m_nScannerCount; nScannerIndex++) {
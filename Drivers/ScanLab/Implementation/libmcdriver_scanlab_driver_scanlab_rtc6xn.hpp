@@ -49,6 +49,7 @@ Abstract: This is the class declaration of CDriver_ScanLab_RTC6xN
 #include "libmcdriver_scanlab_rtccontext.hpp"
 #include "libmcdriver_scanlab_rtcselector.hpp"
 #include "libmcdriver_scanlab_configurationpreset.hpp"
+#include "libmcdriver_scanlab_rtclayerdispatcher.hpp"
 
 
 namespace LibMCDriver_ScanLab {
@@ -76,6 +77,11 @@ private:
 
 	std::map<std::string, PDriver_ScanLab_RTC6ConfigurationPreset> m_ConfigurationPresets;
 
+	bool m_bHasLayerDispatchStatistics;
+	double m_dLayerDispatchLatencyInMilliseconds;
+	double m_dLayerDispatchStartSkewInMilliseconds;
+	std::vector<sRTCLayerDispatchStatistics> m_ScannerDispatchStatistics;
+
 	void updateCardStatus(LibMCEnv::PDriverStatusUpdateSession pDriverUpdateInstance);
 
 	act_managed_ptr<IRTCContext> getRTCContextForScannerIndex(uint32_t nScannerIndex, bool bFailIfNotExisting);
@@ -149,6 +155,12 @@ public:
 
 	void DrawLayer(const std::string & sStreamUUID, const LibMCDriver_ScanLab_uint32 nLayerIndex, const bool bFailIfNonAssignedDataExists) override;
 
+	void DrawLayerParallel(const std::string & sStreamUUID, const LibMCDriver_ScanLab_uint32 nLayerIndex, const bool bFailIfNonAssignedDataExists) override;
+
+	void GetLayerDispatchStatistics(LibMCDriver_ScanLab_double & dLayerLatency, LibMCDriver_ScanLab_double & dStartSkew) override;
+
+	void GetScannerDispatchStatistics(const LibMCDriver_ScanLab_uint32 nScannerIndex, LibMCDriver_ScanLab_double & dListBuildTime, LibMCDriver_ScanLab_double & dStartDelay, LibMCDriver_ScanLab_double & dExecutionTime) override;
+
 	void SetAllCommunicationTimeouts(const LibMCDriver_ScanLab_double dInitialTimeout, const LibMCDriver_ScanLab_double dMaxTimeout, const LibMCDriver_ScanLab_double dMultiplier) override;
 
 	void SetCommunicationTimeouts(const LibMCDriver_ScanLab_uint32 nScannerIndex, const LibMCDriver_ScanLab_double dInitialTimeout, const LibMCDriver_ScanLab_double dMaxTimeout, const LibMCDriver_ScanLab_double dMultiplier) override;
@@ -0,0 +1,868 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class definition of CRTCCommandStreamCompiler and CRTCCompiledLayer
+
+*/
+
+#include "libmcdriver_scanlab_rtccommandstream.hpp"
+#include "libmcdriver_scanlab_interfaceexception.hpp"
+#include "common_parallelblocks.hpp"
+
+#include <thread>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <algorithm>
+
+using namespace LibMCDriver_ScanLab;
+using namespace LibMCDriver_ScanLab::Impl;
+
+#define RTCCOMMANDSTREAM_HASHSEED 0xcbf29ce484222325ULL
+#define RTCCOMMANDSTREAM_HASHMULTIPLIER 0x9e3779b97f4a7c15ULL
+
+namespace {
+
+	uint64_t hashBytes(uint64_t nHash, const void* pData, size_t nSize)
+	{
+		const uint8_t* pBytes = (const uint8_t*)pData;
+		size_t nWordCount = nSize / sizeof(uint64_t);
+		for (size_t nIndex = 0; nIndex < nWordCount; nIndex++) {
+			uint64_t nWord;
+			memcpy(&nWord, pBytes + nIndex * sizeof(uint64_t), sizeof(uint64_t));
+			nHash = (nHash ^ nWord) * RTCCOMMANDSTREAM_HASHMULTIPLIER;
+			nHash ^= (nHash >> 32);
+		}
+
+		for (size_t nIndex = nWordCount * sizeof(uint64_t); nIndex < nSize; nIndex++) {
+			nHash = (nHash ^ pBytes[nIndex]) * RTCCOMMANDSTREAM_HASHMULTIPLIER;
+			nHash ^= (nHash >> 32);
+		}
+
+		return nHash;
+	}
+
+	template <typename T> uint64_t hashValue(uint64_t nHash, const T value)
+	{
+		return hashBytes(nHash, &value, sizeof(T));
+	}
+
+	template <typename T> uint64_t hashVector(uint64_t nHash, const std::vector<T>& values)
+	{
+		nHash = hashValue<uint64_t>(nHash, values.size());
+		if (values.empty())
+			return nHash;
+		return hashBytes(nHash, values.data(), values.size() * sizeof(T));
+	}
+
+	bool configurationsAreEqual(const sRTCCommandStreamConfiguration& configuration1, const sRTCCommandStreamConfiguration& configuration2)
+	{
+		return (configuration1.m_dCorrectionFactor == configuration2.m_dCorrectionFactor) &&
+			(configuration1.m_dZCorrectionFactor == configuration2.m_dZCorrectionFactor) &&
+			(configuration1.m_dLaserOriginX == configuration2.m_dLaserOriginX) &&
+			(configuration1.m_dLaserOriginY == configuration2.m_dLaserOriginY) &&
+			(configuration1.m_bEnableLineSubdivision == configuration2.m_bEnableLineSubdivision) &&
+			(configuration1.m_dLineSubdivisionThreshold == configuration2.m_dLineSubdivisionThreshold) &&
+			(configuration1.m_dLineSubdivisionMinLength == configuration2.m_dLineSubdivisionMinLength) &&
+			(configuration1.m_LaserPort == configuration2.m_LaserPort) &&
+			(configuration1.m_bEnableOIEPIDControl == configuration2.m_bEnableOIEPIDControl) &&
+			(configuration1.m_bMeasurementTagging == configuration2.m_bMeasurementTagging) &&
+			(configuration1.m_bAFXSelectionEnabled == configuration2.m_bAFXSelectionEnabled) &&
+			(configuration1.m_nMaxAFXMode == configuration2.m_nMaxAFXMode) &&
+			(configuration1.m_nLaserIndex == configuration2.m_nLaserIndex) &&
+			(configuration1.m_bFailIfNonAssignedDataExists == configuration2.m_bFailIfNonAssignedDataExists) &&
+			(configuration1.m_nAttributeFilterID == configuration2.m_nAttributeFilterID) &&
+			(configuration1.m_nAttributeFilterValue == configuration2.m_nAttributeFilterValue) &&
+			(configuration1.m_fMaxLaserPowerInWatts == configuration2.m_fMaxLaserPowerInWatts);
+	}
+
+	// Resolved settings only, the command ranges depend on the thread count.
+	bool segmentsAreEqual(const sRTCCompiledSegment& segment1, const sRTCCompiledSegment& segment2)
+	{
+		return (segment1.m_nSegmentID == segment2.m_nSegmentID) &&
+			(segment1.m_nProfileID == segment2.m_nProfileID) &&
+			(segment1.m_nPartID == segment2.m_nPartID) &&
+			(segment1.m_bIsActive == segment2.m_bIsActive) &&
+			(segment1.m_bIsDrawn == segment2.m_bIsDrawn) &&
+			(segment1.m_nAFXMode == segment2.m_nAFXMode) &&
+			(segment1.m_nSkywritingIndex == segment2.m_nSkywritingIndex) &&
+			(segment1.m_nPreSequenceIndex == segment2.m_nPreSequenceIndex) &&
+			(segment1.m_nPostSequenceIndex == segment2.m_nPostSequenceIndex);
+	}
+
+	// Plain structs without padding are compared bytewise, so that NaN values match as well.
+	template <typename T> bool vectorsAreEqual(const std::vector<T>& values1, const std::vector<T>& values2)
+	{
+		if (values1.size() != values2.size())
+			return false;
+		if (values1.empty())
+			return true;
+		return (memcmp(values1.data(), values2.data(), values1.size() * sizeof(T)) == 0);
+	}
+
+	class CSegmentCommandWriter {
+	private:
+		const sRTCCommandStreamConfiguration& m_Configuration;
+		std::vector<sRTCCompiledCommand>& m_Commands;
+
+		bool m_bPositionIsKnown;
+		int32_t m_nCurrentX;
+		int32_t m_nCurrentY;
+
+		void addCommand(eRTCCompiledCommandType commandType, int32_t nParameter1, int32_t nParameter2)
+		{
+			m_Commands.push_back({ commandType, nParameter1, nParameter2 });
+		}
+
+		// Same rounding as CRTCContext::jumpAbsoluteEx and CRTCContext::markAbsoluteEx
+		int32_t toBitsX(double dXInMM)
+		{
+			return (int32_t)round((dXInMM - m_Configuration.m_dLaserOriginX) * m_Configuration.m_dCorrectionFactor);
+		}
+
+		int32_t toBitsY(double dYInMM)
+		{
+			return (int32_t)round((dYInMM - m_Configuration.m_dLaserOriginY) * m_Configuration.m_dCorrectionFactor);
+		}
+
+	public:
+
+		CSegmentCommandWriter(const sRTCCommandStreamConfiguration& configuration, std::vector<sRTCCompiledCommand>& commands)
+			: m_Configuration(configuration), m_Commands(commands), m_bPositionIsKnown(false), m_nCurrentX(0), m_nCurrentY(0)
+		{
+		}
+
+		void writeSpeeds(float fMarkSpeedInMMPerSecond, float fJumpSpeedInMMPerSecond)
+		{
+			m_Commands.push_back(CRTCCompiledLayer::makeValueCommand(eRTCCompiledCommandType::SetMarkSpeed, ((double)fMarkSpeedInMMPerSecond / 1000.0) * m_Configuration.m_dCorrectionFactor));
+			addCommand(eRTCCompiledCommandType::CheckLastError, 0, 0);
+			m_Commands.push_back(CRTCCompiledLayer::makeValueCommand(eRTCCompiledCommandType::SetJumpSpeed, ((double)fJumpSpeedInMMPerSecond / 1000.0) * m_Configuration.m_dCorrectionFactor));
+			addCommand(eRTCCompiledCommandType::CheckLastError, 0, 0);
+		}
+
+		// Mirrors CRTCContext::writePower
+		void writePower(double dPowerInPercent, bool bOIEPIDControlFlag)
+		{
+			double dClippedPowerFactor = dPowerInPercent / 100.0f;
+			if (dClippedPowerFactor > 1.0f)
+				dClippedPowerFactor = 1.0f;
+			if (dClippedPowerFactor < 0.0f)
+				dClippedPowerFactor = 0.0f;
+
+			int32_t nDigitalValue8Bit = (int32_t)round(dClippedPowerFactor * 255.0);
+			int32_t nDigitalValue12Bit = (int32_t)round(dClippedPowerFactor * 4095.0);
+			int32_t nDigitalValue16Bit = (int32_t)round(dClippedPowerFactor * 65535.0);
+
+			if (bOIEPIDControlFlag) {
+
+				switch (m_Configuration.m_LaserPort) {
+				case eLaserPort::Port16bitDigital:
+					addCommand(eRTCCompiledCommandType::SetLaserPowerMCBSP, 6, nDigitalValue16Bit);
+					break;
+				case eLaserPort::Port8bitDigital:
+					addCommand(eRTCCompiledCommandType::SetLaserPowerMCBSP, 3, nDigitalValue8Bit);
+					break;
+				case eLaserPort::Port12BitAnalog1:
+					addCommand(eRTCCompiledCommandType::SetLaserPowerMCBSP, 1, nDigitalValue12Bit);
+					break;
+				case eLaserPort::Port12BitAnalog2:
+					addCommand(eRTCCompiledCommandType::SetLaserPowerMCBSP, 2, nDigitalValue12Bit);
+					break;
+				case eLaserPort::Port12BitAnalog1andAnalog2:
+					throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_MULTIPLELASERPORTSNOTCOMPATIBLEWITHPID);
+				}
+
+				addCommand(eRTCCompiledCommandType::CheckLastError, 0, 0);
+				addCommand(eRTCCompiledCommandType::FlyReturnPulse, 0, 0);
+				addCommand(eRTCCompiledCommandType::CheckLastError, 0, 0);
+
+			}
+			else {
+
+				switch (m_Configuration.m_LaserPort) {
+				case eLaserPort::Port16bitDigital:
+					addCommand(eRTCCompiledCommandType::SetLaserPower, 3, nDigitalValue16Bit);
+					break;
+				case eLaserPort::Port8bitDigital:
+					addCommand(eRTCCompiledCommandType::SetLaserPower, 2, nDigitalValue8Bit);
+					break;
+				case eLaserPort::Port12BitAnalog1:
+					addCommand(eRTCCompiledCommandType::SetLaserPower, 0, nDigitalValue12Bit);
+					break;
+				case eLaserPort::Port12BitAnalog2:
+					addCommand(eRTCCompiledCommandType::SetLaserPower, 1, nDigitalValue12Bit);
+					break;
+				case eLaserPort::Port12BitAnalog1andAnalog2:
+					addCommand(eRTCCompiledCommandType::SetLaserPower, 0, nDigitalValue12Bit);
+					addCommand(eRTCCompiledCommandType::SetLaserPower, 1, nDigitalValue12Bit);
+					break;
+				}
+
+				addCommand(eRTCCompiledCommandType::CheckLastError, 0, 0);
+			}
+		}
+
+		void writeDefocus(float fZValue)
+		{
+			addCommand(eRTCCompiledCommandType::SetDefocus, (int32_t)round(fZValue * m_Configuration.m_dZCorrectionFactor), 0);
+		}
+
+		void writeOIEPIDMode(uint32_t nOIEPIDControlIndex)
+		{
+			addCommand(eRTCCompiledCommandType::SetOIEPIDMode, (int32_t)nOIEPIDControlIndex, 0);
+		}
+
+		void writeMeasurementTag(uint32_t nVectorID)
+		{
+			if (m_Configuration.m_bMeasurementTagging)
+				addCommand(eRTCCompiledCommandType::MeasurementTag, (int32_t)nVectorID, 0);
+		}
+
+		void writeJump(double dTargetXInMM, double dTargetYInMM)
+		{
+			int32_t nTargetX = toBitsX(dTargetXInMM);
+			int32_t nTargetY = toBitsY(dTargetYInMM);
+
+			// Null jumps after a mark of the same segment can be left out already here.
+			// All other jumps are checked against the scanner position at replay.
+			if (m_bPositionIsKnown && (nTargetX == m_nCurrentX) && (nTargetY == m_nCurrentY))
+				return;
+
+			addCommand(eRTCCompiledCommandType::JumpAbsolute, nTargetX, nTargetY);
+			m_bPositionIsKnown = true;
+			m_nCurrentX = nTargetX;
+			m_nCurrentY = nTargetY;
+		}
+
+		// Mirrors the line subdivision of CRTCContext::markAbsoluteEx
+		void writeMark(double dStartXInMM, double dStartYInMM, double dTargetXInMM, double dTargetYInMM)
+		{
+			int32_t nSubdivisionCount = 1;
+			double dDeltaX = dTargetXInMM - dStartXInMM;
+			double dDeltaY = dTargetYInMM - dStartYInMM;
+
+			if (m_Configuration.m_bEnableLineSubdivision) {
+				double dLen = sqrt(dDeltaX * dDeltaX + dDeltaY * dDeltaY);
+				if (dLen > m_Configuration.m_dLineSubdivisionMinLength) {
+					nSubdivisionCount = (int32_t)ceil(dLen / m_Configuration.m_dLineSubdivisionThreshold);
+					dDeltaX /= nSubdivisionCount;
+					dDeltaY /= nSubdivisionCount;
+				}
+			}
+
+			for (int32_t nSubdivisionIndex = 1; nSubdivisionIndex <= nSubdivisionCount; nSubdivisionIndex++) {
+				m_nCurrentX = toBitsX(dStartXInMM + nSubdivisionIndex * dDeltaX);
+				m_nCurrentY = toBitsY(dStartYInMM + nSubdivisionIndex * dDeltaY);
+				addCommand(eRTCCompiledCommandType::MarkAbsolute, m_nCurrentX, m_nCurrentY);
+			}
+
+			m_bPositionIsKnown = true;
+		}
+
+	};
+
+	// Writes the same command sequence as CRTCContext::DrawPolylineOIE and CRTCContext::DrawHatchesOIE
+	void compileSegments(const sRTCCommandStreamConfiguration& configuration, double dUnits, const std::vector<uint32_t>& segmentTypes, const std::vector<uint32_t>& pointOffsets, const std::vector<LibMCEnv::sPosition2D>& points, 
+		const std::vector<sRTCCompiledDrawParameters>& drawParameters, std::vector<sRTCCompiledSegment>& segments, uint32_t nStartSegment, uint32_t nEndSegment, uint32_t nCommandBlock, std::vector<sRTCCompiledCommand>& commands)
+	{
+		for (uint32_t nSegmentIndex = nStartSegment; nSegmentIndex < nEndSegment; nSegmentIndex++) {
+			auto& segment = segments[nSegmentIndex];
+			segment.m_nCommandBlock = nCommandBlock;
+			segment.m_nFirstCommand = commands.size();
+
+			if (segment.m_bIsActive && segment.m_bIsDrawn) {
+				auto& parameters = drawParameters[nSegmentIndex];
+				bool bOIEControlFlag = (parameters.m_nOIEPIDControlIndex != 0);
+
+				uint32_t nPointOffset = pointOffsets[nSegmentIndex];
+				uint32_t nPointCount = pointOffsets[nSegmentIndex + 1] - nPointOffset;
+				const LibMCEnv::sPosition2D* pSegmentPoints = &points[nPointOffset];
+
+				// The scanner position is only known after the first jump of a segment
+				CSegmentCommandWriter segmentWriter(configuration, commands);
+
+				segmentWriter.writeSpeeds(parameters.m_fMarkSpeedInMMPerSecond, parameters.m_fJumpSpeedInMMPerSecond);
+				segmentWriter.writePower(parameters.m_fPowerInPercent, bOIEControlFlag);
+				segmentWriter.writeDefocus(parameters.m_fLaserFocus);
+
+				switch ((LibMCEnv::eToolpathSegmentType)segmentTypes[nSegmentIndex]) {
+				case LibMCEnv::eToolpathSegmentType::Loop:
+				case LibMCEnv::eToolpathSegmentType::Polyline:
+				{
+					double dPrevX = (float)(pSegmentPoints[0].m_Coordinates[0] * dUnits);
+					double dPrevY = (float)(pSegmentPoints[0].m_Coordinates[1] * dUnits);
+					segmentWriter.writeJump(dPrevX, dPrevY);
+
+					if (bOIEControlFlag)
+						segmentWriter.writeOIEPIDMode(parameters.m_nOIEPIDControlIndex);
+
+					for (uint32_t nPointIndex = 1; nPointIndex < nPointCount; nPointIndex++) {
+						double dX = (float)(pSegmentPoints[nPointIndex].m_Coordinates[0] * dUnits);
+						double dY = (float)(pSegmentPoints[nPointIndex].m_Coordinates[1] * dUnits);
+
+						segmentWriter.writeMeasurementTag(nPointIndex);
+						segmentWriter.writeMark(dPrevX, dPrevY, dX, dY);
+
+						dPrevX = dX;
+						dPrevY = dY;
+					}
+					break;
+				}
+
+				case LibMCEnv::eToolpathSegmentType::Hatch:
+				{
+					if (bOIEControlFlag)
+						segmentWriter.writeOIEPIDMode(parameters.m_nOIEPIDControlIndex);
+
+					uint32_t nHatchCount = nPointCount / 2;
+					for (uint32_t nHatchIndex = 0; nHatchIndex < nHatchCount; nHatchIndex++) {
+						double dX1 = (float)(pSegmentPoints[nHatchIndex * 2].m_Coordinates[0] * dUnits);
+						double dY1 = (float)(pSegmentPoints[nHatchIndex * 2].m_Coordinates[1] * dUnits);
+						double dX2 = (float)(pSegmentPoints[nHatchIndex * 2 + 1].m_Coordinates[0] * dUnits);
+						double dY2 = (float)(pSegmentPoints[nHatchIndex * 2 + 1].m_Coordinates[1] * dUnits);
+
+						segmentWriter.writeJump(dX1, dY1);
+						segmentWriter.writeMeasurementTag(nHatchIndex);
+						segmentWriter.writeMark(dX1, dY1, dX2, dY2);
+					}
+					break;
+				}
+
+				default:
+					break;
+				}
+			}
+
+			segment.m_nCommandCount = commands.size() - segment.m_nFirstCommand;
+		}
+	}
+
+}
+
+/*************************************************************************************************************************
+ Class definition of CRTCCompiledLayer 
+**************************************************************************************************************************/
+
+CRTCCompiledLayer::CRTCCompiledLayer()
+	: m_nContentHash (0), m_nPointCount (0), m_dUnits (0.0)
+{
+	memset(&m_Configuration, 0, sizeof(m_Configuration));
+
+	// Index 0 of the lookup tables means "none"
+	m_SkywritingTable.push_back({ 0, 0.0, 0, 0, 0, 0.0 });
+	m_GPIOSequenceNames.push_back("");
+}
+
+CRTCCompiledLayer::~CRTCCompiledLayer()
+{
+
+}
+
+const std::vector<sRTCCompiledSegment>& CRTCCompiledLayer::getSegments()
+{
+	return m_Segments;
+}
+
+const sRTCCompiledCommand* CRTCCompiledLayer::getSegmentCommands(const sRTCCompiledSegment& segment)
+{
+	if (segment.m_nCommandBlock >= m_CommandBlocks.size())
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	auto& commands = m_CommandBlocks[segment.m_nCommandBlock];
+	if ((segment.m_nCommandCount == 0) || (segment.m_nFirstCommand + segment.m_nCommandCount > commands.size()))
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	return &commands[segment.m_nFirstCommand];
+}
+
+const sRTCCompiledSkywriting& CRTCCompiledLayer::getSkywriting(uint32_t nSkywritingIndex)
+{
+	if (nSkywritingIndex >= m_SkywritingTable.size())
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	return m_SkywritingTable[nSkywritingIndex];
+}
+
+const std::string& CRTCCompiledLayer::getGPIOSequenceName(uint32_t nSequenceIndex)
+{
+	if (nSequenceIndex >= m_GPIOSequenceNames.size())
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	return m_GPIOSequenceNames[nSequenceIndex];
+}
+
+uint64_t CRTCCompiledLayer::getContentHash()
+{
+	return m_nContentHash;
+}
+
+uint64_t CRTCCompiledLayer::getCommandCount()
+{
+	uint64_t nCommandCount = 0;
+	for (auto& commands : m_CommandBlocks)
+		nCommandCount += commands.size();
+	return nCommandCount;
+}
+
+bool CRTCCompiledLayer::hasSameInput(const CRTCCompiledLayer& otherLayer) const
+{
+	if (!configurationsAreEqual(m_Configuration, otherLayer.m_Configuration))
+		return false;
+
+	if ((m_dUnits != otherLayer.m_dUnits) || (m_nPointCount != otherLayer.m_nPointCount))
+		return false;
+
+	if (!(vectorsAreEqual(m_SegmentTypes, otherLayer.m_SegmentTypes) && vectorsAreEqual(m_PointOffsets, otherLayer.m_PointOffsets) &&
+		vectorsAreEqual(m_Points, otherLayer.m_Points) && vectorsAreEqual(m_DrawParameters, otherLayer.m_DrawParameters)))
+		return false;
+
+	if ((m_Segments.size() != otherLayer.m_Segments.size()) || (m_SkywritingTable.size() != otherLayer.m_SkywritingTable.size()) || (m_GPIOSequenceNames != otherLayer.m_GPIOSequenceNames))
+		return false;
+
+	for (size_t nSegmentIndex = 0; nSegmentIndex < m_Segments.size(); nSegmentIndex++) {
+		if (!segmentsAreEqual(m_Segments[nSegmentIndex], otherLayer.m_Segments[nSegmentIndex]))
+			return false;
+	}
+
+	for (size_t nSkywritingIndex = 0; nSkywritingIndex < m_SkywritingTable.size(); nSkywritingIndex++) {
+		auto& skywriting1 = m_SkywritingTable[nSkywritingIndex];
+		auto& skywriting2 = otherLayer.m_SkywritingTable[nSkywritingIndex];
+		if ((skywriting1.m_nMode != skywriting2.m_nMode) || (skywriting1.m_dTimeLag != skywriting2.m_dTimeLag) || (skywriting1.m_nLaserOnShift != skywriting2.m_nLaserOnShift) ||
+			(skywriting1.m_nPrev != skywriting2.m_nPrev) || (skywriting1.m_nPost != skywriting2.m_nPost) || (skywriting1.m_dLimit != skywriting2.m_dLimit))
+			return false;
+	}
+
+	return true;
+}
+
+void CRTCCompiledLayer::releaseInput()
+{
+	std::vector<uint32_t>().swap(m_SegmentTypes);
+	std::vector<uint32_t>().swap(m_PointOffsets);
+	std::vector<LibMCEnv::sPosition2D>().swap(m_Points);
+	std::vector<sRTCCompiledDrawParameters>().swap(m_DrawParameters);
+}
+
+double CRTCCompiledLayer::getCommandValue(const sRTCCompiledCommand& command)
+{
+	uint64_t nBits = (uint64_t)(uint32_t)command.m_nParameter1 | ((uint64_t)(uint32_t)command.m_nParameter2 << 32);
+	double dValue;
+	memcpy(&dValue, &nBits, sizeof(double));
+	return dValue;
+}
+
+sRTCCompiledCommand CRTCCompiledLayer::makeValueCommand(eRTCCompiledCommandType commandType, double dValue)
+{
+	uint64_t nBits;
+	memcpy(&nBits, &dValue, sizeof(double));
+	return { commandType, (int32_t)(uint32_t)(nBits & 0xffffffffULL), (int32_t)(uint32_t)(nBits >> 32) };
+}
+
+/*************************************************************************************************************************
+ Class definition of CRTCCommandStreamCompiler 
+**************************************************************************************************************************/
+
+CRTCCommandStreamCompiler::CRTCCommandStreamCompiler(uint32_t nThreadCount, uint32_t nMaxCachedLayers)
+	: m_nThreadCount (nThreadCount), m_nMaxCachedLayers (nMaxCachedLayers)
+{
+	if (m_nThreadCount == 0) {
+		m_nThreadCount = std::thread::hardware_concurrency();
+		if (m_nThreadCount == 0)
+			m_nThreadCount = 1;
+	}
+
+	if ((m_nThreadCount > RTCCOMMANDSTREAM_MAXTHREADCOUNT) || (m_nMaxCachedLayers > RTCCOMMANDSTREAM_MAXCACHEDLAYERS))
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDCOMMANDSTREAMCONFIGURATION);
+
+	m_Statistics.m_nCompiledLayerCount = 0;
+	m_Statistics.m_nCacheHitCount = 0;
+	m_Statistics.m_nCachedLayerCount = 0;
+	m_Statistics.m_nLastCommandCount = 0;
+	m_Statistics.m_dLastCompileTimeInMilliseconds = 0.0;
+}
+
+CRTCCommandStreamCompiler::~CRTCCommandStreamCompiler()
+{
+
+}
+
+uint64_t CRTCCommandStreamCompiler::hashConfiguration(const sRTCCommandStreamConfiguration& configuration)
+{
+	uint64_t nHash = RTCCOMMANDSTREAM_HASHSEED;
+	nHash = hashValue(nHash, configuration.m_dCorrectionFactor);
+	nHash = hashValue(nHash, configuration.m_dZCorrectionFactor);
+	nHash = hashValue(nHash, configuration.m_dLaserOriginX);
+	nHash = hashValue(nHash, configuration.m_dLaserOriginY);
+	nHash = hashValue<uint32_t>(nHash, configuration.m_bEnableLineSubdivision ? 1 : 0);
+	nHash = hashValue(nHash, configuration.m_dLineSubdivisionThreshold);
+	nHash = hashValue(nHash, configuration.m_dLineSubdivisionMinLength);
+	nHash = hashValue<int32_t>(nHash, (int32_t)configuration.m_LaserPort);
+	nHash = hashValue<uint32_t>(nHash, configuration.m_bEnableOIEPIDControl ? 1 : 0);
+	nHash = hashValue<uint32_t>(nHash, configuration.m_bMeasurementTagging ? 1 : 0);
+	nHash = hashValue<uint32_t>(nHash, configuration.m_bAFXSelectionEnabled ? 1 : 0);
+	nHash = hashValue(nHash, configuration.m_nMaxAFXMode);
+	nHash = hashValue(nHash, configuration.m_nLaserIndex);
+	nHash = hashValue<uint32_t>(nHash, configuration.m_bFailIfNonAssignedDataExists ? 1 : 0);
+	nHash = hashValue(nHash, configuration.m_nAttributeFilterID);
+	nHash = hashValue(nHash, configuration.m_nAttributeFilterValue);
+	nHash = hashValue(nHash, configuration.m_fMaxLaserPowerInWatts);
+	return nHash;
+}
+
+PRTCCompiledLayer CRTCCommandStreamCompiler::compileLayer(LibMCEnv::PToolpathLayer pLayer, const sRTCCommandStreamConfiguration& configuration)
+{
+	if (pLayer.get() == nullptr)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	auto startTime = std::chrono::steady_clock::now();
+
+	double dUnits = pLayer->GetUnits();
+
+	// Same export as CRTCContext::addLayerSegmentsToListEx
+	double dNaN = std::numeric_limits<double>::quiet_NaN();
+	std::vector<LibMCEnv::sToolpathProfileValueColumn> ProfileColumns;
+	auto addProfileColumn = [&ProfileColumns](LibMCEnv::eToolpathProfileValueType eValueType, uint32_t nValueID, double dDefaultValue) -> uint32_t {
+		LibMCEnv::sToolpathProfileValueColumn column;
+		column.m_ValueType = (uint32_t)eValueType;
+		column.m_ValueID = nValueID;
+		column.m_DefaultValue = dDefaultValue;
+		ProfileColumns.push_back(column);
+		return (uint32_t)(ProfileColumns.size() - 1);
+	};
+	auto addCustomProfileColumn = [&](const std::string& sNameSpace, const std::string& sValueName, double dDefaultValue) -> uint32_t {
+		return addProfileColumn(LibMCEnv::eToolpathProfileValueType::Custom, pLayer->FindProfileValueID(sNameSpace, sValueName), dDefaultValue);
+	};
+
+	uint32_t nMeasurementIDColumn = addCustomProfileColumn("http://schemas.scanlab.com/oie/2023/08", "measurementid", 0.0);
+	uint32_t nAFXModeColumn = addCustomProfileColumn("http://schemas.nlight.com/afx/2024/09", "afxmode", 0.0);
+	uint32_t nJumpSpeedColumn = addProfileColumn(LibMCEnv::eToolpathProfileValueType::JumpSpeed, 0, dNaN);
+	uint32_t nMarkSpeedColumn = addProfileColumn(LibMCEnv::eToolpathProfileValueType::Speed, 0, dNaN);
+	uint32_t nLaserPowerColumn = addProfileColumn(LibMCEnv::eToolpathProfileValueType::LaserPower, 0, dNaN);
+	uint32_t nLaserFocusColumn = addProfileColumn(LibMCEnv::eToolpathProfileValueType::LaserFocus, 0, dNaN);
+	uint32_t nPIDIndexColumn = addCustomProfileColumn("http://schemas.scanlab.com/oie/2023/08", "pidindex", 0.0);
+	uint32_t nLaserIndexColumn = addCustomProfileColumn("", "laserindex", 0.0);
+	uint32_t nSkywritingModeColumn = addCustomProfileColumn("http://schemas.scanlab.com/skywriting/2023/01", "mode", 0.0);
+	uint32_t nColumnCount = (uint32_t)ProfileColumns.size();
+
+	std::vector<uint32_t> SegmentTypes;
+	std::vector<uint32_t> PointOffsets;
+	std::vector<uint32_t> LocalPartIDs;
+	std::vector<uint32_t> ProfileIDs;
+	pLayer->ExportSegmentTable(SegmentTypes, PointOffsets, LocalPartIDs, ProfileIDs);
+
+	std::vector<double> ProfileValues;
+	pLayer->ExportProfileValueColumns(ProfileColumns, ProfileValues);
+
+	uint32_t nAttributeFilterID = configuration.m_nAttributeFilterID;
+	std::vector<int64_t> FilterAttributeValues;
+	if (nAttributeFilterID != 0)
+		pLayer->ExportSegmentIntegerAttributes(LibMCEnv::CInputVector<uint32_t>(&nAttributeFilterID, 1), FilterAttributeValues);
+
+	std::vector<LibMCEnv::sPosition2D> Points;
+	pLayer->ExportPointData(Points);
+
+	uint32_t nSegmentCount = (uint32_t)SegmentTypes.size();
+	if ((PointOffsets.size() != (size_t)nSegmentCount + 1) || (ProfileValues.size() != (size_t)nSegmentCount * nColumnCount) || (PointOffsets.at(nSegmentCount) != Points.size()))
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPOINTCOUNT);
+
+	auto getIntegerProfileValue = [&](uint32_t nSegmentIndex, uint32_t nColumn, const std::string& sNameSpace, const std::string& sValueName) -> int64_t {
+		double dValue = ProfileValues[(size_t)nSegmentIndex * nColumnCount + nColumn];
+		if ((!std::isnan(dValue)) && (abs(dValue - round(dValue)) < 0.001))
+			return (int64_t)round(dValue);
+		return pLayer->GetSegmentProfileIntegerValueDef(nSegmentIndex, sNameSpace, sValueName, 0);
+	};
+
+	auto getTypedProfileValue = [&](uint32_t nSegmentIndex, uint32_t nColumn, LibMCEnv::eToolpathProfileValueType eValueType) -> double {
+		double dValue = ProfileValues[(size_t)nSegmentIndex * nColumnCount + nColumn];
+		if (!std::isnan(dValue))
+			return dValue;
+		return pLayer->GetSegmentProfileTypedValue(nSegmentIndex, eValueType);
+	};
+
+	auto pCompiledLayer = std::make_shared<CRTCCompiledLayer>();
+	pCompiledLayer->m_nPointCount = Points.size();
+	pCompiledLayer->m_Segments.resize(nSegmentCount);
+
+	// GPIO sequences and skywriting parameters are resolved once per profile.
+	std::map<uint32_t, uint32_t> PreSequenceCache;
+	std::map<uint32_t, uint32_t> PostSequenceCache;
+	std::map<std::string, uint32_t> SequenceNameIndices;
+	auto getGPIOSequenceIndex = [&](uint32_t nSegmentIndex, std::map<uint32_t, uint32_t>& sequenceCache, const std::string& sValueName) -> uint32_t {
+		uint32_t nProfileID = ProfileIDs[nSegmentIndex];
+		auto iIter = sequenceCache.find(nProfileID);
+		if (iIter != sequenceCache.end())
+			return iIter->second;
+
+		uint32_t nSequenceIndex = 0;
+		auto sSequence = pLayer->GetSegmentProfileValueDef(nSegmentIndex, "http://schemas.scanlab.com/gpiosequence/2025/01", sValueName, "");
+		if (!sSequence.empty()) {
+			auto iNameIter = SequenceNameIndices.find(sSequence);
+			if (iNameIter != SequenceNameIndices.end()) {
+				nSequenceIndex = iNameIter->second;
+			}
+			else {
+				nSequenceIndex = (uint32_t)pCompiledLayer->m_GPIOSequenceNames.size();
+				pCompiledLayer->m_GPIOSequenceNames.push_back(sSequence);
+				SequenceNameIndices.insert(std::make_pair(sSequence, nSequenceIndex));
+			}
+		}
+
+		sequenceCache.insert(std::make_pair(nProfileID, nSequenceIndex));
+		return nSequenceIndex;
+	};
+
+	std::map<uint32_t, uint32_t> SkywritingCache;
+	auto getSkywritingIndex = [&](uint32_t nSegmentIndex, int64_t nSkywritingMode) -> uint32_t {
+		uint32_t nProfileID = ProfileIDs[nSegmentIndex];
+		auto iIter = SkywritingCache.find(nProfileID);
+		if (iIter != SkywritingCache.end())
+			return iIter->second;
+
+		sRTCCompiledSkywriting skywriting;
+		skywriting.m_nMode = nSkywritingMode;
+		skywriting.m_dTimeLag = pLayer->GetSegmentProfileDoubleValue(nSegmentIndex, "http://schemas.scanlab.com/skywriting/2023/01", "timelag");
+		skywriting.m_nLaserOnShift = pLayer->GetSegmentProfileIntegerValue(nSegmentIndex, "http://schemas.scanlab.com/skywriting/2023/01", "laseronshift");
+		skywriting.m_nPrev = pLayer->GetSegmentProfileIntegerValue(nSegmentIndex, "http://schemas.scanlab.com/skywriting/2023/01", "nprev");
+		skywriting.m_nPost = pLayer->GetSegmentProfileIntegerValue(nSegmentIndex, "http://schemas.scanlab.com/skywriting/2023/01", "npost");
+		skywriting.m_dLimit = 0.0;
+		if ((nSkywritingMode == 3) || (nSkywritingMode == 4))
+			skywriting.m_dLimit = pLayer->GetSegmentProfileDoubleValue(nSegmentIndex, "http://schemas.scanlab.com/skywriting/2023/01", "limit");
+
+		uint32_t nSkywritingIndex = (uint32_t)pCompiledLayer->m_SkywritingTable.size();
+		pCompiledLayer->m_SkywritingTable.push_back(skywriting);
+		SkywritingCache.insert(std::make_pair(nProfileID, nSkywritingIndex));
+		return nSkywritingIndex;
+	};
+
+	// Resolve all segment settings, with the same checks as the per segment loop of the RTC Context.
+	std::vector<sRTCCompiledDrawParameters> DrawParameters;
+	DrawParameters.resize(nSegmentCount);
+
+	for (uint32_t nSegmentIndex = 0; nSegmentIndex < nSegmentCount; nSegmentIndex++) {
+		auto& segment = pCompiledLayer->m_Segments[nSegmentIndex];
+		auto& parameters = DrawParameters[nSegmentIndex];
+
+		segment.m_nSegmentID = nSegmentIndex + 1;
+		segment.m_nProfileID = (uint32_t)getIntegerProfileValue(nSegmentIndex, nMeasurementIDColumn, "http://schemas.scanlab.com/oie/2023/08", "measurementid");
+		segment.m_nPartID = LocalPartIDs[nSegmentIndex];
+		segment.m_bIsActive = false;
+		segment.m_bIsDrawn = false;
+		segment.m_nAFXMode = -1;
+		segment.m_nSkywritingIndex = 0;
+		segment.m_nPreSequenceIndex = 0;
+		segment.m_nCommandBlock = 0;
+		segment.m_nFirstCommand = 0;
+		segment.m_nCommandCount = 0;
+		parameters = { 0.0f, 0.0f, 0.0f, 0.0f, 0 };
+
+		uint32_t nPointCount = PointOffsets[nSegmentIndex + 1] - PointOffsets[nSegmentIndex];
+
+		bool bDrawSegment = true;
+		if (nAttributeFilterID != 0)
+			bDrawSegment = (FilterAttributeValues[nSegmentIndex] == configuration.m_nAttributeFilterValue);
+
+		if (bDrawSegment && (nPointCount >= 2)) {
+			segment.m_bIsActive = true;
+			segment.m_nPreSequenceIndex = getGPIOSequenceIndex(nSegmentIndex, PreSequenceCache, "presequence");
+
+			if (configuration.m_bAFXSelectionEnabled) {
+				int64_t nLightAFXMode = getIntegerProfileValue(nSegmentIndex, nAFXModeColumn, "http://schemas.nlight.com/afx/2024/09", "afxmode");
+				if ((nLightAFXMode < 0) || (nLightAFXMode > (int64_t)configuration.m_nMaxAFXMode))
+					throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDNLIGHTAFXMODE, "Invalid nLightAFXMode: " + std::to_string(nLightAFXMode));
+				segment.m_nAFXMode = nLightAFXMode;
+			}
+
+			parameters.m_fJumpSpeedInMMPerSecond = (float)getTypedProfileValue(nSegmentIndex, nJumpSpeedColumn, LibMCEnv::eToolpathProfileValueType::JumpSpeed);
+			parameters.m_fMarkSpeedInMMPerSecond = (float)getTypedProfileValue(nSegmentIndex, nMarkSpeedColumn, LibMCEnv::eToolpathProfileValueType::Speed);
+			float fPowerInWatts = (float)getTypedProfileValue(nSegmentIndex, nLaserPowerColumn, LibMCEnv::eToolpathProfileValueType::LaserPower);
+			parameters.m_fPowerInPercent = (fPowerInWatts * 100.f) / configuration.m_fMaxLaserPowerInWatts;
+			parameters.m_fLaserFocus = (float)getTypedProfileValue(nSegmentIndex, nLaserFocusColumn, LibMCEnv::eToolpathProfileValueType::LaserFocus);
+
+			if (configuration.m_bEnableOIEPIDControl)
+				parameters.m_nOIEPIDControlIndex = (uint32_t)getIntegerProfileValue(nSegmentIndex, nPIDIndexColumn, "http://schemas.scanlab.com/oie/2023/08", "pidindex");
+
+			double dLaserIndexOfSegment = ProfileValues[(size_t)nSegmentIndex * nColumnCount + nLaserIndexColumn];
+			if (std::isnan(dLaserIndexOfSegment))
+				dLaserIndexOfSegment = pLayer->GetSegmentProfileDoubleValueDef(nSegmentIndex, "", "laserindex", 0);
+			int64_t nLaserIndexOfSegment = (int64_t)round(dLaserIndexOfSegment);
+			if (abs(dLaserIndexOfSegment - double(nLaserIndexOfSegment)) > 0.001)
+				throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_SEGMENTHASINVALIDLASERINDEX, "Segment has invalid laser index: " + std::to_string(dLaserIndexOfSegment));
+
+			if ((nLaserIndexOfSegment == 0) && configuration.m_bFailIfNonAssignedDataExists)
+				throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_LASERINDEXHASNOASSIGNEDSCANNER, "Laser index has no assigned scanner: " + std::to_string(nLaserIndexOfSegment));
+
+			if (nLaserIndexOfSegment == configuration.m_nLaserIndex) {
+				segment.m_bIsDrawn = true;
+
+				int64_t nSkywritingMode = getIntegerProfileValue(nSegmentIndex, nSkywritingModeColumn, "http://schemas.scanlab.com/skywriting/2023/01", "mode");
+				if (nSkywritingMode != 0)
+					segment.m_nSkywritingIndex = getSkywritingIndex(nSegmentIndex, nSkywritingMode);
+
+				if (((LibMCEnv::eToolpathSegmentType)SegmentTypes[nSegmentIndex] == LibMCEnv::eToolpathSegmentType::Hatch) && (nPointCount % 2 == 1))
+					throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPOINTCOUNT);
+
+				if ((parameters.m_nOIEPIDControlIndex != 0) && (configuration.m_LaserPort == eLaserPort::Port12BitAnalog1andAnalog2))
+					throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_MULTIPLELASERPORTSNOTCOMPATIBLEWITHPID);
+			}
+		}
+
+		segment.m_nPostSequenceIndex = getGPIOSequenceIndex(nSegmentIndex, PostSequenceCache, "postsequence");
+	}
+
+	// The content hash covers everything that goes into the list commands.
+	uint64_t nContentHash = RTCCOMMANDSTREAM_HASHSEED;
+	nContentHash = hashValue(nContentHash, dUnits);
+	nContentHash = hashVector(nContentHash, SegmentTypes);
+	nContentHash = hashVector(nContentHash, PointOffsets);
+	nContentHash = hashVector(nContentHash, Points);
+	for (uint32_t nSegmentIndex = 0; nSegmentIndex < nSegmentCount; nSegmentIndex++) {
+		auto& segment = pCompiledLayer->m_Segments[nSegmentIndex];
+		auto& parameters = DrawParameters[nSegmentIndex];
+		nContentHash = hashValue(nContentHash, segment.m_nProfileID);
+		nContentHash = hashValue(nContentHash, segment.m_nPartID);
+		nContentHash = hashValue<uint32_t>(nContentHash, (segment.m_bIsActive ? 1 : 0) | (segment.m_bIsDrawn ? 2 : 0));
+		nContentHash = hashValue(nContentHash, segment.m_nAFXMode);
+		nContentHash = hashValue(nContentHash, segment.m_nSkywritingIndex);
+		nContentHash = hashValue(nContentHash, segment.m_nPreSequenceIndex);
+		nContentHash = hashValue(nContentHash, segment.m_nPostSequenceIndex);
+		nContentHash = hashValue(nContentHash, parameters.m_fMarkSpeedInMMPerSecond);
+		nContentHash = hashValue(nContentHash, parameters.m_fJumpSpeedInMMPerSecond);
+		nContentHash = hashValue(nContentHash, parameters.m_fPowerInPercent);
+		nContentHash = hashValue(nContentHash, parameters.m_fLaserFocus);
+		nContentHash = hashValue(nContentHash, parameters.m_nOIEPIDControlIndex);
+	}
+	for (auto& skywriting : pCompiledLayer->m_SkywritingTable) {
+		nContentHash = hashValue(nContentHash, skywriting.m_nMode);
+		nContentHash = hashValue(nContentHash, skywriting.m_dTimeLag);
+		nContentHash = hashValue(nContentHash, skywriting.m_nLaserOnShift);
+		nContentHash = hashValue(nContentHash, skywriting.m_nPrev);
+		nContentHash = hashValue(nContentHash, skywriting.m_nPost);
+		nContentHash = hashValue(nContentHash, skywriting.m_dLimit);
+	}
+	for (auto& sSequenceName : pCompiledLayer->m_GPIOSequenceNames)
+		nContentHash = hashBytes(hashValue<uint64_t>(nContentHash, sSequenceName.length()), sSequenceName.c_str(), sSequenceName.length());
+
+	pCompiledLayer->m_nContentHash = nContentHash;
+	pCompiledLayer->m_Configuration = configuration;
+	pCompiledLayer->m_dUnits = dUnits;
+	pCompiledLayer->m_SegmentTypes = std::move(SegmentTypes);
+	pCompiledLayer->m_PointOffsets = std::move(PointOffsets);
+	pCompiledLayer->m_Points = std::move(Points);
+	pCompiledLayer->m_DrawParameters = std::move(DrawParameters);
+
+	auto cacheKey = std::make_pair(nContentHash, hashConfiguration(configuration));
+	if (m_nMaxCachedLayers > 0) {
+		auto iIter = m_Cache.find(cacheKey);
+		if (iIter != m_Cache.end()) {
+			auto pCachedLayer = iIter->second;
+			// A hash collision must not replay another layer. On a mismatch the cached layer is replaced below.
+			if (pCachedLayer->hasSameInput(*pCompiledLayer)) {
+				m_CacheOrder.remove(cacheKey);
+				m_CacheOrder.push_back(cacheKey);
+
+				m_Statistics.m_nCacheHitCount++;
+				m_Statistics.m_nLastCommandCount = pCachedLayer->getCommandCount();
+				m_Statistics.m_dLastCompileTimeInMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+				return pCachedLayer;
+			}
+		}
+	}
+
+	// Split the segments into ranges of about the same point count. Every block writes its own command buffer.
+	auto& SegmentPointOffsets = pCompiledLayer->m_PointOffsets;
+	uint64_t nPointCount = pCompiledLayer->m_nPointCount;
+	uint32_t nRangeCount = AMCCommon::CParallelBlocks::getBlockCount(m_nThreadCount, nPointCount, RTCCOMMANDSTREAM_MINPOINTSPERTHREAD);
+
+	std::vector<uint32_t> RangeStarts;
+	RangeStarts.push_back(0);
+	for (uint32_t nRangeIndex = 1; nRangeIndex < nRangeCount; nRangeIndex++) {
+		uint64_t nTargetPointOffset = (nPointCount * nRangeIndex) / nRangeCount;
+		auto iSplit = std::lower_bound(SegmentPointOffsets.begin() + RangeStarts.back(), SegmentPointOffsets.end() - 1, (uint32_t)nTargetPointOffset);
+		RangeStarts.push_back((uint32_t)(iSplit - SegmentPointOffsets.begin()));
+	}
+	RangeStarts.push_back(nSegmentCount);
+
+	pCompiledLayer->m_CommandBlocks.resize(nRangeCount);
+
+	AMCCommon::CParallelBlocks::processBlocks(nRangeCount, nRangeCount, 1, [&](uint32_t nBlockIndex, size_t nFirstRange, size_t nBlockRangeCount) {
+		for (size_t nRangeIndex = nFirstRange; nRangeIndex < nFirstRange + nBlockRangeCount; nRangeIndex++) {
+			auto& commands = pCompiledLayer->m_CommandBlocks[nRangeIndex];
+			commands.reserve((size_t)(SegmentPointOffsets[RangeStarts[nRangeIndex + 1]] - SegmentPointOffsets[RangeStarts[nRangeIndex]]) * 2);
+			compileSegments(configuration, dUnits, pCompiledLayer->m_SegmentTypes, SegmentPointOffsets, pCompiledLayer->m_Points, pCompiledLayer->m_DrawParameters, pCompiledLayer->m_Segments, 
+				RangeStarts[nRangeIndex], RangeStarts[nRangeIndex + 1], (uint32_t)nRangeIndex, commands);
+		}
+	});
+
+	uint64_t nCommandCount = pCompiledLayer->getCommandCount();
+
+	if (m_nMaxCachedLayers > 0) {
+		if (m_Cache.find(cacheKey) != m_Cache.end())
+			m_CacheOrder.remove(cacheKey);
+		m_Cache[cacheKey] = pCompiledLayer;
+		m_CacheOrder.push_back(cacheKey);
+
+		while (m_Cache.size() > m_nMaxCachedLayers) {
+			m_Cache.erase(m_CacheOrder.front());
+			m_CacheOrder.pop_front();
+		}
+	}
+	else {
+		pCompiledLayer->releaseInput();
+	}
+
+	m_Statistics.m_nCompiledLayerCount++;
+	m_Statistics.m_nCachedLayerCount = (uint32_t)m_Cache.size();
+	m_Statistics.m_nLastCommandCount = nCommandCount;
+	m_Statistics.m_dLastCompileTimeInMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+	return pCompiledLayer;
+}
+
+void CRTCCommandStreamCompiler::clearCache()
+{
+	m_Cache.clear();
+	m_CacheOrder.clear();
+	m_Statistics.m_nCachedLayerCount = 0;
+}
+
+uint32_t CRTCCommandStreamCompiler::getThreadCount()
+{
+	return m_nThreadCount;
+}
+
+uint32_t CRTCCommandStreamCompiler::getMaxCachedLayers()
+{
+	return m_nMaxCachedLayers;
+}
+
+sRTCCommandStreamStatistics CRTCCommandStreamCompiler::getStatistics()
+{
+	return m_Statistics;
+}
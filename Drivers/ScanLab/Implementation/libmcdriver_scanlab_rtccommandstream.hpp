@@ -0,0 +1,243 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class declaration of CRTCCommandStreamCompiler and CRTCCompiledLayer
+
+*/
+
+
+#ifndef __LIBMCDRIVER_SCANLAB_RTCCOMMANDSTREAM
+#define __LIBMCDRIVER_SCANLAB_RTCCOMMANDSTREAM
+
+#include "libmcdriver_scanlab_interfaces.hpp"
+
+#include <vector>
+#include <map>
+#include <list>
+#include <string>
+#include <memory>
+
+#define RTCCOMMANDSTREAM_MAXTHREADCOUNT 64
+#define RTCCOMMANDSTREAM_MINPOINTSPERTHREAD 16384
+#define RTCCOMMANDSTREAM_DEFAULTMAXCACHEDLAYERS 16
+#define RTCCOMMANDSTREAM_MAXCACHEDLAYERS 4096
+
+namespace LibMCDriver_ScanLab {
+namespace Impl {
+
+// List commands of a compiled layer. Coordinates and port values are already in RTC bits.
+enum class eRTCCompiledCommandType : uint32_t {
+	JumpAbsolute = 1,		// m_nParameter1/2: target in bits, skipped at replay if the scanner is already there
+	MarkAbsolute = 2,		// m_nParameter1/2: target in bits
+	SetMarkSpeed = 3,		// Speed in bits per ms, see CRTCCompiledLayer::getCommandValue
+	SetJumpSpeed = 4,		// Speed in bits per ms, see CRTCCompiledLayer::getCommandValue
+	SetLaserPower = 5,		// m_nParameter1: port index of n_set_laser_power, m_nParameter2: digital value
+	SetLaserPowerMCBSP = 6,	// m_nParameter1: port index of n_set_multi_mcbsp_in_list, m_nParameter2: digital value
+	FlyReturnPulse = 7,		// Applies an OIE PID power value, see CRTCContext::writePower
+	SetDefocus = 8,			// m_nParameter1: defocus in bits
+	SetOIEPIDMode = 9,		// m_nParameter1: PID index
+	MeasurementTag = 10,	// m_nParameter1: vector index within the segment
+	CheckLastError = 11
+};
+
+typedef struct _sRTCCompiledCommand {
+	eRTCCompiledCommandType m_Type;
+	int32_t m_nParameter1;
+	int32_t m_nParameter2;
+} sRTCCompiledCommand;
+
+typedef struct _sRTCCompiledSkywriting {
+	int64_t m_nMode;
+	double m_dTimeLag;
+	int64_t m_nLaserOnShift;
+	int64_t m_nPrev;
+	int64_t m_nPost;
+	double m_dLimit;
+} sRTCCompiledSkywriting;
+
+// Everything that addLayerToListEx resolves per segment from the toolpath profiles.
+typedef struct _sRTCCompiledSegment {
+	uint32_t m_nSegmentID;
+	uint32_t m_nProfileID;
+	uint32_t m_nPartID;
+	// Segment passes the attribute filter and has at least two points
+	bool m_bIsActive;
+	// Segment is drawn by this scanner
+	bool m_bIsDrawn;
+	// -1 if AFX mode selection is disabled
+	int64_t m_nAFXMode;
+	// Index into the skywriting table, 0 if the profile does not set a skywriting mode
+	uint32_t m_nSkywritingIndex;
+	// Indices into the GPIO sequence name table, 0 for none
+	uint32_t m_nPreSequenceIndex;
+	uint32_t m_nPostSequenceIndex;
+	// Commands of the segment, one block is written by each compile thread
+	uint32_t m_nCommandBlock;
+	uint64_t m_nFirstCommand;
+	uint64_t m_nCommandCount;
+} sRTCCompiledSegment;
+
+// Values of a drawn segment that go into the list commands
+typedef struct _sRTCCompiledDrawParameters {
+	float m_fMarkSpeedInMMPerSecond;
+	float m_fJumpSpeedInMMPerSecond;
+	float m_fPowerInPercent;
+	float m_fLaserFocus;
+	uint32_t m_nOIEPIDControlIndex;
+} sRTCCompiledDrawParameters;
+
+// State of the RTC Context that the compiled commands depend on.
+typedef struct _sRTCCommandStreamConfiguration {
+	double m_dCorrectionFactor;
+	double m_dZCorrectionFactor;
+	double m_dLaserOriginX;
+	double m_dLaserOriginY;
+	bool m_bEnableLineSubdivision;
+	double m_dLineSubdivisionThreshold;
+	double m_dLineSubdivisionMinLength;
+	eLaserPort m_LaserPort;
+	bool m_bEnableOIEPIDControl;
+	bool m_bMeasurementTagging;
+	bool m_bAFXSelectionEnabled;
+	uint32_t m_nMaxAFXMode;
+	int64_t m_nLaserIndex;
+	bool m_bFailIfNonAssignedDataExists;
+	uint32_t m_nAttributeFilterID;
+	int64_t m_nAttributeFilterValue;
+	float m_fMaxLaserPowerInWatts;
+} sRTCCommandStreamConfiguration;
+
+typedef struct _sRTCCommandStreamStatistics {
+	uint32_t m_nCompiledLayerCount;
+	uint32_t m_nCacheHitCount;
+	uint32_t m_nCachedLayerCount;
+	uint64_t m_nLastCommandCount;
+	double m_dLastCompileTimeInMilliseconds;
+} sRTCCommandStreamStatistics;
+
+/*************************************************************************************************************************
+ Class declaration of CRTCCompiledLayer 
+**************************************************************************************************************************/
+
+// Flat list command records of a toolpath layer for one scanner, with the per segment settings that are applied
+// through the RTC Context during replay (GPIO sequences, AFX mode, skywriting, measurement tag info).
+class CRTCCompiledLayer {
+private:
+
+	std::vector<std::vector<sRTCCompiledCommand>> m_CommandBlocks;
+	std::vector<sRTCCompiledSegment> m_Segments;
+	std::vector<sRTCCompiledSkywriting> m_SkywritingTable;
+	std::vector<std::string> m_GPIOSequenceNames;
+
+	uint64_t m_nContentHash;
+	uint64_t m_nPointCount;
+
+	// Input of the compilation. It is kept while the layer is cached, so that a cache hit can be verified
+	// against the full content instead of only the hash.
+	sRTCCommandStreamConfiguration m_Configuration;
+	double m_dUnits;
+	std::vector<uint32_t> m_SegmentTypes;
+	std::vector<uint32_t> m_PointOffsets;
+	std::vector<LibMCEnv::sPosition2D> m_Points;
+	std::vector<sRTCCompiledDrawParameters> m_DrawParameters;
+
+	// Returns true if both layers have been compiled from the same input with the same configuration.
+	bool hasSameInput(const CRTCCompiledLayer& otherLayer) const;
+
+	void releaseInput();
+
+	friend class CRTCCommandStreamCompiler;
+
+public:
+
+	CRTCCompiledLayer();
+
+	virtual ~CRTCCompiledLayer();
+
+	const std::vector<sRTCCompiledSegment>& getSegments();
+	const sRTCCompiledCommand* getSegmentCommands(const sRTCCompiledSegment& segment);
+	const sRTCCompiledSkywriting& getSkywriting(uint32_t nSkywritingIndex);
+	const std::string& getGPIOSequenceName(uint32_t nSequenceIndex);
+
+	uint64_t getContentHash();
+
+	uint64_t getCommandCount();
+
+	// Speed commands store the bits of a double value in both parameters
+	static double getCommandValue(const sRTCCompiledCommand& command);
+	static sRTCCompiledCommand makeValueCommand(eRTCCompiledCommandType commandType, double dValue);
+};
+
+typedef std::shared_ptr<CRTCCompiledLayer> PRTCCompiledLayer;
+
+/*************************************************************************************************************************
+ Class declaration of CRTCCommandStreamCompiler 
+**************************************************************************************************************************/
+
+// Turns toolpath layers into compiled layers. The toolpath is exported and resolved per segment on the calling thread,
+// the geometry is then converted into list commands in parallel. Compiled layers are cached by content and configuration,
+// so that repeated layers are replayed without compiling them again.
+class CRTCCommandStreamCompiler {
+private:
+
+	uint32_t m_nThreadCount;
+	uint32_t m_nMaxCachedLayers;
+
+	std::map<std::pair<uint64_t, uint64_t>, PRTCCompiledLayer> m_Cache;
+	std::list<std::pair<uint64_t, uint64_t>> m_CacheOrder;
+
+	sRTCCommandStreamStatistics m_Statistics;
+
+	static uint64_t hashConfiguration(const sRTCCommandStreamConfiguration& configuration);
+
+public:
+
+	CRTCCommandStreamCompiler(uint32_t nThreadCount, uint32_t nMaxCachedLayers);
+
+	virtual ~CRTCCommandStreamCompiler();
+
+	// Returns a cached layer if the toolpath and the configuration have been compiled before.
+	PRTCCompiledLayer compileLayer(LibMCEnv::PToolpathLayer pLayer, const sRTCCommandStreamConfiguration& configuration);
+
+	void clearCache();
+
+	uint32_t getThreadCount();
+
+	uint32_t getMaxCachedLayers();
+
+	sRTCCommandStreamStatistics getStatistics();
+
+};
+
+typedef std::shared_ptr<CRTCCommandStreamCompiler> PRTCCommandStreamCompiler;
+
+} // namespace Impl
+} // namespace LibMCDriver_ScanLab
+
+#endif // __LIBMCDRIVER_SCANLAB_RTCCOMMANDSTREAM
@@ -48,6 +48,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <iomanip>
 #include <string>
 #include <array>
+#include <map>
+#include <limits>
+#include <cmath>
 
 using namespace LibMCDriver_ScanLab::Impl;
 
@@ -57,6 +60,16 @@ using namespace LibMCDriver_ScanLab::Impl;
 #define RTCCONTEXT_MIN_LINESUBDIVISIONTHRESHOLD 0.001
 #define RTCCONTEXT_MAX_LINESUBDIVISIONTHRESHOLD 1000000.0
 
+#define RTCCONTEXT_LISTSTREAMING_MINCHUNKSIZE 1024
+#define RTCCONTEXT_LISTSTREAMING_LISTRESERVE 16384
+#define RTCCONTEXT_LISTSTREAMING_CHECKINTERVAL 256
+#define RTCCONTEXT_LISTSTREAMING_POLLINTERVALINMS 1
+
+// Bits of n_read_status: LOAD1/2 = 0/1, READY1/2 = 2/3, BUSY1/2 = 4/5, USED1/2 = 6/7
+#define RTCCONTEXT_READSTATUS_BUSY(nListIndex) (1UL << (3 + (nListIndex)))
+#define RTCCONTEXT_READSTATUS_USED(nListIndex) (1UL << (5 + (nListIndex)))
+#define RTCCONTEXT_READSTATUS_ANYBUSY (RTCCONTEXT_READSTATUS_BUSY(1) | RTCCONTEXT_READSTATUS_BUSY(2))
+
 CRTCContextOwnerData::CRTCContextOwnerData()
 	: m_nAttributeFilterValue (0), m_OIERecordingMode (LibMCDriver_ScanLab::eOIERecordingMode::OIERecordingDisabled), m_dMaxLaserPowerInWatts (100.0)
 {
@@ -149,7 +162,16 @@ CRTCContext::CRTCContext(PRTCContextOwnerData pOwnerData, uint32_t nCardNo, bool
 	m_pModulationCallbackUserData (nullptr),
 	m_bEnableLineSubdivision (false),
 	m_bMeasurementTagging (false),
-	m_dLineSubdivisionThreshold (RTCCONTEXT_MAX_LINESUBDIVISIONTHRESHOLD)
+	m_dLineSubdivisionThreshold (RTCCONTEXT_MAX_LINESUBDIVISIONTHRESHOLD),
+	m_nListSizeA (0),
+	m_nListSizeB (0),
+	m_bListStreamingActive (false),
+	m_nListStreamingChunkSize (0),
+	m_nListStreamingListIndex (1),
+	m_nListStreamingListStart (0),
+	m_nListStreamingCommandCount (0),
+	m_nListStreamingPendingList (0),
+	m_bListStreamingExecutionStarted (false)
 
 {
 	if (pOwnerData.get() == nullptr)
@@ -170,6 +192,12 @@ CRTCContext::CRTCContext(PRTCContextOwnerData pOwnerData, uint32_t nCardNo, bool
 	m_CurrentMeasurementTagInfo.m_nCurrentSegmentID = 0;
 	m_CurrentMeasurementTagInfo.m_nCurrentVectorID = 0;
 
+	m_ListStreamingStatistics.m_nChunkCount = 0;
+	m_ListStreamingStatistics.m_nStarvationCount = 0;
+	m_ListStreamingStatistics.m_dFirstListStartInMilliseconds = 0.0;
+	m_ListStreamingStatistics.m_dIdleTimeInMilliseconds = 0.0;
+	m_ListStreamingStatistics.m_dLoadTimeInMilliseconds = 0.0;
+
 }
 
 CRTCContext::~CRTCContext()
@@ -312,6 +340,9 @@ void CRTCContext::ConfigureLists(const LibMCDriver_ScanLab_uint32 nSizeListA, co
 	m_pScanLabSDK->n_config_list(m_CardNo, nSizeListA, nSizeListB);
 	m_pScanLabSDK->checkError(m_pScanLabSDK->n_get_last_error(m_CardNo));
 
+	m_nListSizeA = nSizeListA;
+	m_nListSizeB = nSizeListB;
+
 	m_pScanLabSDK->checkGlobalErrorOfCard(m_CardNo);
 }
 
@@ -438,6 +469,183 @@ void CRTCContext::SetAutoChangePos(const LibMCDriver_ScanLab_uint32 nPosition)
 	m_pScanLabSDK->checkError(m_pScanLabSDK->n_get_last_error(m_CardNo));
 }
 
+void CRTCContext::beginListStreaming(uint32_t nChunkSize)
+{
+	if (m_bListStreamingActive)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_LISTSTREAMINGALREADYACTIVE);
+
+	// Every chunk must fit into either list, including the commands that are written between two checks.
+	uint64_t nMinListSize = std::min(m_nListSizeA, m_nListSizeB);
+	if ((nChunkSize < RTCCONTEXT_LISTSTREAMING_MINCHUNKSIZE) || (((uint64_t)nChunkSize + RTCCONTEXT_LISTSTREAMING_LISTRESERVE) > nMinListSize))
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDLISTSTREAMINGCHUNKSIZE, "invalid list streaming chunk size: " + std::to_string(nChunkSize) + " (list size " + std::to_string(nMinListSize) + ")");
+
+	m_ListStreamingStatistics.m_nChunkCount = 0;
+	m_ListStreamingStatistics.m_nStarvationCount = 0;
+	m_ListStreamingStatistics.m_dFirstListStartInMilliseconds = 0.0;
+	m_ListStreamingStatistics.m_dIdleTimeInMilliseconds = 0.0;
+	m_ListStreamingStatistics.m_dLoadTimeInMilliseconds = 0.0;
+
+	m_nListStreamingChunkSize = nChunkSize;
+	m_nListStreamingListIndex = 1;
+	m_nListStreamingCommandCount = 0;
+	m_nListStreamingPendingList = 0;
+	m_bListStreamingExecutionStarted = false;
+	m_ListStreamingStartTime = std::chrono::steady_clock::now();
+	m_ListStreamingLastBusyTime = m_ListStreamingStartTime;
+
+	SetStartList(m_nListStreamingListIndex, 0);
+	m_nListStreamingListStart = GetInputPointer();
+
+	m_bListStreamingActive = true;
+}
+
+void CRTCContext::finishListStreaming()
+{
+	if (!m_bListStreamingActive)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_LISTSTREAMINGNOTACTIVE);
+
+	closeStreamingList(true);
+
+	// The last list must have been picked up before the caller starts polling for the end of execution.
+	while (m_nListStreamingPendingList != 0) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(RTCCONTEXT_LISTSTREAMING_POLLINTERVALINMS));
+		updateListStreamingStatus();
+	}
+
+	m_ListStreamingStatistics.m_dLoadTimeInMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_ListStreamingStartTime).count();
+	m_bListStreamingActive = false;
+}
+
+void CRTCContext::abortListStreaming()
+{
+	if (m_bListStreamingActive) {
+		m_bListStreamingActive = false;
+		m_nListStreamingPendingList = 0;
+
+		if (m_bListStreamingExecutionStarted)
+			StopExecution();
+	}
+}
+
+bool CRTCContext::isListStreaming()
+{
+	return m_bListStreamingActive;
+}
+
+sListStreamingStatistics CRTCContext::getListStreamingStatistics()
+{
+	return m_ListStreamingStatistics;
+}
+
+PRTCStatusMonitorInstance CRTCContext::createStatusMonitor(uint32_t nMinPollIntervalInMicroseconds, uint32_t nMaxPollIntervalInMicroseconds)
+{
+	return std::make_shared<CRTCStatusMonitorInstance>(m_pScanLabSDK, m_CardNo, nMinPollIntervalInMicroseconds, nMaxPollIntervalInMicroseconds);
+}
+
+bool CRTCContext::isEmulated()
+{
+	return m_pScanLabSDK->isEmulated();
+}
+
+void CRTCContext::resetEmulationStatistics()
+{
+	m_pScanLabSDK->resetEmulationStatistics(m_CardNo);
+}
+
+sScanLabEmulationStatistics CRTCContext::getEmulationStatistics()
+{
+	sScanLabEmulationStatistics statistics;
+	m_pScanLabSDK->getEmulationStatistics(m_CardNo, statistics);
+	return statistics;
+}
+
+void CRTCContext::countListStreamingCommand()
+{
+	m_nListStreamingCommandCount++;
+	if (m_nListStreamingCommandCount < RTCCONTEXT_LISTSTREAMING_CHECKINTERVAL)
+		return;
+	m_nListStreamingCommandCount = 0;
+
+	uint32_t nInputPointer = m_pScanLabSDK->n_get_input_pointer(m_CardNo);
+	uint32_t nListSpace = m_pScanLabSDK->n_get_list_space(m_CardNo);
+
+	if (((nInputPointer - m_nListStreamingListStart) >= m_nListStreamingChunkSize) || (nListSpace < RTCCONTEXT_LISTSTREAMING_LISTRESERVE))
+		closeStreamingList(false);
+	else
+		updateListStreamingStatus();
+}
+
+void CRTCContext::closeStreamingList(bool bIsLastList)
+{
+	uint32_t nClosedListIndex = m_nListStreamingListIndex;
+
+	SetEndOfList();
+	m_ListStreamingStatistics.m_nChunkCount++;
+
+	if (!m_bListStreamingExecutionStarted) {
+		ExecuteList(nClosedListIndex, 0);
+
+		auto currentTime = std::chrono::steady_clock::now();
+		m_ListStreamingStatistics.m_dFirstListStartInMilliseconds = std::chrono::duration<double, std::milli>(currentTime - m_ListStreamingStartTime).count();
+		m_ListStreamingLastBusyTime = currentTime;
+		m_bListStreamingExecutionStarted = true;
+	}
+	else {
+		// Chain the closed list behind the running one. If the scanner has already run dry,
+		// updateListStreamingStatus executes it directly.
+		m_nListStreamingPendingList = nClosedListIndex;
+		uint32_t nStatus = m_pScanLabSDK->n_read_status(m_CardNo);
+		if ((nStatus & RTCCONTEXT_READSTATUS_ANYBUSY) != 0)
+			SetAutoChangePos(0);
+
+		updateListStreamingStatus();
+	}
+
+	if (!bIsLastList) {
+		// The other list can only be reloaded once the card has finished executing it.
+		m_nListStreamingListIndex = 3 - nClosedListIndex;
+		while (m_pScanLabSDK->n_load_list(m_CardNo, m_nListStreamingListIndex, 0) == 0) {
+			updateListStreamingStatus();
+			std::this_thread::sleep_for(std::chrono::milliseconds(RTCCONTEXT_LISTSTREAMING_POLLINTERVALINMS));
+		}
+		m_pScanLabSDK->checkError(m_pScanLabSDK->n_get_last_error(m_CardNo));
+
+		m_nListStreamingListStart = GetInputPointer();
+	}
+}
+
+void CRTCContext::updateListStreamingStatus()
+{
+	if (!m_bListStreamingExecutionStarted)
+		return;
+
+	uint32_t nStatus = m_pScanLabSDK->n_read_status(m_CardNo);
+	auto currentTime = std::chrono::steady_clock::now();
+
+	if ((nStatus & RTCCONTEXT_READSTATUS_ANYBUSY) != 0)
+		m_ListStreamingLastBusyTime = currentTime;
+
+	if (m_nListStreamingPendingList == 0)
+		return;
+
+	// BUSY or USED of the pending list means the auto change has happened.
+	if ((nStatus & (RTCCONTEXT_READSTATUS_BUSY(m_nListStreamingPendingList) | RTCCONTEXT_READSTATUS_USED(m_nListStreamingPendingList))) != 0) {
+		m_nListStreamingPendingList = 0;
+		return;
+	}
+
+	if ((nStatus & RTCCONTEXT_READSTATUS_ANYBUSY) != 0)
+		return;
+
+	// The running list finished before the pending one was ready: the scanner starved.
+	ExecuteList(m_nListStreamingPendingList, 0);
+	m_nListStreamingPendingList = 0;
+
+	m_ListStreamingStatistics.m_nStarvationCount++;
+	m_ListStreamingStatistics.m_dIdleTimeInMilliseconds += std::chrono::duration<double, std::milli>(currentTime - m_ListStreamingLastBusyTime).count();
+	m_ListStreamingLastBusyTime = currentTime;
+}
+
 void CRTCContext::SetDelays(const LibMCDriver_ScanLab_uint32 nMarkDelay, const LibMCDriver_ScanLab_uint32 nJumpDelay, const LibMCDriver_ScanLab_uint32 nPolygonDelay)
 {
 	m_pScanLabSDK->checkGlobalErrorOfCard(m_CardNo);
@@ -704,6 +912,9 @@ void CRTCContext::jumpAbsoluteEx(double dTargetXInMM, double dTargetYInMM)
 		m_pScanLabSDK->n_jump_abs(m_CardNo, nTargetX, nTargetY);
 		m_nCurrentScanPositionX = nTargetX;
 		m_nCurrentScanPositionY = nTargetY;
+
+		if (m_bListStreamingActive)
+			countListStreamingCommand();
 	}
 
 	// Do not check error because that creates timing issues..
@@ -751,6 +962,9 @@ void CRTCContext::markAbsoluteEx(double dStartXInMM, double dStartYInMM, double
 		m_nCurrentScanPositionX = nTargetX;
 		m_nCurrentScanPositionY = nTargetY;
 
+		if (m_bListStreamingActive)
+			countListStreamingCommand();
+
 		//m_pScanLabSDK->checkError(m_pScanLabSDK->n_get_last_error(m_CardNo));
 		
 		dOldX = dMarkToX;
@@ -994,6 +1208,61 @@ void CRTCContext::DisableLineSubdivision()
 
 }
 
+void CRTCContext::EnableCommandStreamCompilation(const LibMCDriver_ScanLab_uint32 nThreadCount, const LibMCDriver_ScanLab_uint32 nMaxCachedLayers)
+{
+	m_pCommandStreamCompiler = std::make_shared<CRTCCommandStreamCompiler>(nThreadCount, nMaxCachedLayers);
+}
+
+void CRTCContext::DisableCommandStreamCompilation()
+{
+	m_pCommandStreamCompiler = nullptr;
+}
+
+bool CRTCContext::CommandStreamCompilationIsEnabled()
+{
+	return (m_pCommandStreamCompiler.get() != nullptr);
+}
+
+void CRTCContext::ClearCompiledLayerCache()
+{
+	if (m_pCommandStreamCompiler.get() != nullptr)
+		m_pCommandStreamCompiler->clearCache();
+}
+
+void CRTCContext::GetCommandStreamStatistics(LibMCDriver_ScanLab_uint32& nCompiledLayerCount, LibMCDriver_ScanLab_uint32& nCacheHitCount, LibMCDriver_ScanLab_uint64& nLastCommandCount, LibMCDriver_ScanLab_double& dLastCompileTime)
+{
+	if (m_pCommandStreamCompiler.get() == nullptr)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_COMMANDSTREAMCOMPILATIONNOTENABLED);
+
+	auto statistics = m_pCommandStreamCompiler->getStatistics();
+	nCompiledLayerCount = statistics.m_nCompiledLayerCount;
+	nCacheHitCount = statistics.m_nCacheHitCount;
+	nLastCommandCount = statistics.m_nLastCommandCount;
+	dLastCompileTime = statistics.m_dLastCompileTimeInMilliseconds;
+}
+
+void CRTCContext::ResetEmulationStatistics()
+{
+	if (!isEmulated())
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_SDKISNOTEMULATED);
+
+	resetEmulationStatistics();
+}
+
+void CRTCContext::GetEmulationStatistics(LibMCDriver_ScanLab_uint64& nListCommandCount, LibMCDriver_ScanLab_uint64& nListCommandHash, LibMCDriver_ScanLab_double& dMarkTime, LibMCDriver_ScanLab_double& dJumpTime, LibMCDriver_ScanLab_double& dExecutionTime)
+{
+	if (!isEmulated())
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_SDKISNOTEMULATED);
+
+	auto statistics = getEmulationStatistics();
+	nListCommandCount = statistics.m_nListCommandCount;
+	nListCommandHash = statistics.m_nListCommandHash;
+	dMarkTime = statistics.m_dMarkTimeInMicroseconds / 1000.0;
+	dJumpTime = statistics.m_dJumpTimeInMicroseconds / 1000.0;
+	dExecutionTime = statistics.m_dExecutionTimeInMicroseconds / 1000.0;
+}
+
+
 
 double CRTCContext::adjustLaserPowerCalibration(double dLaserPowerInPercent, double dPowerOffsetInPercent, double dPowerOutputScaling)
 {
@@ -2253,8 +2522,6 @@ void CRTCContext::addLayerToListEx(LibMCEnv::PToolpathLayer pLayer, eOIERecordin
 	if (pLayer.get() == nullptr)
 		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
 
-	double dUnits = pLayer->GetUnits();
-
 	switch (oieRecordingMode) {
 	case eOIERecordingMode::OIEEnableAndContinuousMeasurement:
 	case eOIERecordingMode::OIEEnableAndLaserActiveMeasurement:
@@ -2277,27 +2544,162 @@ void CRTCContext::addLayerToListEx(LibMCEnv::PToolpathLayer pLayer, eOIERecordin
 		SetOIEPIDMode(0);
 	}
 
-	uint32_t nSegmentCount = pLayer->GetSegmentCount();
+	// Power modulation calls back for every mark, and the compiled power commands do not apply a laser power calibration.
+	bool bCompileLayer = (m_pCommandStreamCompiler.get() != nullptr) && (m_pModulationCallback == nullptr) && (m_LaserPowerCalibrationList.empty());
+
+	if (bCompileLayer) {
+		sRTCCommandStreamConfiguration configuration;
+		configuration.m_dCorrectionFactor = m_dCorrectionFactor;
+		configuration.m_dZCorrectionFactor = m_dZCorrectionFactor;
+		configuration.m_dLaserOriginX = m_dLaserOriginX;
+		configuration.m_dLaserOriginY = m_dLaserOriginY;
+		configuration.m_bEnableLineSubdivision = m_bEnableLineSubdivision;
+		configuration.m_dLineSubdivisionThreshold = m_dLineSubdivisionThreshold;
+		configuration.m_dLineSubdivisionMinLength = RTCCONTEXT_MIN_LINESUBDIVISIONTHRESHOLD;
+		configuration.m_LaserPort = m_LaserPort;
+		configuration.m_bEnableOIEPIDControl = m_bEnableOIEPIDControl;
+		configuration.m_bMeasurementTagging = m_bMeasurementTagging;
+		configuration.m_bAFXSelectionEnabled = (m_pNLightAFXSelectorInstance.get() != nullptr) && m_pNLightAFXSelectorInstance->isEnabled();
+		configuration.m_nMaxAFXMode = CNLightAFXProfileSelectorInstance::getMaxAFXMode();
+		configuration.m_nLaserIndex = GetLaserIndex();
+		configuration.m_bFailIfNonAssignedDataExists = bFailIfNonAssignedDataExists;
+		configuration.m_nAttributeFilterID = nAttributeFilterID;
+		configuration.m_nAttributeFilterValue = nAttributeFilterValue;
+		configuration.m_fMaxLaserPowerInWatts = fMaxLaserPowerInWatts;
+
+		auto pCompiledLayer = m_pCommandStreamCompiler->compileLayer(pLayer, configuration);
+		replayCompiledLayer(pCompiledLayer);
+	}
+	else {
+		addLayerSegmentsToListEx(pLayer, nAttributeFilterID, nAttributeFilterValue, fMaxLaserPowerInWatts, bFailIfNonAssignedDataExists);
+	}
+
+	if (m_bEnableOIEPIDControl) {
+		SetOIEPIDMode(0);
+	}
+
+	if ((oieRecordingMode != eOIERecordingMode::OIERecordingDisabled))
+		StopOIEMeasurement();
+
+	// Disable AFX Mode
+	if (m_pNLightAFXSelectorInstance.get() != nullptr) {
+		if (m_pNLightAFXSelectorInstance->isEnabled())
+			m_pNLightAFXSelectorInstance->selectAFXModeIfNecessary (0);
+	}
+
+	switch (oieRecordingMode) {
+	case eOIERecordingMode::OIEEnableAndContinuousMeasurement:
+	case eOIERecordingMode::OIEEnableAndLaserActiveMeasurement:
+		DisableOIE();
+		break;
+	}
+
+}
+
+void CRTCContext::addLayerSegmentsToListEx(LibMCEnv::PToolpathLayer pLayer, uint32_t nAttributeFilterID, int64_t nAttributeFilterValue, float fMaxLaserPowerInWatts, bool bFailIfNonAssignedDataExists)
+{
+	if (pLayer.get() == nullptr)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	double dUnits = pLayer->GetUnits();
+
+	// Export the whole layer at once, instead of querying every segment value through the environment interface.
+	// Profile values are resolved once per profile. Missing required values and values that are not plain numbers
+	// come back as NaN and are queried again per segment, which reports the same errors as before.
+	double dNaN = std::numeric_limits<double>::quiet_NaN();
+	std::vector<LibMCEnv::sToolpathProfileValueColumn> ProfileColumns;
+	auto addProfileColumn = [&ProfileColumns](LibMCEnv::eToolpathProfileValueType eValueType, uint32_t nValueID, double dDefaultValue) -> uint32_t {
+		LibMCEnv::sToolpathProfileValueColumn column;
+		column.m_ValueType = (uint32_t)eValueType;
+		column.m_ValueID = nValueID;
+		column.m_DefaultValue = dDefaultValue;
+		ProfileColumns.push_back(column);
+		return (uint32_t)(ProfileColumns.size() - 1);
+	};
+	auto addCustomProfileColumn = [&](const std::string& sNameSpace, const std::string& sValueName, double dDefaultValue) -> uint32_t {
+		return addProfileColumn(LibMCEnv::eToolpathProfileValueType::Custom, pLayer->FindProfileValueID(sNameSpace, sValueName), dDefaultValue);
+	};
+
+	uint32_t nMeasurementIDColumn = addCustomProfileColumn("http://schemas.scanlab.com/oie/2023/08", "measurementid", 0.0);
+	uint32_t nAFXModeColumn = addCustomProfileColumn("http://schemas.nlight.com/afx/2024/09", "afxmode", 0.0);
+	uint32_t nJumpSpeedColumn = addProfileColumn(LibMCEnv::eToolpathProfileValueType::JumpSpeed, 0, dNaN);
+	uint32_t nMarkSpeedColumn = addProfileColumn(LibMCEnv::eToolpathProfileValueType::Speed, 0, dNaN);
+	uint32_t nLaserPowerColumn = addProfileColumn(LibMCEnv::eToolpathProfileValueType::LaserPower, 0, dNaN);
+	uint32_t nLaserFocusColumn = addProfileColumn(LibMCEnv::eToolpathProfileValueType::LaserFocus, 0, dNaN);
+	uint32_t nPIDIndexColumn = addCustomProfileColumn("http://schemas.scanlab.com/oie/2023/08", "pidindex", 0.0);
+	uint32_t nLaserIndexColumn = addCustomProfileColumn("", "laserindex", 0.0);
+	uint32_t nSkywritingModeColumn = addCustomProfileColumn("http://schemas.scanlab.com/skywriting/2023/01", "mode", 0.0);
+	uint32_t nColumnCount = (uint32_t)ProfileColumns.size();
+
+	std::vector<uint32_t> SegmentTypes;
+	std::vector<uint32_t> PointOffsets;
+	std::vector<uint32_t> LocalPartIDs;
+	std::vector<uint32_t> ProfileIDs;
+	pLayer->ExportSegmentTable(SegmentTypes, PointOffsets, LocalPartIDs, ProfileIDs);
+
+	std::vector<double> ProfileValues;
+	pLayer->ExportProfileValueColumns(ProfileColumns, ProfileValues);
+
+	std::vector<int64_t> FilterAttributeValues;
+	if (nAttributeFilterID != 0)
+		pLayer->ExportSegmentIntegerAttributes(LibMCEnv::CInputVector<uint32_t>(&nAttributeFilterID, 1), FilterAttributeValues);
+
+	std::vector<LibMCEnv::sPosition2D> Points;
+	pLayer->ExportPointData(Points);
+
+	uint32_t nSegmentCount = (uint32_t)SegmentTypes.size();
+	if ((PointOffsets.size() != (size_t)nSegmentCount + 1) || (ProfileValues.size() != (size_t)nSegmentCount * nColumnCount) || (PointOffsets.at (nSegmentCount) != Points.size ()))
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPOINTCOUNT);
+
+	// Integer profile values, with the same rounding tolerance as the per-segment accessor.
+	auto getIntegerProfileValue = [&](uint32_t nSegmentIndex, uint32_t nColumn, const std::string& sNameSpace, const std::string& sValueName) -> int64_t {
+		double dValue = ProfileValues[(size_t)nSegmentIndex * nColumnCount + nColumn];
+		if ((!std::isnan(dValue)) && (abs(dValue - round(dValue)) < 0.001))
+			return (int64_t)round(dValue);
+		return pLayer->GetSegmentProfileIntegerValueDef(nSegmentIndex, sNameSpace, sValueName, 0);
+	};
+
+	auto getTypedProfileValue = [&](uint32_t nSegmentIndex, uint32_t nColumn, LibMCEnv::eToolpathProfileValueType eValueType) -> double {
+		double dValue = ProfileValues[(size_t)nSegmentIndex * nColumnCount + nColumn];
+		if (!std::isnan(dValue))
+			return dValue;
+		return pLayer->GetSegmentProfileTypedValue(nSegmentIndex, eValueType);
+	};
+
+	// GPIO sequences are strings, so they are cached per profile.
+	std::map<uint32_t, std::string> PreSequenceCache;
+	std::map<uint32_t, std::string> PostSequenceCache;
+	auto getGPIOSequence = [&](uint32_t nSegmentIndex, std::map<uint32_t, std::string>& sequenceCache, const std::string& sValueName) -> std::string {
+		uint32_t nProfileID = ProfileIDs[nSegmentIndex];
+		auto iIter = sequenceCache.find(nProfileID);
+		if (iIter != sequenceCache.end())
+			return iIter->second;
+
+		auto sSequence = pLayer->GetSegmentProfileValueDef(nSegmentIndex, "http://schemas.scanlab.com/gpiosequence/2025/01", sValueName, "");
+		sequenceCache.insert(std::make_pair(nProfileID, sSequence));
+		return sSequence;
+	};
+
 	for (uint32_t nSegmentIndex = 0; nSegmentIndex < nSegmentCount; nSegmentIndex++) {
 
 		m_CurrentMeasurementTagInfo.m_nCurrentSegmentID = (uint32_t) (nSegmentIndex + 1);
-		m_CurrentMeasurementTagInfo.m_nCurrentProfileID = (uint32_t) pLayer->GetSegmentProfileIntegerValueDef(nSegmentIndex, "http://schemas.scanlab.com/oie/2023/08", "measurementid", 0);
-		m_CurrentMeasurementTagInfo.m_nCurrentPartID = (uint32_t)pLayer->GetSegmentLocalPartID(nSegmentIndex);
+		m_CurrentMeasurementTagInfo.m_nCurrentProfileID = (uint32_t) getIntegerProfileValue(nSegmentIndex, nMeasurementIDColumn, "http://schemas.scanlab.com/oie/2023/08", "measurementid");
+		m_CurrentMeasurementTagInfo.m_nCurrentPartID = LocalPartIDs[nSegmentIndex];
 
-		LibMCEnv::eToolpathSegmentType eSegmentType;
-		uint32_t nPointCount;
-		pLayer->GetSegmentInfo(nSegmentIndex, eSegmentType, nPointCount);
+		LibMCEnv::eToolpathSegmentType eSegmentType = (LibMCEnv::eToolpathSegmentType)SegmentTypes[nSegmentIndex];
+		uint32_t nPointOffset = PointOffsets[nSegmentIndex];
+		uint32_t nPointCount = PointOffsets[nSegmentIndex + 1] - nPointOffset;
 		
 		bool bDrawSegment = true;
 		if (nAttributeFilterID != 0) {
-			int64_t segmentAttributeValue = pLayer->GetSegmentIntegerAttribute(nSegmentIndex, nAttributeFilterID);
+			int64_t segmentAttributeValue = FilterAttributeValues[nSegmentIndex];
 			bDrawSegment = (segmentAttributeValue == nAttributeFilterValue);
 		}
 
 		if (bDrawSegment && (nPointCount >= 2)) {
 
 			// Run GPIO Pre-Sequence
-			auto sPreSequence = pLayer->GetSegmentProfileValueDef(nSegmentIndex, "http://schemas.scanlab.com/gpiosequence/2025/01", "presequence", "");
+			auto sPreSequence = getGPIOSequence(nSegmentIndex, PreSequenceCache, "presequence");
 			if (!sPreSequence.empty()) {
 				addGPIOSequenceToList (sPreSequence);
 			}
@@ -2305,7 +2707,7 @@ void CRTCContext::addLayerToListEx(LibMCEnv::PToolpathLayer pLayer, eOIERecordin
 			// Update nLight AFX Mode if necessary
 			if (m_pNLightAFXSelectorInstance.get() != nullptr) {
 				if (m_pNLightAFXSelectorInstance->isEnabled()) {
-					int64_t nLightAFXMode = pLayer->GetSegmentProfileIntegerValueDef(nSegmentIndex, "http://schemas.nlight.com/afx/2024/09", "afxmode", 0);
+					int64_t nLightAFXMode = getIntegerProfileValue(nSegmentIndex, nAFXModeColumn, "http://schemas.nlight.com/afx/2024/09", "afxmode");
 					if (nLightAFXMode < 0) 
 						throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDNLIGHTAFXMODE, "Invalid nLightAFXMode: " + std::to_string(nLightAFXMode));
 					if (nLightAFXMode > (int64_t) m_pNLightAFXSelectorInstance->getMaxAFXMode ())
@@ -2317,20 +2719,22 @@ void CRTCContext::addLayerToListEx(LibMCEnv::PToolpathLayer pLayer, eOIERecordin
 			}
 
 
-			float fJumpSpeedInMMPerSecond = (float)pLayer->GetSegmentProfileTypedValue(nSegmentIndex, LibMCEnv::eToolpathProfileValueType::JumpSpeed);
-			float fMarkSpeedInMMPerSecond = (float)pLayer->GetSegmentProfileTypedValue(nSegmentIndex, LibMCEnv::eToolpathProfileValueType::Speed);
-			float fPowerInWatts = (float)pLayer->GetSegmentProfileTypedValue(nSegmentIndex, LibMCEnv::eToolpathProfileValueType::LaserPower);
+			float fJumpSpeedInMMPerSecond = (float)getTypedProfileValue(nSegmentIndex, nJumpSpeedColumn, LibMCEnv::eToolpathProfileValueType::JumpSpeed);
+			float fMarkSpeedInMMPerSecond = (float)getTypedProfileValue(nSegmentIndex, nMarkSpeedColumn, LibMCEnv::eToolpathProfileValueType::Speed);
+			float fPowerInWatts = (float)getTypedProfileValue(nSegmentIndex, nLaserPowerColumn, LibMCEnv::eToolpathProfileValueType::LaserPower);
 			float fPowerInPercent = (fPowerInWatts * 100.f) / fMaxLaserPowerInWatts;
-			float fLaserFocus = (float)pLayer->GetSegmentProfileTypedValue(nSegmentIndex, LibMCEnv::eToolpathProfileValueType::LaserFocus);
+			float fLaserFocus = (float)getTypedProfileValue(nSegmentIndex, nLaserFocusColumn, LibMCEnv::eToolpathProfileValueType::LaserFocus);
 
 			uint32_t nOIEPIDControlIndex = 0;
 			if (m_bEnableOIEPIDControl) {
-				nOIEPIDControlIndex = (uint32_t) pLayer->GetSegmentProfileIntegerValueDef(nSegmentIndex, "http://schemas.scanlab.com/oie/2023/08", "pidindex", 0);
+				nOIEPIDControlIndex = (uint32_t) getIntegerProfileValue(nSegmentIndex, nPIDIndexColumn, "http://schemas.scanlab.com/oie/2023/08", "pidindex");
 			}
 
 			// Legacy fix: There might be 3MFs with double values as laser index (like 1.0000)
 			// Ensure that they are at least approximately installers
-			double dLaserIndexOfSegment = pLayer->GetSegmentProfileDoubleValueDef(nSegmentIndex, "", "laserindex", 0);
+			double dLaserIndexOfSegment = ProfileValues[(size_t)nSegmentIndex * nColumnCount + nLaserIndexColumn];
+			if (std::isnan(dLaserIndexOfSegment))
+				dLaserIndexOfSegment = pLayer->GetSegmentProfileDoubleValueDef(nSegmentIndex, "", "laserindex", 0);
 			int64_t nLaserIndexOfSegment = (int64_t)round(dLaserIndexOfSegment);
 			if (abs(dLaserIndexOfSegment - double(nLaserIndexOfSegment)) > 0.001)
 				throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_SEGMENTHASINVALIDLASERINDEX, "Segment has invalid laser index: " + std::to_string(dLaserIndexOfSegment));
@@ -2344,7 +2748,7 @@ void CRTCContext::addLayerToListEx(LibMCEnv::PToolpathLayer pLayer, eOIERecordin
 
 			if (nLaserIndexOfSegment == nCurrentLaserIndex) {
 
-				int64_t nSkywritingMode = pLayer->GetSegmentProfileIntegerValueDef(nSegmentIndex, "http://schemas.scanlab.com/skywriting/2023/01", "mode", 0);
+				int64_t nSkywritingMode = getIntegerProfileValue(nSegmentIndex, nSkywritingModeColumn, "http://schemas.scanlab.com/skywriting/2023/01", "mode");
 
 				if (nSkywritingMode != 0) {
 					double dSkywritingTimeLag = pLayer->GetSegmentProfileDoubleValue(nSegmentIndex, "http://schemas.scanlab.com/skywriting/2023/01", "timelag");
@@ -2377,11 +2781,7 @@ void CRTCContext::addLayerToListEx(LibMCEnv::PToolpathLayer pLayer, eOIERecordin
 
 				}
 
-				std::vector<LibMCEnv::sPosition2D> Points;
-				pLayer->GetSegmentPointData(nSegmentIndex, Points);
-
-				if (nPointCount != Points.size())
-					throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPOINTCOUNT);
+				const LibMCEnv::sPosition2D* pSegmentPoints = &Points[nPointOffset];
 
 				switch (eSegmentType) {
 				case LibMCEnv::eToolpathSegmentType::Loop:
@@ -2393,8 +2793,8 @@ void CRTCContext::addLayerToListEx(LibMCEnv::PToolpathLayer pLayer, eOIERecordin
 
 					for (uint32_t nPointIndex = 0; nPointIndex < nPointCount; nPointIndex++) {
 						auto pContourPoint = &ContourPoints.at(nPointIndex);
-						pContourPoint->m_X = (float)(Points[nPointIndex].m_Coordinates[0] * dUnits);
-						pContourPoint->m_Y = (float)(Points[nPointIndex].m_Coordinates[1] * dUnits);
+						pContourPoint->m_X = (float)(pSegmentPoints[nPointIndex].m_Coordinates[0] * dUnits);
+						pContourPoint->m_Y = (float)(pSegmentPoints[nPointIndex].m_Coordinates[1] * dUnits);
 					}
 
 					DrawPolylineOIE(nPointCount, ContourPoints.data(), fMarkSpeedInMMPerSecond, fJumpSpeedInMMPerSecond, fPowerInPercent, fLaserFocus, nOIEPIDControlIndex);
@@ -2413,10 +2813,10 @@ void CRTCContext::addLayerToListEx(LibMCEnv::PToolpathLayer pLayer, eOIERecordin
 
 					for (uint64_t nHatchIndex = 0; nHatchIndex < nHatchCount; nHatchIndex++) {
 						auto pHatch = &Hatches.at(nHatchIndex);
-						pHatch->m_X1 = (float)(Points[nHatchIndex * 2].m_Coordinates[0] * dUnits);
-						pHatch->m_Y1 = (float)(Points[nHatchIndex * 2].m_Coordinates[1] * dUnits);
-						pHatch->m_X2 = (float)(Points[nHatchIndex * 2 + 1].m_Coordinates[0] * dUnits);
-						pHatch->m_Y2 = (float)(Points[nHatchIndex * 2 + 1].m_Coordinates[1] * dUnits);
+						pHatch->m_X1 = (float)(pSegmentPoints[nHatchIndex * 2].m_Coordinates[0] * dUnits);
+						pHatch->m_Y1 = (float)(pSegmentPoints[nHatchIndex * 2].m_Coordinates[1] * dUnits);
+						pHatch->m_X2 = (float)(pSegmentPoints[nHatchIndex * 2 + 1].m_Coordinates[0] * dUnits);
+						pHatch->m_Y2 = (float)(pSegmentPoints[nHatchIndex * 2 + 1].m_Coordinates[1] * dUnits);
 					}
 
 					DrawHatchesOIE(Hatches.size(), Hatches.data(), fMarkSpeedInMMPerSecond, fJumpSpeedInMMPerSecond, fPowerInPercent, fLaserFocus, nOIEPIDControlIndex);
@@ -2430,32 +2830,137 @@ void CRTCContext::addLayerToListEx(LibMCEnv::PToolpathLayer pLayer, eOIERecordin
 		}
 
 		// Run GPIO Post-Sequence
-		auto sPostSequence = pLayer->GetSegmentProfileValueDef(nSegmentIndex, "http://schemas.scanlab.com/gpiosequence/2025/01", "postsequence", "");
+		auto sPostSequence = getGPIOSequence(nSegmentIndex, PostSequenceCache, "postsequence");
 		if (!sPostSequence.empty()) {
 			addGPIOSequenceToList(sPostSequence);
 		}
 	}
+}
 
+void CRTCContext::replayCompiledLayer(PRTCCompiledLayer pCompiledLayer)
+{
+	if (pCompiledLayer.get() == nullptr)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
 
+	for (auto& segment : pCompiledLayer->getSegments()) {
 
-	if (m_bEnableOIEPIDControl) {
-		SetOIEPIDMode(0);
-	}
+		m_CurrentMeasurementTagInfo.m_nCurrentSegmentID = segment.m_nSegmentID;
+		m_CurrentMeasurementTagInfo.m_nCurrentProfileID = segment.m_nProfileID;
+		m_CurrentMeasurementTagInfo.m_nCurrentPartID = segment.m_nPartID;
 
-	if ((oieRecordingMode != eOIERecordingMode::OIERecordingDisabled))
-		StopOIEMeasurement();
+		if (segment.m_bIsActive) {
 
-	// Disable AFX Mode
-	if (m_pNLightAFXSelectorInstance.get() != nullptr) {
-		if (m_pNLightAFXSelectorInstance->isEnabled())
-			m_pNLightAFXSelectorInstance->selectAFXModeIfNecessary (0);
+			if (segment.m_nPreSequenceIndex != 0)
+				addGPIOSequenceToList(pCompiledLayer->getGPIOSequenceName(segment.m_nPreSequenceIndex));
+
+			if ((segment.m_nAFXMode >= 0) && (m_pNLightAFXSelectorInstance.get() != nullptr))
+				m_pNLightAFXSelectorInstance->selectAFXModeIfNecessary((uint32_t)segment.m_nAFXMode);
+
+			if (segment.m_bIsDrawn) {
+
+				if (segment.m_nSkywritingIndex != 0) {
+					auto& skywriting = pCompiledLayer->getSkywriting(segment.m_nSkywritingIndex);
+					switch (skywriting.m_nMode) {
+					case 1:
+						EnableSkyWritingMode1(skywriting.m_dTimeLag, skywriting.m_nLaserOnShift, skywriting.m_nPrev, skywriting.m_nPost);
+						break;
+					case 2:
+						EnableSkyWritingMode2(skywriting.m_dTimeLag, skywriting.m_nLaserOnShift, skywriting.m_nPrev, skywriting.m_nPost);
+						break;
+					case 3:
+						EnableSkyWritingMode3(skywriting.m_dTimeLag, skywriting.m_nLaserOnShift, skywriting.m_nPrev, skywriting.m_nPost, skywriting.m_dLimit);
+						break;
+					case 4:
+						EnableSkyWritingMode4(skywriting.m_dTimeLag, skywriting.m_nLaserOnShift, skywriting.m_nPrev, skywriting.m_nPost, skywriting.m_dLimit);
+						break;
+					default:
+						DisableSkyWriting();
+					}
+				}
+
+				if (segment.m_nCommandCount > 0)
+					replayCompiledCommands(pCompiledLayer->getSegmentCommands(segment), segment.m_nCommandCount);
+			}
+		}
+
+		if (segment.m_nPostSequenceIndex != 0)
+			addGPIOSequenceToList(pCompiledLayer->getGPIOSequenceName(segment.m_nPostSequenceIndex));
 	}
 
-	switch (oieRecordingMode) {
-	case eOIERecordingMode::OIEEnableAndContinuousMeasurement:
-	case eOIERecordingMode::OIEEnableAndLaserActiveMeasurement:
-		DisableOIE();
-		break;
+}
+
+void CRTCContext::replayCompiledCommands(const sRTCCompiledCommand* pCommands, uint64_t nCommandCount)
+{
+	if (pCommands == nullptr)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	CScanLabSDK* pSDK = m_pScanLabSDK.get();
+	const sRTCCompiledCommand* pEndOfCommands = pCommands + nCommandCount;
+
+	for (const sRTCCompiledCommand* pCommand = pCommands; pCommand < pEndOfCommands; pCommand++) {
+		switch (pCommand->m_Type) {
+		case eRTCCompiledCommandType::JumpAbsolute:
+			// Avoid Null Jumps!
+			if ((pCommand->m_nParameter1 != m_nCurrentScanPositionX) || (pCommand->m_nParameter2 != m_nCurrentScanPositionY)) {
+				pSDK->n_jump_abs(m_CardNo, pCommand->m_nParameter1, pCommand->m_nParameter2);
+				m_nCurrentScanPositionX = pCommand->m_nParameter1;
+				m_nCurrentScanPositionY = pCommand->m_nParameter2;
+
+				if (m_bListStreamingActive)
+					countListStreamingCommand();
+			}
+			break;
+
+		case eRTCCompiledCommandType::MarkAbsolute:
+			pSDK->n_mark_abs(m_CardNo, pCommand->m_nParameter1, pCommand->m_nParameter2);
+			m_nCurrentScanPositionX = pCommand->m_nParameter1;
+			m_nCurrentScanPositionY = pCommand->m_nParameter2;
+
+			if (m_bListStreamingActive)
+				countListStreamingCommand();
+			break;
+
+		case eRTCCompiledCommandType::SetMarkSpeed:
+			pSDK->n_set_mark_speed(m_CardNo, CRTCCompiledLayer::getCommandValue(*pCommand));
+			break;
+
+		case eRTCCompiledCommandType::SetJumpSpeed:
+			pSDK->n_set_jump_speed(m_CardNo, CRTCCompiledLayer::getCommandValue(*pCommand));
+			break;
+
+		case eRTCCompiledCommandType::SetLaserPower:
+			pSDK->n_set_laser_power(m_CardNo, (uint32_t)pCommand->m_nParameter1, (uint32_t)pCommand->m_nParameter2);
+			break;
+
+		case eRTCCompiledCommandType::SetLaserPowerMCBSP:
+			pSDK->n_set_multi_mcbsp_in_list(m_CardNo, (uint32_t)pCommand->m_nParameter1, (uint32_t)pCommand->m_nParameter2, 1);
+			break;
+
+		case eRTCCompiledCommandType::FlyReturnPulse:
+			pSDK->n_set_fly_2d(m_CardNo, 1.0, 1.0);
+			pSDK->n_long_delay(m_CardNo, 10);
+			pSDK->n_fly_return(m_CardNo, 0, 0);
+			break;
+
+		case eRTCCompiledCommandType::SetDefocus:
+			pSDK->n_set_defocus_list(m_CardNo, pCommand->m_nParameter1);
+			break;
+
+		case eRTCCompiledCommandType::SetOIEPIDMode:
+			SetOIEPIDMode((uint32_t)pCommand->m_nParameter1);
+			break;
+
+		case eRTCCompiledCommandType::MeasurementTag:
+			sendOIEMeasurementTag((uint32_t)pCommand->m_nParameter1);
+			break;
+
+		case eRTCCompiledCommandType::CheckLastError:
+			pSDK->checkLastErrorOfCard(m_CardNo);
+			break;
+
+		default:
+			throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDCOMMANDSTREAMCONFIGURATION, "Invalid compiled list command: " + std::to_string((uint32_t)pCommand->m_Type));
+		}
 	}
 
 }
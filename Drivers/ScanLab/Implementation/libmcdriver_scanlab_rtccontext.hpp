@@ -17,6 +17,8 @@ Abstract: This is the class declaration of CRTCContext
 #include "libmcdriver_scanlab_rtcrecordinginstance.hpp"
 #include "libmcdriver_scanlab_nlightafxprofileselector.hpp"
 #include "libmcdriver_scanlab_gpiosequence.hpp"
+#include "libmcdriver_scanlab_rtcstatusmonitor.hpp"
+#include "libmcdriver_scanlab_rtccommandstream.hpp"
 
 // Parent classes
 #include "libmcdriver_scanlab_base.hpp"
@@ -27,6 +29,7 @@ Abstract: This is the class declaration of CRTCContext
 
 // Include custom headers here.
 #include <set>
+#include <chrono>
 
 namespace LibMCDriver_ScanLab {
 namespace Impl {
@@ -39,6 +42,14 @@ typedef struct _sMeasurementTagInfo {
 	uint32_t m_nCurrentVectorID;
 } sMeasurementTagInfo;
 
+typedef struct _sListStreamingStatistics {
+	uint32_t m_nChunkCount;
+	uint32_t m_nStarvationCount;
+	double m_dFirstListStartInMilliseconds;
+	double m_dIdleTimeInMilliseconds;
+	double m_dLoadTimeInMilliseconds;
+} sListStreamingStatistics;
+
 /*************************************************************************************************************************
  Class declaration of CRTCContext 
 **************************************************************************************************************************/
@@ -127,6 +138,24 @@ protected:
 	std::map<std::string, PGPIOSequenceInstance> m_GPIOSequences;
 
 	PNLightAFXProfileSelectorInstance m_pNLightAFXSelectorInstance;
+
+	uint32_t m_nListSizeA;
+	uint32_t m_nListSizeB;
+
+	// Double buffered list streaming state. Lists 1 and 2 are alternately filled and executed.
+	bool m_bListStreamingActive;
+	uint32_t m_nListStreamingChunkSize;
+	uint32_t m_nListStreamingListIndex;
+	uint32_t m_nListStreamingListStart;
+	uint32_t m_nListStreamingCommandCount;
+	uint32_t m_nListStreamingPendingList;
+	bool m_bListStreamingExecutionStarted;
+	std::chrono::steady_clock::time_point m_ListStreamingStartTime;
+	std::chrono::steady_clock::time_point m_ListStreamingLastBusyTime;
+	sListStreamingStatistics m_ListStreamingStatistics;
+
+	// Compiles layers in addLayerToListEx if set.
+	PRTCCommandStreamCompiler m_pCommandStreamCompiler;
 	
 	void writeJumpSpeed (float jumpSpeed);
 
@@ -146,6 +175,12 @@ protected:
 
 	void addLayerToListEx(LibMCEnv::PToolpathLayer pLayer, eOIERecordingMode oieRecordingMode, uint32_t nAttributeFilterID, int64_t nAttributeFilterValue, float fMaxLaserPowerInWatts, bool bFailIfNonAssignedDataExists);
 
+	void addLayerSegmentsToListEx(LibMCEnv::PToolpathLayer pLayer, uint32_t nAttributeFilterID, int64_t nAttributeFilterValue, float fMaxLaserPowerInWatts, bool bFailIfNonAssignedDataExists);
+
+	// Writes a compiled layer with the same list commands as addLayerSegmentsToListEx.
+	void replayCompiledLayer(PRTCCompiledLayer pCompiledLayer);
+	void replayCompiledCommands(const sRTCCompiledCommand* pCommands, uint64_t nCommandCount);
+
 	void updateLaserField(double dMinXInMM, double dMaxXInMM, double dMinYInMM, double dMaxYInMM);
 	
 	void clearLaserField();
@@ -159,6 +194,11 @@ protected:
 	// Calls the SetTriggerX Call that is necessary for the specific OIE board
 	void callSetTriggerOIE(uint32_t nPeriod);
 
+	// Called for every streamed list command. Closes the current list once the chunk is full.
+	void countListStreamingCommand();
+	void closeStreamingList(bool bIsLastList);
+	void updateListStreamingStatus();
+
 public:
 
 	CRTCContext(PRTCContextOwnerData pOwnerData, uint32_t nCardNo, bool bIsNetwork, LibMCEnv::PDriverEnvironment pDriverEnvironment);
@@ -179,6 +219,22 @@ public:
 	// Laser Index Management should be implemented in the Driver.
 	void setLaserIndex (const uint32_t nLaserIndex);
 
+	// List streaming replaces SetStartList/SetEndOfList/ExecuteList for a single layer.
+	// Marking starts as soon as the first chunk has been loaded.
+	void beginListStreaming(uint32_t nChunkSize);
+	void finishListStreaming();
+	void abortListStreaming();
+	bool isListStreaming();
+	sListStreamingStatistics getListStreamingStatistics();
+
+	// Creates a monitor that waits for the end of list execution on a separate thread.
+	PRTCStatusMonitorInstance createStatusMonitor(uint32_t nMinPollIntervalInMicroseconds, uint32_t nMaxPollIntervalInMicroseconds);
+
+	// Counters of the emulated card, see CDriver_ScanLab::LoadEmulatedSDK.
+	bool isEmulated();
+	void resetEmulationStatistics();
+	sScanLabEmulationStatistics getEmulationStatistics();
+
 	void LoadFirmware(const LibMCDriver_ScanLab_uint64 nFirmwareDataBufferSize, const LibMCDriver_ScanLab_uint8* pFirmwareDataBuffer, const LibMCDriver_ScanLab_uint64 nFPGADataBufferSize, const LibMCDriver_ScanLab_uint8* pFPGADataBuffer, const LibMCDriver_ScanLab_uint64 nAuxiliaryDataBufferSize, const LibMCDriver_ScanLab_uint8* pAuxiliaryDataBuffer);
 
 	void LoadCorrectionFile(const LibMCDriver_ScanLab_uint64 nCorrectionFileBufferSize, const LibMCDriver_ScanLab_uint8* pCorrectionFileBuffer, const LibMCDriver_ScanLab_uint32 nTableNumber, const LibMCDriver_ScanLab_uint32 nDimension);
@@ -405,6 +461,20 @@ public:
 
 	void DisableLineSubdivision() override;
 
+	void EnableCommandStreamCompilation(const LibMCDriver_ScanLab_uint32 nThreadCount, const LibMCDriver_ScanLab_uint32 nMaxCachedLayers) override;
+
+	void DisableCommandStreamCompilation() override;
+
+	bool CommandStreamCompilationIsEnabled() override;
+
+	void ClearCompiledLayerCache() override;
+
+	void GetCommandStreamStatistics(LibMCDriver_ScanLab_uint32 & nCompiledLayerCount, LibMCDriver_ScanLab_uint32 & nCacheHitCount, LibMCDriver_ScanLab_uint64 & nLastCommandCount, LibMCDriver_ScanLab_double & dLastCompileTime) override;
+
+	void ResetEmulationStatistics() override;
+
+	void GetEmulationStatistics(LibMCDriver_ScanLab_uint64 & nListCommandCount, LibMCDriver_ScanLab_uint64 & nListCommandHash, LibMCDriver_ScanLab_double & dMarkTime, LibMCDriver_ScanLab_double & dJumpTime, LibMCDriver_ScanLab_double & dExecutionTime) override;
+
 	LibMCDriver_ScanLab_int32 ReadMultiMCBSP(const LibMCDriver_ScanLab_uint32 nRegisterNo) override;
 
 	IUARTConnection* CreateUARTConnection(const LibMCDriver_ScanLab_uint32 nDesiredBaudRate) override;
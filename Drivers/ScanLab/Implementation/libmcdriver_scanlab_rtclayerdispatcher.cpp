@@ -0,0 +1,201 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class definition of CRTCLayerDispatcher
+
+*/
+
+#include "libmcdriver_scanlab_rtclayerdispatcher.hpp"
+#include "libmcdriver_scanlab_interfaceexception.hpp"
+#include "common_parallelblocks.hpp"
+
+#include <algorithm>
+
+using namespace LibMCDriver_ScanLab;
+using namespace LibMCDriver_ScanLab::Impl;
+
+CRTCStartBarrier::CRTCStartBarrier(uint32_t nWorkerCount)
+	: m_nPendingCount (nWorkerCount), m_bCancelled (false)
+{
+
+}
+
+bool CRTCStartBarrier::arriveAndWait()
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	if (m_nPendingCount > 0)
+		m_nPendingCount--;
+
+	if (m_nPendingCount == 0) {
+		m_Released.notify_all();
+	}
+	else {
+		m_Released.wait(lock, [this] { return (m_nPendingCount == 0) || m_bCancelled; });
+	}
+
+	return !m_bCancelled;
+}
+
+void CRTCStartBarrier::cancel()
+{
+	std::lock_guard<std::mutex> lockGuard(m_Mutex);
+	m_bCancelled = true;
+	m_Released.notify_all();
+}
+
+
+CRTCLayerDispatcher::CRTCLayerDispatcher()
+	: m_DispatchStartTime (std::chrono::steady_clock::now ())
+{
+
+}
+
+CRTCLayerDispatcher::~CRTCLayerDispatcher()
+{
+
+}
+
+void CRTCLayerDispatcher::addCard(act_managed_ptr<IRTCContext> pRTCContext, LibMCEnv::PToolpathLayer pLayer)
+{
+	if (pRTCContext.get() == nullptr)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+	if (pLayer.get() == nullptr)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	auto creationTime = std::chrono::steady_clock::now();
+	sRTCLayerDispatchCard card = { pRTCContext, pLayer, false, creationTime, creationTime, creationTime, creationTime };
+	m_Cards.push_back(card);
+}
+
+void CRTCLayerDispatcher::buildAndStartLists(bool bFailIfNonAssignedDataExists)
+{
+	uint32_t nCardCount = (uint32_t)m_Cards.size();
+	if (nCardCount == 0)
+		return;
+
+	// Every card needs a thread of its own, as all of them wait for each other at the start barrier.
+	if (nCardCount > PARALLELBLOCKS_MAXTHREADCOUNT)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	CRTCStartBarrier startBarrier(nCardCount);
+
+	m_DispatchStartTime = std::chrono::steady_clock::now();
+
+	AMCCommon::CParallelBlocks::processBlocks(nCardCount, nCardCount, 1, [this, &startBarrier, bFailIfNonAssignedDataExists](uint32_t nBlockIndex, size_t nFirstCard, size_t nBlockCardCount) {
+		auto& card = m_Cards.at(nFirstCard);
+		try {
+			card.m_BuildStartTime = std::chrono::steady_clock::now();
+
+			card.m_pRTCContext->SetStartList(1, 0);
+			card.m_pRTCContext->AddLayerToList(card.m_pLayer, bFailIfNonAssignedDataExists);
+			card.m_pRTCContext->SetEndOfList();
+
+			card.m_BuildEndTime = std::chrono::steady_clock::now();
+			card.m_ExecutionStartTime = card.m_BuildEndTime;
+
+			if (startBarrier.arriveAndWait()) {
+				card.m_ExecutionStartTime = std::chrono::steady_clock::now();
+				card.m_pRTCContext->ExecuteList(1, 0);
+				card.m_bIsExecuting = true;
+			}
+		}
+		catch (...) {
+			card.m_ExecutionEndTime = card.m_ExecutionStartTime;
+			startBarrier.cancel();
+			throw;
+		}
+		card.m_ExecutionEndTime = card.m_ExecutionStartTime;
+	});
+}
+
+bool CRTCLayerDispatcher::updateExecutionStatus()
+{
+	bool bAnyCardIsBusy = false;
+	for (auto& card : m_Cards) {
+		if (card.m_bIsExecuting) {
+			bool bBusy = true;
+			uint32_t nPosition = 0;
+			card.m_pRTCContext->GetStatus(bBusy, nPosition);
+
+			if (bBusy) {
+				bAnyCardIsBusy = true;
+			}
+			else {
+				card.m_ExecutionEndTime = std::chrono::steady_clock::now();
+				card.m_bIsExecuting = false;
+			}
+		}
+	}
+
+	return bAnyCardIsBusy;
+}
+
+uint32_t CRTCLayerDispatcher::getCardCount()
+{
+	return (uint32_t)m_Cards.size();
+}
+
+sRTCLayerDispatchStatistics CRTCLayerDispatcher::getCardStatistics(uint32_t nCardIndex)
+{
+	if (nCardIndex >= m_Cards.size())
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	auto& card = m_Cards.at(nCardIndex);
+
+	sRTCLayerDispatchStatistics statistics;
+	statistics.m_dListBuildTimeInMilliseconds = std::chrono::duration<double, std::milli>(card.m_BuildEndTime - card.m_BuildStartTime).count();
+	statistics.m_dStartDelayInMilliseconds = std::chrono::duration<double, std::milli>(card.m_ExecutionStartTime - m_DispatchStartTime).count();
+	statistics.m_dExecutionTimeInMilliseconds = std::chrono::duration<double, std::milli>(card.m_ExecutionEndTime - card.m_ExecutionStartTime).count();
+
+	return statistics;
+}
+
+double CRTCLayerDispatcher::getStartSkewInMilliseconds()
+{
+	if (m_Cards.empty())
+		return 0.0;
+
+	auto firstStart = m_Cards.front().m_ExecutionStartTime;
+	auto lastStart = firstStart;
+	for (auto& card : m_Cards) {
+		firstStart = std::min(firstStart, card.m_ExecutionStartTime);
+		lastStart = std::max(lastStart, card.m_ExecutionStartTime);
+	}
+
+	return std::chrono::duration<double, std::milli>(lastStart - firstStart).count();
+}
+
+double CRTCLayerDispatcher::getLayerLatencyInMilliseconds()
+{
+	auto lastEnd = m_DispatchStartTime;
+	for (auto& card : m_Cards)
+		lastEnd = std::max(lastEnd, card.m_ExecutionEndTime);
+
+	return std::chrono::duration<double, std::milli>(lastEnd - m_DispatchStartTime).count();
+}
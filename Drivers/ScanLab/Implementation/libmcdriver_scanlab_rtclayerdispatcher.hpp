@@ -0,0 +1,132 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class declaration of CRTCLayerDispatcher
+
+*/
+
+
+#ifndef __LIBMCDRIVER_SCANLAB_RTCLAYERDISPATCHER
+#define __LIBMCDRIVER_SCANLAB_RTCLAYERDISPATCHER
+
+#include "libmcdriver_scanlab_interfaces.hpp"
+#include "libmcdriver_scanlab_managedptr.hpp"
+
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+namespace LibMCDriver_ScanLab {
+namespace Impl {
+
+typedef struct _sRTCLayerDispatchStatistics {
+	double m_dListBuildTimeInMilliseconds;
+	double m_dStartDelayInMilliseconds;
+	double m_dExecutionTimeInMilliseconds;
+} sRTCLayerDispatchStatistics;
+
+/*************************************************************************************************************************
+ Class declaration of CRTCStartBarrier 
+**************************************************************************************************************************/
+
+// Releases all card workers at once, as soon as the last list is complete. A failing worker cancels the barrier,
+// so that no card starts with an incomplete layer.
+class CRTCStartBarrier {
+private:
+
+	std::mutex m_Mutex;
+	std::condition_variable m_Released;
+	uint32_t m_nPendingCount;
+	bool m_bCancelled;
+
+public:
+
+	CRTCStartBarrier(uint32_t nWorkerCount);
+
+	// Returns false if the barrier has been cancelled.
+	bool arriveAndWait();
+
+	void cancel();
+
+};
+
+/*************************************************************************************************************************
+ Class declaration of CRTCLayerDispatcher 
+**************************************************************************************************************************/
+
+// Draws one layer on several RTC cards. Each card builds its list in its own worker thread. The RTC DLL allows
+// parallel calls as long as each thread addresses a different card. The cards may share one toolpath layer instance,
+// as the list export only reads the layer.
+class CRTCLayerDispatcher {
+private:
+
+	typedef struct _sRTCLayerDispatchCard {
+		act_managed_ptr<IRTCContext> m_pRTCContext;
+		LibMCEnv::PToolpathLayer m_pLayer;
+		bool m_bIsExecuting;
+		std::chrono::steady_clock::time_point m_BuildStartTime;
+		std::chrono::steady_clock::time_point m_BuildEndTime;
+		std::chrono::steady_clock::time_point m_ExecutionStartTime;
+		std::chrono::steady_clock::time_point m_ExecutionEndTime;
+	} sRTCLayerDispatchCard;
+
+	std::vector<sRTCLayerDispatchCard> m_Cards;
+
+	std::chrono::steady_clock::time_point m_DispatchStartTime;
+
+public:
+
+	CRTCLayerDispatcher();
+
+	virtual ~CRTCLayerDispatcher();
+
+	void addCard(act_managed_ptr<IRTCContext> pRTCContext, LibMCEnv::PToolpathLayer pLayer);
+
+	// Builds List 1 of all cards in parallel and starts them together. Rethrows the first error of a worker.
+	// At most PARALLELBLOCKS_MAXTHREADCOUNT cards are supported, as every card needs its own thread.
+	void buildAndStartLists(bool bFailIfNonAssignedDataExists);
+
+	// Polls the status of all cards that have not finished yet. Returns true if any card is still busy.
+	bool updateExecutionStatus();
+
+	uint32_t getCardCount();
+
+	sRTCLayerDispatchStatistics getCardStatistics(uint32_t nCardIndex);
+
+	double getStartSkewInMilliseconds();
+
+	double getLayerLatencyInMilliseconds();
+
+};
+
+} // namespace Impl
+} // namespace LibMCDriver_ScanLab
+
+#endif // __LIBMCDRIVER_SCANLAB_RTCLAYERDISPATCHER
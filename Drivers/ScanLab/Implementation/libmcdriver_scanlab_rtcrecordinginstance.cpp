@@ -33,10 +33,13 @@ Abstract: This is a stub class definition of CRTCRecording
 
 #include "libmcdriver_scanlab_rtcrecordinginstance.hpp"
 #include "libmcdriver_scanlab_interfaceexception.hpp"
+#include "common_parallelblocks.hpp"
 
 using namespace LibMCDriver_ScanLab::Impl;
 
 #include <thread>
+#include <algorithm>
+#include <cstring>
 
 CRTCRecordingChunk::CRTCRecordingChunk(uint64_t nStartEntryIndex, size_t nChunkSize)
 	: m_nStartEntryIndex (nStartEntryIndex), m_nWriteOffset (0)
@@ -74,6 +77,11 @@ std::vector<int32_t>& CRTCRecordingChunk::getBuffer()
 	return m_Buffer;
 }
 
+size_t CRTCRecordingChunk::getEntryCount()
+{
+	return m_nWriteOffset;
+}
+
 int32_t CRTCRecordingChunk::getRecordEntry(uint64_t nAbsoluteEntryIndex)
 {
 	if (nAbsoluteEntryIndex < m_nStartEntryIndex)
@@ -83,7 +91,7 @@ int32_t CRTCRecordingChunk::getRecordEntry(uint64_t nAbsoluteEntryIndex)
 	if (nLocalIndex >= m_Buffer.size ())
 		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_CHUNKENTRYINDEXOUTOFBOUNDS);
 
-	return m_Buffer.at (nAbsoluteEntryIndex);
+	return m_Buffer.at (nLocalIndex);
 }
 
 
@@ -303,24 +311,12 @@ void CRTCRecordingChannel::getAllRecordEntries(uint64_t nValuesBufferSize, uint6
 		if (m_nEntryCount > nValuesBufferSize)
 			throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_BUFFERTOOSMALL);
 
-		uint64_t nIndex = 0;
 		int32_t* pTarget = pValuesBuffer;
 		for (auto pChunk : m_Chunks) {
-			if (nIndex < m_nEntryCount) {
-
-
-				auto& buffer = pChunk->getBuffer();
-				for (int32_t value : buffer) {
-					*pTarget = value;
-					nIndex++;
-					pTarget++;
-
-					if (nIndex >= m_nEntryCount)
-						break;
-				}
-			} else {
-				break;
-			}
+			size_t nEntryCount = pChunk->getEntryCount();
+			if (nEntryCount > 0)
+				memcpy(pTarget, pChunk->getBuffer().data(), nEntryCount * sizeof(int32_t));
+			pTarget += nEntryCount;
 		}
 
 	}
@@ -337,16 +333,13 @@ void CRTCRecordingChannel::getAllScaledRecordEntries(uint64_t nValuesBufferSize,
 		if (m_nEntryCount > nValuesBufferSize)
 			throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_BUFFERTOOSMALL);
 
-		uint64_t nIndex = 0;
 		double* pTarget = pValuesBuffer;
 		for (auto pChunk : m_Chunks) {
-			auto& buffer = pChunk->getBuffer();
-			for (int32_t value : buffer) {
-				*pTarget = ((double)value * dScaleFactor) + dOffset;
-				nIndex++;
-				pTarget++;
-			}
-
+			size_t nEntryCount = pChunk->getEntryCount();
+			const int32_t* pSource = pChunk->getBuffer().data();
+			for (size_t nIndex = 0; nIndex < nEntryCount; nIndex++)
+				pTarget[nIndex] = ((double)pSource[nIndex] * dScaleFactor) + dOffset;
+			pTarget += nEntryCount;
 		}
 
 	}
@@ -545,6 +538,31 @@ int32_t * CRTCRecordingChannel::reserveDataBuffer(uint32_t nCount, uint32_t& nEn
 
 }
 
+size_t CRTCRecordingChannel::getChunkCount()
+{
+	return m_Chunks.size();
+}
+
+PRTCRecordingChunk CRTCRecordingChannel::getChunk(size_t nChunkIndex)
+{
+	if (nChunkIndex >= m_Chunks.size())
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDCHUNKINDEX);
+
+	return m_Chunks.at(nChunkIndex);
+}
+
+void CRTCRecordingChannel::appendToScaledDataTableColumn(LibMCEnv::PDataTable pDataTable, const std::string& sColumnIdentifier)
+{
+	if (pDataTable.get() == nullptr)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	for (auto pChunk : m_Chunks) {
+		size_t nEntryCount = pChunk->getEntryCount();
+		if (nEntryCount > 0)
+			pDataTable->AppendScaledInt32ColumnValues(sColumnIdentifier, LibMCEnv::CInputVector<int32_t>(pChunk->getBuffer().data(), nEntryCount));
+	}
+}
+
 void CRTCRecordingInstance::removeChannel(const std::string& sChannelName)
 {
 	std::string sNormalizedChannelName = normalizeChannelName(sChannelName);
@@ -747,13 +765,21 @@ void CRTCRecordingInstance::addRecordsToDataTable(const std::string& sChannelNam
 
 	uint64_t nRecordCount = pChannel->getRecordCount();
 	if (nRecordCount > 0) {
-		std::vector<int32_t> buffer;
-		uint64_t nNeededEntries = 0;
 
-		buffer.resize(nRecordCount);
-		pChannel->getAllRecordEntries(nRecordCount, &nNeededEntries, buffer.data());
+		// Recordings that fit into one chunk are passed without an intermediate copy
+		if (pChannel->getChunkCount() == 1) {
+			auto pChunk = pChannel->getChunk(0);
+			pDataTable->SetInt32ColumnValues(sColumnIdentifier, LibMCEnv::CInputVector<int32_t>(pChunk->getBuffer().data(), pChunk->getEntryCount()));
+		}
+		else {
+			std::vector<int32_t> buffer;
+			uint64_t nNeededEntries = 0;
+
+			buffer.resize(nRecordCount);
+			pChannel->getAllRecordEntries(nRecordCount, &nNeededEntries, buffer.data());
 
-		pDataTable->SetInt32ColumnValues(sColumnIdentifier, buffer);
+			pDataTable->SetInt32ColumnValues(sColumnIdentifier, buffer);
+		}
 	}
 
 
@@ -765,18 +791,10 @@ void CRTCRecordingInstance::addScaledRecordsToDataTable(const std::string& sChan
 		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
 
 	auto pChannel = findChannel(sChannelName, true);
-	pDataTable->AddColumn(sColumnIdentifier, sColumnDescription, LibMCEnv::eDataTableColumnType::DoubleColumn);
-
-	uint64_t nRecordCount = pChannel->getRecordCount();
-	if (nRecordCount > 0) {
-		std::vector<double> buffer;
-		uint64_t nNeededEntries = 0;
 
-		buffer.resize(nRecordCount);
-		pChannel->getAllScaledRecordEntries(nRecordCount, &nNeededEntries, buffer.data(), dScaleFactor, dOffset);
-
-		pDataTable->SetDoubleColumnValues(sColumnIdentifier, buffer);
-	}
+	// The raw values are scaled by the data table, when the column is accessed
+	pDataTable->AddScaledInt32Column(sColumnIdentifier, sColumnDescription, dScaleFactor, dOffset);
+	pChannel->appendToScaledDataTableColumn(pDataTable, sColumnIdentifier);
 
 }
 
@@ -806,43 +824,13 @@ void CRTCRecordingInstance::addBacktransformedXYPositionsToDataTable(LibMCEnv::P
 	if (pChannelY.get() == nullptr)
 		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELYNOTRECORDED);
 
-	pDataTable->AddColumn(sColumnIdentifierX, sColumnDescriptionX, LibMCEnv::eDataTableColumnType::DoubleColumn);
-	pDataTable->AddColumn(sColumnIdentifierY, sColumnDescriptionY, LibMCEnv::eDataTableColumnType::DoubleColumn);
-
-	uint64_t nRecordCount = pChannelX->getRecordCount();
-	if (nRecordCount != pChannelY->getRecordCount())
+	if (pChannelX->getRecordCount() != pChannelY->getRecordCount())
 		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELXANDYRECORDCOUNTMISMATCH);
 
-	if (nRecordCount > 0) {
-		std::vector<int32_t> bufferX;
-		std::vector<int32_t> bufferY;
-		uint64_t nNeededEntries = 0;
-
-		bufferX.resize(nRecordCount);
-		pChannelX->getAllRecordEntries(nRecordCount, &nNeededEntries, bufferX.data());
-		
-		bufferY.resize(nRecordCount);
-		pChannelY->getAllRecordEntries(nRecordCount, &nNeededEntries, bufferY.data());
-
-		std::vector<double> backtransformedX;
-		std::vector<double> backtransformedY;
-
-		backtransformedX.resize(nRecordCount);
-		backtransformedY.resize(nRecordCount);
-
-		for (uint64_t nIndex = 0; nIndex < nRecordCount; nIndex++) {
-			int32_t nX = bufferX.at(nIndex);
-			int32_t nY = bufferY.at(nIndex);
-			m_pSDK->checkError(m_pSDK->transform(&nX, &nY, m_HeadTransform.data(), 0));
-
-			backtransformedX.at(nIndex) = (double)nX / m_dXYCorrectionFactor;
-			backtransformedY.at(nIndex) = (double)nY / m_dXYCorrectionFactor;
-		}
-
-		pDataTable->SetDoubleColumnValues(sColumnIdentifierX, backtransformedX);
-		pDataTable->SetDoubleColumnValues(sColumnIdentifierY, backtransformedY);
-	}
+	pDataTable->AddScaledInt32Column(sColumnIdentifierX, sColumnDescriptionX, 1.0 / m_dXYCorrectionFactor, 0.0);
+	pDataTable->AddScaledInt32Column(sColumnIdentifierY, sColumnDescriptionY, 1.0 / m_dXYCorrectionFactor, 0.0);
 
+	appendBacktransformedChannels(pChannelX.get(), pChannelY.get(), 0, pDataTable, sColumnIdentifierX, sColumnIdentifierY);
 
 }
 
@@ -884,32 +872,9 @@ void CRTCRecordingInstance::addBacktransformedZPositionToDataTable(LibMCEnv::PDa
 	if (pChannelZ.get() == nullptr)
 		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELZNOTRECORDED);
 
-	pDataTable->AddColumn(sColumnIdentifierZ, sColumnDescriptionZ, LibMCEnv::eDataTableColumnType::DoubleColumn);
-
-	uint64_t nRecordCount = pChannelZ->getRecordCount();
-
-	if (nRecordCount > 0) {
-		std::vector<int32_t> bufferZ;
-		uint64_t nNeededEntries = 0;
-
-		bufferZ.resize(nRecordCount);
-		pChannelZ->getAllRecordEntries(nRecordCount, &nNeededEntries, bufferZ.data());
-
-		std::vector<double> backtransformedZ;
-
-		backtransformedZ.resize(nRecordCount);
-
-		for (uint64_t nIndex = 0; nIndex < nRecordCount; nIndex++) {
-			int32_t nZ = bufferZ.at(nIndex);
-			int32_t nDummy = 0;
-			m_pSDK->checkError(m_pSDK->transform(&nZ, &nDummy, m_HeadTransform.data(), 1));
-
-			backtransformedZ.at(nIndex) = (double)nZ / m_dZCorrectionFactor;
-		}
-
-		pDataTable->SetDoubleColumnValues(sColumnIdentifierZ, backtransformedZ);
-	}
+	pDataTable->AddScaledInt32Column(sColumnIdentifierZ, sColumnDescriptionZ, 1.0 / m_dZCorrectionFactor, 0.0);
 
+	appendBacktransformedChannels(pChannelZ.get(), nullptr, 1, pDataTable, sColumnIdentifierZ, "");
 
 }
 
@@ -950,42 +915,94 @@ void CRTCRecordingInstance::addTargetPositionsToDataTable(LibMCEnv::PDataTable p
 	if (pChannelY.get() == nullptr)
 		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELYNOTRECORDED);
 
-	pDataTable->AddColumn(sColumnIdentifierX, sColumnDescriptionX, LibMCEnv::eDataTableColumnType::DoubleColumn);
-	pDataTable->AddColumn(sColumnIdentifierY, sColumnDescriptionY, LibMCEnv::eDataTableColumnType::DoubleColumn);
-
-	uint64_t nRecordCount = pChannelX->getRecordCount();
-	if (nRecordCount != pChannelY->getRecordCount())
+	if (pChannelX->getRecordCount() != pChannelY->getRecordCount())
 		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELXANDYRECORDCOUNTMISMATCH);
 
-	if (nRecordCount > 0) {
-		std::vector<int32_t> bufferX;
-		std::vector<int32_t> bufferY;
-		uint64_t nNeededEntries = 0;
+	pDataTable->AddScaledInt32Column(sColumnIdentifierX, sColumnDescriptionX, 1.0 / m_dXYCorrectionFactor, 0.0);
+	pDataTable->AddScaledInt32Column(sColumnIdentifierY, sColumnDescriptionY, 1.0 / m_dXYCorrectionFactor, 0.0);
+
+	pChannelX->appendToScaledDataTableColumn(pDataTable, sColumnIdentifierX);
+	pChannelY->appendToScaledDataTableColumn(pDataTable, sColumnIdentifierY);
 
-		bufferX.resize(nRecordCount);
-		pChannelX->getAllRecordEntries(nRecordCount, &nNeededEntries, bufferX.data());
+}
+
+void CRTCRecordingInstance::appendBacktransformedChannels(CRTCRecordingChannel* pChannel1, CRTCRecordingChannel* pChannel2, uint32_t nTransformCode, LibMCEnv::PDataTable pDataTable, const std::string& sColumnIdentifier1, const std::string& sColumnIdentifier2)
+{
+	if ((pChannel1 == nullptr) || (pDataTable.get() == nullptr))
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
 
-		bufferY.resize(nRecordCount);
-		pChannelY->getAllRecordEntries(nRecordCount, &nNeededEntries, bufferY.data());
+	struct sBacktransformBlock {
+		const int32_t* m_pSource1;
+		const int32_t* m_pSource2;
+		int32_t* m_pTarget1;
+		int32_t* m_pTarget2;
+		size_t m_nEntryCount;
+	};
+
+	// All channels are read in the same blocks, so their chunks have the same entry counts.
+	size_t nChunkCount = pChannel1->getChunkCount();
+	if ((pChannel2 != nullptr) && (pChannel2->getChunkCount() != nChunkCount))
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELXANDYRECORDCOUNTMISMATCH);
 
-		std::vector<double> coordXinmm;
-		std::vector<double> coordYinmm;
+	std::vector<std::vector<int32_t>> Results1(nChunkCount);
+	std::vector<std::vector<int32_t>> Results2(nChunkCount);
+	std::vector<sBacktransformBlock> Blocks;
 
-		coordXinmm.resize(nRecordCount);
-		coordYinmm.resize(nRecordCount);
+	for (size_t nChunkIndex = 0; nChunkIndex < nChunkCount; nChunkIndex++) {
+		auto pChunk1 = pChannel1->getChunk(nChunkIndex);
+		size_t nEntryCount = pChunk1->getEntryCount();
+		const int32_t* pSource2 = nullptr;
 
-		for (uint64_t nIndex = 0; nIndex < nRecordCount; nIndex++) {
-			int32_t nX = bufferX.at(nIndex);
-			int32_t nY = bufferY.at(nIndex);
+		Results1[nChunkIndex].resize(nEntryCount);
+		if (pChannel2 != nullptr) {
+			auto pChunk2 = pChannel2->getChunk(nChunkIndex);
+			if (pChunk2->getEntryCount() != nEntryCount)
+				throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELXANDYRECORDCOUNTMISMATCH);
 
-			coordXinmm.at(nIndex) = (double)nX / m_dXYCorrectionFactor;
-			coordYinmm.at(nIndex) = (double)nY / m_dXYCorrectionFactor;
+			pSource2 = pChunk2->getBuffer().data();
+			Results2[nChunkIndex].resize(nEntryCount);
 		}
 
-		pDataTable->SetDoubleColumnValues(sColumnIdentifierX, coordXinmm);
-		pDataTable->SetDoubleColumnValues(sColumnIdentifierY, coordYinmm);
+		for (size_t nFirstEntry = 0; nFirstEntry < nEntryCount; nFirstEntry += RTC_BACKTRANSFORM_BLOCKSIZE) {
+			sBacktransformBlock block;
+			block.m_pSource1 = pChunk1->getBuffer().data() + nFirstEntry;
+			block.m_pSource2 = (pSource2 != nullptr) ? (pSource2 + nFirstEntry) : nullptr;
+			block.m_pTarget1 = Results1[nChunkIndex].data() + nFirstEntry;
+			block.m_pTarget2 = (pSource2 != nullptr) ? (Results2[nChunkIndex].data() + nFirstEntry) : nullptr;
+			block.m_nEntryCount = std::min<size_t>(RTC_BACKTRANSFORM_BLOCKSIZE, nEntryCount - nFirstEntry);
+			Blocks.push_back(block);
+		}
 	}
 
-}
+	// The transform only reads the head transform table, so blocks can be processed by any thread.
+	uint8_t* pHeadTransform = m_HeadTransform.data();
+	AMCCommon::CParallelBlocks::processBlocks(0, Blocks.size(), 1, [&](uint32_t nThreadIndex, size_t nFirstBlock, size_t nThreadBlockCount) {
+		for (size_t nBlockIndex = nFirstBlock; nBlockIndex < nFirstBlock + nThreadBlockCount; nBlockIndex++) {
+			auto& block = Blocks[nBlockIndex];
 
+			for (size_t nIndex = 0; nIndex < block.m_nEntryCount; nIndex++) {
+				int32_t nSignal1 = block.m_pSource1[nIndex];
+				int32_t nSignal2 = (block.m_pSource2 != nullptr) ? block.m_pSource2[nIndex] : 0;
+				m_pSDK->checkError(m_pSDK->transform(&nSignal1, &nSignal2, pHeadTransform, nTransformCode));
 
+				block.m_pTarget1[nIndex] = nSignal1;
+				if (block.m_pTarget2 != nullptr)
+					block.m_pTarget2[nIndex] = nSignal2;
+			}
+		}
+	});
+
+	// Every chunk is released as soon as the data table holds its values
+	for (size_t nChunkIndex = 0; nChunkIndex < nChunkCount; nChunkIndex++) {
+		if (!Results1[nChunkIndex].empty())
+			pDataTable->AppendScaledInt32ColumnValues(sColumnIdentifier1, Results1[nChunkIndex]);
+		std::vector<int32_t>().swap(Results1[nChunkIndex]);
+
+		if (pChannel2 != nullptr) {
+			if (!Results2[nChunkIndex].empty())
+				pDataTable->AppendScaledInt32ColumnValues(sColumnIdentifier2, Results2[nChunkIndex]);
+			std::vector<int32_t>().swap(Results2[nChunkIndex]);
+		}
+	}
+
+}
@@ -48,6 +48,8 @@ Abstract: This is the class declaration of CRTCRecording
 #define RTC_CHUNKSIZE_MAX (1024 * 1024 * 16)
 #define RTC_CHUNKSIZE_DEFAULT (1024 * 1024)
 
+#define RTC_BACKTRANSFORM_BLOCKSIZE (64 * 1024)
+
 
 namespace LibMCDriver_ScanLab {
 namespace Impl {
@@ -85,6 +87,9 @@ public:
 
 	std::vector<int32_t> & getBuffer ();
 
+	// Returns the number of entries that have been read into the buffer.
+	size_t getEntryCount();
+
 	int32_t getRecordEntry(uint64_t nAbsoluteEntryIndex);
 
 	bool isFull ();
@@ -134,6 +139,13 @@ public:
 	void getAllScaledRecordEntries(uint64_t nValuesBufferSize, uint64_t* pValuesNeededCount, double* pValuesBuffer, double dScaleFactor, double dOffset);
 
 	int32_t* reserveDataBuffer(uint32_t nCount, uint32_t& nEntriesToRead);
+
+	size_t getChunkCount();
+
+	PRTCRecordingChunk getChunk(size_t nChunkIndex);
+
+	// Appends the entries chunk by chunk to a column that has been added with AddScaledInt32Column.
+	void appendToScaledDataTableColumn(LibMCEnv::PDataTable pDataTable, const std::string& sColumnIdentifier);
 };
 
 
@@ -166,6 +178,10 @@ private:
 
 	CRTCRecordingChannel* findChannel (const std::string & sChannelName, bool bMustExist);
 
+	// Applies the head transform to all entries of one or two channels and appends the results to scaled data table columns.
+	// Blocks of entries are transformed in parallel. pChannel2 may be null for transforms with a single signal.
+	void appendBacktransformedChannels(CRTCRecordingChannel* pChannel1, CRTCRecordingChannel* pChannel2, uint32_t nTransformCode, LibMCEnv::PDataTable pDataTable, const std::string& sColumnIdentifier1, const std::string& sColumnIdentifier2);
+
 public:
 
 	CRTCRecordingInstance(const std::string & sUUID, PScanLabSDK pSDK, uint32_t cardNo, double dXYCorrectionFactor, double dZCorrectionFactor, size_t nChunkSize, bool bEnableScanheadFeedback, bool bEnableBacktransformation);
@@ -0,0 +1,229 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class definition of CRTCStatusMonitorInstance
+
+*/
+
+#include "libmcdriver_scanlab_rtcstatusmonitor.hpp"
+#include "libmcdriver_scanlab_interfaceexception.hpp"
+
+#include <chrono>
+
+using namespace LibMCDriver_ScanLab::Impl;
+
+// Status bits of n_get_status that indicate list execution, see CRTCContext::GetStatus
+#define RTCSTATUSMONITOR_BUSYMASK ((1UL << 0) | (1UL << 7) | (1UL << 15))
+
+/*************************************************************************************************************************
+ Class definition of CRTCStatusMonitorInstance 
+**************************************************************************************************************************/
+
+CRTCStatusMonitorInstance::CRTCStatusMonitorInstance(PScanLabSDK pSDK, uint32_t nCardNo, uint32_t nMinPollIntervalInMicroseconds, uint32_t nMaxPollIntervalInMicroseconds)
+	: m_pSDK (pSDK), 
+	m_nCardNo (nCardNo), 
+	m_nMinPollIntervalInMicroseconds (nMinPollIntervalInMicroseconds), 
+	m_nMaxPollIntervalInMicroseconds (nMaxPollIntervalInMicroseconds),
+	m_nListEndPosition (0),
+	m_bFinished (false),
+	m_bShallStop (false),
+	m_bBusy (false),
+	m_nPosition (0),
+	m_nPollCount (0)
+{
+	if (pSDK.get() == nullptr)
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDPARAM);
+
+	if ((nMinPollIntervalInMicroseconds < RTCSTATUSMONITOR_MINPOLLINTERVAL) || (nMaxPollIntervalInMicroseconds > RTCSTATUSMONITOR_MAXPOLLINTERVAL) || (nMinPollIntervalInMicroseconds > nMaxPollIntervalInMicroseconds))
+		throw ELibMCDriver_ScanLabInterfaceException(LIBMCDRIVER_SCANLAB_ERROR_INVALIDSTATUSMONITORINTERVAL);
+}
+
+CRTCStatusMonitorInstance::~CRTCStatusMonitorInstance()
+{
+	try {
+		stopMonitoring();
+	}
+	catch (...) {
+	}
+}
+
+void CRTCStatusMonitorInstance::startMonitoring(uint32_t nListEndPosition)
+{
+	stopMonitoring();
+
+	{
+		std::lock_guard<std::mutex> stateLock(m_StateMutex);
+		m_nListEndPosition = nListEndPosition;
+		m_bFinished = false;
+		m_bShallStop = false;
+		m_bBusy = true;
+		m_nPosition = 0;
+		m_nPollCount = 0;
+		m_pMonitorException = nullptr;
+	}
+
+	m_MonitorThread = std::thread([this]() {
+		runMonitorThread();
+	});
+}
+
+bool CRTCStatusMonitorInstance::waitForCompletion(uint32_t nTimeoutInMilliseconds)
+{
+	std::unique_lock<std::mutex> stateLock(m_StateMutex);
+	m_StateChanged.wait_for(stateLock, std::chrono::milliseconds(nTimeoutInMilliseconds), [this]() { return m_bFinished; });
+
+	if (m_pMonitorException)
+		std::rethrow_exception(m_pMonitorException);
+
+	return m_bFinished;
+}
+
+void CRTCStatusMonitorInstance::stopMonitoring()
+{
+	{
+		std::lock_guard<std::mutex> stateLock(m_StateMutex);
+		m_bShallStop = true;
+	}
+	m_StateChanged.notify_all();
+
+	if (m_MonitorThread.joinable())
+		m_MonitorThread.join();
+}
+
+std::unique_lock<std::mutex> CRTCStatusMonitorInstance::lockCardAccess()
+{
+	return std::unique_lock<std::mutex>(m_CardAccessMutex);
+}
+
+void CRTCStatusMonitorInstance::getLastStatus(bool& bBusy, uint32_t& nPosition)
+{
+	std::lock_guard<std::mutex> stateLock(m_StateMutex);
+	bBusy = m_bBusy;
+	nPosition = m_nPosition;
+}
+
+uint32_t CRTCStatusMonitorInstance::getPollCount()
+{
+	std::lock_guard<std::mutex> stateLock(m_StateMutex);
+	return m_nPollCount;
+}
+
+void CRTCStatusMonitorInstance::runMonitorThread()
+{
+	try {
+		bool bHasPreviousPosition = false;
+		uint32_t nPreviousPosition = 0;
+		auto previousTime = std::chrono::steady_clock::now();
+		double dPositionsPerMicrosecond = 0.0;
+		uint32_t nPollInterval = m_nMinPollIntervalInMicroseconds;
+
+		while (true) {
+			uint32_t nStatus = 0;
+			uint32_t nPosition = 0;
+			{
+				auto cardLock = lockCardAccess();
+				m_pSDK->n_get_status(m_nCardNo, &nStatus, &nPosition);
+				m_pSDK->checkError(m_pSDK->n_get_last_error(m_nCardNo));
+			}
+			auto currentTime = std::chrono::steady_clock::now();
+			bool bBusy = (nStatus & RTCSTATUSMONITOR_BUSYMASK) != 0;
+
+			{
+				std::lock_guard<std::mutex> stateLock(m_StateMutex);
+				m_bBusy = bBusy;
+				m_nPosition = nPosition;
+				m_nPollCount++;
+				if (!bBusy)
+					m_bFinished = true;
+			}
+
+			if (!bBusy) {
+				m_StateChanged.notify_all();
+				return;
+			}
+
+			// Execution speed in list positions, smoothed over the last polls
+			if (bHasPreviousPosition && (nPosition > nPreviousPosition)) {
+				double dElapsedMicroseconds = std::chrono::duration<double, std::micro>(currentTime - previousTime).count();
+				if (dElapsedMicroseconds > 0.0) {
+					double dCurrentSpeed = (double)(nPosition - nPreviousPosition) / dElapsedMicroseconds;
+					if (dPositionsPerMicrosecond > 0.0)
+						dPositionsPerMicrosecond = 0.5 * (dPositionsPerMicrosecond + dCurrentSpeed);
+					else
+						dPositionsPerMicrosecond = dCurrentSpeed;
+				}
+			}
+
+			if ((!bHasPreviousPosition) || (nPosition != nPreviousPosition)) {
+				nPreviousPosition = nPosition;
+				previousTime = currentTime;
+				bHasPreviousPosition = true;
+			}
+
+			nPollInterval = calculatePollInterval(nPosition, dPositionsPerMicrosecond, nPollInterval);
+
+			std::unique_lock<std::mutex> stateLock(m_StateMutex);
+			if (m_StateChanged.wait_for(stateLock, std::chrono::microseconds(nPollInterval), [this]() { return m_bShallStop; }))
+				return;
+		}
+	}
+	catch (...) {
+		{
+			std::lock_guard<std::mutex> stateLock(m_StateMutex);
+			m_pMonitorException = std::current_exception();
+			m_bFinished = true;
+		}
+		m_StateChanged.notify_all();
+	}
+}
+
+uint32_t CRTCStatusMonitorInstance::calculatePollInterval(uint32_t nPosition, double dPositionsPerMicrosecond, uint32_t nPreviousPollInterval)
+{
+	// Outside of the last list, or just before its end
+	if ((nPosition > m_nListEndPosition) || ((m_nListEndPosition - nPosition) <= RTCSTATUSMONITOR_NEARENDPOSITIONS))
+		return m_nMinPollIntervalInMicroseconds;
+
+	double dInterval;
+	if (dPositionsPerMicrosecond > 0.0) {
+		// Poll at half the estimated remaining time, so that the end is detected with a small delay.
+		double dRemainingMicroseconds = (double)(m_nListEndPosition - nPosition) / dPositionsPerMicrosecond;
+		dInterval = dRemainingMicroseconds * 0.5;
+	}
+	else {
+		// No progress seen yet: back off slowly.
+		dInterval = (double)nPreviousPollInterval * 2.0;
+	}
+
+	if (dInterval < (double)m_nMinPollIntervalInMicroseconds)
+		return m_nMinPollIntervalInMicroseconds;
+	if (dInterval > (double)m_nMaxPollIntervalInMicroseconds)
+		return m_nMaxPollIntervalInMicroseconds;
+
+	return (uint32_t)dInterval;
+}
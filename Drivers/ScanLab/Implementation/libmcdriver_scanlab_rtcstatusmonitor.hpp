@@ -0,0 +1,121 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class declaration of CRTCStatusMonitorInstance
+
+*/
+
+
+#ifndef __LIBMCDRIVER_SCANLAB_RTCSTATUSMONITOR
+#define __LIBMCDRIVER_SCANLAB_RTCSTATUSMONITOR
+
+#include "libmcdriver_scanlab_sdk.hpp"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+
+#define RTCSTATUSMONITOR_MINPOLLINTERVAL 50
+#define RTCSTATUSMONITOR_MAXPOLLINTERVAL 1000000
+#define RTCSTATUSMONITOR_DEFAULTMINPOLLINTERVAL 250
+#define RTCSTATUSMONITOR_DEFAULTMAXPOLLINTERVAL 10000
+
+// Below this number of remaining list positions, the monitor always polls with the minimum interval.
+#define RTCSTATUSMONITOR_NEARENDPOSITIONS 8
+
+namespace LibMCDriver_ScanLab {
+namespace Impl {
+
+
+/*************************************************************************************************************************
+ Class declaration of CRTCStatusMonitorInstance 
+**************************************************************************************************************************/
+
+// Waits for the end of list execution on a separate thread. The poll interval adapts to the
+// estimated remaining execution time, which is extrapolated from the list position progress.
+class CRTCStatusMonitorInstance {
+private:
+
+	PScanLabSDK m_pSDK;
+	uint32_t m_nCardNo;
+
+	uint32_t m_nMinPollIntervalInMicroseconds;
+	uint32_t m_nMaxPollIntervalInMicroseconds;
+	uint32_t m_nListEndPosition;
+
+	// Serializes card access of the monitor thread and the owner
+	std::mutex m_CardAccessMutex;
+
+	std::mutex m_StateMutex;
+	std::condition_variable m_StateChanged;
+	bool m_bFinished;
+	bool m_bShallStop;
+	bool m_bBusy;
+	uint32_t m_nPosition;
+	uint32_t m_nPollCount;
+	std::exception_ptr m_pMonitorException;
+
+	std::thread m_MonitorThread;
+
+	void runMonitorThread();
+
+	uint32_t calculatePollInterval(uint32_t nPosition, double dPositionsPerMicrosecond, uint32_t nPreviousPollInterval);
+
+public:
+
+	CRTCStatusMonitorInstance(PScanLabSDK pSDK, uint32_t nCardNo, uint32_t nMinPollIntervalInMicroseconds, uint32_t nMaxPollIntervalInMicroseconds);
+
+	virtual ~CRTCStatusMonitorInstance();
+
+	// Starts polling. nListEndPosition is the input pointer after the last list command.
+	void startMonitoring(uint32_t nListEndPosition);
+
+	// Returns true if list execution has finished, false if the timeout elapsed before.
+	// Rethrows errors of the monitor thread.
+	bool waitForCompletion(uint32_t nTimeoutInMilliseconds);
+
+	void stopMonitoring();
+
+	// Must be held by the owner for any other card access while monitoring.
+	std::unique_lock<std::mutex> lockCardAccess();
+
+	void getLastStatus(bool& bBusy, uint32_t& nPosition);
+
+	uint32_t getPollCount();
+
+};
+
+typedef std::shared_ptr<CRTCStatusMonitorInstance> PRTCStatusMonitorInstance;
+
+} // namespace Impl
+} // namespace LibMCDriver_ScanLab
+
+#endif // __LIBMCDRIVER_SCANLAB_RTCSTATUSMONITOR
@@ -111,30 +111,28 @@ std::string CScanLabSDKJournal::getVariableSuffix(const std::string& sVariableBa
 }
 
 
-std::string CScanLabSDKJournal::defineDoubleVariable(const std::string& sVariableBaseName)
+std::string CScanLabSDKJournal::defineVariable(const std::string& sTypeName, const std::string& sVariableBaseName)
 {
-	std::string sVariableName = sVariableBaseName + getVariableSuffix (sVariableBaseName);
+	std::lock_guard<std::mutex> lockGuard(m_Mutex);
 
-	writeCLine("double " + sVariableName + ";");
+	std::string sVariableName = sVariableBaseName + getVariableSuffix(sVariableBaseName);
+	m_CStream << sTypeName << " " << sVariableName << ";" << std::endl;
 	return sVariableName;
 }
 
-std::string CScanLabSDKJournal::defineUint32Variable(const std::string& sVariableBaseName)
+std::string CScanLabSDKJournal::defineDoubleVariable(const std::string& sVariableBaseName)
 {
-	std::string sVariableName = sVariableBaseName + getVariableSuffix(sVariableBaseName);
-
-	writeCLine("uint32_t " + sVariableName + ";");
-	return sVariableName;
+	return defineVariable("double", sVariableBaseName);
+}
 
+std::string CScanLabSDKJournal::defineUint32Variable(const std::string& sVariableBaseName)
+{
+	return defineVariable("uint32_t", sVariableBaseName);
 }
 
 std::string CScanLabSDKJournal::defineInt32Variable(const std::string& sVariableBaseName)
 {
-	std::string sVariableName = sVariableBaseName + getVariableSuffix(sVariableBaseName);
-
-	writeCLine("int32_t " + sVariableName + ";");
-	return sVariableName;
-
+	return defineVariable("int32_t", sVariableBaseName);
 }
 
 std::string CScanLabSDKJournal::escapeString(const std::string& sString)
@@ -144,7 +142,7 @@ std::string CScanLabSDKJournal::escapeString(const std::string& sString)
 
 
 CScanLabSDK::CScanLabSDK(const std::string& sDLLNameUTF8)
-	: m_LibraryHandle (nullptr), m_bIsInitialized (false)
+	: m_LibraryHandle (nullptr), m_bIsInitialized (false), m_bIsEmulated (false)
 {
 
 	resetFunctionPtrs();
@@ -207,6 +205,9 @@ CScanLabSDK::CScanLabSDK(const std::string& sDLLNameUTF8)
 	this->ptr_n_set_end_of_list = (PScanLabPtr_n_set_end_of_list)_loadScanLabAddress(hLibrary, "n_set_end_of_list");
 	this->ptr_n_execute_list_pos = (PScanLabPtr_n_execute_list_pos)_loadScanLabAddress(hLibrary, "n_execute_list_pos");
 	this->ptr_n_auto_change_pos = (PScanLabPtr_n_auto_change_pos)_loadScanLabAddress(hLibrary, "n_auto_change_pos");
+	this->ptr_n_load_list = (PScanLabPtr_n_load_list)_loadScanLabAddress(hLibrary, "n_load_list");
+	this->ptr_n_read_status = (PScanLabPtr_n_read_status)_loadScanLabAddress(hLibrary, "n_read_status");
+	this->ptr_n_get_list_space = (PScanLabPtr_n_get_list_space)_loadScanLabAddress(hLibrary, "n_get_list_space");
 	this->ptr_n_set_scanner_delays = (PScanLabPtr_n_set_scanner_delays)_loadScanLabAddress(hLibrary, "n_set_scanner_delays");
 	this->ptr_n_set_mark_speed = (PScanLabPtr_n_set_mark_speed)_loadScanLabAddress(hLibrary, "n_set_mark_speed");
 	this->ptr_n_set_jump_speed = (PScanLabPtr_n_set_jump_speed)_loadScanLabAddress(hLibrary, "n_set_jump_speed");
@@ -333,6 +334,13 @@ CScanLabSDK::CScanLabSDK(const std::string& sDLLNameUTF8)
 }
 
 
+CScanLabSDK::CScanLabSDK(uint32_t nEmulatedSerialNumber)
+	: m_bIsInitialized(false), m_bIsEmulated(false), m_LibraryHandle(nullptr)
+{
+	resetFunctionPtrs();
+	bindEmulation(nEmulatedSerialNumber);
+}
+
 CScanLabSDK::~CScanLabSDK()
 {
 
@@ -428,6 +436,9 @@ void CScanLabSDK::resetFunctionPtrs()
 	ptr_n_set_end_of_list = nullptr;
 	ptr_n_execute_list_pos = nullptr;
 	ptr_n_auto_change_pos = nullptr;
+	ptr_n_load_list = nullptr;
+	ptr_n_read_status = nullptr;
+	ptr_n_get_list_space = nullptr;
 	ptr_n_set_scanner_delays = nullptr;
 	ptr_n_set_mark_speed = nullptr;
 	ptr_n_set_jump_speed = nullptr;
@@ -815,6 +826,30 @@ void CScanLabSDK::n_auto_change_pos(uint32_t nCardNo, uint32_t nPos)
 	ptr_n_auto_change_pos(nCardNo, nPos);
 }
 
+uint32_t CScanLabSDK::n_load_list(uint32_t nCardNo, uint32_t nListNo, uint32_t nPos)
+{
+	if (m_pLogJournal.get() != nullptr)
+		m_pLogJournal->logCall("n_load_list", std::to_string(nCardNo) + ", " + std::to_string(nListNo) + ", " + std::to_string(nPos));
+
+	return ptr_n_load_list(nCardNo, nListNo, nPos);
+}
+
+uint32_t CScanLabSDK::n_read_status(uint32_t nCardNo)
+{
+	if (m_pLogJournal.get() != nullptr)
+		m_pLogJournal->logCall("n_read_status", std::to_string(nCardNo));
+
+	return ptr_n_read_status(nCardNo);
+}
+
+uint32_t CScanLabSDK::n_get_list_space(uint32_t nCardNo)
+{
+	if (m_pLogJournal.get() != nullptr)
+		m_pLogJournal->logCall("n_get_list_space", std::to_string(nCardNo));
+
+	return ptr_n_get_list_space(nCardNo);
+}
+
 void CScanLabSDK::n_set_scanner_delays(uint32_t nCardNo, uint32_t nJump, uint32_t nMark, uint32_t nPolygon)
 {
 	if (m_pLogJournal.get() != nullptr)
@@ -31,6 +31,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define __LIBMCDRIVER_SCANLAB_SDK
 
 #include "libmcdriver_scanlab_types.hpp"
+#include "libmcdriver_scanlab_sdkemulation.hpp"
 
 #include <memory>
 #include <map>
@@ -94,6 +95,9 @@ namespace LibMCDriver_ScanLab {
 		typedef void(SCANLAB_CALLINGCONVENTION* PScanLabPtr_n_set_end_of_list) (uint32_t nCardNo);
 		typedef void(SCANLAB_CALLINGCONVENTION* PScanLabPtr_n_execute_list_pos) (uint32_t nCardNo, uint32_t nListNo, uint32_t nPos);
 		typedef void(SCANLAB_CALLINGCONVENTION* PScanLabPtr_n_auto_change_pos) (uint32_t nCardNo, uint32_t nPos);
+		typedef uint32_t(SCANLAB_CALLINGCONVENTION* PScanLabPtr_n_load_list) (uint32_t nCardNo, uint32_t nListNo, uint32_t nPos);
+		typedef uint32_t(SCANLAB_CALLINGCONVENTION* PScanLabPtr_n_read_status) (uint32_t nCardNo);
+		typedef uint32_t(SCANLAB_CALLINGCONVENTION* PScanLabPtr_n_get_list_space) (uint32_t nCardNo);
 		typedef void(SCANLAB_CALLINGCONVENTION* PScanLabPtr_n_set_scanner_delays) (uint32_t nCardNo, uint32_t nJump, uint32_t nMark, uint32_t nPolygon);
 		typedef void(SCANLAB_CALLINGCONVENTION* PScanLabPtr_n_set_mark_speed) (uint32_t nCardNo, double dSpeed);
 		typedef void(SCANLAB_CALLINGCONVENTION* PScanLabPtr_n_set_jump_speed) (uint32_t nCardNo, double dSpeed);
@@ -231,6 +235,11 @@ namespace LibMCDriver_ScanLab {
 
 			void writeCLine(const std::string & sLine);
 
+			// Must be called with m_Mutex locked, as cards may be journaled from several threads.
+			std::string getVariableSuffix(const std::string& sVariableBaseName);
+
+			std::string defineVariable(const std::string& sTypeName, const std::string& sVariableBaseName);
+
 		public:
 
 			CScanLabSDKJournal(const std::string & sDebugFileName);
@@ -242,8 +251,6 @@ namespace LibMCDriver_ScanLab {
 			std::string defineUint32Variable(const std::string& sVariableBaseName);
 			std::string defineInt32Variable(const std::string& sVariableBaseName);
 
-			std::string getVariableSuffix(const std::string& sVariableBaseName);
-
 			std::string escapeString(const std::string & sString);
 		};
 
@@ -253,6 +260,7 @@ namespace LibMCDriver_ScanLab {
 		class CScanLabSDK {
 		private:
 			bool m_bIsInitialized;
+			bool m_bIsEmulated;
 
 			PScanLabSDKJournal m_pLogJournal;
 
@@ -290,6 +298,9 @@ namespace LibMCDriver_ScanLab {
 			PScanLabPtr_n_set_end_of_list ptr_n_set_end_of_list = nullptr;
 			PScanLabPtr_n_execute_list_pos ptr_n_execute_list_pos = nullptr;
 			PScanLabPtr_n_auto_change_pos ptr_n_auto_change_pos = nullptr;
+			PScanLabPtr_n_load_list ptr_n_load_list = nullptr;
+			PScanLabPtr_n_read_status ptr_n_read_status = nullptr;
+			PScanLabPtr_n_get_list_space ptr_n_get_list_space = nullptr;
 			PScanLabPtr_n_set_scanner_delays ptr_n_set_scanner_delays = nullptr;
 			PScanLabPtr_n_set_mark_speed ptr_n_set_mark_speed = nullptr;
 			PScanLabPtr_n_set_jump_speed ptr_n_set_jump_speed = nullptr;
@@ -408,11 +419,23 @@ namespace LibMCDriver_ScanLab {
 			PScanLabPtr_n_list_jump_rel ptr_n_list_jump_rel = nullptr;
 
 			void resetFunctionPtrs ();
+
+			// Binds all function pointers to the built-in card emulation, see libmcdriver_scanlab_sdkemulation.cpp
+			void bindEmulation (uint32_t nSerialNumber);
 		public:
 
 			CScanLabSDK(const std::string & sDLLNameUTF8);
+
+			// Creates an SDK that is backed by an emulated RTC6 card instead of the RTC DLL.
+			explicit CScanLabSDK(uint32_t nEmulatedSerialNumber);
+
 			~CScanLabSDK();
 
+			bool isEmulated();
+			void getEmulationStatistics(uint32_t nCardNo, sScanLabEmulationStatistics & statistics);
+			void resetEmulationStatistics(uint32_t nCardNo);
+			void setEmulationTimeFactor(double dTimeFactor);
+
 			void setJournal(PScanLabSDKJournal pLogJournal);
 
 			void initDLL();
@@ -456,6 +479,9 @@ namespace LibMCDriver_ScanLab {
 			void n_set_end_of_list (uint32_t nCardNo);
 			void n_execute_list_pos (uint32_t nCardNo, uint32_t nListNo, uint32_t nPos);
 			void n_auto_change_pos (uint32_t nCardNo, uint32_t nPos);
+			uint32_t n_load_list (uint32_t nCardNo, uint32_t nListNo, uint32_t nPos);
+			uint32_t n_read_status (uint32_t nCardNo);
+			uint32_t n_get_list_space (uint32_t nCardNo);
 			void n_set_scanner_delays (uint32_t nCardNo, uint32_t nJump, uint32_t nMark, uint32_t nPolygon);
 			void n_set_mark_speed (uint32_t nCardNo, double dSpeed);
 			void n_set_jump_speed (uint32_t nCardNo, double dSpeed);
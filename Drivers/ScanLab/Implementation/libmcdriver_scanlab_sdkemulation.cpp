@@ -0,0 +1,1670 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is an in-memory emulation of an RTC6 card behind the function pointers of CScanLabSDK.
+List commands are stored per list and executed in virtual time, so that list generation can be
+benchmarked without hardware. Commands that the emulation does not model are accepted without effect.
+
+*/
+
+#include "libmcdriver_scanlab_sdk.hpp"
+#include "libmcdriver_scanlab_sdkemulation.hpp"
+
+#include <cstring>
+#include <array>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+#include <chrono>
+
+namespace LibMCDriver_ScanLab {
+	namespace Impl {
+
+		enum class eEmulatedListCommand : uint32_t {
+			Nop = 0,
+			ListNop = 1,
+			EndOfList = 2,
+			Jump = 3,
+			Mark = 4,
+			TimedMark = 5,
+			MicroVector = 6,
+			LongDelay = 7,
+			Defocus = 8,
+			MarkSpeed = 9,
+			JumpSpeed = 10,
+			ScannerDelays = 11,
+			SkyWritingPara = 12,
+			SkyWritingLimit = 13,
+			SkyWritingMode = 14,
+			FreeVariable = 15,
+			Trigger = 16
+		};
+
+		typedef struct _sEmulatedListCommand {
+			eEmulatedListCommand m_Type;
+			int32_t m_nParameters[4];
+			double m_dValue;
+		} sEmulatedListCommand;
+
+		// Period in 10us ticks, number of channels and the signals of one set_trigger call.
+		typedef struct _sEmulatedTrigger {
+			uint32_t m_nPeriod;
+			uint32_t m_nChannelCount;
+			uint32_t m_nSignals[RTC6EMULATION_RECORDINGCHANNELCOUNT];
+		} sEmulatedTrigger;
+
+		class CEmulatedRTCCard {
+		public:
+
+			uint32_t m_nListSizes[2];
+			std::vector<sEmulatedListCommand> m_Lists[2];
+
+			uint32_t m_nLoadListIndex;
+			uint32_t m_nLoadPosition;
+			uint32_t m_nStatusPosition;
+			uint32_t m_nUsedListFlags;
+
+			// Wall clock window in which an executed list reports busy, and its list positions.
+			std::chrono::steady_clock::time_point m_ListStartTimes[2];
+			std::chrono::steady_clock::time_point m_ListEndTimes[2];
+			uint32_t m_nListStartPositions[2];
+			uint32_t m_nListEndPositions[2];
+
+			uint32_t m_nLastError;
+			uint32_t m_nAccumulatedError;
+
+			std::array<uint32_t, RTC6EMULATION_FREEVARIABLECOUNT> m_FreeVariables;
+
+			double m_dX;
+			double m_dY;
+			double m_dZ;
+			bool m_bLaserOn;
+			double m_dMarkSpeed;
+			double m_dJumpSpeed;
+			uint32_t m_nJumpDelay;
+			uint32_t m_nMarkDelay;
+			uint32_t m_nPolygonDelay;
+			uint32_t m_nSkyWritingMode;
+			uint32_t m_nSkyWritingPrev;
+			uint32_t m_nSkyWritingPost;
+			double m_dSkyWritingLimit;
+
+			bool m_bInPolyline;
+			double m_dLastMarkDirectionX;
+			double m_dLastMarkDirectionY;
+
+			double m_dVirtualTimeInMicroseconds;
+
+			std::vector<sEmulatedTrigger> m_Triggers;
+			sEmulatedTrigger m_ActiveTrigger;
+			double m_dNextSampleTimeInMicroseconds;
+			std::vector<int32_t> m_RecordingChannels[RTC6EMULATION_RECORDINGCHANNELCOUNT];
+			uint32_t m_nMeasurementPosition;
+
+			sScanLabEmulationStatistics m_Statistics;
+
+			CEmulatedRTCCard()
+				: m_nLoadListIndex(0), m_nLoadPosition(0), m_nStatusPosition(0), m_nUsedListFlags(0),
+				m_nLastError(0), m_nAccumulatedError(0),
+				m_dX(0.0), m_dY(0.0), m_dZ(0.0), m_bLaserOn(false),
+				m_dMarkSpeed(RTC6EMULATION_DEFAULTMARKSPEED), m_dJumpSpeed(RTC6EMULATION_DEFAULTJUMPSPEED),
+				m_nJumpDelay(0), m_nMarkDelay(0), m_nPolygonDelay(0),
+				m_nSkyWritingMode(0), m_nSkyWritingPrev(0), m_nSkyWritingPost(0), m_dSkyWritingLimit(0.0),
+				m_bInPolyline(false), m_dLastMarkDirectionX(0.0), m_dLastMarkDirectionY(0.0),
+				m_dVirtualTimeInMicroseconds(0.0), m_dNextSampleTimeInMicroseconds(0.0), m_nMeasurementPosition(0)
+			{
+				m_nListSizes[0] = RTC6EMULATION_DEFAULTLISTSIZE;
+				m_nListSizes[1] = RTC6EMULATION_DEFAULTLISTSIZE;
+				for (uint32_t nListIndex = 0; nListIndex < 2; nListIndex++) {
+					m_nListStartPositions[nListIndex] = 0;
+					m_nListEndPositions[nListIndex] = 0;
+				}
+				m_FreeVariables.fill(0);
+				m_ActiveTrigger = sEmulatedTrigger();
+				m_Statistics = sScanLabEmulationStatistics();
+			}
+
+			uint32_t getListBase(uint32_t nListIndex)
+			{
+				return (nListIndex == 0) ? 0 : m_nListSizes[0];
+			}
+
+			void writeListCommand(eEmulatedListCommand commandType, int32_t nParameter0 = 0, int32_t nParameter1 = 0, int32_t nParameter2 = 0, int32_t nParameter3 = 0, double dValue = 0.0)
+			{
+				if (m_nLoadPosition >= m_nListSizes[m_nLoadListIndex]) {
+					m_nLastError |= RTC6EMULATION_ERROR_LISTCOMMANDREJECTED;
+					m_nAccumulatedError |= RTC6EMULATION_ERROR_LISTCOMMANDREJECTED;
+					m_Statistics.m_nRejectedListCommandCount++;
+					return;
+				}
+
+				sEmulatedListCommand command;
+				command.m_Type = commandType;
+				command.m_nParameters[0] = nParameter0;
+				command.m_nParameters[1] = nParameter1;
+				command.m_nParameters[2] = nParameter2;
+				command.m_nParameters[3] = nParameter3;
+				command.m_dValue = dValue;
+
+				auto& list = m_Lists[m_nLoadListIndex];
+				if (m_nLoadPosition < list.size())
+					list[m_nLoadPosition] = command;
+				else {
+					list.resize(m_nLoadPosition);
+					list.push_back(command);
+				}
+
+				m_nLoadPosition++;
+				m_Statistics.m_nListCommandCount++;
+				m_Statistics.m_nListCommandHash = hashListCommand(m_Statistics.m_nListCommandHash, command);
+			}
+
+			static uint64_t hashListCommand(uint64_t nHash, const sEmulatedListCommand& command)
+			{
+				uint64_t nValueBits;
+				static_assert (sizeof(nValueBits) == sizeof(command.m_dValue), "invalid double size");
+				memcpy(&nValueBits, &command.m_dValue, sizeof(nValueBits));
+
+				uint64_t Words[6] = { (uint64_t)command.m_Type, (uint32_t)command.m_nParameters[0], (uint32_t)command.m_nParameters[1], (uint32_t)command.m_nParameters[2], (uint32_t)command.m_nParameters[3], nValueBits };
+				if (nHash == 0)
+					nHash = RTC6EMULATION_HASHOFFSETBASIS;
+
+				for (uint64_t nWord : Words) {
+					for (uint32_t nByteIndex = 0; nByteIndex < 8; nByteIndex++) {
+						nHash ^= (nWord >> (nByteIndex * 8)) & 0xff;
+						nHash *= RTC6EMULATION_HASHPRIME;
+					}
+				}
+
+				return nHash;
+			}
+
+			int32_t getSignalValue(uint32_t nSignal)
+			{
+				switch (nSignal) {
+				case 0: return m_bLaserOn ? 1 : 0; // LaserOn
+				case 1: case 7: case 10: return (int32_t)round(m_dX); // StatusAX, SampleX, SampleXCorr
+				case 2: case 8: case 11: return (int32_t)round(m_dY); // StatusAY, SampleY, SampleYCorr
+				case 9: case 12: case 32: return (int32_t)round(m_dZ); // SampleZ, SampleZCorr, Focus shift
+				case 45: return (int32_t)round(m_dMarkSpeed); // Mark speed
+				default: return 0;
+				}
+			}
+
+			// Moves the scanner linearly to the target within the given virtual time and takes the recording samples on the way.
+			void advance(double dTargetX, double dTargetY, double dTargetZ, bool bLaserOn, double dDurationInMicroseconds)
+			{
+				double dStartX = m_dX;
+				double dStartY = m_dY;
+				double dStartZ = m_dZ;
+				double dStartTime = m_dVirtualTimeInMicroseconds;
+				double dEndTime = dStartTime + dDurationInMicroseconds;
+
+				if (m_ActiveTrigger.m_nPeriod > 0) {
+					double dPeriodInMicroseconds = m_ActiveTrigger.m_nPeriod * 10.0;
+					m_bLaserOn = bLaserOn;
+
+					while (m_dNextSampleTimeInMicroseconds < dEndTime) {
+						double dFactor = (dDurationInMicroseconds > 0.0) ? ((m_dNextSampleTimeInMicroseconds - dStartTime) / dDurationInMicroseconds) : 1.0;
+						dFactor = std::min(std::max(dFactor, 0.0), 1.0);
+						m_dX = dStartX + (dTargetX - dStartX) * dFactor;
+						m_dY = dStartY + (dTargetY - dStartY) * dFactor;
+						m_dZ = dStartZ + (dTargetZ - dStartZ) * dFactor;
+
+						for (uint32_t nChannel = 0; nChannel < RTC6EMULATION_RECORDINGCHANNELCOUNT; nChannel++) {
+							int32_t nValue = (nChannel < m_ActiveTrigger.m_nChannelCount) ? getSignalValue(m_ActiveTrigger.m_nSignals[nChannel]) : 0;
+							auto& channel = m_RecordingChannels[nChannel];
+							if (m_nMeasurementPosition < channel.size())
+								channel[m_nMeasurementPosition] = nValue;
+							else
+								channel.push_back(nValue);
+						}
+
+						m_nMeasurementPosition = (m_nMeasurementPosition + 1) % RTC6EMULATION_RECORDINGBUFFERSIZE;
+						m_Statistics.m_nRecordedSampleCount++;
+						m_dNextSampleTimeInMicroseconds += dPeriodInMicroseconds;
+					}
+				}
+
+				m_dX = dTargetX;
+				m_dY = dTargetY;
+				m_dZ = dTargetZ;
+				m_bLaserOn = false;
+				m_dVirtualTimeInMicroseconds = dEndTime;
+				m_Statistics.m_dExecutionTimeInMicroseconds += dDurationInMicroseconds;
+			}
+
+			void delay(double dDurationInMicroseconds)
+			{
+				advance(m_dX, m_dY, m_dZ, false, dDurationInMicroseconds);
+				m_Statistics.m_dDelayTimeInMicroseconds += dDurationInMicroseconds;
+			}
+
+			// The scanner settles with the mark delay after a polyline, sky writing adds its run out.
+			void finishPolyline()
+			{
+				if (!m_bInPolyline)
+					return;
+				m_bInPolyline = false;
+
+				double dDelay = m_nMarkDelay * 10.0;
+				if (m_nSkyWritingMode != 0)
+					dDelay += m_nSkyWritingPost * 10.0;
+				delay(dDelay);
+			}
+
+			void executeMark(double dTargetX, double dTargetY, double dDurationInMicroseconds)
+			{
+				double dDeltaX = dTargetX - m_dX;
+				double dDeltaY = dTargetY - m_dY;
+				double dLength = sqrt(dDeltaX * dDeltaX + dDeltaY * dDeltaY);
+				double dDirectionX = (dLength > 0.0) ? (dDeltaX / dLength) : 0.0;
+				double dDirectionY = (dLength > 0.0) ? (dDeltaY / dLength) : 0.0;
+
+				if (!m_bInPolyline) {
+					if (m_nSkyWritingMode != 0)
+						delay(m_nSkyWritingPrev * 10.0);
+				}
+				else {
+					// Corners are sky written in mode 2, and in mode 3 and 4 if they are sharper than the limit.
+					double dCosAngle = dDirectionX * m_dLastMarkDirectionX + dDirectionY * m_dLastMarkDirectionY;
+					bool bSkyWriteCorner = (m_nSkyWritingMode == 2) || ((m_nSkyWritingMode >= 3) && (dCosAngle < m_dSkyWritingLimit));
+					if (bSkyWriteCorner)
+						delay((m_nSkyWritingPrev + m_nSkyWritingPost) * 10.0);
+					else
+						delay(m_nPolygonDelay * 10.0);
+				}
+
+				if (dDurationInMicroseconds < 0.0)
+					dDurationInMicroseconds = (m_dMarkSpeed > 0.0) ? (dLength / m_dMarkSpeed * 1000.0) : 0.0;
+
+				advance(dTargetX, dTargetY, m_dZ, true, dDurationInMicroseconds);
+
+				m_bInPolyline = true;
+				m_dLastMarkDirectionX = dDirectionX;
+				m_dLastMarkDirectionY = dDirectionY;
+				m_Statistics.m_nMarkCount++;
+				m_Statistics.m_dMarkTimeInMicroseconds += dDurationInMicroseconds;
+			}
+
+			void executeJump(double dTargetX, double dTargetY)
+			{
+				finishPolyline();
+
+				double dDeltaX = dTargetX - m_dX;
+				double dDeltaY = dTargetY - m_dY;
+				double dLength = sqrt(dDeltaX * dDeltaX + dDeltaY * dDeltaY);
+				double dDurationInMicroseconds = (m_dJumpSpeed > 0.0) ? (dLength / m_dJumpSpeed * 1000.0) : 0.0;
+
+				advance(dTargetX, dTargetY, m_dZ, false, dDurationInMicroseconds);
+				delay(m_nJumpDelay * 10.0);
+
+				m_Statistics.m_nJumpCount++;
+				m_Statistics.m_dJumpTimeInMicroseconds += dDurationInMicroseconds;
+			}
+
+			void executeCommand(const sEmulatedListCommand& command)
+			{
+				const int32_t* pParameters = command.m_nParameters;
+
+				switch (command.m_Type) {
+				case eEmulatedListCommand::Jump:
+					executeJump(pParameters[0], pParameters[1]);
+					break;
+
+				case eEmulatedListCommand::Mark:
+					executeMark(pParameters[0], pParameters[1], -1.0);
+					break;
+
+				case eEmulatedListCommand::TimedMark:
+					executeMark(pParameters[0], pParameters[1], command.m_dValue);
+					break;
+
+				case eEmulatedListCommand::MicroVector:
+					// Micro vectors take one 10us clock cycle each.
+					finishPolyline();
+					advance(pParameters[0], pParameters[1], pParameters[2], pParameters[3] != 0, 10.0);
+					break;
+
+				case eEmulatedListCommand::LongDelay:
+					finishPolyline();
+					delay((uint32_t)pParameters[0] * 10.0);
+					break;
+
+				case eEmulatedListCommand::ListNop:
+					delay(10.0);
+					break;
+
+				case eEmulatedListCommand::Defocus:
+					m_dZ = pParameters[0];
+					break;
+
+				case eEmulatedListCommand::MarkSpeed:
+					m_dMarkSpeed = command.m_dValue;
+					break;
+
+				case eEmulatedListCommand::JumpSpeed:
+					m_dJumpSpeed = command.m_dValue;
+					break;
+
+				case eEmulatedListCommand::ScannerDelays:
+					m_nJumpDelay = (uint32_t)pParameters[0];
+					m_nMarkDelay = (uint32_t)pParameters[1];
+					m_nPolygonDelay = (uint32_t)pParameters[2];
+					break;
+
+				case eEmulatedListCommand::SkyWritingPara:
+					m_nSkyWritingPrev = (uint32_t)pParameters[0];
+					m_nSkyWritingPost = (uint32_t)pParameters[1];
+					break;
+
+				case eEmulatedListCommand::SkyWritingLimit:
+					m_dSkyWritingLimit = command.m_dValue;
+					break;
+
+				case eEmulatedListCommand::SkyWritingMode:
+					m_nSkyWritingMode = (uint32_t)pParameters[0];
+					break;
+
+				case eEmulatedListCommand::FreeVariable:
+					m_FreeVariables.at((uint32_t)pParameters[0]) = (uint32_t)pParameters[1];
+					break;
+
+				case eEmulatedListCommand::Trigger:
+					m_ActiveTrigger = m_Triggers.at((uint32_t)pParameters[0]);
+					m_dNextSampleTimeInMicroseconds = m_dVirtualTimeInMicroseconds;
+					break;
+
+				default:
+					break;
+				}
+			}
+
+			// Lists run to completion within the call. The card then reports the list as busy from startTime
+			// on, for its virtual execution time scaled by the time factor.
+			void executeList(uint32_t nListIndex, uint32_t nPosition, std::chrono::steady_clock::time_point startTime, double dTimeFactor)
+			{
+				auto& list = m_Lists[nListIndex];
+				double dVirtualStartTime = m_dVirtualTimeInMicroseconds;
+				uint32_t nCommandCount = (uint32_t)list.size();
+
+				uint32_t nIndex = nPosition;
+				while (nIndex < nCommandCount) {
+					auto& command = list[nIndex];
+					if (command.m_Type == eEmulatedListCommand::EndOfList)
+						break;
+					executeCommand(command);
+					nIndex++;
+				}
+
+				finishPolyline();
+
+				m_nStatusPosition = getListBase(nListIndex) + nIndex;
+				m_nUsedListFlags |= (1UL << (6 + nListIndex));
+				m_Statistics.m_nExecutedListCount++;
+
+				double dBusyTimeInMicroseconds = (m_dVirtualTimeInMicroseconds - dVirtualStartTime) * dTimeFactor;
+				m_ListStartTimes[nListIndex] = startTime;
+				m_ListEndTimes[nListIndex] = startTime + std::chrono::microseconds((int64_t)ceil(dBusyTimeInMicroseconds));
+				m_nListStartPositions[nListIndex] = getListBase(nListIndex) + nPosition;
+				m_nListEndPositions[nListIndex] = m_nStatusPosition;
+			}
+
+			// A list is active from its execution until its busy window has passed, including a list that waits for an auto change.
+			bool listIsActive(uint32_t nListIndex, std::chrono::steady_clock::time_point currentTime)
+			{
+				return ((m_nUsedListFlags & (1UL << (6 + nListIndex))) != 0) && (currentTime < m_ListEndTimes[nListIndex]);
+			}
+
+			bool listIsBusy(uint32_t nListIndex, std::chrono::steady_clock::time_point currentTime)
+			{
+				return listIsActive(nListIndex, currentTime) && (currentTime >= m_ListStartTimes[nListIndex]);
+			}
+
+			bool listIsUsed(uint32_t nListIndex, std::chrono::steady_clock::time_point currentTime)
+			{
+				return ((m_nUsedListFlags & (1UL << (6 + nListIndex))) != 0) && (currentTime >= m_ListEndTimes[nListIndex]);
+			}
+
+			bool anyListIsActive(std::chrono::steady_clock::time_point currentTime)
+			{
+				return listIsActive(0, currentTime) || listIsActive(1, currentTime);
+			}
+
+			// Load list bit, BUSY1/2 (bits 4 and 5) while a list executes and USED1/2 (bits 6 and 7) once it has finished.
+			uint32_t readStatus(std::chrono::steady_clock::time_point currentTime)
+			{
+				uint32_t nStatus = (1UL << m_nLoadListIndex);
+				for (uint32_t nListIndex = 0; nListIndex < 2; nListIndex++) {
+					if (listIsBusy(nListIndex, currentTime))
+						nStatus |= (1UL << (4 + nListIndex));
+					else if (listIsUsed(nListIndex, currentTime))
+						nStatus |= (1UL << (6 + nListIndex));
+				}
+				return nStatus;
+			}
+
+			// The position of a busy list advances linearly through its busy window.
+			bool getBusyPosition(std::chrono::steady_clock::time_point currentTime, uint32_t& nPosition)
+			{
+				for (uint32_t nListIndex = 0; nListIndex < 2; nListIndex++) {
+					if (listIsBusy(nListIndex, currentTime)) {
+						double dWindow = std::chrono::duration<double>(m_ListEndTimes[nListIndex] - m_ListStartTimes[nListIndex]).count();
+						double dElapsed = std::chrono::duration<double>(currentTime - m_ListStartTimes[nListIndex]).count();
+						double dFactor = (dWindow > 0.0) ? std::min(dElapsed / dWindow, 1.0) : 1.0;
+						nPosition = m_nListStartPositions[nListIndex] + (uint32_t)((m_nListEndPositions[nListIndex] - m_nListStartPositions[nListIndex]) * dFactor);
+						return true;
+					}
+				}
+				return false;
+			}
+
+			void stopExecution(std::chrono::steady_clock::time_point currentTime)
+			{
+				for (uint32_t nListIndex = 0; nListIndex < 2; nListIndex++) {
+					if (listIsActive(nListIndex, currentTime)) {
+						if (m_ListStartTimes[nListIndex] > currentTime)
+							m_ListStartTimes[nListIndex] = currentTime;
+						m_ListEndTimes[nListIndex] = currentTime;
+					}
+				}
+			}
+
+			void addTrigger(uint32_t nPeriod, uint32_t nChannelCount, const uint32_t* pSignals)
+			{
+				sEmulatedTrigger trigger = sEmulatedTrigger();
+				trigger.m_nPeriod = nPeriod & ~RTC6_BITFLAG_SETTRIGGER_ROUNDTRIP;
+				trigger.m_nChannelCount = nChannelCount;
+				for (uint32_t nChannel = 0; nChannel < nChannelCount; nChannel++)
+					trigger.m_nSignals[nChannel] = pSignals[nChannel];
+
+				m_Triggers.push_back(trigger);
+				writeListCommand(eEmulatedListCommand::Trigger, (int32_t)(m_Triggers.size() - 1));
+			}
+
+		};
+
+		static std::mutex s_EmulationMutex;
+		static std::map<uint32_t, std::unique_ptr<CEmulatedRTCCard>> s_EmulatedCards;
+		static uint32_t s_nEmulatedSerialNumber = 0;
+		static uint32_t s_nLastEmulationError = 0;
+		static double s_dEmulationTimeFactor = RTC6EMULATION_DEFAULTTIMEFACTOR;
+
+		// Must be called with s_EmulationMutex locked. Card number 0 addresses the default card, like in the RTC DLL.
+		static CEmulatedRTCCard& getEmulatedCard(uint32_t nCardNo, bool bResetLastError = true)
+		{
+			if (nCardNo == 0)
+				nCardNo = 1;
+
+			auto iIter = s_EmulatedCards.find(nCardNo);
+			if (iIter == s_EmulatedCards.end())
+				iIter = s_EmulatedCards.insert(std::make_pair(nCardNo, std::make_unique<CEmulatedRTCCard>())).first;
+
+			auto& card = *iIter->second;
+			if (bResetLastError)
+				card.m_nLastError = 0;
+
+			return card;
+		}
+
+		static void setEmulationError(CEmulatedRTCCard& card, uint32_t nError)
+		{
+			card.m_nLastError |= nError;
+			card.m_nAccumulatedError |= nError;
+			s_nLastEmulationError = nError;
+		}
+
+		static void emulateControlCommand(uint32_t nCardNo)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			getEmulatedCard(nCardNo);
+		}
+
+		static void emulateListCommand(uint32_t nCardNo, eEmulatedListCommand commandType, int32_t nParameter0 = 0, int32_t nParameter1 = 0, int32_t nParameter2 = 0, int32_t nParameter3 = 0, double dValue = 0.0)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			getEmulatedCard(nCardNo).writeListCommand(commandType, nParameter0, nParameter1, nParameter2, nParameter3, dValue);
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_init_rtc6_dll()
+		{
+			return 0;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_free_rtc6_dll()
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			s_EmulatedCards.clear();
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_rtc6_count_cards()
+		{
+			return RTC6EMULATION_MAXCARDCOUNT;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_acquire_rtc(uint32_t nCardNo)
+		{
+			if ((nCardNo == 0) || (nCardNo > RTC6EMULATION_MAXCARDCOUNT))
+				return 0;
+			return nCardNo;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_release_rtc(uint32_t nCardNo)
+		{
+			return nCardNo;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_get_serial_number(uint32_t nCardNo)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			getEmulatedCard(nCardNo);
+			return s_nEmulatedSerialNumber + ((nCardNo == 0) ? 0 : (nCardNo - 1));
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_get_last_error(uint32_t nCardNo)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			return getEmulatedCard(nCardNo, false).m_nLastError;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_get_last_error()
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			return s_nLastEmulationError;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_get_error(uint32_t nCardNo)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			return getEmulatedCard(nCardNo, false).m_nAccumulatedError;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_reset_error(uint32_t nCardNo, uint32_t nCode)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			auto& card = getEmulatedCard(nCardNo);
+			card.m_nAccumulatedError &= ~nCode;
+			s_nLastEmulationError = 0;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_config_list(uint32_t nCardNo, uint32_t nMem1, uint32_t nMem2)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			auto& card = getEmulatedCard(nCardNo);
+
+			if (((uint64_t)nMem1 + (uint64_t)nMem2) > RTC6EMULATION_LISTMEMORYSIZE) {
+				setEmulationError(card, RTC6EMULATION_ERROR_INVALIDPARAMETER);
+				return;
+			}
+
+			card.m_nListSizes[0] = nMem1;
+			card.m_nListSizes[1] = nMem2;
+			card.m_Lists[0].clear();
+			card.m_Lists[1].clear();
+			card.m_nLoadListIndex = 0;
+			card.m_nLoadPosition = 0;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_start_list_pos(uint32_t nCardNo, uint32_t nListNo, uint32_t nListPos)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			auto& card = getEmulatedCard(nCardNo);
+
+			if ((nListNo < 1) || (nListNo > 2) || (nListPos >= card.m_nListSizes[nListNo - 1])) {
+				setEmulationError(card, RTC6EMULATION_ERROR_INVALIDPARAMETER);
+				return;
+			}
+
+			// A list can not be reloaded while it is executing or waiting for an auto change.
+			if (card.listIsActive(nListNo - 1, std::chrono::steady_clock::now())) {
+				setEmulationError(card, RTC6EMULATION_ERROR_BUSY);
+				return;
+			}
+
+			card.m_nLoadListIndex = nListNo - 1;
+			card.m_nLoadPosition = nListPos;
+			card.m_nUsedListFlags &= ~(1UL << (6 + card.m_nLoadListIndex));
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_load_list(uint32_t nCardNo, uint32_t nListNo, uint32_t nPos)
+		{
+			emulated_n_set_start_list_pos(nCardNo, nListNo, nPos);
+
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			if (getEmulatedCard(nCardNo, false).m_nLastError != 0)
+				return 0;
+			return nListNo;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_end_of_list(uint32_t nCardNo)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::EndOfList);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_execute_list_pos(uint32_t nCardNo, uint32_t nListNo, uint32_t nPos)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			auto& card = getEmulatedCard(nCardNo);
+
+			if ((nListNo < 1) || (nListNo > 2) || (nPos >= card.m_nListSizes[nListNo - 1])) {
+				setEmulationError(card, RTC6EMULATION_ERROR_INVALIDPARAMETER);
+				return;
+			}
+
+			auto currentTime = std::chrono::steady_clock::now();
+			if (card.anyListIsActive(currentTime)) {
+				setEmulationError(card, RTC6EMULATION_ERROR_BUSY);
+				return;
+			}
+
+			card.executeList(nListNo - 1, nPos, currentTime, s_dEmulationTimeFactor);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_auto_change_pos(uint32_t nCardNo, uint32_t nPos)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			auto& card = getEmulatedCard(nCardNo);
+
+			// The other list is chained behind the busy one. Without a busy list, the auto change is ignored.
+			auto currentTime = std::chrono::steady_clock::now();
+			for (uint32_t nListIndex = 0; nListIndex < 2; nListIndex++) {
+				uint32_t nOtherListIndex = 1 - nListIndex;
+				if (card.listIsBusy(nListIndex, currentTime) && !card.listIsActive(nOtherListIndex, currentTime)) {
+					if (nPos >= card.m_nListSizes[nOtherListIndex]) {
+						setEmulationError(card, RTC6EMULATION_ERROR_INVALIDPARAMETER);
+						return;
+					}
+
+					card.executeList(nOtherListIndex, nPos, card.m_ListEndTimes[nListIndex], s_dEmulationTimeFactor);
+					return;
+				}
+			}
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_read_status(uint32_t nCardNo)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			return getEmulatedCard(nCardNo).readStatus(std::chrono::steady_clock::now());
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_get_status(uint32_t nCardNo, uint32_t* pnStatus, uint32_t* pnPos)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			auto& card = getEmulatedCard(nCardNo);
+
+			uint32_t nPosition = card.m_nStatusPosition;
+			bool bBusy = card.getBusyPosition(std::chrono::steady_clock::now(), nPosition);
+
+			if (pnStatus != nullptr)
+				*pnStatus = bBusy ? 1 : 0;
+			if (pnPos != nullptr)
+				*pnPos = nPosition;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_get_input_pointer(uint32_t nCardNo)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			auto& card = getEmulatedCard(nCardNo);
+			return card.getListBase(card.m_nLoadListIndex) + card.m_nLoadPosition;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_get_list_space(uint32_t nCardNo)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			auto& card = getEmulatedCard(nCardNo);
+			uint32_t nListSize = card.m_nListSizes[card.m_nLoadListIndex];
+			return (card.m_nLoadPosition < nListSize) ? (nListSize - card.m_nLoadPosition) : 0;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_jump_abs(uint32_t nCardNo, int32_t nX, int32_t nY)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Jump, nX, nY);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_mark_abs(uint32_t nCardNo, int32_t nX, int32_t nY)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Mark, nX, nY);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_timed_mark_abs(uint32_t nCardNo, int32_t nX, int32_t nY, double dTime)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::TimedMark, nX, nY, 0, 0, dTime);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_long_delay(uint32_t nCardNo, uint32_t nDelay)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::LongDelay, (int32_t)nDelay);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_list_nop(uint32_t nCardNo)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::ListNop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_defocus_list(uint32_t nCardNo, int32_t nShift)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Defocus, nShift);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_mark_speed(uint32_t nCardNo, double dSpeed)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::MarkSpeed, 0, 0, 0, 0, dSpeed);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_jump_speed(uint32_t nCardNo, double dSpeed)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::JumpSpeed, 0, 0, 0, 0, dSpeed);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_mark_speed_ctrl(uint32_t nCardNo, double dSpeed)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			getEmulatedCard(nCardNo).m_dMarkSpeed = dSpeed;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_jump_speed_ctrl(uint32_t nCardNo, double dSpeed)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			getEmulatedCard(nCardNo).m_dJumpSpeed = dSpeed;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_scanner_delays(uint32_t nCardNo, uint32_t nJump, uint32_t nMark, uint32_t nPolygon)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::ScannerDelays, (int32_t)nJump, (int32_t)nMark, (int32_t)nPolygon);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_sky_writing_para(uint32_t nCardNo, double dTimelag, int32_t nLaserOnShift, uint32_t nNprev, uint32_t nNPost)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			auto& card = getEmulatedCard(nCardNo);
+			card.m_nSkyWritingPrev = nNprev;
+			card.m_nSkyWritingPost = nNPost;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_sky_writing_limit(uint32_t nCardNo, double dCosAngle)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			getEmulatedCard(nCardNo).m_dSkyWritingLimit = dCosAngle;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_sky_writing_mode(uint32_t nCardNo, uint32_t nMode)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			getEmulatedCard(nCardNo).m_nSkyWritingMode = nMode;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_sky_writing_para_list(uint32_t nCardNo, double dTimelag, int32_t nLaserOnShift, uint32_t nNprev, uint32_t nNPost)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::SkyWritingPara, (int32_t)nNprev, (int32_t)nNPost, 0, 0, dTimelag);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_sky_writing_limit_list(uint32_t nCardNo, double dCosAngle)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::SkyWritingLimit, 0, 0, 0, 0, dCosAngle);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_sky_writing_mode_list(uint32_t nCardNo, uint32_t nMode)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::SkyWritingMode, (int32_t)nMode);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_micro_vector_abs_3d(uint32_t nCardNo, int32_t nX, int32_t nY, int32_t nZ, int32_t nLasOn, int32_t nLasOff)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::MicroVector, nX, nY, nZ, (nLasOn >= 0) ? 1 : 0);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_micro_vector_abs(uint32_t nCardNo, int32_t nX, int32_t nY, int32_t nLasOn, int32_t nLasOff)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			auto& card = getEmulatedCard(nCardNo);
+			card.writeListCommand(eEmulatedListCommand::MicroVector, nX, nY, (int32_t)round(card.m_dZ), (nLasOn >= 0) ? 1 : 0);
+		}
+
+		// Relative micro vectors are resolved against the last written target, as list execution is strictly sequential.
+		static void SCANLAB_CALLINGCONVENTION emulated_n_micro_vector_rel_3d(uint32_t nCardNo, int32_t ndX, int32_t ndY, int32_t ndZ, int32_t nLasOn, int32_t nLasOff)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			auto& card = getEmulatedCard(nCardNo);
+			card.writeListCommand(eEmulatedListCommand::MicroVector, (int32_t)round(card.m_dX) + ndX, (int32_t)round(card.m_dY) + ndY, (int32_t)round(card.m_dZ) + ndZ, (nLasOn >= 0) ? 1 : 0);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_micro_vector_rel(uint32_t nCardNo, int32_t ndX, int32_t ndY, int32_t nLasOn, int32_t nLasOff)
+		{
+			emulated_n_micro_vector_rel_3d(nCardNo, ndX, ndY, 0, nLasOn, nLasOff);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_free_variable_list(uint32_t nCardNo, uint32_t nVarNo, uint32_t nValue)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			auto& card = getEmulatedCard(nCardNo);
+			if (nVarNo >= RTC6EMULATION_FREEVARIABLECOUNT) {
+				setEmulationError(card, RTC6EMULATION_ERROR_INVALIDPARAMETER);
+				return;
+			}
+			card.writeListCommand(eEmulatedListCommand::FreeVariable, (int32_t)nVarNo, (int32_t)nValue);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_free_variable(uint32_t nCardNo, uint32_t nVarNo, uint32_t nValue)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			auto& card = getEmulatedCard(nCardNo);
+			if (nVarNo >= RTC6EMULATION_FREEVARIABLECOUNT) {
+				setEmulationError(card, RTC6EMULATION_ERROR_INVALIDPARAMETER);
+				return;
+			}
+			card.m_FreeVariables[nVarNo] = nValue;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_get_free_variable(uint32_t nCardNo, uint32_t nVarNo)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			auto& card = getEmulatedCard(nCardNo);
+			if (nVarNo >= RTC6EMULATION_FREEVARIABLECOUNT) {
+				setEmulationError(card, RTC6EMULATION_ERROR_INVALIDPARAMETER);
+				return 0;
+			}
+			return card.m_FreeVariables[nVarNo];
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_trigger(uint32_t nCardNo, uint32_t nPeriod, uint32_t nSignal1, uint32_t nSignal2)
+		{
+			uint32_t signals[2] = { nSignal1, nSignal2 };
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			getEmulatedCard(nCardNo).addTrigger(nPeriod, 2, signals);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_trigger4(uint32_t nCardNo, uint32_t nPeriod, uint32_t nSignal1, uint32_t nSignal2, uint32_t nSignal3, uint32_t nSignal4)
+		{
+			uint32_t signals[4] = { nSignal1, nSignal2, nSignal3, nSignal4 };
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			getEmulatedCard(nCardNo).addTrigger(nPeriod, 4, signals);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_trigger8(uint32_t nCardNo, uint32_t nPeriod, uint32_t nSignal1, uint32_t nSignal2, uint32_t nSignal3, uint32_t nSignal4, uint32_t nSignal5, uint32_t nSignal6, uint32_t nSignal7, uint32_t nSignal8)
+		{
+			uint32_t signals[8] = { nSignal1, nSignal2, nSignal3, nSignal4, nSignal5, nSignal6, nSignal7, nSignal8 };
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			getEmulatedCard(nCardNo).addTrigger(nPeriod, 8, signals);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_measurement_status(uint32_t nCardNo, uint32_t* pnBusy, uint32_t* pnPos)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			auto& card = getEmulatedCard(nCardNo);
+			if (pnBusy != nullptr)
+				*pnBusy = card.anyListIsActive(std::chrono::steady_clock::now()) ? 1 : 0;
+			if (pnPos != nullptr)
+				*pnPos = card.m_nMeasurementPosition;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_get_waveform_offset(uint32_t nCardNo, uint32_t nChannel, uint32_t nOffset, uint32_t nNumber, int32_t* pPtr)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			auto& card = getEmulatedCard(nCardNo);
+
+			if ((nChannel < 1) || (nChannel > RTC6EMULATION_RECORDINGCHANNELCOUNT) || (pPtr == nullptr)) {
+				setEmulationError(card, RTC6EMULATION_ERROR_INVALIDPARAMETER);
+				return;
+			}
+
+			auto& channel = card.m_RecordingChannels[nChannel - 1];
+			for (uint32_t nIndex = 0; nIndex < nNumber; nIndex++) {
+				size_t nPosition = ((size_t)nOffset + nIndex) % RTC6EMULATION_RECORDINGBUFFERSIZE;
+				pPtr[nIndex] = (nPosition < channel.size()) ? channel[nPosition] : 0;
+			}
+		}
+
+		static int32_t SCANLAB_CALLINGCONVENTION emulated_n_get_value(uint32_t nCardNo, uint32_t nSignalNo)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			return getEmulatedCard(nCardNo).getSignalValue(nSignalNo);
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_get_head_status(uint32_t nCardNo, uint32_t nHeadNo)
+		{
+			emulateControlCommand(nCardNo);
+			// Position X, position Y, temperature and power are ok.
+			return (1UL << 3) | (1UL << 4) | (1UL << 6) | RTC6_BITFLAG_SCANHEADSTATUS_POWERFLAG;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_get_dll_version()
+		{
+			return RTC6EMULATION_DLLVERSION;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_get_hex_version(uint32_t nCardNo)
+		{
+			emulateControlCommand(nCardNo);
+			return RTC6EMULATION_HEXVERSION;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_get_bios_version(uint32_t nCardNo)
+		{
+			emulateControlCommand(nCardNo);
+			return RTC6EMULATION_BIOSVERSION;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_get_rtc_version(uint32_t nCardNo)
+		{
+			emulateControlCommand(nCardNo);
+			return RTC6EMULATION_RTCVERSION;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_get_card_type(uint32_t nCardNo)
+		{
+			emulateControlCommand(nCardNo);
+			return RTC6EMULATION_CARDTYPE;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_eth_get_com_timeouts_auto(uint32_t nCardNo, double* pdInitialTimeout, double* pdMaxTimeout, double* pdMultiplier, uint32_t* pnMode)
+		{
+			emulateControlCommand(nCardNo);
+			if (pdInitialTimeout != nullptr)
+				*pdInitialTimeout = 0.0;
+			if (pdMaxTimeout != nullptr)
+				*pdMaxTimeout = 0.0;
+			if (pdMultiplier != nullptr)
+				*pdMultiplier = 0.0;
+			if (pnMode != nullptr)
+				*pnMode = 0;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_get_scanahead_params(uint32_t nCardNo, uint32_t nHead, uint32_t* pPreViewTime, uint32_t* Vmax, double* Amax)
+		{
+			emulateControlCommand(nCardNo);
+			if (pPreViewTime != nullptr)
+				*pPreViewTime = 0;
+			if (Vmax != nullptr)
+				*Vmax = 0;
+			if (Amax != nullptr)
+				*Amax = 0.0;
+			return 0;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_uart_config(uint32_t nCardNo, uint32_t nBaudRate)
+		{
+			emulateControlCommand(nCardNo);
+			return nBaudRate;
+		}
+
+		// Commands without effect on the emulated scanner. List commands still occupy a list position.
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_eth_convert_string_to_ip(const char * pIPString)
+		{
+			return 0;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_eth_set_search_cards_timeout(const uint32_t nTimeOut)
+		{
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_eth_search_cards_range(const uint32_t nStartIP, const uint32_t nEndIP)
+		{
+			return 0;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_eth_count_cards()
+		{
+			return 0;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_eth_found_cards()
+		{
+			return 0;
+		}
+
+		static int32_t SCANLAB_CALLINGCONVENTION emulated_eth_assign_card(const uint32_t nSearchNo, const uint32_t nCardNo)
+		{
+			return 0;
+		}
+
+		static int32_t SCANLAB_CALLINGCONVENTION emulated_eth_remove_card(const uint32_t nCardNo)
+		{
+			return 0;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_eth_get_serial_search(uint32_t nSearchNo)
+		{
+			return 0;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_eth_search_cards(uint32_t nIP, uint32_t n_NetMask)
+		{
+			return 0;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_load_correction_file(uint32_t nCardNo, const char * nFileName, uint32_t nNo, uint32_t n_Dimension)
+		{
+			emulateControlCommand(nCardNo);
+			return 0;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_eth_set_com_timeouts_auto(uint32_t nCardNo, const double dInitialTimeout, const double dMaxTimeout, const double dMultiplier, const uint32_t nMode)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_select_cor_table(uint32_t nCardNo, uint32_t nHeadA, uint32_t nHeadB)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_laser_mode(uint32_t nCardNo, uint32_t nMode)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_laser_control(uint32_t nCardNo, uint32_t nControl)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_auto_laser_control(uint32_t nCardNo, uint32_t nControl, uint32_t nValue, uint32_t nMode, uint32_t nMinValue, uint32_t nMaxValue)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_laser_pulses(uint32_t nCardNo, uint32_t nHalfPeriod, uint32_t nPulseLength)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_standby(uint32_t nCardNo, uint32_t nHalfPeriod, uint32_t nPulseLength)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_load_program_file(uint32_t nCardNo, const char * pPath)
+		{
+			emulateControlCommand(nCardNo);
+			return 0;
+		}
+
+		static double SCANLAB_CALLINGCONVENTION emulated_n_get_table_para(uint32_t nCardNo, uint32_t nTableNo, uint32_t nParaNo)
+		{
+			emulateControlCommand(nCardNo);
+			return 0.0;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_write_io_port(uint32_t nCardNo, uint32_t nValue)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_write_8bit_port(uint32_t nCardNo, uint32_t nValue)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_write_da_1(uint32_t nCardNo, uint32_t nValue)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_write_da_2(uint32_t nCardNo, uint32_t nValue)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_write_io_port_list(uint32_t nCardNo, uint32_t nValue)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_write_io_port_mask_list(uint32_t nCardNo, uint32_t nValue, uint32_t nMask)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_write_8bit_port_list(uint32_t nCardNo, uint32_t nValue)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_write_da_1_list(uint32_t nCardNo, uint32_t nValue)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_write_da_2_list(uint32_t nCardNo, uint32_t nValue)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_laser_delays(uint32_t nCardNo, int32_t nLaserOnDelay, uint32_t nLaserOffDelay)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_set_mcbsp_freq(uint32_t nCardNo, uint32_t nFrequency)
+		{
+			emulateControlCommand(nCardNo);
+			return 0;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_mcbsp_init(uint32_t nCardNo, uint32_t nXDelay, uint32_t nYDelay)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_mcbsp_init_spi(uint32_t nCardNo, uint32_t nClockLevel, uint32_t nClockDelay)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_mcbsp_out_ptr(uint32_t nCardNo, uint32_t nNumber, void* pSignalPtr)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_multi_mcbsp_in(uint32_t nCardNo, uint32_t nCtrl, uint32_t nP, uint32_t nMode)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_multi_mcbsp_in_list(uint32_t nCardNo, uint32_t nCtrl, uint32_t nP, uint32_t nMode)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_laser_power(uint32_t nCardNo, uint32_t nPort, uint32_t nPower)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_control_mode(uint32_t nCardNo, uint32_t nMode)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_laser_pulses_ctrl(uint32_t nCardNo, uint32_t nHalfPeriod, uint32_t nPulseLength)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_firstpulse_killer(uint32_t nCardNo, uint32_t nLength)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_firstpulse_killer_list(uint32_t nCardNo, uint32_t nLength)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_qswitch_delay(uint32_t nCardNo, uint32_t nDelay)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_qswitch_delay_list(uint32_t nCardNo, uint32_t nDelay)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_write_da_x(uint32_t nCardNo, uint32_t nX, uint32_t nValue)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_laser_pin_out(uint32_t nCardNo, uint32_t nPins)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_laser_pin_out_list(uint32_t nCardNo, uint32_t nPins)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_get_laser_pin_in(uint32_t nCardNo)
+		{
+			emulateControlCommand(nCardNo);
+			return 0;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_sky_writing(uint32_t nCardNo, double dTimelag, int32_t nLaserOnShift)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_sky_writing_list(uint32_t nCardNo, double dTimelag, int32_t nLaserOnShift)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_control_command(uint32_t nCardNo, uint32_t nHead, uint32_t nAxis, uint32_t nData)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static int32_t SCANLAB_CALLINGCONVENTION emulated_n_activate_scanahead_autodelays(uint32_t nCardNo, int32_t nMode)
+		{
+			emulateControlCommand(nCardNo);
+			return 0;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_scanahead_laser_shifts(uint32_t nCardNo, int32_t nDLasOn, int32_t nDLasOff)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_scanahead_line_params(uint32_t nCardNo, uint32_t nCornerScale, uint32_t nEndScale, uint32_t nAccScale)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_scanahead_line_params_ex(uint32_t nCardNo, uint32_t nCornerScale, uint32_t nEndScale, uint32_t nAccScale, uint32_t nJumpScale)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_set_scanahead_params(uint32_t nCardNo, uint32_t nMode, uint32_t nHeadNo, uint32_t nTableNo, uint32_t nPreviewTime, uint32_t nVMax, double dAmax)
+		{
+			emulateControlCommand(nCardNo);
+			return 0;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_scanahead_speed_control(uint32_t nCardNo, uint32_t nMode)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_angle(uint32_t nCardNo, uint32_t nHeadNo, double dAngle, uint32_t nAtOnce)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_scale(uint32_t nCardNo, uint32_t nHeadNo, double dScaleFactor, uint32_t nAtOnce)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_offset(uint32_t nCardNo, uint32_t nHeadNo, int32_t nXOffset, int32_t nYOffset, uint32_t nAtOnce)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_matrix(uint32_t nCardNo, uint32_t nHeadNo, double dM11, double dM12, double dM21, double dM22, uint32_t nAtOnce)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_transform(int32_t * pSignal1, int32_t * pSignal2, uint8_t * pTransform, uint32_t nCode)
+		{
+			return 0;
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_upload_transform(uint32_t nCardNo, uint32_t nHeadNo, uint8_t * pTransformData)
+		{
+			emulateControlCommand(nCardNo);
+			return 0;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_timelag_compensation(uint32_t nCardNo, uint32_t nHeadNo, uint32_t nTimelagXY, uint32_t nTimelagZ)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_init_fly_2d(uint32_t nCardNo, int32_t nOffsetX, int32_t nOffsetY, uint32_t nNo)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_activate_fly_2d(uint32_t nCardNo, const double ScaleX, const double ScaleY)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_activate_fly_2d_encoder(uint32_t nCardNo, const double ScaleX, const double ScaleY, int32_t nEncoderOffsetX, int32_t nEncoderOffsetY)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_fly_2d(uint32_t nCardNo, const double ScaleX, const double ScaleY)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_get_fly_2d_offset(uint32_t nCardNo, const int32_t * pOffsetX, const int32_t* pOffsetY)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_fly_x_pos(uint32_t nCardNo, const double ScaleX)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_fly_y_pos(uint32_t nCardNo, const double ScaleY)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_fly_x(uint32_t nCardNo, const double ScaleX)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_fly_y(uint32_t nCardNo, const double ScaleY)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_fly_return(uint32_t nCardNo, int32_t sX, int32_t nY)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_get_encoder(uint32_t nCardNo, const int32_t* pEncoderX, const int32_t* pEncoderY)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_get_marking_info(uint32_t nCardNo)
+		{
+			emulateControlCommand(nCardNo);
+			return 0;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_wait_for_encoder(uint32_t nCardNo, int32_t nValue, uint32_t nEncoderNo)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_wait_for_encoder_mode(uint32_t nCardNo, int32_t nValue, uint32_t nEncoderNo, int32_t nMode)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_fly_limits(uint32_t nCardNo, int32_t nXMin, int32_t nXMax, int32_t nYMin, int32_t nYMax)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_range_checking(uint32_t nCardNo, uint32_t nHeadNo, uint32_t nMode, uint32_t nData)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_stop_execution(uint32_t nCardNo)
+		{
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			getEmulatedCard(nCardNo).stopExecution(std::chrono::steady_clock::now());
+		}
+
+		static int32_t SCANLAB_CALLINGCONVENTION emulated_n_read_multi_mcbsp(uint32_t nCardNo, uint32_t nRegisterNo)
+		{
+			emulateControlCommand(nCardNo);
+			return 0;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_rs232_write_data(uint32_t nCardNo, uint32_t nData)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static uint32_t SCANLAB_CALLINGCONVENTION emulated_n_rs232_read_data(uint32_t nCardNo)
+		{
+			emulateControlCommand(nCardNo);
+			return 0;
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_set_mcbsp_out_oie_ctrl(uint32_t nCardNo, uint32_t nSignalID1, uint32_t nSignalID2)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_eth_config_waveform_streaming_ctrl(uint32_t nCardNo, uint32_t nSize, uint32_t nFlags)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_eth_set_high_performance_mode(uint32_t nCardNo, uint32_t nMode)
+		{
+			emulateControlCommand(nCardNo);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_list_repeat(uint32_t nCardNo)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_list_until(uint32_t nCardNo, uint32_t nNumberOfRepetitions)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_list_jump_rel_cond(uint32_t nCardNo, uint32_t nMask1, uint32_t nMask0, int32_t nRelativeJumpPosition)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+		static void SCANLAB_CALLINGCONVENTION emulated_n_list_jump_rel(uint32_t nCardNo, int32_t nRelativeJumpPosition)
+		{
+			emulateListCommand(nCardNo, eEmulatedListCommand::Nop);
+		}
+
+
+		void CScanLabSDK::bindEmulation(uint32_t nSerialNumber)
+		{
+			{
+				std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+				s_nEmulatedSerialNumber = nSerialNumber;
+			}
+
+			ptr_init_rtc6_dll = &emulated_init_rtc6_dll;
+			ptr_free_rtc6_dll = &emulated_free_rtc6_dll;
+			ptr_eth_convert_string_to_ip = &emulated_eth_convert_string_to_ip;
+			ptr_eth_set_search_cards_timeout = &emulated_eth_set_search_cards_timeout;
+			ptr_eth_search_cards_range = &emulated_eth_search_cards_range;
+			ptr_rtc6_count_cards = &emulated_rtc6_count_cards;
+			ptr_eth_count_cards = &emulated_eth_count_cards;
+			ptr_eth_found_cards = &emulated_eth_found_cards;
+			ptr_eth_assign_card = &emulated_eth_assign_card;
+			ptr_eth_remove_card = &emulated_eth_remove_card;
+			ptr_acquire_rtc = &emulated_acquire_rtc;
+			ptr_release_rtc = &emulated_release_rtc;
+			ptr_n_get_serial_number = &emulated_n_get_serial_number;
+			ptr_eth_get_serial_search = &emulated_eth_get_serial_search;
+			ptr_eth_search_cards = &emulated_eth_search_cards;
+			ptr_n_load_correction_file = &emulated_n_load_correction_file;
+			ptr_n_eth_set_com_timeouts_auto = &emulated_n_eth_set_com_timeouts_auto;
+			ptr_n_eth_get_com_timeouts_auto = &emulated_n_eth_get_com_timeouts_auto;
+			ptr_n_select_cor_table = &emulated_n_select_cor_table;
+			ptr_n_config_list = &emulated_n_config_list;
+			ptr_n_set_laser_mode = &emulated_n_set_laser_mode;
+			ptr_n_set_laser_control = &emulated_n_set_laser_control;
+			ptr_n_set_auto_laser_control = &emulated_n_set_auto_laser_control;
+			ptr_n_set_laser_pulses = &emulated_n_set_laser_pulses;
+			ptr_n_set_standby = &emulated_n_set_standby;
+			ptr_n_get_last_error = &emulated_n_get_last_error;
+			ptr_get_last_error = &emulated_get_last_error;
+			ptr_n_load_program_file = &emulated_n_load_program_file;
+			ptr_n_get_table_para = &emulated_n_get_table_para;
+			ptr_n_set_end_of_list = &emulated_n_set_end_of_list;
+			ptr_n_execute_list_pos = &emulated_n_execute_list_pos;
+			ptr_n_auto_change_pos = &emulated_n_auto_change_pos;
+			ptr_n_load_list = &emulated_n_load_list;
+			ptr_n_read_status = &emulated_n_read_status;
+			ptr_n_get_list_space = &emulated_n_get_list_space;
+			ptr_n_set_scanner_delays = &emulated_n_set_scanner_delays;
+			ptr_n_set_mark_speed = &emulated_n_set_mark_speed;
+			ptr_n_set_jump_speed = &emulated_n_set_jump_speed;
+			ptr_n_write_io_port = &emulated_n_write_io_port;
+			ptr_n_write_8bit_port = &emulated_n_write_8bit_port;
+			ptr_n_write_da_1 = &emulated_n_write_da_1;
+			ptr_n_write_da_2 = &emulated_n_write_da_2;
+			ptr_n_write_io_port_list = &emulated_n_write_io_port_list;
+			ptr_n_write_io_port_mask_list = &emulated_n_write_io_port_mask_list;
+			ptr_n_write_8bit_port_list = &emulated_n_write_8bit_port_list;
+			ptr_n_write_da_1_list = &emulated_n_write_da_1_list;
+			ptr_n_write_da_2_list = &emulated_n_write_da_2_list;
+			ptr_n_jump_abs = &emulated_n_jump_abs;
+			ptr_n_mark_abs = &emulated_n_mark_abs;
+			ptr_n_long_delay = &emulated_n_long_delay;
+			ptr_n_get_status = &emulated_n_get_status;
+			ptr_n_get_input_pointer = &emulated_n_get_input_pointer;
+			ptr_n_set_laser_delays = &emulated_n_set_laser_delays;
+			ptr_n_set_start_list_pos = &emulated_n_set_start_list_pos;
+			ptr_n_set_defocus_list = &emulated_n_set_defocus_list;
+			ptr_n_get_head_status = &emulated_n_get_head_status;
+			ptr_n_get_value = &emulated_n_get_value;
+			ptr_get_dll_version = &emulated_get_dll_version;
+			ptr_n_get_hex_version = &emulated_n_get_hex_version;
+			ptr_n_get_bios_version = &emulated_n_get_bios_version;
+			ptr_n_get_rtc_version = &emulated_n_get_rtc_version;
+			ptr_n_get_card_type = &emulated_n_get_card_type;
+			ptr_n_set_mcbsp_freq = &emulated_n_set_mcbsp_freq;
+			ptr_n_mcbsp_init = &emulated_n_mcbsp_init;
+			ptr_n_mcbsp_init_spi = &emulated_n_mcbsp_init_spi;
+			ptr_n_set_mcbsp_out_ptr = &emulated_n_set_mcbsp_out_ptr;
+			ptr_n_set_multi_mcbsp_in = &emulated_n_set_multi_mcbsp_in;
+			ptr_n_set_multi_mcbsp_in_list = &emulated_n_set_multi_mcbsp_in_list;
+			ptr_n_set_laser_power = &emulated_n_set_laser_power;
+			ptr_n_list_nop = &emulated_n_list_nop;
+			ptr_n_set_free_variable_list = &emulated_n_set_free_variable_list;
+			ptr_n_set_free_variable = &emulated_n_set_free_variable;
+			ptr_n_get_free_variable = &emulated_n_get_free_variable;
+			ptr_n_set_trigger = &emulated_n_set_trigger;
+			ptr_n_set_trigger4 = &emulated_n_set_trigger4;
+			ptr_n_set_trigger8 = &emulated_n_set_trigger8;
+			ptr_n_set_control_mode = &emulated_n_set_control_mode;
+			ptr_n_set_laser_pulses_ctrl = &emulated_n_set_laser_pulses_ctrl;
+			ptr_n_set_mark_speed_ctrl = &emulated_n_set_mark_speed_ctrl;
+			ptr_n_set_jump_speed_ctrl = &emulated_n_set_jump_speed_ctrl;
+			ptr_n_set_firstpulse_killer = &emulated_n_set_firstpulse_killer;
+			ptr_n_set_firstpulse_killer_list = &emulated_n_set_firstpulse_killer_list;
+			ptr_n_set_qswitch_delay = &emulated_n_set_qswitch_delay;
+			ptr_n_set_qswitch_delay_list = &emulated_n_set_qswitch_delay_list;
+			ptr_n_write_da_x = &emulated_n_write_da_x;
+			ptr_n_set_laser_pin_out = &emulated_n_set_laser_pin_out;
+			ptr_n_set_laser_pin_out_list = &emulated_n_set_laser_pin_out_list;
+			ptr_n_get_laser_pin_in = &emulated_n_get_laser_pin_in;
+			ptr_n_set_sky_writing_para = &emulated_n_set_sky_writing_para;
+			ptr_n_set_sky_writing_limit = &emulated_n_set_sky_writing_limit;
+			ptr_n_set_sky_writing_mode = &emulated_n_set_sky_writing_mode;
+			ptr_n_set_sky_writing = &emulated_n_set_sky_writing;
+			ptr_n_set_sky_writing_para_list = &emulated_n_set_sky_writing_para_list;
+			ptr_n_set_sky_writing_list = &emulated_n_set_sky_writing_list;
+			ptr_n_set_sky_writing_limit_list = &emulated_n_set_sky_writing_limit_list;
+			ptr_n_set_sky_writing_mode_list = &emulated_n_set_sky_writing_mode_list;
+			ptr_n_control_command = &emulated_n_control_command;
+			ptr_n_get_scanahead_params = &emulated_n_get_scanahead_params;
+			ptr_n_activate_scanahead_autodelays = &emulated_n_activate_scanahead_autodelays;
+			ptr_n_set_scanahead_laser_shifts = &emulated_n_set_scanahead_laser_shifts;
+			ptr_n_set_scanahead_line_params = &emulated_n_set_scanahead_line_params;
+			ptr_n_set_scanahead_line_params_ex = &emulated_n_set_scanahead_line_params_ex;
+			ptr_n_set_scanahead_params = &emulated_n_set_scanahead_params;
+			ptr_n_set_scanahead_speed_control = &emulated_n_set_scanahead_speed_control;
+			ptr_n_micro_vector_abs_3d = &emulated_n_micro_vector_abs_3d;
+			ptr_n_micro_vector_rel_3d = &emulated_n_micro_vector_rel_3d;
+			ptr_n_micro_vector_abs = &emulated_n_micro_vector_abs;
+			ptr_n_micro_vector_rel = &emulated_n_micro_vector_rel;
+			ptr_n_get_error = &emulated_n_get_error;
+			ptr_n_reset_error = &emulated_n_reset_error;
+			ptr_n_set_angle = &emulated_n_set_angle;
+			ptr_n_set_scale = &emulated_n_set_scale;
+			ptr_n_set_offset = &emulated_n_set_offset;
+			ptr_n_set_matrix = &emulated_n_set_matrix;
+			ptr_n_get_waveform_offset = &emulated_n_get_waveform_offset;
+			ptr_n_measurement_status = &emulated_n_measurement_status;
+			ptr_transform = &emulated_transform;
+			ptr_n_upload_transform = &emulated_n_upload_transform;
+			ptr_n_set_timelag_compensation = &emulated_n_set_timelag_compensation;
+			ptr_n_init_fly_2d = &emulated_n_init_fly_2d;
+			ptr_n_activate_fly_2d = &emulated_n_activate_fly_2d;
+			ptr_n_activate_fly_2d_encoder = &emulated_n_activate_fly_2d_encoder;
+			ptr_n_set_fly_2d = &emulated_n_set_fly_2d;
+			ptr_n_get_fly_2d_offset = &emulated_n_get_fly_2d_offset;
+			ptr_n_set_fly_x_pos = &emulated_n_set_fly_x_pos;
+			ptr_n_set_fly_y_pos = &emulated_n_set_fly_y_pos;
+			ptr_n_set_fly_x = &emulated_n_set_fly_x;
+			ptr_n_set_fly_y = &emulated_n_set_fly_y;
+			ptr_n_fly_return = &emulated_n_fly_return;
+			ptr_n_get_encoder = &emulated_n_get_encoder;
+			ptr_n_get_marking_info = &emulated_n_get_marking_info;
+			ptr_n_wait_for_encoder = &emulated_n_wait_for_encoder;
+			ptr_n_wait_for_encoder_mode = &emulated_n_wait_for_encoder_mode;
+			ptr_n_set_fly_limits = &emulated_n_set_fly_limits;
+			ptr_n_range_checking = &emulated_n_range_checking;
+			ptr_n_stop_execution = &emulated_n_stop_execution;
+			ptr_n_timed_mark_abs = &emulated_n_timed_mark_abs;
+			ptr_n_read_multi_mcbsp = &emulated_n_read_multi_mcbsp;
+			ptr_n_uart_config = &emulated_n_uart_config;
+			ptr_n_rs232_write_data = &emulated_n_rs232_write_data;
+			ptr_n_rs232_read_data = &emulated_n_rs232_read_data;
+			ptr_n_set_mcbsp_out_oie_ctrl = &emulated_n_set_mcbsp_out_oie_ctrl;
+			ptr_n_eth_config_waveform_streaming_ctrl = &emulated_n_eth_config_waveform_streaming_ctrl;
+			ptr_n_eth_set_high_performance_mode = &emulated_n_eth_set_high_performance_mode;
+			ptr_n_list_repeat = &emulated_n_list_repeat;
+			ptr_n_list_until = &emulated_n_list_until;
+			ptr_n_list_jump_rel_cond = &emulated_n_list_jump_rel_cond;
+			ptr_n_list_jump_rel = &emulated_n_list_jump_rel;
+
+			m_bIsEmulated = true;
+		}
+
+		bool CScanLabSDK::isEmulated()
+		{
+			return m_bIsEmulated;
+		}
+
+		void CScanLabSDK::getEmulationStatistics(uint32_t nCardNo, sScanLabEmulationStatistics& statistics)
+		{
+			if (!m_bIsEmulated)
+				throw std::runtime_error("RTC SDK is not emulated");
+
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			statistics = getEmulatedCard(nCardNo, false).m_Statistics;
+		}
+
+		void CScanLabSDK::resetEmulationStatistics(uint32_t nCardNo)
+		{
+			if (!m_bIsEmulated)
+				throw std::runtime_error("RTC SDK is not emulated");
+
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			getEmulatedCard(nCardNo, false).m_Statistics = sScanLabEmulationStatistics();
+		}
+
+		void CScanLabSDK::setEmulationTimeFactor(double dTimeFactor)
+		{
+			if (!m_bIsEmulated)
+				throw std::runtime_error("RTC SDK is not emulated");
+			if (!(dTimeFactor >= 0.0))
+				throw std::runtime_error("invalid emulation time factor");
+
+			std::lock_guard<std::mutex> lockGuard(s_EmulationMutex);
+			s_dEmulationTimeFactor = dTimeFactor;
+		}
+
+	}
+}
@@ -0,0 +1,96 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: Declarations of the built-in RTC6 card emulation that CScanLabSDK can be bound to instead of the RTC DLL.
+
+*/
+
+
+#ifndef __LIBMCDRIVER_SCANLAB_SDKEMULATION
+#define __LIBMCDRIVER_SCANLAB_SDKEMULATION
+
+#include <cstdint>
+
+// The emulation models the RTC6 list memory of 2^23 entries, split into two lists by n_config_list.
+#define RTC6EMULATION_LISTMEMORYSIZE (1UL << 23)
+#define RTC6EMULATION_DEFAULTLISTSIZE (1UL << 22)
+
+// Recording ring buffer, matches the maximum measurement position of the RTC6.
+#define RTC6EMULATION_RECORDINGBUFFERSIZE ((1UL << 22) - 1)
+#define RTC6EMULATION_RECORDINGCHANNELCOUNT 8
+
+// Cards 1 to MAXCARDCOUNT are emulated, card N reports the emulated serial number + N - 1.
+#define RTC6EMULATION_MAXCARDCOUNT 8
+#define RTC6EMULATION_FREEVARIABLECOUNT 8
+#define RTC6EMULATION_DLLVERSION 630
+#define RTC6EMULATION_HEXVERSION 630
+#define RTC6EMULATION_BIOSVERSION 0x0510
+#define RTC6EMULATION_RTCVERSION 0x00010630
+#define RTC6EMULATION_CARDTYPE 6
+
+// FNV-1a parameters of the list command hash.
+#define RTC6EMULATION_HASHOFFSETBASIS 0xcbf29ce484222325ULL
+#define RTC6EMULATION_HASHPRIME 0x100000001b3ULL
+
+// Speeds in bits per ms, as after n_set_mark_speed / n_set_jump_speed.
+#define RTC6EMULATION_DEFAULTMARKSPEED 1000.0
+#define RTC6EMULATION_DEFAULTJUMPSPEED 1000.0
+
+// Wall clock time per virtual time for which an executed list reports busy, 1.0 is real time.
+#define RTC6EMULATION_DEFAULTTIMEFACTOR 1.0
+
+// Error bits of n_get_last_error
+#define RTC6EMULATION_ERROR_INVALIDPARAMETER 16
+#define RTC6EMULATION_ERROR_BUSY 32
+#define RTC6EMULATION_ERROR_LISTCOMMANDREJECTED 64
+
+namespace LibMCDriver_ScanLab {
+	namespace Impl {
+
+		// Counters of an emulated card. Times are virtual scanner times, derived from the
+		// executed list commands and the speeds and delays that were active at that point.
+		typedef struct _sScanLabEmulationStatistics {
+			uint64_t m_nListCommandCount;
+			uint64_t m_nRejectedListCommandCount;
+			uint64_t m_nExecutedListCount;
+			uint64_t m_nMarkCount;
+			uint64_t m_nJumpCount;
+			uint64_t m_nRecordedSampleCount;
+			double m_dMarkTimeInMicroseconds;
+			double m_dJumpTimeInMicroseconds;
+			double m_dDelayTimeInMicroseconds;
+			double m_dExecutionTimeInMicroseconds;
+			// Order dependent hash of all accepted list commands, including their parameters.
+			uint64_t m_nListCommandHash;
+		} sScanLabEmulationStatistics;
+
+	}
+}
+
+#endif // __LIBMCDRIVER_SCANLAB_SDKEMULATION
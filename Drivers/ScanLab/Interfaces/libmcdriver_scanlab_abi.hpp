@@ -1944,6 +1944,74 @@ LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_rtcco
 */
 LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_rtccontext_disablelinesubdivision(LibMCDriver_ScanLab_RTCContext pRTCContext);
 
+/**
+* Enables the compilation of layers in AddLayerToList. Layers are converted into list commands in parallel before they are written to the list. Compiled layers are cached, so that repeated layers are not compiled again. Layers are written directly if a power modulation callback or a laser power calibration is set.
+*
+* @param[in] pRTCContext - RTCContext instance.
+* @param[in] nThreadCount - Number of compile threads. 0 uses the number of hardware threads. Maximum is 64.
+* @param[in] nMaxCachedLayers - Maximum number of compiled layers that are kept. 0 disables the cache. Maximum is 4096.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_rtccontext_enablecommandstreamcompilation(LibMCDriver_ScanLab_RTCContext pRTCContext, LibMCDriver_ScanLab_uint32 nThreadCount, LibMCDriver_ScanLab_uint32 nMaxCachedLayers);
+
+/**
+* Disables the compilation of layers and releases all cached layers. This is the default.
+*
+* @param[in] pRTCContext - RTCContext instance.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_rtccontext_disablecommandstreamcompilation(LibMCDriver_ScanLab_RTCContext pRTCContext);
+
+/**
+* Returns if layers are compiled in AddLayerToList.
+*
+* @param[in] pRTCContext - RTCContext instance.
+* @param[out] pIsEnabled - True if command stream compilation is enabled.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_rtccontext_commandstreamcompilationisenabled(LibMCDriver_ScanLab_RTCContext pRTCContext, bool * pIsEnabled);
+
+/**
+* Releases all cached compiled layers.
+*
+* @param[in] pRTCContext - RTCContext instance.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_rtccontext_clearcompiledlayercache(LibMCDriver_ScanLab_RTCContext pRTCContext);
+
+/**
+* Returns statistics of the command stream compilation. Fails if command stream compilation is not enabled.
+*
+* @param[in] pRTCContext - RTCContext instance.
+* @param[out] pCompiledLayerCount - Number of compiled layers.
+* @param[out] pCacheHitCount - Number of layers that have been taken from the cache.
+* @param[out] pLastCommandCount - Number of list commands of the last layer.
+* @param[out] pLastCompileTime - Compile time of the last layer in milliseconds, including the cache lookup.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_rtccontext_getcommandstreamstatistics(LibMCDriver_ScanLab_RTCContext pRTCContext, LibMCDriver_ScanLab_uint32 * pCompiledLayerCount, LibMCDriver_ScanLab_uint32 * pCacheHitCount, LibMCDriver_ScanLab_uint64 * pLastCommandCount, LibMCDriver_ScanLab_double * pLastCompileTime);
+
+/**
+* Resets the statistics of the emulated card. Fails if the SDK is not emulated.
+*
+* @param[in] pRTCContext - RTCContext instance.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_rtccontext_resetemulationstatistics(LibMCDriver_ScanLab_RTCContext pRTCContext);
+
+/**
+* Returns the statistics of the emulated card since the last reset. Fails if the SDK is not emulated.
+*
+* @param[in] pRTCContext - RTCContext instance.
+* @param[out] pListCommandCount - Number of accepted list commands.
+* @param[out] pListCommandHash - Order dependent hash of all accepted list commands and their parameters.
+* @param[out] pMarkTime - Emulated mark time in ms.
+* @param[out] pJumpTime - Emulated jump time in ms.
+* @param[out] pExecutionTime - Emulated execution time including delays in ms.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_rtccontext_getemulationstatistics(LibMCDriver_ScanLab_RTCContext pRTCContext, LibMCDriver_ScanLab_uint64 * pListCommandCount, LibMCDriver_ScanLab_uint64 * pListCommandHash, LibMCDriver_ScanLab_double * pMarkTime, LibMCDriver_ScanLab_double * pJumpTime, LibMCDriver_ScanLab_double * pExecutionTime);
+
 /**
 * Reads a multi MCBSP register from the RTC Card. Should be used only for debugging purposes.
 *
@@ -2147,6 +2215,33 @@ LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_drive
 */
 LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_driver_scanlab_loadcustomsdk(LibMCDriver_ScanLab_Driver_ScanLab pDriver_ScanLab, LibMCDriver_ScanLab_uint64 nScanlabDLLBufferSize, const LibMCDriver_ScanLab_uint8 * pScanlabDLLBuffer);
 
+/**
+* Initializes the ScanLab SDK with a built-in RTC6 card emulation instead of the RTC DLL. The emulated card executes lists in virtual time and allows to benchmark list generation without hardware.
+*
+* @param[in] pDriver_ScanLab - Driver_ScanLab instance.
+* @param[in] nSerialNumber - Serial number of the first emulated card. Card N reports SerialNumber + N - 1.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_driver_scanlab_loademulatedsdk(LibMCDriver_ScanLab_Driver_ScanLab pDriver_ScanLab, LibMCDriver_ScanLab_uint32 nSerialNumber);
+
+/**
+* Returns if the loaded ScanLab SDK is the built-in card emulation.
+*
+* @param[in] pDriver_ScanLab - Driver_ScanLab instance.
+* @param[out] pIsEmulated - True if LoadEmulatedSDK has been called.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_driver_scanlab_issdkemulated(LibMCDriver_ScanLab_Driver_ScanLab pDriver_ScanLab, bool * pIsEmulated);
+
+/**
+* Sets how fast emulated cards report their lists as busy, relative to the virtual execution time of the list. Applies to all emulated cards. Fails if the SDK is not emulated.
+*
+* @param[in] pDriver_ScanLab - Driver_ScanLab instance.
+* @param[in] dTimeFactor - Wall clock time per virtual time. 1.0 is real time, 0.0 finishes every list immediately. MUST not be negative.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_driver_scanlab_setemulationtimefactor(LibMCDriver_ScanLab_Driver_ScanLab pDriver_ScanLab, LibMCDriver_ScanLab_double dTimeFactor);
+
 /**
 * Creates and initializes a new RTC selector singleton. Should only be called once per Process.
 *
@@ -2406,6 +2501,54 @@ LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_drive
 */
 LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_driver_scanlab_rtc6_disableattributefilter(LibMCDriver_ScanLab_Driver_ScanLab_RTC6 pDriver_ScanLab_RTC6);
 
+/**
+* Enables double buffered list streaming for DrawLayer. The layer is split into chunks that are alternately loaded into list 1 and list 2, so marking starts as soon as the first chunk is loaded. Needs lists that are larger than the chunk size plus a reserve of 16384 positions.
+*
+* @param[in] pDriver_ScanLab_RTC6 - Driver_ScanLab_RTC6 instance.
+* @param[in] nChunkSize - Number of list positions per chunk. Minimum is 1024.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_driver_scanlab_rtc6_enableliststreaming(LibMCDriver_ScanLab_Driver_ScanLab_RTC6 pDriver_ScanLab_RTC6, LibMCDriver_ScanLab_uint32 nChunkSize);
+
+/**
+* Disables list streaming. DrawLayer loads the complete layer into list 1 before execution. This is the default.
+*
+* @param[in] pDriver_ScanLab_RTC6 - Driver_ScanLab_RTC6 instance.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_driver_scanlab_rtc6_disableliststreaming(LibMCDriver_ScanLab_Driver_ScanLab_RTC6 pDriver_ScanLab_RTC6);
+
+/**
+* Returns if list streaming is enabled for DrawLayer.
+*
+* @param[in] pDriver_ScanLab_RTC6 - Driver_ScanLab_RTC6 instance.
+* @param[out] pStreamingIsEnabled - Flag if list streaming is enabled.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_driver_scanlab_rtc6_liststreamingisenabled(LibMCDriver_ScanLab_Driver_ScanLab_RTC6 pDriver_ScanLab_RTC6, bool * pStreamingIsEnabled);
+
+/**
+* Configures how DrawLayer waits for the end of list execution. A monitor thread polls the card adaptively between the minimum and maximum poll interval, depending on the estimated remaining list execution time. Status parameters are published at the status update interval, and only if their values have changed.
+*
+* @param[in] pDriver_ScanLab_RTC6 - Driver_ScanLab_RTC6 instance.
+* @param[in] nMinPollIntervalInMicroseconds - Poll interval close to the end of the list, in microseconds. Minimum is 50, default is 250.
+* @param[in] nMaxPollIntervalInMicroseconds - Poll interval far from the end of the list, in microseconds. MUST be at least MinPollIntervalInMicroseconds. Maximum is 1000000, default is 10000.
+* @param[in] nStatusUpdateIntervalInMilliseconds - Interval of status parameter updates while drawing, in milliseconds. Minimum is 1, maximum is 60000, default is 100.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_driver_scanlab_rtc6_setstatusmonitorintervals(LibMCDriver_ScanLab_Driver_ScanLab_RTC6 pDriver_ScanLab_RTC6, LibMCDriver_ScanLab_uint32 nMinPollIntervalInMicroseconds, LibMCDriver_ScanLab_uint32 nMaxPollIntervalInMicroseconds, LibMCDriver_ScanLab_uint32 nStatusUpdateIntervalInMilliseconds);
+
+/**
+* Returns the status monitor intervals of DrawLayer.
+*
+* @param[in] pDriver_ScanLab_RTC6 - Driver_ScanLab_RTC6 instance.
+* @param[out] pMinPollIntervalInMicroseconds - Poll interval close to the end of the list, in microseconds.
+* @param[out] pMaxPollIntervalInMicroseconds - Poll interval far from the end of the list, in microseconds.
+* @param[out] pStatusUpdateIntervalInMilliseconds - Interval of status parameter updates while drawing, in milliseconds.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_driver_scanlab_rtc6_getstatusmonitorintervals(LibMCDriver_ScanLab_Driver_ScanLab_RTC6 pDriver_ScanLab_RTC6, LibMCDriver_ScanLab_uint32 * pMinPollIntervalInMicroseconds, LibMCDriver_ScanLab_uint32 * pMaxPollIntervalInMicroseconds, LibMCDriver_ScanLab_uint32 * pStatusUpdateIntervalInMilliseconds);
+
 /**
 * Draws a layer of a build stream. Blocks until the layer is drawn.
 *
@@ -2714,6 +2857,39 @@ LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_drive
 */
 LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_driver_scanlab_rtc6xn_drawlayer(LibMCDriver_ScanLab_Driver_ScanLab_RTC6xN pDriver_ScanLab_RTC6xN, const char * pStreamUUID, LibMCDriver_ScanLab_uint32 nLayerIndex, bool bFailIfNonAssignedDataExists);
 
+/**
+* Draws a layer of a build stream on List 1 of all scanners. Every scanner builds its list in its own worker thread. All scanners are started together as soon as every list is complete. Blocks until the layer is drawn.
+*
+* @param[in] pDriver_ScanLab_RTC6xN - Driver_ScanLab_RTC6xN instance.
+* @param[in] pStreamUUID - UUID of the build stream. Must have been loaded in memory by the system.
+* @param[in] nLayerIndex - Layer index of the build file.
+* @param[in] bFailIfNonAssignedDataExists - If true, the call will fail in case a layer contains data that is not assigned to any defined scanner card.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_driver_scanlab_rtc6xn_drawlayerparallel(LibMCDriver_ScanLab_Driver_ScanLab_RTC6xN pDriver_ScanLab_RTC6xN, const char * pStreamUUID, LibMCDriver_ScanLab_uint32 nLayerIndex, bool bFailIfNonAssignedDataExists);
+
+/**
+* Returns the timing of the last call of DrawLayerParallel. Fails if DrawLayerParallel has not been called yet.
+*
+* @param[in] pDriver_ScanLab_RTC6xN - Driver_ScanLab_RTC6xN instance.
+* @param[out] pLayerLatency - Time in milliseconds from the call until all scanners have finished.
+* @param[out] pStartSkew - Time in milliseconds between the start of the first and the last scanner.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_driver_scanlab_rtc6xn_getlayerdispatchstatistics(LibMCDriver_ScanLab_Driver_ScanLab_RTC6xN pDriver_ScanLab_RTC6xN, LibMCDriver_ScanLab_double * pLayerLatency, LibMCDriver_ScanLab_double * pStartSkew);
+
+/**
+* Returns the timing of a scanner during the last call of DrawLayerParallel. Fails if DrawLayerParallel has not been called yet.
+*
+* @param[in] pDriver_ScanLab_RTC6xN - Driver_ScanLab_RTC6xN instance.
+* @param[in] nScannerIndex - Index of the scanner (1-based). MUST be between 1 and ScannerCount
+* @param[out] pListBuildTime - Time in milliseconds to build the list of the scanner.
+* @param[out] pStartDelay - Time in milliseconds from the call until the scanner has been started.
+* @param[out] pExecutionTime - Time in milliseconds from the start until the scanner has finished.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLAB_DECLSPEC LibMCDriver_ScanLabResult libmcdriver_scanlab_driver_scanlab_rtc6xn_getscannerdispatchstatistics(LibMCDriver_ScanLab_Driver_ScanLab_RTC6xN pDriver_ScanLab_RTC6xN, LibMCDriver_ScanLab_uint32 nScannerIndex, LibMCDriver_ScanLab_double * pListBuildTime, LibMCDriver_ScanLab_double * pStartDelay, LibMCDriver_ScanLab_double * pExecutionTime);
+
 /**
 * Set RTC Ethernet communication timeouts for all existing and future connections.
 *
@@ -1764,6 +1764,53 @@ public:
 	*/
 	virtual void DisableLineSubdivision() = 0;
 
+	/**
+	* IRTCContext::EnableCommandStreamCompilation - Enables the compilation of layers in AddLayerToList. Layers are converted into list commands in parallel before they are written to the list. Compiled layers are cached, so that repeated layers are not compiled again. Layers are written directly if a power modulation callback or a laser power calibration is set.
+	* @param[in] nThreadCount - Number of compile threads. 0 uses the number of hardware threads. Maximum is 64.
+	* @param[in] nMaxCachedLayers - Maximum number of compiled layers that are kept. 0 disables the cache. Maximum is 4096.
+	*/
+	virtual void EnableCommandStreamCompilation(const LibMCDriver_ScanLab_uint32 nThreadCount, const LibMCDriver_ScanLab_uint32 nMaxCachedLayers) = 0;
+
+	/**
+	* IRTCContext::DisableCommandStreamCompilation - Disables the compilation of layers and releases all cached layers. This is the default.
+	*/
+	virtual void DisableCommandStreamCompilation() = 0;
+
+	/**
+	* IRTCContext::CommandStreamCompilationIsEnabled - Returns if layers are compiled in AddLayerToList.
+	* @return True if command stream compilation is enabled.
+	*/
+	virtual bool CommandStreamCompilationIsEnabled() = 0;
+
+	/**
+	* IRTCContext::ClearCompiledLayerCache - Releases all cached compiled layers.
+	*/
+	virtual void ClearCompiledLayerCache() = 0;
+
+	/**
+	* IRTCContext::GetCommandStreamStatistics - Returns statistics of the command stream compilation. Fails if command stream compilation is not enabled.
+	* @param[out] nCompiledLayerCount - Number of compiled layers.
+	* @param[out] nCacheHitCount - Number of layers that have been taken from the cache.
+	* @param[out] nLastCommandCount - Number of list commands of the last layer.
+	* @param[out] dLastCompileTime - Compile time of the last layer in milliseconds, including the cache lookup.
+	*/
+	virtual void GetCommandStreamStatistics(LibMCDriver_ScanLab_uint32 & nCompiledLayerCount, LibMCDriver_ScanLab_uint32 & nCacheHitCount, LibMCDriver_ScanLab_uint64 & nLastCommandCount, LibMCDriver_ScanLab_double & dLastCompileTime) = 0;
+
+	/**
+	* IRTCContext::ResetEmulationStatistics - Resets the statistics of the emulated card. Fails if the SDK is not emulated.
+	*/
+	virtual void ResetEmulationStatistics() = 0;
+
+	/**
+	* IRTCContext::GetEmulationStatistics - Returns the statistics of the emulated card since the last reset. Fails if the SDK is not emulated.
+	* @param[out] nListCommandCount - Number of accepted list commands.
+	* @param[out] nListCommandHash - Order dependent hash of all accepted list commands and their parameters.
+	* @param[out] dMarkTime - Emulated mark time in ms.
+	* @param[out] dJumpTime - Emulated jump time in ms.
+	* @param[out] dExecutionTime - Emulated execution time including delays in ms.
+	*/
+	virtual void GetEmulationStatistics(LibMCDriver_ScanLab_uint64 & nListCommandCount, LibMCDriver_ScanLab_uint64 & nListCommandHash, LibMCDriver_ScanLab_double & dMarkTime, LibMCDriver_ScanLab_double & dJumpTime, LibMCDriver_ScanLab_double & dExecutionTime) = 0;
+
 	/**
 	* IRTCContext::ReadMultiMCBSP - Reads a multi MCBSP register from the RTC Card. Should be used only for debugging purposes.
 	* @param[in] nRegisterNo - Number of the register to read.
@@ -1921,6 +1968,24 @@ public:
 	*/
 	virtual void LoadCustomSDK(const LibMCDriver_ScanLab_uint64 nScanlabDLLBufferSize, const LibMCDriver_ScanLab_uint8 * pScanlabDLLBuffer) = 0;
 
+	/**
+	* IDriver_ScanLab::LoadEmulatedSDK - Initializes the ScanLab SDK with a built-in RTC6 card emulation instead of the RTC DLL. The emulated card executes lists in virtual time and allows to benchmark list generation without hardware.
+	* @param[in] nSerialNumber - Serial number of the first emulated card. Card N reports SerialNumber + N - 1.
+	*/
+	virtual void LoadEmulatedSDK(const LibMCDriver_ScanLab_uint32 nSerialNumber) = 0;
+
+	/**
+	* IDriver_ScanLab::IsSDKEmulated - Returns if the loaded ScanLab SDK is the built-in card emulation.
+	* @return True if LoadEmulatedSDK has been called.
+	*/
+	virtual bool IsSDKEmulated() = 0;
+
+	/**
+	* IDriver_ScanLab::SetEmulationTimeFactor - Sets how fast emulated cards report their lists as busy, relative to the virtual execution time of the list. Applies to all emulated cards. Fails if the SDK is not emulated.
+	* @param[in] dTimeFactor - Wall clock time per virtual time. 1.0 is real time, 0.0 finishes every list immediately. MUST not be negative.
+	*/
+	virtual void SetEmulationTimeFactor(const LibMCDriver_ScanLab_double dTimeFactor) = 0;
+
 	/**
 	* IDriver_ScanLab::CreateRTCSelector - Creates and initializes a new RTC selector singleton. Should only be called once per Process.
 	* @return New Selector instance
@@ -2111,6 +2176,39 @@ public:
 	*/
 	virtual void DisableAttributeFilter() = 0;
 
+	/**
+	* IDriver_ScanLab_RTC6::EnableListStreaming - Enables double buffered list streaming for DrawLayer. The layer is split into chunks that are alternately loaded into list 1 and list 2, so marking starts as soon as the first chunk is loaded. Needs lists that are larger than the chunk size plus a reserve of 16384 positions.
+	* @param[in] nChunkSize - Number of list positions per chunk. Minimum is 1024.
+	*/
+	virtual void EnableListStreaming(const LibMCDriver_ScanLab_uint32 nChunkSize) = 0;
+
+	/**
+	* IDriver_ScanLab_RTC6::DisableListStreaming - Disables list streaming. DrawLayer loads the complete layer into list 1 before execution. This is the default.
+	*/
+	virtual void DisableListStreaming() = 0;
+
+	/**
+	* IDriver_ScanLab_RTC6::ListStreamingIsEnabled - Returns if list streaming is enabled for DrawLayer.
+	* @return Flag if list streaming is enabled.
+	*/
+	virtual bool ListStreamingIsEnabled() = 0;
+
+	/**
+	* IDriver_ScanLab_RTC6::SetStatusMonitorIntervals - Configures how DrawLayer waits for the end of list execution. A monitor thread polls the card adaptively between the minimum and maximum poll interval, depending on the estimated remaining list execution time. Status parameters are published at the status update interval, and only if their values have changed.
+	* @param[in] nMinPollIntervalInMicroseconds - Poll interval close to the end of the list, in microseconds. Minimum is 50, default is 250.
+	* @param[in] nMaxPollIntervalInMicroseconds - Poll interval far from the end of the list, in microseconds. MUST be at least MinPollIntervalInMicroseconds. Maximum is 1000000, default is 10000.
+	* @param[in] nStatusUpdateIntervalInMilliseconds - Interval of status parameter updates while drawing, in milliseconds. Minimum is 1, maximum is 60000, default is 100.
+	*/
+	virtual void SetStatusMonitorIntervals(const LibMCDriver_ScanLab_uint32 nMinPollIntervalInMicroseconds, const LibMCDriver_ScanLab_uint32 nMaxPollIntervalInMicroseconds, const LibMCDriver_ScanLab_uint32 nStatusUpdateIntervalInMilliseconds) = 0;
+
+	/**
+	* IDriver_ScanLab_RTC6::GetStatusMonitorIntervals - Returns the status monitor intervals of DrawLayer.
+	* @param[out] nMinPollIntervalInMicroseconds - Poll interval close to the end of the list, in microseconds.
+	* @param[out] nMaxPollIntervalInMicroseconds - Poll interval far from the end of the list, in microseconds.
+	* @param[out] nStatusUpdateIntervalInMilliseconds - Interval of status parameter updates while drawing, in milliseconds.
+	*/
+	virtual void GetStatusMonitorIntervals(LibMCDriver_ScanLab_uint32 & nMinPollIntervalInMicroseconds, LibMCDriver_ScanLab_uint32 & nMaxPollIntervalInMicroseconds, LibMCDriver_ScanLab_uint32 & nStatusUpdateIntervalInMilliseconds) = 0;
+
 	/**
 	* IDriver_ScanLab_RTC6::DrawLayer - Draws a layer of a build stream. Blocks until the layer is drawn.
 	* @param[in] sStreamUUID - UUID of the build stream. Must have been loaded in memory by the system.
@@ -2338,6 +2436,30 @@ public:
 	*/
 	virtual void DrawLayer(const std::string & sStreamUUID, const LibMCDriver_ScanLab_uint32 nLayerIndex, const bool bFailIfNonAssignedDataExists) = 0;
 
+	/**
+	* IDriver_ScanLab_RTC6xN::DrawLayerParallel - Draws a layer of a build stream on List 1 of all scanners. Every scanner builds its list in its own worker thread. All scanners are started together as soon as every list is complete. Blocks until the layer is drawn.
+	* @param[in] sStreamUUID - UUID of the build stream. Must have been loaded in memory by the system.
+	* @param[in] nLayerIndex - Layer index of the build file.
+	* @param[in] bFailIfNonAssignedDataExists - If true, the call will fail in case a layer contains data that is not assigned to any defined scanner card.
+	*/
+	virtual void DrawLayerParallel(const std::string & sStreamUUID, const LibMCDriver_ScanLab_uint32 nLayerIndex, const bool bFailIfNonAssignedDataExists) = 0;
+
+	/**
+	* IDriver_ScanLab_RTC6xN::GetLayerDispatchStatistics - Returns the timing of the last call of DrawLayerParallel. Fails if DrawLayerParallel has not been called yet.
+	* @param[out] dLayerLatency - Time in milliseconds from the call until all scanners have finished.
+	* @param[out] dStartSkew - Time in milliseconds between the start of the first and the last scanner.
+	*/
+	virtual void GetLayerDispatchStatistics(LibMCDriver_ScanLab_double & dLayerLatency, LibMCDriver_ScanLab_double & dStartSkew) = 0;
+
+	/**
+	* IDriver_ScanLab_RTC6xN::GetScannerDispatchStatistics - Returns the timing of a scanner during the last call of DrawLayerParallel. Fails if DrawLayerParallel has not been called yet.
+	* @param[in] nScannerIndex - Index of the scanner (1-based). MUST be between 1 and ScannerCount
+	* @param[out] dListBuildTime - Time in milliseconds to build the list of the scanner.
+	* @param[out] dStartDelay - Time in milliseconds from the call until the scanner has been started.
+	* @param[out] dExecutionTime - Time in milliseconds from the start until the scanner has finished.
+	*/
+	virtual void GetScannerDispatchStatistics(const LibMCDriver_ScanLab_uint32 nScannerIndex, LibMCDriver_ScanLab_double & dListBuildTime, LibMCDriver_ScanLab_double & dStartDelay, LibMCDriver_ScanLab_double & dExecutionTime) = 0;
+
 	/**
 	* IDriver_ScanLab_RTC6xN::SetAllCommunicationTimeouts - Set RTC Ethernet communication timeouts for all existing and future connections.
 	* @param[in] dInitialTimeout - Initial timeout in ms
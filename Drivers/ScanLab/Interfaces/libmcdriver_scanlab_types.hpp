@@ -245,6 +245,15 @@ typedef void * LibMCDriver_ScanLab_pvoid;
 #define LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELYNOTRECORDED 1140 /** RTC Channel Y not recorded. */
 #define LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELZNOTRECORDED 1141 /** RTC Channel Z not recorded. */
 #define LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELXANDYRECORDCOUNTMISMATCH 1142 /** RTC X and Y record count mismatch. */
+#define LIBMCDRIVER_SCANLAB_ERROR_INVALIDLISTSTREAMINGCHUNKSIZE 1143 /** Invalid list streaming chunk size. */
+#define LIBMCDRIVER_SCANLAB_ERROR_LISTSTREAMINGALREADYACTIVE 1144 /** List streaming is already active. */
+#define LIBMCDRIVER_SCANLAB_ERROR_LISTSTREAMINGNOTACTIVE 1145 /** List streaming is not active. */
+#define LIBMCDRIVER_SCANLAB_ERROR_INVALIDSTATUSMONITORINTERVAL 1146 /** Invalid status monitor interval. */
+#define LIBMCDRIVER_SCANLAB_ERROR_INVALIDCOMMANDSTREAMCONFIGURATION 1147 /** Invalid command stream configuration. */
+#define LIBMCDRIVER_SCANLAB_ERROR_COMMANDSTREAMCOMPILATIONNOTENABLED 1148 /** Command stream compilation is not enabled. */
+#define LIBMCDRIVER_SCANLAB_ERROR_NOLAYERDISPATCHSTATISTICS 1149 /** No layer dispatch statistics available. */
+#define LIBMCDRIVER_SCANLAB_ERROR_SDKISNOTEMULATED 1150 /** SDK is not emulated. */
+#define LIBMCDRIVER_SCANLAB_ERROR_INVALIDEMULATIONTIMEFACTOR 1151 /** Invalid emulation time factor. */
 
 /*************************************************************************************************************************
  Error strings for LibMCDriver_ScanLab
@@ -402,6 +411,15 @@ inline const char * LIBMCDRIVER_SCANLAB_GETERRORSTRING (LibMCDriver_ScanLabResul
     case LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELYNOTRECORDED: return "RTC Channel Y not recorded.";
     case LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELZNOTRECORDED: return "RTC Channel Z not recorded.";
     case LIBMCDRIVER_SCANLAB_ERROR_RTCCHANNELXANDYRECORDCOUNTMISMATCH: return "RTC X and Y record count mismatch.";
+    case LIBMCDRIVER_SCANLAB_ERROR_INVALIDLISTSTREAMINGCHUNKSIZE: return "Invalid list streaming chunk size.";
+    case LIBMCDRIVER_SCANLAB_ERROR_LISTSTREAMINGALREADYACTIVE: return "List streaming is already active.";
+    case LIBMCDRIVER_SCANLAB_ERROR_LISTSTREAMINGNOTACTIVE: return "List streaming is not active.";
+    case LIBMCDRIVER_SCANLAB_ERROR_INVALIDSTATUSMONITORINTERVAL: return "Invalid status monitor interval.";
+    case LIBMCDRIVER_SCANLAB_ERROR_INVALIDCOMMANDSTREAMCONFIGURATION: return "Invalid command stream configuration.";
+    case LIBMCDRIVER_SCANLAB_ERROR_COMMANDSTREAMCOMPILATIONNOTENABLED: return "Command stream compilation is not enabled.";
+    case LIBMCDRIVER_SCANLAB_ERROR_NOLAYERDISPATCHSTATISTICS: return "No layer dispatch statistics available.";
+    case LIBMCDRIVER_SCANLAB_ERROR_SDKISNOTEMULATED: return "SDK is not emulated.";
+    case LIBMCDRIVER_SCANLAB_ERROR_INVALIDEMULATIONTIMEFACTOR: return "Invalid emulation time factor.";
     default: return "unknown error";
   }
 }
@@ -793,6 +793,55 @@ typedef LibMCDriver_ScanLabOIEResult (*PLibMCDriver_ScanLabOIEOIEDevice_Retrieve
 */
 typedef LibMCDriver_ScanLabOIEResult (*PLibMCDriver_ScanLabOIEOIEDevice_ClearCurrentRecordingPtr) (LibMCDriver_ScanLabOIE_OIEDevice pOIEDevice);
 
+/**
+* Starts streaming all finished recording pages into a binary file in the driver working directory. Streamed records are freed from memory, so the current recording only holds records that have not been streamed yet. Fails if a recording stream is already active.
+*
+* @param[in] pOIEDevice - OIEDevice instance.
+* @param[in] eCompression - Compression of the stream chunks.
+* @param[in] nCompressionLevel - Compression level from 0 to 9. zlib compresses best at 9. LZ4 uses the fast compressor below level 3 and LZ4 HC from level 3. Ignored without compression.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_ScanLabOIEResult (*PLibMCDriver_ScanLabOIEOIEDevice_StartRecordingStreamPtr) (LibMCDriver_ScanLabOIE_OIEDevice pOIEDevice, eLibMCDriver_ScanLabOIERecordingStreamCompression eCompression, LibMCDriver_ScanLabOIE_uint32 nCompressionLevel);
+
+/**
+* Streams all remaining records of the current recording, waits for the background writer and closes the stream file. Does nothing if no recording stream is active. Throws the error of the background writer if the stream could not be written.
+*
+* @param[in] pOIEDevice - OIEDevice instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_ScanLabOIEResult (*PLibMCDriver_ScanLabOIEOIEDevice_StopRecordingStreamPtr) (LibMCDriver_ScanLabOIE_OIEDevice pOIEDevice);
+
+/**
+* Returns if a recording stream is active.
+*
+* @param[in] pOIEDevice - OIEDevice instance.
+* @param[out] pValue - Flag if a recording stream is active.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_ScanLabOIEResult (*PLibMCDriver_ScanLabOIEOIEDevice_RecordingStreamIsActivePtr) (LibMCDriver_ScanLabOIE_OIEDevice pOIEDevice, bool * pValue);
+
+/**
+* Returns the statistics of the active or last recording stream.
+*
+* @param[in] pOIEDevice - OIEDevice instance.
+* @param[out] pRecordCount - Number of records written to the stream.
+* @param[out] pChunkCount - Number of chunks written to the stream.
+* @param[out] pUncompressedSize - Uncompressed size of all chunks in bytes.
+* @param[out] pStreamSize - Size of the stream file in bytes.
+* @param[out] pDroppedRecordCount - Number of records that were dropped because the background writer could not keep up or has failed.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_ScanLabOIEResult (*PLibMCDriver_ScanLabOIEOIEDevice_GetRecordingStreamStatisticsPtr) (LibMCDriver_ScanLabOIE_OIEDevice pOIEDevice, LibMCDriver_ScanLabOIE_uint64 * pRecordCount, LibMCDriver_ScanLabOIE_uint64 * pChunkCount, LibMCDriver_ScanLabOIE_uint64 * pUncompressedSize, LibMCDriver_ScanLabOIE_uint64 * pStreamSize, LibMCDriver_ScanLabOIE_uint64 * pDroppedRecordCount);
+
+/**
+* Reads back the last recording stream into a new DataRecording instance. Fails if the recording stream is still active.
+*
+* @param[in] pOIEDevice - OIEDevice instance.
+* @param[out] pRecordingInstance - Recording instance with all streamed records.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_ScanLabOIEResult (*PLibMCDriver_ScanLabOIEOIEDevice_LoadRecordingStreamPtr) (LibMCDriver_ScanLabOIE_OIEDevice pOIEDevice, LibMCDriver_ScanLabOIE_DataRecording * pRecordingInstance);
+
 /**
 * Returns if the device is logged in.
 *
@@ -1092,6 +1141,11 @@ typedef struct {
 	PLibMCDriver_ScanLabOIEOIEDevice_UninstallAppByMinorVersionPtr m_OIEDevice_UninstallAppByMinorVersion;
 	PLibMCDriver_ScanLabOIEOIEDevice_RetrieveCurrentRecordingPtr m_OIEDevice_RetrieveCurrentRecording;
 	PLibMCDriver_ScanLabOIEOIEDevice_ClearCurrentRecordingPtr m_OIEDevice_ClearCurrentRecording;
+	PLibMCDriver_ScanLabOIEOIEDevice_StartRecordingStreamPtr m_OIEDevice_StartRecordingStream;
+	PLibMCDriver_ScanLabOIEOIEDevice_StopRecordingStreamPtr m_OIEDevice_StopRecordingStream;
+	PLibMCDriver_ScanLabOIEOIEDevice_RecordingStreamIsActivePtr m_OIEDevice_RecordingStreamIsActive;
+	PLibMCDriver_ScanLabOIEOIEDevice_GetRecordingStreamStatisticsPtr m_OIEDevice_GetRecordingStreamStatistics;
+	PLibMCDriver_ScanLabOIEOIEDevice_LoadRecordingStreamPtr m_OIEDevice_LoadRecordingStream;
 	PLibMCDriver_ScanLabOIEOIEDevice_IsLoggedInPtr m_OIEDevice_IsLoggedIn;
 	PLibMCDriver_ScanLabOIEOIEDevice_IsStreamingPtr m_OIEDevice_IsStreaming;
 	PLibMCDriver_ScanLabOIEOIEDevice_GetReceivedMeasurementTagPtr m_OIEDevice_GetReceivedMeasurementTag;
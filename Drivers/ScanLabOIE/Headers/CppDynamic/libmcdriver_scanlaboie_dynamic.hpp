@@ -245,6 +245,14 @@ public:
 			case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDOIEEXECUTIONMODE: return "INVALIDOIEEXECUTIONMODE";
 			case LIBMCDRIVER_SCANLABOIE_ERROR_POSITIONMISSINGINOIERTCIDLIST: return "POSITIONMISSINGINOIERTCIDLIST";
 			case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDOIEDEVICESTATE: return "INVALIDOIEDEVICESTATE";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_RECORDINGSTREAMALREADYACTIVE: return "RECORDINGSTREAMALREADYACTIVE";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_RECORDINGSTREAMISACTIVE: return "RECORDINGSTREAMISACTIVE";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_NORECORDINGSTREAMAVAILABLE: return "NORECORDINGSTREAMAVAILABLE";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAMCOMPRESSIONLEVEL: return "INVALIDRECORDINGSTREAMCOMPRESSIONLEVEL";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTWRITERECORDINGSTREAM: return "COULDNOTWRITERECORDINGSTREAM";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTREADRECORDINGSTREAM: return "COULDNOTREADRECORDINGSTREAM";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM: return "INVALIDRECORDINGSTREAM";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAMCOMPRESSION: return "INVALIDRECORDINGSTREAMCOMPRESSION";
 		}
 		return "UNKNOWN";
 	}
@@ -320,6 +328,14 @@ public:
 			case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDOIEEXECUTIONMODE: return "Invalid OIE Execution mode.";
 			case LIBMCDRIVER_SCANLABOIE_ERROR_POSITIONMISSINGINOIERTCIDLIST: return "Position missing in OIE RTC ID List.";
 			case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDOIEDEVICESTATE: return "Invalid OIE device state.";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_RECORDINGSTREAMALREADYACTIVE: return "Recording stream is already active.";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_RECORDINGSTREAMISACTIVE: return "Recording stream is still active.";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_NORECORDINGSTREAMAVAILABLE: return "No recording stream available.";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAMCOMPRESSIONLEVEL: return "Invalid recording stream compression level.";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTWRITERECORDINGSTREAM: return "Could not write recording stream.";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTREADRECORDINGSTREAM: return "Could not read recording stream.";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM: return "Invalid recording stream.";
+			case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAMCOMPRESSION: return "Invalid recording stream compression.";
 		}
 		return "unknown error";
 	}
@@ -638,6 +654,11 @@ public:
 	inline void UninstallAppByMinorVersion(const std::string & sName, const LibMCDriver_ScanLabOIE_uint32 nMajorVersion, const LibMCDriver_ScanLabOIE_uint32 nMinorVersion);
 	inline PDataRecording RetrieveCurrentRecording();
 	inline void ClearCurrentRecording();
+	inline void StartRecordingStream(const eRecordingStreamCompression eCompression, const LibMCDriver_ScanLabOIE_uint32 nCompressionLevel);
+	inline void StopRecordingStream();
+	inline bool RecordingStreamIsActive();
+	inline void GetRecordingStreamStatistics(LibMCDriver_ScanLabOIE_uint64 & nRecordCount, LibMCDriver_ScanLabOIE_uint64 & nChunkCount, LibMCDriver_ScanLabOIE_uint64 & nUncompressedSize, LibMCDriver_ScanLabOIE_uint64 & nStreamSize, LibMCDriver_ScanLabOIE_uint64 & nDroppedRecordCount);
+	inline PDataRecording LoadRecordingStream();
 	inline bool IsLoggedIn();
 	inline bool IsStreaming();
 	inline LibMCDriver_ScanLabOIE_uint32 GetReceivedMeasurementTag();
@@ -862,6 +883,11 @@ public:
 		pWrapperTable->m_OIEDevice_UninstallAppByMinorVersion = nullptr;
 		pWrapperTable->m_OIEDevice_RetrieveCurrentRecording = nullptr;
 		pWrapperTable->m_OIEDevice_ClearCurrentRecording = nullptr;
+		pWrapperTable->m_OIEDevice_StartRecordingStream = nullptr;
+		pWrapperTable->m_OIEDevice_StopRecordingStream = nullptr;
+		pWrapperTable->m_OIEDevice_RecordingStreamIsActive = nullptr;
+		pWrapperTable->m_OIEDevice_GetRecordingStreamStatistics = nullptr;
+		pWrapperTable->m_OIEDevice_LoadRecordingStream = nullptr;
 		pWrapperTable->m_OIEDevice_IsLoggedIn = nullptr;
 		pWrapperTable->m_OIEDevice_IsStreaming = nullptr;
 		pWrapperTable->m_OIEDevice_GetReceivedMeasurementTag = nullptr;
@@ -1555,6 +1581,51 @@ public:
 		if (pWrapperTable->m_OIEDevice_ClearCurrentRecording == nullptr)
 			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_OIEDevice_StartRecordingStream = (PLibMCDriver_ScanLabOIEOIEDevice_StartRecordingStreamPtr) GetProcAddress(hLibrary, "libmcdriver_scanlaboie_oiedevice_startrecordingstream");
+		#else // _WIN32
+		pWrapperTable->m_OIEDevice_StartRecordingStream = (PLibMCDriver_ScanLabOIEOIEDevice_StartRecordingStreamPtr) dlsym(hLibrary, "libmcdriver_scanlaboie_oiedevice_startrecordingstream");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OIEDevice_StartRecordingStream == nullptr)
+			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OIEDevice_StopRecordingStream = (PLibMCDriver_ScanLabOIEOIEDevice_StopRecordingStreamPtr) GetProcAddress(hLibrary, "libmcdriver_scanlaboie_oiedevice_stoprecordingstream");
+		#else // _WIN32
+		pWrapperTable->m_OIEDevice_StopRecordingStream = (PLibMCDriver_ScanLabOIEOIEDevice_StopRecordingStreamPtr) dlsym(hLibrary, "libmcdriver_scanlaboie_oiedevice_stoprecordingstream");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OIEDevice_StopRecordingStream == nullptr)
+			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OIEDevice_RecordingStreamIsActive = (PLibMCDriver_ScanLabOIEOIEDevice_RecordingStreamIsActivePtr) GetProcAddress(hLibrary, "libmcdriver_scanlaboie_oiedevice_recordingstreamisactive");
+		#else // _WIN32
+		pWrapperTable->m_OIEDevice_RecordingStreamIsActive = (PLibMCDriver_ScanLabOIEOIEDevice_RecordingStreamIsActivePtr) dlsym(hLibrary, "libmcdriver_scanlaboie_oiedevice_recordingstreamisactive");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OIEDevice_RecordingStreamIsActive == nullptr)
+			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OIEDevice_GetRecordingStreamStatistics = (PLibMCDriver_ScanLabOIEOIEDevice_GetRecordingStreamStatisticsPtr) GetProcAddress(hLibrary, "libmcdriver_scanlaboie_oiedevice_getrecordingstreamstatistics");
+		#else // _WIN32
+		pWrapperTable->m_OIEDevice_GetRecordingStreamStatistics = (PLibMCDriver_ScanLabOIEOIEDevice_GetRecordingStreamStatisticsPtr) dlsym(hLibrary, "libmcdriver_scanlaboie_oiedevice_getrecordingstreamstatistics");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OIEDevice_GetRecordingStreamStatistics == nullptr)
+			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_OIEDevice_LoadRecordingStream = (PLibMCDriver_ScanLabOIEOIEDevice_LoadRecordingStreamPtr) GetProcAddress(hLibrary, "libmcdriver_scanlaboie_oiedevice_loadrecordingstream");
+		#else // _WIN32
+		pWrapperTable->m_OIEDevice_LoadRecordingStream = (PLibMCDriver_ScanLabOIEOIEDevice_LoadRecordingStreamPtr) dlsym(hLibrary, "libmcdriver_scanlaboie_oiedevice_loadrecordingstream");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_OIEDevice_LoadRecordingStream == nullptr)
+			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_OIEDevice_IsLoggedIn = (PLibMCDriver_ScanLabOIEOIEDevice_IsLoggedInPtr) GetProcAddress(hLibrary, "libmcdriver_scanlaboie_oiedevice_isloggedin");
 		#else // _WIN32
@@ -2045,6 +2116,26 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_OIEDevice_ClearCurrentRecording == nullptr) )
 			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_scanlaboie_oiedevice_startrecordingstream", (void**)&(pWrapperTable->m_OIEDevice_StartRecordingStream));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OIEDevice_StartRecordingStream == nullptr) )
+			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlaboie_oiedevice_stoprecordingstream", (void**)&(pWrapperTable->m_OIEDevice_StopRecordingStream));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OIEDevice_StopRecordingStream == nullptr) )
+			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlaboie_oiedevice_recordingstreamisactive", (void**)&(pWrapperTable->m_OIEDevice_RecordingStreamIsActive));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OIEDevice_RecordingStreamIsActive == nullptr) )
+			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlaboie_oiedevice_getrecordingstreamstatistics", (void**)&(pWrapperTable->m_OIEDevice_GetRecordingStreamStatistics));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OIEDevice_GetRecordingStreamStatistics == nullptr) )
+			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlaboie_oiedevice_loadrecordingstream", (void**)&(pWrapperTable->m_OIEDevice_LoadRecordingStream));
+		if ( (eLookupError != 0) || (pWrapperTable->m_OIEDevice_LoadRecordingStream == nullptr) )
+			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_scanlaboie_oiedevice_isloggedin", (void**)&(pWrapperTable->m_OIEDevice_IsLoggedIn));
 		if ( (eLookupError != 0) || (pWrapperTable->m_OIEDevice_IsLoggedIn == nullptr) )
 			return LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -3006,6 +3097,64 @@ public:
 		CheckError(m_pWrapper->m_WrapperTable.m_OIEDevice_ClearCurrentRecording(m_pHandle));
 	}
 	
+	/**
+	* COIEDevice::StartRecordingStream - Starts streaming all finished recording pages into a binary file in the driver working directory. Streamed records are freed from memory, so the current recording only holds records that have not been streamed yet. Fails if a recording stream is already active.
+	* @param[in] eCompression - Compression of the stream chunks.
+	* @param[in] nCompressionLevel - Compression level from 0 to 9. zlib compresses best at 9. LZ4 uses the fast compressor below level 3 and LZ4 HC from level 3. Ignored without compression.
+	*/
+	void COIEDevice::StartRecordingStream(const eRecordingStreamCompression eCompression, const LibMCDriver_ScanLabOIE_uint32 nCompressionLevel)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_OIEDevice_StartRecordingStream(m_pHandle, eCompression, nCompressionLevel));
+	}
+	
+	/**
+	* COIEDevice::StopRecordingStream - Streams all remaining records of the current recording, waits for the background writer and closes the stream file. Does nothing if no recording stream is active. Throws the error of the background writer if the stream could not be written.
+	*/
+	void COIEDevice::StopRecordingStream()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_OIEDevice_StopRecordingStream(m_pHandle));
+	}
+	
+	/**
+	* COIEDevice::RecordingStreamIsActive - Returns if a recording stream is active.
+	* @return Flag if a recording stream is active.
+	*/
+	bool COIEDevice::RecordingStreamIsActive()
+	{
+		bool resultValue = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_OIEDevice_RecordingStreamIsActive(m_pHandle, &resultValue));
+		
+		return resultValue;
+	}
+	
+	/**
+	* COIEDevice::GetRecordingStreamStatistics - Returns the statistics of the active or last recording stream.
+	* @param[out] nRecordCount - Number of records written to the stream.
+	* @param[out] nChunkCount - Number of chunks written to the stream.
+	* @param[out] nUncompressedSize - Uncompressed size of all chunks in bytes.
+	* @param[out] nStreamSize - Size of the stream file in bytes.
+	* @param[out] nDroppedRecordCount - Number of records that were dropped because the background writer could not keep up or has failed.
+	*/
+	void COIEDevice::GetRecordingStreamStatistics(LibMCDriver_ScanLabOIE_uint64 & nRecordCount, LibMCDriver_ScanLabOIE_uint64 & nChunkCount, LibMCDriver_ScanLabOIE_uint64 & nUncompressedSize, LibMCDriver_ScanLabOIE_uint64 & nStreamSize, LibMCDriver_ScanLabOIE_uint64 & nDroppedRecordCount)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_OIEDevice_GetRecordingStreamStatistics(m_pHandle, &nRecordCount, &nChunkCount, &nUncompressedSize, &nStreamSize, &nDroppedRecordCount));
+	}
+	
+	/**
+	* COIEDevice::LoadRecordingStream - Reads back the last recording stream into a new DataRecording instance. Fails if the recording stream is still active.
+	* @return Recording instance with all streamed records.
+	*/
+	PDataRecording COIEDevice::LoadRecordingStream()
+	{
+		LibMCDriver_ScanLabOIEHandle hRecordingInstance = nullptr;
+		CheckError(m_pWrapper->m_WrapperTable.m_OIEDevice_LoadRecordingStream(m_pHandle, &hRecordingInstance));
+		
+		if (!hRecordingInstance) {
+			CheckError(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+		}
+		return std::make_shared<CDataRecording>(m_pWrapper, hRecordingInstance);
+	}
+	
 	/**
 	* COIEDevice::IsLoggedIn - Returns if the device is logged in.
 	* @return Flag if the device is logged in.
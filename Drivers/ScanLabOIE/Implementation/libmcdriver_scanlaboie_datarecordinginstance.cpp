@@ -157,6 +157,12 @@ void CDataRecordingInstance::finishRecord()
     m_CurrentEntry.m_dY = 0.0;
     m_CurrentEntry.m_nPacketNumber = 0;
     m_CurrentEntry.m_pData = nullptr;
+
+    // Hand completed pages over to the stream writer
+    if (m_pStreamWriter.get() != nullptr) {
+        if (m_Entries.getCount() >= m_Entries.getBlockSize())
+            streamCompletedPages();
+    }
 }
 
 size_t CDataRecordingInstance::getRecordCount()
@@ -172,8 +178,9 @@ void CDataRecordingInstance::writeToFile(const std::string& sFileName)
     if (!fStream.is_open())
         throw std::runtime_error ("could not write file");
 
-    fStream << "packet number, X, Y, value 0, value 1, ...." << std::endl;
+    fStream << "packet number, X, Y, value 0, value 1, ....\n";
 
+    // Do not use std::endl here, as it flushes the stream for every record.
     size_t nCount = m_Entries.getCount();
     for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
         auto & entry = m_Entries.getDataRef(nIndex);
@@ -181,7 +188,7 @@ void CDataRecordingInstance::writeToFile(const std::string& sFileName)
         for (uint32_t nIndex = 0; nIndex < m_nValuesPerRecord; nIndex++)
             fStream << ", " << entry.m_pData[nIndex];
 
-        fStream << std::endl;
+        fStream << "\n";
 
     }
 
@@ -224,6 +231,121 @@ PDataRecordingInstance CDataRecordingInstance::createEmptyDuplicate()
     return std::make_shared<CDataRecordingInstance>(m_nSensorValueCount, m_nRTCValueCount, m_nAdditionalValueCount, m_nBufferSizeInRecords);
 }
 
+void CDataRecordingInstance::attachStreamWriter(PDataRecordingStreamWriter pStreamWriter)
+{
+    if (pStreamWriter.get() == nullptr)
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+    if (pStreamWriter->getValuesPerRecord() != m_nValuesPerRecord)
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM);
+
+    m_pStreamWriter = pStreamWriter;
+}
+
+void CDataRecordingInstance::detachStreamWriter()
+{
+    m_pStreamWriter = nullptr;
+}
+
+void CDataRecordingInstance::streamPendingRecords(bool bReleaseRecords)
+{
+    if (m_pStreamWriter.get() == nullptr)
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_NORECORDINGSTREAMAVAILABLE);
+
+    if (m_Entries.getCount() > 0)
+        m_pStreamWriter->writeChunkAsync(createStreamChunk());
+
+    if (bReleaseRecords)
+        releaseAllRecords();
+}
+
+void CDataRecordingInstance::streamCompletedPages()
+{
+    size_t nRecordCount = m_Entries.getCount();
+
+    if (!m_pStreamWriter->hasFailed()) {
+        // Chunks are only queued while the device holds its recording mutex, so the queue can not fill up in between.
+        if (m_pStreamWriter->hasQueueSpace()) {
+            if (m_pStreamWriter->tryWriteChunkAsync(createStreamChunk())) {
+                releaseAllRecords();
+                return;
+            }
+        }
+
+        // Retry with the next record while the deferred pages fit into memory.
+        if (nRecordCount < m_Entries.getBlockSize() * SCANLABOIE_DATARECORDMAXDEFERREDPAGES)
+            return;
+    }
+
+    m_pStreamWriter->addDroppedRecords(nRecordCount);
+    releaseAllRecords();
+}
+
+void CDataRecordingInstance::releaseAllRecords()
+{
+    m_Entries.clearAllData();
+    m_Buffers.clear();
+    m_pCurrentBuffer = nullptr;
+
+    m_CurrentEntry.m_pData = nullptr;
+    m_nCurrentEntryDataIndex = 0;
+}
+
+PDataRecordingStreamChunk CDataRecordingInstance::createStreamChunk()
+{
+    size_t nRecordCount = m_Entries.getCount();
+    auto pChunk = std::make_shared<CDataRecordingStreamChunk>((uint32_t)nRecordCount, CDataRecordingStreamChunk::getPayloadSize((uint32_t)nRecordCount, m_nValuesPerRecord));
+
+    // Transpose the records into columns, see CDataRecordingStreamChunk for the layout
+    uint32_t* pPacketNumbers = (uint32_t*)pChunk->getPayload().data();
+    uint32_t* pMeasurementTags = pPacketNumbers + nRecordCount;
+    double* pXCoordinates = (double*)(pMeasurementTags + nRecordCount);
+    double* pYCoordinates = pXCoordinates + nRecordCount;
+    int32_t* pValues = (int32_t*)(pYCoordinates + nRecordCount);
+
+    for (size_t nRecordIndex = 0; nRecordIndex < nRecordCount; nRecordIndex++) {
+        auto& entry = m_Entries.getDataRef(nRecordIndex);
+        pPacketNumbers[nRecordIndex] = entry.m_nPacketNumber;
+        pMeasurementTags[nRecordIndex] = entry.m_nMeasurementTag;
+        pXCoordinates[nRecordIndex] = entry.m_dX;
+        pYCoordinates[nRecordIndex] = entry.m_dY;
+
+        int32_t* pTarget = &pValues[nRecordIndex];
+        for (uint32_t nValueIndex = 0; nValueIndex < m_nValuesPerRecord; nValueIndex++) {
+            *pTarget = entry.m_pData[nValueIndex];
+            pTarget += nRecordCount;
+        }
+    }
+
+    return pChunk;
+}
+
+void CDataRecordingInstance::appendStreamChunk(uint32_t nRecordCount, const uint8_t* pPayload, size_t nPayloadSize)
+{
+    if (pPayload == nullptr)
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+    if (nPayloadSize != CDataRecordingStreamChunk::getPayloadSize(nRecordCount, m_nValuesPerRecord))
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM);
+
+    const uint32_t* pPacketNumbers = (const uint32_t*)pPayload;
+    const uint32_t* pMeasurementTags = pPacketNumbers + nRecordCount;
+    const double* pXCoordinates = (const double*)(pMeasurementTags + nRecordCount);
+    const double* pYCoordinates = pXCoordinates + nRecordCount;
+    const int32_t* pValues = (const int32_t*)(pYCoordinates + nRecordCount);
+
+    for (uint32_t nRecordIndex = 0; nRecordIndex < nRecordCount; nRecordIndex++) {
+        startRecord(pPacketNumbers[nRecordIndex], pMeasurementTags[nRecordIndex], pXCoordinates[nRecordIndex], pYCoordinates[nRecordIndex]);
+
+        const int32_t* pSource = &pValues[nRecordIndex];
+        for (uint32_t nValueIndex = 0; nValueIndex < m_nValuesPerRecord; nValueIndex++) {
+            m_CurrentEntry.m_pData[nValueIndex] = *pSource;
+            pSource += nRecordCount;
+        }
+        m_nCurrentEntryDataIndex = m_nValuesPerRecord;
+
+        finishRecord();
+    }
+}
+
 int32_t* CDataRecordingInstance::getRTCData(size_t nRecordIndex)
 {
     if (m_nRTCValueCount == 0)
@@ -38,6 +38,7 @@ Abstract: This is the class declaration of CDeviceConfiguration
 #include "libmcdriver_scanlaboie_interfaces.hpp"
 #include "libmcdriver_scanlaboie_sdk.hpp"
 #include "libmcdriver_scanlaboie_pagedvector.hpp"
+#include "libmcdriver_scanlaboie_datarecordingstream.hpp"
 
 // Parent classes
 #include "libmcdriver_scanlaboie_base.hpp"
@@ -56,6 +57,9 @@ namespace Impl {
 
 #define SCANLABOIE_DATARECORDPAGESIZE (1024 * 256)
 
+// Number of record pages that are kept in memory while the stream writer is busy. Further records are dropped.
+#define SCANLABOIE_DATARECORDMAXDEFERREDPAGES 4
+
 /*************************************************************************************************************************
  Class declaration of CDeviceConfiguration 
 **************************************************************************************************************************/
@@ -116,11 +120,20 @@ private:
 
     uint32_t m_nBufferSizeInRecords;
     size_t m_nValueCountPerBuffer;
+
+    PDataRecordingStreamWriter m_pStreamWriter;
     
     int32_t* getRTCData (size_t nRecordIndex);
     int32_t* getSensorData(size_t nRecordIndex);
     int32_t* getAdditionalData(size_t nRecordIndex);
 
+    PDataRecordingStreamChunk createStreamChunk();
+
+    // Hands the completed pages to the stream writer without blocking the packet callback.
+    void streamCompletedPages();
+
+    void releaseAllRecords();
+
 public:
 
     CDataRecordingInstance(uint32_t nSensorValuesPerRecord, uint32_t nRTCValuesPerRecord, uint32_t nAdditionalValuesPerRecord, uint32_t nBufferSizeInRecords);
@@ -175,6 +188,17 @@ public:
 
     PDataRecordingInstance createEmptyDuplicate ();
 
+    // While a stream writer is attached, every completed record page is handed to the writer and freed from memory.
+    // If the writer is busy, the pages are kept up to SCANLABOIE_DATARECORDMAXDEFERREDPAGES and dropped beyond that.
+    void attachStreamWriter(PDataRecordingStreamWriter pStreamWriter);
+
+    void detachStreamWriter();
+
+    // Hands all records in memory to the attached stream writer, freeing them if bReleaseRecords is set.
+    void streamPendingRecords(bool bReleaseRecords);
+
+    void appendStreamChunk(uint32_t nRecordCount, const uint8_t* pPayload, size_t nPayloadSize);
+
 };
 
 
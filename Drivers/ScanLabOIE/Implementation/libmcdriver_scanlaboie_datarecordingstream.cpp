@@ -0,0 +1,496 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract: This is the class definition of CDataRecordingStreamWriter and CDataRecordingStreamReader
+
+*/
+
+#include "libmcdriver_scanlaboie_datarecordingstream.hpp"
+#include "libmcdriver_scanlaboie_datarecordinginstance.hpp"
+#include "libmcdriver_scanlaboie_interfaceexception.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+#include "Libraries/zlib/zlib.h"
+#include "Libraries/lz4/lz4.h"
+#include "Libraries/lz4/lz4hc.h"
+
+using namespace LibMCDriver_ScanLabOIE::Impl;
+
+
+CDataRecordingStreamChunk::CDataRecordingStreamChunk(uint32_t nRecordCount, size_t nPayloadSize)
+    : m_nRecordCount (nRecordCount)
+{
+    m_Payload.resize(nPayloadSize);
+}
+
+CDataRecordingStreamChunk::~CDataRecordingStreamChunk()
+{
+
+}
+
+uint32_t CDataRecordingStreamChunk::getRecordCount()
+{
+    return m_nRecordCount;
+}
+
+std::vector<uint8_t>& CDataRecordingStreamChunk::getPayload()
+{
+    return m_Payload;
+}
+
+size_t CDataRecordingStreamChunk::getPayloadSize(uint32_t nRecordCount, uint32_t nValuesPerRecord)
+{
+    size_t nBytesPerRecord = sizeof(uint32_t) + sizeof(uint32_t) + sizeof(double) + sizeof(double) + (size_t)nValuesPerRecord * sizeof(int32_t);
+    return (size_t)nRecordCount * nBytesPerRecord;
+}
+
+
+CDataRecordingStreamWriter::CDataRecordingStreamWriter(const std::string& sFileName, uint32_t nSensorValueCount, uint32_t nRTCValueCount, uint32_t nAdditionalValueCount, uint32_t nCompressionType, uint32_t nCompressionLevel)
+    : m_sFileName (sFileName),
+    m_nSensorValueCount (nSensorValueCount),
+    m_nRTCValueCount (nRTCValueCount),
+    m_nAdditionalValueCount (nAdditionalValueCount),
+    m_nCompressionType (nCompressionType),
+    m_nCompressionLevel (nCompressionLevel),
+    m_bStopRequested (false),
+    m_bFinished (false),
+    m_bHasFailed (false),
+    m_nRecordCount (0),
+    m_nChunkCount (0),
+    m_nUncompressedSize (0),
+    m_nStreamSize (0),
+    m_nDroppedRecordCount (0)
+{
+    if ((nCompressionType != SCANLABOIE_DATARECORDINGSTREAM_COMPRESSIONTYPE_NONE) && (nCompressionType != SCANLABOIE_DATARECORDINGSTREAM_COMPRESSIONTYPE_ZLIB) && (nCompressionType != SCANLABOIE_DATARECORDINGSTREAM_COMPRESSIONTYPE_LZ4))
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAMCOMPRESSION);
+    if (nCompressionLevel > SCANLABOIE_DATARECORDINGSTREAM_MAXCOMPRESSIONLEVEL)
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAMCOMPRESSIONLEVEL);
+
+    m_Stream.open(sFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!m_Stream.is_open())
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTWRITERECORDINGSTREAM, "could not create recording stream: " + sFileName);
+
+    // The header is written again with the final counts in finish.
+    writeHeader();
+    m_nStreamSize = sizeof(sDataRecordingStreamHeader);
+
+    m_WriterThread = std::thread([this]() { writerThreadLoop(); });
+}
+
+CDataRecordingStreamWriter::~CDataRecordingStreamWriter()
+{
+    try {
+        finish();
+    }
+    catch (...) {
+        joinWriterThread();
+    }
+}
+
+void CDataRecordingStreamWriter::writeHeader()
+{
+    sDataRecordingStreamHeader header;
+    memset((void*)&header, 0, sizeof(header));
+    header.m_nSignature = SCANLABOIE_DATARECORDINGSTREAM_SIGNATURE;
+    header.m_nVersion = SCANLABOIE_DATARECORDINGSTREAM_VERSION;
+    header.m_nSensorValueCount = m_nSensorValueCount;
+    header.m_nRTCValueCount = m_nRTCValueCount;
+    header.m_nAdditionalValueCount = m_nAdditionalValueCount;
+    header.m_nCompressionLevel = m_nCompressionLevel;
+    header.m_nRecordCount = m_nRecordCount;
+    header.m_nChunkCount = m_nChunkCount;
+
+    m_Stream.seekp(0, std::ios::beg);
+    m_Stream.write((const char*)&header, sizeof(header));
+    m_Stream.seekp(0, std::ios::end);
+
+    if (!m_Stream.good())
+        throw std::runtime_error("could not write recording stream header");
+}
+
+void CDataRecordingStreamWriter::writeChunk(PDataRecordingStreamChunk pChunk, std::vector<uint8_t>& compressionBuffer)
+{
+    auto& payload = pChunk->getPayload();
+
+    sDataRecordingStreamChunkHeader chunkHeader;
+    memset((void*)&chunkHeader, 0, sizeof(chunkHeader));
+    chunkHeader.m_nSignature = SCANLABOIE_DATARECORDINGSTREAM_CHUNKSIGNATURE;
+    chunkHeader.m_nRecordCount = pChunk->getRecordCount();
+    chunkHeader.m_nCompressionType = SCANLABOIE_DATARECORDINGSTREAM_COMPRESSIONTYPE_NONE;
+    chunkHeader.m_nUncompressedSize = payload.size();
+
+    const uint8_t* pData = payload.data();
+    size_t nDataSize = payload.size();
+
+    switch (m_nCompressionType) {
+    case SCANLABOIE_DATARECORDINGSTREAM_COMPRESSIONTYPE_ZLIB: {
+        uLongf nCompressedSize = compressBound((uLong)payload.size());
+        compressionBuffer.resize(nCompressedSize);
+
+        int nResult = compress2(compressionBuffer.data(), &nCompressedSize, payload.data(), (uLong)payload.size(), (int)m_nCompressionLevel);
+        if (nResult != Z_OK)
+            throw std::runtime_error("could not compress recording stream chunk: " + std::to_string(nResult));
+
+        pData = compressionBuffer.data();
+        nDataSize = nCompressedSize;
+        chunkHeader.m_nCompressionType = SCANLABOIE_DATARECORDINGSTREAM_COMPRESSIONTYPE_ZLIB;
+        break;
+    }
+
+    case SCANLABOIE_DATARECORDINGSTREAM_COMPRESSIONTYPE_LZ4: {
+        if (payload.size() > (size_t)LZ4_MAX_INPUT_SIZE)
+            throw std::runtime_error("recording stream chunk is too large for LZ4");
+
+        int nBound = LZ4_compressBound((int)payload.size());
+        compressionBuffer.resize((size_t)nBound);
+
+        int nResult;
+        if (m_nCompressionLevel < SCANLABOIE_DATARECORDINGSTREAM_MINLZ4HCCOMPRESSIONLEVEL)
+            nResult = LZ4_compress_default((const char*)payload.data(), (char*)compressionBuffer.data(), (int)payload.size(), nBound);
+        else
+            nResult = LZ4_compress_HC((const char*)payload.data(), (char*)compressionBuffer.data(), (int)payload.size(), nBound, (int)m_nCompressionLevel);
+        if (nResult <= 0)
+            throw std::runtime_error("could not compress recording stream chunk: " + std::to_string(nResult));
+
+        pData = compressionBuffer.data();
+        nDataSize = (size_t)nResult;
+        chunkHeader.m_nCompressionType = SCANLABOIE_DATARECORDINGSTREAM_COMPRESSIONTYPE_LZ4;
+        break;
+    }
+
+    default:
+        break;
+    }
+
+    chunkHeader.m_nCompressedSize = nDataSize;
+
+    m_Stream.write((const char*)&chunkHeader, sizeof(chunkHeader));
+    m_Stream.write((const char*)pData, nDataSize);
+    if (!m_Stream.good())
+        throw std::runtime_error("could not write recording stream chunk");
+
+    m_nRecordCount += chunkHeader.m_nRecordCount;
+    m_nChunkCount++;
+    m_nUncompressedSize += chunkHeader.m_nUncompressedSize;
+    m_nStreamSize += sizeof(chunkHeader) + nDataSize;
+}
+
+void CDataRecordingStreamWriter::writerThreadLoop()
+{
+    std::vector<uint8_t> compressionBuffer;
+
+    while (true) {
+        PDataRecordingStreamChunk pChunk;
+
+        {
+            std::unique_lock<std::mutex> lockGuard(m_QueueMutex);
+            m_QueueCondition.wait(lockGuard, [this]() { return m_bStopRequested || !m_Queue.empty(); });
+
+            // Stop is only honoured once the queue has been drained.
+            if (m_Queue.empty())
+                break;
+
+            pChunk = m_Queue.front();
+        }
+
+        // After a write error, all further chunks are dropped. The error is reported by checkError and finish.
+        if (m_bHasFailed) {
+            m_nDroppedRecordCount += pChunk->getRecordCount();
+        }
+        else {
+            try {
+                writeChunk(pChunk, compressionBuffer);
+            }
+            catch (std::exception& E) {
+                m_sErrorMessage = E.what();
+                m_nDroppedRecordCount += pChunk->getRecordCount();
+                m_bHasFailed = true;
+            }
+            catch (...) {
+                m_sErrorMessage = "unknown error";
+                m_nDroppedRecordCount += pChunk->getRecordCount();
+                m_bHasFailed = true;
+            }
+        }
+
+        // The chunk stays in the queue while it is written, so the queue limit bounds all chunks in flight.
+        {
+            std::lock_guard<std::mutex> lockGuard(m_QueueMutex);
+            m_Queue.pop_front();
+        }
+        m_QueueCondition.notify_all();
+    }
+}
+
+void CDataRecordingStreamWriter::joinWriterThread()
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_QueueMutex);
+        m_bStopRequested = true;
+    }
+    m_QueueCondition.notify_all();
+
+    if (m_WriterThread.joinable())
+        m_WriterThread.join();
+}
+
+void CDataRecordingStreamWriter::writeChunkAsync(PDataRecordingStreamChunk pChunk)
+{
+    if (pChunk.get() == nullptr)
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+
+    if (pChunk->getRecordCount() == 0)
+        return;
+
+    {
+        std::unique_lock<std::mutex> lockGuard(m_QueueMutex);
+        if (m_bStopRequested)
+            throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_NORECORDINGSTREAMAVAILABLE);
+
+        m_QueueCondition.wait(lockGuard, [this]() { return (m_Queue.size() < SCANLABOIE_DATARECORDINGSTREAM_MAXQUEUEDCHUNKS) || m_bHasFailed; });
+
+        if (m_bHasFailed) {
+            m_nDroppedRecordCount += pChunk->getRecordCount();
+            return;
+        }
+
+        m_Queue.push_back(pChunk);
+    }
+
+    m_QueueCondition.notify_all();
+}
+
+bool CDataRecordingStreamWriter::tryWriteChunkAsync(PDataRecordingStreamChunk pChunk)
+{
+    if (pChunk.get() == nullptr)
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+
+    if (pChunk->getRecordCount() == 0)
+        return true;
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_QueueMutex);
+        if (m_bStopRequested)
+            throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_NORECORDINGSTREAMAVAILABLE);
+
+        if (m_bHasFailed) {
+            m_nDroppedRecordCount += pChunk->getRecordCount();
+            return true;
+        }
+
+        if (m_Queue.size() >= SCANLABOIE_DATARECORDINGSTREAM_MAXQUEUEDCHUNKS)
+            return false;
+
+        m_Queue.push_back(pChunk);
+    }
+
+    m_QueueCondition.notify_all();
+    return true;
+}
+
+bool CDataRecordingStreamWriter::hasQueueSpace()
+{
+    std::lock_guard<std::mutex> lockGuard(m_QueueMutex);
+    return (m_Queue.size() < SCANLABOIE_DATARECORDINGSTREAM_MAXQUEUEDCHUNKS);
+}
+
+void CDataRecordingStreamWriter::addDroppedRecords(uint64_t nRecordCount)
+{
+    m_nDroppedRecordCount += nRecordCount;
+}
+
+bool CDataRecordingStreamWriter::hasFailed()
+{
+    return m_bHasFailed;
+}
+
+void CDataRecordingStreamWriter::checkError()
+{
+    // m_sErrorMessage is written before m_bHasFailed is set and never changes afterwards.
+    if (m_bHasFailed)
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTWRITERECORDINGSTREAM, "could not write recording stream: " + m_sErrorMessage);
+}
+
+void CDataRecordingStreamWriter::finish()
+{
+    if (m_bFinished)
+        return;
+
+    joinWriterThread();
+
+    if (!m_bHasFailed) {
+        try {
+            writeHeader();
+        }
+        catch (std::exception& E) {
+            m_sErrorMessage = E.what();
+            m_bHasFailed = true;
+        }
+    }
+
+    m_Stream.close();
+    m_bFinished = true;
+
+    checkError();
+}
+
+bool CDataRecordingStreamWriter::isFinished()
+{
+    return m_bFinished;
+}
+
+std::string CDataRecordingStreamWriter::getFileName()
+{
+    return m_sFileName;
+}
+
+uint32_t CDataRecordingStreamWriter::getValuesPerRecord()
+{
+    return m_nSensorValueCount + m_nRTCValueCount + m_nAdditionalValueCount;
+}
+
+uint64_t CDataRecordingStreamWriter::getRecordCount()
+{
+    return m_nRecordCount;
+}
+
+uint64_t CDataRecordingStreamWriter::getChunkCount()
+{
+    return m_nChunkCount;
+}
+
+uint64_t CDataRecordingStreamWriter::getUncompressedSize()
+{
+    return m_nUncompressedSize;
+}
+
+uint64_t CDataRecordingStreamWriter::getStreamSize()
+{
+    return m_nStreamSize;
+}
+
+uint64_t CDataRecordingStreamWriter::getDroppedRecordCount()
+{
+    return m_nDroppedRecordCount;
+}
+
+
+PDataRecordingInstance CDataRecordingStreamReader::readFromFile(const std::string& sFileName)
+{
+    std::ifstream stream;
+    stream.open(sFileName, std::ios::in | std::ios::binary);
+    if (!stream.is_open())
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTREADRECORDINGSTREAM, "could not open recording stream: " + sFileName);
+
+    sDataRecordingStreamHeader header;
+    memset((void*)&header, 0, sizeof(header));
+    stream.read((char*)&header, sizeof(header));
+    if (stream.gcount() != (std::streamsize)sizeof(header))
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM, "recording stream header is incomplete");
+    if ((header.m_nSignature != SCANLABOIE_DATARECORDINGSTREAM_SIGNATURE) || (header.m_nVersion != SCANLABOIE_DATARECORDINGSTREAM_VERSION))
+        throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM, "invalid recording stream signature");
+
+    auto pInstance = std::make_shared<CDataRecordingInstance>(header.m_nSensorValueCount, header.m_nRTCValueCount, header.m_nAdditionalValueCount, SCANLABOIE_DATARECORDINGSTREAM_READBUFFERSIZEINRECORDS);
+    uint32_t nValuesPerRecord = header.m_nSensorValueCount + header.m_nRTCValueCount + header.m_nAdditionalValueCount;
+
+    std::vector<uint8_t> compressedBuffer;
+    std::vector<uint8_t> payload;
+    uint64_t nChunkCount = 0;
+
+    while (true) {
+        sDataRecordingStreamChunkHeader chunkHeader;
+        memset((void*)&chunkHeader, 0, sizeof(chunkHeader));
+        stream.read((char*)&chunkHeader, sizeof(chunkHeader));
+        if ((stream.gcount() == 0) && stream.eof())
+            break;
+
+        if (stream.gcount() != (std::streamsize)sizeof(chunkHeader))
+            throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM, "recording stream chunk header is incomplete");
+        if (chunkHeader.m_nSignature != SCANLABOIE_DATARECORDINGSTREAM_CHUNKSIGNATURE)
+            throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM, "invalid recording stream chunk signature");
+        if (chunkHeader.m_nUncompressedSize != CDataRecordingStreamChunk::getPayloadSize(chunkHeader.m_nRecordCount, nValuesPerRecord))
+            throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM, "invalid recording stream chunk size");
+
+        payload.resize((size_t)chunkHeader.m_nUncompressedSize);
+
+        switch (chunkHeader.m_nCompressionType) {
+        case SCANLABOIE_DATARECORDINGSTREAM_COMPRESSIONTYPE_NONE:
+            if (chunkHeader.m_nCompressedSize != chunkHeader.m_nUncompressedSize)
+                throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM, "invalid recording stream chunk size");
+
+            stream.read((char*)payload.data(), (std::streamsize)payload.size());
+            if (stream.gcount() != (std::streamsize)payload.size())
+                throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM, "recording stream chunk is incomplete");
+            break;
+
+        case SCANLABOIE_DATARECORDINGSTREAM_COMPRESSIONTYPE_ZLIB: {
+            compressedBuffer.resize((size_t)chunkHeader.m_nCompressedSize);
+            stream.read((char*)compressedBuffer.data(), (std::streamsize)compressedBuffer.size());
+            if (stream.gcount() != (std::streamsize)compressedBuffer.size())
+                throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM, "recording stream chunk is incomplete");
+
+            uLongf nUncompressedSize = (uLongf)payload.size();
+            int nResult = uncompress(payload.data(), &nUncompressedSize, compressedBuffer.data(), (uLong)compressedBuffer.size());
+            if ((nResult != Z_OK) || (nUncompressedSize != payload.size()))
+                throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM, "could not decompress recording stream chunk");
+            break;
+        }
+
+        case SCANLABOIE_DATARECORDINGSTREAM_COMPRESSIONTYPE_LZ4: {
+            if ((chunkHeader.m_nCompressedSize > (uint64_t)LZ4_MAX_INPUT_SIZE) || (chunkHeader.m_nUncompressedSize > (uint64_t)LZ4_MAX_INPUT_SIZE))
+                throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM, "invalid recording stream chunk size");
+
+            compressedBuffer.resize((size_t)chunkHeader.m_nCompressedSize);
+            stream.read((char*)compressedBuffer.data(), (std::streamsize)compressedBuffer.size());
+            if (stream.gcount() != (std::streamsize)compressedBuffer.size())
+                throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM, "recording stream chunk is incomplete");
+
+            int nResult = LZ4_decompress_safe((const char*)compressedBuffer.data(), (char*)payload.data(), (int)compressedBuffer.size(), (int)payload.size());
+            if ((nResult < 0) || ((size_t)nResult != payload.size()))
+                throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM, "could not decompress recording stream chunk");
+            break;
+        }
+
+        default:
+            throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM, "invalid recording stream compression type");
+        }
+
+        pInstance->appendStreamChunk(chunkHeader.m_nRecordCount, payload.data(), payload.size());
+        nChunkCount++;
+    }
+
+    // Streams that have not been finished successfully carry no counts in their header.
+    if (header.m_nChunkCount != 0) {
+        if ((header.m_nChunkCount != nChunkCount) || (header.m_nRecordCount != pInstance->getRecordCount()))
+            throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM, "recording stream record count mismatch");
+    }
+
+    return pInstance;
+}
@@ -0,0 +1,233 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract: This is the class declaration of CDataRecordingStreamWriter and CDataRecordingStreamReader
+
+*/
+
+
+#ifndef __LIBMCDRIVER_SCANLABOIE_DATARECORDINGSTREAM
+#define __LIBMCDRIVER_SCANLABOIE_DATARECORDINGSTREAM
+
+#include "libmcdriver_scanlaboie_interfaces.hpp"
+
+// Include custom headers here.
+#include <vector>
+#include <list>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace LibMCDriver_ScanLabOIE {
+namespace Impl {
+
+#define SCANLABOIE_DATARECORDINGSTREAM_SIGNATURE 0x524F454F
+#define SCANLABOIE_DATARECORDINGSTREAM_CHUNKSIGNATURE 0x434F454F
+#define SCANLABOIE_DATARECORDINGSTREAM_VERSION 1
+
+#define SCANLABOIE_DATARECORDINGSTREAM_COMPRESSIONTYPE_NONE 0
+#define SCANLABOIE_DATARECORDINGSTREAM_COMPRESSIONTYPE_ZLIB 1
+#define SCANLABOIE_DATARECORDINGSTREAM_COMPRESSIONTYPE_LZ4 2
+#define SCANLABOIE_DATARECORDINGSTREAM_MAXCOMPRESSIONLEVEL 9
+
+// LZ4 levels below this use the fast compressor, higher levels LZ4 HC
+#define SCANLABOIE_DATARECORDINGSTREAM_MINLZ4HCCOMPRESSIONLEVEL 3
+
+// Maximum number of chunks that wait for the background writer, which bounds the memory held by the writer.
+#define SCANLABOIE_DATARECORDINGSTREAM_MAXQUEUEDCHUNKS 2
+
+#define SCANLABOIE_DATARECORDINGSTREAM_READBUFFERSIZEINRECORDS (64 * 1024)
+
+/*************************************************************************************************************************
+ Stream file layout: One file header, followed by an arbitrary number of chunks.
+ Every chunk holds a column-major payload of RecordCount records:
+   uint32 packet numbers, uint32 measurement tags, double X, double Y, 
+   followed by one int32 column per value (sensor values, RTC values, additional values).
+**************************************************************************************************************************/
+
+#pragma pack (1)
+
+typedef struct _sDataRecordingStreamHeader
+{
+    uint32_t m_nSignature;
+    uint32_t m_nVersion;
+    uint32_t m_nSensorValueCount;
+    uint32_t m_nRTCValueCount;
+    uint32_t m_nAdditionalValueCount;
+    uint32_t m_nCompressionLevel;
+    uint64_t m_nRecordCount;
+    uint64_t m_nChunkCount;
+} sDataRecordingStreamHeader;
+
+typedef struct _sDataRecordingStreamChunkHeader
+{
+    uint32_t m_nSignature;
+    uint32_t m_nRecordCount;
+    uint32_t m_nCompressionType;
+    uint32_t m_nReserved;
+    uint64_t m_nUncompressedSize;
+    uint64_t m_nCompressedSize;
+} sDataRecordingStreamChunkHeader;
+
+#pragma pack ()
+
+
+/*************************************************************************************************************************
+ Class declaration of CDataRecordingStreamChunk 
+**************************************************************************************************************************/
+
+class CDataRecordingStreamChunk {
+private:
+    uint32_t m_nRecordCount;
+    std::vector<uint8_t> m_Payload;
+
+public:
+
+    CDataRecordingStreamChunk(uint32_t nRecordCount, size_t nPayloadSize);
+
+    virtual ~CDataRecordingStreamChunk();
+
+    uint32_t getRecordCount();
+
+    std::vector<uint8_t> & getPayload();
+
+    static size_t getPayloadSize(uint32_t nRecordCount, uint32_t nValuesPerRecord);
+
+};
+
+typedef std::shared_ptr<CDataRecordingStreamChunk> PDataRecordingStreamChunk;
+
+
+/*************************************************************************************************************************
+ Class declaration of CDataRecordingStreamWriter 
+**************************************************************************************************************************/
+
+class CDataRecordingStreamWriter {
+private:
+
+    std::string m_sFileName;
+    std::ofstream m_Stream;
+
+    uint32_t m_nSensorValueCount;
+    uint32_t m_nRTCValueCount;
+    uint32_t m_nAdditionalValueCount;
+    uint32_t m_nCompressionType;
+    uint32_t m_nCompressionLevel;
+
+    std::mutex m_QueueMutex;
+    std::condition_variable m_QueueCondition;
+    std::list<PDataRecordingStreamChunk> m_Queue;
+    bool m_bStopRequested;
+
+    std::thread m_WriterThread;
+
+    std::atomic<bool> m_bFinished;
+    std::atomic<bool> m_bHasFailed;
+    std::string m_sErrorMessage;
+
+    std::atomic<uint64_t> m_nRecordCount;
+    std::atomic<uint64_t> m_nChunkCount;
+    std::atomic<uint64_t> m_nUncompressedSize;
+    std::atomic<uint64_t> m_nStreamSize;
+    std::atomic<uint64_t> m_nDroppedRecordCount;
+
+    void writerThreadLoop();
+
+    void writeChunk(PDataRecordingStreamChunk pChunk, std::vector<uint8_t> & compressionBuffer);
+
+    void writeHeader();
+
+    void joinWriterThread();
+
+public:
+
+    CDataRecordingStreamWriter(const std::string & sFileName, uint32_t nSensorValueCount, uint32_t nRTCValueCount, uint32_t nAdditionalValueCount, uint32_t nCompressionType, uint32_t nCompressionLevel);
+
+    virtual ~CDataRecordingStreamWriter();
+
+    // Hands a chunk over to the background writer. Blocks if too many chunks are queued.
+    // Must not be called from the packet callback. The records are counted as dropped if the writer has failed.
+    void writeChunkAsync(PDataRecordingStreamChunk pChunk);
+
+    // Hands a chunk over to the background writer without blocking. Returns false if the queue is full.
+    // The records are counted as dropped if the writer has failed.
+    bool tryWriteChunkAsync(PDataRecordingStreamChunk pChunk);
+
+    bool hasQueueSpace();
+
+    void addDroppedRecords(uint64_t nRecordCount);
+
+    bool hasFailed();
+
+    // Throws the error of the background writer, if there is any.
+    void checkError();
+
+    // Writes all queued chunks, finalizes the file header and closes the file.
+    void finish();
+
+    bool isFinished();
+
+    std::string getFileName();
+
+    uint32_t getValuesPerRecord();
+
+    uint64_t getRecordCount();
+
+    uint64_t getChunkCount();
+
+    uint64_t getUncompressedSize();
+
+    uint64_t getStreamSize();
+
+    uint64_t getDroppedRecordCount();
+
+};
+
+typedef std::shared_ptr<CDataRecordingStreamWriter> PDataRecordingStreamWriter;
+
+
+/*************************************************************************************************************************
+ Class declaration of CDataRecordingStreamReader 
+**************************************************************************************************************************/
+
+class CDataRecordingInstance;
+
+class CDataRecordingStreamReader {
+public:
+
+    static std::shared_ptr<CDataRecordingInstance> readFromFile(const std::string & sFileName);
+
+};
+
+
+} // namespace Impl
+} // namespace LibMCDriver_ScanLabOIE
+
+#endif // __LIBMCDRIVER_SCANLABOIE_DATARECORDINGSTREAM
@@ -481,7 +481,17 @@ void COIEDeviceInstance::startAppEx(const std::string& sName, const int32_t nMaj
 
 	{
 		std::lock_guard<std::mutex> lockGuard(m_RecordingMutex);
+		checkRecordingStreamError();
+
+		if (m_pRecordingStreamWriter.get() != nullptr) {
+			if (m_pCurrentDataRecording.get() != nullptr)
+				m_pCurrentDataRecording->streamPendingRecords(true);
+		}
+
 		m_pCurrentDataRecording = std::make_shared<CDataRecordingInstance>(m_nSensorSignalCount, m_nRTCSignalCount, m_nAdditionalSignalCount, 1024);
+
+		if (m_pRecordingStreamWriter.get() != nullptr)
+			m_pCurrentDataRecording->attachStreamWriter(m_pRecordingStreamWriter);
 	}
 
 }
@@ -743,6 +753,7 @@ void COIEDeviceInstance::onErrorEvent(oie_device device, oie_error error, int32_
 PDataRecordingInstance COIEDeviceInstance::RetrieveCurrentRecording()
 {
 	std::lock_guard<std::mutex> lockGuard(m_RecordingMutex);
+	checkRecordingStreamError();
 
 	if (m_pCurrentDataRecording.get() != nullptr) {
 
@@ -750,6 +761,13 @@ PDataRecordingInstance COIEDeviceInstance::RetrieveCurrentRecording()
 		m_pCurrentDataRecording = nullptr;
 		m_pCurrentDataRecording = pOldRecording->createEmptyDuplicate();
 
+		// The returned records stay in memory, but are written to the stream as well.
+		if (m_pRecordingStreamWriter.get() != nullptr) {
+			pOldRecording->streamPendingRecords(false);
+			pOldRecording->detachStreamWriter();
+			m_pCurrentDataRecording->attachStreamWriter(m_pRecordingStreamWriter);
+		}
+
 		return pOldRecording;
 	}
 	else {
@@ -764,17 +782,133 @@ PDataRecordingInstance COIEDeviceInstance::RetrieveCurrentRecording()
 void COIEDeviceInstance::ClearCurrentRecording()
 {
 	std::lock_guard<std::mutex> lockGuard(m_RecordingMutex);
+	checkRecordingStreamError();
 	if (m_pCurrentDataRecording.get() != nullptr) {
 		auto pOldRecording = m_pCurrentDataRecording;
 		m_pCurrentDataRecording = nullptr;
 		m_pCurrentDataRecording = pOldRecording->createEmptyDuplicate();
 
+		if (m_pRecordingStreamWriter.get() != nullptr) {
+			pOldRecording->streamPendingRecords(true);
+			pOldRecording->detachStreamWriter();
+			m_pCurrentDataRecording->attachStreamWriter(m_pRecordingStreamWriter);
+		}
+
 		n_LastReceivedMeasurementTag = 0;
 
 	}
 }
 
 
+void COIEDeviceInstance::StartRecordingStream(const LibMCDriver_ScanLabOIE::eRecordingStreamCompression eCompression, const LibMCDriver_ScanLabOIE_uint32 nCompressionLevel)
+{
+	static std::atomic<uint32_t> s_nRecordingStreamCounter (0);
+
+	uint32_t nCompressionType;
+	switch (eCompression) {
+		case LibMCDriver_ScanLabOIE::eRecordingStreamCompression::NoCompression: nCompressionType = SCANLABOIE_DATARECORDINGSTREAM_COMPRESSIONTYPE_NONE; break;
+		case LibMCDriver_ScanLabOIE::eRecordingStreamCompression::ZLib: nCompressionType = SCANLABOIE_DATARECORDINGSTREAM_COMPRESSIONTYPE_ZLIB; break;
+		case LibMCDriver_ScanLabOIE::eRecordingStreamCompression::LZ4: nCompressionType = SCANLABOIE_DATARECORDINGSTREAM_COMPRESSIONTYPE_LZ4; break;
+		default:
+			throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAMCOMPRESSION);
+	}
+
+	if (nCompressionLevel > SCANLABOIE_DATARECORDINGSTREAM_MAXCOMPRESSIONLEVEL)
+		throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAMCOMPRESSIONLEVEL);
+
+	std::lock_guard<std::mutex> lockGuard(m_RecordingMutex);
+
+	if (m_pRecordingStreamWriter.get() != nullptr)
+		throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_RECORDINGSTREAMALREADYACTIVE);
+
+	if (m_pLastRecordingStreamWriter.get() != nullptr) {
+		if (!m_pLastRecordingStreamWriter->isFinished())
+			throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_RECORDINGSTREAMISACTIVE);
+		m_pLastRecordingStreamWriter = nullptr;
+	}
+
+	// Only the last recording stream is kept on disk
+	if (m_pRecordingStreamFile.get() != nullptr) {
+		m_pRecordingStreamFile->DeleteFromDisk();
+		m_pRecordingStreamFile = nullptr;
+	}
+
+	uint32_t nStreamIndex = ++s_nRecordingStreamCounter;
+	m_pRecordingStreamFile = m_pWorkingDirectory->AddManagedFile("oierecording_" + std::to_string(nStreamIndex) + ".bin");
+
+	auto pStreamWriter = std::make_shared<CDataRecordingStreamWriter>(m_pRecordingStreamFile->GetAbsoluteFileName(), m_nSensorSignalCount, m_nRTCSignalCount, m_nAdditionalSignalCount, nCompressionType, nCompressionLevel);
+
+	if (m_pCurrentDataRecording.get() != nullptr)
+		m_pCurrentDataRecording->attachStreamWriter(pStreamWriter);
+
+	m_pRecordingStreamWriter = pStreamWriter;
+	m_pLastRecordingStreamWriter = pStreamWriter;
+}
+
+void COIEDeviceInstance::StopRecordingStream()
+{
+	PDataRecordingStreamWriter pStreamWriter;
+
+	{
+		std::lock_guard<std::mutex> lockGuard(m_RecordingMutex);
+		if (m_pRecordingStreamWriter.get() == nullptr)
+			return;
+
+		if (m_pCurrentDataRecording.get() != nullptr) {
+			m_pCurrentDataRecording->streamPendingRecords(true);
+			m_pCurrentDataRecording->detachStreamWriter();
+		}
+
+		pStreamWriter = m_pRecordingStreamWriter;
+		m_pRecordingStreamWriter = nullptr;
+	}
+
+	// Do not block the packet callback while the writer drains its queue. Rethrows a failure of the writer.
+	pStreamWriter->finish();
+}
+
+void COIEDeviceInstance::checkRecordingStreamError()
+{
+	if (m_pRecordingStreamWriter.get() != nullptr)
+		m_pRecordingStreamWriter->checkError();
+}
+
+bool COIEDeviceInstance::RecordingStreamIsActive()
+{
+	std::lock_guard<std::mutex> lockGuard(m_RecordingMutex);
+	return (m_pRecordingStreamWriter.get() != nullptr);
+}
+
+void COIEDeviceInstance::GetRecordingStreamStatistics(LibMCDriver_ScanLabOIE_uint64& nRecordCount, LibMCDriver_ScanLabOIE_uint64& nChunkCount, LibMCDriver_ScanLabOIE_uint64& nUncompressedSize, LibMCDriver_ScanLabOIE_uint64& nStreamSize, LibMCDriver_ScanLabOIE_uint64& nDroppedRecordCount)
+{
+	std::lock_guard<std::mutex> lockGuard(m_RecordingMutex);
+	if (m_pLastRecordingStreamWriter.get() == nullptr)
+		throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_NORECORDINGSTREAMAVAILABLE);
+
+	nRecordCount = m_pLastRecordingStreamWriter->getRecordCount();
+	nChunkCount = m_pLastRecordingStreamWriter->getChunkCount();
+	nUncompressedSize = m_pLastRecordingStreamWriter->getUncompressedSize();
+	nStreamSize = m_pLastRecordingStreamWriter->getStreamSize();
+	nDroppedRecordCount = m_pLastRecordingStreamWriter->getDroppedRecordCount();
+}
+
+PDataRecordingInstance COIEDeviceInstance::LoadRecordingStream()
+{
+	PDataRecordingStreamWriter pStreamWriter;
+	{
+		std::lock_guard<std::mutex> lockGuard(m_RecordingMutex);
+		if (m_pLastRecordingStreamWriter.get() == nullptr)
+			throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_NORECORDINGSTREAMAVAILABLE);
+
+		pStreamWriter = m_pLastRecordingStreamWriter;
+	}
+
+	if (!pStreamWriter->isFinished())
+		throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_RECORDINGSTREAMISACTIVE);
+
+	return CDataRecordingStreamReader::readFromFile(pStreamWriter->getFileName());
+}
+
 void COIEDeviceInstance::SetRTC6IPAddress(const std::string& sRTC6IPAddress)
 {
 	m_sRTC6IPAddress = sRTC6IPAddress;
@@ -994,6 +1128,32 @@ void COIEDevice::ClearCurrentRecording()
 	lockInstance()->ClearCurrentRecording();
 }
 
+void COIEDevice::StartRecordingStream(const LibMCDriver_ScanLabOIE::eRecordingStreamCompression eCompression, const LibMCDriver_ScanLabOIE_uint32 nCompressionLevel)
+{
+	lockInstance()->StartRecordingStream(eCompression, nCompressionLevel);
+}
+
+void COIEDevice::StopRecordingStream()
+{
+	lockInstance()->StopRecordingStream();
+}
+
+bool COIEDevice::RecordingStreamIsActive()
+{
+	return lockInstance()->RecordingStreamIsActive();
+}
+
+void COIEDevice::GetRecordingStreamStatistics(LibMCDriver_ScanLabOIE_uint64& nRecordCount, LibMCDriver_ScanLabOIE_uint64& nChunkCount, LibMCDriver_ScanLabOIE_uint64& nUncompressedSize, LibMCDriver_ScanLabOIE_uint64& nStreamSize, LibMCDriver_ScanLabOIE_uint64& nDroppedRecordCount)
+{
+	lockInstance()->GetRecordingStreamStatistics(nRecordCount, nChunkCount, nUncompressedSize, nStreamSize, nDroppedRecordCount);
+}
+
+IDataRecording* COIEDevice::LoadRecordingStream()
+{
+	auto pRecordingInstance = lockInstance()->LoadRecordingStream();
+	return new CDataRecording(pRecordingInstance);
+}
+
 
 bool COIEDevice::IsLoggedIn()
 {
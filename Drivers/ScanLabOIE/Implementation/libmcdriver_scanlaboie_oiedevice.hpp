@@ -122,6 +122,14 @@ protected:
 
 	PDataRecordingInstance m_pCurrentDataRecording;
 
+	// Recording stream that is currently active, and the last one that has been started.
+	PDataRecordingStreamWriter m_pRecordingStreamWriter;
+	PDataRecordingStreamWriter m_pLastRecordingStreamWriter;
+	LibMCEnv::PWorkingFile m_pRecordingStreamFile;
+
+	// Rethrows a failure of the active recording stream writer. Must be called with the recording mutex held.
+	void checkRecordingStreamError();
+
 	void buildDeviceConfig (IDeviceConfiguration* pDeviceConfiguration, std::vector<uint8_t> & correctionFileData);
 
 public:
@@ -190,6 +198,16 @@ public:
 
 	void ClearCurrentRecording();
 
+	void StartRecordingStream(const LibMCDriver_ScanLabOIE::eRecordingStreamCompression eCompression, const LibMCDriver_ScanLabOIE_uint32 nCompressionLevel);
+
+	void StopRecordingStream();
+
+	bool RecordingStreamIsActive();
+
+	void GetRecordingStreamStatistics(LibMCDriver_ScanLabOIE_uint64& nRecordCount, LibMCDriver_ScanLabOIE_uint64& nChunkCount, LibMCDriver_ScanLabOIE_uint64& nUncompressedSize, LibMCDriver_ScanLabOIE_uint64& nStreamSize, LibMCDriver_ScanLabOIE_uint64& nDroppedRecordCount);
+
+	PDataRecordingInstance LoadRecordingStream();
+
 	void SetRTC6IPAddress (const std::string & sRTC6IPAddress);
 
 	bool isLoggedIn();
@@ -275,6 +293,16 @@ public:
 
 	void ClearCurrentRecording() override;
 
+	void StartRecordingStream(const LibMCDriver_ScanLabOIE::eRecordingStreamCompression eCompression, const LibMCDriver_ScanLabOIE_uint32 nCompressionLevel) override;
+
+	void StopRecordingStream() override;
+
+	bool RecordingStreamIsActive() override;
+
+	void GetRecordingStreamStatistics(LibMCDriver_ScanLabOIE_uint64 & nRecordCount, LibMCDriver_ScanLabOIE_uint64 & nChunkCount, LibMCDriver_ScanLabOIE_uint64 & nUncompressedSize, LibMCDriver_ScanLabOIE_uint64 & nStreamSize, LibMCDriver_ScanLabOIE_uint64 & nDroppedRecordCount) override;
+
+	IDataRecording* LoadRecordingStream() override;
+
 	bool IsLoggedIn() override;
 
 	bool IsStreaming() override;
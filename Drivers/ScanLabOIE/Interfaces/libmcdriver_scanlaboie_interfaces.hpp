@@ -803,6 +803,40 @@ public:
 	*/
 	virtual void ClearCurrentRecording() = 0;
 
+	/**
+	* IOIEDevice::StartRecordingStream - Starts streaming all finished recording pages into a binary file in the driver working directory. Streamed records are freed from memory, so the current recording only holds records that have not been streamed yet. Fails if a recording stream is already active.
+	* @param[in] eCompression - Compression of the stream chunks.
+	* @param[in] nCompressionLevel - Compression level from 0 to 9. zlib compresses best at 9. LZ4 uses the fast compressor below level 3 and LZ4 HC from level 3. Ignored without compression.
+	*/
+	virtual void StartRecordingStream(const LibMCDriver_ScanLabOIE::eRecordingStreamCompression eCompression, const LibMCDriver_ScanLabOIE_uint32 nCompressionLevel) = 0;
+
+	/**
+	* IOIEDevice::StopRecordingStream - Streams all remaining records of the current recording, waits for the background writer and closes the stream file. Does nothing if no recording stream is active. Throws the error of the background writer if the stream could not be written.
+	*/
+	virtual void StopRecordingStream() = 0;
+
+	/**
+	* IOIEDevice::RecordingStreamIsActive - Returns if a recording stream is active.
+	* @return Flag if a recording stream is active.
+	*/
+	virtual bool RecordingStreamIsActive() = 0;
+
+	/**
+	* IOIEDevice::GetRecordingStreamStatistics - Returns the statistics of the active or last recording stream.
+	* @param[out] nRecordCount - Number of records written to the stream.
+	* @param[out] nChunkCount - Number of chunks written to the stream.
+	* @param[out] nUncompressedSize - Uncompressed size of all chunks in bytes.
+	* @param[out] nStreamSize - Size of the stream file in bytes.
+	* @param[out] nDroppedRecordCount - Number of records that were dropped because the background writer could not keep up or has failed.
+	*/
+	virtual void GetRecordingStreamStatistics(LibMCDriver_ScanLabOIE_uint64 & nRecordCount, LibMCDriver_ScanLabOIE_uint64 & nChunkCount, LibMCDriver_ScanLabOIE_uint64 & nUncompressedSize, LibMCDriver_ScanLabOIE_uint64 & nStreamSize, LibMCDriver_ScanLabOIE_uint64 & nDroppedRecordCount) = 0;
+
+	/**
+	* IOIEDevice::LoadRecordingStream - Reads back the last recording stream into a new DataRecording instance. Fails if the recording stream is still active.
+	* @return Recording instance with all streamed records.
+	*/
+	virtual IDataRecording * LoadRecordingStream() = 0;
+
 	/**
 	* IOIEDevice::IsLoggedIn - Returns if the device is logged in.
 	* @return Flag if the device is logged in.
@@ -2231,6 +2231,142 @@ LibMCDriver_ScanLabOIEResult libmcdriver_scanlaboie_oiedevice_clearcurrentrecord
 	}
 }
 
+LibMCDriver_ScanLabOIEResult libmcdriver_scanlaboie_oiedevice_startrecordingstream(LibMCDriver_ScanLabOIE_OIEDevice pOIEDevice, eLibMCDriver_ScanLabOIERecordingStreamCompression eCompression, LibMCDriver_ScanLabOIE_uint32 nCompressionLevel)
+{
+	IBase* pIBaseClass = (IBase *)pOIEDevice;
+
+	try {
+		IOIEDevice* pIOIEDevice = dynamic_cast<IOIEDevice*>(pIBaseClass);
+		if (!pIOIEDevice)
+			throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDCAST);
+		
+		pIOIEDevice->StartRecordingStream(eCompression, nCompressionLevel);
+
+		return LIBMCDRIVER_SCANLABOIE_SUCCESS;
+	}
+	catch (ELibMCDriver_ScanLabOIEInterfaceException & Exception) {
+		return handleLibMCDriver_ScanLabOIEException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_ScanLabOIEResult libmcdriver_scanlaboie_oiedevice_stoprecordingstream(LibMCDriver_ScanLabOIE_OIEDevice pOIEDevice)
+{
+	IBase* pIBaseClass = (IBase *)pOIEDevice;
+
+	try {
+		IOIEDevice* pIOIEDevice = dynamic_cast<IOIEDevice*>(pIBaseClass);
+		if (!pIOIEDevice)
+			throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDCAST);
+		
+		pIOIEDevice->StopRecordingStream();
+
+		return LIBMCDRIVER_SCANLABOIE_SUCCESS;
+	}
+	catch (ELibMCDriver_ScanLabOIEInterfaceException & Exception) {
+		return handleLibMCDriver_ScanLabOIEException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_ScanLabOIEResult libmcdriver_scanlaboie_oiedevice_recordingstreamisactive(LibMCDriver_ScanLabOIE_OIEDevice pOIEDevice, bool * pValue)
+{
+	IBase* pIBaseClass = (IBase *)pOIEDevice;
+
+	try {
+		if (pValue == nullptr)
+			throw ELibMCDriver_ScanLabOIEInterfaceException (LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+		IOIEDevice* pIOIEDevice = dynamic_cast<IOIEDevice*>(pIBaseClass);
+		if (!pIOIEDevice)
+			throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDCAST);
+		
+		*pValue = pIOIEDevice->RecordingStreamIsActive();
+
+		return LIBMCDRIVER_SCANLABOIE_SUCCESS;
+	}
+	catch (ELibMCDriver_ScanLabOIEInterfaceException & Exception) {
+		return handleLibMCDriver_ScanLabOIEException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_ScanLabOIEResult libmcdriver_scanlaboie_oiedevice_getrecordingstreamstatistics(LibMCDriver_ScanLabOIE_OIEDevice pOIEDevice, LibMCDriver_ScanLabOIE_uint64 * pRecordCount, LibMCDriver_ScanLabOIE_uint64 * pChunkCount, LibMCDriver_ScanLabOIE_uint64 * pUncompressedSize, LibMCDriver_ScanLabOIE_uint64 * pStreamSize, LibMCDriver_ScanLabOIE_uint64 * pDroppedRecordCount)
+{
+	IBase* pIBaseClass = (IBase *)pOIEDevice;
+
+	try {
+		if (!pRecordCount)
+			throw ELibMCDriver_ScanLabOIEInterfaceException (LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+		if (!pChunkCount)
+			throw ELibMCDriver_ScanLabOIEInterfaceException (LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+		if (!pUncompressedSize)
+			throw ELibMCDriver_ScanLabOIEInterfaceException (LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+		if (!pStreamSize)
+			throw ELibMCDriver_ScanLabOIEInterfaceException (LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+		if (!pDroppedRecordCount)
+			throw ELibMCDriver_ScanLabOIEInterfaceException (LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+		IOIEDevice* pIOIEDevice = dynamic_cast<IOIEDevice*>(pIBaseClass);
+		if (!pIOIEDevice)
+			throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDCAST);
+		
+		pIOIEDevice->GetRecordingStreamStatistics(*pRecordCount, *pChunkCount, *pUncompressedSize, *pStreamSize, *pDroppedRecordCount);
+
+		return LIBMCDRIVER_SCANLABOIE_SUCCESS;
+	}
+	catch (ELibMCDriver_ScanLabOIEInterfaceException & Exception) {
+		return handleLibMCDriver_ScanLabOIEException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_ScanLabOIEResult libmcdriver_scanlaboie_oiedevice_loadrecordingstream(LibMCDriver_ScanLabOIE_OIEDevice pOIEDevice, LibMCDriver_ScanLabOIE_DataRecording * pRecordingInstance)
+{
+	IBase* pIBaseClass = (IBase *)pOIEDevice;
+
+	try {
+		if (pRecordingInstance == nullptr)
+			throw ELibMCDriver_ScanLabOIEInterfaceException (LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDPARAM);
+		IBase* pBaseRecordingInstance(nullptr);
+		IOIEDevice* pIOIEDevice = dynamic_cast<IOIEDevice*>(pIBaseClass);
+		if (!pIOIEDevice)
+			throw ELibMCDriver_ScanLabOIEInterfaceException(LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDCAST);
+		
+		pBaseRecordingInstance = pIOIEDevice->LoadRecordingStream();
+
+		*pRecordingInstance = (IBase*)(pBaseRecordingInstance);
+		return LIBMCDRIVER_SCANLABOIE_SUCCESS;
+	}
+	catch (ELibMCDriver_ScanLabOIEInterfaceException & Exception) {
+		return handleLibMCDriver_ScanLabOIEException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 LibMCDriver_ScanLabOIEResult libmcdriver_scanlaboie_oiedevice_isloggedin(LibMCDriver_ScanLabOIE_OIEDevice pOIEDevice, bool * pValue)
 {
 	IBase* pIBaseClass = (IBase *)pOIEDevice;
@@ -2825,6 +2961,16 @@ LibMCDriver_ScanLabOIEResult LibMCDriver_ScanLabOIE::Impl::LibMCDriver_ScanLabOI
 		*ppProcAddress = (void*) &libmcdriver_scanlaboie_oiedevice_retrievecurrentrecording;
 	if (sProcName == "libmcdriver_scanlaboie_oiedevice_clearcurrentrecording") 
 		*ppProcAddress = (void*) &libmcdriver_scanlaboie_oiedevice_clearcurrentrecording;
+	if (sProcName == "libmcdriver_scanlaboie_oiedevice_startrecordingstream") 
+		*ppProcAddress = (void*) &libmcdriver_scanlaboie_oiedevice_startrecordingstream;
+	if (sProcName == "libmcdriver_scanlaboie_oiedevice_stoprecordingstream") 
+		*ppProcAddress = (void*) &libmcdriver_scanlaboie_oiedevice_stoprecordingstream;
+	if (sProcName == "libmcdriver_scanlaboie_oiedevice_recordingstreamisactive") 
+		*ppProcAddress = (void*) &libmcdriver_scanlaboie_oiedevice_recordingstreamisactive;
+	if (sProcName == "libmcdriver_scanlaboie_oiedevice_getrecordingstreamstatistics") 
+		*ppProcAddress = (void*) &libmcdriver_scanlaboie_oiedevice_getrecordingstreamstatistics;
+	if (sProcName == "libmcdriver_scanlaboie_oiedevice_loadrecordingstream") 
+		*ppProcAddress = (void*) &libmcdriver_scanlaboie_oiedevice_loadrecordingstream;
 	if (sProcName == "libmcdriver_scanlaboie_oiedevice_isloggedin") 
 		*ppProcAddress = (void*) &libmcdriver_scanlaboie_oiedevice_isloggedin;
 	if (sProcName == "libmcdriver_scanlaboie_oiedevice_isstreaming") 
@@ -163,6 +163,14 @@ typedef void * LibMCDriver_ScanLabOIE_pvoid;
 #define LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDOIEEXECUTIONMODE 1056 /** Invalid OIE Execution mode. */
 #define LIBMCDRIVER_SCANLABOIE_ERROR_POSITIONMISSINGINOIERTCIDLIST 1057 /** Position missing in OIE RTC ID List. */
 #define LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDOIEDEVICESTATE 1058 /** Invalid OIE device state. */
+#define LIBMCDRIVER_SCANLABOIE_ERROR_RECORDINGSTREAMALREADYACTIVE 1059 /** Recording stream is already active. */
+#define LIBMCDRIVER_SCANLABOIE_ERROR_RECORDINGSTREAMISACTIVE 1060 /** Recording stream is still active. */
+#define LIBMCDRIVER_SCANLABOIE_ERROR_NORECORDINGSTREAMAVAILABLE 1061 /** No recording stream available. */
+#define LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAMCOMPRESSIONLEVEL 1062 /** Invalid recording stream compression level. */
+#define LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTWRITERECORDINGSTREAM 1063 /** Could not write recording stream. */
+#define LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTREADRECORDINGSTREAM 1064 /** Could not read recording stream. */
+#define LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM 1065 /** Invalid recording stream. */
+#define LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAMCOMPRESSION 1066 /** Invalid recording stream compression. */
 
 /*************************************************************************************************************************
  Error strings for LibMCDriver_ScanLabOIE
@@ -238,6 +246,14 @@ inline const char * LIBMCDRIVER_SCANLABOIE_GETERRORSTRING (LibMCDriver_ScanLabOI
     case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDOIEEXECUTIONMODE: return "Invalid OIE Execution mode.";
     case LIBMCDRIVER_SCANLABOIE_ERROR_POSITIONMISSINGINOIERTCIDLIST: return "Position missing in OIE RTC ID List.";
     case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDOIEDEVICESTATE: return "Invalid OIE device state.";
+    case LIBMCDRIVER_SCANLABOIE_ERROR_RECORDINGSTREAMALREADYACTIVE: return "Recording stream is already active.";
+    case LIBMCDRIVER_SCANLABOIE_ERROR_RECORDINGSTREAMISACTIVE: return "Recording stream is still active.";
+    case LIBMCDRIVER_SCANLABOIE_ERROR_NORECORDINGSTREAMAVAILABLE: return "No recording stream available.";
+    case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAMCOMPRESSIONLEVEL: return "Invalid recording stream compression level.";
+    case LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTWRITERECORDINGSTREAM: return "Could not write recording stream.";
+    case LIBMCDRIVER_SCANLABOIE_ERROR_COULDNOTREADRECORDINGSTREAM: return "Could not read recording stream.";
+    case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAM: return "Invalid recording stream.";
+    case LIBMCDRIVER_SCANLABOIE_ERROR_INVALIDRECORDINGSTREAMCOMPRESSION: return "Invalid recording stream compression.";
     default: return "unknown error";
   }
 }
@@ -272,10 +288,17 @@ namespace LibMCDriver_ScanLabOIE {
     OIEVersion3 = 3
   };
   
+  enum class eRecordingStreamCompression : LibMCDriver_ScanLabOIE_int32 {
+    NoCompression = 0,
+    ZLib = 1,
+    LZ4 = 2
+  };
+  
 } // namespace LibMCDriver_ScanLabOIE;
 
 // define legacy C-names for enums, structs and function types
 typedef LibMCDriver_ScanLabOIE::eRTCDeviceType eLibMCDriver_ScanLabOIERTCDeviceType;
 typedef LibMCDriver_ScanLabOIE::eOIEDeviceDriverType eLibMCDriver_ScanLabOIEOIEDeviceDriverType;
+typedef LibMCDriver_ScanLabOIE::eRecordingStreamCompression eLibMCDriver_ScanLabOIERecordingStreamCompression;
 
 #endif // __LIBMCDRIVER_SCANLABOIE_TYPES_HEADER_CPP
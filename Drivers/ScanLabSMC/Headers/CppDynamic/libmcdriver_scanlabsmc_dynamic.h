@@ -235,6 +235,37 @@ typedef LibMCDriver_ScanLabSMCResult (*PLibMCDriver_ScanLabSMCSMCJob_IsExecuting
 */
 typedef LibMCDriver_ScanLabSMCResult (*PLibMCDriver_ScanLabSMCSMCJob_WaitForExecutionPtr) (LibMCDriver_ScanLabSMC_SMCJob pSMCJob, LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds);
 
+/**
+* Waits until the execution is finished or the timeout is reached. Does not fail on timeout, so that a state can check for termination in between. Will fail if an error occured.
+*
+* @param[in] pSMCJob - SMCJob instance.
+* @param[in] nTimeOutInMilliseconds - Maximum time to wait. 0 returns immediately.
+* @param[out] pFinished - Returns true if the execution has finished.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_ScanLabSMCResult (*PLibMCDriver_ScanLabSMCSMCJob_WaitForCompletionPtr) (LibMCDriver_ScanLabSMC_SMCJob pSMCJob, LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds, bool * pFinished);
+
+/**
+* Returns the estimated progress of the execution. The estimate is based on the motion micro steps of the job.
+*
+* @param[in] pSMCJob - SMCJob instance.
+* @param[out] pProgress - Progress between 0.0 (not started) and 1.0 (finished).
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_ScanLabSMCResult (*PLibMCDriver_ScanLabSMCSMCJob_GetExecutionProgressPtr) (LibMCDriver_ScanLabSMC_SMCJob pSMCJob, LibMCDriver_ScanLabSMC_double * pProgress);
+
+/**
+* Returns the timing of the job. Preparation lasts from BeginJob until Execute has been called.
+*
+* @param[in] pSMCJob - SMCJob instance.
+* @param[out] pPreparationTime - Preparation time of the job in milliseconds.
+* @param[out] pQueueTime - Time in milliseconds between the call of Execute and the start of the execution.
+* @param[out] pExecutionTime - Execution time in milliseconds. Counts up to now if the job is still executing.
+* @param[out] pOverlapTime - Part of the preparation time in milliseconds in which another job of the same context has been executing.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_ScanLabSMCResult (*PLibMCDriver_ScanLabSMCSMCJob_GetExecutionStatisticsPtr) (LibMCDriver_ScanLabSMC_SMCJob pSMCJob, LibMCDriver_ScanLabSMC_double * pPreparationTime, LibMCDriver_ScanLabSMC_double * pQueueTime, LibMCDriver_ScanLabSMC_double * pExecutionTime, LibMCDriver_ScanLabSMC_double * pOverlapTime);
+
 /**
 * Stops the execution of the current list immediately.
 *
@@ -718,6 +749,17 @@ typedef LibMCDriver_ScanLabSMCResult (*PLibMCDriver_ScanLabSMCDriver_ScanLabSMC_
 */
 typedef LibMCDriver_ScanLabSMCResult (*PLibMCDriver_ScanLabSMCDriver_ScanLabSMC_CreateTemplateConfigurationPtr) (LibMCDriver_ScanLabSMC_Driver_ScanLabSMC pDriver_ScanLabSMC, const char * pTemplateName, LibMCDriver_ScanLabSMC_SMCConfiguration * pInstance);
 
+/**
+* Parses the content of an SMC simulation file into a data table. Uses the same columns as SMCJob.LoadSimulationData. Does not need the SDK to be loaded.
+*
+* @param[in] pDriver_ScanLabSMC - Driver_ScanLabSMC instance.
+* @param[in] nSimulationDataBufferSize - Number of elements in buffer
+* @param[in] pSimulationDataBuffer - uint8 buffer of Content of the simulation file.
+* @param[in] pSimulationDataTable - Data table object to read the simulation into.
+* @return error code or 0 (success)
+*/
+typedef LibMCDriver_ScanLabSMCResult (*PLibMCDriver_ScanLabSMCDriver_ScanLabSMC_LoadSimulationFileDataPtr) (LibMCDriver_ScanLabSMC_Driver_ScanLabSMC pDriver_ScanLabSMC, LibMCDriver_ScanLabSMC_uint64 nSimulationDataBufferSize, const LibMCDriver_ScanLabSMC_uint8 * pSimulationDataBuffer, LibMCEnv_DataTable pSimulationDataTable);
+
 /*************************************************************************************************************************
  Global functions
 **************************************************************************************************************************/
@@ -811,6 +853,9 @@ typedef struct {
 	PLibMCDriver_ScanLabSMCSMCJob_ExecutePtr m_SMCJob_Execute;
 	PLibMCDriver_ScanLabSMCSMCJob_IsExecutingPtr m_SMCJob_IsExecuting;
 	PLibMCDriver_ScanLabSMCSMCJob_WaitForExecutionPtr m_SMCJob_WaitForExecution;
+	PLibMCDriver_ScanLabSMCSMCJob_WaitForCompletionPtr m_SMCJob_WaitForCompletion;
+	PLibMCDriver_ScanLabSMCSMCJob_GetExecutionProgressPtr m_SMCJob_GetExecutionProgress;
+	PLibMCDriver_ScanLabSMCSMCJob_GetExecutionStatisticsPtr m_SMCJob_GetExecutionStatistics;
 	PLibMCDriver_ScanLabSMCSMCJob_StopExecutionPtr m_SMCJob_StopExecution;
 	PLibMCDriver_ScanLabSMCSMCJob_LoadSimulationDataPtr m_SMCJob_LoadSimulationData;
 	PLibMCDriver_ScanLabSMCSMCJob_GetJobCharacteristicPtr m_SMCJob_GetJobCharacteristic;
@@ -859,6 +904,7 @@ typedef struct {
 	PLibMCDriver_ScanLabSMCDriver_ScanLabSMC_ReleaseContextPtr m_Driver_ScanLabSMC_ReleaseContext;
 	PLibMCDriver_ScanLabSMCDriver_ScanLabSMC_CreateEmptyConfigurationPtr m_Driver_ScanLabSMC_CreateEmptyConfiguration;
 	PLibMCDriver_ScanLabSMCDriver_ScanLabSMC_CreateTemplateConfigurationPtr m_Driver_ScanLabSMC_CreateTemplateConfiguration;
+	PLibMCDriver_ScanLabSMCDriver_ScanLabSMC_LoadSimulationFileDataPtr m_Driver_ScanLabSMC_LoadSimulationFileData;
 	PLibMCDriver_ScanLabSMCGetVersionPtr m_GetVersion;
 	PLibMCDriver_ScanLabSMCGetLastErrorPtr m_GetLastError;
 	PLibMCDriver_ScanLabSMCReleaseInstancePtr m_ReleaseInstance;
@@ -230,6 +230,13 @@ public:
 			case LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTGETJOBCHARACTERISTIC: return "COULDNOTGETJOBCHARACTERISTIC";
 			case LIBMCDRIVER_SCANLABSMC_ERROR_JOBDURATIONHASNOTBEENPARSED: return "JOBDURATIONHASNOTBEENPARSED";
 			case LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTSTOPJOBEXECUTION: return "COULDNOTSTOPJOBEXECUTION";
+			case LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONFILEENTRY: return "INVALIDSIMULATIONFILEENTRY";
+			case LIBMCDRIVER_SCANLABSMC_ERROR_JOBISNOTFINALIZED: return "JOBISNOTFINALIZED";
+			case LIBMCDRIVER_SCANLABSMC_ERROR_JOBHASALREADYBEENEXECUTED: return "JOBHASALREADYBEENEXECUTED";
+			case LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONTIMEOUT: return "JOBEXECUTIONTIMEOUT";
+			case LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONABORTED: return "JOBEXECUTIONABORTED";
+			case LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONFAILED: return "JOBEXECUTIONFAILED";
+			case LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONNOTSTARTED: return "JOBEXECUTIONNOTSTARTED";
 		}
 		return "UNKNOWN";
 	}
@@ -290,6 +297,13 @@ public:
 			case LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTGETJOBCHARACTERISTIC: return "Could not get job characteristic.";
 			case LIBMCDRIVER_SCANLABSMC_ERROR_JOBDURATIONHASNOTBEENPARSED: return "Job duration has not been parsed.";
 			case LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTSTOPJOBEXECUTION: return "Could not stop job execution.";
+			case LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONFILEENTRY: return "Invalid simulation file entry.";
+			case LIBMCDRIVER_SCANLABSMC_ERROR_JOBISNOTFINALIZED: return "Job is not finalized.";
+			case LIBMCDRIVER_SCANLABSMC_ERROR_JOBHASALREADYBEENEXECUTED: return "Job has already been executed.";
+			case LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONTIMEOUT: return "Job execution timeout.";
+			case LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONABORTED: return "Job execution has been aborted.";
+			case LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONFAILED: return "Job execution failed.";
+			case LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONNOTSTARTED: return "Job execution has not been started.";
 		}
 		return "unknown error";
 	}
@@ -524,6 +538,9 @@ public:
 	inline void Execute(const bool bBlocking);
 	inline bool IsExecuting();
 	inline void WaitForExecution(const LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds);
+	inline bool WaitForCompletion(const LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds);
+	inline LibMCDriver_ScanLabSMC_double GetExecutionProgress();
+	inline void GetExecutionStatistics(LibMCDriver_ScanLabSMC_double & dPreparationTime, LibMCDriver_ScanLabSMC_double & dQueueTime, LibMCDriver_ScanLabSMC_double & dExecutionTime, LibMCDriver_ScanLabSMC_double & dOverlapTime);
 	inline void StopExecution();
 	inline void LoadSimulationData(classParam<LibMCEnv::CDataTable> pSimulationDataTable);
 	inline LibMCDriver_ScanLabSMC_double GetJobCharacteristic(const eJobCharacteristic eValueType);
@@ -620,6 +637,7 @@ public:
 	inline void ReleaseContext(const std::string & sContextName);
 	inline PSMCConfiguration CreateEmptyConfiguration();
 	inline PSMCConfiguration CreateTemplateConfiguration(const std::string & sTemplateName);
+	inline void LoadSimulationFileData(const CInputVector<LibMCDriver_ScanLabSMC_uint8> & SimulationDataBuffer, classParam<LibMCEnv::CDataTable> pSimulationDataTable);
 };
 	
 	/**
@@ -761,6 +779,9 @@ public:
 		pWrapperTable->m_SMCJob_Execute = nullptr;
 		pWrapperTable->m_SMCJob_IsExecuting = nullptr;
 		pWrapperTable->m_SMCJob_WaitForExecution = nullptr;
+		pWrapperTable->m_SMCJob_WaitForCompletion = nullptr;
+		pWrapperTable->m_SMCJob_GetExecutionProgress = nullptr;
+		pWrapperTable->m_SMCJob_GetExecutionStatistics = nullptr;
 		pWrapperTable->m_SMCJob_StopExecution = nullptr;
 		pWrapperTable->m_SMCJob_LoadSimulationData = nullptr;
 		pWrapperTable->m_SMCJob_GetJobCharacteristic = nullptr;
@@ -809,6 +830,7 @@ public:
 		pWrapperTable->m_Driver_ScanLabSMC_ReleaseContext = nullptr;
 		pWrapperTable->m_Driver_ScanLabSMC_CreateEmptyConfiguration = nullptr;
 		pWrapperTable->m_Driver_ScanLabSMC_CreateTemplateConfiguration = nullptr;
+		pWrapperTable->m_Driver_ScanLabSMC_LoadSimulationFileData = nullptr;
 		pWrapperTable->m_GetVersion = nullptr;
 		pWrapperTable->m_GetLastError = nullptr;
 		pWrapperTable->m_ReleaseInstance = nullptr;
@@ -1019,6 +1041,33 @@ public:
 		if (pWrapperTable->m_SMCJob_WaitForExecution == nullptr)
 			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_SMCJob_WaitForCompletion = (PLibMCDriver_ScanLabSMCSMCJob_WaitForCompletionPtr) GetProcAddress(hLibrary, "libmcdriver_scanlabsmc_smcjob_waitforcompletion");
+		#else // _WIN32
+		pWrapperTable->m_SMCJob_WaitForCompletion = (PLibMCDriver_ScanLabSMCSMCJob_WaitForCompletionPtr) dlsym(hLibrary, "libmcdriver_scanlabsmc_smcjob_waitforcompletion");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_SMCJob_WaitForCompletion == nullptr)
+			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_SMCJob_GetExecutionProgress = (PLibMCDriver_ScanLabSMCSMCJob_GetExecutionProgressPtr) GetProcAddress(hLibrary, "libmcdriver_scanlabsmc_smcjob_getexecutionprogress");
+		#else // _WIN32
+		pWrapperTable->m_SMCJob_GetExecutionProgress = (PLibMCDriver_ScanLabSMCSMCJob_GetExecutionProgressPtr) dlsym(hLibrary, "libmcdriver_scanlabsmc_smcjob_getexecutionprogress");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_SMCJob_GetExecutionProgress == nullptr)
+			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_SMCJob_GetExecutionStatistics = (PLibMCDriver_ScanLabSMCSMCJob_GetExecutionStatisticsPtr) GetProcAddress(hLibrary, "libmcdriver_scanlabsmc_smcjob_getexecutionstatistics");
+		#else // _WIN32
+		pWrapperTable->m_SMCJob_GetExecutionStatistics = (PLibMCDriver_ScanLabSMCSMCJob_GetExecutionStatisticsPtr) dlsym(hLibrary, "libmcdriver_scanlabsmc_smcjob_getexecutionstatistics");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_SMCJob_GetExecutionStatistics == nullptr)
+			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_SMCJob_StopExecution = (PLibMCDriver_ScanLabSMCSMCJob_StopExecutionPtr) GetProcAddress(hLibrary, "libmcdriver_scanlabsmc_smcjob_stopexecution");
 		#else // _WIN32
@@ -1451,6 +1500,15 @@ public:
 		if (pWrapperTable->m_Driver_ScanLabSMC_CreateTemplateConfiguration == nullptr)
 			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Driver_ScanLabSMC_LoadSimulationFileData = (PLibMCDriver_ScanLabSMCDriver_ScanLabSMC_LoadSimulationFileDataPtr) GetProcAddress(hLibrary, "libmcdriver_scanlabsmc_driver_scanlabsmc_loadsimulationfiledata");
+		#else // _WIN32
+		pWrapperTable->m_Driver_ScanLabSMC_LoadSimulationFileData = (PLibMCDriver_ScanLabSMCDriver_ScanLabSMC_LoadSimulationFileDataPtr) dlsym(hLibrary, "libmcdriver_scanlabsmc_driver_scanlabsmc_loadsimulationfiledata");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Driver_ScanLabSMC_LoadSimulationFileData == nullptr)
+			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_GetVersion = (PLibMCDriver_ScanLabSMCGetVersionPtr) GetProcAddress(hLibrary, "libmcdriver_scanlabsmc_getversion");
 		#else // _WIN32
@@ -1598,6 +1656,18 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_SMCJob_WaitForExecution == nullptr) )
 			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_scanlabsmc_smcjob_waitforcompletion", (void**)&(pWrapperTable->m_SMCJob_WaitForCompletion));
+		if ( (eLookupError != 0) || (pWrapperTable->m_SMCJob_WaitForCompletion == nullptr) )
+			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlabsmc_smcjob_getexecutionprogress", (void**)&(pWrapperTable->m_SMCJob_GetExecutionProgress));
+		if ( (eLookupError != 0) || (pWrapperTable->m_SMCJob_GetExecutionProgress == nullptr) )
+			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("libmcdriver_scanlabsmc_smcjob_getexecutionstatistics", (void**)&(pWrapperTable->m_SMCJob_GetExecutionStatistics));
+		if ( (eLookupError != 0) || (pWrapperTable->m_SMCJob_GetExecutionStatistics == nullptr) )
+			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_scanlabsmc_smcjob_stopexecution", (void**)&(pWrapperTable->m_SMCJob_StopExecution));
 		if ( (eLookupError != 0) || (pWrapperTable->m_SMCJob_StopExecution == nullptr) )
 			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -1790,6 +1860,10 @@ public:
 		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLabSMC_CreateTemplateConfiguration == nullptr) )
 			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("libmcdriver_scanlabsmc_driver_scanlabsmc_loadsimulationfiledata", (void**)&(pWrapperTable->m_Driver_ScanLabSMC_LoadSimulationFileData));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Driver_ScanLabSMC_LoadSimulationFileData == nullptr) )
+			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("libmcdriver_scanlabsmc_getversion", (void**)&(pWrapperTable->m_GetVersion));
 		if ( (eLookupError != 0) || (pWrapperTable->m_GetVersion == nullptr) )
 			return LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -2036,6 +2110,43 @@ public:
 		CheckError(m_pWrapper->m_WrapperTable.m_SMCJob_WaitForExecution(m_pHandle, nTimeOutInMilliseconds));
 	}
 	
+	/**
+	* CSMCJob::WaitForCompletion - Waits until the execution is finished or the timeout is reached. Does not fail on timeout, so that a state can check for termination in between. Will fail if an error occured.
+	* @param[in] nTimeOutInMilliseconds - Maximum time to wait. 0 returns immediately.
+	* @return Returns true if the execution has finished.
+	*/
+	bool CSMCJob::WaitForCompletion(const LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds)
+	{
+		bool resultFinished = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_SMCJob_WaitForCompletion(m_pHandle, nTimeOutInMilliseconds, &resultFinished));
+		
+		return resultFinished;
+	}
+	
+	/**
+	* CSMCJob::GetExecutionProgress - Returns the estimated progress of the execution. The estimate is based on the motion micro steps of the job.
+	* @return Progress between 0.0 (not started) and 1.0 (finished).
+	*/
+	LibMCDriver_ScanLabSMC_double CSMCJob::GetExecutionProgress()
+	{
+		LibMCDriver_ScanLabSMC_double resultProgress = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_SMCJob_GetExecutionProgress(m_pHandle, &resultProgress));
+		
+		return resultProgress;
+	}
+	
+	/**
+	* CSMCJob::GetExecutionStatistics - Returns the timing of the job. Preparation lasts from BeginJob until Execute has been called.
+	* @param[out] dPreparationTime - Preparation time of the job in milliseconds.
+	* @param[out] dQueueTime - Time in milliseconds between the call of Execute and the start of the execution.
+	* @param[out] dExecutionTime - Execution time in milliseconds. Counts up to now if the job is still executing.
+	* @param[out] dOverlapTime - Part of the preparation time in milliseconds in which another job of the same context has been executing.
+	*/
+	void CSMCJob::GetExecutionStatistics(LibMCDriver_ScanLabSMC_double & dPreparationTime, LibMCDriver_ScanLabSMC_double & dQueueTime, LibMCDriver_ScanLabSMC_double & dExecutionTime, LibMCDriver_ScanLabSMC_double & dOverlapTime)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_SMCJob_GetExecutionStatistics(m_pHandle, &dPreparationTime, &dQueueTime, &dExecutionTime, &dOverlapTime));
+	}
+	
 	/**
 	* CSMCJob::StopExecution - Stops the execution of the current list immediately.
 	*/
@@ -2604,6 +2715,17 @@ public:
 		}
 		return std::make_shared<CSMCConfiguration>(m_pWrapper, hInstance);
 	}
+	
+	/**
+	* CDriver_ScanLabSMC::LoadSimulationFileData - Parses the content of an SMC simulation file into a data table. Uses the same columns as SMCJob.LoadSimulationData. Does not need the SDK to be loaded.
+	* @param[in] SimulationDataBuffer - Content of the simulation file.
+	* @param[in] pSimulationDataTable - Data table object to read the simulation into.
+	*/
+	void CDriver_ScanLabSMC::LoadSimulationFileData(const CInputVector<LibMCDriver_ScanLabSMC_uint8> & SimulationDataBuffer, classParam<LibMCEnv::CDataTable> pSimulationDataTable)
+	{
+		LibMCEnvHandle hSimulationDataTable = pSimulationDataTable.GetHandle();
+		CheckError(m_pWrapper->m_WrapperTable.m_Driver_ScanLabSMC_LoadSimulationFileData(m_pHandle, (LibMCDriver_ScanLabSMC_uint64)SimulationDataBuffer.size(), SimulationDataBuffer.data(), hSimulationDataTable));
+	}
 
 } // namespace LibMCDriver_ScanLabSMC
 
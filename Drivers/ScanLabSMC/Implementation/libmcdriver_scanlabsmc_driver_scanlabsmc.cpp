@@ -36,6 +36,7 @@ Abstract: This is a stub class definition of CDriver_ScanLabSMC
 #include "libmcdriver_scanlabsmc_smccontext.hpp"
 #include "libmcdriver_scanlabsmc_smccontextinstance.hpp"
 #include "libmcdriver_scanlabsmc_smcconfiguration.hpp"
+#include "libmcdriver_scanlabsmc_smcsimulationparser.hpp"
 
 // Include custom headers here.
 #define __STRINGIZE(x) #x
@@ -231,6 +232,25 @@ ISMCConfiguration* CDriver_ScanLabSMC::CreateTemplateConfiguration(const std::st
     throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_NOTIMPLEMENTED);
 }
 
+void CDriver_ScanLabSMC::LoadSimulationFileData(const LibMCDriver_ScanLabSMC_uint64 nSimulationDataBufferSize, const LibMCDriver_ScanLabSMC_uint8* pSimulationDataBuffer, LibMCEnv::PDataTable pSimulationDataTable)
+{
+    if ((nSimulationDataBufferSize == 0) || (pSimulationDataBuffer == nullptr))
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+    if (pSimulationDataTable.get() == nullptr)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+
+    // The parser maps the file into memory, so the data is stored in a temporary file first.
+    auto pWorkingDirectory = m_pDriverEnvironment->CreateWorkingDirectory();
+    auto pSimulationFile = pWorkingDirectory->StoreCustomDataInTempFile("txt", LibMCEnv::CInputVector<uint8_t>(pSimulationDataBuffer, (size_t)nSimulationDataBufferSize));
+
+    {
+        CSMCSimulationParser parser(pSimulationFile->GetAbsoluteFileName());
+        parser.writeToDataTable(pSimulationDataTable);
+    }
+
+    pSimulationFile->DeleteFromDisk();
+}
+
 ISMCContext* CDriver_ScanLabSMC::CreateContext(const std::string& sContextName, ISMCConfiguration* pSMCConfiguration)
 {
     if (sContextName.empty ())
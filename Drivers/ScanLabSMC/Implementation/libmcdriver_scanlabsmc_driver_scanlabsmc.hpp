@@ -105,6 +105,8 @@ public:
 
 	ISMCConfiguration* CreateTemplateConfiguration(const std::string& sTemplateName) override;
 
+	void LoadSimulationFileData(const LibMCDriver_ScanLabSMC_uint64 nSimulationDataBufferSize, const LibMCDriver_ScanLabSMC_uint8* pSimulationDataBuffer, LibMCEnv::PDataTable pSimulationDataTable) override;
+
     void Configure(const std::string& sConfigurationString) override;
 
     std::string GetName() override;
@@ -66,4 +66,9 @@ slscHandle CSMCContextHandle::getHandle()
 PScanLabSMCSDK CSMCContextHandle::getSDK()
 {
     return m_pSDK;
+}
+
+std::mutex& CSMCContextHandle::getSDKMutex()
+{
+    return m_SDKMutex;
 }
\ No newline at end of file
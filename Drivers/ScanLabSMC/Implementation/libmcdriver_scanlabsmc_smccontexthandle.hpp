@@ -47,6 +47,8 @@ Abstract: This is the class declaration of CSMCContext
 // Include custom headers here.
 #include "libmcdriver_scanlabsmc_sdk.hpp"
 
+#include <mutex>
+
 namespace LibMCDriver_ScanLabSMC {
 namespace Impl {
 
@@ -57,6 +59,8 @@ namespace Impl {
         slscHandle m_Handle;
         PScanLabSMCSDK m_pSDK;
 
+        std::mutex m_SDKMutex;
+
     public:
 
         CSMCContextHandle(PScanLabSMCSDK pSDK, slscHandle handle);
@@ -67,6 +71,9 @@ namespace Impl {
 
         PScanLabSMCSDK getSDK ();
 
+        // Serializes the SDK calls on the handle between the job dispatcher thread and the calling thread.
+        std::mutex& getSDKMutex ();
+
     };
 
     typedef std::shared_ptr<CSMCContextHandle> PSMCContextHandle;
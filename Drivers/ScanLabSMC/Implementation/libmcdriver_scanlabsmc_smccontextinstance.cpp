@@ -98,6 +98,7 @@ CSMCContextInstance::CSMCContextInstance(const std::string& sContextName, ISMCCo
 	m_pSDK->checkError(newHandle, m_pSDK->slsc_cfg_initialize_from_file(&newHandle, sConfigurationFilePath.c_str()));
 
 	m_pContextHandle = std::make_shared<CSMCContextHandle>(m_pSDK, newHandle);
+	m_pJobDispatcher = std::make_shared<CSMCJobDispatcher>(m_pContextHandle);
 
 	pConfigurationFile = nullptr;
 
@@ -105,6 +106,7 @@ CSMCContextInstance::CSMCContextInstance(const std::string& sContextName, ISMCCo
 
 CSMCContextInstance::~CSMCContextInstance()
 {
+	m_pJobDispatcher = nullptr;
 	m_pContextHandle = nullptr;
 	m_pSDK = nullptr;
 
@@ -155,7 +157,7 @@ std::string CSMCContextInstance::GetSimulationSubDirectory()
 
 PSMCJobInstance CSMCContextInstance::BeginJob(const double dStartPositionX, const double dStartPositionY, const LibMCDriver_ScanLabSMC::eBlendMode eBlendMode)
 {
-	return std::make_shared<CSMCJobInstance> (m_pContextHandle, dStartPositionX, dStartPositionY, eBlendMode, m_pWorkingDirectory, m_sSimulationSubDirectory);
+	return std::make_shared<CSMCJobInstance> (m_pContextHandle, m_pJobDispatcher, dStartPositionX, dStartPositionY, eBlendMode, m_pWorkingDirectory, m_sSimulationSubDirectory);
 }
 
 PSMCJobInstance CSMCContextInstance::GetUnfinishedJob()
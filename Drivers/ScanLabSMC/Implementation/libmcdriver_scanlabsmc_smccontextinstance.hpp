@@ -38,6 +38,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "libmcdriver_scanlabsmc_smccontexthandle.hpp"
 #include "libmcdriver_scanlabsmc_sdk.hpp"
 #include "libmcdriver_scanlabsmc_smcjobinstance.hpp"
+#include "libmcdriver_scanlabsmc_smcjobexecution.hpp"
 
 
 namespace LibMCDriver_ScanLabSMC {
@@ -53,6 +54,7 @@ private:
 
 	PSMCContextHandle m_pContextHandle;
 	PScanLabSMCSDK m_pSDK;
+	PSMCJobDispatcher m_pJobDispatcher;
 	std::string m_sContextName;
 
 	LibMCEnv::PDriverEnvironment m_pDriverEnvironment;
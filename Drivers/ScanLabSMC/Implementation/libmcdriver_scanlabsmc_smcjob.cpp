@@ -122,6 +122,21 @@ void CSMCJob::WaitForExecution(const LibMCDriver_ScanLabSMC_uint32 nTimeOutInMil
     m_pJobInstance->WaitForExecution(nTimeOutInMilliseconds);
 }
 
+bool CSMCJob::WaitForCompletion(const LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds)
+{
+    return m_pJobInstance->WaitForCompletion(nTimeOutInMilliseconds);
+}
+
+LibMCDriver_ScanLabSMC_double CSMCJob::GetExecutionProgress()
+{
+    return m_pJobInstance->GetExecutionProgress();
+}
+
+void CSMCJob::GetExecutionStatistics(LibMCDriver_ScanLabSMC_double& dPreparationTime, LibMCDriver_ScanLabSMC_double& dQueueTime, LibMCDriver_ScanLabSMC_double& dExecutionTime, LibMCDriver_ScanLabSMC_double& dOverlapTime)
+{
+    m_pJobInstance->GetExecutionStatistics(dPreparationTime, dQueueTime, dExecutionTime, dOverlapTime);
+}
+
 void CSMCJob::StopExecution()
 {
     m_pJobInstance->StopExecution();
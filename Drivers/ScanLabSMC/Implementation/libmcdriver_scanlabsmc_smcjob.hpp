@@ -92,6 +92,12 @@ public:
 
 	void WaitForExecution(const LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds) override;
 
+	bool WaitForCompletion(const LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds) override;
+
+	LibMCDriver_ScanLabSMC_double GetExecutionProgress() override;
+
+	void GetExecutionStatistics(LibMCDriver_ScanLabSMC_double & dPreparationTime, LibMCDriver_ScanLabSMC_double & dQueueTime, LibMCDriver_ScanLabSMC_double & dExecutionTime, LibMCDriver_ScanLabSMC_double & dOverlapTime) override;
+
 	void StopExecution() override;
 
 	void LoadSimulationData(LibMCEnv::PDataTable pSimulationDataTable) override;
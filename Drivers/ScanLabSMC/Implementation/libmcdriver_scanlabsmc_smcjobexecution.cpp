@@ -0,0 +1,362 @@
+/*++
+
+Copyright (C) 2023 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is a stub class definition of CSMCJob
+
+Abstract: This is a stub class definition of CSMCJobExecution and CSMCJobDispatcher
+
+*/
+
+#include "libmcdriver_scanlabsmc_smcjobexecution.hpp"
+#include "libmcdriver_scanlabsmc_interfaceexception.hpp"
+
+// Include custom headers here.
+#include <algorithm>
+
+using namespace LibMCDriver_ScanLabSMC::Impl;
+
+/*************************************************************************************************************************
+ Class definition of CSMCJobExecution
+**************************************************************************************************************************/
+
+CSMCJobExecution::CSMCJobExecution(double dExpectedDuration)
+    : m_State (eSMCJobExecutionState::Queued),
+    m_dExpectedDuration (dExpectedDuration),
+    m_QueueTime (std::chrono::steady_clock::now ())
+{
+    m_StartTime = m_QueueTime;
+    m_EndTime = m_QueueTime;
+}
+
+CSMCJobExecution::~CSMCJobExecution()
+{
+
+}
+
+void CSMCJobExecution::checkForFailure()
+{
+    if (m_State == eSMCJobExecutionState::Failed) {
+        if (m_pException)
+            std::rethrow_exception(m_pException);
+
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONFAILED);
+    }
+}
+
+void CSMCJobExecution::setExecuting()
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    m_State = eSMCJobExecutionState::Executing;
+    m_StartTime = std::chrono::steady_clock::now();
+    m_EndTime = m_StartTime;
+}
+
+void CSMCJobExecution::setFinished()
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        m_State = eSMCJobExecutionState::Finished;
+        m_EndTime = std::chrono::steady_clock::now();
+    }
+
+    m_StateChanged.notify_all();
+}
+
+void CSMCJobExecution::setFailed(std::exception_ptr pException)
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        if (m_State == eSMCJobExecutionState::Queued)
+            m_StartTime = std::chrono::steady_clock::now();
+
+        m_State = eSMCJobExecutionState::Failed;
+        m_pException = pException;
+        m_EndTime = std::chrono::steady_clock::now();
+    }
+
+    m_StateChanged.notify_all();
+}
+
+bool CSMCJobExecution::isPending()
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    return (m_State == eSMCJobExecutionState::Queued) || (m_State == eSMCJobExecutionState::Executing);
+}
+
+bool CSMCJobExecution::waitForCompletion(uint32_t nTimeOutInMilliseconds)
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_StateChanged.wait_for(lock, std::chrono::milliseconds(nTimeOutInMilliseconds), [this] {
+        return (m_State == eSMCJobExecutionState::Finished) || (m_State == eSMCJobExecutionState::Failed);
+    });
+
+    checkForFailure();
+
+    return (m_State == eSMCJobExecutionState::Finished);
+}
+
+void CSMCJobExecution::waitForCompletion()
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_StateChanged.wait(lock, [this] {
+        return (m_State == eSMCJobExecutionState::Finished) || (m_State == eSMCJobExecutionState::Failed);
+    });
+
+    checkForFailure();
+}
+
+double CSMCJobExecution::getProgress()
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+    switch (m_State) {
+        case eSMCJobExecutionState::Finished:
+            return 1.0;
+
+        case eSMCJobExecutionState::Executing: {
+            if (m_dExpectedDuration <= 0.0)
+                return 0.0;
+
+            double dElapsedTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_StartTime).count();
+            // The estimate does not account for the stop of the scanner, so 1.0 is reserved for the finished state.
+            return std::min(dElapsedTime / m_dExpectedDuration, 0.99);
+        }
+
+        default:
+            return 0.0;
+    }
+}
+
+double CSMCJobExecution::getQueueTimeInMilliseconds()
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+    if (m_State == eSMCJobExecutionState::Queued)
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_QueueTime).count();
+
+    return std::chrono::duration<double, std::milli>(m_StartTime - m_QueueTime).count();
+}
+
+double CSMCJobExecution::getExecutionTimeInMilliseconds()
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+    switch (m_State) {
+        case eSMCJobExecutionState::Executing:
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_StartTime).count();
+
+        case eSMCJobExecutionState::Finished:
+        case eSMCJobExecutionState::Failed:
+            return std::chrono::duration<double, std::milli>(m_EndTime - m_StartTime).count();
+
+        default:
+            return 0.0;
+    }
+}
+
+
+/*************************************************************************************************************************
+ Class definition of CSMCJobDispatcher
+**************************************************************************************************************************/
+
+CSMCJobDispatcher::CSMCJobDispatcher(PSMCContextHandle pContextHandle)
+    : m_pContextHandle (pContextHandle),
+    m_bTerminate (false),
+    m_nUnstartedJobCount (0),
+    m_bIsExecuting (false),
+    m_dAccumulatedExecutionTime (0.0)
+{
+    if (pContextHandle.get() == nullptr)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+
+    m_pSDK = m_pContextHandle->getSDK();
+}
+
+CSMCJobDispatcher::~CSMCJobDispatcher()
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_QueueMutex);
+        m_bTerminate = true;
+    }
+    m_QueueChanged.notify_all();
+
+    if (m_WorkerThread.joinable())
+        m_WorkerThread.join();
+
+    // Jobs that have not been started will never be executed.
+    while (!m_Queue.empty()) {
+        m_Queue.front()->setFailed(std::make_exception_ptr(ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONABORTED)));
+        m_Queue.pop();
+    }
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_QueueMutex);
+        m_nUnstartedJobCount = 0;
+    }
+    m_JobStarted.notify_all();
+}
+
+void CSMCJobDispatcher::enqueueExecution(PSMCJobExecution pExecution)
+{
+    if (pExecution.get() == nullptr)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_QueueMutex);
+        m_Queue.push(pExecution);
+        m_nUnstartedJobCount++;
+
+        if (!m_WorkerThread.joinable())
+            m_WorkerThread = std::thread(&CSMCJobDispatcher::runWorker, this);
+    }
+
+    m_QueueChanged.notify_all();
+}
+
+double CSMCJobDispatcher::getAccumulatedExecutionTimeInMilliseconds()
+{
+    std::lock_guard<std::mutex> lockGuard(m_TimingMutex);
+
+    double dResult = m_dAccumulatedExecutionTime;
+    if (m_bIsExecuting)
+        dResult += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_ExecutionStartTime).count();
+
+    return dResult;
+}
+
+void CSMCJobDispatcher::waitForEnqueuedJobsToStart()
+{
+    std::unique_lock<std::mutex> lock(m_QueueMutex);
+    m_JobStarted.wait(lock, [this] { return m_bTerminate || (m_nUnstartedJobCount == 0); });
+}
+
+void CSMCJobDispatcher::markJobStarted()
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_QueueMutex);
+        if (m_nUnstartedJobCount > 0)
+            m_nUnstartedJobCount--;
+    }
+
+    m_JobStarted.notify_all();
+}
+
+bool CSMCJobDispatcher::terminationRequested()
+{
+    std::lock_guard<std::mutex> lockGuard(m_QueueMutex);
+    return m_bTerminate;
+}
+
+slsc_ExecState CSMCJobDispatcher::getExecState(slscHandle contextHandle)
+{
+    std::lock_guard<std::mutex> lockGuard(m_pContextHandle->getSDKMutex());
+
+    slsc_ExecState execState = slsc_ExecState::slsc_ExecState_NotInitOrError;
+    m_pSDK->checkError(contextHandle, m_pSDK->slsc_ctrl_get_exec_state(contextHandle, &execState));
+    return execState;
+}
+
+void CSMCJobDispatcher::runWorker()
+{
+    while (true) {
+
+        PSMCJobExecution pExecution;
+        {
+            std::unique_lock<std::mutex> lock(m_QueueMutex);
+            m_QueueChanged.wait(lock, [this] { return m_bTerminate || !m_Queue.empty(); });
+
+            if (m_bTerminate)
+                return;
+
+            pExecution = m_Queue.front();
+            m_Queue.pop();
+        }
+
+        bool bStartIssued = false;
+        try {
+            executeJob(pExecution, bStartIssued);
+        }
+        catch (...) {
+            pExecution->setFailed(std::current_exception());
+        }
+
+        // A job that failed before its start does not block the next BeginJob either.
+        if (!bStartIssued)
+            markJobStarted();
+
+        std::lock_guard<std::mutex> lockGuard(m_TimingMutex);
+        if (m_bIsExecuting) {
+            m_dAccumulatedExecutionTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_ExecutionStartTime).count();
+            m_bIsExecuting = false;
+        }
+
+    }
+}
+
+void CSMCJobDispatcher::executeJob(PSMCJobExecution pExecution, bool& bStartIssued)
+{
+    auto contextHandle = m_pContextHandle->getHandle();
+
+    while (getExecState(contextHandle) != slsc_ExecState::slsc_ExecState_ReadyForExecution) {
+        if (terminationRequested())
+            throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONABORTED);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(SCANLABSMC_READYPOLLINTERVAL_MS));
+    }
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_pContextHandle->getSDKMutex());
+        m_pSDK->checkError(contextHandle, m_pSDK->slsc_ctrl_start_execution(contextHandle));
+    }
+
+    bStartIssued = true;
+    markJobStarted();
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_TimingMutex);
+        m_bIsExecuting = true;
+        m_ExecutionStartTime = std::chrono::steady_clock::now();
+    }
+    pExecution->setExecuting();
+
+    slsc_ExecState execState = slsc_ExecState::slsc_ExecState_Executing;
+    while (execState == slsc_ExecState::slsc_ExecState_Executing) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(SCANLABSMC_EXECUTIONPOLLINTERVAL_MS));
+
+        if (terminationRequested())
+            throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONABORTED);
+
+        execState = getExecState(contextHandle);
+    }
+
+    if (execState == slsc_ExecState::slsc_ExecState_NotInitOrError)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONFAILED);
+
+    pExecution->setFinished();
+}
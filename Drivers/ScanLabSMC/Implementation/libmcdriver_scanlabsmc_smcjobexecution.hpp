@@ -0,0 +1,174 @@
+/*++
+
+Copyright (C) 2023 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class declaration of CSMCJob
+
+Abstract: This is the class declaration of CSMCJobExecution and CSMCJobDispatcher
+
+*/
+
+
+#ifndef __LIBMCDRIVER_SCANLABSMC_SMCJOBEXECUTION
+#define __LIBMCDRIVER_SCANLABSMC_SMCJOBEXECUTION
+
+#include "libmcdriver_scanlabsmc_interfaces.hpp"
+
+#include "libmcdriver_scanlabsmc_smccontexthandle.hpp"
+#include "libmcdriver_scanlabsmc_sdk.hpp"
+
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <queue>
+#include <chrono>
+#include <exception>
+
+#define SCANLABSMC_READYPOLLINTERVAL_MS 1
+#define SCANLABSMC_EXECUTIONPOLLINTERVAL_MS 10
+
+namespace LibMCDriver_ScanLabSMC {
+namespace Impl {
+
+enum class eSMCJobExecutionState : int32_t {
+	Queued = 0,
+	Executing = 1,
+	Finished = 2,
+	Failed = 3
+};
+
+// Execution record of a finalized job. Is written by the dispatcher thread and waited on by the calling thread.
+class CSMCJobExecution {
+private:
+
+	std::mutex m_Mutex;
+	std::condition_variable m_StateChanged;
+
+	eSMCJobExecutionState m_State;
+	std::exception_ptr m_pException;
+
+	// Expected execution duration in seconds. 0.0 if unknown.
+	double m_dExpectedDuration;
+
+	std::chrono::steady_clock::time_point m_QueueTime;
+	std::chrono::steady_clock::time_point m_StartTime;
+	std::chrono::steady_clock::time_point m_EndTime;
+
+	// Rethrows the stored exception, if the execution failed. Mutex MUST be locked.
+	void checkForFailure();
+
+public:
+
+	CSMCJobExecution(double dExpectedDuration);
+
+	virtual ~CSMCJobExecution();
+
+	void setExecuting();
+
+	void setFinished();
+
+	void setFailed(std::exception_ptr pException);
+
+	// Returns true if the job is queued or executing.
+	bool isPending();
+
+	// Returns true if the execution has finished within the timeout. Rethrows the error of a failed execution.
+	bool waitForCompletion(uint32_t nTimeOutInMilliseconds);
+
+	// Waits without timeout. Rethrows the error of a failed execution.
+	void waitForCompletion();
+
+	double getProgress();
+
+	double getQueueTimeInMilliseconds();
+
+	double getExecutionTimeInMilliseconds();
+
+};
+
+typedef std::shared_ptr<CSMCJobExecution> PSMCJobExecution;
+
+
+// Executes the finalized jobs of a context one after another in a worker thread, so that the next job can be
+// built and simulated while the scanner is busy.
+class CSMCJobDispatcher {
+private:
+
+	PSMCContextHandle m_pContextHandle;
+	PScanLabSMCSDK m_pSDK;
+
+	std::mutex m_QueueMutex;
+	std::condition_variable m_QueueChanged;
+	std::queue<PSMCJobExecution> m_Queue;
+	bool m_bTerminate;
+
+	// Number of enqueued jobs for which slsc_ctrl_start_execution has not been called yet. Guarded by m_QueueMutex.
+	uint32_t m_nUnstartedJobCount;
+	std::condition_variable m_JobStarted;
+
+	std::thread m_WorkerThread;
+
+	std::mutex m_TimingMutex;
+	bool m_bIsExecuting;
+	double m_dAccumulatedExecutionTime;
+	std::chrono::steady_clock::time_point m_ExecutionStartTime;
+
+	void runWorker();
+
+	void executeJob(PSMCJobExecution pExecution, bool & bStartIssued);
+
+	void markJobStarted();
+
+	slsc_ExecState getExecState(slscHandle contextHandle);
+
+	bool terminationRequested();
+
+public:
+
+	CSMCJobDispatcher(PSMCContextHandle pContextHandle);
+
+	virtual ~CSMCJobDispatcher();
+
+	void enqueueExecution(PSMCJobExecution pExecution);
+
+	// slsc_ctrl_start_execution starts the current job of the context. Blocks until it has been called for all
+	// enqueued jobs, so that a new job can be begun without taking the place of a queued one.
+	void waitForEnqueuedJobsToStart();
+
+	// Sum of the execution times of all jobs of the context in milliseconds, including the currently executing job.
+	// The difference of two readings is the time the scanner has been busy in between.
+	double getAccumulatedExecutionTimeInMilliseconds();
+
+};
+
+typedef std::shared_ptr<CSMCJobDispatcher> PSMCJobDispatcher;
+
+} // namespace Impl
+} // namespace LibMCDriver_ScanLabSMC
+
+#endif // __LIBMCDRIVER_SCANLABSMC_SMCJOBEXECUTION
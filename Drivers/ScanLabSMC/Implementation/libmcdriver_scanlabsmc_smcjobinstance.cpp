@@ -49,23 +49,37 @@ using namespace LibMCDriver_ScanLabSMC::Impl;
  Class definition of CSMCJob
 **************************************************************************************************************************/
 
-CSMCJobInstance::CSMCJobInstance(PSMCContextHandle pContextHandle, double dStartPositionX, double dStartPositionY, LibMCDriver_ScanLabSMC::eBlendMode eBlendMode, LibMCEnv::PWorkingDirectory pWorkingDirectory, std::string sSimulationSubDirectory)
+CSMCJobInstance::CSMCJobInstance(PSMCContextHandle pContextHandle, PSMCJobDispatcher pJobDispatcher, double dStartPositionX, double dStartPositionY, LibMCDriver_ScanLabSMC::eBlendMode eBlendMode, LibMCEnv::PWorkingDirectory pWorkingDirectory, std::string sSimulationSubDirectory)
     : m_pContextHandle(pContextHandle), 
     m_JobID(0), 
     m_bIsFinalized(false), 
     m_pWorkingDirectory (pWorkingDirectory), 
     m_sSimulationSubDirectory (sSimulationSubDirectory),
     m_bHasJobDuration (false),
-    m_dJobDuration (0.0)
+    m_dJobDuration (0.0),
+    m_pJobDispatcher (pJobDispatcher),
+    m_dExecutionTimeAtPreparationStart (0.0),
+    m_dExecutionTimeAtPreparationEnd (0.0)
 {
 
     if (m_pWorkingDirectory.get() == nullptr)
         throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
     if (m_pContextHandle.get() == nullptr)
         throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+    if (m_pJobDispatcher.get() == nullptr)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
 
     m_pSDK = m_pContextHandle->getSDK();
 
+    // slsc_job_begin replaces the current job of the context, which must not happen before a queued job has been started.
+    m_pJobDispatcher->waitForEnqueuedJobsToStart();
+
+    m_PreparationStartTime = std::chrono::steady_clock::now();
+    m_PreparationEndTime = m_PreparationStartTime;
+    m_dExecutionTimeAtPreparationStart = m_pJobDispatcher->getAccumulatedExecutionTimeInMilliseconds();
+
+    std::lock_guard<std::mutex> lockGuard(m_pContextHandle->getSDKMutex());
+
     auto contextHandle = m_pContextHandle->getHandle();
     //m_pSDK->checkError(m_pSDK->slsc_cfg_set_blend_mode(contextHandle, (slsc_BlendModes)eBlendMode));
     m_pSDK->checkError(contextHandle, m_pSDK->slsc_job_begin(contextHandle, &m_JobID));
@@ -86,6 +100,8 @@ void CSMCJobInstance::Finalize()
 {
     if (m_bIsFinalized)
         throw std::runtime_error("Job is already finalized!");
+
+    std::lock_guard<std::mutex> lockGuard(m_pContextHandle->getSDKMutex());
     
     auto contextHandle = m_pContextHandle->getHandle();
 
@@ -141,6 +157,8 @@ void CSMCJobInstance::DrawPolyline(const LibMCDriver_ScanLabSMC_uint64 nPointsBu
 
     if (nPointsBufferSize >= 2) {
 
+        std::lock_guard<std::mutex> lockGuard(m_pContextHandle->getSDKMutex());
+
         auto contextHandle = m_pContextHandle->getHandle();
 
         m_pSDK->checkError(contextHandle, m_pSDK->slsc_job_set_jump_speed(contextHandle, dJumpSpeed));
@@ -161,6 +179,8 @@ void CSMCJobInstance::DrawLoop(const LibMCDriver_ScanLabSMC_uint64 nPointsBuffer
 
     if (nPointsBufferSize >= 2) {
 
+        std::lock_guard<std::mutex> lockGuard(m_pContextHandle->getSDKMutex());
+
         auto contextHandle = m_pContextHandle->getHandle();
 
         m_pSDK->checkError(contextHandle, m_pSDK->slsc_job_set_jump_speed(contextHandle, dJumpSpeed));
@@ -183,6 +203,8 @@ void CSMCJobInstance::DrawHatches(const LibMCDriver_ScanLabSMC_uint64 nHatchesBu
         if (pHatchesBuffer == nullptr)
             throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
 
+        std::lock_guard<std::mutex> lockGuard(m_pContextHandle->getSDKMutex());
+
         auto contextHandle = m_pContextHandle->getHandle();
 
         m_pSDK->checkError(contextHandle, m_pSDK->slsc_job_set_jump_speed(contextHandle, dJumpSpeed));
@@ -212,46 +234,84 @@ bool CSMCJobInstance::IsReady()
     return true;
 }
 
-void CSMCJobInstance::Execute(const bool bBlocking)
+double CSMCJobInstance::getExpectedDuration()
 {
-    auto contextHandle = m_pContextHandle->getHandle();
+    if (m_bHasJobDuration)
+        return m_dJobDuration;
 
-    std::cout << "Waiting for execution" << std::endl;
+    return GetJobCharacteristic(LibMCDriver_ScanLabSMC::eJobCharacteristic::MotionMicroSteps) / (double)SCANLABSMC_MICROSTEPSPERSECOND;
+}
 
-    slsc_ExecState execState1 = slsc_ExecState::slsc_ExecState_NotInitOrError;
-    while (execState1 != slsc_ExecState::slsc_ExecState_ReadyForExecution) {
-        m_pSDK->checkError(contextHandle, m_pSDK->slsc_ctrl_get_exec_state(contextHandle, &execState1));
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
-    } 
+void CSMCJobInstance::Execute(const bool bBlocking)
+{
+    if (!m_bIsFinalized)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_JOBISNOTFINALIZED);
+    if (m_pExecution.get() != nullptr)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_JOBHASALREADYBEENEXECUTED);
 
-    //std::cout << "Starting execution" << std::endl;
+    m_PreparationEndTime = std::chrono::steady_clock::now();
+    m_dExecutionTimeAtPreparationEnd = m_pJobDispatcher->getAccumulatedExecutionTimeInMilliseconds();
 
-    m_pSDK->checkError(contextHandle, m_pSDK->slsc_ctrl_start_execution(contextHandle));
+    // The dispatcher starts the job as soon as all previously queued jobs of the context have finished.
+    m_pExecution = std::make_shared<CSMCJobExecution>(getExpectedDuration());
+    m_pJobDispatcher->enqueueExecution(m_pExecution);
 
-    //std::cout << "Waiting for execution finished" << std::endl;
+    if (bBlocking)
+        m_pExecution->waitForCompletion();
+}
 
-    slsc_ExecState execState2 = slsc_ExecState::slsc_ExecState_Executing;
-    while (execState2 == slsc_ExecState::slsc_ExecState_Executing) {
-        m_pSDK->checkError(contextHandle, m_pSDK->slsc_ctrl_get_exec_state(contextHandle, &execState2));
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    } 
+bool CSMCJobInstance::IsExecuting()
+{
+    if (m_pExecution.get() == nullptr)
+        return false;
 
+    return m_pExecution->isPending();
+}
 
+void CSMCJobInstance::WaitForExecution(const LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds)
+{
+    if (!WaitForCompletion(nTimeOutInMilliseconds))
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONTIMEOUT);
 }
 
-bool CSMCJobInstance::IsExecuting()
+bool CSMCJobInstance::WaitForCompletion(const LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds)
 {
-    return false;
+    if (m_pExecution.get() == nullptr)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONNOTSTARTED);
+
+    return m_pExecution->waitForCompletion(nTimeOutInMilliseconds);
 }
 
-void CSMCJobInstance::WaitForExecution(const LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds)
+double CSMCJobInstance::GetExecutionProgress()
 {
+    if (m_pExecution.get() == nullptr)
+        return 0.0;
 
+    return m_pExecution->getProgress();
+}
+
+void CSMCJobInstance::GetExecutionStatistics(double& dPreparationTime, double& dQueueTime, double& dExecutionTime, double& dOverlapTime)
+{
+    if (m_pExecution.get() != nullptr) {
+        dPreparationTime = std::chrono::duration<double, std::milli>(m_PreparationEndTime - m_PreparationStartTime).count();
+        dOverlapTime = m_dExecutionTimeAtPreparationEnd - m_dExecutionTimeAtPreparationStart;
+        dQueueTime = m_pExecution->getQueueTimeInMilliseconds();
+        dExecutionTime = m_pExecution->getExecutionTimeInMilliseconds();
+    }
+    else {
+        dPreparationTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_PreparationStartTime).count();
+        dOverlapTime = m_pJobDispatcher->getAccumulatedExecutionTimeInMilliseconds() - m_dExecutionTimeAtPreparationStart;
+        dQueueTime = 0.0;
+        dExecutionTime = 0.0;
+    }
 }
 
 void CSMCJobInstance::StopExecution()
 {
-    m_pSDK->checkError(m_pSDK->slsc_ctrl_stop(m_pContextHandle->getHandle()), LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTSTOPJOBEXECUTION);
+    std::lock_guard<std::mutex> lockGuard(m_pContextHandle->getSDKMutex());
+
+    auto contextHandle = m_pContextHandle->getHandle();
+    m_pSDK->checkError(contextHandle, m_pSDK->slsc_ctrl_stop(contextHandle));
 }
 
 
@@ -487,6 +547,7 @@ double CSMCJobInstance::GetJobCharacteristic(const LibMCDriver_ScanLabSMC::eJobC
 
     }
     
+    std::lock_guard<std::mutex> lockGuard(m_pContextHandle->getSDKMutex());
     m_pSDK->slsc_ctrl_get_job_characteristic (m_pContextHandle->getHandle (), m_JobID, eKey, &dResult);
 
     return dResult;
@@ -510,7 +571,10 @@ void CSMCJobInstance::ReadSimulationFile(LibMCEnv::PDataTable pDataTable)
 
     std::vector<char> buffer;
     buffer.resize(16384);
-    m_pSDK->checkError(contextHandle, m_pSDK->slsc_ctrl_get_simulation_filename(contextHandle, m_JobID, buffer.data (), buffer.size ()));
+    {
+        std::lock_guard<std::mutex> lockGuard(m_pContextHandle->getSDKMutex());
+        m_pSDK->checkError(contextHandle, m_pSDK->slsc_ctrl_get_simulation_filename(contextHandle, m_JobID, buffer.data (), buffer.size ()));
+    }
     buffer.at(buffer.size() - 1) = 0;
 
     std::string sSimulationFileName(buffer.data());
@@ -521,28 +585,7 @@ void CSMCJobInstance::ReadSimulationFile(LibMCEnv::PDataTable pDataTable)
 
     CSMCSimulationParser parser(sSimulationDirectory + sSimulationFileName);
 
-    pDataTable->AddColumn("timestamp", "Timestamp", LibMCEnv::eDataTableColumnType::DoubleColumn);
-    pDataTable->AddColumn("x", "X", LibMCEnv::eDataTableColumnType::DoubleColumn);
-    pDataTable->AddColumn("y", "Y", LibMCEnv::eDataTableColumnType::DoubleColumn);
-    pDataTable->AddColumn("laseron", "LaserOn", LibMCEnv::eDataTableColumnType::Int32Column);
-    pDataTable->AddColumn("active1", "Active Channel 1", LibMCEnv::eDataTableColumnType::DoubleColumn);
-    pDataTable->AddColumn("active2", "Active Channel 2", LibMCEnv::eDataTableColumnType::DoubleColumn);
-    pDataTable->AddColumn("cmdindex", "Command Index", LibMCEnv::eDataTableColumnType::Int32Column);
-
-    std::vector<double> timestampValues;
-    parser.readTimestampValues(timestampValues);
-    pDataTable->SetDoubleColumnValues("timestamp", timestampValues);
-    timestampValues.resize(0);
-
-    std::vector<double> xValues;
-    parser.readXValues(xValues);
-    pDataTable->SetDoubleColumnValues("x", xValues);
-    xValues.resize(0);
-
-    std::vector<double> yValues;
-    parser.readYValues(yValues);
-    pDataTable->SetDoubleColumnValues("y", yValues);
-    yValues.resize(0);
+    parser.writeToDataTable(pDataTable);
 
     m_dJobDuration = (double)parser.getCount() / (double)SCANLABSMC_MICROSTEPSPERSECOND;
     m_bHasJobDuration = true;
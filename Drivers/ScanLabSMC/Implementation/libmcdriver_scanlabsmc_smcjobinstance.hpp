@@ -39,6 +39,7 @@ Abstract: This is the class declaration of CSMCJob
 
 #include "libmcdriver_scanlabsmc_smccontexthandle.hpp"
 #include "libmcdriver_scanlabsmc_sdk.hpp"
+#include "libmcdriver_scanlabsmc_smcjobexecution.hpp"
 
 
 namespace LibMCDriver_ScanLabSMC {
@@ -62,11 +63,23 @@ private:
 	bool m_bHasJobDuration;
 	double m_dJobDuration;
 
+	PSMCJobDispatcher m_pJobDispatcher;
+	PSMCJobExecution m_pExecution;
+
+	// Preparation lasts from the job begin until Execute is called. The accumulated execution times of the
+	// dispatcher at both points give the overlap with jobs that are executing in the meantime.
+	std::chrono::steady_clock::time_point m_PreparationStartTime;
+	std::chrono::steady_clock::time_point m_PreparationEndTime;
+	double m_dExecutionTimeAtPreparationStart;
+	double m_dExecutionTimeAtPreparationEnd;
+
+	double getExpectedDuration();
+
 	void drawPolylineEx(slscHandle contextHandle, const uint64_t nPointsBufferSize, const LibMCDriver_ScanLabSMC::sPoint2D* pPointsBuffer, bool bIsClosed);
 
 public:
 
-	CSMCJobInstance(PSMCContextHandle pContextHandle, double dStartPositionX, double dStartPositionY, LibMCDriver_ScanLabSMC::eBlendMode eBlendMode, LibMCEnv::PWorkingDirectory pWorkingDirectory, std::string sSimulationSubDirectory);
+	CSMCJobInstance(PSMCContextHandle pContextHandle, PSMCJobDispatcher pJobDispatcher, double dStartPositionX, double dStartPositionY, LibMCDriver_ScanLabSMC::eBlendMode eBlendMode, LibMCEnv::PWorkingDirectory pWorkingDirectory, std::string sSimulationSubDirectory);
 
 	virtual ~CSMCJobInstance();
 
@@ -91,6 +104,12 @@ public:
 
 	void WaitForExecution(const LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds);
 
+	bool WaitForCompletion(const LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds);
+
+	double GetExecutionProgress();
+
+	void GetExecutionStatistics(double & dPreparationTime, double & dQueueTime, double & dExecutionTime, double & dOverlapTime);
+
 	void StopExecution();
 
 	void AddLayerToList(LibMCEnv::PToolpathLayer pLayer);
@@ -31,9 +31,11 @@ Abstract: This is a stub class definition of CSMCJob
 
 */
 
+
 #include "libmcdriver_scanlabsmc_smcsimulationparser.hpp"
 #include "libmcdriver_scanlabsmc_interfaceexception.hpp"
 #include "libmcdriver_scanlabsmc_sdk.hpp"
+#include "common_parallelblocks.hpp"
 
 // Include custom headers here.
 
@@ -41,17 +43,162 @@ Abstract: This is a stub class definition of CSMCJob
 #include <thread>
 #include <iostream>
 #include <algorithm>
-#include <fstream>
 #include <sstream>
+#include <cstring>
+#include <cstdlib>
 
 #ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 #endif
 
+#define SMCSIMULATIONPARSER_HEADERPREFIX "<!--Simulation output"
+#define SMCSIMULATIONPARSER_MAXEXACTMANTISSA (1ULL << 53)
+#define SMCSIMULATIONPARSER_MAXEXACTPOWEROFTEN 22
+#define SMCSIMULATIONPARSER_MAXMANTISSADIGITS 19
+
 using namespace LibMCDriver_ScanLabSMC::Impl;
 
-CSMCSimulationParser::CSMCSimulationParser(const std::string& sAbsoluteFileNameUTF8)
+
+static bool isWhitespaceCharacter(char cCharacter)
+{
+    return (cCharacter == ' ') || (cCharacter == '\t') || (cCharacter == '\r') || (cCharacter == '\n') || (cCharacter == '\v') || (cCharacter == '\f');
+}
+
+// Parses an integer like std::stoi, but without copying the field.
+static int32_t parseSimulationInteger(const char* pField, const char* pFieldEnd)
+{
+    const char* pChar = pField;
+    while ((pChar < pFieldEnd) && isWhitespaceCharacter(*pChar))
+        pChar++;
+
+    bool bNegative = false;
+    if ((pChar < pFieldEnd) && ((*pChar == '+') || (*pChar == '-'))) {
+        bNegative = (*pChar == '-');
+        pChar++;
+    }
+
+    int64_t nValue = 0;
+    const char* pDigits = pChar;
+    while ((pChar < pFieldEnd) && (*pChar >= '0') && (*pChar <= '9')) {
+        nValue = nValue * 10 + (*pChar - '0');
+        if (nValue > (int64_t)INT32_MAX + 1)
+            throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONFILEENTRY, "integer out of range: " + std::string(pField, pFieldEnd));
+        pChar++;
+    }
+
+    if (pChar == pDigits)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONFILEENTRY, "invalid integer: " + std::string(pField, pFieldEnd));
+
+    if (bNegative)
+        nValue = -nValue;
+    if (nValue > INT32_MAX)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONFILEENTRY, "integer out of range: " + std::string(pField, pFieldEnd));
+
+    return (int32_t)nValue;
+}
+
+// Parses a double like std::stod, but without copying the field. Values with at most 19 digits, a mantissa below 2^53 and
+// a power of ten of at most 22 are computed with a single, correctly rounded floating point operation. All other values
+// are passed to strtod, so that the result is always the same as the one of std::stod.
+static double parseSimulationDouble(const char* pField, const char* pFieldEnd)
+{
+    static const double PowersOfTen[SMCSIMULATIONPARSER_MAXEXACTPOWEROFTEN + 1] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+    const char* pChar = pField;
+    while ((pChar < pFieldEnd) && isWhitespaceCharacter(*pChar))
+        pChar++;
+
+    bool bNegative = false;
+    if ((pChar < pFieldEnd) && ((*pChar == '+') || (*pChar == '-'))) {
+        bNegative = (*pChar == '-');
+        pChar++;
+    }
+
+    uint64_t nMantissa = 0;
+    int32_t nDigitCount = 0;
+    int32_t nExponent = 0;
+    bool bExact = true;
+
+    while ((pChar < pFieldEnd) && (*pChar >= '0') && (*pChar <= '9')) {
+        nMantissa = nMantissa * 10 + (uint64_t)(*pChar - '0');
+        nDigitCount++;
+        pChar++;
+    }
+
+    if ((pChar < pFieldEnd) && (*pChar == '.')) {
+        pChar++;
+        while ((pChar < pFieldEnd) && (*pChar >= '0') && (*pChar <= '9')) {
+            nMantissa = nMantissa * 10 + (uint64_t)(*pChar - '0');
+            nDigitCount++;
+            nExponent--;
+            pChar++;
+        }
+    }
+
+    if ((pChar < pFieldEnd) && ((*pChar == 'e') || (*pChar == 'E'))) {
+        const char* pExponent = pChar + 1;
+        bool bNegativeExponent = false;
+        if ((pExponent < pFieldEnd) && ((*pExponent == '+') || (*pExponent == '-'))) {
+            bNegativeExponent = (*pExponent == '-');
+            pExponent++;
+        }
+
+        // An exponent without digits is not part of the number
+        int32_t nExplicitExponent = 0;
+        const char* pExponentDigits = pExponent;
+        while ((pExponent < pFieldEnd) && (*pExponent >= '0') && (*pExponent <= '9')) {
+            if (nExplicitExponent < 10000)
+                nExplicitExponent = nExplicitExponent * 10 + (*pExponent - '0');
+            pExponent++;
+        }
+
+        if (pExponent != pExponentDigits) {
+            nExponent += bNegativeExponent ? -nExplicitExponent : nExplicitExponent;
+            pChar = pExponent;
+        }
+    }
+
+    // Hexadecimal, infinite and NaN values, as well as long or large values are left to strtod
+    if ((nDigitCount == 0) || (nDigitCount > SMCSIMULATIONPARSER_MAXMANTISSADIGITS) || (nMantissa > SMCSIMULATIONPARSER_MAXEXACTMANTISSA) ||
+        (nExponent < -SMCSIMULATIONPARSER_MAXEXACTPOWEROFTEN) || (nExponent > SMCSIMULATIONPARSER_MAXEXACTPOWEROFTEN) ||
+        ((pChar < pFieldEnd) && ((*pChar == 'x') || (*pChar == 'X'))))
+        bExact = false;
+
+    if (!bExact) {
+        std::string sField(pField, pFieldEnd);
+        char* pParseEnd = nullptr;
+        double dValue = strtod(sField.c_str(), &pParseEnd);
+        if (pParseEnd == sField.c_str())
+            throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONFILEENTRY, "invalid number: " + sField);
+
+        return dValue;
+    }
+
+    double dValue = (double)nMantissa;
+    if (nExponent >= 0)
+        dValue *= PowersOfTen[nExponent];
+    else
+        dValue /= PowersOfTen[-nExponent];
+
+    return bNegative ? -dValue : dValue;
+}
+
+
+CSMCMappedFile::CSMCMappedFile(const std::string& sAbsoluteFileNameUTF8)
+    : m_pData (nullptr), m_nSize (0),
+#ifdef _WIN32
+    m_hFile (INVALID_HANDLE_VALUE), m_hMapping (nullptr)
+#else
+    m_nFileDescriptor (-1)
+#endif
 {
-    
 #ifdef _WIN32
     if (sAbsoluteFileNameUTF8.length () > 65536)
         throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
@@ -63,155 +210,425 @@ CSMCSimulationParser::CSMCSimulationParser(const std::string& sAbsoluteFileNameU
     if (nResult == 0)
         throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONFILENAME);
 
-    std::ifstream file(wsLibraryFileName.data (), std::ios::in);
+    m_hFile = CreateFileW(wsLibraryFileName.data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (m_hFile == INVALID_HANDLE_VALUE)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTOOPENSIMULATIONFILE);
+
+    LARGE_INTEGER nFileSize;
+    if (!GetFileSizeEx(m_hFile, &nFileSize)) {
+        CloseHandle(m_hFile);
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTOOPENSIMULATIONFILE);
+    }
+
+    m_nSize = (size_t)nFileSize.QuadPart;
+
+    // Empty files can not be mapped
+    if (m_nSize > 0) {
+        m_hMapping = CreateFileMappingW(m_hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (m_hMapping != nullptr)
+            m_pData = (const char*)MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0);
+
+        if (m_pData == nullptr) {
+            if (m_hMapping != nullptr)
+                CloseHandle(m_hMapping);
+            CloseHandle(m_hFile);
+            throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTOOPENSIMULATIONFILE);
+        }
+    }
+
 #else
-    std::ifstream file(sAbsoluteFileNameUTF8, std::ios::in);
+    m_nFileDescriptor = open(sAbsoluteFileNameUTF8.c_str(), O_RDONLY);
+    if (m_nFileDescriptor < 0)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTOOPENSIMULATIONFILE);
+
+    struct stat fileStatus;
+    if (fstat(m_nFileDescriptor, &fileStatus) != 0) {
+        close(m_nFileDescriptor);
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTOOPENSIMULATIONFILE);
+    }
+
+    m_nSize = (size_t)fileStatus.st_size;
+
+    // Empty files can not be mapped
+    if (m_nSize > 0) {
+        void* pMapping = mmap(nullptr, m_nSize, PROT_READ, MAP_PRIVATE, m_nFileDescriptor, 0);
+        if (pMapping == MAP_FAILED) {
+            close(m_nFileDescriptor);
+            throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTOOPENSIMULATIONFILE);
+        }
+
+        madvise(pMapping, m_nSize, MADV_SEQUENTIAL);
+        m_pData = (const char*)pMapping;
+    }
 #endif
+}
 
+CSMCMappedFile::~CSMCMappedFile()
+{
+#ifdef _WIN32
+    if (m_pData != nullptr)
+        UnmapViewOfFile(m_pData);
+    if (m_hMapping != nullptr)
+        CloseHandle(m_hMapping);
+    if (m_hFile != INVALID_HANDLE_VALUE)
+        CloseHandle(m_hFile);
+#else
+    if (m_pData != nullptr)
+        munmap((void*)m_pData, m_nSize);
+    if (m_nFileDescriptor >= 0)
+        close(m_nFileDescriptor);
+#endif
+}
 
-    if (!file.is_open ()) 
-        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTOOPENSIMULATIONFILE);
-    
-    std::string line;
-    double timestamp = 0;
-    int numberOfCoordinates = 0;
-    int scanDevices = 0;
-    int stages = 0;
+const char* CSMCMappedFile::getData()
+{
+    return m_pData;
+}
 
-        while (std::getline(file, line)) {
+size_t CSMCMappedFile::getSize()
+{
+    return m_nSize;
+}
 
-            if (!line.empty()) {
-                if (line.rfind("<!--Simulation output", 0) == 0) {
-                    std::istringstream iss(line);
-                    std::string item;
-                    while (iss >> item) {
-                        if (item.find("ScanDevices") == 0) {
-                            scanDevices = std::stoi(item.substr(13, item.size() - 14));
-                        }
-                        else if (item.find("Stage") == 0 && item.find("StageDelay") != 0) {
-                            std::string stagesRaw = item.substr(7, item.size() - 8);
-                            stages = (stagesRaw == "None") ? 0 : std::stoi(stagesRaw.substr(5));
-                        }
-                    }
-                    numberOfCoordinates = scanDevices * 2 + stages * 2;
-                }
 
-                if (line[0] == '+' || line[0] == '-') {
-                    std::istringstream iss(line);
-                    std::string token;
-                    std::vector<std::string> data;
+CSMCSimulationParser::CSMCSimulationParser(const std::string& sAbsoluteFileNameUTF8, uint32_t nThreadCount)
+{
+    CSMCMappedFile mappedFile(sAbsoluteFileNameUTF8);
+
+    const char* pData = mappedFile.getData();
+    size_t nSize = mappedFile.getSize();
+    if (nSize == 0)
+        return;
+
+    const char* pDataEnd = pData + nSize;
+
+    // The header precedes the data lines and defines the number of coordinates of every line
+    int32_t nNumberOfCoordinates = 0;
+    const char* pHeaderLine = nullptr;
+    size_t nHeaderPrefixLength = strlen(SMCSIMULATIONPARSER_HEADERPREFIX);
+    const char* pLine = pData;
+    while (pLine < pDataEnd) {
+        const char* pLineEnd = (const char*)memchr(pLine, '\n', pDataEnd - pLine);
+        if (pLineEnd == nullptr)
+            pLineEnd = pDataEnd;
+
+        if (((size_t)(pLineEnd - pLine) >= nHeaderPrefixLength) && (memcmp(pLine, SMCSIMULATIONPARSER_HEADERPREFIX, nHeaderPrefixLength) == 0)) {
+            pHeaderLine = pLine;
+            nNumberOfCoordinates = parseHeaderLine(std::string(pLine, pLineEnd));
+            break;
+        }
+
+        if ((pLineEnd > pLine) && ((*pLine == '+') || (*pLine == '-')))
+            break;
 
-                    sSMCSimulationEntry newEntry;
+        pLine = pLineEnd + 1;
+    }
 
-                    while (std::getline(iss, token, ';')) {
-                        data.push_back(token);
-                    }
+    if (nThreadCount == 0)
+        nThreadCount = std::thread::hardware_concurrency();
+    if (nThreadCount > SMCSIMULATIONPARSER_MAXTHREADCOUNT)
+        nThreadCount = SMCSIMULATIONPARSER_MAXTHREADCOUNT;
+    if (nSize / SMCSIMULATIONPARSER_MINBYTESPERTHREAD < nThreadCount)
+        nThreadCount = (uint32_t)(nSize / SMCSIMULATIONPARSER_MINBYTESPERTHREAD);
+    if (nThreadCount < 1)
+        nThreadCount = 1;
+
+    // Every range starts at the beginning of a line
+    std::vector<sSMCSimulationRange> ranges(nThreadCount);
+    const char* pRangeStart = pData;
+    for (uint32_t nRangeIndex = 0; nRangeIndex < nThreadCount; nRangeIndex++) {
+        const char* pRangeEnd = pDataEnd;
+        if (nRangeIndex + 1 < nThreadCount) {
+            const char* pSplit = pData + (nSize * (nRangeIndex + 1)) / nThreadCount;
+            if (pSplit < pRangeStart)
+                pSplit = pRangeStart;
+            const char* pNewLine = (const char*)memchr(pSplit, '\n', pDataEnd - pSplit);
+            pRangeEnd = (pNewLine != nullptr) ? (pNewLine + 1) : pDataEnd;
+        }
 
-                    if (data.size() > 3) {
-                        int numLaserOnDelays = std::stoi(data[numberOfCoordinates]);
-                        int numLaserOffDelays = std::stoi(data[numberOfCoordinates + 1 + numLaserOnDelays]);
-
-                        newEntry.m_dCoordinates[0] = std::stod(data[0]);
-                        newEntry.m_dCoordinates[1] = std::stod(data[1]);
-                        newEntry.m_dCoordinates[2] = 0.0;
-
-                        newEntry.m_dLaserToggle = std::stoi(data[numberOfCoordinates + 2 + numLaserOnDelays + numLaserOffDelays]);
-                        newEntry.m_dActiveChannel1 = std::stod(data[numberOfCoordinates + 3 + numLaserOnDelays + numLaserOffDelays]);
-                        newEntry.m_dActiveChannel2 = std::stod(data[numberOfCoordinates + 4 + numLaserOnDelays + numLaserOffDelays]);
-                        newEntry.m_CommandIndex = std::stoi(data[numberOfCoordinates + 5 + numLaserOnDelays + numLaserOffDelays]);
-
-                        double tempTimestamp = timestamp + 10;
-                        if (numLaserOnDelays > 0) {
-                            for (int i = 0; i < numLaserOnDelays; i++) {
-                                double timeStep = std::stod(data[numberOfCoordinates + 1 + i]);
-                                timestamp = tempTimestamp + timeStep;
-
-                                newEntry.m_dTimestamp = timestamp;
-                                m_Entries.push_back(newEntry);
-                            }
-                            timestamp = tempTimestamp;
-                        }
-                        if (numLaserOffDelays > 0) {
-                            for (int i = 0; i < numLaserOffDelays; i++) {
-                                double timeStep = std::stod(data[numberOfCoordinates + 2 + numLaserOnDelays + i]);
-                                timestamp = tempTimestamp + timeStep;
-
-                                newEntry.m_dTimestamp = timestamp;
-                                m_Entries.push_back(newEntry);
-                            }
-                            timestamp = tempTimestamp;
-                        }
-                        if (numLaserOnDelays == 0 && numLaserOffDelays == 0) {
+        ranges[nRangeIndex].m_pStart = pRangeStart;
+        ranges[nRangeIndex].m_pEnd = pRangeEnd;
+        pRangeStart = pRangeEnd;
+    }
+
+    parseRanges(ranges, nNumberOfCoordinates, pHeaderLine, false);
+
+    // Further headers change the number of coordinates of all following lines, which only a single range can follow
+    bool bHasFurtherHeaders = false;
+    for (auto& range : ranges)
+        bHasFurtherHeaders = bHasFurtherHeaders || range.m_bHasHeader;
 
-                            newEntry.m_dTimestamp = tempTimestamp;
-                            m_Entries.push_back(newEntry);
+    if (bHasFurtherHeaders && (ranges.size() > 1)) {
+        ranges.resize(1);
+        ranges[0].m_pStart = pData;
+        ranges[0].m_pEnd = pDataEnd;
+        parseRanges(ranges, nNumberOfCoordinates, pHeaderLine, false);
+    }
+
+    uint64_t nLineCount = 0;
+    uint64_t nEntryCount = 0;
+    for (auto& range : ranges) {
+        range.m_nLineOffset = nLineCount;
+        range.m_nEntryOffset = nEntryCount;
+        nLineCount += range.m_nLineCount;
+        nEntryCount += range.m_nEntryCount;
+    }
+
+    m_Timestamps.resize(nEntryCount);
+    m_XValues.resize(nEntryCount);
+    m_YValues.resize(nEntryCount);
+    m_LaserToggle.resize(nEntryCount);
+    m_ActiveChannel1.resize(nEntryCount);
+    m_ActiveChannel2.resize(nEntryCount);
+    m_CommandIndices.resize(nEntryCount);
+
+    parseRanges(ranges, nNumberOfCoordinates, pHeaderLine, true);
+
+    sortByTimestamp();
+}
+
+CSMCSimulationParser::~CSMCSimulationParser()
+{
+
+}
 
-                            timestamp += 10;
+int32_t CSMCSimulationParser::parseHeaderLine(const std::string& sLine)
+{
+    int scanDevices = 0;
+    int stages = 0;
+
+    std::istringstream iss(sLine);
+    std::string item;
+    while (iss >> item) {
+        if (item.find("ScanDevices") == 0) {
+            scanDevices = std::stoi(item.substr(13, item.size() - 14));
+        }
+        else if (item.find("Stage") == 0 && item.find("StageDelay") != 0) {
+            std::string stagesRaw = item.substr(7, item.size() - 8);
+            stages = (stagesRaw == "None") ? 0 : std::stoi(stagesRaw.substr(5));
+        }
+    }
+
+    return scanDevices * 2 + stages * 2;
+}
+
+void CSMCSimulationParser::parseRanges(std::vector<sSMCSimulationRange>& ranges, int32_t nNumberOfCoordinates, const char* pHeaderLine, bool bWriteEntries)
+{
+    AMCCommon::CParallelBlocks::processBlocks((uint32_t)ranges.size(), ranges.size(), 1, [&](uint32_t nBlockIndex, size_t nFirstRange, size_t nBlockRangeCount) {
+        for (size_t nRangeIndex = nFirstRange; nRangeIndex < nFirstRange + nBlockRangeCount; nRangeIndex++)
+            parseRange(ranges[nRangeIndex], nNumberOfCoordinates, pHeaderLine, bWriteEntries);
+    });
+}
+
+void CSMCSimulationParser::parseRange(sSMCSimulationRange& range, int32_t nNumberOfCoordinates, const char* pHeaderLine, bool bWriteEntries)
+{
+    uint64_t nLineIndex = 0;
+    uint64_t nEntryIndex = 0;
+    range.m_bHasHeader = false;
+
+    size_t nHeaderPrefixLength = strlen(SMCSIMULATIONPARSER_HEADERPREFIX);
+
+    // Start of every field of the current line. The vector is reused for all lines.
+    std::vector<const char*> fieldStarts;
+    const char* pLineEnd = nullptr;
+
+    auto getField = [&](int32_t nFieldIndex, const char*& pFieldEnd) -> const char* {
+        if ((nFieldIndex < 0) || ((size_t)nFieldIndex >= fieldStarts.size()))
+            throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONFILEENTRY, "missing field " + std::to_string(nFieldIndex) + " in simulation line " + std::string(fieldStarts.at(0), pLineEnd));
+
+        pFieldEnd = ((size_t)nFieldIndex + 1 < fieldStarts.size()) ? (fieldStarts[nFieldIndex + 1] - 1) : pLineEnd;
+        return fieldStarts[nFieldIndex];
+    };
+
+    auto parseIntegerField = [&](int32_t nFieldIndex) -> int32_t {
+        const char* pFieldEnd = nullptr;
+        const char* pField = getField(nFieldIndex, pFieldEnd);
+        return parseSimulationInteger(pField, pFieldEnd);
+    };
+
+    auto parseDoubleField = [&](int32_t nFieldIndex) -> double {
+        const char* pFieldEnd = nullptr;
+        const char* pField = getField(nFieldIndex, pFieldEnd);
+        return parseSimulationDouble(pField, pFieldEnd);
+    };
+
+    const char* pLine = range.m_pStart;
+    while (pLine < range.m_pEnd) {
+        pLineEnd = (const char*)memchr(pLine, '\n', range.m_pEnd - pLine);
+        if (pLineEnd == nullptr)
+            pLineEnd = range.m_pEnd;
+
+        if (pLineEnd > pLine) {
+
+            if ((pLine != pHeaderLine) && ((size_t)(pLineEnd - pLine) >= nHeaderPrefixLength) && (memcmp(pLine, SMCSIMULATIONPARSER_HEADERPREFIX, nHeaderPrefixLength) == 0)) {
+                nNumberOfCoordinates = parseHeaderLine(std::string(pLine, pLineEnd));
+                range.m_bHasHeader = true;
+            }
+
+            if ((*pLine == '+') || (*pLine == '-')) {
+
+                // Fields are separated by ';'. A separator at the end of the line does not start another field.
+                fieldStarts.clear();
+                const char* pField = pLine;
+                while (true) {
+                    fieldStarts.push_back(pField);
+                    const char* pSeparator = (const char*)memchr(pField, ';', pLineEnd - pField);
+                    if (pSeparator == nullptr)
+                        break;
+                    pField = pSeparator + 1;
+                    if (pField == pLineEnd)
+                        break;
+                }
+
+                if (fieldStarts.size() > 3) {
+                    int32_t nLaserOnDelays = parseIntegerField(nNumberOfCoordinates);
+                    int32_t nLaserOffDelays = parseIntegerField(nNumberOfCoordinates + 1 + nLaserOnDelays);
+                    if ((nLaserOnDelays < 0) || (nLaserOffDelays < 0))
+                        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONFILEENTRY, "invalid delay count in simulation line " + std::string(pLine, pLineEnd));
+
+                    // Every delay results in an entry. Lines without delays result in a single entry.
+                    uint64_t nLineEntryCount = (uint64_t)nLaserOnDelays + (uint64_t)nLaserOffDelays;
+                    if (nLineEntryCount == 0)
+                        nLineEntryCount = 1;
+
+                    if (bWriteEntries) {
+                        if (nEntryIndex + nLineEntryCount > range.m_nEntryCount)
+                            throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONFILEENTRY, "simulation file has changed while parsing");
+
+                        int32_t nValueIndex = nNumberOfCoordinates + 2 + nLaserOnDelays + nLaserOffDelays;
+                        double dX = parseDoubleField(0);
+                        double dY = parseDoubleField(1);
+                        int32_t nLaserToggle = parseIntegerField(nValueIndex);
+                        double dActiveChannel1 = parseDoubleField(nValueIndex + 1);
+                        double dActiveChannel2 = parseDoubleField(nValueIndex + 2);
+                        int32_t nCommandIndex = parseIntegerField(nValueIndex + 3);
+
+                        // Every line advances the time by one step. The result is the same as summing up the steps line by line.
+                        double dLineTimestamp = SMCSIMULATIONPARSER_TIMESTEP * (double)(range.m_nLineOffset + nLineIndex + 1);
+
+                        for (uint64_t nLineEntryIndex = 0; nLineEntryIndex < nLineEntryCount; nLineEntryIndex++) {
+                            size_t nTargetIndex = (size_t)(range.m_nEntryOffset + nEntryIndex + nLineEntryIndex);
+
+                            double dTimestamp = dLineTimestamp;
+                            if (nLineEntryIndex < (uint64_t)nLaserOnDelays)
+                                dTimestamp += parseDoubleField(nNumberOfCoordinates + 1 + (int32_t)nLineEntryIndex);
+                            else if (nLaserOffDelays > 0)
+                                dTimestamp += parseDoubleField(nNumberOfCoordinates + 2 + (int32_t)nLineEntryIndex);
+
+                            m_Timestamps[nTargetIndex] = dTimestamp;
+                            m_XValues[nTargetIndex] = dX;
+                            m_YValues[nTargetIndex] = dY;
+                            m_LaserToggle[nTargetIndex] = nLaserToggle;
+                            m_ActiveChannel1[nTargetIndex] = dActiveChannel1;
+                            m_ActiveChannel2[nTargetIndex] = dActiveChannel2;
+                            m_CommandIndices[nTargetIndex] = nCommandIndex;
                         }
                     }
+
+                    nLineIndex++;
+                    nEntryIndex += nLineEntryCount;
                 }
             }
         }
 
-        std::sort(m_Entries.begin(), m_Entries.end(),
-            [](const sSMCSimulationEntry& x, const sSMCSimulationEntry& y) { return x.m_dTimestamp < y.m_dTimestamp; });
+        pLine = pLineEnd + 1;
+    }
 
+    if (!bWriteEntries) {
+        range.m_nLineCount = nLineIndex;
+        range.m_nEntryCount = nEntryIndex;
+    }
 }
 
-CSMCSimulationParser::~CSMCSimulationParser()
+template <typename T> static void reorderValues(std::vector<T>& values, const std::vector<size_t>& order)
 {
+    std::vector<T> reorderedValues(values.size());
+    for (size_t nIndex = 0; nIndex < order.size(); nIndex++)
+        reorderedValues[nIndex] = values[order[nIndex]];
+    values.swap(reorderedValues);
+}
 
+void CSMCSimulationParser::sortByTimestamp()
+{
+    if (std::is_sorted(m_Timestamps.begin(), m_Timestamps.end()))
+        return;
+
+    // Entries with the same timestamp stay in file order
+    std::vector<size_t> order(m_Timestamps.size());
+    for (size_t nIndex = 0; nIndex < order.size(); nIndex++)
+        order[nIndex] = nIndex;
+
+    std::stable_sort(order.begin(), order.end(), [this](size_t nIndex1, size_t nIndex2) {
+        return m_Timestamps[nIndex1] < m_Timestamps[nIndex2];
+    });
+
+    reorderValues(m_Timestamps, order);
+    reorderValues(m_XValues, order);
+    reorderValues(m_YValues, order);
+    reorderValues(m_LaserToggle, order);
+    reorderValues(m_ActiveChannel1, order);
+    reorderValues(m_ActiveChannel2, order);
+    reorderValues(m_CommandIndices, order);
 }
 
 size_t CSMCSimulationParser::getCount()
 {
-    return m_Entries.size();
+    return m_Timestamps.size();
 }
 
-sSMCSimulationEntry& CSMCSimulationParser::getEntry(size_t nIndex)
+const std::vector<double>& CSMCSimulationParser::getTimestamps()
 {
-    return m_Entries.at(nIndex);
+    return m_Timestamps;
 }
 
-void CSMCSimulationParser::readTimestampValues(std::vector<double>& values)
+const std::vector<double>& CSMCSimulationParser::getXValues()
 {
-    values.resize(m_Entries.size());
-
-    if (m_Entries.size() > 0) {
-        double* pTarget = values.data();
-
-        for (auto& entry : m_Entries) {
-            *pTarget = entry.m_dTimestamp;
-            pTarget++;
-        }
-    }
+    return m_XValues;
 }
 
-void CSMCSimulationParser::readXValues(std::vector<double>& values)
+const std::vector<double>& CSMCSimulationParser::getYValues()
 {
-    values.resize(m_Entries.size());
+    return m_YValues;
+}
 
-    if (m_Entries.size() > 0) {
-        double* pTarget = values.data();
+const std::vector<int32_t>& CSMCSimulationParser::getLaserToggle()
+{
+    return m_LaserToggle;
+}
 
-        for (auto& entry : m_Entries) {
-            *pTarget = entry.m_dCoordinates[0];
-            pTarget++;
-        }
-    }
+const std::vector<double>& CSMCSimulationParser::getActiveChannel1()
+{
+    return m_ActiveChannel1;
 }
 
-void CSMCSimulationParser::readYValues(std::vector<double>& values)
+const std::vector<double>& CSMCSimulationParser::getActiveChannel2()
 {
-    values.resize(m_Entries.size());
+    return m_ActiveChannel2;
+}
 
-    if (m_Entries.size() > 0) {
-        double* pTarget = values.data();
+const std::vector<int32_t>& CSMCSimulationParser::getCommandIndices()
+{
+    return m_CommandIndices;
+}
 
-        for (auto& entry : m_Entries) {
-            *pTarget = entry.m_dCoordinates[1];
-            pTarget++;
-        }
-    }
+void CSMCSimulationParser::writeToDataTable(LibMCEnv::PDataTable pDataTable)
+{
+    if (pDataTable.get() == nullptr)
+        throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
 
+    pDataTable->AddColumn("timestamp", "Timestamp", LibMCEnv::eDataTableColumnType::DoubleColumn);
+    pDataTable->AddColumn("x", "X", LibMCEnv::eDataTableColumnType::DoubleColumn);
+    pDataTable->AddColumn("y", "Y", LibMCEnv::eDataTableColumnType::DoubleColumn);
+    pDataTable->AddColumn("laseron", "LaserOn", LibMCEnv::eDataTableColumnType::Int32Column);
+    pDataTable->AddColumn("active1", "Active Channel 1", LibMCEnv::eDataTableColumnType::DoubleColumn);
+    pDataTable->AddColumn("active2", "Active Channel 2", LibMCEnv::eDataTableColumnType::DoubleColumn);
+    pDataTable->AddColumn("cmdindex", "Command Index", LibMCEnv::eDataTableColumnType::Int32Column);
+
+    pDataTable->SetDoubleColumnValues("timestamp", m_Timestamps);
+    pDataTable->SetDoubleColumnValues("x", m_XValues);
+    pDataTable->SetDoubleColumnValues("y", m_YValues);
+    pDataTable->SetInt32ColumnValues("laseron", m_LaserToggle);
+    pDataTable->SetDoubleColumnValues("active1", m_ActiveChannel1);
+    pDataTable->SetDoubleColumnValues("active2", m_ActiveChannel2);
+    pDataTable->SetInt32ColumnValues("cmdindex", m_CommandIndices);
 }
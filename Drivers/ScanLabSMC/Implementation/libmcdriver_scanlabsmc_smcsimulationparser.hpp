@@ -41,38 +41,95 @@ Abstract: This is the class declaration of CSMCJob
 #include "libmcdriver_scanlabsmc_sdk.hpp"
 
 
+#define SMCSIMULATIONPARSER_MAXTHREADCOUNT 64
+#define SMCSIMULATIONPARSER_MINBYTESPERTHREAD (4 * 1024 * 1024)
+#define SMCSIMULATIONPARSER_TIMESTEP 10.0
+
 namespace LibMCDriver_ScanLabSMC {
 namespace Impl {
 
 
-typedef struct _sSMCSimulationEntry {
-	double m_dTimestamp;
-	double m_dCoordinates[3];
-	int32_t m_dLaserToggle;
-	double m_dActiveChannel1;
-	double m_dActiveChannel2;
-	int32_t m_CommandIndex;
-} sSMCSimulationEntry;
+// Read only memory mapping of a whole file.
+class CSMCMappedFile {
+private:
+
+	const char* m_pData;
+	size_t m_nSize;
+
+#ifdef _WIN32
+	void* m_hFile;
+	void* m_hMapping;
+#else
+	int m_nFileDescriptor;
+#endif
+
+public:
+
+	CSMCMappedFile(const std::string& sAbsoluteFileNameUTF8);
+
+	virtual ~CSMCMappedFile();
+
+	const char* getData();
 
+	size_t getSize();
 
+};
+
+
+// Line aligned part of a simulation file. The ranges are parsed twice: The first pass counts the lines and entries,
+// so that the second pass can write the entries directly to their final position.
+typedef struct _sSMCSimulationRange {
+	const char* m_pStart;
+	const char* m_pEnd;
+	bool m_bHasHeader;
+	uint64_t m_nLineCount;
+	uint64_t m_nEntryCount;
+	uint64_t m_nLineOffset;
+	uint64_t m_nEntryOffset;
+} sSMCSimulationRange;
+
+
+// Parses a simulation file into columns, sorted by timestamp. The file is memory mapped and split into
+// line aligned ranges, that are parsed in parallel.
 class CSMCSimulationParser {
 private:
 
-	std::vector<sSMCSimulationEntry> m_Entries;
+	std::vector<double> m_Timestamps;
+	std::vector<double> m_XValues;
+	std::vector<double> m_YValues;
+	std::vector<int32_t> m_LaserToggle;
+	std::vector<double> m_ActiveChannel1;
+	std::vector<double> m_ActiveChannel2;
+	std::vector<int32_t> m_CommandIndices;
+
+	static int32_t parseHeaderLine(const std::string& sLine);
+
+	// Counts the lines and entries of a range, if bWriteEntries is false. Writes the entries otherwise.
+	void parseRange(sSMCSimulationRange& range, int32_t nNumberOfCoordinates, const char* pHeaderLine, bool bWriteEntries);
+
+	void parseRanges(std::vector<sSMCSimulationRange>& ranges, int32_t nNumberOfCoordinates, const char* pHeaderLine, bool bWriteEntries);
+
+	void sortByTimestamp();
 
 public:
 
-	CSMCSimulationParser(const std::string & sAbsoluteFileName);
+	// nThreadCount 0 uses all hardware threads.
+	CSMCSimulationParser(const std::string & sAbsoluteFileName, uint32_t nThreadCount = 0);
 
 	virtual ~CSMCSimulationParser();
 
 	size_t getCount();
 
-	sSMCSimulationEntry & getEntry(size_t nIndex);
+	const std::vector<double>& getTimestamps();
+	const std::vector<double>& getXValues();
+	const std::vector<double>& getYValues();
+	const std::vector<int32_t>& getLaserToggle();
+	const std::vector<double>& getActiveChannel1();
+	const std::vector<double>& getActiveChannel2();
+	const std::vector<int32_t>& getCommandIndices();
 
-	void readTimestampValues(std::vector<double> & values);
-	void readXValues(std::vector<double>& values);
-	void readYValues(std::vector<double>& values);
+	// Adds the timestamp, x, y, laseron, active1, active2 and cmdindex columns.
+	void writeToDataTable(LibMCEnv::PDataTable pDataTable);
 
 };
 
@@ -248,6 +248,37 @@ LIBMCDRIVER_SCANLABSMC_DECLSPEC LibMCDriver_ScanLabSMCResult libmcdriver_scanlab
 */
 LIBMCDRIVER_SCANLABSMC_DECLSPEC LibMCDriver_ScanLabSMCResult libmcdriver_scanlabsmc_smcjob_waitforexecution(LibMCDriver_ScanLabSMC_SMCJob pSMCJob, LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds);
 
+/**
+* Waits until the execution is finished or the timeout is reached. Does not fail on timeout, so that a state can check for termination in between. Will fail if an error occured.
+*
+* @param[in] pSMCJob - SMCJob instance.
+* @param[in] nTimeOutInMilliseconds - Maximum time to wait. 0 returns immediately.
+* @param[out] pFinished - Returns true if the execution has finished.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLABSMC_DECLSPEC LibMCDriver_ScanLabSMCResult libmcdriver_scanlabsmc_smcjob_waitforcompletion(LibMCDriver_ScanLabSMC_SMCJob pSMCJob, LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds, bool * pFinished);
+
+/**
+* Returns the estimated progress of the execution. The estimate is based on the motion micro steps of the job.
+*
+* @param[in] pSMCJob - SMCJob instance.
+* @param[out] pProgress - Progress between 0.0 (not started) and 1.0 (finished).
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLABSMC_DECLSPEC LibMCDriver_ScanLabSMCResult libmcdriver_scanlabsmc_smcjob_getexecutionprogress(LibMCDriver_ScanLabSMC_SMCJob pSMCJob, LibMCDriver_ScanLabSMC_double * pProgress);
+
+/**
+* Returns the timing of the job. Preparation lasts from BeginJob until Execute has been called.
+*
+* @param[in] pSMCJob - SMCJob instance.
+* @param[out] pPreparationTime - Preparation time of the job in milliseconds.
+* @param[out] pQueueTime - Time in milliseconds between the call of Execute and the start of the execution.
+* @param[out] pExecutionTime - Execution time in milliseconds. Counts up to now if the job is still executing.
+* @param[out] pOverlapTime - Part of the preparation time in milliseconds in which another job of the same context has been executing.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLABSMC_DECLSPEC LibMCDriver_ScanLabSMCResult libmcdriver_scanlabsmc_smcjob_getexecutionstatistics(LibMCDriver_ScanLabSMC_SMCJob pSMCJob, LibMCDriver_ScanLabSMC_double * pPreparationTime, LibMCDriver_ScanLabSMC_double * pQueueTime, LibMCDriver_ScanLabSMC_double * pExecutionTime, LibMCDriver_ScanLabSMC_double * pOverlapTime);
+
 /**
 * Stops the execution of the current list immediately.
 *
@@ -731,6 +762,17 @@ LIBMCDRIVER_SCANLABSMC_DECLSPEC LibMCDriver_ScanLabSMCResult libmcdriver_scanlab
 */
 LIBMCDRIVER_SCANLABSMC_DECLSPEC LibMCDriver_ScanLabSMCResult libmcdriver_scanlabsmc_driver_scanlabsmc_createtemplateconfiguration(LibMCDriver_ScanLabSMC_Driver_ScanLabSMC pDriver_ScanLabSMC, const char * pTemplateName, LibMCDriver_ScanLabSMC_SMCConfiguration * pInstance);
 
+/**
+* Parses the content of an SMC simulation file into a data table. Uses the same columns as SMCJob.LoadSimulationData. Does not need the SDK to be loaded.
+*
+* @param[in] pDriver_ScanLabSMC - Driver_ScanLabSMC instance.
+* @param[in] nSimulationDataBufferSize - Number of elements in buffer
+* @param[in] pSimulationDataBuffer - uint8 buffer of Content of the simulation file.
+* @param[in] pSimulationDataTable - Data table object to read the simulation into.
+* @return error code or 0 (success)
+*/
+LIBMCDRIVER_SCANLABSMC_DECLSPEC LibMCDriver_ScanLabSMCResult libmcdriver_scanlabsmc_driver_scanlabsmc_loadsimulationfiledata(LibMCDriver_ScanLabSMC_Driver_ScanLabSMC pDriver_ScanLabSMC, LibMCDriver_ScanLabSMC_uint64 nSimulationDataBufferSize, const LibMCDriver_ScanLabSMC_uint8 * pSimulationDataBuffer, LibMCEnv_DataTable pSimulationDataTable);
+
 /*************************************************************************************************************************
  Global functions
 **************************************************************************************************************************/
@@ -424,6 +424,28 @@ public:
 	*/
 	virtual void WaitForExecution(const LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds) = 0;
 
+	/**
+	* ISMCJob::WaitForCompletion - Waits until the execution is finished or the timeout is reached. Does not fail on timeout, so that a state can check for termination in between. Will fail if an error occured.
+	* @param[in] nTimeOutInMilliseconds - Maximum time to wait. 0 returns immediately.
+	* @return Returns true if the execution has finished.
+	*/
+	virtual bool WaitForCompletion(const LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds) = 0;
+
+	/**
+	* ISMCJob::GetExecutionProgress - Returns the estimated progress of the execution. The estimate is based on the motion micro steps of the job.
+	* @return Progress between 0.0 (not started) and 1.0 (finished).
+	*/
+	virtual LibMCDriver_ScanLabSMC_double GetExecutionProgress() = 0;
+
+	/**
+	* ISMCJob::GetExecutionStatistics - Returns the timing of the job. Preparation lasts from BeginJob until Execute has been called.
+	* @param[out] dPreparationTime - Preparation time of the job in milliseconds.
+	* @param[out] dQueueTime - Time in milliseconds between the call of Execute and the start of the execution.
+	* @param[out] dExecutionTime - Execution time in milliseconds. Counts up to now if the job is still executing.
+	* @param[out] dOverlapTime - Part of the preparation time in milliseconds in which another job of the same context has been executing.
+	*/
+	virtual void GetExecutionStatistics(LibMCDriver_ScanLabSMC_double & dPreparationTime, LibMCDriver_ScanLabSMC_double & dQueueTime, LibMCDriver_ScanLabSMC_double & dExecutionTime, LibMCDriver_ScanLabSMC_double & dOverlapTime) = 0;
+
 	/**
 	* ISMCJob::StopExecution - Stops the execution of the current list immediately.
 	*/
@@ -772,6 +794,14 @@ public:
 	*/
 	virtual ISMCConfiguration * CreateTemplateConfiguration(const std::string & sTemplateName) = 0;
 
+	/**
+	* IDriver_ScanLabSMC::LoadSimulationFileData - Parses the content of an SMC simulation file into a data table. Uses the same columns as SMCJob.LoadSimulationData. Does not need the SDK to be loaded.
+	* @param[in] nSimulationDataBufferSize - Number of elements in buffer
+	* @param[in] pSimulationDataBuffer - uint8 buffer of Content of the simulation file.
+	* @param[in] pSimulationDataTable - Data table object to read the simulation into.
+	*/
+	virtual void LoadSimulationFileData(const LibMCDriver_ScanLabSMC_uint64 nSimulationDataBufferSize, const LibMCDriver_ScanLabSMC_uint8 * pSimulationDataBuffer, LibMCEnv::PDataTable pSimulationDataTable) = 0;
+
 };
 
 typedef IBaseSharedPtr<IDriver_ScanLabSMC> PIDriver_ScanLabSMC;
@@ -600,6 +600,90 @@ LibMCDriver_ScanLabSMCResult libmcdriver_scanlabsmc_smcjob_waitforexecution(LibM
 	}
 }
 
+LibMCDriver_ScanLabSMCResult libmcdriver_scanlabsmc_smcjob_waitforcompletion(LibMCDriver_ScanLabSMC_SMCJob pSMCJob, LibMCDriver_ScanLabSMC_uint32 nTimeOutInMilliseconds, bool * pFinished)
+{
+	IBase* pIBaseClass = (IBase *)pSMCJob;
+
+	try {
+		if (pFinished == nullptr)
+			throw ELibMCDriver_ScanLabSMCInterfaceException (LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+		ISMCJob* pISMCJob = dynamic_cast<ISMCJob*>(pIBaseClass);
+		if (!pISMCJob)
+			throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDCAST);
+		
+		*pFinished = pISMCJob->WaitForCompletion(nTimeOutInMilliseconds);
+
+		return LIBMCDRIVER_SCANLABSMC_SUCCESS;
+	}
+	catch (ELibMCDriver_ScanLabSMCInterfaceException & Exception) {
+		return handleLibMCDriver_ScanLabSMCException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_ScanLabSMCResult libmcdriver_scanlabsmc_smcjob_getexecutionprogress(LibMCDriver_ScanLabSMC_SMCJob pSMCJob, LibMCDriver_ScanLabSMC_double * pProgress)
+{
+	IBase* pIBaseClass = (IBase *)pSMCJob;
+
+	try {
+		if (pProgress == nullptr)
+			throw ELibMCDriver_ScanLabSMCInterfaceException (LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+		ISMCJob* pISMCJob = dynamic_cast<ISMCJob*>(pIBaseClass);
+		if (!pISMCJob)
+			throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDCAST);
+		
+		*pProgress = pISMCJob->GetExecutionProgress();
+
+		return LIBMCDRIVER_SCANLABSMC_SUCCESS;
+	}
+	catch (ELibMCDriver_ScanLabSMCInterfaceException & Exception) {
+		return handleLibMCDriver_ScanLabSMCException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCDriver_ScanLabSMCResult libmcdriver_scanlabsmc_smcjob_getexecutionstatistics(LibMCDriver_ScanLabSMC_SMCJob pSMCJob, LibMCDriver_ScanLabSMC_double * pPreparationTime, LibMCDriver_ScanLabSMC_double * pQueueTime, LibMCDriver_ScanLabSMC_double * pExecutionTime, LibMCDriver_ScanLabSMC_double * pOverlapTime)
+{
+	IBase* pIBaseClass = (IBase *)pSMCJob;
+
+	try {
+		if (!pPreparationTime)
+			throw ELibMCDriver_ScanLabSMCInterfaceException (LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+		if (!pQueueTime)
+			throw ELibMCDriver_ScanLabSMCInterfaceException (LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+		if (!pExecutionTime)
+			throw ELibMCDriver_ScanLabSMCInterfaceException (LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+		if (!pOverlapTime)
+			throw ELibMCDriver_ScanLabSMCInterfaceException (LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+		ISMCJob* pISMCJob = dynamic_cast<ISMCJob*>(pIBaseClass);
+		if (!pISMCJob)
+			throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDCAST);
+		
+		pISMCJob->GetExecutionStatistics(*pPreparationTime, *pQueueTime, *pExecutionTime, *pOverlapTime);
+
+		return LIBMCDRIVER_SCANLABSMC_SUCCESS;
+	}
+	catch (ELibMCDriver_ScanLabSMCInterfaceException & Exception) {
+		return handleLibMCDriver_ScanLabSMCException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 LibMCDriver_ScanLabSMCResult libmcdriver_scanlabsmc_smcjob_stopexecution(LibMCDriver_ScanLabSMC_SMCJob pSMCJob)
 {
 	IBase* pIBaseClass = (IBase *)pSMCJob;
@@ -2039,6 +2123,37 @@ LibMCDriver_ScanLabSMCResult libmcdriver_scanlabsmc_driver_scanlabsmc_createtemp
 	}
 }
 
+LibMCDriver_ScanLabSMCResult libmcdriver_scanlabsmc_driver_scanlabsmc_loadsimulationfiledata(LibMCDriver_ScanLabSMC_Driver_ScanLabSMC pDriver_ScanLabSMC, LibMCDriver_ScanLabSMC_uint64 nSimulationDataBufferSize, const LibMCDriver_ScanLabSMC_uint8 * pSimulationDataBuffer, LibMCEnv_DataTable pSimulationDataTable)
+{
+	IBase* pIBaseClass = (IBase *)pDriver_ScanLabSMC;
+
+	try {
+		if ( (!pSimulationDataBuffer) && (nSimulationDataBufferSize>0))
+			throw ELibMCDriver_ScanLabSMCInterfaceException (LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDPARAM);
+		LibMCEnv::PDataTable pISimulationDataTable = std::make_shared<LibMCEnv::CDataTable>(CWrapper::sPLibMCEnvWrapper.get(), pSimulationDataTable);
+		CWrapper::sPLibMCEnvWrapper->AcquireInstance(pISimulationDataTable.get());
+		if (!pISimulationDataTable)
+			throw ELibMCDriver_ScanLabSMCInterfaceException (LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDCAST);
+		
+		IDriver_ScanLabSMC* pIDriver_ScanLabSMC = dynamic_cast<IDriver_ScanLabSMC*>(pIBaseClass);
+		if (!pIDriver_ScanLabSMC)
+			throw ELibMCDriver_ScanLabSMCInterfaceException(LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDCAST);
+		
+		pIDriver_ScanLabSMC->LoadSimulationFileData(nSimulationDataBufferSize, pSimulationDataBuffer, pISimulationDataTable);
+
+		return LIBMCDRIVER_SCANLABSMC_SUCCESS;
+	}
+	catch (ELibMCDriver_ScanLabSMCInterfaceException & Exception) {
+		return handleLibMCDriver_ScanLabSMCException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 
 /*************************************************************************************************************************
@@ -2088,6 +2203,12 @@ LibMCDriver_ScanLabSMCResult LibMCDriver_ScanLabSMC::Impl::LibMCDriver_ScanLabSM
 		*ppProcAddress = (void*) &libmcdriver_scanlabsmc_smcjob_isexecuting;
 	if (sProcName == "libmcdriver_scanlabsmc_smcjob_waitforexecution") 
 		*ppProcAddress = (void*) &libmcdriver_scanlabsmc_smcjob_waitforexecution;
+	if (sProcName == "libmcdriver_scanlabsmc_smcjob_waitforcompletion") 
+		*ppProcAddress = (void*) &libmcdriver_scanlabsmc_smcjob_waitforcompletion;
+	if (sProcName == "libmcdriver_scanlabsmc_smcjob_getexecutionprogress") 
+		*ppProcAddress = (void*) &libmcdriver_scanlabsmc_smcjob_getexecutionprogress;
+	if (sProcName == "libmcdriver_scanlabsmc_smcjob_getexecutionstatistics") 
+		*ppProcAddress = (void*) &libmcdriver_scanlabsmc_smcjob_getexecutionstatistics;
 	if (sProcName == "libmcdriver_scanlabsmc_smcjob_stopexecution") 
 		*ppProcAddress = (void*) &libmcdriver_scanlabsmc_smcjob_stopexecution;
 	if (sProcName == "libmcdriver_scanlabsmc_smcjob_loadsimulationdata") 
@@ -2184,6 +2305,8 @@ LibMCDriver_ScanLabSMCResult LibMCDriver_ScanLabSMC::Impl::LibMCDriver_ScanLabSM
 		*ppProcAddress = (void*) &libmcdriver_scanlabsmc_driver_scanlabsmc_createemptyconfiguration;
 	if (sProcName == "libmcdriver_scanlabsmc_driver_scanlabsmc_createtemplateconfiguration") 
 		*ppProcAddress = (void*) &libmcdriver_scanlabsmc_driver_scanlabsmc_createtemplateconfiguration;
+	if (sProcName == "libmcdriver_scanlabsmc_driver_scanlabsmc_loadsimulationfiledata") 
+		*ppProcAddress = (void*) &libmcdriver_scanlabsmc_driver_scanlabsmc_loadsimulationfiledata;
 	if (sProcName == "libmcdriver_scanlabsmc_getversion") 
 		*ppProcAddress = (void*) &libmcdriver_scanlabsmc_getversion;
 	if (sProcName == "libmcdriver_scanlabsmc_getlasterror") 
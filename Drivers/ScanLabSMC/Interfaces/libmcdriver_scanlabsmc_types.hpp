@@ -148,6 +148,13 @@ typedef void * LibMCDriver_ScanLabSMC_pvoid;
 #define LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTGETJOBCHARACTERISTIC 1040 /** Could not get job characteristic. */
 #define LIBMCDRIVER_SCANLABSMC_ERROR_JOBDURATIONHASNOTBEENPARSED 1041 /** Job duration has not been parsed. */
 #define LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTSTOPJOBEXECUTION 1042 /** Could not stop job execution. */
+#define LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONFILEENTRY 1043 /** Invalid simulation file entry. */
+#define LIBMCDRIVER_SCANLABSMC_ERROR_JOBISNOTFINALIZED 1044 /** Job is not finalized. */
+#define LIBMCDRIVER_SCANLABSMC_ERROR_JOBHASALREADYBEENEXECUTED 1045 /** Job has already been executed. */
+#define LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONTIMEOUT 1046 /** Job execution timeout. */
+#define LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONABORTED 1047 /** Job execution has been aborted. */
+#define LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONFAILED 1048 /** Job execution failed. */
+#define LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONNOTSTARTED 1049 /** Job execution has not been started. */
 
 /*************************************************************************************************************************
  Error strings for LibMCDriver_ScanLabSMC
@@ -208,6 +215,13 @@ inline const char * LIBMCDRIVER_SCANLABSMC_GETERRORSTRING (LibMCDriver_ScanLabSM
     case LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTGETJOBCHARACTERISTIC: return "Could not get job characteristic.";
     case LIBMCDRIVER_SCANLABSMC_ERROR_JOBDURATIONHASNOTBEENPARSED: return "Job duration has not been parsed.";
     case LIBMCDRIVER_SCANLABSMC_ERROR_COULDNOTSTOPJOBEXECUTION: return "Could not stop job execution.";
+    case LIBMCDRIVER_SCANLABSMC_ERROR_INVALIDSIMULATIONFILEENTRY: return "Invalid simulation file entry.";
+    case LIBMCDRIVER_SCANLABSMC_ERROR_JOBISNOTFINALIZED: return "Job is not finalized.";
+    case LIBMCDRIVER_SCANLABSMC_ERROR_JOBHASALREADYBEENEXECUTED: return "Job has already been executed.";
+    case LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONTIMEOUT: return "Job execution timeout.";
+    case LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONABORTED: return "Job execution has been aborted.";
+    case LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONFAILED: return "Job execution failed.";
+    case LIBMCDRIVER_SCANLABSMC_ERROR_JOBEXECUTIONNOTSTARTED: return "Job execution has not been started.";
     default: return "unknown error";
   }
 }
@@ -727,6 +727,12 @@ public:
 			case LIBMC_ERROR_INVALIDCONTENTSTATEID: return "INVALIDCONTENTSTATEID";
 			case LIBMC_ERROR_INVALIDWIDGETREQUEST: return "INVALIDWIDGETREQUEST";
 			case LIBMC_ERROR_SOURCEVARIABLENOTFOUND: return "SOURCEVARIABLENOTFOUND";
+			case LIBMC_ERROR_INVALIDTOOLPATHTILEINDEX: return "INVALIDTOOLPATHTILEINDEX";
+			case LIBMC_ERROR_INVALIDTOOLPATHVIEWPORT: return "INVALIDTOOLPATHVIEWPORT";
+			case LIBMC_ERROR_INVALIDTOOLPATHRESOLUTION: return "INVALIDTOOLPATHRESOLUTION";
+			case LIBMC_ERROR_INVALIDSCATTERPLOTVIEWPORT: return "INVALIDSCATTERPLOTVIEWPORT";
+			case LIBMC_ERROR_INVALIDSCATTERPLOTRESOLUTION: return "INVALIDSCATTERPLOTRESOLUTION";
+			case LIBMC_ERROR_INVALIDSCATTERPLOTMEMORYBUDGET: return "INVALIDSCATTERPLOTMEMORYBUDGET";
 		}
 		return "UNKNOWN";
 	}
@@ -1288,6 +1294,12 @@ public:
 			case LIBMC_ERROR_INVALIDCONTENTSTATEID: return "Invalid content state ID";
 			case LIBMC_ERROR_INVALIDWIDGETREQUEST: return "Invalid widget request";
 			case LIBMC_ERROR_SOURCEVARIABLENOTFOUND: return "Source variable not found";
+			case LIBMC_ERROR_INVALIDTOOLPATHTILEINDEX: return "Invalid toolpath tile index";
+			case LIBMC_ERROR_INVALIDTOOLPATHVIEWPORT: return "Invalid toolpath viewport";
+			case LIBMC_ERROR_INVALIDTOOLPATHRESOLUTION: return "Invalid toolpath resolution";
+			case LIBMC_ERROR_INVALIDSCATTERPLOTVIEWPORT: return "Invalid scatterplot viewport";
+			case LIBMC_ERROR_INVALIDSCATTERPLOTRESOLUTION: return "Invalid scatterplot resolution";
+			case LIBMC_ERROR_INVALIDSCATTERPLOTMEMORYBUDGET: return "Invalid scatterplot memory budget";
 		}
 		return "unknown error";
 	}
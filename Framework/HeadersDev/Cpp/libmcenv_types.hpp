@@ -135,6 +135,10 @@ typedef void * LibMCEnv_pvoid;
 #define LIBMCENV_ERROR_INVALIDIMAGEBUFFER 37 /** Invalid image buffer. */
 #define LIBMCENV_ERROR_INVALIDPIXELFORMAT 38 /** Invalid pixel format. */
 #define LIBMCENV_ERROR_INVALIDTESTOUTPUTNAME 39 /** Invalid test output name. */
+#define LIBMCENV_ERROR_INVALIDTOOLPATHRESOLUTION 10238 /** Invalid toolpath resolution */
+#define LIBMCENV_ERROR_INVALIDSCATTERPLOTVIEWPORT 10239 /** Invalid scatter plot viewport */
+#define LIBMCENV_ERROR_INVALIDSCATTERPLOTRESOLUTION 10240 /** Invalid scatter plot resolution */
+#define LIBMCENV_ERROR_EMPTYTOOLPATHNAME 10241 /** Empty toolpath name */
 
 /*************************************************************************************************************************
  Error strings for LibMCEnv
@@ -182,6 +186,10 @@ inline const char * LIBMCENV_GETERRORSTRING (LibMCEnvResult nErrorCode) {
     case LIBMCENV_ERROR_INVALIDIMAGEBUFFER: return "Invalid image buffer.";
     case LIBMCENV_ERROR_INVALIDPIXELFORMAT: return "Invalid pixel format.";
     case LIBMCENV_ERROR_INVALIDTESTOUTPUTNAME: return "Invalid test output name.";
+    case LIBMCENV_ERROR_INVALIDTOOLPATHRESOLUTION: return "Invalid toolpath resolution";
+    case LIBMCENV_ERROR_INVALIDSCATTERPLOTVIEWPORT: return "Invalid scatter plot viewport";
+    case LIBMCENV_ERROR_INVALIDSCATTERPLOTRESOLUTION: return "Invalid scatter plot resolution";
+    case LIBMCENV_ERROR_EMPTYTOOLPATHNAME: return "Empty toolpath name";
     default: return "unknown error";
   }
 }
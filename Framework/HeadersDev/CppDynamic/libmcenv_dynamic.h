@@ -216,6 +216,78 @@ typedef LibMCEnvResult (*PLibMCEnvPNGImageStoreOptions_GetStorageFormatPtr) (Lib
 */
 typedef LibMCEnvResult (*PLibMCEnvPNGImageStoreOptions_SetStorageFormatPtr) (LibMCEnv_PNGImageStoreOptions pPNGImageStoreOptions, LibMCEnv::ePNGStorageFormat ePNGStorageFormat);
 
+/**
+* Returns the zlib compression level.
+*
+* @param[in] pPNGImageStoreOptions - PNGImageStoreOptions instance.
+* @param[out] pCompressionLevel - Compression level from 0 (stored) to 9 (smallest). Default is 6.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvPNGImageStoreOptions_GetCompressionLevelPtr) (LibMCEnv_PNGImageStoreOptions pPNGImageStoreOptions, LibMCEnv_uint32 * pCompressionLevel);
+
+/**
+* Sets the zlib compression level.
+*
+* @param[in] pPNGImageStoreOptions - PNGImageStoreOptions instance.
+* @param[in] nCompressionLevel - Compression level from 0 (stored) to 9 (smallest). Default is 6.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvPNGImageStoreOptions_SetCompressionLevelPtr) (LibMCEnv_PNGImageStoreOptions pPNGImageStoreOptions, LibMCEnv_uint32 nCompressionLevel);
+
+/**
+* Returns the scanline filter strategy.
+*
+* @param[in] pPNGImageStoreOptions - PNGImageStoreOptions instance.
+* @param[out] pFilterStrategy - Filter strategy. Default is Adaptive.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvPNGImageStoreOptions_GetFilterStrategyPtr) (LibMCEnv_PNGImageStoreOptions pPNGImageStoreOptions, eLibMCEnvPNGFilterStrategy * pFilterStrategy);
+
+/**
+* Sets the scanline filter strategy.
+*
+* @param[in] pPNGImageStoreOptions - PNGImageStoreOptions instance.
+* @param[in] eFilterStrategy - Filter strategy. Default is Adaptive.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvPNGImageStoreOptions_SetFilterStrategyPtr) (LibMCEnv_PNGImageStoreOptions pPNGImageStoreOptions, eLibMCEnvPNGFilterStrategy eFilterStrategy);
+
+/**
+* Returns the encoder that is used to create the PNG stream.
+*
+* @param[in] pPNGImageStoreOptions - PNGImageStoreOptions instance.
+* @param[out] pEncoderBackend - Encoder backend. Default is ZLib.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvPNGImageStoreOptions_GetEncoderBackendPtr) (LibMCEnv_PNGImageStoreOptions pPNGImageStoreOptions, eLibMCEnvPNGEncoderBackend * pEncoderBackend);
+
+/**
+* Sets the encoder that is used to create the PNG stream.
+*
+* @param[in] pPNGImageStoreOptions - PNGImageStoreOptions instance.
+* @param[in] eEncoderBackend - Encoder backend. Default is ZLib.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvPNGImageStoreOptions_SetEncoderBackendPtr) (LibMCEnv_PNGImageStoreOptions pPNGImageStoreOptions, eLibMCEnvPNGEncoderBackend eEncoderBackend);
+
+/**
+* Returns the number of threads the ZLib encoder may use.
+*
+* @param[in] pPNGImageStoreOptions - PNGImageStoreOptions instance.
+* @param[out] pThreadCount - Number of threads. 0 uses the number of hardware threads. 1 compresses the image as a single stream.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvPNGImageStoreOptions_GetThreadCountPtr) (LibMCEnv_PNGImageStoreOptions pPNGImageStoreOptions, LibMCEnv_uint32 * pThreadCount);
+
+/**
+* Sets the number of threads the ZLib encoder may use.
+*
+* @param[in] pPNGImageStoreOptions - PNGImageStoreOptions instance.
+* @param[in] nThreadCount - Number of threads. 0 uses the number of hardware threads. 1 compresses the image as a single stream. Default is 0.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvPNGImageStoreOptions_SetThreadCountPtr) (LibMCEnv_PNGImageStoreOptions pPNGImageStoreOptions, LibMCEnv_uint32 nThreadCount);
+
 /*************************************************************************************************************************
  Class definition for PNGImageData
 **************************************************************************************************************************/
@@ -668,6 +740,26 @@ typedef LibMCEnvResult (*PLibMCEnvScatterPlot_GetPointPositionPtr) (LibMCEnv_Sca
 */
 typedef LibMCEnvResult (*PLibMCEnvScatterPlot_GetBoundariesPtr) (LibMCEnv_ScatterPlot pScatterPlot, LibMCEnv_double * pMinX, LibMCEnv_double * pMinY, LibMCEnv_double * pMaxX, LibMCEnv_double * pMaxY);
 
+/**
+* Aggregates all points in a viewport into a grid of bins, using the spatial index of the plot. Every non-empty bin returns the mean position and the number of its points. Non-empty bins are returned row by row, starting at MinX/MinY. Bins that are larger than an index cell are aggregated from whole cells, so all points of such a cell are counted in the bin of the cell's mean position.
+*
+* @param[in] pScatterPlot - ScatterPlot instance.
+* @param[in] dMinX - Minimum X value of the viewport in mm
+* @param[in] dMinY - Minimum Y value of the viewport in mm
+* @param[in] dMaxX - Maximum X value of the viewport in mm. MUST be larger than MinX.
+* @param[in] dMaxY - Maximum Y value of the viewport in mm. MUST be larger than MinY.
+* @param[in] nResolutionX - Number of bins in X. MUST be between 1 and 4096.
+* @param[in] nResolutionY - Number of bins in Y. MUST be between 1 and 4096.
+* @param[in] nPositionsBufferSize - Number of elements in buffer
+* @param[out] pPositionsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pPositionsBuffer - FloatPosition2D  buffer of Mean position of every non-empty bin in mm.
+* @param[in] nCountsBufferSize - Number of elements in buffer
+* @param[out] pCountsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pCountsBuffer - uint32  buffer of Number of points of every non-empty bin.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvScatterPlot_QueryDensityPtr) (LibMCEnv_ScatterPlot pScatterPlot, LibMCEnv_double dMinX, LibMCEnv_double dMinY, LibMCEnv_double dMaxX, LibMCEnv_double dMaxY, LibMCEnv_uint32 nResolutionX, LibMCEnv_uint32 nResolutionY, const LibMCEnv_uint64 nPositionsBufferSize, LibMCEnv_uint64* pPositionsNeededCount, sLibMCEnvFloatPosition2D * pPositionsBuffer, const LibMCEnv_uint64 nCountsBufferSize, LibMCEnv_uint64* pCountsNeededCount, LibMCEnv_uint32 * pCountsBuffer);
+
 /**
 * Release the scatter plot and clear its memory. All accessing code will lose access to the data.
 *
@@ -936,130 +1028,640 @@ typedef LibMCEnvResult (*PLibMCEnvDiscreteFieldData2D_AddFieldPtr) (LibMCEnv_Dis
 */
 typedef LibMCEnvResult (*PLibMCEnvDiscreteFieldData2D_DuplicatePtr) (LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, LibMCEnv_DiscreteFieldData2D * pNewField);
 
+/**
+* Returns the precision in which the field values are stored.
+*
+* @param[in] pDiscreteFieldData2D - DiscreteFieldData2D instance.
+* @param[out] pStoragePrecision - Storage precision. Default is Float64.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDiscreteFieldData2D_GetStoragePrecisionPtr) (LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, eLibMCEnvFieldStoragePrecision * pStoragePrecision);
+
+/**
+* Changes the precision in which the field values are stored. Existing values are converted.
+*
+* @param[in] pDiscreteFieldData2D - DiscreteFieldData2D instance.
+* @param[in] eStoragePrecision - Storage precision.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDiscreteFieldData2D_SetStoragePrecisionPtr) (LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, eLibMCEnvFieldStoragePrecision eStoragePrecision);
+
+/**
+* Returns how the field values are stored in memory.
+*
+* @param[in] pDiscreteFieldData2D - DiscreteFieldData2D instance.
+* @param[out] pStorageLayout - Storage layout. Default is Dense.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDiscreteFieldData2D_GetStorageLayoutPtr) (LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, eLibMCEnvFieldStorageLayout * pStorageLayout);
+
+/**
+* Changes how the field values are stored in memory. Existing values are kept. Converting to a tiled layout does not allocate tiles that only contain the background value.
+*
+* @param[in] pDiscreteFieldData2D - DiscreteFieldData2D instance.
+* @param[in] eStorageLayout - Storage layout.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDiscreteFieldData2D_SetStorageLayoutPtr) (LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, eLibMCEnvFieldStorageLayout eStorageLayout);
+
+/**
+* Returns the memory that is allocated for the field values.
+*
+* @param[in] pDiscreteFieldData2D - DiscreteFieldData2D instance.
+* @param[out] pStorageSize - Allocated memory in bytes.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDiscreteFieldData2D_GetStorageSizePtr) (LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, LibMCEnv_uint64 * pStorageSize);
+
+/**
+* Releases all allocated tiles whose values are all equal to the background value of the field. The background value is the value that was last passed to Clear.
+*
+* @param[in] pDiscreteFieldData2D - DiscreteFieldData2D instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDiscreteFieldData2D_CompactPtr) (LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D);
+
+/**
+* Returns the number of threads that field operations may use.
+*
+* @param[in] pDiscreteFieldData2D - DiscreteFieldData2D instance.
+* @param[out] pThreadCount - Number of threads. 0 uses the number of hardware threads.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDiscreteFieldData2D_GetThreadCountPtr) (LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, LibMCEnv_uint32 * pThreadCount);
+
+/**
+* Sets the number of threads that field operations may use. Small fields are always processed on the calling thread.
+*
+* @param[in] pDiscreteFieldData2D - DiscreteFieldData2D instance.
+* @param[in] nThreadCount - Number of threads. 0 uses the number of hardware threads. MUST not be larger than 64. Default is 0.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDiscreteFieldData2D_SetThreadCountPtr) (LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, LibMCEnv_uint32 nThreadCount);
+
+/**
+* Enables or disables the vectorised kernels of the field operations. All kernels return identical results, disabling them is meant for benchmarks and diagnostics.
+*
+* @param[in] pDiscreteFieldData2D - DiscreteFieldData2D instance.
+* @param[in] bEnabled - If false, the scalar kernels are used. Default is true.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDiscreteFieldData2D_SetSIMDKernelsEnabledPtr) (LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, bool bEnabled);
+
+/**
+* Returns the name of the kernels that are used for the field operations.
+*
+* @param[in] pDiscreteFieldData2D - DiscreteFieldData2D instance.
+* @param[in] nKernelNameBufferSize - size of the buffer (including trailing 0)
+* @param[out] pKernelNameNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pKernelNameBuffer -  buffer of scalar or avx2., may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDiscreteFieldData2D_GetSIMDKernelNamePtr) (LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, const LibMCEnv_uint32 nKernelNameBufferSize, LibMCEnv_uint32* pKernelNameNeededChars, char * pKernelNameBuffer);
+
 /*************************************************************************************************************************
  Class definition for DataTableWriteOptions
 **************************************************************************************************************************/
 
+/**
+* Resets all options to default. Columns are stored raw and uncompressed.
+*
+* @param[in] pDataTableWriteOptions - DataTableWriteOptions instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableWriteOptions_ResetToDefaultsPtr) (LibMCEnv_DataTableWriteOptions pDataTableWriteOptions);
+
+/**
+* Returns the encoding of all columns that have no column specific encoding.
+*
+* @param[in] pDataTableWriteOptions - DataTableWriteOptions instance.
+* @param[out] pEncoding - Column encoding. Default is Raw.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableWriteOptions_GetDefaultEncodingPtr) (LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, eLibMCEnvDataTableColumnEncoding * pEncoding);
+
+/**
+* Sets the encoding of all columns that have no column specific encoding.
+*
+* @param[in] pDataTableWriteOptions - DataTableWriteOptions instance.
+* @param[in] eEncoding - Column encoding.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableWriteOptions_SetDefaultEncodingPtr) (LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, eLibMCEnvDataTableColumnEncoding eEncoding);
+
+/**
+* Returns the encoding of a column.
+*
+* @param[in] pDataTableWriteOptions - DataTableWriteOptions instance.
+* @param[in] pIdentifier - Identifier of the column.
+* @param[out] pEncoding - Column encoding. Returns the default encoding, if no column specific encoding has been set.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableWriteOptions_GetColumnEncodingPtr) (LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, const char * pIdentifier, eLibMCEnvDataTableColumnEncoding * pEncoding);
+
+/**
+* Sets the encoding of a column. The column does not need to exist in the data table. Unknown identifiers are ignored when writing.
+*
+* @param[in] pDataTableWriteOptions - DataTableWriteOptions instance.
+* @param[in] pIdentifier - Identifier of the column.
+* @param[in] eEncoding - Column encoding.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableWriteOptions_SetColumnEncodingPtr) (LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, const char * pIdentifier, eLibMCEnvDataTableColumnEncoding eEncoding);
+
+/**
+* Removes all column specific encodings.
+*
+* @param[in] pDataTableWriteOptions - DataTableWriteOptions instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableWriteOptions_ClearColumnEncodingsPtr) (LibMCEnv_DataTableWriteOptions pDataTableWriteOptions);
+
+/**
+* Returns the compression that is applied to the encoded column data.
+*
+* @param[in] pDataTableWriteOptions - DataTableWriteOptions instance.
+* @param[out] pCompression - Compression. Default is NoCompression.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableWriteOptions_GetCompressionPtr) (LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, eLibMCEnvDataTableCompression * pCompression);
+
+/**
+* Sets the compression that is applied to the encoded column data.
+*
+* @param[in] pDataTableWriteOptions - DataTableWriteOptions instance.
+* @param[in] eCompression - Compression.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableWriteOptions_SetCompressionPtr) (LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, eLibMCEnvDataTableCompression eCompression);
+
+/**
+* Returns the compression level.
+*
+* @param[in] pDataTableWriteOptions - DataTableWriteOptions instance.
+* @param[out] pCompressionLevel - Compression level from 0 to 9. ZLib stores level 0 uncompressed and compresses best at 9. LZ4 uses the fast compressor below level 3 and LZ4 HC from level 3. Default is 6.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableWriteOptions_GetCompressionLevelPtr) (LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, LibMCEnv_uint32 * pCompressionLevel);
+
+/**
+* Sets the compression level.
+*
+* @param[in] pDataTableWriteOptions - DataTableWriteOptions instance.
+* @param[in] nCompressionLevel - Compression level from 0 to 9. ZLib stores level 0 uncompressed and compresses best at 9. LZ4 uses the fast compressor below level 3 and LZ4 HC from level 3.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableWriteOptions_SetCompressionLevelPtr) (LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, LibMCEnv_uint32 nCompressionLevel);
+
 /*************************************************************************************************************************
  Class definition for DataTableCSVWriteOptions
 **************************************************************************************************************************/
 
 /**
-* Returns the desired separator of the CSV file. Default is semicolon.
+* Returns the desired separator of the CSV file. Default is semicolon.
+*
+* @param[in] pDataTableCSVWriteOptions - DataTableCSVWriteOptions instance.
+* @param[in] nSeparatorBufferSize - size of the buffer (including trailing 0)
+* @param[out] pSeparatorNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pSeparatorBuffer -  buffer of Separator to use., may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableCSVWriteOptions_GetSeparatorPtr) (LibMCEnv_DataTableCSVWriteOptions pDataTableCSVWriteOptions, const LibMCEnv_uint32 nSeparatorBufferSize, LibMCEnv_uint32* pSeparatorNeededChars, char * pSeparatorBuffer);
+
+/**
+* Sets the desired separator of the CSV file.
+*
+* @param[in] pDataTableCSVWriteOptions - DataTableCSVWriteOptions instance.
+* @param[in] pSeparator - Separator to use. MUST be a single character ASCII string. (ASCII Code 32-127)
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableCSVWriteOptions_SetSeparatorPtr) (LibMCEnv_DataTableCSVWriteOptions pDataTableCSVWriteOptions, const char * pSeparator);
+
+/*************************************************************************************************************************
+ Class definition for DataTableScatterPlotOptions
+**************************************************************************************************************************/
+
+/**
+* Sets the column to use for the X Axis value. Column MUST exist.
+*
+* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
+* @param[in] pColumnIdentifier - Identifier of the column. Must be alphanumeric and not empty.
+* @param[in] dScaleFactor - Scale factor to use. The X value will be computed as raw value times scale factor plus offset factor in millimeters.
+* @param[in] dOffsetFactor - Offset factor to use. The X value will be computed as raw value times scale factor plus offset factor in millimeters.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_SetXAxisColumnPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const char * pColumnIdentifier, LibMCEnv_double dScaleFactor, LibMCEnv_double dOffsetFactor);
+
+/**
+* Returns the column to use for the X Axis value..
+*
+* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
+* @param[in] nColumnIdentifierBufferSize - size of the buffer (including trailing 0)
+* @param[out] pColumnIdentifierNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pColumnIdentifierBuffer -  buffer of Identifier of the column. Empty if not set yet., may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_GetXAxisColumnPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer);
+
+/**
+* Returns the scaling for the X Axis value..
+*
+* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
+* @param[out] pScaleFactor - Scale factor to use. The X value will be computed as raw value times scale factor plus offset factor in millimeters. Default is 1.0.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_GetXAxisScalingPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, LibMCEnv_double * pScaleFactor);
+
+/**
+* Returns the scaling for the X Axis value..
+*
+* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
+* @param[out] pOffsetFactor - Offset factor to use. The X value will be computed as raw value times scale factor plus offset factor in millimeters. Default is 0.0.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_GetXAxisOffsetPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, LibMCEnv_double * pOffsetFactor);
+
+/**
+* Sets the column to use for the Y Axis value. Column MUST exist.
+*
+* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
+* @param[in] pColumnIdentifier - Identifier of the column. Must be alphanumeric and not empty.
+* @param[in] dScaleFactor - Scale factor to use. The Y value will be computed as raw value times scale factor plus offset factor in millimeters.
+* @param[in] dOffsetFactor - Offset factor to use. The Y value will be computed as raw value times scale factor plus offset factor in millimeters.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_SetYAxisColumnPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const char * pColumnIdentifier, LibMCEnv_double dScaleFactor, LibMCEnv_double dOffsetFactor);
+
+/**
+* Returns the column to use for the X Axis value..
+*
+* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
+* @param[in] nColumnIdentifierBufferSize - size of the buffer (including trailing 0)
+* @param[out] pColumnIdentifierNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pColumnIdentifierBuffer -  buffer of Identifier of the column. Empty if not set yet., may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_GetYAxisColumnPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer);
+
+/**
+* Returns the scaling for the X Axis value..
+*
+* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
+* @param[out] pScaleFactor - Scale factor to use. The X value will be computed as raw value times scale factor plus offset factor in millimeters. Default is 1.0.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_GetYAxisScalingPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, LibMCEnv_double * pScaleFactor);
+
+/**
+* Returns the scaling for the X Axis value..
+*
+* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
+* @param[out] pOffsetFactor - Offset factor to use. The X value will be computed as raw value times scale factor plus offset factor in millimeters. Default is 0.0.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_GetYAxisOffsetPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, LibMCEnv_double * pOffsetFactor);
+
+/**
+* Adds a data channel. Column MUST exist.
+*
+* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
+* @param[in] pChannelIdentifier - Identifier of the channel. Must be alphanumeric and not empty.
+* @param[in] pColumnIdentifier - Identifier of the column to use. Must be alphanumeric and not empty.
+* @param[in] dScaleFactor - Scale factor to use. The channel value will be computed as raw value times scale factor plus offset factor.
+* @param[in] dOffsetFactor - Offset factor to use. The channel value will be computed as raw value times scale factor plus offset factor.
+* @param[in] nColor - Base color to use.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_AddDataChannelPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const char * pChannelIdentifier, const char * pColumnIdentifier, LibMCEnv_double dScaleFactor, LibMCEnv_double dOffsetFactor, LibMCEnv_uint32 nColor);
+
+/*************************************************************************************************************************
+ Class definition for DataTableFilter
+*************************************************************************************************************************/
+
+/**
+* Adds a condition on a column. The column is looked up when the filter is applied. Integer columns are compared exactly against the threshold values.
+*
+* @param[in] pDataTableFilter - DataTableFilter instance.
+* @param[in] pColumnIdentifier - Identifier of the column. Must be alphanumeric and not empty.
+* @param[in] eOperator - Comparison operator.
+* @param[in] dValue - Threshold value. Lower bound for InRange and OutsideRange.
+* @param[in] dUpperValue - Upper bound for InRange and OutsideRange. Ignored for all other operators.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableFilter_AddConditionPtr) (LibMCEnv_DataTableFilter pDataTableFilter, const char * pColumnIdentifier, eLibMCEnvDataTableFilterOperator eOperator, LibMCEnv_double dValue, LibMCEnv_double dUpperValue);
+
+/**
+* Returns the number of conditions of the filter.
+*
+* @param[in] pDataTableFilter - DataTableFilter instance.
+* @param[out] pConditionCount - Number of conditions.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableFilter_GetConditionCountPtr) (LibMCEnv_DataTableFilter pDataTableFilter, LibMCEnv_uint32 * pConditionCount);
+
+/**
+* Returns the column of a condition.
+*
+* @param[in] pDataTableFilter - DataTableFilter instance.
+* @param[in] nIndex - Index of the condition. 0-based.
+* @param[in] nColumnIdentifierBufferSize - size of the buffer (including trailing 0)
+* @param[out] pColumnIdentifierNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pColumnIdentifierBuffer -  buffer of Identifier of the column., may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableFilter_GetConditionColumnPtr) (LibMCEnv_DataTableFilter pDataTableFilter, LibMCEnv_uint32 nIndex, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer);
+
+/**
+* Returns the operator of a condition.
+*
+* @param[in] pDataTableFilter - DataTableFilter instance.
+* @param[in] nIndex - Index of the condition. 0-based.
+* @param[out] pOperator - Comparison operator.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableFilter_GetConditionOperatorPtr) (LibMCEnv_DataTableFilter pDataTableFilter, LibMCEnv_uint32 nIndex, eLibMCEnvDataTableFilterOperator * pOperator);
+
+/**
+* Returns the threshold value of a condition.
+*
+* @param[in] pDataTableFilter - DataTableFilter instance.
+* @param[in] nIndex - Index of the condition. 0-based.
+* @param[out] pValue - Threshold value or lower bound.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableFilter_GetConditionValuePtr) (LibMCEnv_DataTableFilter pDataTableFilter, LibMCEnv_uint32 nIndex, LibMCEnv_double * pValue);
+
+/**
+* Returns the upper bound of a condition.
+*
+* @param[in] pDataTableFilter - DataTableFilter instance.
+* @param[in] nIndex - Index of the condition. 0-based.
+* @param[out] pUpperValue - Upper bound.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableFilter_GetConditionUpperValuePtr) (LibMCEnv_DataTableFilter pDataTableFilter, LibMCEnv_uint32 nIndex, LibMCEnv_double * pUpperValue);
+
+/**
+* Removes all conditions. An empty filter matches all rows.
+*
+* @param[in] pDataTableFilter - DataTableFilter instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableFilter_ClearPtr) (LibMCEnv_DataTableFilter pDataTableFilter);
+
+/*************************************************************************************************************************
+ Class definition for DataTableSortOptions
+*************************************************************************************************************************/
+
+/**
+* Adds a sort key. Rows are ordered by the first key, ties by the following keys. Rows with equal keys keep their original order.
+*
+* @param[in] pDataTableSortOptions - DataTableSortOptions instance.
+* @param[in] pColumnIdentifier - Identifier of the column. Must be alphanumeric and not empty.
+* @param[in] bDescending - If true, the column is sorted in descending order. NaN values are always sorted to the end.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableSortOptions_AddSortColumnPtr) (LibMCEnv_DataTableSortOptions pDataTableSortOptions, const char * pColumnIdentifier, bool bDescending);
+
+/**
+* Returns the number of sort keys.
+*
+* @param[in] pDataTableSortOptions - DataTableSortOptions instance.
+* @param[out] pSortColumnCount - Number of sort keys.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableSortOptions_GetSortColumnCountPtr) (LibMCEnv_DataTableSortOptions pDataTableSortOptions, LibMCEnv_uint32 * pSortColumnCount);
+
+/**
+* Returns the column of a sort key.
+*
+* @param[in] pDataTableSortOptions - DataTableSortOptions instance.
+* @param[in] nIndex - Index of the sort key. 0-based.
+* @param[in] nColumnIdentifierBufferSize - size of the buffer (including trailing 0)
+* @param[out] pColumnIdentifierNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pColumnIdentifierBuffer -  buffer of Identifier of the column., may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableSortOptions_GetSortColumnPtr) (LibMCEnv_DataTableSortOptions pDataTableSortOptions, LibMCEnv_uint32 nIndex, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer);
+
+/**
+* Returns if a sort key is sorted in descending order.
+*
+* @param[in] pDataTableSortOptions - DataTableSortOptions instance.
+* @param[in] nIndex - Index of the sort key. 0-based.
+* @param[out] pDescending - Flag if the column is sorted in descending order.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableSortOptions_GetSortColumnDescendingPtr) (LibMCEnv_DataTableSortOptions pDataTableSortOptions, LibMCEnv_uint32 nIndex, bool * pDescending);
+
+/**
+* Removes all sort keys.
+*
+* @param[in] pDataTableSortOptions - DataTableSortOptions instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableSortOptions_ClearPtr) (LibMCEnv_DataTableSortOptions pDataTableSortOptions);
+
+/*************************************************************************************************************************
+ Class definition for DataTableAggregationOptions
+*************************************************************************************************************************/
+
+/**
+* Adds a column to group by. Rows with equal values in all group columns form a group. Without group columns, all rows form a single group.
+*
+* @param[in] pDataTableAggregationOptions - DataTableAggregationOptions instance.
+* @param[in] pColumnIdentifier - Identifier of the column. Must be alphanumeric and not empty.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableAggregationOptions_AddGroupColumnPtr) (LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions, const char * pColumnIdentifier);
+
+/**
+* Returns the number of group columns.
+*
+* @param[in] pDataTableAggregationOptions - DataTableAggregationOptions instance.
+* @param[out] pGroupColumnCount - Number of group columns.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableAggregationOptions_GetGroupColumnCountPtr) (LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions, LibMCEnv_uint32 * pGroupColumnCount);
+
+/**
+* Returns a group column.
+*
+* @param[in] pDataTableAggregationOptions - DataTableAggregationOptions instance.
+* @param[in] nIndex - Index of the group column. 0-based.
+* @param[in] nColumnIdentifierBufferSize - size of the buffer (including trailing 0)
+* @param[out] pColumnIdentifierNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pColumnIdentifierBuffer -  buffer of Identifier of the column., may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableAggregationOptions_GetGroupColumnPtr) (LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions, LibMCEnv_uint32 nIndex, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer);
+
+/**
+* Adds an aggregated result column. Count results are uint64 columns, all other results are double columns.
+*
+* @param[in] pDataTableAggregationOptions - DataTableAggregationOptions instance.
+* @param[in] pResultIdentifier - Identifier of the result column. MUST be unique, alphanumeric and not empty.
+* @param[in] pColumnIdentifier - Identifier of the column to aggregate. Must be alphanumeric and not empty.
+* @param[in] eAggregation - Aggregation to compute.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableAggregationOptions_AddAggregationPtr) (LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions, const char * pResultIdentifier, const char * pColumnIdentifier, eLibMCEnvDataTableAggregation eAggregation);
+
+/**
+* Returns the number of aggregations.
+*
+* @param[in] pDataTableAggregationOptions - DataTableAggregationOptions instance.
+* @param[out] pAggregationCount - Number of aggregations.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableAggregationOptions_GetAggregationCountPtr) (LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions, LibMCEnv_uint32 * pAggregationCount);
+
+/**
+* Returns the identifier of the result column of an aggregation.
+*
+* @param[in] pDataTableAggregationOptions - DataTableAggregationOptions instance.
+* @param[in] nIndex - Index of the aggregation. 0-based.
+* @param[in] nResultIdentifierBufferSize - size of the buffer (including trailing 0)
+* @param[out] pResultIdentifierNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pResultIdentifierBuffer -  buffer of Identifier of the result column., may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableAggregationOptions_GetAggregationResultIdentifierPtr) (LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions, LibMCEnv_uint32 nIndex, const LibMCEnv_uint32 nResultIdentifierBufferSize, LibMCEnv_uint32* pResultIdentifierNeededChars, char * pResultIdentifierBuffer);
+
+/**
+* Returns the aggregated column of an aggregation.
+*
+* @param[in] pDataTableAggregationOptions - DataTableAggregationOptions instance.
+* @param[in] nIndex - Index of the aggregation. 0-based.
+* @param[in] nColumnIdentifierBufferSize - size of the buffer (including trailing 0)
+* @param[out] pColumnIdentifierNeededChars - will be filled with the count of the written bytes, or needed buffer size.
+* @param[out] pColumnIdentifierBuffer -  buffer of Identifier of the column to aggregate., may be NULL
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableAggregationOptions_GetAggregationColumnPtr) (LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions, LibMCEnv_uint32 nIndex, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer);
+
+/**
+* Returns the aggregation type of an aggregation.
 *
-* @param[in] pDataTableCSVWriteOptions - DataTableCSVWriteOptions instance.
-* @param[in] nSeparatorBufferSize - size of the buffer (including trailing 0)
-* @param[out] pSeparatorNeededChars - will be filled with the count of the written bytes, or needed buffer size.
-* @param[out] pSeparatorBuffer -  buffer of Separator to use., may be NULL
+* @param[in] pDataTableAggregationOptions - DataTableAggregationOptions instance.
+* @param[in] nIndex - Index of the aggregation. 0-based.
+* @param[out] pAggregation - Aggregation to compute.
 * @return error code or 0 (success)
 */
-typedef LibMCEnvResult (*PLibMCEnvDataTableCSVWriteOptions_GetSeparatorPtr) (LibMCEnv_DataTableCSVWriteOptions pDataTableCSVWriteOptions, const LibMCEnv_uint32 nSeparatorBufferSize, LibMCEnv_uint32* pSeparatorNeededChars, char * pSeparatorBuffer);
+typedef LibMCEnvResult (*PLibMCEnvDataTableAggregationOptions_GetAggregationTypePtr) (LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions, LibMCEnv_uint32 nIndex, eLibMCEnvDataTableAggregation * pAggregation);
 
 /**
-* Sets the desired separator of the CSV file.
+* Removes all group columns and aggregations.
 *
-* @param[in] pDataTableCSVWriteOptions - DataTableCSVWriteOptions instance.
-* @param[in] pSeparator - Separator to use. MUST be a single character ASCII string. (ASCII Code 32-127)
+* @param[in] pDataTableAggregationOptions - DataTableAggregationOptions instance.
 * @return error code or 0 (success)
 */
-typedef LibMCEnvResult (*PLibMCEnvDataTableCSVWriteOptions_SetSeparatorPtr) (LibMCEnv_DataTableCSVWriteOptions pDataTableCSVWriteOptions, const char * pSeparator);
+typedef LibMCEnvResult (*PLibMCEnvDataTableAggregationOptions_ClearPtr) (LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions);
 
 /*************************************************************************************************************************
- Class definition for DataTableScatterPlotOptions
-**************************************************************************************************************************/
+ Class definition for DataTableLoadOptions
+*************************************************************************************************************************/
 
 /**
-* Sets the column to use for the X Axis value. Column MUST exist.
+* Adds a column to the loaded columns. If no columns are added, all columns of the stream are loaded.
 *
-* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
+* @param[in] pDataTableLoadOptions - DataTableLoadOptions instance.
 * @param[in] pColumnIdentifier - Identifier of the column. Must be alphanumeric and not empty.
-* @param[in] dScaleFactor - Scale factor to use. The X value will be computed as raw value times scale factor plus offset factor in millimeters.
-* @param[in] dOffsetFactor - Offset factor to use. The X value will be computed as raw value times scale factor plus offset factor in millimeters.
 * @return error code or 0 (success)
 */
-typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_SetXAxisColumnPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const char * pColumnIdentifier, LibMCEnv_double dScaleFactor, LibMCEnv_double dOffsetFactor);
+typedef LibMCEnvResult (*PLibMCEnvDataTableLoadOptions_AddColumnPtr) (LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, const char * pColumnIdentifier);
 
 /**
-* Returns the column to use for the X Axis value..
+* Returns the number of columns that have been added.
 *
-* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
+* @param[in] pDataTableLoadOptions - DataTableLoadOptions instance.
+* @param[out] pColumnCount - Number of columns. 0 loads all columns.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableLoadOptions_GetColumnCountPtr) (LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, LibMCEnv_uint32 * pColumnCount);
+
+/**
+* Returns a column that has been added.
+*
+* @param[in] pDataTableLoadOptions - DataTableLoadOptions instance.
+* @param[in] nIndex - Index of the column. 0-based.
 * @param[in] nColumnIdentifierBufferSize - size of the buffer (including trailing 0)
 * @param[out] pColumnIdentifierNeededChars - will be filled with the count of the written bytes, or needed buffer size.
-* @param[out] pColumnIdentifierBuffer -  buffer of Identifier of the column. Empty if not set yet., may be NULL
+* @param[out] pColumnIdentifierBuffer -  buffer of Identifier of the column., may be NULL
 * @return error code or 0 (success)
 */
-typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_GetXAxisColumnPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer);
+typedef LibMCEnvResult (*PLibMCEnvDataTableLoadOptions_GetColumnPtr) (LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, LibMCEnv_uint32 nIndex, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer);
 
 /**
-* Returns the scaling for the X Axis value..
+* Removes all columns, so that all columns of the stream are loaded.
 *
-* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
-* @param[out] pScaleFactor - Scale factor to use. The X value will be computed as raw value times scale factor plus offset factor in millimeters. Default is 1.0.
+* @param[in] pDataTableLoadOptions - DataTableLoadOptions instance.
 * @return error code or 0 (success)
 */
-typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_GetXAxisScalingPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, LibMCEnv_double * pScaleFactor);
+typedef LibMCEnvResult (*PLibMCEnvDataTableLoadOptions_ClearColumnsPtr) (LibMCEnv_DataTableLoadOptions pDataTableLoadOptions);
 
 /**
-* Returns the scaling for the X Axis value..
+* Only loads a range of rows of every column.
 *
-* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
-* @param[out] pOffsetFactor - Offset factor to use. The X value will be computed as raw value times scale factor plus offset factor in millimeters. Default is 0.0.
+* @param[in] pDataTableLoadOptions - DataTableLoadOptions instance.
+* @param[in] nFirstRow - First row to load. 0-based.
+* @param[in] nRowCount - Number of rows to load. Columns that end earlier are shortened accordingly.
 * @return error code or 0 (success)
 */
-typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_GetXAxisOffsetPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, LibMCEnv_double * pOffsetFactor);
+typedef LibMCEnvResult (*PLibMCEnvDataTableLoadOptions_SetRowRangePtr) (LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, LibMCEnv_uint64 nFirstRow, LibMCEnv_uint64 nRowCount);
 
 /**
-* Sets the column to use for the Y Axis value. Column MUST exist.
+* Returns if only a range of rows is loaded.
 *
-* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
-* @param[in] pColumnIdentifier - Identifier of the column. Must be alphanumeric and not empty.
-* @param[in] dScaleFactor - Scale factor to use. The Y value will be computed as raw value times scale factor plus offset factor in millimeters.
-* @param[in] dOffsetFactor - Offset factor to use. The Y value will be computed as raw value times scale factor plus offset factor in millimeters.
+* @param[in] pDataTableLoadOptions - DataTableLoadOptions instance.
+* @param[out] pHasRowRange - True if a row range has been set.
 * @return error code or 0 (success)
 */
-typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_SetYAxisColumnPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const char * pColumnIdentifier, LibMCEnv_double dScaleFactor, LibMCEnv_double dOffsetFactor);
+typedef LibMCEnvResult (*PLibMCEnvDataTableLoadOptions_HasRowRangePtr) (LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, bool * pHasRowRange);
 
 /**
-* Returns the column to use for the X Axis value..
+* Returns the first row of the row range.
 *
-* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
-* @param[in] nColumnIdentifierBufferSize - size of the buffer (including trailing 0)
-* @param[out] pColumnIdentifierNeededChars - will be filled with the count of the written bytes, or needed buffer size.
-* @param[out] pColumnIdentifierBuffer -  buffer of Identifier of the column. Empty if not set yet., may be NULL
+* @param[in] pDataTableLoadOptions - DataTableLoadOptions instance.
+* @param[out] pFirstRow - First row to load. 0 if no row range has been set.
 * @return error code or 0 (success)
 */
-typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_GetYAxisColumnPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer);
+typedef LibMCEnvResult (*PLibMCEnvDataTableLoadOptions_GetFirstRowPtr) (LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, LibMCEnv_uint64 * pFirstRow);
 
 /**
-* Returns the scaling for the X Axis value..
+* Returns the number of rows of the row range.
 *
-* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
-* @param[out] pScaleFactor - Scale factor to use. The X value will be computed as raw value times scale factor plus offset factor in millimeters. Default is 1.0.
+* @param[in] pDataTableLoadOptions - DataTableLoadOptions instance.
+* @param[out] pRowCount - Number of rows to load. 0 if no row range has been set.
 * @return error code or 0 (success)
 */
-typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_GetYAxisScalingPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, LibMCEnv_double * pScaleFactor);
+typedef LibMCEnvResult (*PLibMCEnvDataTableLoadOptions_GetRowCountPtr) (LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, LibMCEnv_uint64 * pRowCount);
 
 /**
-* Returns the scaling for the X Axis value..
+* Loads all rows of every column.
 *
-* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
-* @param[out] pOffsetFactor - Offset factor to use. The X value will be computed as raw value times scale factor plus offset factor in millimeters. Default is 0.0.
+* @param[in] pDataTableLoadOptions - DataTableLoadOptions instance.
 * @return error code or 0 (success)
 */
-typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_GetYAxisOffsetPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, LibMCEnv_double * pOffsetFactor);
+typedef LibMCEnvResult (*PLibMCEnvDataTableLoadOptions_ClearRowRangePtr) (LibMCEnv_DataTableLoadOptions pDataTableLoadOptions);
 
 /**
-* Adds a data channel. Column MUST exist.
+* Sets if the column data is only read from the stream when a column is accessed for the first time. The data table keeps a reference to the stream in that case.
 *
-* @param[in] pDataTableScatterPlotOptions - DataTableScatterPlotOptions instance.
-* @param[in] pChannelIdentifier - Identifier of the channel. Must be alphanumeric and not empty.
-* @param[in] pColumnIdentifier - Identifier of the column to use. Must be alphanumeric and not empty.
-* @param[in] dScaleFactor - Scale factor to use. The channel value will be computed as raw value times scale factor plus offset factor.
-* @param[in] dOffsetFactor - Offset factor to use. The channel value will be computed as raw value times scale factor plus offset factor.
-* @param[in] nColor - Base color to use.
+* @param[in] pDataTableLoadOptions - DataTableLoadOptions instance.
+* @param[in] bLazyLoading - True reads columns on first access, false reads all columns at once. Default is true.
 * @return error code or 0 (success)
 */
-typedef LibMCEnvResult (*PLibMCEnvDataTableScatterPlotOptions_AddDataChannelPtr) (LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const char * pChannelIdentifier, const char * pColumnIdentifier, LibMCEnv_double dScaleFactor, LibMCEnv_double dOffsetFactor, LibMCEnv_uint32 nColor);
+typedef LibMCEnvResult (*PLibMCEnvDataTableLoadOptions_SetLazyLoadingPtr) (LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, bool bLazyLoading);
+
+/**
+* Returns if the column data is only read from the stream when a column is accessed for the first time.
+*
+* @param[in] pDataTableLoadOptions - DataTableLoadOptions instance.
+* @param[out] pLazyLoading - True if columns are read on first access.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTableLoadOptions_GetLazyLoadingPtr) (LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, bool * pLazyLoading);
 
 /*************************************************************************************************************************
  Class definition for DataTable
@@ -1349,6 +1951,181 @@ typedef LibMCEnvResult (*PLibMCEnvDataTable_CreateScatterPlotOptionsPtr) (LibMCE
 */
 typedef LibMCEnvResult (*PLibMCEnvDataTable_CalculateScatterPlotPtr) (LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableScatterPlotOptions pScatterPlotOptions, LibMCEnv_ScatterPlot * pScatterPlot);
 
+/**
+* Returns the number of threads that queries on the data table may use.
+*
+* @param[in] pDataTable - DataTable instance.
+* @param[out] pThreadCount - Number of threads. 0 uses the number of hardware threads.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTable_GetThreadCountPtr) (LibMCEnv_DataTable pDataTable, LibMCEnv_uint32 * pThreadCount);
+
+/**
+* Sets the number of threads that queries on the data table may use. Small tables are always processed on the calling thread. Results do not depend on the thread count.
+*
+* @param[in] pDataTable - DataTable instance.
+* @param[in] nThreadCount - Number of threads. 0 uses the number of hardware threads. MUST not be larger than 64. Default is 0.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTable_SetThreadCountPtr) (LibMCEnv_DataTable pDataTable, LibMCEnv_uint32 nThreadCount);
+
+/**
+* Creates an empty row filter.
+*
+* @param[in] pDataTable - DataTable instance.
+* @param[out] pFilter - Filter instance to pass on to FindRows or FilterRows.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTable_CreateFilterPtr) (LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableFilter * pFilter);
+
+/**
+* Returns the indices of all rows that fulfil all conditions of a filter.
+*
+* @param[in] pDataTable - DataTable instance.
+* @param[in] pFilter - Filter to apply.
+* @param[in] nRowIndicesBufferSize - Number of elements in buffer
+* @param[out] pRowIndicesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pRowIndicesBuffer - uint32  buffer of Indices of the matching rows in ascending order.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTable_FindRowsPtr) (LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableFilter pFilter, const LibMCEnv_uint64 nRowIndicesBufferSize, LibMCEnv_uint64* pRowIndicesNeededCount, LibMCEnv_uint32 * pRowIndicesBuffer);
+
+/**
+* Creates a new data table with all rows that fulfil all conditions of a filter.
+*
+* @param[in] pDataTable - DataTable instance.
+* @param[in] pFilter - Filter to apply.
+* @param[out] pResult - New data table with the same columns and the matching rows.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTable_FilterRowsPtr) (LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableFilter pFilter, LibMCEnv_DataTable * pResult);
+
+/**
+* Creates a new data table from a selection of rows.
+*
+* @param[in] pDataTable - DataTable instance.
+* @param[in] nRowIndicesBufferSize - Number of elements in buffer
+* @param[in] pRowIndicesBuffer - uint32 buffer of Indices of the rows to copy. Rows may appear in any order and more than once. MUST be smaller than the row count.
+* @param[out] pResult - New data table with the same columns and the selected rows.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTable_SelectRowsPtr) (LibMCEnv_DataTable pDataTable, LibMCEnv_uint64 nRowIndicesBufferSize, const LibMCEnv_uint32 * pRowIndicesBuffer, LibMCEnv_DataTable * pResult);
+
+/**
+* Creates an options object for sorting.
+*
+* @param[in] pDataTable - DataTable instance.
+* @param[out] pSortOptions - Sort options instance to pass on to GetSortedRowIndices or SortRows.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTable_CreateSortOptionsPtr) (LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableSortOptions * pSortOptions);
+
+/**
+* Returns the row order of a stable sort. The data table is not modified.
+*
+* @param[in] pDataTable - DataTable instance.
+* @param[in] pSortOptions - Sort options to use.
+* @param[in] nRowIndicesBufferSize - Number of elements in buffer
+* @param[out] pRowIndicesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pRowIndicesBuffer - uint32  buffer of Row indices in sorted order.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTable_GetSortedRowIndicesPtr) (LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableSortOptions pSortOptions, const LibMCEnv_uint64 nRowIndicesBufferSize, LibMCEnv_uint64* pRowIndicesNeededCount, LibMCEnv_uint32 * pRowIndicesBuffer);
+
+/**
+* Creates a new data table with the rows in stable sorted order.
+*
+* @param[in] pDataTable - DataTable instance.
+* @param[in] pSortOptions - Sort options to use.
+* @param[out] pResult - New data table with the same columns and sorted rows.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTable_SortRowsPtr) (LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableSortOptions pSortOptions, LibMCEnv_DataTable * pResult);
+
+/**
+* Creates an options object for grouping and aggregation.
+*
+* @param[in] pDataTable - DataTable instance.
+* @param[out] pAggregationOptions - Aggregation options instance to pass on to Aggregate.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTable_CreateAggregationOptionsPtr) (LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableAggregationOptions * pAggregationOptions);
+
+/**
+* Groups the rows and computes aggregated values per group. NaN values propagate into Sum, Minimum, Maximum and Mean.
+*
+* @param[in] pDataTable - DataTable instance.
+* @param[in] pAggregationOptions - Aggregation options to use.
+* @param[out] pResult - New data table with one row per group, ordered ascending by the group columns. Contains the group columns followed by the aggregation results.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTable_AggregatePtr) (LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableAggregationOptions pAggregationOptions, LibMCEnv_DataTable * pResult);
+
+/**
+* Adds a double column with a statistic over a trailing window of rows of another column. The first rows use the rows that are available. Windows that contain NaN result in NaN.
+*
+* @param[in] pDataTable - DataTable instance.
+* @param[in] pColumnIdentifier - Identifier of the source column.
+* @param[in] pResultIdentifier - Identifier of the new column. MUST be unique, alphanumeric and not empty.
+* @param[in] pDescription - Description of the new column.
+* @param[in] eStatistic - Statistic to compute.
+* @param[in] nWindowSize - Number of rows of the window, including the current row. MUST be at least 1.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTable_AddWindowStatisticColumnPtr) (LibMCEnv_DataTable pDataTable, const char * pColumnIdentifier, const char * pResultIdentifier, const char * pDescription, eLibMCEnvDataTableWindowStatistic eStatistic, LibMCEnv_uint32 nWindowSize);
+
+/**
+* Creates an options object for loading a data table from a stream.
+*
+* @param[in] pDataTable - DataTable instance.
+* @param[out] pOptions - Load options instance. Loads all rows of all columns lazily by default.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTable_CreateLoadOptionsPtr) (LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableLoadOptions * pOptions);
+
+/**
+* Loads the data table from a stream. Clears all existing data from the data table. Only reads the column directory, if lazy loading is enabled.
+*
+* @param[in] pDataTable - DataTable instance.
+* @param[in] pStream - Stream read instance to read from.
+* @param[in] pOptions - Load options.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTable_LoadFromStreamWithOptionsPtr) (LibMCEnv_DataTable pDataTable, LibMCEnv_StreamReader pStream, LibMCEnv_DataTableLoadOptions pOptions);
+
+/**
+* Returns if the values of a column are in memory. Columns of lazily loaded tables are read on first access of their values.
+*
+* @param[in] pDataTable - DataTable instance.
+* @param[in] pIdentifier - Identifier of the column. Fails if column does not exist.
+* @param[out] pIsLoaded - True if the values are in memory.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTable_IsColumnLoadedPtr) (LibMCEnv_DataTable pDataTable, const char * pIdentifier, bool * pIsLoaded);
+
+/**
+* Adds a double column, whose values are stored as raw int32 values. The double values are computed as raw value * ScaleFactor + Offset, when the values of the column are accessed the first time.
+*
+* @param[in] pDataTable - DataTable instance.
+* @param[in] pIdentifier - Identifier of the column. MUST be unique, alphanumeric and not empty.
+* @param[in] pDescription - Description of the column.
+* @param[in] dScaleFactor - Factor the raw values are multiplied with.
+* @param[in] dOffset - Offset that is added to the scaled values.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTable_AddScaledInt32ColumnPtr) (LibMCEnv_DataTable pDataTable, const char * pIdentifier, const char * pDescription, LibMCEnv_double dScaleFactor, LibMCEnv_double dOffset);
+
+/**
+* Appends raw values to a scaled int32 column. Will fail if column does not exist, has not been added with AddScaledInt32Column or if its values have been accessed already.
+*
+* @param[in] pDataTable - DataTable instance.
+* @param[in] pIdentifier - Identifier of the column.
+* @param[in] nValuesBufferSize - Number of elements in buffer
+* @param[in] pValuesBuffer - int32 buffer of Raw values to append.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvDataTable_AppendScaledInt32ColumnValuesPtr) (LibMCEnv_DataTable pDataTable, const char * pIdentifier, LibMCEnv_uint64 nValuesBufferSize, const LibMCEnv_int32 * pValuesBuffer);
+
 /*************************************************************************************************************************
  Class definition for DataSeries
 **************************************************************************************************************************/
@@ -2106,6 +2883,74 @@ typedef LibMCEnvResult (*PLibMCEnvMeshObject_GetTriangleIDsPtr) (LibMCEnv_MeshOb
 */
 typedef LibMCEnvResult (*PLibMCEnvMeshObject_GetAllTrianglesPtr) (LibMCEnv_MeshObject pMeshObject, const LibMCEnv_uint64 nTrianglesBufferSize, LibMCEnv_uint64* pTrianglesNeededCount, LibMCEnv::sMeshTriangle3D * pTrianglesBuffer);
 
+/**
+* Builds the bounding volume hierarchy that accelerates the spatial queries of the mesh. The index of a persistent mesh is shared by all its instances and is released when the mesh is unloaded. Spatial queries build the index on first use if it does not exist.
+*
+* @param[in] pMeshObject - MeshObject instance.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvMeshObject_BuildSpatialIndexPtr) (LibMCEnv_MeshObject pMeshObject);
+
+/**
+* Returns if the spatial index of the mesh has already been built.
+*
+* @param[in] pMeshObject - MeshObject instance.
+* @param[out] pValue - Returns true if the spatial index exists.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvMeshObject_HasSpatialIndexPtr) (LibMCEnv_MeshObject pMeshObject, bool * pValue);
+
+/**
+* Returns the first triangle hit by a ray.
+*
+* @param[in] pMeshObject - MeshObject instance.
+* @param[in] dOriginX - X coordinate of the ray origin.
+* @param[in] dOriginY - Y coordinate of the ray origin.
+* @param[in] dOriginZ - Z coordinate of the ray origin.
+* @param[in] dDirectionX - X coordinate of the ray direction. Does not need to be normalized.
+* @param[in] dDirectionY - Y coordinate of the ray direction. Does not need to be normalized.
+* @param[in] dDirectionZ - Z coordinate of the ray direction. Does not need to be normalized.
+* @param[out] pTriangleID - ID of the hit triangle. 0 if there is no hit.
+* @param[out] pDistance - Distance of the hit point from the ray origin. 0 if there is no hit.
+* @param[out] pHit - Returns true if the ray hits the mesh.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvMeshObject_CastRayPtr) (LibMCEnv_MeshObject pMeshObject, LibMCEnv_double dOriginX, LibMCEnv_double dOriginY, LibMCEnv_double dOriginZ, LibMCEnv_double dDirectionX, LibMCEnv_double dDirectionY, LibMCEnv_double dDirectionZ, LibMCEnv_uint32 * pTriangleID, LibMCEnv_double * pDistance, bool * pHit);
+
+/**
+* Returns all triangles that intersect an axis aligned box. Triangles touching the boundary of the box are included.
+*
+* @param[in] pMeshObject - MeshObject instance.
+* @param[in] dMinX - Minimum X coordinate of the box.
+* @param[in] dMinY - Minimum Y coordinate of the box.
+* @param[in] dMinZ - Minimum Z coordinate of the box.
+* @param[in] dMaxX - Maximum X coordinate of the box.
+* @param[in] dMaxY - Maximum Y coordinate of the box.
+* @param[in] dMaxZ - Maximum Z coordinate of the box.
+* @param[in] nTriangleIDsBufferSize - Number of elements in buffer
+* @param[out] pTriangleIDsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pTriangleIDsBuffer - uint32  buffer of Triangle IDs in ascending order.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvMeshObject_FindTrianglesInBoxPtr) (LibMCEnv_MeshObject pMeshObject, LibMCEnv_double dMinX, LibMCEnv_double dMinY, LibMCEnv_double dMinZ, LibMCEnv_double dMaxX, LibMCEnv_double dMaxY, LibMCEnv_double dMaxZ, const LibMCEnv_uint64 nTriangleIDsBufferSize, LibMCEnv_uint64* pTriangleIDsNeededCount, LibMCEnv_uint32 * pTriangleIDsBuffer);
+
+/**
+* Returns the point on the mesh surface that is closest to a given point.
+*
+* @param[in] pMeshObject - MeshObject instance.
+* @param[in] dX - X coordinate of the query point.
+* @param[in] dY - Y coordinate of the query point.
+* @param[in] dZ - Z coordinate of the query point.
+* @param[out] pTriangleID - ID of the triangle that contains the closest point. 0 if the mesh has no triangles.
+* @param[out] pClosestX - X coordinate of the closest point.
+* @param[out] pClosestY - Y coordinate of the closest point.
+* @param[out] pClosestZ - Z coordinate of the closest point.
+* @param[out] pDistance - Distance of the closest point from the query point.
+* @param[out] pFound - Returns false if the mesh has no triangles.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvMeshObject_FindClosestPointPtr) (LibMCEnv_MeshObject pMeshObject, LibMCEnv_double dX, LibMCEnv_double dY, LibMCEnv_double dZ, LibMCEnv_uint32 * pTriangleID, LibMCEnv_double * pClosestX, LibMCEnv_double * pClosestY, LibMCEnv_double * pClosestZ, LibMCEnv_double * pDistance, bool * pFound);
+
 /**
 * Returns if the mesh object is persisted in memory.
 *
@@ -3094,6 +3939,88 @@ typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_CalculateExtentsPtr) (LibMCEnv_T
 */
 typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_CalculateExtentsInMMPtr) (LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_double * pMinX, LibMCEnv_double * pMinY, LibMCEnv_double * pMaxX, LibMCEnv_double * pMaxY);
 
+/**
+* Returns the layer local ID of a profile value for ExportProfileValueColumns. IDs are assigned when the layer is loaded, so the layer is not modified.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] pNamespace - Namespace of the profile value.
+* @param[in] pValueName - Name of the profile value.
+* @param[out] pValueID - ID of the profile value. 0 if no profile of the layer contains the value.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_FindProfileValueIDPtr) (LibMCEnv_ToolpathLayer pToolpathLayer, const char * pNamespace, const char * pValueName, LibMCEnv_uint32 * pValueID);
+
+/**
+* Exports the segment information of the whole layer in one call. Each array has one entry per segment.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nSegmentTypesBufferSize - Number of elements in buffer
+* @param[out] pSegmentTypesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pSegmentTypesBuffer - uint32  buffer of Segment type of each segment, as ToolpathSegmentType value.
+* @param[in] nPointOffsetsBufferSize - Number of elements in buffer
+* @param[out] pPointOffsetsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pPointOffsetsBuffer - uint32  buffer of Index of the first point of each segment in ExportPointData. Has one additional entry with the total point count, so the point count of segment i is PointOffsets[i + 1] - PointOffsets[i].
+* @param[in] nLocalPartIDsBufferSize - Number of elements in buffer
+* @param[out] pLocalPartIDsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pLocalPartIDsBuffer - uint32  buffer of Local part ID of each segment.
+* @param[in] nProfileIDsBufferSize - Number of elements in buffer
+* @param[out] pProfileIDsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pProfileIDsBuffer - uint32  buffer of Layer local profile ID of each segment. Segments with equal IDs share the same profile. 0 if the segment has no profile.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_ExportSegmentTablePtr) (LibMCEnv_ToolpathLayer pToolpathLayer, const LibMCEnv_uint64 nSegmentTypesBufferSize, LibMCEnv_uint64* pSegmentTypesNeededCount, LibMCEnv_uint32 * pSegmentTypesBuffer, const LibMCEnv_uint64 nPointOffsetsBufferSize, LibMCEnv_uint64* pPointOffsetsNeededCount, LibMCEnv_uint32 * pPointOffsetsBuffer, const LibMCEnv_uint64 nLocalPartIDsBufferSize, LibMCEnv_uint64* pLocalPartIDsNeededCount, LibMCEnv_uint32 * pLocalPartIDsBuffer, const LibMCEnv_uint64 nProfileIDsBufferSize, LibMCEnv_uint64* pProfileIDsNeededCount, LibMCEnv_uint32 * pProfileIDsBuffer);
+
+/**
+* Exports profile values of all segments in one call. Values are resolved once per profile, not per segment. Values that are not numeric are exported as NaN.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nColumnsBufferSize - Number of elements in buffer
+* @param[in] pColumnsBuffer - ToolpathProfileValueColumn buffer of Columns to export. JumpSpeed falls back to Speed, as in GetSegmentProfileTypedValue.
+* @param[in] nValuesBufferSize - Number of elements in buffer
+* @param[out] pValuesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pValuesBuffer - double  buffer of Segment major value table with SegmentCount * ColumnCount entries. The value of column c of segment i is at index i * ColumnCount + c.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_ExportProfileValueColumnsPtr) (LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint64 nColumnsBufferSize, const sLibMCEnvToolpathProfileValueColumn * pColumnsBuffer, const LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_double * pValuesBuffer);
+
+/**
+* Exports integer custom segment attributes of all segments in one call. Fails if an attribute does not exist or is not an integer attribute.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nAttributeIDsBufferSize - Number of elements in buffer
+* @param[in] pAttributeIDsBuffer - uint32 buffer of IDs of the attributes to export.
+* @param[in] nValuesBufferSize - Number of elements in buffer
+* @param[out] pValuesNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pValuesBuffer - int64  buffer of Segment major value table with SegmentCount * AttributeCount entries.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_ExportSegmentIntegerAttributesPtr) (LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint64 nAttributeIDsBufferSize, const LibMCEnv_uint32 * pAttributeIDsBuffer, const LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_int64 * pValuesBuffer);
+
+/**
+* Exports the points of all segments in one call. For type hatch, the points are taken pairwise.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] nPointDataBufferSize - Number of elements in buffer
+* @param[out] pPointDataNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pPointDataBuffer - Position2D  buffer of The point data array of the layer. Positions are absolute in units.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_ExportPointDataPtr) (LibMCEnv_ToolpathLayer pToolpathLayer, const LibMCEnv_uint64 nPointDataBufferSize, LibMCEnv_uint64* pPointDataNeededCount, sLibMCEnvPosition2D * pPointDataBuffer);
+
+/**
+* Encodes the whole layer in the binary tile format of the api/build/toolpathbinary request and returns the size and timings of the encoding. The tile tree is built for every call and not cached.
+*
+* @param[in] pToolpathLayer - ToolpathLayer instance.
+* @param[in] dResolutionInMM - Display resolution in mm. Primitives smaller than the resolution are skipped and coordinates are quantised to half of it. 0 encodes all points without quantisation.
+* @param[out] pEncodedSize - Size of the binary response in bytes.
+* @param[out] pTileCount - Number of tiles in the response.
+* @param[out] pPointCount - Number of encoded points.
+* @param[out] pTreeBuildTimeInMicroseconds - Time needed to build the tile tree.
+* @param[out] pEncodingTimeInMicroseconds - Time needed to encode the response.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvToolpathLayer_EncodeBinaryTilesPtr) (LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_double dResolutionInMM, LibMCEnv_uint64 * pEncodedSize, LibMCEnv_uint32 * pTileCount, LibMCEnv_uint64 * pPointCount, LibMCEnv_uint64 * pTreeBuildTimeInMicroseconds, LibMCEnv_uint64 * pEncodingTimeInMicroseconds);
+
 /*************************************************************************************************************************
  Class definition for ToolpathAccessor
 **************************************************************************************************************************/
@@ -7866,6 +8793,22 @@ typedef LibMCEnvResult (*PLibMCEnvStateEnvironment_GetBuildExecutionPtr) (LibMCE
 */
 typedef LibMCEnvResult (*PLibMCEnvStateEnvironment_UnloadAllToolpathesPtr) (LibMCEnv_StateEnvironment pStateEnvironment);
 
+/**
+* Generates a reproducible random toolpath, stores it as temporary 3MF stream and loads it into memory. Even segments are hatches, odd segments are loops. Meant for tests and benchmarks of toolpath consumers.
+*
+* @param[in] pStateEnvironment - StateEnvironment instance.
+* @param[in] pName - Name of the storage stream.
+* @param[in] nLayerCount - Number of layers. MUST be positive.
+* @param[in] nSegmentsPerLayer - Number of segments per layer. MUST be positive.
+* @param[in] nPointsPerSegment - Number of points per segment. MUST be at least 3. Hatch segments use the next lower even number.
+* @param[in] nProfileCount - Number of profiles that the segments cycle through. MUST be positive.
+* @param[in] nLaserIndex - Laser index that all profiles are assigned to.
+* @param[in] nSeed - Seed of the random geometry.
+* @param[out] pToolpathInstance - Accessor of the loaded toolpath. The toolpath stays in memory until UnloadAllToolpathes is called.
+* @return error code or 0 (success)
+*/
+typedef LibMCEnvResult (*PLibMCEnvStateEnvironment_CreateSyntheticToolpathPtr) (LibMCEnv_StateEnvironment pStateEnvironment, const char * pName, LibMCEnv_uint32 nLayerCount, LibMCEnv_uint32 nSegmentsPerLayer, LibMCEnv_uint32 nPointsPerSegment, LibMCEnv_uint32 nProfileCount, LibMCEnv_uint32 nLaserIndex, LibMCEnv_uint32 nSeed, LibMCEnv_ToolpathAccessor * pToolpathInstance);
+
 /**
 * sets the next state
 *
@@ -9477,6 +10420,14 @@ typedef struct {
 	PLibMCEnvPNGImageStoreOptions_ResetToDefaultsPtr m_PNGImageStoreOptions_ResetToDefaults;
 	PLibMCEnvPNGImageStoreOptions_GetStorageFormatPtr m_PNGImageStoreOptions_GetStorageFormat;
 	PLibMCEnvPNGImageStoreOptions_SetStorageFormatPtr m_PNGImageStoreOptions_SetStorageFormat;
+	PLibMCEnvPNGImageStoreOptions_GetCompressionLevelPtr m_PNGImageStoreOptions_GetCompressionLevel;
+	PLibMCEnvPNGImageStoreOptions_SetCompressionLevelPtr m_PNGImageStoreOptions_SetCompressionLevel;
+	PLibMCEnvPNGImageStoreOptions_GetFilterStrategyPtr m_PNGImageStoreOptions_GetFilterStrategy;
+	PLibMCEnvPNGImageStoreOptions_SetFilterStrategyPtr m_PNGImageStoreOptions_SetFilterStrategy;
+	PLibMCEnvPNGImageStoreOptions_GetEncoderBackendPtr m_PNGImageStoreOptions_GetEncoderBackend;
+	PLibMCEnvPNGImageStoreOptions_SetEncoderBackendPtr m_PNGImageStoreOptions_SetEncoderBackend;
+	PLibMCEnvPNGImageStoreOptions_GetThreadCountPtr m_PNGImageStoreOptions_GetThreadCount;
+	PLibMCEnvPNGImageStoreOptions_SetThreadCountPtr m_PNGImageStoreOptions_SetThreadCount;
 	PLibMCEnvPNGImageData_GetSizeInPixelsPtr m_PNGImageData_GetSizeInPixels;
 	PLibMCEnvPNGImageData_GetPNGDataStreamPtr m_PNGImageData_GetPNGDataStream;
 	PLibMCEnvPNGImageData_WriteToStreamPtr m_PNGImageData_WriteToStream;
@@ -9514,6 +10465,7 @@ typedef struct {
 	PLibMCEnvScatterPlot_GetPointCountPtr m_ScatterPlot_GetPointCount;
 	PLibMCEnvScatterPlot_GetPointPositionPtr m_ScatterPlot_GetPointPosition;
 	PLibMCEnvScatterPlot_GetBoundariesPtr m_ScatterPlot_GetBoundaries;
+	PLibMCEnvScatterPlot_QueryDensityPtr m_ScatterPlot_QueryDensity;
 	PLibMCEnvScatterPlot_ReleasePtr m_ScatterPlot_Release;
 	PLibMCEnvDiscreteFieldData2DStoreOptions_ResetToDefaultsPtr m_DiscreteFieldData2DStoreOptions_ResetToDefaults;
 	PLibMCEnvDiscreteFieldData2D_GetDPIPtr m_DiscreteFieldData2D_GetDPI;
@@ -9538,6 +10490,26 @@ typedef struct {
 	PLibMCEnvDiscreteFieldData2D_TransformFieldPtr m_DiscreteFieldData2D_TransformField;
 	PLibMCEnvDiscreteFieldData2D_AddFieldPtr m_DiscreteFieldData2D_AddField;
 	PLibMCEnvDiscreteFieldData2D_DuplicatePtr m_DiscreteFieldData2D_Duplicate;
+	PLibMCEnvDiscreteFieldData2D_GetStoragePrecisionPtr m_DiscreteFieldData2D_GetStoragePrecision;
+	PLibMCEnvDiscreteFieldData2D_SetStoragePrecisionPtr m_DiscreteFieldData2D_SetStoragePrecision;
+	PLibMCEnvDiscreteFieldData2D_GetStorageLayoutPtr m_DiscreteFieldData2D_GetStorageLayout;
+	PLibMCEnvDiscreteFieldData2D_SetStorageLayoutPtr m_DiscreteFieldData2D_SetStorageLayout;
+	PLibMCEnvDiscreteFieldData2D_GetStorageSizePtr m_DiscreteFieldData2D_GetStorageSize;
+	PLibMCEnvDiscreteFieldData2D_CompactPtr m_DiscreteFieldData2D_Compact;
+	PLibMCEnvDiscreteFieldData2D_GetThreadCountPtr m_DiscreteFieldData2D_GetThreadCount;
+	PLibMCEnvDiscreteFieldData2D_SetThreadCountPtr m_DiscreteFieldData2D_SetThreadCount;
+	PLibMCEnvDiscreteFieldData2D_SetSIMDKernelsEnabledPtr m_DiscreteFieldData2D_SetSIMDKernelsEnabled;
+	PLibMCEnvDiscreteFieldData2D_GetSIMDKernelNamePtr m_DiscreteFieldData2D_GetSIMDKernelName;
+	PLibMCEnvDataTableWriteOptions_ResetToDefaultsPtr m_DataTableWriteOptions_ResetToDefaults;
+	PLibMCEnvDataTableWriteOptions_GetDefaultEncodingPtr m_DataTableWriteOptions_GetDefaultEncoding;
+	PLibMCEnvDataTableWriteOptions_SetDefaultEncodingPtr m_DataTableWriteOptions_SetDefaultEncoding;
+	PLibMCEnvDataTableWriteOptions_GetColumnEncodingPtr m_DataTableWriteOptions_GetColumnEncoding;
+	PLibMCEnvDataTableWriteOptions_SetColumnEncodingPtr m_DataTableWriteOptions_SetColumnEncoding;
+	PLibMCEnvDataTableWriteOptions_ClearColumnEncodingsPtr m_DataTableWriteOptions_ClearColumnEncodings;
+	PLibMCEnvDataTableWriteOptions_GetCompressionPtr m_DataTableWriteOptions_GetCompression;
+	PLibMCEnvDataTableWriteOptions_SetCompressionPtr m_DataTableWriteOptions_SetCompression;
+	PLibMCEnvDataTableWriteOptions_GetCompressionLevelPtr m_DataTableWriteOptions_GetCompressionLevel;
+	PLibMCEnvDataTableWriteOptions_SetCompressionLevelPtr m_DataTableWriteOptions_SetCompressionLevel;
 	PLibMCEnvDataTableCSVWriteOptions_GetSeparatorPtr m_DataTableCSVWriteOptions_GetSeparator;
 	PLibMCEnvDataTableCSVWriteOptions_SetSeparatorPtr m_DataTableCSVWriteOptions_SetSeparator;
 	PLibMCEnvDataTableScatterPlotOptions_SetXAxisColumnPtr m_DataTableScatterPlotOptions_SetXAxisColumn;
@@ -9549,6 +10521,38 @@ typedef struct {
 	PLibMCEnvDataTableScatterPlotOptions_GetYAxisScalingPtr m_DataTableScatterPlotOptions_GetYAxisScaling;
 	PLibMCEnvDataTableScatterPlotOptions_GetYAxisOffsetPtr m_DataTableScatterPlotOptions_GetYAxisOffset;
 	PLibMCEnvDataTableScatterPlotOptions_AddDataChannelPtr m_DataTableScatterPlotOptions_AddDataChannel;
+	PLibMCEnvDataTableFilter_AddConditionPtr m_DataTableFilter_AddCondition;
+	PLibMCEnvDataTableFilter_GetConditionCountPtr m_DataTableFilter_GetConditionCount;
+	PLibMCEnvDataTableFilter_GetConditionColumnPtr m_DataTableFilter_GetConditionColumn;
+	PLibMCEnvDataTableFilter_GetConditionOperatorPtr m_DataTableFilter_GetConditionOperator;
+	PLibMCEnvDataTableFilter_GetConditionValuePtr m_DataTableFilter_GetConditionValue;
+	PLibMCEnvDataTableFilter_GetConditionUpperValuePtr m_DataTableFilter_GetConditionUpperValue;
+	PLibMCEnvDataTableFilter_ClearPtr m_DataTableFilter_Clear;
+	PLibMCEnvDataTableSortOptions_AddSortColumnPtr m_DataTableSortOptions_AddSortColumn;
+	PLibMCEnvDataTableSortOptions_GetSortColumnCountPtr m_DataTableSortOptions_GetSortColumnCount;
+	PLibMCEnvDataTableSortOptions_GetSortColumnPtr m_DataTableSortOptions_GetSortColumn;
+	PLibMCEnvDataTableSortOptions_GetSortColumnDescendingPtr m_DataTableSortOptions_GetSortColumnDescending;
+	PLibMCEnvDataTableSortOptions_ClearPtr m_DataTableSortOptions_Clear;
+	PLibMCEnvDataTableAggregationOptions_AddGroupColumnPtr m_DataTableAggregationOptions_AddGroupColumn;
+	PLibMCEnvDataTableAggregationOptions_GetGroupColumnCountPtr m_DataTableAggregationOptions_GetGroupColumnCount;
+	PLibMCEnvDataTableAggregationOptions_GetGroupColumnPtr m_DataTableAggregationOptions_GetGroupColumn;
+	PLibMCEnvDataTableAggregationOptions_AddAggregationPtr m_DataTableAggregationOptions_AddAggregation;
+	PLibMCEnvDataTableAggregationOptions_GetAggregationCountPtr m_DataTableAggregationOptions_GetAggregationCount;
+	PLibMCEnvDataTableAggregationOptions_GetAggregationResultIdentifierPtr m_DataTableAggregationOptions_GetAggregationResultIdentifier;
+	PLibMCEnvDataTableAggregationOptions_GetAggregationColumnPtr m_DataTableAggregationOptions_GetAggregationColumn;
+	PLibMCEnvDataTableAggregationOptions_GetAggregationTypePtr m_DataTableAggregationOptions_GetAggregationType;
+	PLibMCEnvDataTableAggregationOptions_ClearPtr m_DataTableAggregationOptions_Clear;
+	PLibMCEnvDataTableLoadOptions_AddColumnPtr m_DataTableLoadOptions_AddColumn;
+	PLibMCEnvDataTableLoadOptions_GetColumnCountPtr m_DataTableLoadOptions_GetColumnCount;
+	PLibMCEnvDataTableLoadOptions_GetColumnPtr m_DataTableLoadOptions_GetColumn;
+	PLibMCEnvDataTableLoadOptions_ClearColumnsPtr m_DataTableLoadOptions_ClearColumns;
+	PLibMCEnvDataTableLoadOptions_SetRowRangePtr m_DataTableLoadOptions_SetRowRange;
+	PLibMCEnvDataTableLoadOptions_HasRowRangePtr m_DataTableLoadOptions_HasRowRange;
+	PLibMCEnvDataTableLoadOptions_GetFirstRowPtr m_DataTableLoadOptions_GetFirstRow;
+	PLibMCEnvDataTableLoadOptions_GetRowCountPtr m_DataTableLoadOptions_GetRowCount;
+	PLibMCEnvDataTableLoadOptions_ClearRowRangePtr m_DataTableLoadOptions_ClearRowRange;
+	PLibMCEnvDataTableLoadOptions_SetLazyLoadingPtr m_DataTableLoadOptions_SetLazyLoading;
+	PLibMCEnvDataTableLoadOptions_GetLazyLoadingPtr m_DataTableLoadOptions_GetLazyLoading;
 	PLibMCEnvDataTable_AddColumnPtr m_DataTable_AddColumn;
 	PLibMCEnvDataTable_RemoveColumnPtr m_DataTable_RemoveColumn;
 	PLibMCEnvDataTable_ClearPtr m_DataTable_Clear;
@@ -9576,6 +10580,23 @@ typedef struct {
 	PLibMCEnvDataTable_LoadFromStreamPtr m_DataTable_LoadFromStream;
 	PLibMCEnvDataTable_CreateScatterPlotOptionsPtr m_DataTable_CreateScatterPlotOptions;
 	PLibMCEnvDataTable_CalculateScatterPlotPtr m_DataTable_CalculateScatterPlot;
+	PLibMCEnvDataTable_GetThreadCountPtr m_DataTable_GetThreadCount;
+	PLibMCEnvDataTable_SetThreadCountPtr m_DataTable_SetThreadCount;
+	PLibMCEnvDataTable_CreateFilterPtr m_DataTable_CreateFilter;
+	PLibMCEnvDataTable_FindRowsPtr m_DataTable_FindRows;
+	PLibMCEnvDataTable_FilterRowsPtr m_DataTable_FilterRows;
+	PLibMCEnvDataTable_SelectRowsPtr m_DataTable_SelectRows;
+	PLibMCEnvDataTable_CreateSortOptionsPtr m_DataTable_CreateSortOptions;
+	PLibMCEnvDataTable_GetSortedRowIndicesPtr m_DataTable_GetSortedRowIndices;
+	PLibMCEnvDataTable_SortRowsPtr m_DataTable_SortRows;
+	PLibMCEnvDataTable_CreateAggregationOptionsPtr m_DataTable_CreateAggregationOptions;
+	PLibMCEnvDataTable_AggregatePtr m_DataTable_Aggregate;
+	PLibMCEnvDataTable_AddWindowStatisticColumnPtr m_DataTable_AddWindowStatisticColumn;
+	PLibMCEnvDataTable_CreateLoadOptionsPtr m_DataTable_CreateLoadOptions;
+	PLibMCEnvDataTable_LoadFromStreamWithOptionsPtr m_DataTable_LoadFromStreamWithOptions;
+	PLibMCEnvDataTable_IsColumnLoadedPtr m_DataTable_IsColumnLoaded;
+	PLibMCEnvDataTable_AddScaledInt32ColumnPtr m_DataTable_AddScaledInt32Column;
+	PLibMCEnvDataTable_AppendScaledInt32ColumnValuesPtr m_DataTable_AppendScaledInt32ColumnValues;
 	PLibMCEnvDataSeries_GetNamePtr m_DataSeries_GetName;
 	PLibMCEnvDataSeries_GetUUIDPtr m_DataSeries_GetUUID;
 	PLibMCEnvDataSeries_ClearPtr m_DataSeries_Clear;
@@ -9656,6 +10677,11 @@ typedef struct {
 	PLibMCEnvMeshObject_GetTrianglePtr m_MeshObject_GetTriangle;
 	PLibMCEnvMeshObject_GetTriangleIDsPtr m_MeshObject_GetTriangleIDs;
 	PLibMCEnvMeshObject_GetAllTrianglesPtr m_MeshObject_GetAllTriangles;
+	PLibMCEnvMeshObject_BuildSpatialIndexPtr m_MeshObject_BuildSpatialIndex;
+	PLibMCEnvMeshObject_HasSpatialIndexPtr m_MeshObject_HasSpatialIndex;
+	PLibMCEnvMeshObject_CastRayPtr m_MeshObject_CastRay;
+	PLibMCEnvMeshObject_FindTrianglesInBoxPtr m_MeshObject_FindTrianglesInBox;
+	PLibMCEnvMeshObject_FindClosestPointPtr m_MeshObject_FindClosestPoint;
 	PLibMCEnvMeshObject_IsPersistentPtr m_MeshObject_IsPersistent;
 	PLibMCEnvMeshObject_MakePersistentPtr m_MeshObject_MakePersistent;
 	PLibMCEnvPersistentMeshObject_IsBoundToLoginSessionPtr m_PersistentMeshObject_IsBoundToLoginSession;
@@ -9746,6 +10772,12 @@ typedef struct {
 	PLibMCEnvToolpathLayer_FindUniqueMetaDataPtr m_ToolpathLayer_FindUniqueMetaData;
 	PLibMCEnvToolpathLayer_CalculateExtentsPtr m_ToolpathLayer_CalculateExtents;
 	PLibMCEnvToolpathLayer_CalculateExtentsInMMPtr m_ToolpathLayer_CalculateExtentsInMM;
+	PLibMCEnvToolpathLayer_FindProfileValueIDPtr m_ToolpathLayer_FindProfileValueID;
+	PLibMCEnvToolpathLayer_ExportSegmentTablePtr m_ToolpathLayer_ExportSegmentTable;
+	PLibMCEnvToolpathLayer_ExportProfileValueColumnsPtr m_ToolpathLayer_ExportProfileValueColumns;
+	PLibMCEnvToolpathLayer_ExportSegmentIntegerAttributesPtr m_ToolpathLayer_ExportSegmentIntegerAttributes;
+	PLibMCEnvToolpathLayer_ExportPointDataPtr m_ToolpathLayer_ExportPointData;
+	PLibMCEnvToolpathLayer_EncodeBinaryTilesPtr m_ToolpathLayer_EncodeBinaryTiles;
 	PLibMCEnvToolpathAccessor_GetStorageUUIDPtr m_ToolpathAccessor_GetStorageUUID;
 	PLibMCEnvToolpathAccessor_GetBuildUUIDPtr m_ToolpathAccessor_GetBuildUUID;
 	PLibMCEnvToolpathAccessor_GetLayerCountPtr m_ToolpathAccessor_GetLayerCount;
@@ -10187,6 +11219,7 @@ typedef struct {
 	PLibMCEnvStateEnvironment_HasBuildExecutionPtr m_StateEnvironment_HasBuildExecution;
 	PLibMCEnvStateEnvironment_GetBuildExecutionPtr m_StateEnvironment_GetBuildExecution;
 	PLibMCEnvStateEnvironment_UnloadAllToolpathesPtr m_StateEnvironment_UnloadAllToolpathes;
+	PLibMCEnvStateEnvironment_CreateSyntheticToolpathPtr m_StateEnvironment_CreateSyntheticToolpath;
 	PLibMCEnvStateEnvironment_SetNextStatePtr m_StateEnvironment_SetNextState;
 	PLibMCEnvStateEnvironment_LogMessagePtr m_StateEnvironment_LogMessage;
 	PLibMCEnvStateEnvironment_LogWarningPtr m_StateEnvironment_LogWarning;
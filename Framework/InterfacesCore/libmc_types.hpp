@@ -649,6 +649,12 @@ typedef void * LibMC_pvoid;
 #define LIBMC_ERROR_INVALIDCONTENTSTATEID 632 /** Invalid content state ID */
 #define LIBMC_ERROR_INVALIDWIDGETREQUEST 633 /** Invalid widget request */
 #define LIBMC_ERROR_SOURCEVARIABLENOTFOUND 634 /** Source variable not found */
+#define LIBMC_ERROR_INVALIDTOOLPATHTILEINDEX 635 /** Invalid toolpath tile index */
+#define LIBMC_ERROR_INVALIDTOOLPATHVIEWPORT 636 /** Invalid toolpath viewport */
+#define LIBMC_ERROR_INVALIDTOOLPATHRESOLUTION 637 /** Invalid toolpath resolution */
+#define LIBMC_ERROR_INVALIDSCATTERPLOTVIEWPORT 638 /** Invalid scatterplot viewport */
+#define LIBMC_ERROR_INVALIDSCATTERPLOTRESOLUTION 639 /** Invalid scatterplot resolution */
+#define LIBMC_ERROR_INVALIDSCATTERPLOTMEMORYBUDGET 640 /** Invalid scatterplot memory budget */
 
 /*************************************************************************************************************************
  Error strings for LibMC
@@ -1210,6 +1216,12 @@ inline const char * LIBMC_GETERRORSTRING (LibMCResult nErrorCode) {
     case LIBMC_ERROR_INVALIDCONTENTSTATEID: return "Invalid content state ID";
     case LIBMC_ERROR_INVALIDWIDGETREQUEST: return "Invalid widget request";
     case LIBMC_ERROR_SOURCEVARIABLENOTFOUND: return "Source variable not found";
+    case LIBMC_ERROR_INVALIDTOOLPATHTILEINDEX: return "Invalid toolpath tile index";
+    case LIBMC_ERROR_INVALIDTOOLPATHVIEWPORT: return "Invalid toolpath viewport";
+    case LIBMC_ERROR_INVALIDTOOLPATHRESOLUTION: return "Invalid toolpath resolution";
+    case LIBMC_ERROR_INVALIDSCATTERPLOTVIEWPORT: return "Invalid scatterplot viewport";
+    case LIBMC_ERROR_INVALIDSCATTERPLOTRESOLUTION: return "Invalid scatterplot resolution";
+    case LIBMC_ERROR_INVALIDSCATTERPLOTMEMORYBUDGET: return "Invalid scatterplot memory budget";
     default: return "unknown error";
   }
 }
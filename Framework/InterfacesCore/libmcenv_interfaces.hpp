@@ -71,6 +71,10 @@ class IDiscreteFieldData2D;
 class IDataTableWriteOptions;
 class IDataTableCSVWriteOptions;
 class IDataTableScatterPlotOptions;
+class IDataTableFilter;
+class IDataTableSortOptions;
+class IDataTableAggregationOptions;
+class IDataTableLoadOptions;
 class IDataTable;
 class IDataSeries;
 class IDateTimeDifference;
@@ -481,6 +485,54 @@ public:
 	*/
 	virtual void SetStorageFormat(const LibMCEnv::ePNGStorageFormat ePNGStorageFormat) = 0;
 
+	/**
+	* IPNGImageStoreOptions::GetCompressionLevel - Returns the zlib compression level.
+	* @return Compression level from 0 (stored) to 9 (smallest). Default is 6.
+	*/
+	virtual LibMCEnv_uint32 GetCompressionLevel() = 0;
+
+	/**
+	* IPNGImageStoreOptions::SetCompressionLevel - Sets the zlib compression level.
+	* @param[in] nCompressionLevel - Compression level from 0 (stored) to 9 (smallest). Default is 6.
+	*/
+	virtual void SetCompressionLevel(const LibMCEnv_uint32 nCompressionLevel) = 0;
+
+	/**
+	* IPNGImageStoreOptions::GetFilterStrategy - Returns the scanline filter strategy.
+	* @return Filter strategy. Default is Adaptive.
+	*/
+	virtual LibMCEnv::ePNGFilterStrategy GetFilterStrategy() = 0;
+
+	/**
+	* IPNGImageStoreOptions::SetFilterStrategy - Sets the scanline filter strategy.
+	* @param[in] eFilterStrategy - Filter strategy. Default is Adaptive.
+	*/
+	virtual void SetFilterStrategy(const LibMCEnv::ePNGFilterStrategy eFilterStrategy) = 0;
+
+	/**
+	* IPNGImageStoreOptions::GetEncoderBackend - Returns the encoder that is used to create the PNG stream.
+	* @return Encoder backend. Default is ZLib.
+	*/
+	virtual LibMCEnv::ePNGEncoderBackend GetEncoderBackend() = 0;
+
+	/**
+	* IPNGImageStoreOptions::SetEncoderBackend - Sets the encoder that is used to create the PNG stream.
+	* @param[in] eEncoderBackend - Encoder backend. Default is ZLib.
+	*/
+	virtual void SetEncoderBackend(const LibMCEnv::ePNGEncoderBackend eEncoderBackend) = 0;
+
+	/**
+	* IPNGImageStoreOptions::GetThreadCount - Returns the number of threads the ZLib encoder may use.
+	* @return Number of threads. 0 uses the number of hardware threads. 1 compresses the image as a single stream.
+	*/
+	virtual LibMCEnv_uint32 GetThreadCount() = 0;
+
+	/**
+	* IPNGImageStoreOptions::SetThreadCount - Sets the number of threads the ZLib encoder may use.
+	* @param[in] nThreadCount - Number of threads. 0 uses the number of hardware threads. 1 compresses the image as a single stream. Default is 0.
+	*/
+	virtual void SetThreadCount(const LibMCEnv_uint32 nThreadCount) = 0;
+
 };
 
 typedef IBaseSharedPtr<IPNGImageStoreOptions> PIPNGImageStoreOptions;
@@ -869,6 +921,23 @@ public:
 	*/
 	virtual void GetBoundaries(LibMCEnv_double & dMinX, LibMCEnv_double & dMinY, LibMCEnv_double & dMaxX, LibMCEnv_double & dMaxY) = 0;
 
+	/**
+	* IScatterPlot::QueryDensity - Aggregates all points in a viewport into a grid of bins, using the spatial index of the plot. Every non-empty bin returns the mean position and the number of its points. Non-empty bins are returned row by row, starting at MinX/MinY. Bins that are larger than an index cell are aggregated from whole cells, so all points of such a cell are counted in the bin of the cell's mean position.
+	* @param[in] dMinX - Minimum X value of the viewport in mm
+	* @param[in] dMinY - Minimum Y value of the viewport in mm
+	* @param[in] dMaxX - Maximum X value of the viewport in mm. MUST be larger than MinX.
+	* @param[in] dMaxY - Maximum Y value of the viewport in mm. MUST be larger than MinY.
+	* @param[in] nResolutionX - Number of bins in X. MUST be between 1 and 4096.
+	* @param[in] nResolutionY - Number of bins in Y. MUST be between 1 and 4096.
+	* @param[in] nPositionsBufferSize - Number of elements in buffer
+	* @param[out] pPositionsNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pPositionsBuffer - FloatPosition2D buffer of Mean position of every non-empty bin in mm.
+	* @param[in] nCountsBufferSize - Number of elements in buffer
+	* @param[out] pCountsNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pCountsBuffer - uint32 buffer of Number of points of every non-empty bin.
+	*/
+	virtual void QueryDensity(const LibMCEnv_double dMinX, const LibMCEnv_double dMinY, const LibMCEnv_double dMaxX, const LibMCEnv_double dMaxY, const LibMCEnv_uint32 nResolutionX, const LibMCEnv_uint32 nResolutionY, LibMCEnv_uint64 nPositionsBufferSize, LibMCEnv_uint64* pPositionsNeededCount, LibMCEnv::sFloatPosition2D * pPositionsBuffer, LibMCEnv_uint64 nCountsBufferSize, LibMCEnv_uint64* pCountsNeededCount, LibMCEnv_uint32 * pCountsBuffer) = 0;
+
 	/**
 	* IScatterPlot::Release - Release the scatter plot and clear its memory. All accessing code will lose access to the data.
 	*/
@@ -1079,6 +1148,65 @@ public:
 	*/
 	virtual IDiscreteFieldData2D * Duplicate() = 0;
 
+	/**
+	* IDiscreteFieldData2D::GetStoragePrecision - Returns the precision in which the field values are stored.
+	* @return Storage precision. Default is Float64.
+	*/
+	virtual LibMCEnv::eFieldStoragePrecision GetStoragePrecision() = 0;
+
+	/**
+	* IDiscreteFieldData2D::SetStoragePrecision - Changes the precision in which the field values are stored. Existing values are converted.
+	* @param[in] eStoragePrecision - Storage precision.
+	*/
+	virtual void SetStoragePrecision(const LibMCEnv::eFieldStoragePrecision eStoragePrecision) = 0;
+
+	/**
+	* IDiscreteFieldData2D::GetStorageLayout - Returns how the field values are stored in memory.
+	* @return Storage layout. Default is Dense.
+	*/
+	virtual LibMCEnv::eFieldStorageLayout GetStorageLayout() = 0;
+
+	/**
+	* IDiscreteFieldData2D::SetStorageLayout - Changes how the field values are stored in memory. Existing values are kept. Converting to a tiled layout does not allocate tiles that only contain the background value.
+	* @param[in] eStorageLayout - Storage layout.
+	*/
+	virtual void SetStorageLayout(const LibMCEnv::eFieldStorageLayout eStorageLayout) = 0;
+
+	/**
+	* IDiscreteFieldData2D::GetStorageSize - Returns the memory that is allocated for the field values.
+	* @return Allocated memory in bytes.
+	*/
+	virtual LibMCEnv_uint64 GetStorageSize() = 0;
+
+	/**
+	* IDiscreteFieldData2D::Compact - Releases all allocated tiles whose values are all equal to the background value of the field. The background value is the value that was last passed to Clear.
+	*/
+	virtual void Compact() = 0;
+
+	/**
+	* IDiscreteFieldData2D::GetThreadCount - Returns the number of threads that field operations may use.
+	* @return Number of threads. 0 uses the number of hardware threads.
+	*/
+	virtual LibMCEnv_uint32 GetThreadCount() = 0;
+
+	/**
+	* IDiscreteFieldData2D::SetThreadCount - Sets the number of threads that field operations may use. Small fields are always processed on the calling thread.
+	* @param[in] nThreadCount - Number of threads. 0 uses the number of hardware threads. MUST not be larger than 64. Default is 0.
+	*/
+	virtual void SetThreadCount(const LibMCEnv_uint32 nThreadCount) = 0;
+
+	/**
+	* IDiscreteFieldData2D::SetSIMDKernelsEnabled - Enables or disables the vectorised kernels of the field operations. All kernels return identical results, disabling them is meant for benchmarks and diagnostics.
+	* @param[in] bEnabled - If false, the scalar kernels are used. Default is true.
+	*/
+	virtual void SetSIMDKernelsEnabled(const bool bEnabled) = 0;
+
+	/**
+	* IDiscreteFieldData2D::GetSIMDKernelName - Returns the name of the kernels that are used for the field operations.
+	* @return scalar or avx2.
+	*/
+	virtual std::string GetSIMDKernelName() = 0;
+
 };
 
 typedef IBaseSharedPtr<IDiscreteFieldData2D> PIDiscreteFieldData2D;
@@ -1090,6 +1218,66 @@ typedef IBaseSharedPtr<IDiscreteFieldData2D> PIDiscreteFieldData2D;
 
 class IDataTableWriteOptions : public virtual IBase {
 public:
+	/**
+	* IDataTableWriteOptions::ResetToDefaults - Resets all options to default. Columns are stored raw and uncompressed.
+	*/
+	virtual void ResetToDefaults() = 0;
+
+	/**
+	* IDataTableWriteOptions::GetDefaultEncoding - Returns the encoding of all columns that have no column specific encoding.
+	* @return Column encoding. Default is Raw.
+	*/
+	virtual LibMCEnv::eDataTableColumnEncoding GetDefaultEncoding() = 0;
+
+	/**
+	* IDataTableWriteOptions::SetDefaultEncoding - Sets the encoding of all columns that have no column specific encoding.
+	* @param[in] eEncoding - Column encoding.
+	*/
+	virtual void SetDefaultEncoding(const LibMCEnv::eDataTableColumnEncoding eEncoding) = 0;
+
+	/**
+	* IDataTableWriteOptions::GetColumnEncoding - Returns the encoding of a column.
+	* @param[in] sIdentifier - Identifier of the column.
+	* @return Column encoding. Returns the default encoding, if no column specific encoding has been set.
+	*/
+	virtual LibMCEnv::eDataTableColumnEncoding GetColumnEncoding(const std::string & sIdentifier) = 0;
+
+	/**
+	* IDataTableWriteOptions::SetColumnEncoding - Sets the encoding of a column. The column does not need to exist in the data table. Unknown identifiers are ignored when writing.
+	* @param[in] sIdentifier - Identifier of the column.
+	* @param[in] eEncoding - Column encoding.
+	*/
+	virtual void SetColumnEncoding(const std::string & sIdentifier, const LibMCEnv::eDataTableColumnEncoding eEncoding) = 0;
+
+	/**
+	* IDataTableWriteOptions::ClearColumnEncodings - Removes all column specific encodings.
+	*/
+	virtual void ClearColumnEncodings() = 0;
+
+	/**
+	* IDataTableWriteOptions::GetCompression - Returns the compression that is applied to the encoded column data.
+	* @return Compression. Default is NoCompression.
+	*/
+	virtual LibMCEnv::eDataTableCompression GetCompression() = 0;
+
+	/**
+	* IDataTableWriteOptions::SetCompression - Sets the compression that is applied to the encoded column data.
+	* @param[in] eCompression - Compression.
+	*/
+	virtual void SetCompression(const LibMCEnv::eDataTableCompression eCompression) = 0;
+
+	/**
+	* IDataTableWriteOptions::GetCompressionLevel - Returns the compression level.
+	* @return Compression level from 0 to 9. ZLib stores level 0 uncompressed and compresses best at 9. LZ4 uses the fast compressor below level 3 and LZ4 HC from level 3. Default is 6.
+	*/
+	virtual LibMCEnv_uint32 GetCompressionLevel() = 0;
+
+	/**
+	* IDataTableWriteOptions::SetCompressionLevel - Sets the compression level.
+	* @param[in] nCompressionLevel - Compression level from 0 to 9. ZLib stores level 0 uncompressed and compresses best at 9. LZ4 uses the fast compressor below level 3 and LZ4 HC from level 3.
+	*/
+	virtual void SetCompressionLevel(const LibMCEnv_uint32 nCompressionLevel) = 0;
+
 };
 
 typedef IBaseSharedPtr<IDataTableWriteOptions> PIDataTableWriteOptions;
@@ -1191,6 +1379,255 @@ public:
 typedef IBaseSharedPtr<IDataTableScatterPlotOptions> PIDataTableScatterPlotOptions;
 
 
+/*************************************************************************************************************************
+ Class interface for DataTableFilter 
+*************************************************************************************************************************/
+
+class IDataTableFilter : public virtual IBase {
+public:
+	/**
+	* IDataTableFilter::AddCondition - Adds a condition on a column. The column is looked up when the filter is applied. Integer columns are compared exactly against the threshold values.
+	* @param[in] sColumnIdentifier - Identifier of the column. Must be alphanumeric and not empty.
+	* @param[in] eOperator - Comparison operator.
+	* @param[in] dValue - Threshold value. Lower bound for InRange and OutsideRange.
+	* @param[in] dUpperValue - Upper bound for InRange and OutsideRange. Ignored for all other operators.
+	*/
+	virtual void AddCondition(const std::string & sColumnIdentifier, const LibMCEnv::eDataTableFilterOperator eOperator, const LibMCEnv_double dValue, const LibMCEnv_double dUpperValue) = 0;
+
+	/**
+	* IDataTableFilter::GetConditionCount - Returns the number of conditions of the filter.
+	* @return Number of conditions.
+	*/
+	virtual LibMCEnv_uint32 GetConditionCount() = 0;
+
+	/**
+	* IDataTableFilter::GetConditionColumn - Returns the column of a condition.
+	* @param[in] nIndex - Index of the condition. 0-based.
+	* @return Identifier of the column.
+	*/
+	virtual std::string GetConditionColumn(const LibMCEnv_uint32 nIndex) = 0;
+
+	/**
+	* IDataTableFilter::GetConditionOperator - Returns the operator of a condition.
+	* @param[in] nIndex - Index of the condition. 0-based.
+	* @return Comparison operator.
+	*/
+	virtual LibMCEnv::eDataTableFilterOperator GetConditionOperator(const LibMCEnv_uint32 nIndex) = 0;
+
+	/**
+	* IDataTableFilter::GetConditionValue - Returns the threshold value of a condition.
+	* @param[in] nIndex - Index of the condition. 0-based.
+	* @return Threshold value or lower bound.
+	*/
+	virtual LibMCEnv_double GetConditionValue(const LibMCEnv_uint32 nIndex) = 0;
+
+	/**
+	* IDataTableFilter::GetConditionUpperValue - Returns the upper bound of a condition.
+	* @param[in] nIndex - Index of the condition. 0-based.
+	* @return Upper bound.
+	*/
+	virtual LibMCEnv_double GetConditionUpperValue(const LibMCEnv_uint32 nIndex) = 0;
+
+	/**
+	* IDataTableFilter::Clear - Removes all conditions. An empty filter matches all rows.
+	*/
+	virtual void Clear() = 0;
+
+};
+
+typedef IBaseSharedPtr<IDataTableFilter> PIDataTableFilter;
+
+
+/*************************************************************************************************************************
+ Class interface for DataTableSortOptions 
+*************************************************************************************************************************/
+
+class IDataTableSortOptions : public virtual IBase {
+public:
+	/**
+	* IDataTableSortOptions::AddSortColumn - Adds a sort key. Rows are ordered by the first key, ties by the following keys. Rows with equal keys keep their original order.
+	* @param[in] sColumnIdentifier - Identifier of the column. Must be alphanumeric and not empty.
+	* @param[in] bDescending - If true, the column is sorted in descending order. NaN values are always sorted to the end.
+	*/
+	virtual void AddSortColumn(const std::string & sColumnIdentifier, const bool bDescending) = 0;
+
+	/**
+	* IDataTableSortOptions::GetSortColumnCount - Returns the number of sort keys.
+	* @return Number of sort keys.
+	*/
+	virtual LibMCEnv_uint32 GetSortColumnCount() = 0;
+
+	/**
+	* IDataTableSortOptions::GetSortColumn - Returns the column of a sort key.
+	* @param[in] nIndex - Index of the sort key. 0-based.
+	* @return Identifier of the column.
+	*/
+	virtual std::string GetSortColumn(const LibMCEnv_uint32 nIndex) = 0;
+
+	/**
+	* IDataTableSortOptions::GetSortColumnDescending - Returns if a sort key is sorted in descending order.
+	* @param[in] nIndex - Index of the sort key. 0-based.
+	* @return Flag if the column is sorted in descending order.
+	*/
+	virtual bool GetSortColumnDescending(const LibMCEnv_uint32 nIndex) = 0;
+
+	/**
+	* IDataTableSortOptions::Clear - Removes all sort keys.
+	*/
+	virtual void Clear() = 0;
+
+};
+
+typedef IBaseSharedPtr<IDataTableSortOptions> PIDataTableSortOptions;
+
+
+/*************************************************************************************************************************
+ Class interface for DataTableAggregationOptions 
+*************************************************************************************************************************/
+
+class IDataTableAggregationOptions : public virtual IBase {
+public:
+	/**
+	* IDataTableAggregationOptions::AddGroupColumn - Adds a column to group by. Rows with equal values in all group columns form a group. Without group columns, all rows form a single group.
+	* @param[in] sColumnIdentifier - Identifier of the column. Must be alphanumeric and not empty.
+	*/
+	virtual void AddGroupColumn(const std::string & sColumnIdentifier) = 0;
+
+	/**
+	* IDataTableAggregationOptions::GetGroupColumnCount - Returns the number of group columns.
+	* @return Number of group columns.
+	*/
+	virtual LibMCEnv_uint32 GetGroupColumnCount() = 0;
+
+	/**
+	* IDataTableAggregationOptions::GetGroupColumn - Returns a group column.
+	* @param[in] nIndex - Index of the group column. 0-based.
+	* @return Identifier of the column.
+	*/
+	virtual std::string GetGroupColumn(const LibMCEnv_uint32 nIndex) = 0;
+
+	/**
+	* IDataTableAggregationOptions::AddAggregation - Adds an aggregated result column. Count results are uint64 columns, all other results are double columns.
+	* @param[in] sResultIdentifier - Identifier of the result column. MUST be unique, alphanumeric and not empty.
+	* @param[in] sColumnIdentifier - Identifier of the column to aggregate. Must be alphanumeric and not empty.
+	* @param[in] eAggregation - Aggregation to compute.
+	*/
+	virtual void AddAggregation(const std::string & sResultIdentifier, const std::string & sColumnIdentifier, const LibMCEnv::eDataTableAggregation eAggregation) = 0;
+
+	/**
+	* IDataTableAggregationOptions::GetAggregationCount - Returns the number of aggregations.
+	* @return Number of aggregations.
+	*/
+	virtual LibMCEnv_uint32 GetAggregationCount() = 0;
+
+	/**
+	* IDataTableAggregationOptions::GetAggregationResultIdentifier - Returns the identifier of the result column of an aggregation.
+	* @param[in] nIndex - Index of the aggregation. 0-based.
+	* @return Identifier of the result column.
+	*/
+	virtual std::string GetAggregationResultIdentifier(const LibMCEnv_uint32 nIndex) = 0;
+
+	/**
+	* IDataTableAggregationOptions::GetAggregationColumn - Returns the aggregated column of an aggregation.
+	* @param[in] nIndex - Index of the aggregation. 0-based.
+	* @return Identifier of the column to aggregate.
+	*/
+	virtual std::string GetAggregationColumn(const LibMCEnv_uint32 nIndex) = 0;
+
+	/**
+	* IDataTableAggregationOptions::GetAggregationType - Returns the aggregation type of an aggregation.
+	* @param[in] nIndex - Index of the aggregation. 0-based.
+	* @return Aggregation to compute.
+	*/
+	virtual LibMCEnv::eDataTableAggregation GetAggregationType(const LibMCEnv_uint32 nIndex) = 0;
+
+	/**
+	* IDataTableAggregationOptions::Clear - Removes all group columns and aggregations.
+	*/
+	virtual void Clear() = 0;
+
+};
+
+typedef IBaseSharedPtr<IDataTableAggregationOptions> PIDataTableAggregationOptions;
+
+
+/*************************************************************************************************************************
+ Class interface for DataTableLoadOptions 
+*************************************************************************************************************************/
+
+class IDataTableLoadOptions : public virtual IBase {
+public:
+	/**
+	* IDataTableLoadOptions::AddColumn - Adds a column to the loaded columns. If no columns are added, all columns of the stream are loaded.
+	* @param[in] sColumnIdentifier - Identifier of the column. Must be alphanumeric and not empty.
+	*/
+	virtual void AddColumn(const std::string & sColumnIdentifier) = 0;
+
+	/**
+	* IDataTableLoadOptions::GetColumnCount - Returns the number of columns that have been added.
+	* @return Number of columns. 0 loads all columns.
+	*/
+	virtual LibMCEnv_uint32 GetColumnCount() = 0;
+
+	/**
+	* IDataTableLoadOptions::GetColumn - Returns a column that has been added.
+	* @param[in] nIndex - Index of the column. 0-based.
+	* @return Identifier of the column.
+	*/
+	virtual std::string GetColumn(const LibMCEnv_uint32 nIndex) = 0;
+
+	/**
+	* IDataTableLoadOptions::ClearColumns - Removes all columns, so that all columns of the stream are loaded.
+	*/
+	virtual void ClearColumns() = 0;
+
+	/**
+	* IDataTableLoadOptions::SetRowRange - Only loads a range of rows of every column.
+	* @param[in] nFirstRow - First row to load. 0-based.
+	* @param[in] nRowCount - Number of rows to load. Columns that end earlier are shortened accordingly.
+	*/
+	virtual void SetRowRange(const LibMCEnv_uint64 nFirstRow, const LibMCEnv_uint64 nRowCount) = 0;
+
+	/**
+	* IDataTableLoadOptions::HasRowRange - Returns if only a range of rows is loaded.
+	* @return True if a row range has been set.
+	*/
+	virtual bool HasRowRange() = 0;
+
+	/**
+	* IDataTableLoadOptions::GetFirstRow - Returns the first row of the row range.
+	* @return First row to load. 0 if no row range has been set.
+	*/
+	virtual LibMCEnv_uint64 GetFirstRow() = 0;
+
+	/**
+	* IDataTableLoadOptions::GetRowCount - Returns the number of rows of the row range.
+	* @return Number of rows to load. 0 if no row range has been set.
+	*/
+	virtual LibMCEnv_uint64 GetRowCount() = 0;
+
+	/**
+	* IDataTableLoadOptions::ClearRowRange - Loads all rows of every column.
+	*/
+	virtual void ClearRowRange() = 0;
+
+	/**
+	* IDataTableLoadOptions::SetLazyLoading - Sets if the column data is only read from the stream when a column is accessed for the first time. The data table keeps a reference to the stream in that case.
+	* @param[in] bLazyLoading - True reads columns on first access, false reads all columns at once. Default is true.
+	*/
+	virtual void SetLazyLoading(const bool bLazyLoading) = 0;
+
+	/**
+	* IDataTableLoadOptions::GetLazyLoading - Returns if the column data is only read from the stream when a column is accessed for the first time.
+	* @return True if columns are read on first access.
+	*/
+	virtual bool GetLazyLoading() = 0;
+
+};
+
+typedef IBaseSharedPtr<IDataTableLoadOptions> PIDataTableLoadOptions;
+
+
 /*************************************************************************************************************************
  Class interface for DataTable 
 **************************************************************************************************************************/
@@ -1394,6 +1831,130 @@ public:
 	*/
 	virtual IScatterPlot * CalculateScatterPlot(IDataTableScatterPlotOptions* pScatterPlotOptions) = 0;
 
+	/**
+	* IDataTable::GetThreadCount - Returns the number of threads that queries on the data table may use.
+	* @return Number of threads. 0 uses the number of hardware threads.
+	*/
+	virtual LibMCEnv_uint32 GetThreadCount() = 0;
+
+	/**
+	* IDataTable::SetThreadCount - Sets the number of threads that queries on the data table may use. Small tables are always processed on the calling thread. Results do not depend on the thread count.
+	* @param[in] nThreadCount - Number of threads. 0 uses the number of hardware threads. MUST not be larger than 64. Default is 0.
+	*/
+	virtual void SetThreadCount(const LibMCEnv_uint32 nThreadCount) = 0;
+
+	/**
+	* IDataTable::CreateFilter - Creates an empty row filter.
+	* @return Filter instance to pass on to FindRows or FilterRows.
+	*/
+	virtual IDataTableFilter * CreateFilter() = 0;
+
+	/**
+	* IDataTable::FindRows - Returns the indices of all rows that fulfil all conditions of a filter.
+	* @param[in] pFilter - Filter to apply.
+	* @param[in] nRowIndicesBufferSize - Number of elements in buffer
+	* @param[out] pRowIndicesNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pRowIndicesBuffer - uint32 buffer of Indices of the matching rows in ascending order.
+	*/
+	virtual void FindRows(IDataTableFilter* pFilter, LibMCEnv_uint64 nRowIndicesBufferSize, LibMCEnv_uint64* pRowIndicesNeededCount, LibMCEnv_uint32 * pRowIndicesBuffer) = 0;
+
+	/**
+	* IDataTable::FilterRows - Creates a new data table with all rows that fulfil all conditions of a filter.
+	* @param[in] pFilter - Filter to apply.
+	* @return New data table with the same columns and the matching rows.
+	*/
+	virtual IDataTable * FilterRows(IDataTableFilter* pFilter) = 0;
+
+	/**
+	* IDataTable::SelectRows - Creates a new data table from a selection of rows.
+	* @param[in] nRowIndicesBufferSize - Number of elements in buffer
+	* @param[in] pRowIndicesBuffer - uint32 buffer of Indices of the rows to copy. Rows may appear in any order and more than once. MUST be smaller than the row count.
+	* @return New data table with the same columns and the selected rows.
+	*/
+	virtual IDataTable * SelectRows(const LibMCEnv_uint64 nRowIndicesBufferSize, const LibMCEnv_uint32 * pRowIndicesBuffer) = 0;
+
+	/**
+	* IDataTable::CreateSortOptions - Creates an options object for sorting.
+	* @return Sort options instance to pass on to GetSortedRowIndices or SortRows.
+	*/
+	virtual IDataTableSortOptions * CreateSortOptions() = 0;
+
+	/**
+	* IDataTable::GetSortedRowIndices - Returns the row order of a stable sort. The data table is not modified.
+	* @param[in] pSortOptions - Sort options to use.
+	* @param[in] nRowIndicesBufferSize - Number of elements in buffer
+	* @param[out] pRowIndicesNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pRowIndicesBuffer - uint32 buffer of Row indices in sorted order.
+	*/
+	virtual void GetSortedRowIndices(IDataTableSortOptions* pSortOptions, LibMCEnv_uint64 nRowIndicesBufferSize, LibMCEnv_uint64* pRowIndicesNeededCount, LibMCEnv_uint32 * pRowIndicesBuffer) = 0;
+
+	/**
+	* IDataTable::SortRows - Creates a new data table with the rows in stable sorted order.
+	* @param[in] pSortOptions - Sort options to use.
+	* @return New data table with the same columns and sorted rows.
+	*/
+	virtual IDataTable * SortRows(IDataTableSortOptions* pSortOptions) = 0;
+
+	/**
+	* IDataTable::CreateAggregationOptions - Creates an options object for grouping and aggregation.
+	* @return Aggregation options instance to pass on to Aggregate.
+	*/
+	virtual IDataTableAggregationOptions * CreateAggregationOptions() = 0;
+
+	/**
+	* IDataTable::Aggregate - Groups the rows and computes aggregated values per group. NaN values propagate into Sum, Minimum, Maximum and Mean.
+	* @param[in] pAggregationOptions - Aggregation options to use.
+	* @return New data table with one row per group, ordered ascending by the group columns. Contains the group columns followed by the aggregation results.
+	*/
+	virtual IDataTable * Aggregate(IDataTableAggregationOptions* pAggregationOptions) = 0;
+
+	/**
+	* IDataTable::AddWindowStatisticColumn - Adds a double column with a statistic over a trailing window of rows of another column. The first rows use the rows that are available. Windows that contain NaN result in NaN.
+	* @param[in] sColumnIdentifier - Identifier of the source column.
+	* @param[in] sResultIdentifier - Identifier of the new column. MUST be unique, alphanumeric and not empty.
+	* @param[in] sDescription - Description of the new column.
+	* @param[in] eStatistic - Statistic to compute.
+	* @param[in] nWindowSize - Number of rows of the window, including the current row. MUST be at least 1.
+	*/
+	virtual void AddWindowStatisticColumn(const std::string & sColumnIdentifier, const std::string & sResultIdentifier, const std::string & sDescription, const LibMCEnv::eDataTableWindowStatistic eStatistic, const LibMCEnv_uint32 nWindowSize) = 0;
+
+	/**
+	* IDataTable::CreateLoadOptions - Creates an options object for loading a data table from a stream.
+	* @return Load options instance. Loads all rows of all columns lazily by default.
+	*/
+	virtual IDataTableLoadOptions * CreateLoadOptions() = 0;
+
+	/**
+	* IDataTable::LoadFromStreamWithOptions - Loads the data table from a stream. Clears all existing data from the data table. Only reads the column directory, if lazy loading is enabled.
+	* @param[in] pStream - Stream read instance to read from.
+	* @param[in] pOptions - Load options.
+	*/
+	virtual void LoadFromStreamWithOptions(IStreamReader* pStream, IDataTableLoadOptions* pOptions) = 0;
+
+	/**
+	* IDataTable::IsColumnLoaded - Returns if the values of a column are in memory. Columns of lazily loaded tables are read on first access of their values.
+	* @param[in] sIdentifier - Identifier of the column. Fails if column does not exist.
+	* @return True if the values are in memory.
+	*/
+	virtual bool IsColumnLoaded(const std::string & sIdentifier) = 0;
+
+	/**
+	* IDataTable::AddScaledInt32Column - Adds a double column, whose values are stored as raw int32 values. The double values are computed as raw value * ScaleFactor + Offset, when the values of the column are accessed the first time.
+	* @param[in] sIdentifier - Identifier of the column. MUST be unique, alphanumeric and not empty.
+	* @param[in] sDescription - Description of the column.
+	* @param[in] dScaleFactor - Factor the raw values are multiplied with.
+	* @param[in] dOffset - Offset that is added to the scaled values.
+	*/
+	virtual void AddScaledInt32Column(const std::string & sIdentifier, const std::string & sDescription, const LibMCEnv_double dScaleFactor, const LibMCEnv_double dOffset) = 0;
+
+	/**
+	* IDataTable::AppendScaledInt32ColumnValues - Appends raw values to a scaled int32 column. Will fail if column does not exist, has not been added with AddScaledInt32Column or if its values have been accessed already.
+	* @param[in] sIdentifier - Identifier of the column.
+	* @param[in] nValuesBufferSize - Number of elements in buffer
+	* @param[in] pValuesBuffer - int32 buffer of Raw values to append.
+	*/
+	virtual void AppendScaledInt32ColumnValues(const std::string & sIdentifier, const LibMCEnv_uint64 nValuesBufferSize, const LibMCEnv_int32 * pValuesBuffer) = 0;
+
 };
 
 typedef IBaseSharedPtr<IDataTable> PIDataTable;
@@ -1925,6 +2486,59 @@ public:
 	*/
 	virtual void GetAllTriangles(LibMCEnv_uint64 nTrianglesBufferSize, LibMCEnv_uint64* pTrianglesNeededCount, LibMCEnv::sMeshTriangle3D * pTrianglesBuffer) = 0;
 
+	/**
+	* IMeshObject::BuildSpatialIndex - Builds the bounding volume hierarchy that accelerates the spatial queries of the mesh. The index of a persistent mesh is shared by all its instances and is released when the mesh is unloaded. Spatial queries build the index on first use if it does not exist.
+	*/
+	virtual void BuildSpatialIndex() = 0;
+
+	/**
+	* IMeshObject::HasSpatialIndex - Returns if the spatial index of the mesh has already been built.
+	* @return Returns true if the spatial index exists.
+	*/
+	virtual bool HasSpatialIndex() = 0;
+
+	/**
+	* IMeshObject::CastRay - Returns the first triangle hit by a ray.
+	* @param[in] dOriginX - X coordinate of the ray origin.
+	* @param[in] dOriginY - Y coordinate of the ray origin.
+	* @param[in] dOriginZ - Z coordinate of the ray origin.
+	* @param[in] dDirectionX - X coordinate of the ray direction. Does not need to be normalized.
+	* @param[in] dDirectionY - Y coordinate of the ray direction. Does not need to be normalized.
+	* @param[in] dDirectionZ - Z coordinate of the ray direction. Does not need to be normalized.
+	* @param[out] nTriangleID - ID of the hit triangle. 0 if there is no hit.
+	* @param[out] dDistance - Distance of the hit point from the ray origin. 0 if there is no hit.
+	* @return Returns true if the ray hits the mesh.
+	*/
+	virtual bool CastRay(const LibMCEnv_double dOriginX, const LibMCEnv_double dOriginY, const LibMCEnv_double dOriginZ, const LibMCEnv_double dDirectionX, const LibMCEnv_double dDirectionY, const LibMCEnv_double dDirectionZ, LibMCEnv_uint32 & nTriangleID, LibMCEnv_double & dDistance) = 0;
+
+	/**
+	* IMeshObject::FindTrianglesInBox - Returns all triangles that intersect an axis aligned box. Triangles touching the boundary of the box are included.
+	* @param[in] dMinX - Minimum X coordinate of the box.
+	* @param[in] dMinY - Minimum Y coordinate of the box.
+	* @param[in] dMinZ - Minimum Z coordinate of the box.
+	* @param[in] dMaxX - Maximum X coordinate of the box.
+	* @param[in] dMaxY - Maximum Y coordinate of the box.
+	* @param[in] dMaxZ - Maximum Z coordinate of the box.
+	* @param[in] nTriangleIDsBufferSize - Number of elements in buffer
+	* @param[out] pTriangleIDsNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pTriangleIDsBuffer - uint32 buffer of Triangle IDs in ascending order.
+	*/
+	virtual void FindTrianglesInBox(const LibMCEnv_double dMinX, const LibMCEnv_double dMinY, const LibMCEnv_double dMinZ, const LibMCEnv_double dMaxX, const LibMCEnv_double dMaxY, const LibMCEnv_double dMaxZ, LibMCEnv_uint64 nTriangleIDsBufferSize, LibMCEnv_uint64* pTriangleIDsNeededCount, LibMCEnv_uint32 * pTriangleIDsBuffer) = 0;
+
+	/**
+	* IMeshObject::FindClosestPoint - Returns the point on the mesh surface that is closest to a given point.
+	* @param[in] dX - X coordinate of the query point.
+	* @param[in] dY - Y coordinate of the query point.
+	* @param[in] dZ - Z coordinate of the query point.
+	* @param[out] nTriangleID - ID of the triangle that contains the closest point. 0 if the mesh has no triangles.
+	* @param[out] dClosestX - X coordinate of the closest point.
+	* @param[out] dClosestY - Y coordinate of the closest point.
+	* @param[out] dClosestZ - Z coordinate of the closest point.
+	* @param[out] dDistance - Distance of the closest point from the query point.
+	* @return Returns false if the mesh has no triangles.
+	*/
+	virtual bool FindClosestPoint(const LibMCEnv_double dX, const LibMCEnv_double dY, const LibMCEnv_double dZ, LibMCEnv_uint32 & nTriangleID, LibMCEnv_double & dClosestX, LibMCEnv_double & dClosestY, LibMCEnv_double & dClosestZ, LibMCEnv_double & dDistance) = 0;
+
 	/**
 	* IMeshObject::IsPersistent - Returns if the mesh object is persisted in memory.
 	* @return If true, the mesh object is persisted in memory and can be retrieved by FindPersistentMeshObject.
@@ -2667,6 +3281,70 @@ public:
 	*/
 	virtual void CalculateExtentsInMM(LibMCEnv_double & dMinX, LibMCEnv_double & dMinY, LibMCEnv_double & dMaxX, LibMCEnv_double & dMaxY) = 0;
 
+	/**
+	* IToolpathLayer::FindProfileValueID - Returns the layer local ID of a profile value for ExportProfileValueColumns. IDs are assigned when the layer is loaded, so the layer is not modified.
+	* @param[in] sNamespace - Namespace of the profile value.
+	* @param[in] sValueName - Name of the profile value.
+	* @return ID of the profile value. 0 if no profile of the layer contains the value.
+	*/
+	virtual LibMCEnv_uint32 FindProfileValueID(const std::string & sNamespace, const std::string & sValueName) = 0;
+
+	/**
+	* IToolpathLayer::ExportSegmentTable - Exports the segment information of the whole layer in one call. Each array has one entry per segment.
+	* @param[in] nSegmentTypesBufferSize - Number of elements in buffer
+	* @param[out] pSegmentTypesNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pSegmentTypesBuffer - uint32 buffer of Segment type of each segment, as ToolpathSegmentType value.
+	* @param[in] nPointOffsetsBufferSize - Number of elements in buffer
+	* @param[out] pPointOffsetsNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pPointOffsetsBuffer - uint32 buffer of Index of the first point of each segment in ExportPointData. Has one additional entry with the total point count, so the point count of segment i is PointOffsets[i + 1] - PointOffsets[i].
+	* @param[in] nLocalPartIDsBufferSize - Number of elements in buffer
+	* @param[out] pLocalPartIDsNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pLocalPartIDsBuffer - uint32 buffer of Local part ID of each segment.
+	* @param[in] nProfileIDsBufferSize - Number of elements in buffer
+	* @param[out] pProfileIDsNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pProfileIDsBuffer - uint32 buffer of Layer local profile ID of each segment. Segments with equal IDs share the same profile. 0 if the segment has no profile.
+	*/
+	virtual void ExportSegmentTable(LibMCEnv_uint64 nSegmentTypesBufferSize, LibMCEnv_uint64* pSegmentTypesNeededCount, LibMCEnv_uint32 * pSegmentTypesBuffer, LibMCEnv_uint64 nPointOffsetsBufferSize, LibMCEnv_uint64* pPointOffsetsNeededCount, LibMCEnv_uint32 * pPointOffsetsBuffer, LibMCEnv_uint64 nLocalPartIDsBufferSize, LibMCEnv_uint64* pLocalPartIDsNeededCount, LibMCEnv_uint32 * pLocalPartIDsBuffer, LibMCEnv_uint64 nProfileIDsBufferSize, LibMCEnv_uint64* pProfileIDsNeededCount, LibMCEnv_uint32 * pProfileIDsBuffer) = 0;
+
+	/**
+	* IToolpathLayer::ExportProfileValueColumns - Exports profile values of all segments in one call. Values are resolved once per profile, not per segment. Values that are not numeric are exported as NaN.
+	* @param[in] nColumnsBufferSize - Number of elements in buffer
+	* @param[in] pColumnsBuffer - ToolpathProfileValueColumn buffer of Columns to export. JumpSpeed falls back to Speed, as in GetSegmentProfileTypedValue.
+	* @param[in] nValuesBufferSize - Number of elements in buffer
+	* @param[out] pValuesNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pValuesBuffer - double buffer of Segment major value table with SegmentCount * ColumnCount entries. The value of column c of segment i is at index i * ColumnCount + c.
+	*/
+	virtual void ExportProfileValueColumns(const LibMCEnv_uint64 nColumnsBufferSize, const LibMCEnv::sToolpathProfileValueColumn * pColumnsBuffer, LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_double * pValuesBuffer) = 0;
+
+	/**
+	* IToolpathLayer::ExportSegmentIntegerAttributes - Exports integer custom segment attributes of all segments in one call. Fails if an attribute does not exist or is not an integer attribute.
+	* @param[in] nAttributeIDsBufferSize - Number of elements in buffer
+	* @param[in] pAttributeIDsBuffer - uint32 buffer of IDs of the attributes to export.
+	* @param[in] nValuesBufferSize - Number of elements in buffer
+	* @param[out] pValuesNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pValuesBuffer - int64 buffer of Segment major value table with SegmentCount * AttributeCount entries.
+	*/
+	virtual void ExportSegmentIntegerAttributes(const LibMCEnv_uint64 nAttributeIDsBufferSize, const LibMCEnv_uint32 * pAttributeIDsBuffer, LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_int64 * pValuesBuffer) = 0;
+
+	/**
+	* IToolpathLayer::ExportPointData - Exports the points of all segments in one call. For type hatch, the points are taken pairwise.
+	* @param[in] nPointDataBufferSize - Number of elements in buffer
+	* @param[out] pPointDataNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pPointDataBuffer - Position2D buffer of The point data array of the layer. Positions are absolute in units.
+	*/
+	virtual void ExportPointData(LibMCEnv_uint64 nPointDataBufferSize, LibMCEnv_uint64* pPointDataNeededCount, LibMCEnv::sPosition2D * pPointDataBuffer) = 0;
+
+	/**
+	* IToolpathLayer::EncodeBinaryTiles - Encodes the whole layer in the binary tile format of the api/build/toolpathbinary request and returns the size and timings of the encoding. The tile tree is built for every call and not cached.
+	* @param[in] dResolutionInMM - Display resolution in mm. Primitives smaller than the resolution are skipped and coordinates are quantised to half of it. 0 encodes all points without quantisation.
+	* @param[out] nEncodedSize - Size of the binary response in bytes.
+	* @param[out] nTileCount - Number of tiles in the response.
+	* @param[out] nPointCount - Number of encoded points.
+	* @param[out] nTreeBuildTimeInMicroseconds - Time needed to build the tile tree.
+	* @param[out] nEncodingTimeInMicroseconds - Time needed to encode the response.
+	*/
+	virtual void EncodeBinaryTiles(const LibMCEnv_double dResolutionInMM, LibMCEnv_uint64 & nEncodedSize, LibMCEnv_uint32 & nTileCount, LibMCEnv_uint64 & nPointCount, LibMCEnv_uint64 & nTreeBuildTimeInMicroseconds, LibMCEnv_uint64 & nEncodingTimeInMicroseconds) = 0;
+
 };
 
 typedef IBaseSharedPtr<IToolpathLayer> PIToolpathLayer;
@@ -6154,6 +6832,19 @@ public:
 	*/
 	virtual void UnloadAllToolpathes() = 0;
 
+	/**
+	* IStateEnvironment::CreateSyntheticToolpath - Generates a reproducible random toolpath, stores it as temporary 3MF stream and loads it into memory. Even segments are hatches, odd segments are loops. Meant for tests and benchmarks of toolpath consumers.
+	* @param[in] sName - Name of the storage stream.
+	* @param[in] nLayerCount - Number of layers. MUST be positive.
+	* @param[in] nSegmentsPerLayer - Number of segments per layer. MUST be positive.
+	* @param[in] nPointsPerSegment - Number of points per segment. MUST be at least 3. Hatch segments use the next lower even number.
+	* @param[in] nProfileCount - Number of profiles that the segments cycle through. MUST be positive.
+	* @param[in] nLaserIndex - Laser index that all profiles are assigned to.
+	* @param[in] nSeed - Seed of the random geometry.
+	* @return Accessor of the loaded toolpath. The toolpath stays in memory until UnloadAllToolpathes is called.
+	*/
+	virtual IToolpathAccessor * CreateSyntheticToolpath(const std::string & sName, const LibMCEnv_uint32 nLayerCount, const LibMCEnv_uint32 nSegmentsPerLayer, const LibMCEnv_uint32 nPointsPerSegment, const LibMCEnv_uint32 nProfileCount, const LibMCEnv_uint32 nLaserIndex, const LibMCEnv_uint32 nSeed) = 0;
+
 	/**
 	* IStateEnvironment::SetNextState - sets the next state
 	* @param[in] sStateName - Name of next state
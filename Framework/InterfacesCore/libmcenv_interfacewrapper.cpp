@@ -631,6 +631,206 @@ LibMCEnvResult libmcenv_pngimagestoreoptions_setstorageformat(LibMCEnv_PNGImageS
 	}
 }
 
+LibMCEnvResult libmcenv_pngimagestoreoptions_getcompressionlevel(LibMCEnv_PNGImageStoreOptions pPNGImageStoreOptions, LibMCEnv_uint32 * pCompressionLevel)
+{
+	IBase* pIBaseClass = (IBase *)pPNGImageStoreOptions;
+
+	try {
+		if (pCompressionLevel == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IPNGImageStoreOptions* pIPNGImageStoreOptions = dynamic_cast<IPNGImageStoreOptions*>(pIBaseClass);
+		if (!pIPNGImageStoreOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pCompressionLevel = pIPNGImageStoreOptions->GetCompressionLevel();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_pngimagestoreoptions_setcompressionlevel(LibMCEnv_PNGImageStoreOptions pPNGImageStoreOptions, LibMCEnv_uint32 nCompressionLevel)
+{
+	IBase* pIBaseClass = (IBase *)pPNGImageStoreOptions;
+
+	try {
+		IPNGImageStoreOptions* pIPNGImageStoreOptions = dynamic_cast<IPNGImageStoreOptions*>(pIBaseClass);
+		if (!pIPNGImageStoreOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIPNGImageStoreOptions->SetCompressionLevel(nCompressionLevel);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_pngimagestoreoptions_getfilterstrategy(LibMCEnv_PNGImageStoreOptions pPNGImageStoreOptions, eLibMCEnvPNGFilterStrategy * pFilterStrategy)
+{
+	IBase* pIBaseClass = (IBase *)pPNGImageStoreOptions;
+
+	try {
+		if (pFilterStrategy == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IPNGImageStoreOptions* pIPNGImageStoreOptions = dynamic_cast<IPNGImageStoreOptions*>(pIBaseClass);
+		if (!pIPNGImageStoreOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pFilterStrategy = pIPNGImageStoreOptions->GetFilterStrategy();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_pngimagestoreoptions_setfilterstrategy(LibMCEnv_PNGImageStoreOptions pPNGImageStoreOptions, eLibMCEnvPNGFilterStrategy eFilterStrategy)
+{
+	IBase* pIBaseClass = (IBase *)pPNGImageStoreOptions;
+
+	try {
+		IPNGImageStoreOptions* pIPNGImageStoreOptions = dynamic_cast<IPNGImageStoreOptions*>(pIBaseClass);
+		if (!pIPNGImageStoreOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIPNGImageStoreOptions->SetFilterStrategy(eFilterStrategy);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_pngimagestoreoptions_getencoderbackend(LibMCEnv_PNGImageStoreOptions pPNGImageStoreOptions, eLibMCEnvPNGEncoderBackend * pEncoderBackend)
+{
+	IBase* pIBaseClass = (IBase *)pPNGImageStoreOptions;
+
+	try {
+		if (pEncoderBackend == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IPNGImageStoreOptions* pIPNGImageStoreOptions = dynamic_cast<IPNGImageStoreOptions*>(pIBaseClass);
+		if (!pIPNGImageStoreOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pEncoderBackend = pIPNGImageStoreOptions->GetEncoderBackend();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_pngimagestoreoptions_setencoderbackend(LibMCEnv_PNGImageStoreOptions pPNGImageStoreOptions, eLibMCEnvPNGEncoderBackend eEncoderBackend)
+{
+	IBase* pIBaseClass = (IBase *)pPNGImageStoreOptions;
+
+	try {
+		IPNGImageStoreOptions* pIPNGImageStoreOptions = dynamic_cast<IPNGImageStoreOptions*>(pIBaseClass);
+		if (!pIPNGImageStoreOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIPNGImageStoreOptions->SetEncoderBackend(eEncoderBackend);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_pngimagestoreoptions_getthreadcount(LibMCEnv_PNGImageStoreOptions pPNGImageStoreOptions, LibMCEnv_uint32 * pThreadCount)
+{
+	IBase* pIBaseClass = (IBase *)pPNGImageStoreOptions;
+
+	try {
+		if (pThreadCount == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IPNGImageStoreOptions* pIPNGImageStoreOptions = dynamic_cast<IPNGImageStoreOptions*>(pIBaseClass);
+		if (!pIPNGImageStoreOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pThreadCount = pIPNGImageStoreOptions->GetThreadCount();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_pngimagestoreoptions_setthreadcount(LibMCEnv_PNGImageStoreOptions pPNGImageStoreOptions, LibMCEnv_uint32 nThreadCount)
+{
+	IBase* pIBaseClass = (IBase *)pPNGImageStoreOptions;
+
+	try {
+		IPNGImageStoreOptions* pIPNGImageStoreOptions = dynamic_cast<IPNGImageStoreOptions*>(pIBaseClass);
+		if (!pIPNGImageStoreOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIPNGImageStoreOptions->SetThreadCount(nThreadCount);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 /*************************************************************************************************************************
  Class implementation for PNGImageData
@@ -1687,6 +1887,34 @@ LibMCEnvResult libmcenv_scatterplot_getboundaries(LibMCEnv_ScatterPlot pScatterP
 	}
 }
 
+LibMCEnvResult libmcenv_scatterplot_querydensity(LibMCEnv_ScatterPlot pScatterPlot, LibMCEnv_double dMinX, LibMCEnv_double dMinY, LibMCEnv_double dMaxX, LibMCEnv_double dMaxY, LibMCEnv_uint32 nResolutionX, LibMCEnv_uint32 nResolutionY, const LibMCEnv_uint64 nPositionsBufferSize, LibMCEnv_uint64* pPositionsNeededCount, sLibMCEnvFloatPosition2D * pPositionsBuffer, const LibMCEnv_uint64 nCountsBufferSize, LibMCEnv_uint64* pCountsNeededCount, LibMCEnv_uint32 * pCountsBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pScatterPlot;
+
+	try {
+		if ((!pPositionsBuffer) && !(pPositionsNeededCount))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if ((!pCountsBuffer) && !(pCountsNeededCount))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IScatterPlot* pIScatterPlot = dynamic_cast<IScatterPlot*>(pIBaseClass);
+		if (!pIScatterPlot)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIScatterPlot->QueryDensity(dMinX, dMinY, dMaxX, dMaxY, nResolutionX, nResolutionY, nPositionsBufferSize, pPositionsNeededCount, pPositionsBuffer, nCountsBufferSize, pCountsNeededCount, pCountsBuffer);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 LibMCEnvResult libmcenv_scatterplot_release(LibMCEnv_ScatterPlot pScatterPlot)
 {
 	IBase* pIBaseClass = (IBase *)pScatterPlot;
@@ -2322,49 +2550,19 @@ LibMCEnvResult libmcenv_discretefielddata2d_duplicate(LibMCEnv_DiscreteFieldData
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for DataTableWriteOptions
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for DataTableCSVWriteOptions
-**************************************************************************************************************************/
-LibMCEnvResult libmcenv_datatablecsvwriteoptions_getseparator(LibMCEnv_DataTableCSVWriteOptions pDataTableCSVWriteOptions, const LibMCEnv_uint32 nSeparatorBufferSize, LibMCEnv_uint32* pSeparatorNeededChars, char * pSeparatorBuffer)
+LibMCEnvResult libmcenv_discretefielddata2d_getstorageprecision(LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, eLibMCEnvFieldStoragePrecision * pStoragePrecision)
 {
-	IBase* pIBaseClass = (IBase *)pDataTableCSVWriteOptions;
+	IBase* pIBaseClass = (IBase *)pDiscreteFieldData2D;
 
 	try {
-		if ( (!pSeparatorBuffer) && !(pSeparatorNeededChars) )
+		if (pStoragePrecision == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sSeparator("");
-		IDataTableCSVWriteOptions* pIDataTableCSVWriteOptions = dynamic_cast<IDataTableCSVWriteOptions*>(pIBaseClass);
-		if (!pIDataTableCSVWriteOptions)
+		IDiscreteFieldData2D* pIDiscreteFieldData2D = dynamic_cast<IDiscreteFieldData2D*>(pIBaseClass);
+		if (!pIDiscreteFieldData2D)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pSeparatorBuffer == nullptr);
-		if (isCacheCall) {
-			sSeparator = pIDataTableCSVWriteOptions->GetSeparator();
+		*pStoragePrecision = pIDiscreteFieldData2D->GetStoragePrecision();
 
-			pIDataTableCSVWriteOptions->_setCache (new ParameterCache_1<std::string> (sSeparator));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDataTableCSVWriteOptions->_getCache ());
-			if (cache == nullptr)
-				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
-			cache->retrieveData (sSeparator);
-			pIDataTableCSVWriteOptions->_setCache (nullptr);
-		}
-		
-		if (pSeparatorNeededChars)
-			*pSeparatorNeededChars = (LibMCEnv_uint32) (sSeparator.size()+1);
-		if (pSeparatorBuffer) {
-			if (sSeparator.size() >= nSeparatorBufferSize)
-				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
-			for (size_t iSeparator = 0; iSeparator < sSeparator.size(); iSeparator++)
-				pSeparatorBuffer[iSeparator] = sSeparator[iSeparator];
-			pSeparatorBuffer[sSeparator.size()] = 0;
-		}
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -2378,19 +2576,16 @@ LibMCEnvResult libmcenv_datatablecsvwriteoptions_getseparator(LibMCEnv_DataTable
 	}
 }
 
-LibMCEnvResult libmcenv_datatablecsvwriteoptions_setseparator(LibMCEnv_DataTableCSVWriteOptions pDataTableCSVWriteOptions, const char * pSeparator)
+LibMCEnvResult libmcenv_discretefielddata2d_setstorageprecision(LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, eLibMCEnvFieldStoragePrecision eStoragePrecision)
 {
-	IBase* pIBaseClass = (IBase *)pDataTableCSVWriteOptions;
+	IBase* pIBaseClass = (IBase *)pDiscreteFieldData2D;
 
 	try {
-		if (pSeparator == nullptr)
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sSeparator(pSeparator);
-		IDataTableCSVWriteOptions* pIDataTableCSVWriteOptions = dynamic_cast<IDataTableCSVWriteOptions*>(pIBaseClass);
-		if (!pIDataTableCSVWriteOptions)
+		IDiscreteFieldData2D* pIDiscreteFieldData2D = dynamic_cast<IDiscreteFieldData2D*>(pIBaseClass);
+		if (!pIDiscreteFieldData2D)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTableCSVWriteOptions->SetSeparator(sSeparator);
+		pIDiscreteFieldData2D->SetStoragePrecision(eStoragePrecision);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -2405,23 +2600,1974 @@ LibMCEnvResult libmcenv_datatablecsvwriteoptions_setseparator(LibMCEnv_DataTable
 	}
 }
 
+LibMCEnvResult libmcenv_discretefielddata2d_getstoragelayout(LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, eLibMCEnvFieldStorageLayout * pStorageLayout)
+{
+	IBase* pIBaseClass = (IBase *)pDiscreteFieldData2D;
+
+	try {
+		if (pStorageLayout == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDiscreteFieldData2D* pIDiscreteFieldData2D = dynamic_cast<IDiscreteFieldData2D*>(pIBaseClass);
+		if (!pIDiscreteFieldData2D)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pStorageLayout = pIDiscreteFieldData2D->GetStorageLayout();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_discretefielddata2d_setstoragelayout(LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, eLibMCEnvFieldStorageLayout eStorageLayout)
+{
+	IBase* pIBaseClass = (IBase *)pDiscreteFieldData2D;
+
+	try {
+		IDiscreteFieldData2D* pIDiscreteFieldData2D = dynamic_cast<IDiscreteFieldData2D*>(pIBaseClass);
+		if (!pIDiscreteFieldData2D)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDiscreteFieldData2D->SetStorageLayout(eStorageLayout);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_discretefielddata2d_getstoragesize(LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, LibMCEnv_uint64 * pStorageSize)
+{
+	IBase* pIBaseClass = (IBase *)pDiscreteFieldData2D;
+
+	try {
+		if (pStorageSize == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDiscreteFieldData2D* pIDiscreteFieldData2D = dynamic_cast<IDiscreteFieldData2D*>(pIBaseClass);
+		if (!pIDiscreteFieldData2D)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pStorageSize = pIDiscreteFieldData2D->GetStorageSize();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_discretefielddata2d_compact(LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D)
+{
+	IBase* pIBaseClass = (IBase *)pDiscreteFieldData2D;
+
+	try {
+		IDiscreteFieldData2D* pIDiscreteFieldData2D = dynamic_cast<IDiscreteFieldData2D*>(pIBaseClass);
+		if (!pIDiscreteFieldData2D)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDiscreteFieldData2D->Compact();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_discretefielddata2d_getthreadcount(LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, LibMCEnv_uint32 * pThreadCount)
+{
+	IBase* pIBaseClass = (IBase *)pDiscreteFieldData2D;
+
+	try {
+		if (pThreadCount == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDiscreteFieldData2D* pIDiscreteFieldData2D = dynamic_cast<IDiscreteFieldData2D*>(pIBaseClass);
+		if (!pIDiscreteFieldData2D)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pThreadCount = pIDiscreteFieldData2D->GetThreadCount();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_discretefielddata2d_setthreadcount(LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, LibMCEnv_uint32 nThreadCount)
+{
+	IBase* pIBaseClass = (IBase *)pDiscreteFieldData2D;
+
+	try {
+		IDiscreteFieldData2D* pIDiscreteFieldData2D = dynamic_cast<IDiscreteFieldData2D*>(pIBaseClass);
+		if (!pIDiscreteFieldData2D)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDiscreteFieldData2D->SetThreadCount(nThreadCount);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_discretefielddata2d_setsimdkernelsenabled(LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, bool bEnabled)
+{
+	IBase* pIBaseClass = (IBase *)pDiscreteFieldData2D;
+
+	try {
+		IDiscreteFieldData2D* pIDiscreteFieldData2D = dynamic_cast<IDiscreteFieldData2D*>(pIBaseClass);
+		if (!pIDiscreteFieldData2D)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDiscreteFieldData2D->SetSIMDKernelsEnabled(bEnabled);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_discretefielddata2d_getsimdkernelname(LibMCEnv_DiscreteFieldData2D pDiscreteFieldData2D, const LibMCEnv_uint32 nKernelNameBufferSize, LibMCEnv_uint32* pKernelNameNeededChars, char * pKernelNameBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pDiscreteFieldData2D;
+
+	try {
+		if ( (!pKernelNameBuffer) && !(pKernelNameNeededChars) )
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sKernelName("");
+		IDiscreteFieldData2D* pIDiscreteFieldData2D = dynamic_cast<IDiscreteFieldData2D*>(pIBaseClass);
+		if (!pIDiscreteFieldData2D)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pKernelNameBuffer == nullptr);
+		if (isCacheCall) {
+			sKernelName = pIDiscreteFieldData2D->GetSIMDKernelName();
+
+			pIDiscreteFieldData2D->_setCache (new ParameterCache_1<std::string> (sKernelName));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDiscreteFieldData2D->_getCache ());
+			if (cache == nullptr)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+			cache->retrieveData (sKernelName);
+			pIDiscreteFieldData2D->_setCache (nullptr);
+		}
+		
+		if (pKernelNameNeededChars)
+			*pKernelNameNeededChars = (LibMCEnv_uint32) (sKernelName.size()+1);
+		if (pKernelNameBuffer) {
+			if (sKernelName.size() >= nKernelNameBufferSize)
+				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
+			for (size_t iKernelName = 0; iKernelName < sKernelName.size(); iKernelName++)
+				pKernelNameBuffer[iKernelName] = sKernelName[iKernelName];
+			pKernelNameBuffer[sKernelName.size()] = 0;
+		}
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+
+/*************************************************************************************************************************
+ Class implementation for DataTableWriteOptions
+**************************************************************************************************************************/
+LibMCEnvResult libmcenv_datatablewriteoptions_resettodefaults(LibMCEnv_DataTableWriteOptions pDataTableWriteOptions)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableWriteOptions;
+
+	try {
+		IDataTableWriteOptions* pIDataTableWriteOptions = dynamic_cast<IDataTableWriteOptions*>(pIBaseClass);
+		if (!pIDataTableWriteOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableWriteOptions->ResetToDefaults();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablewriteoptions_getdefaultencoding(LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, eLibMCEnvDataTableColumnEncoding * pEncoding)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableWriteOptions;
+
+	try {
+		if (pEncoding == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableWriteOptions* pIDataTableWriteOptions = dynamic_cast<IDataTableWriteOptions*>(pIBaseClass);
+		if (!pIDataTableWriteOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pEncoding = pIDataTableWriteOptions->GetDefaultEncoding();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablewriteoptions_setdefaultencoding(LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, eLibMCEnvDataTableColumnEncoding eEncoding)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableWriteOptions;
+
+	try {
+		IDataTableWriteOptions* pIDataTableWriteOptions = dynamic_cast<IDataTableWriteOptions*>(pIBaseClass);
+		if (!pIDataTableWriteOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableWriteOptions->SetDefaultEncoding(eEncoding);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablewriteoptions_getcolumnencoding(LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, const char * pIdentifier, eLibMCEnvDataTableColumnEncoding * pEncoding)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableWriteOptions;
+
+	try {
+		if (pIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (pEncoding == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IDataTableWriteOptions* pIDataTableWriteOptions = dynamic_cast<IDataTableWriteOptions*>(pIBaseClass);
+		if (!pIDataTableWriteOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pEncoding = pIDataTableWriteOptions->GetColumnEncoding(sIdentifier);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablewriteoptions_setcolumnencoding(LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, const char * pIdentifier, eLibMCEnvDataTableColumnEncoding eEncoding)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableWriteOptions;
+
+	try {
+		if (pIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IDataTableWriteOptions* pIDataTableWriteOptions = dynamic_cast<IDataTableWriteOptions*>(pIBaseClass);
+		if (!pIDataTableWriteOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableWriteOptions->SetColumnEncoding(sIdentifier, eEncoding);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablewriteoptions_clearcolumnencodings(LibMCEnv_DataTableWriteOptions pDataTableWriteOptions)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableWriteOptions;
+
+	try {
+		IDataTableWriteOptions* pIDataTableWriteOptions = dynamic_cast<IDataTableWriteOptions*>(pIBaseClass);
+		if (!pIDataTableWriteOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableWriteOptions->ClearColumnEncodings();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablewriteoptions_getcompression(LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, eLibMCEnvDataTableCompression * pCompression)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableWriteOptions;
+
+	try {
+		if (pCompression == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableWriteOptions* pIDataTableWriteOptions = dynamic_cast<IDataTableWriteOptions*>(pIBaseClass);
+		if (!pIDataTableWriteOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pCompression = pIDataTableWriteOptions->GetCompression();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablewriteoptions_setcompression(LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, eLibMCEnvDataTableCompression eCompression)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableWriteOptions;
+
+	try {
+		IDataTableWriteOptions* pIDataTableWriteOptions = dynamic_cast<IDataTableWriteOptions*>(pIBaseClass);
+		if (!pIDataTableWriteOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableWriteOptions->SetCompression(eCompression);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablewriteoptions_getcompressionlevel(LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, LibMCEnv_uint32 * pCompressionLevel)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableWriteOptions;
+
+	try {
+		if (pCompressionLevel == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableWriteOptions* pIDataTableWriteOptions = dynamic_cast<IDataTableWriteOptions*>(pIBaseClass);
+		if (!pIDataTableWriteOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pCompressionLevel = pIDataTableWriteOptions->GetCompressionLevel();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablewriteoptions_setcompressionlevel(LibMCEnv_DataTableWriteOptions pDataTableWriteOptions, LibMCEnv_uint32 nCompressionLevel)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableWriteOptions;
+
+	try {
+		IDataTableWriteOptions* pIDataTableWriteOptions = dynamic_cast<IDataTableWriteOptions*>(pIBaseClass);
+		if (!pIDataTableWriteOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableWriteOptions->SetCompressionLevel(nCompressionLevel);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+/*************************************************************************************************************************
+ Class implementation for DataTableCSVWriteOptions
+**************************************************************************************************************************/
+LibMCEnvResult libmcenv_datatablecsvwriteoptions_getseparator(LibMCEnv_DataTableCSVWriteOptions pDataTableCSVWriteOptions, const LibMCEnv_uint32 nSeparatorBufferSize, LibMCEnv_uint32* pSeparatorNeededChars, char * pSeparatorBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableCSVWriteOptions;
+
+	try {
+		if ( (!pSeparatorBuffer) && !(pSeparatorNeededChars) )
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sSeparator("");
+		IDataTableCSVWriteOptions* pIDataTableCSVWriteOptions = dynamic_cast<IDataTableCSVWriteOptions*>(pIBaseClass);
+		if (!pIDataTableCSVWriteOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pSeparatorBuffer == nullptr);
+		if (isCacheCall) {
+			sSeparator = pIDataTableCSVWriteOptions->GetSeparator();
+
+			pIDataTableCSVWriteOptions->_setCache (new ParameterCache_1<std::string> (sSeparator));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDataTableCSVWriteOptions->_getCache ());
+			if (cache == nullptr)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+			cache->retrieveData (sSeparator);
+			pIDataTableCSVWriteOptions->_setCache (nullptr);
+		}
+		
+		if (pSeparatorNeededChars)
+			*pSeparatorNeededChars = (LibMCEnv_uint32) (sSeparator.size()+1);
+		if (pSeparatorBuffer) {
+			if (sSeparator.size() >= nSeparatorBufferSize)
+				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
+			for (size_t iSeparator = 0; iSeparator < sSeparator.size(); iSeparator++)
+				pSeparatorBuffer[iSeparator] = sSeparator[iSeparator];
+			pSeparatorBuffer[sSeparator.size()] = 0;
+		}
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablecsvwriteoptions_setseparator(LibMCEnv_DataTableCSVWriteOptions pDataTableCSVWriteOptions, const char * pSeparator)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableCSVWriteOptions;
+
+	try {
+		if (pSeparator == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sSeparator(pSeparator);
+		IDataTableCSVWriteOptions* pIDataTableCSVWriteOptions = dynamic_cast<IDataTableCSVWriteOptions*>(pIBaseClass);
+		if (!pIDataTableCSVWriteOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableCSVWriteOptions->SetSeparator(sSeparator);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+
+/*************************************************************************************************************************
+ Class implementation for DataTableScatterPlotOptions
+**************************************************************************************************************************/
+LibMCEnvResult libmcenv_datatablescatterplotoptions_setxaxiscolumn(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const char * pColumnIdentifier, LibMCEnv_double dScaleFactor, LibMCEnv_double dOffsetFactor)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+
+	try {
+		if (pColumnIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sColumnIdentifier(pColumnIdentifier);
+		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
+		if (!pIDataTableScatterPlotOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableScatterPlotOptions->SetXAxisColumn(sColumnIdentifier, dScaleFactor, dOffsetFactor);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablescatterplotoptions_getxaxiscolumn(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+
+	try {
+		if ( (!pColumnIdentifierBuffer) && !(pColumnIdentifierNeededChars) )
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sColumnIdentifier("");
+		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
+		if (!pIDataTableScatterPlotOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pColumnIdentifierBuffer == nullptr);
+		if (isCacheCall) {
+			sColumnIdentifier = pIDataTableScatterPlotOptions->GetXAxisColumn();
+
+			pIDataTableScatterPlotOptions->_setCache (new ParameterCache_1<std::string> (sColumnIdentifier));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDataTableScatterPlotOptions->_getCache ());
+			if (cache == nullptr)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+			cache->retrieveData (sColumnIdentifier);
+			pIDataTableScatterPlotOptions->_setCache (nullptr);
+		}
+		
+		if (pColumnIdentifierNeededChars)
+			*pColumnIdentifierNeededChars = (LibMCEnv_uint32) (sColumnIdentifier.size()+1);
+		if (pColumnIdentifierBuffer) {
+			if (sColumnIdentifier.size() >= nColumnIdentifierBufferSize)
+				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
+			for (size_t iColumnIdentifier = 0; iColumnIdentifier < sColumnIdentifier.size(); iColumnIdentifier++)
+				pColumnIdentifierBuffer[iColumnIdentifier] = sColumnIdentifier[iColumnIdentifier];
+			pColumnIdentifierBuffer[sColumnIdentifier.size()] = 0;
+		}
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablescatterplotoptions_getxaxisscaling(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, LibMCEnv_double * pScaleFactor)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+
+	try {
+		if (pScaleFactor == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
+		if (!pIDataTableScatterPlotOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pScaleFactor = pIDataTableScatterPlotOptions->GetXAxisScaling();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablescatterplotoptions_getxaxisoffset(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, LibMCEnv_double * pOffsetFactor)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+
+	try {
+		if (pOffsetFactor == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
+		if (!pIDataTableScatterPlotOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pOffsetFactor = pIDataTableScatterPlotOptions->GetXAxisOffset();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablescatterplotoptions_setyaxiscolumn(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const char * pColumnIdentifier, LibMCEnv_double dScaleFactor, LibMCEnv_double dOffsetFactor)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+
+	try {
+		if (pColumnIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sColumnIdentifier(pColumnIdentifier);
+		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
+		if (!pIDataTableScatterPlotOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableScatterPlotOptions->SetYAxisColumn(sColumnIdentifier, dScaleFactor, dOffsetFactor);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablescatterplotoptions_getyaxiscolumn(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+
+	try {
+		if ( (!pColumnIdentifierBuffer) && !(pColumnIdentifierNeededChars) )
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sColumnIdentifier("");
+		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
+		if (!pIDataTableScatterPlotOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pColumnIdentifierBuffer == nullptr);
+		if (isCacheCall) {
+			sColumnIdentifier = pIDataTableScatterPlotOptions->GetYAxisColumn();
+
+			pIDataTableScatterPlotOptions->_setCache (new ParameterCache_1<std::string> (sColumnIdentifier));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDataTableScatterPlotOptions->_getCache ());
+			if (cache == nullptr)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+			cache->retrieveData (sColumnIdentifier);
+			pIDataTableScatterPlotOptions->_setCache (nullptr);
+		}
+		
+		if (pColumnIdentifierNeededChars)
+			*pColumnIdentifierNeededChars = (LibMCEnv_uint32) (sColumnIdentifier.size()+1);
+		if (pColumnIdentifierBuffer) {
+			if (sColumnIdentifier.size() >= nColumnIdentifierBufferSize)
+				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
+			for (size_t iColumnIdentifier = 0; iColumnIdentifier < sColumnIdentifier.size(); iColumnIdentifier++)
+				pColumnIdentifierBuffer[iColumnIdentifier] = sColumnIdentifier[iColumnIdentifier];
+			pColumnIdentifierBuffer[sColumnIdentifier.size()] = 0;
+		}
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablescatterplotoptions_getyaxisscaling(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, LibMCEnv_double * pScaleFactor)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+
+	try {
+		if (pScaleFactor == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
+		if (!pIDataTableScatterPlotOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pScaleFactor = pIDataTableScatterPlotOptions->GetYAxisScaling();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablescatterplotoptions_getyaxisoffset(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, LibMCEnv_double * pOffsetFactor)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+
+	try {
+		if (pOffsetFactor == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
+		if (!pIDataTableScatterPlotOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pOffsetFactor = pIDataTableScatterPlotOptions->GetYAxisOffset();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablescatterplotoptions_adddatachannel(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const char * pChannelIdentifier, const char * pColumnIdentifier, LibMCEnv_double dScaleFactor, LibMCEnv_double dOffsetFactor, LibMCEnv_uint32 nColor)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+
+	try {
+		if (pChannelIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (pColumnIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sChannelIdentifier(pChannelIdentifier);
+		std::string sColumnIdentifier(pColumnIdentifier);
+		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
+		if (!pIDataTableScatterPlotOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableScatterPlotOptions->AddDataChannel(sChannelIdentifier, sColumnIdentifier, dScaleFactor, dOffsetFactor, nColor);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+
+/*************************************************************************************************************************
+ Class implementation for DataTableFilter
+*************************************************************************************************************************/
+LibMCEnvResult libmcenv_datatablefilter_addcondition(LibMCEnv_DataTableFilter pDataTableFilter, const char * pColumnIdentifier, eLibMCEnvDataTableFilterOperator eOperator, LibMCEnv_double dValue, LibMCEnv_double dUpperValue)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableFilter;
+
+	try {
+		if (pColumnIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sColumnIdentifier(pColumnIdentifier);
+		IDataTableFilter* pIDataTableFilter = dynamic_cast<IDataTableFilter*>(pIBaseClass);
+		if (!pIDataTableFilter)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableFilter->AddCondition(sColumnIdentifier, eOperator, dValue, dUpperValue);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablefilter_getconditioncount(LibMCEnv_DataTableFilter pDataTableFilter, LibMCEnv_uint32 * pConditionCount)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableFilter;
+
+	try {
+		if (pConditionCount == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableFilter* pIDataTableFilter = dynamic_cast<IDataTableFilter*>(pIBaseClass);
+		if (!pIDataTableFilter)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pConditionCount = pIDataTableFilter->GetConditionCount();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablefilter_getconditioncolumn(LibMCEnv_DataTableFilter pDataTableFilter, LibMCEnv_uint32 nIndex, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableFilter;
+
+	try {
+		if ( (!pColumnIdentifierBuffer) && !(pColumnIdentifierNeededChars) )
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sColumnIdentifier("");
+		IDataTableFilter* pIDataTableFilter = dynamic_cast<IDataTableFilter*>(pIBaseClass);
+		if (!pIDataTableFilter)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pColumnIdentifierBuffer == nullptr);
+		if (isCacheCall) {
+			sColumnIdentifier = pIDataTableFilter->GetConditionColumn(nIndex);
+
+			pIDataTableFilter->_setCache (new ParameterCache_1<std::string> (sColumnIdentifier));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDataTableFilter->_getCache ());
+			if (cache == nullptr)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+			cache->retrieveData (sColumnIdentifier);
+			pIDataTableFilter->_setCache (nullptr);
+		}
+		
+		if (pColumnIdentifierNeededChars)
+			*pColumnIdentifierNeededChars = (LibMCEnv_uint32) (sColumnIdentifier.size()+1);
+		if (pColumnIdentifierBuffer) {
+			if (sColumnIdentifier.size() >= nColumnIdentifierBufferSize)
+				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
+			for (size_t iColumnIdentifier = 0; iColumnIdentifier < sColumnIdentifier.size(); iColumnIdentifier++)
+				pColumnIdentifierBuffer[iColumnIdentifier] = sColumnIdentifier[iColumnIdentifier];
+			pColumnIdentifierBuffer[sColumnIdentifier.size()] = 0;
+		}
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablefilter_getconditionoperator(LibMCEnv_DataTableFilter pDataTableFilter, LibMCEnv_uint32 nIndex, eLibMCEnvDataTableFilterOperator * pOperator)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableFilter;
+
+	try {
+		if (pOperator == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableFilter* pIDataTableFilter = dynamic_cast<IDataTableFilter*>(pIBaseClass);
+		if (!pIDataTableFilter)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pOperator = pIDataTableFilter->GetConditionOperator(nIndex);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablefilter_getconditionvalue(LibMCEnv_DataTableFilter pDataTableFilter, LibMCEnv_uint32 nIndex, LibMCEnv_double * pValue)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableFilter;
+
+	try {
+		if (pValue == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableFilter* pIDataTableFilter = dynamic_cast<IDataTableFilter*>(pIBaseClass);
+		if (!pIDataTableFilter)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pValue = pIDataTableFilter->GetConditionValue(nIndex);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablefilter_getconditionuppervalue(LibMCEnv_DataTableFilter pDataTableFilter, LibMCEnv_uint32 nIndex, LibMCEnv_double * pUpperValue)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableFilter;
+
+	try {
+		if (pUpperValue == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableFilter* pIDataTableFilter = dynamic_cast<IDataTableFilter*>(pIBaseClass);
+		if (!pIDataTableFilter)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pUpperValue = pIDataTableFilter->GetConditionUpperValue(nIndex);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablefilter_clear(LibMCEnv_DataTableFilter pDataTableFilter)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableFilter;
+
+	try {
+		IDataTableFilter* pIDataTableFilter = dynamic_cast<IDataTableFilter*>(pIBaseClass);
+		if (!pIDataTableFilter)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableFilter->Clear();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+/*************************************************************************************************************************
+ Class implementation for DataTableSortOptions
+*************************************************************************************************************************/
+LibMCEnvResult libmcenv_datatablesortoptions_addsortcolumn(LibMCEnv_DataTableSortOptions pDataTableSortOptions, const char * pColumnIdentifier, bool bDescending)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableSortOptions;
+
+	try {
+		if (pColumnIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sColumnIdentifier(pColumnIdentifier);
+		IDataTableSortOptions* pIDataTableSortOptions = dynamic_cast<IDataTableSortOptions*>(pIBaseClass);
+		if (!pIDataTableSortOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableSortOptions->AddSortColumn(sColumnIdentifier, bDescending);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablesortoptions_getsortcolumncount(LibMCEnv_DataTableSortOptions pDataTableSortOptions, LibMCEnv_uint32 * pSortColumnCount)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableSortOptions;
+
+	try {
+		if (pSortColumnCount == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableSortOptions* pIDataTableSortOptions = dynamic_cast<IDataTableSortOptions*>(pIBaseClass);
+		if (!pIDataTableSortOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pSortColumnCount = pIDataTableSortOptions->GetSortColumnCount();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablesortoptions_getsortcolumn(LibMCEnv_DataTableSortOptions pDataTableSortOptions, LibMCEnv_uint32 nIndex, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableSortOptions;
+
+	try {
+		if ( (!pColumnIdentifierBuffer) && !(pColumnIdentifierNeededChars) )
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sColumnIdentifier("");
+		IDataTableSortOptions* pIDataTableSortOptions = dynamic_cast<IDataTableSortOptions*>(pIBaseClass);
+		if (!pIDataTableSortOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pColumnIdentifierBuffer == nullptr);
+		if (isCacheCall) {
+			sColumnIdentifier = pIDataTableSortOptions->GetSortColumn(nIndex);
+
+			pIDataTableSortOptions->_setCache (new ParameterCache_1<std::string> (sColumnIdentifier));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDataTableSortOptions->_getCache ());
+			if (cache == nullptr)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+			cache->retrieveData (sColumnIdentifier);
+			pIDataTableSortOptions->_setCache (nullptr);
+		}
+		
+		if (pColumnIdentifierNeededChars)
+			*pColumnIdentifierNeededChars = (LibMCEnv_uint32) (sColumnIdentifier.size()+1);
+		if (pColumnIdentifierBuffer) {
+			if (sColumnIdentifier.size() >= nColumnIdentifierBufferSize)
+				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
+			for (size_t iColumnIdentifier = 0; iColumnIdentifier < sColumnIdentifier.size(); iColumnIdentifier++)
+				pColumnIdentifierBuffer[iColumnIdentifier] = sColumnIdentifier[iColumnIdentifier];
+			pColumnIdentifierBuffer[sColumnIdentifier.size()] = 0;
+		}
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablesortoptions_getsortcolumndescending(LibMCEnv_DataTableSortOptions pDataTableSortOptions, LibMCEnv_uint32 nIndex, bool * pDescending)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableSortOptions;
+
+	try {
+		if (pDescending == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableSortOptions* pIDataTableSortOptions = dynamic_cast<IDataTableSortOptions*>(pIBaseClass);
+		if (!pIDataTableSortOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pDescending = pIDataTableSortOptions->GetSortColumnDescending(nIndex);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatablesortoptions_clear(LibMCEnv_DataTableSortOptions pDataTableSortOptions)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableSortOptions;
+
+	try {
+		IDataTableSortOptions* pIDataTableSortOptions = dynamic_cast<IDataTableSortOptions*>(pIBaseClass);
+		if (!pIDataTableSortOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableSortOptions->Clear();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+/*************************************************************************************************************************
+ Class implementation for DataTableAggregationOptions
+*************************************************************************************************************************/
+LibMCEnvResult libmcenv_datatableaggregationoptions_addgroupcolumn(LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions, const char * pColumnIdentifier)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableAggregationOptions;
+
+	try {
+		if (pColumnIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sColumnIdentifier(pColumnIdentifier);
+		IDataTableAggregationOptions* pIDataTableAggregationOptions = dynamic_cast<IDataTableAggregationOptions*>(pIBaseClass);
+		if (!pIDataTableAggregationOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableAggregationOptions->AddGroupColumn(sColumnIdentifier);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableaggregationoptions_getgroupcolumncount(LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions, LibMCEnv_uint32 * pGroupColumnCount)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableAggregationOptions;
+
+	try {
+		if (pGroupColumnCount == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableAggregationOptions* pIDataTableAggregationOptions = dynamic_cast<IDataTableAggregationOptions*>(pIBaseClass);
+		if (!pIDataTableAggregationOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pGroupColumnCount = pIDataTableAggregationOptions->GetGroupColumnCount();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableaggregationoptions_getgroupcolumn(LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions, LibMCEnv_uint32 nIndex, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableAggregationOptions;
+
+	try {
+		if ( (!pColumnIdentifierBuffer) && !(pColumnIdentifierNeededChars) )
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sColumnIdentifier("");
+		IDataTableAggregationOptions* pIDataTableAggregationOptions = dynamic_cast<IDataTableAggregationOptions*>(pIBaseClass);
+		if (!pIDataTableAggregationOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pColumnIdentifierBuffer == nullptr);
+		if (isCacheCall) {
+			sColumnIdentifier = pIDataTableAggregationOptions->GetGroupColumn(nIndex);
+
+			pIDataTableAggregationOptions->_setCache (new ParameterCache_1<std::string> (sColumnIdentifier));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDataTableAggregationOptions->_getCache ());
+			if (cache == nullptr)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+			cache->retrieveData (sColumnIdentifier);
+			pIDataTableAggregationOptions->_setCache (nullptr);
+		}
+		
+		if (pColumnIdentifierNeededChars)
+			*pColumnIdentifierNeededChars = (LibMCEnv_uint32) (sColumnIdentifier.size()+1);
+		if (pColumnIdentifierBuffer) {
+			if (sColumnIdentifier.size() >= nColumnIdentifierBufferSize)
+				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
+			for (size_t iColumnIdentifier = 0; iColumnIdentifier < sColumnIdentifier.size(); iColumnIdentifier++)
+				pColumnIdentifierBuffer[iColumnIdentifier] = sColumnIdentifier[iColumnIdentifier];
+			pColumnIdentifierBuffer[sColumnIdentifier.size()] = 0;
+		}
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableaggregationoptions_addaggregation(LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions, const char * pResultIdentifier, const char * pColumnIdentifier, eLibMCEnvDataTableAggregation eAggregation)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableAggregationOptions;
+
+	try {
+		if (pResultIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (pColumnIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sResultIdentifier(pResultIdentifier);
+		std::string sColumnIdentifier(pColumnIdentifier);
+		IDataTableAggregationOptions* pIDataTableAggregationOptions = dynamic_cast<IDataTableAggregationOptions*>(pIBaseClass);
+		if (!pIDataTableAggregationOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableAggregationOptions->AddAggregation(sResultIdentifier, sColumnIdentifier, eAggregation);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableaggregationoptions_getaggregationcount(LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions, LibMCEnv_uint32 * pAggregationCount)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableAggregationOptions;
+
+	try {
+		if (pAggregationCount == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableAggregationOptions* pIDataTableAggregationOptions = dynamic_cast<IDataTableAggregationOptions*>(pIBaseClass);
+		if (!pIDataTableAggregationOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pAggregationCount = pIDataTableAggregationOptions->GetAggregationCount();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableaggregationoptions_getaggregationresultidentifier(LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions, LibMCEnv_uint32 nIndex, const LibMCEnv_uint32 nResultIdentifierBufferSize, LibMCEnv_uint32* pResultIdentifierNeededChars, char * pResultIdentifierBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableAggregationOptions;
+
+	try {
+		if ( (!pResultIdentifierBuffer) && !(pResultIdentifierNeededChars) )
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sResultIdentifier("");
+		IDataTableAggregationOptions* pIDataTableAggregationOptions = dynamic_cast<IDataTableAggregationOptions*>(pIBaseClass);
+		if (!pIDataTableAggregationOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pResultIdentifierBuffer == nullptr);
+		if (isCacheCall) {
+			sResultIdentifier = pIDataTableAggregationOptions->GetAggregationResultIdentifier(nIndex);
+
+			pIDataTableAggregationOptions->_setCache (new ParameterCache_1<std::string> (sResultIdentifier));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDataTableAggregationOptions->_getCache ());
+			if (cache == nullptr)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+			cache->retrieveData (sResultIdentifier);
+			pIDataTableAggregationOptions->_setCache (nullptr);
+		}
+		
+		if (pResultIdentifierNeededChars)
+			*pResultIdentifierNeededChars = (LibMCEnv_uint32) (sResultIdentifier.size()+1);
+		if (pResultIdentifierBuffer) {
+			if (sResultIdentifier.size() >= nResultIdentifierBufferSize)
+				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
+			for (size_t iResultIdentifier = 0; iResultIdentifier < sResultIdentifier.size(); iResultIdentifier++)
+				pResultIdentifierBuffer[iResultIdentifier] = sResultIdentifier[iResultIdentifier];
+			pResultIdentifierBuffer[sResultIdentifier.size()] = 0;
+		}
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableaggregationoptions_getaggregationcolumn(LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions, LibMCEnv_uint32 nIndex, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableAggregationOptions;
+
+	try {
+		if ( (!pColumnIdentifierBuffer) && !(pColumnIdentifierNeededChars) )
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sColumnIdentifier("");
+		IDataTableAggregationOptions* pIDataTableAggregationOptions = dynamic_cast<IDataTableAggregationOptions*>(pIBaseClass);
+		if (!pIDataTableAggregationOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pColumnIdentifierBuffer == nullptr);
+		if (isCacheCall) {
+			sColumnIdentifier = pIDataTableAggregationOptions->GetAggregationColumn(nIndex);
+
+			pIDataTableAggregationOptions->_setCache (new ParameterCache_1<std::string> (sColumnIdentifier));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDataTableAggregationOptions->_getCache ());
+			if (cache == nullptr)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+			cache->retrieveData (sColumnIdentifier);
+			pIDataTableAggregationOptions->_setCache (nullptr);
+		}
+		
+		if (pColumnIdentifierNeededChars)
+			*pColumnIdentifierNeededChars = (LibMCEnv_uint32) (sColumnIdentifier.size()+1);
+		if (pColumnIdentifierBuffer) {
+			if (sColumnIdentifier.size() >= nColumnIdentifierBufferSize)
+				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
+			for (size_t iColumnIdentifier = 0; iColumnIdentifier < sColumnIdentifier.size(); iColumnIdentifier++)
+				pColumnIdentifierBuffer[iColumnIdentifier] = sColumnIdentifier[iColumnIdentifier];
+			pColumnIdentifierBuffer[sColumnIdentifier.size()] = 0;
+		}
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableaggregationoptions_getaggregationtype(LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions, LibMCEnv_uint32 nIndex, eLibMCEnvDataTableAggregation * pAggregation)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableAggregationOptions;
+
+	try {
+		if (pAggregation == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableAggregationOptions* pIDataTableAggregationOptions = dynamic_cast<IDataTableAggregationOptions*>(pIBaseClass);
+		if (!pIDataTableAggregationOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pAggregation = pIDataTableAggregationOptions->GetAggregationType(nIndex);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableaggregationoptions_clear(LibMCEnv_DataTableAggregationOptions pDataTableAggregationOptions)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableAggregationOptions;
+
+	try {
+		IDataTableAggregationOptions* pIDataTableAggregationOptions = dynamic_cast<IDataTableAggregationOptions*>(pIBaseClass);
+		if (!pIDataTableAggregationOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableAggregationOptions->Clear();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+/*************************************************************************************************************************
+ Class implementation for DataTableLoadOptions
+*************************************************************************************************************************/
+LibMCEnvResult libmcenv_datatableloadoptions_addcolumn(LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, const char * pColumnIdentifier)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableLoadOptions;
+
+	try {
+		if (pColumnIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sColumnIdentifier(pColumnIdentifier);
+		IDataTableLoadOptions* pIDataTableLoadOptions = dynamic_cast<IDataTableLoadOptions*>(pIBaseClass);
+		if (!pIDataTableLoadOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableLoadOptions->AddColumn(sColumnIdentifier);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableloadoptions_getcolumncount(LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, LibMCEnv_uint32 * pColumnCount)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableLoadOptions;
+
+	try {
+		if (pColumnCount == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableLoadOptions* pIDataTableLoadOptions = dynamic_cast<IDataTableLoadOptions*>(pIBaseClass);
+		if (!pIDataTableLoadOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pColumnCount = pIDataTableLoadOptions->GetColumnCount();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableloadoptions_getcolumn(LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, LibMCEnv_uint32 nIndex, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableLoadOptions;
+
+	try {
+		if ( (!pColumnIdentifierBuffer) && !(pColumnIdentifierNeededChars) )
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sColumnIdentifier("");
+		IDataTableLoadOptions* pIDataTableLoadOptions = dynamic_cast<IDataTableLoadOptions*>(pIBaseClass);
+		if (!pIDataTableLoadOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pColumnIdentifierBuffer == nullptr);
+		if (isCacheCall) {
+			sColumnIdentifier = pIDataTableLoadOptions->GetColumn(nIndex);
+
+			pIDataTableLoadOptions->_setCache (new ParameterCache_1<std::string> (sColumnIdentifier));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDataTableLoadOptions->_getCache ());
+			if (cache == nullptr)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+			cache->retrieveData (sColumnIdentifier);
+			pIDataTableLoadOptions->_setCache (nullptr);
+		}
+		
+		if (pColumnIdentifierNeededChars)
+			*pColumnIdentifierNeededChars = (LibMCEnv_uint32) (sColumnIdentifier.size()+1);
+		if (pColumnIdentifierBuffer) {
+			if (sColumnIdentifier.size() >= nColumnIdentifierBufferSize)
+				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
+			for (size_t iColumnIdentifier = 0; iColumnIdentifier < sColumnIdentifier.size(); iColumnIdentifier++)
+				pColumnIdentifierBuffer[iColumnIdentifier] = sColumnIdentifier[iColumnIdentifier];
+			pColumnIdentifierBuffer[sColumnIdentifier.size()] = 0;
+		}
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableloadoptions_clearcolumns(LibMCEnv_DataTableLoadOptions pDataTableLoadOptions)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableLoadOptions;
+
+	try {
+		IDataTableLoadOptions* pIDataTableLoadOptions = dynamic_cast<IDataTableLoadOptions*>(pIBaseClass);
+		if (!pIDataTableLoadOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableLoadOptions->ClearColumns();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableloadoptions_setrowrange(LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, LibMCEnv_uint64 nFirstRow, LibMCEnv_uint64 nRowCount)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableLoadOptions;
+
+	try {
+		IDataTableLoadOptions* pIDataTableLoadOptions = dynamic_cast<IDataTableLoadOptions*>(pIBaseClass);
+		if (!pIDataTableLoadOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableLoadOptions->SetRowRange(nFirstRow, nRowCount);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableloadoptions_hasrowrange(LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, bool * pHasRowRange)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableLoadOptions;
+
+	try {
+		if (pHasRowRange == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableLoadOptions* pIDataTableLoadOptions = dynamic_cast<IDataTableLoadOptions*>(pIBaseClass);
+		if (!pIDataTableLoadOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pHasRowRange = pIDataTableLoadOptions->HasRowRange();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableloadoptions_getfirstrow(LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, LibMCEnv_uint64 * pFirstRow)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableLoadOptions;
+
+	try {
+		if (pFirstRow == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableLoadOptions* pIDataTableLoadOptions = dynamic_cast<IDataTableLoadOptions*>(pIBaseClass);
+		if (!pIDataTableLoadOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pFirstRow = pIDataTableLoadOptions->GetFirstRow();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableloadoptions_getrowcount(LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, LibMCEnv_uint64 * pRowCount)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableLoadOptions;
+
+	try {
+		if (pRowCount == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableLoadOptions* pIDataTableLoadOptions = dynamic_cast<IDataTableLoadOptions*>(pIBaseClass);
+		if (!pIDataTableLoadOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pRowCount = pIDataTableLoadOptions->GetRowCount();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableloadoptions_clearrowrange(LibMCEnv_DataTableLoadOptions pDataTableLoadOptions)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableLoadOptions;
+
+	try {
+		IDataTableLoadOptions* pIDataTableLoadOptions = dynamic_cast<IDataTableLoadOptions*>(pIBaseClass);
+		if (!pIDataTableLoadOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableLoadOptions->ClearRowRange();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableloadoptions_setlazyloading(LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, bool bLazyLoading)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableLoadOptions;
+
+	try {
+		IDataTableLoadOptions* pIDataTableLoadOptions = dynamic_cast<IDataTableLoadOptions*>(pIBaseClass);
+		if (!pIDataTableLoadOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTableLoadOptions->SetLazyLoading(bLazyLoading);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatableloadoptions_getlazyloading(LibMCEnv_DataTableLoadOptions pDataTableLoadOptions, bool * pLazyLoading)
+{
+	IBase* pIBaseClass = (IBase *)pDataTableLoadOptions;
+
+	try {
+		if (pLazyLoading == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTableLoadOptions* pIDataTableLoadOptions = dynamic_cast<IDataTableLoadOptions*>(pIBaseClass);
+		if (!pIDataTableLoadOptions)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pLazyLoading = pIDataTableLoadOptions->GetLazyLoading();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
 
 /*************************************************************************************************************************
- Class implementation for DataTableScatterPlotOptions
+ Class implementation for DataTable
 **************************************************************************************************************************/
-LibMCEnvResult libmcenv_datatablescatterplotoptions_setxaxiscolumn(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const char * pColumnIdentifier, LibMCEnv_double dScaleFactor, LibMCEnv_double dOffsetFactor)
+LibMCEnvResult libmcenv_datatable_addcolumn(LibMCEnv_DataTable pDataTable, const char * pIdentifier, const char * pDescription, eLibMCEnvDataTableColumnType eColumnType)
+{
+	IBase* pIBaseClass = (IBase *)pDataTable;
+
+	try {
+		if (pIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (pDescription == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		std::string sDescription(pDescription);
+		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
+		if (!pIDataTable)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTable->AddColumn(sIdentifier, sDescription, eColumnType);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatable_removecolumn(LibMCEnv_DataTable pDataTable, const char * pIdentifier)
+{
+	IBase* pIBaseClass = (IBase *)pDataTable;
+
+	try {
+		if (pIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
+		if (!pIDataTable)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTable->RemoveColumn(sIdentifier);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatable_clear(LibMCEnv_DataTable pDataTable)
+{
+	IBase* pIBaseClass = (IBase *)pDataTable;
+
+	try {
+		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
+		if (!pIDataTable)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTable->Clear();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatable_hascolumn(LibMCEnv_DataTable pDataTable, const char * pIdentifier, bool * pColumnExists)
+{
+	IBase* pIBaseClass = (IBase *)pDataTable;
+
+	try {
+		if (pIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (pColumnExists == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
+		if (!pIDataTable)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pColumnExists = pIDataTable->HasColumn(sIdentifier);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatable_getrowcount(LibMCEnv_DataTable pDataTable, LibMCEnv_uint32 * pRowCount)
+{
+	IBase* pIBaseClass = (IBase *)pDataTable;
+
+	try {
+		if (pRowCount == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
+		if (!pIDataTable)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pRowCount = pIDataTable->GetRowCount();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatable_getcolumncount(LibMCEnv_DataTable pDataTable, LibMCEnv_uint32 * pColumnCount)
 {
-	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pColumnIdentifier == nullptr)
+		if (pColumnCount == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sColumnIdentifier(pColumnIdentifier);
-		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
-		if (!pIDataTableScatterPlotOptions)
+		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
+		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTableScatterPlotOptions->SetXAxisColumn(sColumnIdentifier, dScaleFactor, dOffsetFactor);
+		*pColumnCount = pIDataTable->GetColumnCount();
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -2436,40 +4582,40 @@ LibMCEnvResult libmcenv_datatablescatterplotoptions_setxaxiscolumn(LibMCEnv_Data
 	}
 }
 
-LibMCEnvResult libmcenv_datatablescatterplotoptions_getxaxiscolumn(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer)
+LibMCEnvResult libmcenv_datatable_getcolumnidentifier(LibMCEnv_DataTable pDataTable, LibMCEnv_uint32 nColumnIndex, const LibMCEnv_uint32 nIdentifierBufferSize, LibMCEnv_uint32* pIdentifierNeededChars, char * pIdentifierBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if ( (!pColumnIdentifierBuffer) && !(pColumnIdentifierNeededChars) )
+		if ( (!pIdentifierBuffer) && !(pIdentifierNeededChars) )
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sColumnIdentifier("");
-		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
-		if (!pIDataTableScatterPlotOptions)
+		std::string sIdentifier("");
+		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
+		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pColumnIdentifierBuffer == nullptr);
+		bool isCacheCall = (pIdentifierBuffer == nullptr);
 		if (isCacheCall) {
-			sColumnIdentifier = pIDataTableScatterPlotOptions->GetXAxisColumn();
+			sIdentifier = pIDataTable->GetColumnIdentifier(nColumnIndex);
 
-			pIDataTableScatterPlotOptions->_setCache (new ParameterCache_1<std::string> (sColumnIdentifier));
+			pIDataTable->_setCache (new ParameterCache_1<std::string> (sIdentifier));
 		}
 		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDataTableScatterPlotOptions->_getCache ());
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDataTable->_getCache ());
 			if (cache == nullptr)
 				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
-			cache->retrieveData (sColumnIdentifier);
-			pIDataTableScatterPlotOptions->_setCache (nullptr);
+			cache->retrieveData (sIdentifier);
+			pIDataTable->_setCache (nullptr);
 		}
 		
-		if (pColumnIdentifierNeededChars)
-			*pColumnIdentifierNeededChars = (LibMCEnv_uint32) (sColumnIdentifier.size()+1);
-		if (pColumnIdentifierBuffer) {
-			if (sColumnIdentifier.size() >= nColumnIdentifierBufferSize)
+		if (pIdentifierNeededChars)
+			*pIdentifierNeededChars = (LibMCEnv_uint32) (sIdentifier.size()+1);
+		if (pIdentifierBuffer) {
+			if (sIdentifier.size() >= nIdentifierBufferSize)
 				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
-			for (size_t iColumnIdentifier = 0; iColumnIdentifier < sColumnIdentifier.size(); iColumnIdentifier++)
-				pColumnIdentifierBuffer[iColumnIdentifier] = sColumnIdentifier[iColumnIdentifier];
-			pColumnIdentifierBuffer[sColumnIdentifier.size()] = 0;
+			for (size_t iIdentifier = 0; iIdentifier < sIdentifier.size(); iIdentifier++)
+				pIdentifierBuffer[iIdentifier] = sIdentifier[iIdentifier];
+			pIdentifierBuffer[sIdentifier.size()] = 0;
 		}
 		return LIBMCENV_SUCCESS;
 	}
@@ -2484,19 +4630,41 @@ LibMCEnvResult libmcenv_datatablescatterplotoptions_getxaxiscolumn(LibMCEnv_Data
 	}
 }
 
-LibMCEnvResult libmcenv_datatablescatterplotoptions_getxaxisscaling(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, LibMCEnv_double * pScaleFactor)
+LibMCEnvResult libmcenv_datatable_getcolumndescription(LibMCEnv_DataTable pDataTable, LibMCEnv_uint32 nColumnIndex, const LibMCEnv_uint32 nDescriptionBufferSize, LibMCEnv_uint32* pDescriptionNeededChars, char * pDescriptionBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pScaleFactor == nullptr)
+		if ( (!pDescriptionBuffer) && !(pDescriptionNeededChars) )
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
-		if (!pIDataTableScatterPlotOptions)
+		std::string sDescription("");
+		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
+		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		*pScaleFactor = pIDataTableScatterPlotOptions->GetXAxisScaling();
+		bool isCacheCall = (pDescriptionBuffer == nullptr);
+		if (isCacheCall) {
+			sDescription = pIDataTable->GetColumnDescription(nColumnIndex);
 
+			pIDataTable->_setCache (new ParameterCache_1<std::string> (sDescription));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDataTable->_getCache ());
+			if (cache == nullptr)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+			cache->retrieveData (sDescription);
+			pIDataTable->_setCache (nullptr);
+		}
+		
+		if (pDescriptionNeededChars)
+			*pDescriptionNeededChars = (LibMCEnv_uint32) (sDescription.size()+1);
+		if (pDescriptionBuffer) {
+			if (sDescription.size() >= nDescriptionBufferSize)
+				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
+			for (size_t iDescription = 0; iDescription < sDescription.size(); iDescription++)
+				pDescriptionBuffer[iDescription] = sDescription[iDescription];
+			pDescriptionBuffer[sDescription.size()] = 0;
+		}
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -2510,18 +4678,18 @@ LibMCEnvResult libmcenv_datatablescatterplotoptions_getxaxisscaling(LibMCEnv_Dat
 	}
 }
 
-LibMCEnvResult libmcenv_datatablescatterplotoptions_getxaxisoffset(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, LibMCEnv_double * pOffsetFactor)
+LibMCEnvResult libmcenv_datatable_getcolumntype(LibMCEnv_DataTable pDataTable, LibMCEnv_uint32 nColumnIndex, eLibMCEnvDataTableColumnType * pColumnType)
 {
-	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pOffsetFactor == nullptr)
+		if (pColumnType == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
-		if (!pIDataTableScatterPlotOptions)
+		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
+		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		*pOffsetFactor = pIDataTableScatterPlotOptions->GetXAxisOffset();
+		*pColumnType = pIDataTable->GetColumnType(nColumnIndex);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -2536,19 +4704,74 @@ LibMCEnvResult libmcenv_datatablescatterplotoptions_getxaxisoffset(LibMCEnv_Data
 	}
 }
 
-LibMCEnvResult libmcenv_datatablescatterplotoptions_setyaxiscolumn(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const char * pColumnIdentifier, LibMCEnv_double dScaleFactor, LibMCEnv_double dOffsetFactor)
+LibMCEnvResult libmcenv_datatable_getcolumninformation(LibMCEnv_DataTable pDataTable, const char * pIdentifier, const LibMCEnv_uint32 nDescriptionBufferSize, LibMCEnv_uint32* pDescriptionNeededChars, char * pDescriptionBuffer, eLibMCEnvDataTableColumnType * pColumnType)
 {
-	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pColumnIdentifier == nullptr)
+		if (pIdentifier == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sColumnIdentifier(pColumnIdentifier);
-		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
-		if (!pIDataTableScatterPlotOptions)
+		if ( (!pDescriptionBuffer) && !(pDescriptionNeededChars) )
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (!pColumnType)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		std::string sDescription("");
+		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
+		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTableScatterPlotOptions->SetYAxisColumn(sColumnIdentifier, dScaleFactor, dOffsetFactor);
+		bool isCacheCall = (pDescriptionBuffer == nullptr);
+		if (isCacheCall) {
+			pIDataTable->GetColumnInformation(sIdentifier, sDescription, *pColumnType);
+
+			pIDataTable->_setCache (new ParameterCache_2<std::string, LibMCEnv::eDataTableColumnType> (sDescription, *pColumnType));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_2<std::string, LibMCEnv::eDataTableColumnType>*> (pIDataTable->_getCache ());
+			if (cache == nullptr)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+			cache->retrieveData (sDescription, *pColumnType);
+			pIDataTable->_setCache (nullptr);
+		}
+		
+		if (pDescriptionNeededChars)
+			*pDescriptionNeededChars = (LibMCEnv_uint32) (sDescription.size()+1);
+		if (pDescriptionBuffer) {
+			if (sDescription.size() >= nDescriptionBufferSize)
+				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
+			for (size_t iDescription = 0; iDescription < sDescription.size(); iDescription++)
+				pDescriptionBuffer[iDescription] = sDescription[iDescription];
+			pDescriptionBuffer[sDescription.size()] = 0;
+		}
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatable_getdoublecolumnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, const LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_double * pValuesBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pDataTable;
+
+	try {
+		if (pIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if ((!pValuesBuffer) && !(pValuesNeededCount))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
+		if (!pIDataTable)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTable->GetDoubleColumnValues(sIdentifier, nValuesBufferSize, pValuesNeededCount, pValuesBuffer);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -2563,41 +4786,80 @@ LibMCEnvResult libmcenv_datatablescatterplotoptions_setyaxiscolumn(LibMCEnv_Data
 	}
 }
 
-LibMCEnvResult libmcenv_datatablescatterplotoptions_getyaxiscolumn(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const LibMCEnv_uint32 nColumnIdentifierBufferSize, LibMCEnv_uint32* pColumnIdentifierNeededChars, char * pColumnIdentifierBuffer)
+LibMCEnvResult libmcenv_datatable_getint32columnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, const LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_int32 * pValuesBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if ( (!pColumnIdentifierBuffer) && !(pColumnIdentifierNeededChars) )
+		if (pIdentifier == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sColumnIdentifier("");
-		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
-		if (!pIDataTableScatterPlotOptions)
+		if ((!pValuesBuffer) && !(pValuesNeededCount))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
+		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pColumnIdentifierBuffer == nullptr);
-		if (isCacheCall) {
-			sColumnIdentifier = pIDataTableScatterPlotOptions->GetYAxisColumn();
+		pIDataTable->GetInt32ColumnValues(sIdentifier, nValuesBufferSize, pValuesNeededCount, pValuesBuffer);
 
-			pIDataTableScatterPlotOptions->_setCache (new ParameterCache_1<std::string> (sColumnIdentifier));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDataTableScatterPlotOptions->_getCache ());
-			if (cache == nullptr)
-				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
-			cache->retrieveData (sColumnIdentifier);
-			pIDataTableScatterPlotOptions->_setCache (nullptr);
-		}
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatable_getint64columnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, const LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_int64 * pValuesBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pDataTable;
+
+	try {
+		if (pIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if ((!pValuesBuffer) && !(pValuesNeededCount))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
+		if (!pIDataTable)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		if (pColumnIdentifierNeededChars)
-			*pColumnIdentifierNeededChars = (LibMCEnv_uint32) (sColumnIdentifier.size()+1);
-		if (pColumnIdentifierBuffer) {
-			if (sColumnIdentifier.size() >= nColumnIdentifierBufferSize)
-				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
-			for (size_t iColumnIdentifier = 0; iColumnIdentifier < sColumnIdentifier.size(); iColumnIdentifier++)
-				pColumnIdentifierBuffer[iColumnIdentifier] = sColumnIdentifier[iColumnIdentifier];
-			pColumnIdentifierBuffer[sColumnIdentifier.size()] = 0;
-		}
+		pIDataTable->GetInt64ColumnValues(sIdentifier, nValuesBufferSize, pValuesNeededCount, pValuesBuffer);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_datatable_getuint32columnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, const LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_uint32 * pValuesBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pDataTable;
+
+	try {
+		if (pIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if ((!pValuesBuffer) && !(pValuesNeededCount))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
+		if (!pIDataTable)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIDataTable->GetUint32ColumnValues(sIdentifier, nValuesBufferSize, pValuesNeededCount, pValuesBuffer);
+
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -2611,18 +4873,21 @@ LibMCEnvResult libmcenv_datatablescatterplotoptions_getyaxiscolumn(LibMCEnv_Data
 	}
 }
 
-LibMCEnvResult libmcenv_datatablescatterplotoptions_getyaxisscaling(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, LibMCEnv_double * pScaleFactor)
+LibMCEnvResult libmcenv_datatable_getuint64columnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, const LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_uint64 * pValuesBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pScaleFactor == nullptr)
+		if (pIdentifier == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
-		if (!pIDataTableScatterPlotOptions)
+		if ((!pValuesBuffer) && !(pValuesNeededCount))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
+		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		*pScaleFactor = pIDataTableScatterPlotOptions->GetYAxisScaling();
+		pIDataTable->GetUint64ColumnValues(sIdentifier, nValuesBufferSize, pValuesNeededCount, pValuesBuffer);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -2637,18 +4902,21 @@ LibMCEnvResult libmcenv_datatablescatterplotoptions_getyaxisscaling(LibMCEnv_Dat
 	}
 }
 
-LibMCEnvResult libmcenv_datatablescatterplotoptions_getyaxisoffset(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, LibMCEnv_double * pOffsetFactor)
+LibMCEnvResult libmcenv_datatable_setdoublecolumnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, LibMCEnv_uint64 nValuesBufferSize, const LibMCEnv_double * pValuesBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pOffsetFactor == nullptr)
+		if (pIdentifier == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
-		if (!pIDataTableScatterPlotOptions)
+		if ( (!pValuesBuffer) && (nValuesBufferSize>0))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
+		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		*pOffsetFactor = pIDataTableScatterPlotOptions->GetYAxisOffset();
+		pIDataTable->SetDoubleColumnValues(sIdentifier, nValuesBufferSize, pValuesBuffer);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -2663,22 +4931,21 @@ LibMCEnvResult libmcenv_datatablescatterplotoptions_getyaxisoffset(LibMCEnv_Data
 	}
 }
 
-LibMCEnvResult libmcenv_datatablescatterplotoptions_adddatachannel(LibMCEnv_DataTableScatterPlotOptions pDataTableScatterPlotOptions, const char * pChannelIdentifier, const char * pColumnIdentifier, LibMCEnv_double dScaleFactor, LibMCEnv_double dOffsetFactor, LibMCEnv_uint32 nColor)
+LibMCEnvResult libmcenv_datatable_setint32columnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, LibMCEnv_uint64 nValuesBufferSize, const LibMCEnv_int32 * pValuesBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pDataTableScatterPlotOptions;
+	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pChannelIdentifier == nullptr)
+		if (pIdentifier == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if (pColumnIdentifier == nullptr)
+		if ( (!pValuesBuffer) && (nValuesBufferSize>0))
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sChannelIdentifier(pChannelIdentifier);
-		std::string sColumnIdentifier(pColumnIdentifier);
-		IDataTableScatterPlotOptions* pIDataTableScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClass);
-		if (!pIDataTableScatterPlotOptions)
+		std::string sIdentifier(pIdentifier);
+		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
+		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTableScatterPlotOptions->AddDataChannel(sChannelIdentifier, sColumnIdentifier, dScaleFactor, dOffsetFactor, nColor);
+		pIDataTable->SetInt32ColumnValues(sIdentifier, nValuesBufferSize, pValuesBuffer);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -2693,26 +4960,21 @@ LibMCEnvResult libmcenv_datatablescatterplotoptions_adddatachannel(LibMCEnv_Data
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for DataTable
-**************************************************************************************************************************/
-LibMCEnvResult libmcenv_datatable_addcolumn(LibMCEnv_DataTable pDataTable, const char * pIdentifier, const char * pDescription, eLibMCEnvDataTableColumnType eColumnType)
+LibMCEnvResult libmcenv_datatable_setint64columnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, LibMCEnv_uint64 nValuesBufferSize, const LibMCEnv_int64 * pValuesBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
 		if (pIdentifier == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if (pDescription == nullptr)
+		if ( (!pValuesBuffer) && (nValuesBufferSize>0))
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
 		std::string sIdentifier(pIdentifier);
-		std::string sDescription(pDescription);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTable->AddColumn(sIdentifier, sDescription, eColumnType);
+		pIDataTable->SetInt64ColumnValues(sIdentifier, nValuesBufferSize, pValuesBuffer);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -2727,19 +4989,21 @@ LibMCEnvResult libmcenv_datatable_addcolumn(LibMCEnv_DataTable pDataTable, const
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_removecolumn(LibMCEnv_DataTable pDataTable, const char * pIdentifier)
+LibMCEnvResult libmcenv_datatable_setuint32columnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, LibMCEnv_uint64 nValuesBufferSize, const LibMCEnv_uint32 * pValuesBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
 		if (pIdentifier == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if ( (!pValuesBuffer) && (nValuesBufferSize>0))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
 		std::string sIdentifier(pIdentifier);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTable->RemoveColumn(sIdentifier);
+		pIDataTable->SetUint32ColumnValues(sIdentifier, nValuesBufferSize, pValuesBuffer);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -2754,16 +5018,21 @@ LibMCEnvResult libmcenv_datatable_removecolumn(LibMCEnv_DataTable pDataTable, co
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_clear(LibMCEnv_DataTable pDataTable)
+LibMCEnvResult libmcenv_datatable_setuint64columnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, LibMCEnv_uint64 nValuesBufferSize, const LibMCEnv_uint64 * pValuesBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
+		if (pIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if ( (!pValuesBuffer) && (nValuesBufferSize>0))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTable->Clear();
+		pIDataTable->SetUint64ColumnValues(sIdentifier, nValuesBufferSize, pValuesBuffer);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -2778,22 +5047,21 @@ LibMCEnvResult libmcenv_datatable_clear(LibMCEnv_DataTable pDataTable)
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_hascolumn(LibMCEnv_DataTable pDataTable, const char * pIdentifier, bool * pColumnExists)
+LibMCEnvResult libmcenv_datatable_createwriteoptions(LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableWriteOptions * pOptions)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pIdentifier == nullptr)
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if (pColumnExists == nullptr)
+		if (pOptions == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
+		IBase* pBaseOptions(nullptr);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		*pColumnExists = pIDataTable->HasColumn(sIdentifier);
+		pBaseOptions = pIDataTable->CreateWriteOptions();
 
+		*pOptions = (IBase*)(pBaseOptions);
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -2807,19 +5075,21 @@ LibMCEnvResult libmcenv_datatable_hascolumn(LibMCEnv_DataTable pDataTable, const
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_getrowcount(LibMCEnv_DataTable pDataTable, LibMCEnv_uint32 * pRowCount)
+LibMCEnvResult libmcenv_datatable_createcsvwriteoptions(LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableCSVWriteOptions * pOptions)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pRowCount == nullptr)
+		if (pOptions == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IBase* pBaseOptions(nullptr);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		*pRowCount = pIDataTable->GetRowCount();
+		pBaseOptions = pIDataTable->CreateCSVWriteOptions();
 
+		*pOptions = (IBase*)(pBaseOptions);
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -2833,18 +5103,23 @@ LibMCEnvResult libmcenv_datatable_getrowcount(LibMCEnv_DataTable pDataTable, Lib
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_getcolumncount(LibMCEnv_DataTable pDataTable, LibMCEnv_uint32 * pColumnCount)
+LibMCEnvResult libmcenv_datatable_writecsvtostream(LibMCEnv_DataTable pDataTable, LibMCEnv_TempStreamWriter pWriter, LibMCEnv_DataTableCSVWriteOptions pOptions)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pColumnCount == nullptr)
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IBase* pIBaseClassWriter = (IBase *)pWriter;
+		ITempStreamWriter* pIWriter = dynamic_cast<ITempStreamWriter*>(pIBaseClassWriter);
+		if (!pIWriter)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDCAST);
+		
+		IBase* pIBaseClassOptions = (IBase *)pOptions;
+		IDataTableCSVWriteOptions* pIOptions = dynamic_cast<IDataTableCSVWriteOptions*>(pIBaseClassOptions);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		*pColumnCount = pIDataTable->GetColumnCount();
+		pIDataTable->WriteCSVToStream(pIWriter, pIOptions);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -2859,41 +5134,24 @@ LibMCEnvResult libmcenv_datatable_getcolumncount(LibMCEnv_DataTable pDataTable,
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_getcolumnidentifier(LibMCEnv_DataTable pDataTable, LibMCEnv_uint32 nColumnIndex, const LibMCEnv_uint32 nIdentifierBufferSize, LibMCEnv_uint32* pIdentifierNeededChars, char * pIdentifierBuffer)
+LibMCEnvResult libmcenv_datatable_writedatatostream(LibMCEnv_DataTable pDataTable, LibMCEnv_TempStreamWriter pWriter, LibMCEnv_DataTableWriteOptions pOptions)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if ( (!pIdentifierBuffer) && !(pIdentifierNeededChars) )
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sIdentifier("");
+		IBase* pIBaseClassWriter = (IBase *)pWriter;
+		ITempStreamWriter* pIWriter = dynamic_cast<ITempStreamWriter*>(pIBaseClassWriter);
+		if (!pIWriter)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDCAST);
+		
+		IBase* pIBaseClassOptions = (IBase *)pOptions;
+		IDataTableWriteOptions* pIOptions = dynamic_cast<IDataTableWriteOptions*>(pIBaseClassOptions);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pIdentifierBuffer == nullptr);
-		if (isCacheCall) {
-			sIdentifier = pIDataTable->GetColumnIdentifier(nColumnIndex);
+		pIDataTable->WriteDataToStream(pIWriter, pIOptions);
 
-			pIDataTable->_setCache (new ParameterCache_1<std::string> (sIdentifier));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDataTable->_getCache ());
-			if (cache == nullptr)
-				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
-			cache->retrieveData (sIdentifier);
-			pIDataTable->_setCache (nullptr);
-		}
-		
-		if (pIdentifierNeededChars)
-			*pIdentifierNeededChars = (LibMCEnv_uint32) (sIdentifier.size()+1);
-		if (pIdentifierBuffer) {
-			if (sIdentifier.size() >= nIdentifierBufferSize)
-				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
-			for (size_t iIdentifier = 0; iIdentifier < sIdentifier.size(); iIdentifier++)
-				pIdentifierBuffer[iIdentifier] = sIdentifier[iIdentifier];
-			pIdentifierBuffer[sIdentifier.size()] = 0;
-		}
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -2907,41 +5165,22 @@ LibMCEnvResult libmcenv_datatable_getcolumnidentifier(LibMCEnv_DataTable pDataTa
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_getcolumndescription(LibMCEnv_DataTable pDataTable, LibMCEnv_uint32 nColumnIndex, const LibMCEnv_uint32 nDescriptionBufferSize, LibMCEnv_uint32* pDescriptionNeededChars, char * pDescriptionBuffer)
+LibMCEnvResult libmcenv_datatable_loadfromstream(LibMCEnv_DataTable pDataTable, LibMCEnv_StreamReader pStream)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if ( (!pDescriptionBuffer) && !(pDescriptionNeededChars) )
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sDescription("");
+		IBase* pIBaseClassStream = (IBase *)pStream;
+		IStreamReader* pIStream = dynamic_cast<IStreamReader*>(pIBaseClassStream);
+		if (!pIStream)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDCAST);
+		
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pDescriptionBuffer == nullptr);
-		if (isCacheCall) {
-			sDescription = pIDataTable->GetColumnDescription(nColumnIndex);
+		pIDataTable->LoadFromStream(pIStream);
 
-			pIDataTable->_setCache (new ParameterCache_1<std::string> (sDescription));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIDataTable->_getCache ());
-			if (cache == nullptr)
-				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
-			cache->retrieveData (sDescription);
-			pIDataTable->_setCache (nullptr);
-		}
-		
-		if (pDescriptionNeededChars)
-			*pDescriptionNeededChars = (LibMCEnv_uint32) (sDescription.size()+1);
-		if (pDescriptionBuffer) {
-			if (sDescription.size() >= nDescriptionBufferSize)
-				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
-			for (size_t iDescription = 0; iDescription < sDescription.size(); iDescription++)
-				pDescriptionBuffer[iDescription] = sDescription[iDescription];
-			pDescriptionBuffer[sDescription.size()] = 0;
-		}
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -2955,19 +5194,21 @@ LibMCEnvResult libmcenv_datatable_getcolumndescription(LibMCEnv_DataTable pDataT
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_getcolumntype(LibMCEnv_DataTable pDataTable, LibMCEnv_uint32 nColumnIndex, eLibMCEnvDataTableColumnType * pColumnType)
+LibMCEnvResult libmcenv_datatable_createscatterplotoptions(LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableScatterPlotOptions * pScatterPlotOptions)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pColumnType == nullptr)
+		if (pScatterPlotOptions == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IBase* pBaseScatterPlotOptions(nullptr);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		*pColumnType = pIDataTable->GetColumnType(nColumnIndex);
+		pBaseScatterPlotOptions = pIDataTable->CreateScatterPlotOptions();
 
+		*pScatterPlotOptions = (IBase*)(pBaseScatterPlotOptions);
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -2981,46 +5222,26 @@ LibMCEnvResult libmcenv_datatable_getcolumntype(LibMCEnv_DataTable pDataTable, L
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_getcolumninformation(LibMCEnv_DataTable pDataTable, const char * pIdentifier, const LibMCEnv_uint32 nDescriptionBufferSize, LibMCEnv_uint32* pDescriptionNeededChars, char * pDescriptionBuffer, eLibMCEnvDataTableColumnType * pColumnType)
+LibMCEnvResult libmcenv_datatable_calculatescatterplot(LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableScatterPlotOptions pScatterPlotOptions, LibMCEnv_ScatterPlot * pScatterPlot)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pIdentifier == nullptr)
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if ( (!pDescriptionBuffer) && !(pDescriptionNeededChars) )
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if (!pColumnType)
+		if (pScatterPlot == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		std::string sDescription("");
+		IBase* pIBaseClassScatterPlotOptions = (IBase *)pScatterPlotOptions;
+		IDataTableScatterPlotOptions* pIScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClassScatterPlotOptions);
+		if (!pIScatterPlotOptions)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDCAST);
+		
+		IBase* pBaseScatterPlot(nullptr);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pDescriptionBuffer == nullptr);
-		if (isCacheCall) {
-			pIDataTable->GetColumnInformation(sIdentifier, sDescription, *pColumnType);
+		pBaseScatterPlot = pIDataTable->CalculateScatterPlot(pIScatterPlotOptions);
 
-			pIDataTable->_setCache (new ParameterCache_2<std::string, LibMCEnv::eDataTableColumnType> (sDescription, *pColumnType));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_2<std::string, LibMCEnv::eDataTableColumnType>*> (pIDataTable->_getCache ());
-			if (cache == nullptr)
-				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
-			cache->retrieveData (sDescription, *pColumnType);
-			pIDataTable->_setCache (nullptr);
-		}
-		
-		if (pDescriptionNeededChars)
-			*pDescriptionNeededChars = (LibMCEnv_uint32) (sDescription.size()+1);
-		if (pDescriptionBuffer) {
-			if (sDescription.size() >= nDescriptionBufferSize)
-				throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_BUFFERTOOSMALL);
-			for (size_t iDescription = 0; iDescription < sDescription.size(); iDescription++)
-				pDescriptionBuffer[iDescription] = sDescription[iDescription];
-			pDescriptionBuffer[sDescription.size()] = 0;
-		}
+		*pScatterPlot = (IBase*)(pBaseScatterPlot);
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -3034,21 +5255,18 @@ LibMCEnvResult libmcenv_datatable_getcolumninformation(LibMCEnv_DataTable pDataT
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_getdoublecolumnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, const LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_double * pValuesBuffer)
+LibMCEnvResult libmcenv_datatable_getthreadcount(LibMCEnv_DataTable pDataTable, LibMCEnv_uint32 * pThreadCount)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pIdentifier == nullptr)
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if ((!pValuesBuffer) && !(pValuesNeededCount))
+		if (pThreadCount == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTable->GetDoubleColumnValues(sIdentifier, nValuesBufferSize, pValuesNeededCount, pValuesBuffer);
+		*pThreadCount = pIDataTable->GetThreadCount();
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -3063,21 +5281,16 @@ LibMCEnvResult libmcenv_datatable_getdoublecolumnvalues(LibMCEnv_DataTable pData
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_getint32columnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, const LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_int32 * pValuesBuffer)
+LibMCEnvResult libmcenv_datatable_setthreadcount(LibMCEnv_DataTable pDataTable, LibMCEnv_uint32 nThreadCount)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pIdentifier == nullptr)
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if ((!pValuesBuffer) && !(pValuesNeededCount))
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTable->GetInt32ColumnValues(sIdentifier, nValuesBufferSize, pValuesNeededCount, pValuesBuffer);
+		pIDataTable->SetThreadCount(nThreadCount);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -3092,22 +5305,21 @@ LibMCEnvResult libmcenv_datatable_getint32columnvalues(LibMCEnv_DataTable pDataT
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_getint64columnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, const LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_int64 * pValuesBuffer)
+LibMCEnvResult libmcenv_datatable_createfilter(LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableFilter * pFilter)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pIdentifier == nullptr)
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if ((!pValuesBuffer) && !(pValuesNeededCount))
+		if (pFilter == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
+		IBase* pBaseFilter(nullptr);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTable->GetInt64ColumnValues(sIdentifier, nValuesBufferSize, pValuesNeededCount, pValuesBuffer);
+		pBaseFilter = pIDataTable->CreateFilter();
 
+		*pFilter = (IBase*)(pBaseFilter);
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -3121,21 +5333,23 @@ LibMCEnvResult libmcenv_datatable_getint64columnvalues(LibMCEnv_DataTable pDataT
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_getuint32columnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, const LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_uint32 * pValuesBuffer)
+LibMCEnvResult libmcenv_datatable_findrows(LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableFilter pFilter, const LibMCEnv_uint64 nRowIndicesBufferSize, LibMCEnv_uint64* pRowIndicesNeededCount, LibMCEnv_uint32 * pRowIndicesBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pIdentifier == nullptr)
+		if ((!pRowIndicesBuffer) && !(pRowIndicesNeededCount))
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if ((!pValuesBuffer) && !(pValuesNeededCount))
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
+		IBase* pIBaseClassFilter = (IBase *)pFilter;
+		IDataTableFilter* pIFilter = dynamic_cast<IDataTableFilter*>(pIBaseClassFilter);
+		if (!pIFilter)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDCAST);
+		
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTable->GetUint32ColumnValues(sIdentifier, nValuesBufferSize, pValuesNeededCount, pValuesBuffer);
+		pIDataTable->FindRows(pIFilter, nRowIndicesBufferSize, pRowIndicesNeededCount, pRowIndicesBuffer);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -3150,22 +5364,26 @@ LibMCEnvResult libmcenv_datatable_getuint32columnvalues(LibMCEnv_DataTable pData
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_getuint64columnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, const LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_uint64 * pValuesBuffer)
+LibMCEnvResult libmcenv_datatable_filterrows(LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableFilter pFilter, LibMCEnv_DataTable * pResult)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pIdentifier == nullptr)
+		if (pResult == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if ((!pValuesBuffer) && !(pValuesNeededCount))
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
+		IBase* pIBaseClassFilter = (IBase *)pFilter;
+		IDataTableFilter* pIFilter = dynamic_cast<IDataTableFilter*>(pIBaseClassFilter);
+		if (!pIFilter)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDCAST);
+		
+		IBase* pBaseResult(nullptr);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTable->GetUint64ColumnValues(sIdentifier, nValuesBufferSize, pValuesNeededCount, pValuesBuffer);
+		pBaseResult = pIDataTable->FilterRows(pIFilter);
 
+		*pResult = (IBase*)(pBaseResult);
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -3179,22 +5397,23 @@ LibMCEnvResult libmcenv_datatable_getuint64columnvalues(LibMCEnv_DataTable pData
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_setdoublecolumnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, LibMCEnv_uint64 nValuesBufferSize, const LibMCEnv_double * pValuesBuffer)
+LibMCEnvResult libmcenv_datatable_selectrows(LibMCEnv_DataTable pDataTable, LibMCEnv_uint64 nRowIndicesBufferSize, const LibMCEnv_uint32 * pRowIndicesBuffer, LibMCEnv_DataTable * pResult)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pIdentifier == nullptr)
+		if ( (!pRowIndicesBuffer) && (nRowIndicesBufferSize>0))
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if ( (!pValuesBuffer) && (nValuesBufferSize>0))
+		if (pResult == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
+		IBase* pBaseResult(nullptr);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTable->SetDoubleColumnValues(sIdentifier, nValuesBufferSize, pValuesBuffer);
+		pBaseResult = pIDataTable->SelectRows(nRowIndicesBufferSize, pRowIndicesBuffer);
 
+		*pResult = (IBase*)(pBaseResult);
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -3208,22 +5427,21 @@ LibMCEnvResult libmcenv_datatable_setdoublecolumnvalues(LibMCEnv_DataTable pData
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_setint32columnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, LibMCEnv_uint64 nValuesBufferSize, const LibMCEnv_int32 * pValuesBuffer)
+LibMCEnvResult libmcenv_datatable_createsortoptions(LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableSortOptions * pSortOptions)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pIdentifier == nullptr)
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if ( (!pValuesBuffer) && (nValuesBufferSize>0))
+		if (pSortOptions == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
+		IBase* pBaseSortOptions(nullptr);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTable->SetInt32ColumnValues(sIdentifier, nValuesBufferSize, pValuesBuffer);
+		pBaseSortOptions = pIDataTable->CreateSortOptions();
 
+		*pSortOptions = (IBase*)(pBaseSortOptions);
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -3237,21 +5455,23 @@ LibMCEnvResult libmcenv_datatable_setint32columnvalues(LibMCEnv_DataTable pDataT
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_setint64columnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, LibMCEnv_uint64 nValuesBufferSize, const LibMCEnv_int64 * pValuesBuffer)
+LibMCEnvResult libmcenv_datatable_getsortedrowindices(LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableSortOptions pSortOptions, const LibMCEnv_uint64 nRowIndicesBufferSize, LibMCEnv_uint64* pRowIndicesNeededCount, LibMCEnv_uint32 * pRowIndicesBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pIdentifier == nullptr)
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if ( (!pValuesBuffer) && (nValuesBufferSize>0))
+		if ((!pRowIndicesBuffer) && !(pRowIndicesNeededCount))
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
+		IBase* pIBaseClassSortOptions = (IBase *)pSortOptions;
+		IDataTableSortOptions* pISortOptions = dynamic_cast<IDataTableSortOptions*>(pIBaseClassSortOptions);
+		if (!pISortOptions)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDCAST);
+		
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTable->SetInt64ColumnValues(sIdentifier, nValuesBufferSize, pValuesBuffer);
+		pIDataTable->GetSortedRowIndices(pISortOptions, nRowIndicesBufferSize, pRowIndicesNeededCount, pRowIndicesBuffer);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -3266,22 +5486,26 @@ LibMCEnvResult libmcenv_datatable_setint64columnvalues(LibMCEnv_DataTable pDataT
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_setuint32columnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, LibMCEnv_uint64 nValuesBufferSize, const LibMCEnv_uint32 * pValuesBuffer)
+LibMCEnvResult libmcenv_datatable_sortrows(LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableSortOptions pSortOptions, LibMCEnv_DataTable * pResult)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pIdentifier == nullptr)
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if ( (!pValuesBuffer) && (nValuesBufferSize>0))
+		if (pResult == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
+		IBase* pIBaseClassSortOptions = (IBase *)pSortOptions;
+		IDataTableSortOptions* pISortOptions = dynamic_cast<IDataTableSortOptions*>(pIBaseClassSortOptions);
+		if (!pISortOptions)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDCAST);
+		
+		IBase* pBaseResult(nullptr);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTable->SetUint32ColumnValues(sIdentifier, nValuesBufferSize, pValuesBuffer);
+		pBaseResult = pIDataTable->SortRows(pISortOptions);
 
+		*pResult = (IBase*)(pBaseResult);
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -3295,22 +5519,21 @@ LibMCEnvResult libmcenv_datatable_setuint32columnvalues(LibMCEnv_DataTable pData
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_setuint64columnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, LibMCEnv_uint64 nValuesBufferSize, const LibMCEnv_uint64 * pValuesBuffer)
+LibMCEnvResult libmcenv_datatable_createaggregationoptions(LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableAggregationOptions * pAggregationOptions)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pIdentifier == nullptr)
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if ( (!pValuesBuffer) && (nValuesBufferSize>0))
+		if (pAggregationOptions == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
+		IBase* pBaseAggregationOptions(nullptr);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTable->SetUint64ColumnValues(sIdentifier, nValuesBufferSize, pValuesBuffer);
+		pBaseAggregationOptions = pIDataTable->CreateAggregationOptions();
 
+		*pAggregationOptions = (IBase*)(pBaseAggregationOptions);
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -3324,21 +5547,26 @@ LibMCEnvResult libmcenv_datatable_setuint64columnvalues(LibMCEnv_DataTable pData
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_createwriteoptions(LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableWriteOptions * pOptions)
+LibMCEnvResult libmcenv_datatable_aggregate(LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableAggregationOptions pAggregationOptions, LibMCEnv_DataTable * pResult)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pOptions == nullptr)
+		if (pResult == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		IBase* pBaseOptions(nullptr);
+		IBase* pIBaseClassAggregationOptions = (IBase *)pAggregationOptions;
+		IDataTableAggregationOptions* pIAggregationOptions = dynamic_cast<IDataTableAggregationOptions*>(pIBaseClassAggregationOptions);
+		if (!pIAggregationOptions)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDCAST);
+		
+		IBase* pBaseResult(nullptr);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pBaseOptions = pIDataTable->CreateWriteOptions();
+		pBaseResult = pIDataTable->Aggregate(pIAggregationOptions);
 
-		*pOptions = (IBase*)(pBaseOptions);
+		*pResult = (IBase*)(pBaseResult);
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -3352,21 +5580,26 @@ LibMCEnvResult libmcenv_datatable_createwriteoptions(LibMCEnv_DataTable pDataTab
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_createcsvwriteoptions(LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableCSVWriteOptions * pOptions)
+LibMCEnvResult libmcenv_datatable_addwindowstatisticcolumn(LibMCEnv_DataTable pDataTable, const char * pColumnIdentifier, const char * pResultIdentifier, const char * pDescription, eLibMCEnvDataTableWindowStatistic eStatistic, LibMCEnv_uint32 nWindowSize)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pOptions == nullptr)
+		if (pColumnIdentifier == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		IBase* pBaseOptions(nullptr);
+		if (pResultIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (pDescription == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sColumnIdentifier(pColumnIdentifier);
+		std::string sResultIdentifier(pResultIdentifier);
+		std::string sDescription(pDescription);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pBaseOptions = pIDataTable->CreateCSVWriteOptions();
+		pIDataTable->AddWindowStatisticColumn(sColumnIdentifier, sResultIdentifier, sDescription, eStatistic, nWindowSize);
 
-		*pOptions = (IBase*)(pBaseOptions);
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -3380,24 +5613,21 @@ LibMCEnvResult libmcenv_datatable_createcsvwriteoptions(LibMCEnv_DataTable pData
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_writecsvtostream(LibMCEnv_DataTable pDataTable, LibMCEnv_TempStreamWriter pWriter, LibMCEnv_DataTableCSVWriteOptions pOptions)
+LibMCEnvResult libmcenv_datatable_createloadoptions(LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableLoadOptions * pOptions)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		IBase* pIBaseClassWriter = (IBase *)pWriter;
-		ITempStreamWriter* pIWriter = dynamic_cast<ITempStreamWriter*>(pIBaseClassWriter);
-		if (!pIWriter)
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDCAST);
-		
-		IBase* pIBaseClassOptions = (IBase *)pOptions;
-		IDataTableCSVWriteOptions* pIOptions = dynamic_cast<IDataTableCSVWriteOptions*>(pIBaseClassOptions);
+		if (pOptions == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IBase* pBaseOptions(nullptr);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTable->WriteCSVToStream(pIWriter, pIOptions);
+		pBaseOptions = pIDataTable->CreateLoadOptions();
 
+		*pOptions = (IBase*)(pBaseOptions);
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -3411,23 +5641,26 @@ LibMCEnvResult libmcenv_datatable_writecsvtostream(LibMCEnv_DataTable pDataTable
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_writedatatostream(LibMCEnv_DataTable pDataTable, LibMCEnv_TempStreamWriter pWriter, LibMCEnv_DataTableWriteOptions pOptions)
+LibMCEnvResult libmcenv_datatable_loadfromstreamwithoptions(LibMCEnv_DataTable pDataTable, LibMCEnv_StreamReader pStream, LibMCEnv_DataTableLoadOptions pOptions)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		IBase* pIBaseClassWriter = (IBase *)pWriter;
-		ITempStreamWriter* pIWriter = dynamic_cast<ITempStreamWriter*>(pIBaseClassWriter);
-		if (!pIWriter)
+		IBase* pIBaseClassStream = (IBase *)pStream;
+		IStreamReader* pIStream = dynamic_cast<IStreamReader*>(pIBaseClassStream);
+		if (!pIStream)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDCAST);
 		
 		IBase* pIBaseClassOptions = (IBase *)pOptions;
-		IDataTableWriteOptions* pIOptions = dynamic_cast<IDataTableWriteOptions*>(pIBaseClassOptions);
+		IDataTableLoadOptions* pIOptions = dynamic_cast<IDataTableLoadOptions*>(pIBaseClassOptions);
+		if (!pIOptions)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDCAST);
+		
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTable->WriteDataToStream(pIWriter, pIOptions);
+		pIDataTable->LoadFromStreamWithOptions(pIStream, pIOptions);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -3442,21 +5675,21 @@ LibMCEnvResult libmcenv_datatable_writedatatostream(LibMCEnv_DataTable pDataTabl
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_loadfromstream(LibMCEnv_DataTable pDataTable, LibMCEnv_StreamReader pStream)
+LibMCEnvResult libmcenv_datatable_iscolumnloaded(LibMCEnv_DataTable pDataTable, const char * pIdentifier, bool * pIsLoaded)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		IBase* pIBaseClassStream = (IBase *)pStream;
-		IStreamReader* pIStream = dynamic_cast<IStreamReader*>(pIBaseClassStream);
-		if (!pIStream)
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDCAST);
-		
+		if (pIdentifier == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (pIsLoaded == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIDataTable->LoadFromStream(pIStream);
+		*pIsLoaded = pIDataTable->IsColumnLoaded(sIdentifier);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -3471,21 +5704,23 @@ LibMCEnvResult libmcenv_datatable_loadfromstream(LibMCEnv_DataTable pDataTable,
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_createscatterplotoptions(LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableScatterPlotOptions * pScatterPlotOptions)
+LibMCEnvResult libmcenv_datatable_addscaledint32column(LibMCEnv_DataTable pDataTable, const char * pIdentifier, const char * pDescription, LibMCEnv_double dScaleFactor, LibMCEnv_double dOffset)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pScatterPlotOptions == nullptr)
+		if (pIdentifier == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		IBase* pBaseScatterPlotOptions(nullptr);
+		if (pDescription == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		std::string sDescription(pDescription);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pBaseScatterPlotOptions = pIDataTable->CreateScatterPlotOptions();
+		pIDataTable->AddScaledInt32Column(sIdentifier, sDescription, dScaleFactor, dOffset);
 
-		*pScatterPlotOptions = (IBase*)(pBaseScatterPlotOptions);
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -3499,26 +5734,22 @@ LibMCEnvResult libmcenv_datatable_createscatterplotoptions(LibMCEnv_DataTable pD
 	}
 }
 
-LibMCEnvResult libmcenv_datatable_calculatescatterplot(LibMCEnv_DataTable pDataTable, LibMCEnv_DataTableScatterPlotOptions pScatterPlotOptions, LibMCEnv_ScatterPlot * pScatterPlot)
+LibMCEnvResult libmcenv_datatable_appendscaledint32columnvalues(LibMCEnv_DataTable pDataTable, const char * pIdentifier, LibMCEnv_uint64 nValuesBufferSize, const LibMCEnv_int32 * pValuesBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pDataTable;
 
 	try {
-		if (pScatterPlot == nullptr)
+		if (pIdentifier == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		IBase* pIBaseClassScatterPlotOptions = (IBase *)pScatterPlotOptions;
-		IDataTableScatterPlotOptions* pIScatterPlotOptions = dynamic_cast<IDataTableScatterPlotOptions*>(pIBaseClassScatterPlotOptions);
-		if (!pIScatterPlotOptions)
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDCAST);
-		
-		IBase* pBaseScatterPlot(nullptr);
+		if ( (!pValuesBuffer) && (nValuesBufferSize>0))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
 		IDataTable* pIDataTable = dynamic_cast<IDataTable*>(pIBaseClass);
 		if (!pIDataTable)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pBaseScatterPlot = pIDataTable->CalculateScatterPlot(pIScatterPlotOptions);
+		pIDataTable->AppendScaledInt32ColumnValues(sIdentifier, nValuesBufferSize, pValuesBuffer);
 
-		*pScatterPlot = (IBase*)(pBaseScatterPlot);
 		return LIBMCENV_SUCCESS;
 	}
 	catch (ELibMCEnvInterfaceException & Exception) {
@@ -5452,13 +7683,149 @@ LibMCEnvResult libmcenv_meshobject_isoriented(LibMCEnv_MeshObject pMeshObject, b
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	try {
-		if (pOrientedResult == nullptr)
+		if (pOrientedResult == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pOrientedResult = pIMeshObject->IsOriented();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_meshobject_iswatertight(LibMCEnv_MeshObject pMeshObject, bool * pWatertightResult)
+{
+	IBase* pIBaseClass = (IBase *)pMeshObject;
+
+	try {
+		if (pWatertightResult == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pWatertightResult = pIMeshObject->IsWatertight();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_meshobject_getmaxvertexid(LibMCEnv_MeshObject pMeshObject, LibMCEnv_uint32 * pMaxVertexID)
+{
+	IBase* pIBaseClass = (IBase *)pMeshObject;
+
+	try {
+		if (pMaxVertexID == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pMaxVertexID = pIMeshObject->GetMaxVertexID();
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_meshobject_vertexexists(LibMCEnv_MeshObject pMeshObject, LibMCEnv_uint32 nVertexID, bool * pVertexExists)
+{
+	IBase* pIBaseClass = (IBase *)pMeshObject;
+
+	try {
+		if (pVertexExists == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pVertexExists = pIMeshObject->VertexExists(nVertexID);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_meshobject_getvertex(LibMCEnv_MeshObject pMeshObject, LibMCEnv_uint32 nVertexID, LibMCEnv_double * pX, LibMCEnv_double * pY, LibMCEnv_double * pZ, bool * pVertexExists)
+{
+	IBase* pIBaseClass = (IBase *)pMeshObject;
+
+	try {
+		if (!pX)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (!pY)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (!pZ)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (pVertexExists == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pVertexExists = pIMeshObject->GetVertex(nVertexID, *pX, *pY, *pZ);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_meshobject_getvertexids(LibMCEnv_MeshObject pMeshObject, const LibMCEnv_uint64 nVertexIDsBufferSize, LibMCEnv_uint64* pVertexIDsNeededCount, LibMCEnv_uint32 * pVertexIDsBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pMeshObject;
+
+	try {
+		if ((!pVertexIDsBuffer) && !(pVertexIDsNeededCount))
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		*pOrientedResult = pIMeshObject->IsOriented();
+		pIMeshObject->GetVertexIDs(nVertexIDsBufferSize, pVertexIDsNeededCount, pVertexIDsBuffer);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -5473,18 +7840,18 @@ LibMCEnvResult libmcenv_meshobject_isoriented(LibMCEnv_MeshObject pMeshObject, b
 	}
 }
 
-LibMCEnvResult libmcenv_meshobject_iswatertight(LibMCEnv_MeshObject pMeshObject, bool * pWatertightResult)
+LibMCEnvResult libmcenv_meshobject_getallvertices(LibMCEnv_MeshObject pMeshObject, const LibMCEnv_uint64 nVerticesBufferSize, LibMCEnv_uint64* pVerticesNeededCount, sLibMCEnvMeshVertex3D * pVerticesBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	try {
-		if (pWatertightResult == nullptr)
+		if ((!pVerticesBuffer) && !(pVerticesNeededCount))
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		*pWatertightResult = pIMeshObject->IsWatertight();
+		pIMeshObject->GetAllVertices(nVerticesBufferSize, pVerticesNeededCount, pVerticesBuffer);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -5499,18 +7866,18 @@ LibMCEnvResult libmcenv_meshobject_iswatertight(LibMCEnv_MeshObject pMeshObject,
 	}
 }
 
-LibMCEnvResult libmcenv_meshobject_getmaxvertexid(LibMCEnv_MeshObject pMeshObject, LibMCEnv_uint32 * pMaxVertexID)
+LibMCEnvResult libmcenv_meshobject_getmaxtriangleid(LibMCEnv_MeshObject pMeshObject, LibMCEnv_uint32 * pMaxTriangleID)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	try {
-		if (pMaxVertexID == nullptr)
+		if (pMaxTriangleID == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		*pMaxVertexID = pIMeshObject->GetMaxVertexID();
+		*pMaxTriangleID = pIMeshObject->GetMaxTriangleID();
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -5525,18 +7892,18 @@ LibMCEnvResult libmcenv_meshobject_getmaxvertexid(LibMCEnv_MeshObject pMeshObjec
 	}
 }
 
-LibMCEnvResult libmcenv_meshobject_vertexexists(LibMCEnv_MeshObject pMeshObject, LibMCEnv_uint32 nVertexID, bool * pVertexExists)
+LibMCEnvResult libmcenv_meshobject_triangeexists(LibMCEnv_MeshObject pMeshObject, LibMCEnv_uint32 nTriangleID, bool * pTriangleExists)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	try {
-		if (pVertexExists == nullptr)
+		if (pTriangleExists == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		*pVertexExists = pIMeshObject->VertexExists(nVertexID);
+		*pTriangleExists = pIMeshObject->TriangeExists(nTriangleID);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -5551,16 +7918,16 @@ LibMCEnvResult libmcenv_meshobject_vertexexists(LibMCEnv_MeshObject pMeshObject,
 	}
 }
 
-LibMCEnvResult libmcenv_meshobject_getvertex(LibMCEnv_MeshObject pMeshObject, LibMCEnv_uint32 nVertexID, LibMCEnv_double * pX, LibMCEnv_double * pY, LibMCEnv_double * pZ, bool * pVertexExists)
+LibMCEnvResult libmcenv_meshobject_gettriangle(LibMCEnv_MeshObject pMeshObject, LibMCEnv_uint32 nTriangleID, LibMCEnv_uint32 * pVertex1ID, LibMCEnv_uint32 * pVertex2ID, LibMCEnv_uint32 * pVertex3ID, bool * pVertexExists)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	try {
-		if (!pX)
+		if (!pVertex1ID)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if (!pY)
+		if (!pVertex2ID)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if (!pZ)
+		if (!pVertex3ID)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
 		if (pVertexExists == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
@@ -5568,7 +7935,7 @@ LibMCEnvResult libmcenv_meshobject_getvertex(LibMCEnv_MeshObject pMeshObject, Li
 		if (!pIMeshObject)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		*pVertexExists = pIMeshObject->GetVertex(nVertexID, *pX, *pY, *pZ);
+		*pVertexExists = pIMeshObject->GetTriangle(nTriangleID, *pVertex1ID, *pVertex2ID, *pVertex3ID);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -5583,18 +7950,18 @@ LibMCEnvResult libmcenv_meshobject_getvertex(LibMCEnv_MeshObject pMeshObject, Li
 	}
 }
 
-LibMCEnvResult libmcenv_meshobject_getvertexids(LibMCEnv_MeshObject pMeshObject, const LibMCEnv_uint64 nVertexIDsBufferSize, LibMCEnv_uint64* pVertexIDsNeededCount, LibMCEnv_uint32 * pVertexIDsBuffer)
+LibMCEnvResult libmcenv_meshobject_gettriangleids(LibMCEnv_MeshObject pMeshObject, const LibMCEnv_uint64 nTriangleIDsBufferSize, LibMCEnv_uint64* pTriangleIDsNeededCount, LibMCEnv_uint32 * pTriangleIDsBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	try {
-		if ((!pVertexIDsBuffer) && !(pVertexIDsNeededCount))
+		if ((!pTriangleIDsBuffer) && !(pTriangleIDsNeededCount))
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIMeshObject->GetVertexIDs(nVertexIDsBufferSize, pVertexIDsNeededCount, pVertexIDsBuffer);
+		pIMeshObject->GetTriangleIDs(nTriangleIDsBufferSize, pTriangleIDsNeededCount, pTriangleIDsBuffer);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -5609,18 +7976,18 @@ LibMCEnvResult libmcenv_meshobject_getvertexids(LibMCEnv_MeshObject pMeshObject,
 	}
 }
 
-LibMCEnvResult libmcenv_meshobject_getallvertices(LibMCEnv_MeshObject pMeshObject, const LibMCEnv_uint64 nVerticesBufferSize, LibMCEnv_uint64* pVerticesNeededCount, sLibMCEnvMeshVertex3D * pVerticesBuffer)
+LibMCEnvResult libmcenv_meshobject_getalltriangles(LibMCEnv_MeshObject pMeshObject, const LibMCEnv_uint64 nTrianglesBufferSize, LibMCEnv_uint64* pTrianglesNeededCount, sLibMCEnvMeshTriangle3D * pTrianglesBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	try {
-		if ((!pVerticesBuffer) && !(pVerticesNeededCount))
+		if ((!pTrianglesBuffer) && !(pTrianglesNeededCount))
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIMeshObject->GetAllVertices(nVerticesBufferSize, pVerticesNeededCount, pVerticesBuffer);
+		pIMeshObject->GetAllTriangles(nTrianglesBufferSize, pTrianglesNeededCount, pTrianglesBuffer);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -5635,18 +8002,16 @@ LibMCEnvResult libmcenv_meshobject_getallvertices(LibMCEnv_MeshObject pMeshObjec
 	}
 }
 
-LibMCEnvResult libmcenv_meshobject_getmaxtriangleid(LibMCEnv_MeshObject pMeshObject, LibMCEnv_uint32 * pMaxTriangleID)
+LibMCEnvResult libmcenv_meshobject_buildspatialindex(LibMCEnv_MeshObject pMeshObject)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	try {
-		if (pMaxTriangleID == nullptr)
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		*pMaxTriangleID = pIMeshObject->GetMaxTriangleID();
+		pIMeshObject->BuildSpatialIndex();
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -5661,18 +8026,18 @@ LibMCEnvResult libmcenv_meshobject_getmaxtriangleid(LibMCEnv_MeshObject pMeshObj
 	}
 }
 
-LibMCEnvResult libmcenv_meshobject_triangeexists(LibMCEnv_MeshObject pMeshObject, LibMCEnv_uint32 nTriangleID, bool * pTriangleExists)
+LibMCEnvResult libmcenv_meshobject_hasspatialindex(LibMCEnv_MeshObject pMeshObject, bool * pValue)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	try {
-		if (pTriangleExists == nullptr)
+		if (pValue == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		*pTriangleExists = pIMeshObject->TriangeExists(nTriangleID);
+		*pValue = pIMeshObject->HasSpatialIndex();
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -5687,24 +8052,22 @@ LibMCEnvResult libmcenv_meshobject_triangeexists(LibMCEnv_MeshObject pMeshObject
 	}
 }
 
-LibMCEnvResult libmcenv_meshobject_gettriangle(LibMCEnv_MeshObject pMeshObject, LibMCEnv_uint32 nTriangleID, LibMCEnv_uint32 * pVertex1ID, LibMCEnv_uint32 * pVertex2ID, LibMCEnv_uint32 * pVertex3ID, bool * pVertexExists)
+LibMCEnvResult libmcenv_meshobject_castray(LibMCEnv_MeshObject pMeshObject, LibMCEnv_double dOriginX, LibMCEnv_double dOriginY, LibMCEnv_double dOriginZ, LibMCEnv_double dDirectionX, LibMCEnv_double dDirectionY, LibMCEnv_double dDirectionZ, LibMCEnv_uint32 * pTriangleID, LibMCEnv_double * pDistance, bool * pHit)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	try {
-		if (!pVertex1ID)
-			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if (!pVertex2ID)
+		if (!pTriangleID)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if (!pVertex3ID)
+		if (!pDistance)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
-		if (pVertexExists == nullptr)
+		if (pHit == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		*pVertexExists = pIMeshObject->GetTriangle(nTriangleID, *pVertex1ID, *pVertex2ID, *pVertex3ID);
+		*pHit = pIMeshObject->CastRay(dOriginX, dOriginY, dOriginZ, dDirectionX, dDirectionY, dDirectionZ, *pTriangleID, *pDistance);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -5719,7 +8082,7 @@ LibMCEnvResult libmcenv_meshobject_gettriangle(LibMCEnv_MeshObject pMeshObject,
 	}
 }
 
-LibMCEnvResult libmcenv_meshobject_gettriangleids(LibMCEnv_MeshObject pMeshObject, const LibMCEnv_uint64 nTriangleIDsBufferSize, LibMCEnv_uint64* pTriangleIDsNeededCount, LibMCEnv_uint32 * pTriangleIDsBuffer)
+LibMCEnvResult libmcenv_meshobject_findtrianglesinbox(LibMCEnv_MeshObject pMeshObject, LibMCEnv_double dMinX, LibMCEnv_double dMinY, LibMCEnv_double dMinZ, LibMCEnv_double dMaxX, LibMCEnv_double dMaxY, LibMCEnv_double dMaxZ, const LibMCEnv_uint64 nTriangleIDsBufferSize, LibMCEnv_uint64* pTriangleIDsNeededCount, LibMCEnv_uint32 * pTriangleIDsBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
@@ -5730,7 +8093,7 @@ LibMCEnvResult libmcenv_meshobject_gettriangleids(LibMCEnv_MeshObject pMeshObjec
 		if (!pIMeshObject)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIMeshObject->GetTriangleIDs(nTriangleIDsBufferSize, pTriangleIDsNeededCount, pTriangleIDsBuffer);
+		pIMeshObject->FindTrianglesInBox(dMinX, dMinY, dMinZ, dMaxX, dMaxY, dMaxZ, nTriangleIDsBufferSize, pTriangleIDsNeededCount, pTriangleIDsBuffer);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -5745,18 +8108,28 @@ LibMCEnvResult libmcenv_meshobject_gettriangleids(LibMCEnv_MeshObject pMeshObjec
 	}
 }
 
-LibMCEnvResult libmcenv_meshobject_getalltriangles(LibMCEnv_MeshObject pMeshObject, const LibMCEnv_uint64 nTrianglesBufferSize, LibMCEnv_uint64* pTrianglesNeededCount, sLibMCEnvMeshTriangle3D * pTrianglesBuffer)
+LibMCEnvResult libmcenv_meshobject_findclosestpoint(LibMCEnv_MeshObject pMeshObject, LibMCEnv_double dX, LibMCEnv_double dY, LibMCEnv_double dZ, LibMCEnv_uint32 * pTriangleID, LibMCEnv_double * pClosestX, LibMCEnv_double * pClosestY, LibMCEnv_double * pClosestZ, LibMCEnv_double * pDistance, bool * pFound)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	try {
-		if ((!pTrianglesBuffer) && !(pTrianglesNeededCount))
+		if (!pTriangleID)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (!pClosestX)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (!pClosestY)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (!pClosestZ)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (!pDistance)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (pFound == nullptr)
 			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
 		
-		pIMeshObject->GetAllTriangles(nTrianglesBufferSize, pTrianglesNeededCount, pTrianglesBuffer);
+		*pFound = pIMeshObject->FindClosestPoint(dX, dY, dZ, *pTriangleID, *pClosestX, *pClosestY, *pClosestZ, *pDistance);
 
 		return LIBMCENV_SUCCESS;
 	}
@@ -8668,6 +11041,186 @@ LibMCEnvResult libmcenv_toolpathlayer_calculateextentsinmm(LibMCEnv_ToolpathLaye
 	}
 }
 
+LibMCEnvResult libmcenv_toolpathlayer_findprofilevalueid(LibMCEnv_ToolpathLayer pToolpathLayer, const char * pNamespace, const char * pValueName, LibMCEnv_uint32 * pValueID)
+{
+	IBase* pIBaseClass = (IBase *)pToolpathLayer;
+
+	try {
+		if (pNamespace == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (pValueName == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (pValueID == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sNamespace(pNamespace);
+		std::string sValueName(pValueName);
+		IToolpathLayer* pIToolpathLayer = dynamic_cast<IToolpathLayer*>(pIBaseClass);
+		if (!pIToolpathLayer)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		*pValueID = pIToolpathLayer->FindProfileValueID(sNamespace, sValueName);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_toolpathlayer_exportsegmenttable(LibMCEnv_ToolpathLayer pToolpathLayer, const LibMCEnv_uint64 nSegmentTypesBufferSize, LibMCEnv_uint64* pSegmentTypesNeededCount, LibMCEnv_uint32 * pSegmentTypesBuffer, const LibMCEnv_uint64 nPointOffsetsBufferSize, LibMCEnv_uint64* pPointOffsetsNeededCount, LibMCEnv_uint32 * pPointOffsetsBuffer, const LibMCEnv_uint64 nLocalPartIDsBufferSize, LibMCEnv_uint64* pLocalPartIDsNeededCount, LibMCEnv_uint32 * pLocalPartIDsBuffer, const LibMCEnv_uint64 nProfileIDsBufferSize, LibMCEnv_uint64* pProfileIDsNeededCount, LibMCEnv_uint32 * pProfileIDsBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pToolpathLayer;
+
+	try {
+		if ((!pSegmentTypesBuffer) && !(pSegmentTypesNeededCount))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if ((!pPointOffsetsBuffer) && !(pPointOffsetsNeededCount))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if ((!pLocalPartIDsBuffer) && !(pLocalPartIDsNeededCount))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if ((!pProfileIDsBuffer) && !(pProfileIDsNeededCount))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IToolpathLayer* pIToolpathLayer = dynamic_cast<IToolpathLayer*>(pIBaseClass);
+		if (!pIToolpathLayer)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIToolpathLayer->ExportSegmentTable(nSegmentTypesBufferSize, pSegmentTypesNeededCount, pSegmentTypesBuffer, nPointOffsetsBufferSize, pPointOffsetsNeededCount, pPointOffsetsBuffer, nLocalPartIDsBufferSize, pLocalPartIDsNeededCount, pLocalPartIDsBuffer, nProfileIDsBufferSize, pProfileIDsNeededCount, pProfileIDsBuffer);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_toolpathlayer_exportprofilevaluecolumns(LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint64 nColumnsBufferSize, const sLibMCEnvToolpathProfileValueColumn * pColumnsBuffer, const LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_double * pValuesBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pToolpathLayer;
+
+	try {
+		if ( (!pColumnsBuffer) && (nColumnsBufferSize>0))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if ((!pValuesBuffer) && !(pValuesNeededCount))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IToolpathLayer* pIToolpathLayer = dynamic_cast<IToolpathLayer*>(pIBaseClass);
+		if (!pIToolpathLayer)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIToolpathLayer->ExportProfileValueColumns(nColumnsBufferSize, pColumnsBuffer, nValuesBufferSize, pValuesNeededCount, pValuesBuffer);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_toolpathlayer_exportsegmentintegerattributes(LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_uint64 nAttributeIDsBufferSize, const LibMCEnv_uint32 * pAttributeIDsBuffer, const LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_int64 * pValuesBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pToolpathLayer;
+
+	try {
+		if ( (!pAttributeIDsBuffer) && (nAttributeIDsBufferSize>0))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if ((!pValuesBuffer) && !(pValuesNeededCount))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IToolpathLayer* pIToolpathLayer = dynamic_cast<IToolpathLayer*>(pIBaseClass);
+		if (!pIToolpathLayer)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIToolpathLayer->ExportSegmentIntegerAttributes(nAttributeIDsBufferSize, pAttributeIDsBuffer, nValuesBufferSize, pValuesNeededCount, pValuesBuffer);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_toolpathlayer_exportpointdata(LibMCEnv_ToolpathLayer pToolpathLayer, const LibMCEnv_uint64 nPointDataBufferSize, LibMCEnv_uint64* pPointDataNeededCount, sLibMCEnvPosition2D * pPointDataBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pToolpathLayer;
+
+	try {
+		if ((!pPointDataBuffer) && !(pPointDataNeededCount))
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IToolpathLayer* pIToolpathLayer = dynamic_cast<IToolpathLayer*>(pIBaseClass);
+		if (!pIToolpathLayer)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIToolpathLayer->ExportPointData(nPointDataBufferSize, pPointDataNeededCount, pPointDataBuffer);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
+LibMCEnvResult libmcenv_toolpathlayer_encodebinarytiles(LibMCEnv_ToolpathLayer pToolpathLayer, LibMCEnv_double dResolutionInMM, LibMCEnv_uint64 * pEncodedSize, LibMCEnv_uint32 * pTileCount, LibMCEnv_uint64 * pPointCount, LibMCEnv_uint64 * pTreeBuildTimeInMicroseconds, LibMCEnv_uint64 * pEncodingTimeInMicroseconds)
+{
+	IBase* pIBaseClass = (IBase *)pToolpathLayer;
+
+	try {
+		if (!pEncodedSize)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (!pTileCount)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (!pPointCount)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (!pTreeBuildTimeInMicroseconds)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (!pEncodingTimeInMicroseconds)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		IToolpathLayer* pIToolpathLayer = dynamic_cast<IToolpathLayer*>(pIBaseClass);
+		if (!pIToolpathLayer)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pIToolpathLayer->EncodeBinaryTiles(dResolutionInMM, *pEncodedSize, *pTileCount, *pPointCount, *pTreeBuildTimeInMicroseconds, *pEncodingTimeInMicroseconds);
+
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 
 /*************************************************************************************************************************
  Class implementation for ToolpathAccessor
@@ -23533,6 +26086,37 @@ LibMCEnvResult libmcenv_stateenvironment_unloadalltoolpathes(LibMCEnv_StateEnvir
 	}
 }
 
+LibMCEnvResult libmcenv_stateenvironment_createsynthetictoolpath(LibMCEnv_StateEnvironment pStateEnvironment, const char * pName, LibMCEnv_uint32 nLayerCount, LibMCEnv_uint32 nSegmentsPerLayer, LibMCEnv_uint32 nPointsPerSegment, LibMCEnv_uint32 nProfileCount, LibMCEnv_uint32 nLaserIndex, LibMCEnv_uint32 nSeed, LibMCEnv_ToolpathAccessor * pToolpathInstance)
+{
+	IBase* pIBaseClass = (IBase *)pStateEnvironment;
+
+	try {
+		if (pName == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		if (pToolpathInstance == nullptr)
+			throw ELibMCEnvInterfaceException (LIBMCENV_ERROR_INVALIDPARAM);
+		std::string sName(pName);
+		IBase* pBaseToolpathInstance(nullptr);
+		IStateEnvironment* pIStateEnvironment = dynamic_cast<IStateEnvironment*>(pIBaseClass);
+		if (!pIStateEnvironment)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+		
+		pBaseToolpathInstance = pIStateEnvironment->CreateSyntheticToolpath(sName, nLayerCount, nSegmentsPerLayer, nPointsPerSegment, nProfileCount, nLaserIndex, nSeed);
+
+		*pToolpathInstance = (IBase*)(pBaseToolpathInstance);
+		return LIBMCENV_SUCCESS;
+	}
+	catch (ELibMCEnvInterfaceException & Exception) {
+		return handleLibMCEnvException(pIBaseClass, Exception);
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException);
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass);
+	}
+}
+
 LibMCEnvResult libmcenv_stateenvironment_setnextstate(LibMCEnv_StateEnvironment pStateEnvironment, const char * pStateName)
 {
 	IBase* pIBaseClass = (IBase *)pStateEnvironment;
@@ -28309,6 +30893,22 @@ LibMCEnvResult LibMCEnv::Impl::LibMCEnv_GetProcAddress (const char * pProcName,
 		*ppProcAddress = (void*) &libmcenv_pngimagestoreoptions_getstorageformat;
 	if (sProcName == "libmcenv_pngimagestoreoptions_setstorageformat") 
 		*ppProcAddress = (void*) &libmcenv_pngimagestoreoptions_setstorageformat;
+	if (sProcName == "libmcenv_pngimagestoreoptions_getcompressionlevel") 
+		*ppProcAddress = (void*) &libmcenv_pngimagestoreoptions_getcompressionlevel;
+	if (sProcName == "libmcenv_pngimagestoreoptions_setcompressionlevel") 
+		*ppProcAddress = (void*) &libmcenv_pngimagestoreoptions_setcompressionlevel;
+	if (sProcName == "libmcenv_pngimagestoreoptions_getfilterstrategy") 
+		*ppProcAddress = (void*) &libmcenv_pngimagestoreoptions_getfilterstrategy;
+	if (sProcName == "libmcenv_pngimagestoreoptions_setfilterstrategy") 
+		*ppProcAddress = (void*) &libmcenv_pngimagestoreoptions_setfilterstrategy;
+	if (sProcName == "libmcenv_pngimagestoreoptions_getencoderbackend") 
+		*ppProcAddress = (void*) &libmcenv_pngimagestoreoptions_getencoderbackend;
+	if (sProcName == "libmcenv_pngimagestoreoptions_setencoderbackend") 
+		*ppProcAddress = (void*) &libmcenv_pngimagestoreoptions_setencoderbackend;
+	if (sProcName == "libmcenv_pngimagestoreoptions_getthreadcount") 
+		*ppProcAddress = (void*) &libmcenv_pngimagestoreoptions_getthreadcount;
+	if (sProcName == "libmcenv_pngimagestoreoptions_setthreadcount") 
+		*ppProcAddress = (void*) &libmcenv_pngimagestoreoptions_setthreadcount;
 	if (sProcName == "libmcenv_pngimagedata_getsizeinpixels") 
 		*ppProcAddress = (void*) &libmcenv_pngimagedata_getsizeinpixels;
 	if (sProcName == "libmcenv_pngimagedata_getpngdatastream") 
@@ -28383,6 +30983,8 @@ LibMCEnvResult LibMCEnv::Impl::LibMCEnv_GetProcAddress (const char * pProcName,
 		*ppProcAddress = (void*) &libmcenv_scatterplot_getpointposition;
 	if (sProcName == "libmcenv_scatterplot_getboundaries") 
 		*ppProcAddress = (void*) &libmcenv_scatterplot_getboundaries;
+	if (sProcName == "libmcenv_scatterplot_querydensity") 
+		*ppProcAddress = (void*) &libmcenv_scatterplot_querydensity;
 	if (sProcName == "libmcenv_scatterplot_release") 
 		*ppProcAddress = (void*) &libmcenv_scatterplot_release;
 	if (sProcName == "libmcenv_discretefielddata2dstoreoptions_resettodefaults") 
@@ -28431,6 +31033,46 @@ LibMCEnvResult LibMCEnv::Impl::LibMCEnv_GetProcAddress (const char * pProcName,
 		*ppProcAddress = (void*) &libmcenv_discretefielddata2d_addfield;
 	if (sProcName == "libmcenv_discretefielddata2d_duplicate") 
 		*ppProcAddress = (void*) &libmcenv_discretefielddata2d_duplicate;
+	if (sProcName == "libmcenv_discretefielddata2d_getstorageprecision") 
+		*ppProcAddress = (void*) &libmcenv_discretefielddata2d_getstorageprecision;
+	if (sProcName == "libmcenv_discretefielddata2d_setstorageprecision") 
+		*ppProcAddress = (void*) &libmcenv_discretefielddata2d_setstorageprecision;
+	if (sProcName == "libmcenv_discretefielddata2d_getstoragelayout") 
+		*ppProcAddress = (void*) &libmcenv_discretefielddata2d_getstoragelayout;
+	if (sProcName == "libmcenv_discretefielddata2d_setstoragelayout") 
+		*ppProcAddress = (void*) &libmcenv_discretefielddata2d_setstoragelayout;
+	if (sProcName == "libmcenv_discretefielddata2d_getstoragesize") 
+		*ppProcAddress = (void*) &libmcenv_discretefielddata2d_getstoragesize;
+	if (sProcName == "libmcenv_discretefielddata2d_compact") 
+		*ppProcAddress = (void*) &libmcenv_discretefielddata2d_compact;
+	if (sProcName == "libmcenv_discretefielddata2d_getthreadcount") 
+		*ppProcAddress = (void*) &libmcenv_discretefielddata2d_getthreadcount;
+	if (sProcName == "libmcenv_discretefielddata2d_setthreadcount") 
+		*ppProcAddress = (void*) &libmcenv_discretefielddata2d_setthreadcount;
+	if (sProcName == "libmcenv_discretefielddata2d_setsimdkernelsenabled") 
+		*ppProcAddress = (void*) &libmcenv_discretefielddata2d_setsimdkernelsenabled;
+	if (sProcName == "libmcenv_discretefielddata2d_getsimdkernelname") 
+		*ppProcAddress = (void*) &libmcenv_discretefielddata2d_getsimdkernelname;
+	if (sProcName == "libmcenv_datatablewriteoptions_resettodefaults") 
+		*ppProcAddress = (void*) &libmcenv_datatablewriteoptions_resettodefaults;
+	if (sProcName == "libmcenv_datatablewriteoptions_getdefaultencoding") 
+		*ppProcAddress = (void*) &libmcenv_datatablewriteoptions_getdefaultencoding;
+	if (sProcName == "libmcenv_datatablewriteoptions_setdefaultencoding") 
+		*ppProcAddress = (void*) &libmcenv_datatablewriteoptions_setdefaultencoding;
+	if (sProcName == "libmcenv_datatablewriteoptions_getcolumnencoding") 
+		*ppProcAddress = (void*) &libmcenv_datatablewriteoptions_getcolumnencoding;
+	if (sProcName == "libmcenv_datatablewriteoptions_setcolumnencoding") 
+		*ppProcAddress = (void*) &libmcenv_datatablewriteoptions_setcolumnencoding;
+	if (sProcName == "libmcenv_datatablewriteoptions_clearcolumnencodings") 
+		*ppProcAddress = (void*) &libmcenv_datatablewriteoptions_clearcolumnencodings;
+	if (sProcName == "libmcenv_datatablewriteoptions_getcompression") 
+		*ppProcAddress = (void*) &libmcenv_datatablewriteoptions_getcompression;
+	if (sProcName == "libmcenv_datatablewriteoptions_setcompression") 
+		*ppProcAddress = (void*) &libmcenv_datatablewriteoptions_setcompression;
+	if (sProcName == "libmcenv_datatablewriteoptions_getcompressionlevel") 
+		*ppProcAddress = (void*) &libmcenv_datatablewriteoptions_getcompressionlevel;
+	if (sProcName == "libmcenv_datatablewriteoptions_setcompressionlevel") 
+		*ppProcAddress = (void*) &libmcenv_datatablewriteoptions_setcompressionlevel;
 	if (sProcName == "libmcenv_datatablecsvwriteoptions_getseparator") 
 		*ppProcAddress = (void*) &libmcenv_datatablecsvwriteoptions_getseparator;
 	if (sProcName == "libmcenv_datatablecsvwriteoptions_setseparator") 
@@ -28453,6 +31095,70 @@ LibMCEnvResult LibMCEnv::Impl::LibMCEnv_GetProcAddress (const char * pProcName,
 		*ppProcAddress = (void*) &libmcenv_datatablescatterplotoptions_getyaxisoffset;
 	if (sProcName == "libmcenv_datatablescatterplotoptions_adddatachannel") 
 		*ppProcAddress = (void*) &libmcenv_datatablescatterplotoptions_adddatachannel;
+	if (sProcName == "libmcenv_datatablefilter_addcondition") 
+		*ppProcAddress = (void*) &libmcenv_datatablefilter_addcondition;
+	if (sProcName == "libmcenv_datatablefilter_getconditioncount") 
+		*ppProcAddress = (void*) &libmcenv_datatablefilter_getconditioncount;
+	if (sProcName == "libmcenv_datatablefilter_getconditioncolumn") 
+		*ppProcAddress = (void*) &libmcenv_datatablefilter_getconditioncolumn;
+	if (sProcName == "libmcenv_datatablefilter_getconditionoperator") 
+		*ppProcAddress = (void*) &libmcenv_datatablefilter_getconditionoperator;
+	if (sProcName == "libmcenv_datatablefilter_getconditionvalue") 
+		*ppProcAddress = (void*) &libmcenv_datatablefilter_getconditionvalue;
+	if (sProcName == "libmcenv_datatablefilter_getconditionuppervalue") 
+		*ppProcAddress = (void*) &libmcenv_datatablefilter_getconditionuppervalue;
+	if (sProcName == "libmcenv_datatablefilter_clear") 
+		*ppProcAddress = (void*) &libmcenv_datatablefilter_clear;
+	if (sProcName == "libmcenv_datatablesortoptions_addsortcolumn") 
+		*ppProcAddress = (void*) &libmcenv_datatablesortoptions_addsortcolumn;
+	if (sProcName == "libmcenv_datatablesortoptions_getsortcolumncount") 
+		*ppProcAddress = (void*) &libmcenv_datatablesortoptions_getsortcolumncount;
+	if (sProcName == "libmcenv_datatablesortoptions_getsortcolumn") 
+		*ppProcAddress = (void*) &libmcenv_datatablesortoptions_getsortcolumn;
+	if (sProcName == "libmcenv_datatablesortoptions_getsortcolumndescending") 
+		*ppProcAddress = (void*) &libmcenv_datatablesortoptions_getsortcolumndescending;
+	if (sProcName == "libmcenv_datatablesortoptions_clear") 
+		*ppProcAddress = (void*) &libmcenv_datatablesortoptions_clear;
+	if (sProcName == "libmcenv_datatableaggregationoptions_addgroupcolumn") 
+		*ppProcAddress = (void*) &libmcenv_datatableaggregationoptions_addgroupcolumn;
+	if (sProcName == "libmcenv_datatableaggregationoptions_getgroupcolumncount") 
+		*ppProcAddress = (void*) &libmcenv_datatableaggregationoptions_getgroupcolumncount;
+	if (sProcName == "libmcenv_datatableaggregationoptions_getgroupcolumn") 
+		*ppProcAddress = (void*) &libmcenv_datatableaggregationoptions_getgroupcolumn;
+	if (sProcName == "libmcenv_datatableaggregationoptions_addaggregation") 
+		*ppProcAddress = (void*) &libmcenv_datatableaggregationoptions_addaggregation;
+	if (sProcName == "libmcenv_datatableaggregationoptions_getaggregationcount") 
+		*ppProcAddress = (void*) &libmcenv_datatableaggregationoptions_getaggregationcount;
+	if (sProcName == "libmcenv_datatableaggregationoptions_getaggregationresultidentifier") 
+		*ppProcAddress = (void*) &libmcenv_datatableaggregationoptions_getaggregationresultidentifier;
+	if (sProcName == "libmcenv_datatableaggregationoptions_getaggregationcolumn") 
+		*ppProcAddress = (void*) &libmcenv_datatableaggregationoptions_getaggregationcolumn;
+	if (sProcName == "libmcenv_datatableaggregationoptions_getaggregationtype") 
+		*ppProcAddress = (void*) &libmcenv_datatableaggregationoptions_getaggregationtype;
+	if (sProcName == "libmcenv_datatableaggregationoptions_clear") 
+		*ppProcAddress = (void*) &libmcenv_datatableaggregationoptions_clear;
+	if (sProcName == "libmcenv_datatableloadoptions_addcolumn") 
+		*ppProcAddress = (void*) &libmcenv_datatableloadoptions_addcolumn;
+	if (sProcName == "libmcenv_datatableloadoptions_getcolumncount") 
+		*ppProcAddress = (void*) &libmcenv_datatableloadoptions_getcolumncount;
+	if (sProcName == "libmcenv_datatableloadoptions_getcolumn") 
+		*ppProcAddress = (void*) &libmcenv_datatableloadoptions_getcolumn;
+	if (sProcName == "libmcenv_datatableloadoptions_clearcolumns") 
+		*ppProcAddress = (void*) &libmcenv_datatableloadoptions_clearcolumns;
+	if (sProcName == "libmcenv_datatableloadoptions_setrowrange") 
+		*ppProcAddress = (void*) &libmcenv_datatableloadoptions_setrowrange;
+	if (sProcName == "libmcenv_datatableloadoptions_hasrowrange") 
+		*ppProcAddress = (void*) &libmcenv_datatableloadoptions_hasrowrange;
+	if (sProcName == "libmcenv_datatableloadoptions_getfirstrow") 
+		*ppProcAddress = (void*) &libmcenv_datatableloadoptions_getfirstrow;
+	if (sProcName == "libmcenv_datatableloadoptions_getrowcount") 
+		*ppProcAddress = (void*) &libmcenv_datatableloadoptions_getrowcount;
+	if (sProcName == "libmcenv_datatableloadoptions_clearrowrange") 
+		*ppProcAddress = (void*) &libmcenv_datatableloadoptions_clearrowrange;
+	if (sProcName == "libmcenv_datatableloadoptions_setlazyloading") 
+		*ppProcAddress = (void*) &libmcenv_datatableloadoptions_setlazyloading;
+	if (sProcName == "libmcenv_datatableloadoptions_getlazyloading") 
+		*ppProcAddress = (void*) &libmcenv_datatableloadoptions_getlazyloading;
 	if (sProcName == "libmcenv_datatable_addcolumn") 
 		*ppProcAddress = (void*) &libmcenv_datatable_addcolumn;
 	if (sProcName == "libmcenv_datatable_removecolumn") 
@@ -28507,6 +31213,40 @@ LibMCEnvResult LibMCEnv::Impl::LibMCEnv_GetProcAddress (const char * pProcName,
 		*ppProcAddress = (void*) &libmcenv_datatable_createscatterplotoptions;
 	if (sProcName == "libmcenv_datatable_calculatescatterplot") 
 		*ppProcAddress = (void*) &libmcenv_datatable_calculatescatterplot;
+	if (sProcName == "libmcenv_datatable_getthreadcount") 
+		*ppProcAddress = (void*) &libmcenv_datatable_getthreadcount;
+	if (sProcName == "libmcenv_datatable_setthreadcount") 
+		*ppProcAddress = (void*) &libmcenv_datatable_setthreadcount;
+	if (sProcName == "libmcenv_datatable_createfilter") 
+		*ppProcAddress = (void*) &libmcenv_datatable_createfilter;
+	if (sProcName == "libmcenv_datatable_findrows") 
+		*ppProcAddress = (void*) &libmcenv_datatable_findrows;
+	if (sProcName == "libmcenv_datatable_filterrows") 
+		*ppProcAddress = (void*) &libmcenv_datatable_filterrows;
+	if (sProcName == "libmcenv_datatable_selectrows") 
+		*ppProcAddress = (void*) &libmcenv_datatable_selectrows;
+	if (sProcName == "libmcenv_datatable_createsortoptions") 
+		*ppProcAddress = (void*) &libmcenv_datatable_createsortoptions;
+	if (sProcName == "libmcenv_datatable_getsortedrowindices") 
+		*ppProcAddress = (void*) &libmcenv_datatable_getsortedrowindices;
+	if (sProcName == "libmcenv_datatable_sortrows") 
+		*ppProcAddress = (void*) &libmcenv_datatable_sortrows;
+	if (sProcName == "libmcenv_datatable_createaggregationoptions") 
+		*ppProcAddress = (void*) &libmcenv_datatable_createaggregationoptions;
+	if (sProcName == "libmcenv_datatable_aggregate") 
+		*ppProcAddress = (void*) &libmcenv_datatable_aggregate;
+	if (sProcName == "libmcenv_datatable_addwindowstatisticcolumn") 
+		*ppProcAddress = (void*) &libmcenv_datatable_addwindowstatisticcolumn;
+	if (sProcName == "libmcenv_datatable_createloadoptions") 
+		*ppProcAddress = (void*) &libmcenv_datatable_createloadoptions;
+	if (sProcName == "libmcenv_datatable_loadfromstreamwithoptions") 
+		*ppProcAddress = (void*) &libmcenv_datatable_loadfromstreamwithoptions;
+	if (sProcName == "libmcenv_datatable_iscolumnloaded") 
+		*ppProcAddress = (void*) &libmcenv_datatable_iscolumnloaded;
+	if (sProcName == "libmcenv_datatable_addscaledint32column") 
+		*ppProcAddress = (void*) &libmcenv_datatable_addscaledint32column;
+	if (sProcName == "libmcenv_datatable_appendscaledint32columnvalues") 
+		*ppProcAddress = (void*) &libmcenv_datatable_appendscaledint32columnvalues;
 	if (sProcName == "libmcenv_dataseries_getname") 
 		*ppProcAddress = (void*) &libmcenv_dataseries_getname;
 	if (sProcName == "libmcenv_dataseries_getuuid") 
@@ -28667,6 +31407,16 @@ LibMCEnvResult LibMCEnv::Impl::LibMCEnv_GetProcAddress (const char * pProcName,
 		*ppProcAddress = (void*) &libmcenv_meshobject_gettriangleids;
 	if (sProcName == "libmcenv_meshobject_getalltriangles") 
 		*ppProcAddress = (void*) &libmcenv_meshobject_getalltriangles;
+	if (sProcName == "libmcenv_meshobject_buildspatialindex") 
+		*ppProcAddress = (void*) &libmcenv_meshobject_buildspatialindex;
+	if (sProcName == "libmcenv_meshobject_hasspatialindex") 
+		*ppProcAddress = (void*) &libmcenv_meshobject_hasspatialindex;
+	if (sProcName == "libmcenv_meshobject_castray") 
+		*ppProcAddress = (void*) &libmcenv_meshobject_castray;
+	if (sProcName == "libmcenv_meshobject_findtrianglesinbox") 
+		*ppProcAddress = (void*) &libmcenv_meshobject_findtrianglesinbox;
+	if (sProcName == "libmcenv_meshobject_findclosestpoint") 
+		*ppProcAddress = (void*) &libmcenv_meshobject_findclosestpoint;
 	if (sProcName == "libmcenv_meshobject_ispersistent") 
 		*ppProcAddress = (void*) &libmcenv_meshobject_ispersistent;
 	if (sProcName == "libmcenv_meshobject_makepersistent") 
@@ -28847,6 +31597,18 @@ LibMCEnvResult LibMCEnv::Impl::LibMCEnv_GetProcAddress (const char * pProcName,
 		*ppProcAddress = (void*) &libmcenv_toolpathlayer_calculateextents;
 	if (sProcName == "libmcenv_toolpathlayer_calculateextentsinmm") 
 		*ppProcAddress = (void*) &libmcenv_toolpathlayer_calculateextentsinmm;
+	if (sProcName == "libmcenv_toolpathlayer_findprofilevalueid") 
+		*ppProcAddress = (void*) &libmcenv_toolpathlayer_findprofilevalueid;
+	if (sProcName == "libmcenv_toolpathlayer_exportsegmenttable") 
+		*ppProcAddress = (void*) &libmcenv_toolpathlayer_exportsegmenttable;
+	if (sProcName == "libmcenv_toolpathlayer_exportprofilevaluecolumns") 
+		*ppProcAddress = (void*) &libmcenv_toolpathlayer_exportprofilevaluecolumns;
+	if (sProcName == "libmcenv_toolpathlayer_exportsegmentintegerattributes") 
+		*ppProcAddress = (void*) &libmcenv_toolpathlayer_exportsegmentintegerattributes;
+	if (sProcName == "libmcenv_toolpathlayer_exportpointdata") 
+		*ppProcAddress = (void*) &libmcenv_toolpathlayer_exportpointdata;
+	if (sProcName == "libmcenv_toolpathlayer_encodebinarytiles") 
+		*ppProcAddress = (void*) &libmcenv_toolpathlayer_encodebinarytiles;
 	if (sProcName == "libmcenv_toolpathaccessor_getstorageuuid") 
 		*ppProcAddress = (void*) &libmcenv_toolpathaccessor_getstorageuuid;
 	if (sProcName == "libmcenv_toolpathaccessor_getbuilduuid") 
@@ -29729,6 +32491,8 @@ LibMCEnvResult LibMCEnv::Impl::LibMCEnv_GetProcAddress (const char * pProcName,
 		*ppProcAddress = (void*) &libmcenv_stateenvironment_getbuildexecution;
 	if (sProcName == "libmcenv_stateenvironment_unloadalltoolpathes") 
 		*ppProcAddress = (void*) &libmcenv_stateenvironment_unloadalltoolpathes;
+	if (sProcName == "libmcenv_stateenvironment_createsynthetictoolpath") 
+		*ppProcAddress = (void*) &libmcenv_stateenvironment_createsynthetictoolpath;
 	if (sProcName == "libmcenv_stateenvironment_setnextstate") 
 		*ppProcAddress = (void*) &libmcenv_stateenvironment_setnextstate;
 	if (sProcName == "libmcenv_stateenvironment_logmessage") 
@@ -307,6 +307,35 @@ typedef void * LibMCEnv_pvoid;
 #define LIBMCENV_ERROR_NOYAXISCOLUMNGIVEN 10210 /** No Y Axis Column given */
 #define LIBMCENV_ERROR_INVALIDSCATTERPLOTPOINTINDEX 10211 /** Invalid scatter plot index. */
 #define LIBMCENV_ERROR_SCATTERPLOTNOTFOUND 10212 /** Scatter plot not found */
+#define LIBMCENV_ERROR_INVALIDPNGCOMPRESSIONLEVEL 10213 /** Invalid PNG compression level */
+#define LIBMCENV_ERROR_INVALIDPNGFILTERSTRATEGY 10214 /** Invalid PNG filter strategy */
+#define LIBMCENV_ERROR_INVALIDPNGENCODERBACKEND 10215 /** Invalid PNG encoder backend */
+#define LIBMCENV_ERROR_INVALIDFIELDSTORAGEPRECISION 10216 /** Invalid field storage precision */
+#define LIBMCENV_ERROR_INVALIDFIELDTHREADCOUNT 10217 /** Invalid field thread count */
+#define LIBMCENV_ERROR_INVALIDFIELDSTORAGELAYOUT 10218 /** Invalid field storage layout */
+#define LIBMCENV_ERROR_FIELDTILECOUNTEXCEEDSMAXIMUM 10219 /** Field tile count exceeds maximum */
+#define LIBMCENV_ERROR_INVALIDDATATABLECOLUMNENCODING 10220 /** Invalid data table column encoding */
+#define LIBMCENV_ERROR_INVALIDDATATABLECOMPRESSION 10221 /** Invalid data table compression */
+#define LIBMCENV_ERROR_INVALIDDATATABLECOMPRESSIONLEVEL 10222 /** Invalid data table compression level */
+#define LIBMCENV_ERROR_UNSUPPORTEDDATATABLESTREAMVERSION 10223 /** Unsupported data table stream version */
+#define LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA 10224 /** Data table column data is corrupt */
+#define LIBMCENV_ERROR_COULDNOTCOMPRESSDATATABLECOLUMN 10225 /** Could not compress data table column */
+#define LIBMCENV_ERROR_INVALIDDATATABLEFILTEROPERATOR 10226 /** Invalid data table filter operator */
+#define LIBMCENV_ERROR_INVALIDDATATABLEAGGREGATION 10227 /** Invalid data table aggregation */
+#define LIBMCENV_ERROR_INVALIDDATATABLEWINDOWSTATISTIC 10228 /** Invalid data table window statistic */
+#define LIBMCENV_ERROR_INVALIDDATATABLEWINDOWSIZE 10229 /** Invalid data table window size */
+#define LIBMCENV_ERROR_DATATABLEROWINDEXOUTOFRANGE 10230 /** Data table row index out of range */
+#define LIBMCENV_ERROR_INVALIDDATATABLETHREADCOUNT 10231 /** Invalid data table thread count */
+#define LIBMCENV_ERROR_INVALIDDATATABLEQUERYINDEX 10232 /** Invalid data table query index */
+#define LIBMCENV_ERROR_INVALIDDATATABLEROWRANGE 10233 /** Invalid data table row range */
+#define LIBMCENV_ERROR_INVALIDRAYDIRECTION 10234 /** Invalid ray direction */
+#define LIBMCENV_ERROR_INVALIDBOUNDINGBOX 10235 /** Invalid bounding box */
+#define LIBMCENV_ERROR_COLUMNISNOTSCALEDINT32 10236 /** Column is not a scaled int32 column or its values have been accessed already. */
+#define LIBMCENV_ERROR_INVALIDPROFILEVALUEID 10237 /** Invalid profile value ID. */
+#define LIBMCENV_ERROR_INVALIDTOOLPATHRESOLUTION 10238 /** Invalid toolpath resolution */
+#define LIBMCENV_ERROR_INVALIDSCATTERPLOTVIEWPORT 10239 /** Invalid scatter plot viewport */
+#define LIBMCENV_ERROR_INVALIDSCATTERPLOTRESOLUTION 10240 /** Invalid scatter plot resolution */
+#define LIBMCENV_ERROR_EMPTYTOOLPATHNAME 10241 /** Empty toolpath name */
 
 /*************************************************************************************************************************
  Error strings for LibMCEnv
@@ -526,6 +555,35 @@ inline const char * LIBMCENV_GETERRORSTRING (LibMCEnvResult nErrorCode) {
     case LIBMCENV_ERROR_NOYAXISCOLUMNGIVEN: return "No Y Axis Column given";
     case LIBMCENV_ERROR_INVALIDSCATTERPLOTPOINTINDEX: return "Invalid scatter plot index.";
     case LIBMCENV_ERROR_SCATTERPLOTNOTFOUND: return "Scatter plot not found";
+    case LIBMCENV_ERROR_INVALIDPNGCOMPRESSIONLEVEL: return "Invalid PNG compression level";
+    case LIBMCENV_ERROR_INVALIDPNGFILTERSTRATEGY: return "Invalid PNG filter strategy";
+    case LIBMCENV_ERROR_INVALIDPNGENCODERBACKEND: return "Invalid PNG encoder backend";
+    case LIBMCENV_ERROR_INVALIDFIELDSTORAGEPRECISION: return "Invalid field storage precision";
+    case LIBMCENV_ERROR_INVALIDFIELDTHREADCOUNT: return "Invalid field thread count";
+    case LIBMCENV_ERROR_INVALIDFIELDSTORAGELAYOUT: return "Invalid field storage layout";
+    case LIBMCENV_ERROR_FIELDTILECOUNTEXCEEDSMAXIMUM: return "Field tile count exceeds maximum";
+    case LIBMCENV_ERROR_INVALIDDATATABLECOLUMNENCODING: return "Invalid data table column encoding";
+    case LIBMCENV_ERROR_INVALIDDATATABLECOMPRESSION: return "Invalid data table compression";
+    case LIBMCENV_ERROR_INVALIDDATATABLECOMPRESSIONLEVEL: return "Invalid data table compression level";
+    case LIBMCENV_ERROR_UNSUPPORTEDDATATABLESTREAMVERSION: return "Unsupported data table stream version";
+    case LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA: return "Data table column data is corrupt";
+    case LIBMCENV_ERROR_COULDNOTCOMPRESSDATATABLECOLUMN: return "Could not compress data table column";
+    case LIBMCENV_ERROR_INVALIDDATATABLEFILTEROPERATOR: return "Invalid data table filter operator";
+    case LIBMCENV_ERROR_INVALIDDATATABLEAGGREGATION: return "Invalid data table aggregation";
+    case LIBMCENV_ERROR_INVALIDDATATABLEWINDOWSTATISTIC: return "Invalid data table window statistic";
+    case LIBMCENV_ERROR_INVALIDDATATABLEWINDOWSIZE: return "Invalid data table window size";
+    case LIBMCENV_ERROR_DATATABLEROWINDEXOUTOFRANGE: return "Data table row index out of range";
+    case LIBMCENV_ERROR_INVALIDDATATABLETHREADCOUNT: return "Invalid data table thread count";
+    case LIBMCENV_ERROR_INVALIDDATATABLEQUERYINDEX: return "Invalid data table query index";
+    case LIBMCENV_ERROR_INVALIDDATATABLEROWRANGE: return "Invalid data table row range";
+    case LIBMCENV_ERROR_INVALIDRAYDIRECTION: return "Invalid ray direction";
+    case LIBMCENV_ERROR_INVALIDBOUNDINGBOX: return "Invalid bounding box";
+    case LIBMCENV_ERROR_COLUMNISNOTSCALEDINT32: return "Column is not a scaled int32 column or its values have been accessed already.";
+    case LIBMCENV_ERROR_INVALIDPROFILEVALUEID: return "Invalid profile value ID.";
+    case LIBMCENV_ERROR_INVALIDTOOLPATHRESOLUTION: return "Invalid toolpath resolution";
+    case LIBMCENV_ERROR_INVALIDSCATTERPLOTVIEWPORT: return "Invalid scatter plot viewport";
+    case LIBMCENV_ERROR_INVALIDSCATTERPLOTRESOLUTION: return "Invalid scatter plot resolution";
+    case LIBMCENV_ERROR_EMPTYTOOLPATHNAME: return "Empty toolpath name";
     default: return "unknown error";
   }
 }
@@ -551,6 +609,10 @@ typedef LibMCEnvHandle LibMCEnv_DiscreteFieldData2D;
 typedef LibMCEnvHandle LibMCEnv_DataTableWriteOptions;
 typedef LibMCEnvHandle LibMCEnv_DataTableCSVWriteOptions;
 typedef LibMCEnvHandle LibMCEnv_DataTableScatterPlotOptions;
+typedef LibMCEnvHandle LibMCEnv_DataTableFilter;
+typedef LibMCEnvHandle LibMCEnv_DataTableSortOptions;
+typedef LibMCEnvHandle LibMCEnv_DataTableAggregationOptions;
+typedef LibMCEnvHandle LibMCEnv_DataTableLoadOptions;
 typedef LibMCEnvHandle LibMCEnv_DataTable;
 typedef LibMCEnvHandle LibMCEnv_DataSeries;
 typedef LibMCEnvHandle LibMCEnv_DateTimeDifference;
@@ -655,6 +717,20 @@ namespace LibMCEnv {
     RGBA32bit = 7
   };
   
+  enum class ePNGFilterStrategy : LibMCEnv_int32 {
+    Unknown = 0,
+    NoFilter = 1, /** All scanlines are stored unfiltered. */
+    Sub = 2, /** All scanlines use the Sub filter. */
+    Up = 3, /** All scanlines use the Up filter. */
+    Adaptive = 4 /** Each scanline uses the filter with the minimum sum of absolute differences. */
+  };
+  
+  enum class ePNGEncoderBackend : LibMCEnv_int32 {
+    Unknown = 0,
+    LodePNG = 1, /** Reference encoder. Single threaded and slow for large images. */
+    ZLib = 2 /** Encodes the scanlines with zlib. Large images are compressed in row stripes on multiple threads. */
+  };
+  
   enum class eFieldSamplingMode : LibMCEnv_int32 {
     Unknown = 0, /** Field sampling mode is invalid. */
     FloorCoordinate = 1, /** Point Coordinates are rounded down to the nearest pixel and the point value is fully attached to this pixel. Points on a border will be attached to the pixel which is nearer to the origin. */
@@ -663,6 +739,18 @@ namespace LibMCEnv {
     WeightByEllipseArea = 4 /** Point values are valued by a ellipse shape area that its overlap with each pixel (with the center as the given coordinate). */
   };
   
+  enum class eFieldStoragePrecision : LibMCEnv_int32 {
+    Unknown = 0,
+    Float64 = 1, /** Field values are stored as double precision values. */
+    Float32 = 2 /** Field values are stored as single precision values. Halves the memory usage, all operations are still computed in double precision. */
+  };
+  
+  enum class eFieldStorageLayout : LibMCEnv_int32 {
+    Unknown = 0,
+    Dense = 1, /** Field values are stored in a single buffer that covers the whole field. */
+    Tiled = 2 /** Field values are stored in tiles of 256x256 pixels, which are only allocated when they are written to. Untouched tiles have a common background value. */
+  };
+  
   enum class eToolpathSegmentType : LibMCEnv_int32 {
     Unknown = 0,
     Hatch = 1,
@@ -724,6 +812,53 @@ namespace LibMCEnv {
     Uint64Column = 5
   };
   
+  enum class eDataTableColumnEncoding : LibMCEnv_int32 {
+    Unknown = 0,
+    Raw = 1, /** Values are stored as they are in memory. */
+    Delta = 2, /** Stores the difference to the previous value as variable length integer. Suited for monotonic columns, like timestamps or counters. Double columns fall back to XOR if they contain non-integer values. */
+    DeltaOfDelta = 3, /** Stores the change of the difference to the previous value as variable length integer. Suited for columns with a nearly constant step. Double columns fall back to XOR if they contain non-integer values. */
+    RunLength = 4, /** Stores runs of equal values as count and value. Suited for constant or rarely changing columns. */
+    XOR = 5, /** Stores the XOR of each value with its predecessor with leading and trailing zero bits stripped (Gorilla encoding). Suited for slowly changing double values. */
+    Automatic = 6 /** Encodes the column with every applicable encoding and stores the smallest result. */
+  };
+  
+  enum class eDataTableCompression : LibMCEnv_int32 {
+    Unknown = 0,
+    NoCompression = 1, /** Encoded column data is stored as it is. */
+    ZLib = 2, /** Encoded column data is deflated with zlib. Columns that do not get smaller are stored uncompressed. */
+    LZ4 = 3 /** Encoded column data is compressed with LZ4. Columns that do not get smaller are stored uncompressed. */
+  };
+  
+  enum class eDataTableFilterOperator : LibMCEnv_int32 {
+    Unknown = 0,
+    Equal = 1, /** Value is equal to the threshold. */
+    NotEqual = 2, /** Value is not equal to the threshold. */
+    Less = 3, /** Value is less than the threshold. */
+    LessOrEqual = 4, /** Value is less than or equal to the threshold. */
+    Greater = 5, /** Value is greater than the threshold. */
+    GreaterOrEqual = 6, /** Value is greater than or equal to the threshold. */
+    InRange = 7, /** Value is between the lower and upper bound, both inclusive. */
+    OutsideRange = 8 /** Value is less than the lower or greater than the upper bound. */
+  };
+  
+  enum class eDataTableAggregation : LibMCEnv_int32 {
+    Unknown = 0,
+    Count = 1, /** Number of rows of the group. */
+    Sum = 2, /** Sum of the values of the group. */
+    Minimum = 3, /** Minimum of the values of the group. */
+    Maximum = 4, /** Maximum of the values of the group. */
+    Mean = 5 /** Arithmetic mean of the values of the group. */
+  };
+  
+  enum class eDataTableWindowStatistic : LibMCEnv_int32 {
+    Unknown = 0,
+    Sum = 1, /** Sum of the values in the window. */
+    Mean = 2, /** Arithmetic mean of the values in the window. */
+    Minimum = 3, /** Minimum of the values in the window. */
+    Maximum = 4, /** Maximum of the values in the window. */
+    StandardDeviation = 5 /** Sample standard deviation of the values in the window. 0 for windows of a single row. */
+  };
+  
   /*************************************************************************************************************************
    Declaration of structs
   **************************************************************************************************************************/
@@ -777,6 +912,12 @@ namespace LibMCEnv {
       LibMCEnv_double m_Point2Override;
   } sHatch2DOverrides;
   
+  typedef struct sToolpathProfileValueColumn {
+      LibMCEnv_uint32 m_ValueType;
+      LibMCEnv_uint32 m_ValueID;
+      LibMCEnv_double m_DefaultValue;
+  } sToolpathProfileValueColumn;
+  
   typedef struct sModelDataTransform {
       LibMCEnv_double m_Matrix[3][3];
       LibMCEnv_double m_Translation[3];
@@ -803,7 +944,11 @@ typedef LibMCEnv::eLogLevel eLibMCEnvLogLevel;
 typedef LibMCEnv::eJSONObjectType eLibMCEnvJSONObjectType;
 typedef LibMCEnv::eImagePixelFormat eLibMCEnvImagePixelFormat;
 typedef LibMCEnv::ePNGStorageFormat eLibMCEnvPNGStorageFormat;
+typedef LibMCEnv::ePNGFilterStrategy eLibMCEnvPNGFilterStrategy;
+typedef LibMCEnv::ePNGEncoderBackend eLibMCEnvPNGEncoderBackend;
 typedef LibMCEnv::eFieldSamplingMode eLibMCEnvFieldSamplingMode;
+typedef LibMCEnv::eFieldStoragePrecision eLibMCEnvFieldStoragePrecision;
+typedef LibMCEnv::eFieldStorageLayout eLibMCEnvFieldStorageLayout;
 typedef LibMCEnv::eToolpathSegmentType eLibMCEnvToolpathSegmentType;
 typedef LibMCEnv::eToolpathAttributeType eLibMCEnvToolpathAttributeType;
 typedef LibMCEnv::eToolpathProfileValueType eLibMCEnvToolpathProfileValueType;
@@ -811,6 +956,11 @@ typedef LibMCEnv::eToolpathProfileOverrideFactor eLibMCEnvToolpathProfileOverrid
 typedef LibMCEnv::eMessageDialogType eLibMCEnvMessageDialogType;
 typedef LibMCEnv::eBuildExecutionStatus eLibMCEnvBuildExecutionStatus;
 typedef LibMCEnv::eDataTableColumnType eLibMCEnvDataTableColumnType;
+typedef LibMCEnv::eDataTableColumnEncoding eLibMCEnvDataTableColumnEncoding;
+typedef LibMCEnv::eDataTableCompression eLibMCEnvDataTableCompression;
+typedef LibMCEnv::eDataTableFilterOperator eLibMCEnvDataTableFilterOperator;
+typedef LibMCEnv::eDataTableAggregation eLibMCEnvDataTableAggregation;
+typedef LibMCEnv::eDataTableWindowStatistic eLibMCEnvDataTableWindowStatistic;
 typedef LibMCEnv::sPosition2D sLibMCEnvPosition2D;
 typedef LibMCEnv::sHatch2D sLibMCEnvHatch2D;
 typedef LibMCEnv::sMeshVertex3D sLibMCEnvMeshVertex3D;
@@ -820,6 +970,7 @@ typedef LibMCEnv::sFieldData2DPoint sLibMCEnvFieldData2DPoint;
 typedef LibMCEnv::sFieldData3DPoint sLibMCEnvFieldData3DPoint;
 typedef LibMCEnv::sFloatHatch2D sLibMCEnvFloatHatch2D;
 typedef LibMCEnv::sHatch2DOverrides sLibMCEnvHatch2DOverrides;
+typedef LibMCEnv::sToolpathProfileValueColumn sLibMCEnvToolpathProfileValueColumn;
 typedef LibMCEnv::sModelDataTransform sLibMCEnvModelDataTransform;
 typedef LibMCEnv::sColorRGB sLibMCEnvColorRGB;
 typedef LibMCEnv::sTimeStreamEntry sLibMCEnvTimeStreamEntry;
@@ -167,6 +167,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AMC_API_KEY_UI_VIEWMINY "viewminy"
 #define AMC_API_KEY_UI_VIEWMAXX "viewmaxx"
 #define AMC_API_KEY_UI_VIEWMAXY "viewmaxy"
+#define AMC_API_KEY_UI_RESOLUTIONX "resolutionx"
+#define AMC_API_KEY_UI_RESOLUTIONY "resolutiony"
 #define AMC_API_KEY_UI_SHOWGRID "showgrid"
 #define AMC_API_KEY_UI_ORIGINX "originx"
 #define AMC_API_KEY_UI_ORIGINY "originy"
@@ -334,6 +336,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AMC_API_KEY_PROFILENAME "profilename"
 #define AMC_API_KEY_LASERINDEX "laserindex"
 #define AMC_API_KEY_COLOR "color"
+#define AMC_API_KEY_VIEWMINX "viewminx"
+#define AMC_API_KEY_VIEWMINY "viewminy"
+#define AMC_API_KEY_VIEWMAXX "viewmaxx"
+#define AMC_API_KEY_VIEWMAXY "viewmaxy"
+#define AMC_API_KEY_RESOLUTION "resolution"
+
+#define AMC_API_TOOLPATHBINARY_MAXVIEWCOORDINATE 1000000.0
+#define AMC_API_POINTCLOUD_MAXVIEWCOORDINATE 1.0E12
 
 #define AMC_API_KEY_STATUSINSTANCE_NAME "name"
 #define AMC_API_KEY_STATUSINSTANCE_STATE "state"
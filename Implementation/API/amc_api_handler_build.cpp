@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "libmcdata_dynamic.hpp"
 
 #include "amc_toolpathhandler.hpp"
+#include "amc_toolpathlayerbinaryencoder.hpp"
 
 #include "common_utils.hpp"
 
@@ -42,9 +43,28 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 #include <string>
 #include <iostream>
+#include <cmath>
 
 using namespace AMC;
 
+
+/*************************************************************************************************************************
+ Binary toolpath layer response. See amc_toolpathlayerbinaryencoder.hpp for the format.
+**************************************************************************************************************************/
+class CAPIToolpathBinaryResponse : public CAPIFixedBufferResponse {
+public:
+
+	CAPIToolpathBinaryResponse(CToolpathLayerTileTree* pTileTree, uint32_t nLayerIndex, int32_t nViewMinX, int32_t nViewMinY, int32_t nViewMaxX, int32_t nViewMaxY, int32_t nResolutionInUnits, bool bTreeWasBuilt)
+		: CAPIFixedBufferResponse("application/binary")
+	{
+		if (pTileTree == nullptr)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+		CToolpathLayerBinaryEncoder::encodeLayer(pTileTree, nLayerIndex, nViewMinX, nViewMinY, nViewMaxX, nViewMaxY, nResolutionInUnits, bTreeWasBuilt, getBuffer());
+	}
+
+};
+
 CAPIHandler_Build::CAPIHandler_Build(PSystemState pSystemState)
 	: CAPIHandler(pSystemState->getClientHash ()), m_pSystemState(pSystemState)
 {
@@ -75,6 +95,10 @@ APIHandler_BuildType CAPIHandler_Build::parseRequest(const std::string& sURI, co
 			return APIHandler_BuildType::btToolpath;
 		}
 
+		if ((sParameterString == "/toolpathbinary") || (sParameterString == "/toolpathbinary/")) {
+			return APIHandler_BuildType::btToolpathBinary;
+		}
+
 	}
 
 	if (requestType == eAPIRequestType::rtGet) {
@@ -111,6 +135,7 @@ bool CAPIHandler_Build::expectsRawBody(const std::string& sURI, const eAPIReques
 
 	switch (parseRequest(sURI, requestType, jobUUID)) {
 		case APIHandler_BuildType::btToolpath:
+		case APIHandler_BuildType::btToolpathBinary:
 			return true;
 
 		default:
@@ -239,6 +264,61 @@ void CAPIHandler_Build::handleToolpathRequest(CJSONWriter& writer, const uint8_t
 }
 
 
+PAPIResponse CAPIHandler_Build::handleToolpathBinaryRequest(const uint8_t* pBodyData, const size_t nBodyDataSize, PAPIAuth pAuth)
+{
+	if (pBodyData == nullptr)
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+	if (pAuth.get() == nullptr)
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+	CAPIJSONRequest jsonRequest(pBodyData, nBodyDataSize);
+	auto sBuildUUID = jsonRequest.getUUID(AMC_API_KEY_BUILDUUID, LIBMC_ERROR_INVALIDBUILDUUID);
+
+	auto pDataModel = m_pSystemState->getDataModelInstance();
+	auto pBuildJobHandler = pDataModel->CreateBuildJobHandler();
+	auto pBuildJob = pBuildJobHandler->RetrieveJob(sBuildUUID);
+	auto sStreamUUID = pBuildJob->GetStorageStreamUUID();
+
+	auto pToolpathHandler = m_pSystemState->toolpathHandler();
+
+	auto pToolpath = pToolpathHandler->findToolpathEntity(sStreamUUID, false);
+	if (pToolpath == nullptr) {
+		pToolpath = pToolpathHandler->loadToolpathEntity(sStreamUUID);
+	}
+
+	auto nLayerCount = pToolpath->getLayerCount();
+	if (nLayerCount == 0)
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDLAYERINDEX);
+
+	auto nLayerIndex = (uint32_t)jsonRequest.getUint64(AMC_API_KEY_LAYERINDEX, 0, (uint64_t)nLayerCount - 1, LIBMC_ERROR_INVALIDLAYERINDEX);
+
+	bool bTreeWasBuilt = false;
+	auto pTileTree = pToolpathHandler->retrieveLayerTileTree(pToolpath, sStreamUUID, nLayerIndex, bTreeWasBuilt);
+
+	double dUnits = pTileTree->getUnits();
+	if (dUnits <= 0.0)
+		throw ELibMCInterfaceException(LIBMC_ERROR_UNITSAREOUTOFRANGE);
+
+	int32_t nViewMinX, nViewMinY, nViewMaxX, nViewMaxY;
+	pTileTree->getExtents(nViewMinX, nViewMinY, nViewMaxX, nViewMaxY);
+
+	// Viewport and resolution are given in mm
+	if (jsonRequest.hasValue(AMC_API_KEY_VIEWMINX) || jsonRequest.hasValue(AMC_API_KEY_VIEWMINY) || jsonRequest.hasValue(AMC_API_KEY_VIEWMAXX) || jsonRequest.hasValue(AMC_API_KEY_VIEWMAXY)) {
+		double dMaxCoordinate = AMC_API_TOOLPATHBINARY_MAXVIEWCOORDINATE;
+		nViewMinX = (int32_t)floor(jsonRequest.getDouble(AMC_API_KEY_VIEWMINX, -dMaxCoordinate, dMaxCoordinate, LIBMC_ERROR_INVALIDTOOLPATHVIEWPORT) / dUnits);
+		nViewMinY = (int32_t)floor(jsonRequest.getDouble(AMC_API_KEY_VIEWMINY, -dMaxCoordinate, dMaxCoordinate, LIBMC_ERROR_INVALIDTOOLPATHVIEWPORT) / dUnits);
+		nViewMaxX = (int32_t)ceil(jsonRequest.getDouble(AMC_API_KEY_VIEWMAXX, -dMaxCoordinate, dMaxCoordinate, LIBMC_ERROR_INVALIDTOOLPATHVIEWPORT) / dUnits);
+		nViewMaxY = (int32_t)ceil(jsonRequest.getDouble(AMC_API_KEY_VIEWMAXY, -dMaxCoordinate, dMaxCoordinate, LIBMC_ERROR_INVALIDTOOLPATHVIEWPORT) / dUnits);
+	}
+
+	int32_t nResolutionInUnits = 0;
+	if (jsonRequest.hasValue(AMC_API_KEY_RESOLUTION))
+		nResolutionInUnits = (int32_t)(jsonRequest.getDouble(AMC_API_KEY_RESOLUTION, 0.0, AMC_TOOLPATHBINARY_MAXRESOLUTION, LIBMC_ERROR_INVALIDTOOLPATHRESOLUTION) / dUnits);
+
+	return std::make_shared<CAPIToolpathBinaryResponse>(pTileTree.get(), nLayerIndex, nViewMinX, nViewMinY, nViewMaxX, nViewMaxY, nResolutionInUnits, bTreeWasBuilt);
+}
+
+
 void CAPIHandler_Build::handleListJobsRequest(CJSONWriter& writer, PAPIAuth pAuth)
 {	
 	if (pAuth.get() == nullptr)
@@ -433,6 +513,9 @@ PAPIResponse CAPIHandler_Build::handleRequest(const std::string& sURI, const eAP
 		handleToolpathRequest(writer, pBodyData, nBodyDataSize, pAuth);
 		break;
 
+	case APIHandler_BuildType::btToolpathBinary:
+		return handleToolpathBinaryRequest(pBodyData, nBodyDataSize, pAuth);
+
 	case APIHandler_BuildType::btListBuildData:
 		handleListBuildDataRequest(writer, pAuth, paramUUID);
 		break;
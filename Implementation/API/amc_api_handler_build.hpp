@@ -47,7 +47,8 @@ namespace AMC {
 		btToolpath = 3,
 		btListBuildData = 4,
 		btGetBuildData = 5,
-		btBuildJobDetails = 6
+		btBuildJobDetails = 6,
+		btToolpathBinary = 7
 
 	};
 
@@ -59,6 +60,7 @@ namespace AMC {
 		APIHandler_BuildType parseRequest(const std::string& sURI, const eAPIRequestType requestType, std::string& paramUUID);
 
 		void handleToolpathRequest(CJSONWriter& writer, const uint8_t* pBodyData, const size_t nBodyDataSize, PAPIAuth pAuth);
+		PAPIResponse handleToolpathBinaryRequest(const uint8_t* pBodyData, const size_t nBodyDataSize, PAPIAuth pAuth);
 
 		void handleListJobsRequest(CJSONWriter& writer, PAPIAuth pAuth);
 		void handleListBuildDataRequest(CJSONWriter& writer, PAPIAuth pAuth, std::string& buildUUID);
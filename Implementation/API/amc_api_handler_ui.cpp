@@ -143,7 +143,7 @@ public:
 			size_t nPointCount = pScatterplot->getEntryCount ();
 			resizeTo(nPointCount * 2); 
 
-			auto& entries = pScatterplot->getEntries();
+			auto& entries = pScatterplot->readEntries();
 
 			for (size_t nPointIndex = 0; nPointIndex < nPointCount; nPointIndex++) {
 
@@ -163,6 +163,29 @@ public:
 
 
 
+class CAPIRenderPointCloudViewResponse : public CAPIFixedFloatBufferResponse {
+private:
+
+public:
+
+	CAPIRenderPointCloudViewResponse(const std::vector<AMC::sScatterplotDensityEntry> & densityEntries)
+		: CAPIFixedFloatBufferResponse("application/binary")
+	{
+		size_t nEntryCount = densityEntries.size();
+		resizeTo(nEntryCount * 3);
+
+		for (auto& entry : densityEntries) {
+			addFloat(entry.m_fX);
+			addFloat(entry.m_fY);
+			addFloat(entry.m_fCount);
+		}
+
+	}
+
+};
+
+
+
 CAPIHandler_UI::CAPIHandler_UI(PSystemState pSystemState)
 	: CAPIHandler(pSystemState->getClientHash()), m_pSystemState(pSystemState)
 {
@@ -264,6 +287,13 @@ APIHandler_UIType CAPIHandler_UI::parseRequest(const std::string& sURI, const eA
 			return APIHandler_UIType::utEvent;
 		}
 
+		if (sParameterString.length() == 48) {
+			if (sParameterString.substr(0, 12) == "/pointcloud/") {
+				sParameterUUID = AMCCommon::CUtils::normalizeUUIDString(sParameterString.substr(12));
+				return APIHandler_UIType::utPointCloudView;
+			}
+		}
+
 		if (sParameterString.length() >= 44) {
 			if (sParameterString.substr(0, 8) == "/widget/") {
 				sParameterUUID = AMCCommon::CUtils::normalizeUUIDString(sParameterString.substr(8, 36));
@@ -317,7 +347,7 @@ bool CAPIHandler_UI::expectsRawBody(const std::string& sURI, const eAPIRequestTy
 	std::string sAdditionalParameter;
 	auto uiType = parseRequest(sURI, requestType, sParameterUUID, sAdditionalParameter);
 
-	return (uiType == APIHandler_UIType::utEvent) || (uiType == APIHandler_UIType::utWidgetRequest);
+	return (uiType == APIHandler_UIType::utEvent) || (uiType == APIHandler_UIType::utWidgetRequest) || (uiType == APIHandler_UIType::utPointCloudView);
 
 }
 
@@ -405,6 +435,46 @@ PAPIResponse CAPIHandler_UI::handleDownloadRequest(const std::string& sParameter
 }
 
 
+PAPIResponse CAPIHandler_UI::handlePointCloudViewRequest(const std::string& sParameterUUID, const uint8_t* pBodyData, const size_t nBodyDataSize, PAPIAuth pAuth)
+{
+	if (pBodyData == nullptr)
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+	if (pAuth.get() == nullptr)
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+	auto pToolpathHandler = m_pSystemState->getToolpathHandlerInstance();
+	auto pScatterplot = pToolpathHandler->restoreScatterplot(sParameterUUID, true);
+
+	CAPIJSONRequest jsonRequest(pBodyData, nBodyDataSize);
+
+	// Viewport defaults to the full extent of the scatterplot
+	double dMinX, dMinY, dMaxX, dMaxY;
+	pScatterplot->getBoundaries(dMinX, dMinY, dMaxX, dMaxY);
+
+	if (jsonRequest.hasValue(AMC_API_KEY_UI_VIEWMINX) || jsonRequest.hasValue(AMC_API_KEY_UI_VIEWMINY) || jsonRequest.hasValue(AMC_API_KEY_UI_VIEWMAXX) || jsonRequest.hasValue(AMC_API_KEY_UI_VIEWMAXY)) {
+		double dMaxCoordinate = AMC_API_POINTCLOUD_MAXVIEWCOORDINATE;
+		dMinX = jsonRequest.getDouble(AMC_API_KEY_UI_VIEWMINX, -dMaxCoordinate, dMaxCoordinate, LIBMC_ERROR_INVALIDSCATTERPLOTVIEWPORT);
+		dMinY = jsonRequest.getDouble(AMC_API_KEY_UI_VIEWMINY, -dMaxCoordinate, dMaxCoordinate, LIBMC_ERROR_INVALIDSCATTERPLOTVIEWPORT);
+		dMaxX = jsonRequest.getDouble(AMC_API_KEY_UI_VIEWMAXX, -dMaxCoordinate, dMaxCoordinate, LIBMC_ERROR_INVALIDSCATTERPLOTVIEWPORT);
+		dMaxY = jsonRequest.getDouble(AMC_API_KEY_UI_VIEWMAXY, -dMaxCoordinate, dMaxCoordinate, LIBMC_ERROR_INVALIDSCATTERPLOTVIEWPORT);
+	}
+
+	// A degenerate scatterplot (e.g. a single point) still needs a valid viewport
+	if (!(dMinX < dMaxX))
+		dMaxX = dMinX + 1.0;
+	if (!(dMinY < dMaxY))
+		dMaxY = dMinY + 1.0;
+
+	uint32_t nResolutionX = (uint32_t)jsonRequest.getUint64(AMC_API_KEY_UI_RESOLUTIONX, 1, AMC_SCATTERPLOT_MAXQUERYRESOLUTION, LIBMC_ERROR_INVALIDSCATTERPLOTRESOLUTION);
+	uint32_t nResolutionY = (uint32_t)jsonRequest.getUint64(AMC_API_KEY_UI_RESOLUTIONY, 1, AMC_SCATTERPLOT_MAXQUERYRESOLUTION, LIBMC_ERROR_INVALIDSCATTERPLOTRESOLUTION);
+
+	std::vector<sScatterplotDensityEntry> densityEntries;
+	pScatterplot->queryDensity(dMinX, dMinY, dMaxX, dMaxY, nResolutionX, nResolutionY, densityEntries);
+
+	return std::make_shared<CAPIRenderPointCloudViewResponse>(densityEntries);
+}
+
+
 PAPIResponse CAPIHandler_UI::handleChartRequest(const std::string& sParameterUUID, PAPIAuth pAuth)
 {
 	if (pAuth.get() == nullptr)
@@ -576,6 +646,9 @@ PAPIResponse CAPIHandler_UI::handleRequest(const std::string& sURI, const eAPIRe
 		return std::make_shared<CAPIRenderPointCloudResponse>(pScatterplot.get ());
 	}
 
+	case APIHandler_UIType::utPointCloudView:
+		return handlePointCloudViewRequest(sParameterUUID, pBodyData, nBodyDataSize, pAuth);
+
 	case APIHandler_UIType::utChart:
 		return handleChartRequest(sParameterUUID, pAuth);
 
@@ -52,7 +52,8 @@ namespace AMC {
 		utMeshEdges = 8,
 		utDownload = 9,
 		utPointCloud = 10,
-		utWidgetRequest = 11
+		utWidgetRequest = 11,
+		utPointCloudView = 12
 	};
 
 	class CAPIHandler_UI : public CAPIHandler {
@@ -68,6 +69,7 @@ namespace AMC {
 		PAPIResponse handleImageRequest(const std::string & sParameterUUID, PAPIAuth pAuth);
 		PAPIResponse handleChartRequest(const std::string& sParameterUUID, PAPIAuth pAuth);
 		PAPIResponse handleDownloadRequest(const std::string& sParameterUUID, PAPIAuth pAuth);
+		PAPIResponse handlePointCloudViewRequest(const std::string& sParameterUUID, const uint8_t* pBodyData, const size_t nBodyDataSize, PAPIAuth pAuth);
 
 		void handleEventRequest(CJSONWriter& writer, const uint8_t* pBodyData, const size_t nBodyDataSize, PAPIAuth pAuth);
 		void handleWidgetRequest(CJSONWriter& writer, const std::string & sWidgetUUID, const std::string& sRequestType, const uint8_t* pBodyData, const size_t nBodyDataSize, PAPIAuth pAuth);
@@ -139,6 +139,21 @@ uint64_t CAPIJSONRequest::getUint64(const std::string& sKeyName, const uint64_t
 	return nValue;
 }
 
+double CAPIJSONRequest::getDouble(const std::string& sKeyName, const double dMinValue, const double dMaxValue, uint32_t nErrorCode) const
+{
+	if (!hasValue(sKeyName))
+		throw ELibMCInterfaceException(nErrorCode);
+	if (!m_pImpl->m_Document[sKeyName.c_str()].IsNumber())
+		throw ELibMCInterfaceException(nErrorCode);
+
+	double dValue = m_pImpl->m_Document[sKeyName.c_str()].GetDouble();
+
+	if ((dValue < dMinValue) || (dValue > dMaxValue))
+		throw ELibMCInterfaceException(nErrorCode);
+
+	return dValue;
+}
+
 std::string CAPIJSONRequest::getSHA256(const std::string& sKeyName, uint32_t nErrorCode) const
 {
 	auto sNameString = getNameString(sKeyName, nErrorCode);
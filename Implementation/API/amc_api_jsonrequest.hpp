@@ -62,6 +62,7 @@ namespace AMC {
 		std::string getJSONObjectString (const std::string& sKeyName, uint32_t nErrorCode) const;
 		std::string getNameString(const std::string& sKeyName, uint32_t nErrorCode) const;
 		uint64_t getUint64 (const std::string& sKeyName, const uint64_t nMinValue, const uint64_t nMaxValue, uint32_t nErrorCode) const;
+		double getDouble (const std::string& sKeyName, const double dMinValue, const double dMaxValue, uint32_t nErrorCode) const;
 		std::string getSHA256(const std::string& sKeyName, uint32_t nErrorCode) const;
 	};
 
@@ -0,0 +1,107 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "common_parallelblocks.hpp"
+
+#include <thread>
+#include <vector>
+#include <exception>
+#include <algorithm>
+
+namespace AMCCommon {
+
+	uint32_t CParallelBlocks::getBlockCount(uint32_t nThreadCount, size_t nItemCount, size_t nMinItemsPerBlock)
+	{
+		if (nThreadCount == 0)
+			nThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+		nThreadCount = std::min(nThreadCount, (uint32_t)PARALLELBLOCKS_MAXTHREADCOUNT);
+
+		if (nMinItemsPerBlock < 1)
+			nMinItemsPerBlock = 1;
+
+		size_t nMaxBlockCount = std::max(nItemCount / nMinItemsPerBlock, (size_t)1);
+		return (uint32_t)std::min((size_t)nThreadCount, nMaxBlockCount);
+	}
+
+	void CParallelBlocks::processBlocks(uint32_t nThreadCount, size_t nItemCount, size_t nMinItemsPerBlock, const std::function<void(uint32_t nBlockIndex, size_t nFirstItem, size_t nItemCount)>& blockFunction)
+	{
+		if (nItemCount == 0)
+			return;
+
+		uint32_t nBlockCount = getBlockCount(nThreadCount, nItemCount, nMinItemsPerBlock);
+		if (nBlockCount <= 1) {
+			blockFunction(0, 0, nItemCount);
+			return;
+		}
+
+		size_t nItemsPerBlock = (nItemCount + nBlockCount - 1) / nBlockCount;
+
+		std::vector<std::thread> workerThreads;
+		workerThreads.reserve(nBlockCount);
+
+		std::vector<std::exception_ptr> workerExceptions(nBlockCount);
+
+		try {
+			uint32_t nBlockIndex = 1;
+			for (size_t nFirstItem = nItemsPerBlock; nFirstItem < nItemCount; nFirstItem += nItemsPerBlock) {
+				size_t nBlockItemCount = std::min(nItemsPerBlock, nItemCount - nFirstItem);
+				std::exception_ptr* pWorkerException = &workerExceptions.at(nBlockIndex);
+
+				workerThreads.push_back(std::thread([&blockFunction, pWorkerException, nBlockIndex, nFirstItem, nBlockItemCount]() {
+					try {
+						blockFunction(nBlockIndex, nFirstItem, nBlockItemCount);
+					}
+					catch (...) {
+						*pWorkerException = std::current_exception();
+					}
+				}));
+
+				nBlockIndex++;
+			}
+
+			blockFunction(0, 0, nItemsPerBlock);
+		}
+		catch (...) {
+			for (auto& workerThread : workerThreads)
+				workerThread.join();
+			throw;
+		}
+
+		for (auto& workerThread : workerThreads)
+			workerThread.join();
+
+		for (auto& workerException : workerExceptions) {
+			if (workerException)
+				std::rethrow_exception(workerException);
+		}
+	}
+
+}
@@ -0,0 +1,58 @@
+/*++
+
+Copyright (C) 2020 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMC_PARALLELBLOCKS
+#define __AMC_PARALLELBLOCKS
+
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+#define PARALLELBLOCKS_MAXTHREADCOUNT 64
+
+namespace AMCCommon {
+
+	class CParallelBlocks {
+	public:
+
+		// Returns the number of blocks processBlocks uses. A thread count of 0 selects the hardware concurrency.
+		// Every block gets at least nMinItemsPerBlock items, but there is always at least one block.
+		static uint32_t getBlockCount(uint32_t nThreadCount, size_t nItemCount, size_t nMinItemsPerBlock);
+
+		// Splits nItemCount items into contiguous blocks and calls blockFunction once per block. The calling thread
+		// handles the first block itself. The first exception of any block is rethrown after all workers have been joined.
+		static void processBlocks(uint32_t nThreadCount, size_t nItemCount, size_t nMinItemsPerBlock, const std::function<void(uint32_t nBlockIndex, size_t nFirstItem, size_t nItemCount)>& blockFunction);
+
+	};
+
+}
+
+#endif // __AMC_PARALLELBLOCKS
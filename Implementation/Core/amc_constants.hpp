@@ -51,7 +51,25 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define DATATABLE_MINCSVSEPARATOR 32
 #define DATATABLE_MAXCSVSEPARATOR 127
 
+#define DATATABLE_STREAMVERSION 1
+
 #define DATATABLE_ENCODINGTYPE_RAW 1
+#define DATATABLE_ENCODINGTYPE_DELTA 2
+#define DATATABLE_ENCODINGTYPE_DELTAOFDELTA 3
+#define DATATABLE_ENCODINGTYPE_RUNLENGTH 4
+#define DATATABLE_ENCODINGTYPE_XOR 5
+
+#define DATATABLE_COMPRESSIONTYPE_NONE 0
+#define DATATABLE_COMPRESSIONTYPE_ZLIB 1
+#define DATATABLE_COMPRESSIONTYPE_LZ4 2
+// LZ4 levels below this use the fast compressor, higher levels LZ4 HC
+#define DATATABLE_MINLZ4HCCOMPRESSIONLEVEL 3
+#define DATATABLE_DEFAULTCOMPRESSIONLEVEL 6
+#define DATATABLE_MAXCOMPRESSIONLEVEL 9
+
+#define DATATABLE_MAXTHREADCOUNT 64
+#define DATATABLE_MINROWSPERTHREAD (64 * 1024)
+#define DATATABLE_WINDOWBLOCKSIZE (64 * 1024)
 
 #define MICROSECONDS_PER_MILLISECOND 1000ULL
 #define MICROSECONDS_PER_SECOND (1000ULL * 1000ULL)
@@ -34,23 +34,31 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "libmcenv_interfaceexception.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstring>
+#include <limits>
 
 using namespace AMC;
 
 #define DISCRETEFIELD_MAXPIXELCOUNT (1024ULL * 1024ULL * 32ULL)
-#define DISCRETEFIELD_MINVALUEDISTANCE 1E-6
 #define DISCRETEFIELD_MAXPOINTVALUESCOUNT (1024ULL * 1024ULL * 1024ULL)
 
 #define DISCRETEFIELD_MAXORIGINCOORDINATE 1.0e9
 
+#define DISCRETEFIELD_TILESIZE 256
+#define DISCRETEFIELD_MAXTILECOUNT (1024ULL * 1024ULL * 16ULL)
+
 #define DISCRETEFIELD2D_STREAMFILESIGN 0x17AE971A
 #define DISCRETEFIELD2D_STREAMFILEMAJORVERSION 1
-#define DISCRETEFIELD2D_STREAMFILEMINORVERSION 0
+#define DISCRETEFIELD2D_STREAMFILEMINORVERSION 1
 #define DISCRETEFIELD2D_STREAMFILEPATCHVERSION 0
 
+// Raw data streams are still written with minor version 0, so that older readers can load them.
+#define DISCRETEFIELD2D_STREAMFILEMINORVERSION_RAWDATA 0
+
 #define DISCRETEFIELD2D_STREAMSTORAGETYPE_RAWDATA 1
+#define DISCRETEFIELD2D_STREAMSTORAGETYPE_TILEDDATA 2
 
 #pragma pack(push)
 #pragma pack(1)
@@ -69,9 +77,570 @@ typedef struct _sDiscreteField2DStreamHeader {
 	uint64_t m_nDataOffset;
 	uint32_t m_nReserved[32];
 } sDiscreteField2DStreamHeader;
+
+// Tiled data starts with this header, followed by the indices of all stored tiles and
+// their values as doubles. Tiles that are not stored have the background value.
+typedef struct _sDiscreteField2DStreamTileHeader {
+	uint32_t m_nTileSizeX;
+	uint32_t m_nTileSizeY;
+	uint32_t m_nStoredTileCount;
+	uint32_t m_nReserved;
+	double m_dBackgroundValue;
+} sDiscreteField2DStreamTileHeader;
 #pragma pack(pop)
 
 
+template <typename TTarget, typename TSource> static void copyValues(TTarget* pTarget, const TSource* pSource, size_t nCount)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++)
+		pTarget[nIndex] = (TTarget)pSource[nIndex];
+}
+
+// Compares the stored bits, so that NaN and signed zero values are not mixed up with the background value.
+template <typename TValue> static bool isSameValue(TValue value1, TValue value2)
+{
+	return memcmp(&value1, &value2, sizeof(TValue)) == 0;
+}
+
+template <typename TValue> static bool hasOnlyValue(const TValue* pData, size_t nCount, TValue value)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++)
+		if (!isSameValue(pData[nIndex], value))
+			return false;
+
+	return true;
+}
+
+template <typename TValue> static void loadGreyValues(const uint8_t* pSource, TValue* pTarget, size_t nCount, size_t nBytesPerPixel, double dBlackValue, double dWhiteValue)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		double dGreyScale;
+		if (nBytesPerPixel == 1) {
+			dGreyScale = (*pSource) / 255.0;
+		}
+		else {
+			// Alpha is skipped
+			int64_t nRed = pSource[0];
+			int64_t nGreen = pSource[1];
+			int64_t nBlue = pSource[2];
+			dGreyScale = (nRed + nGreen + nBlue) / (255.0 * 3);
+		}
+		pSource += nBytesPerPixel;
+
+		double dValue = (1.0 - dGreyScale) * dBlackValue + dGreyScale * dWhiteValue;
+		pTarget[nIndex] = (TValue)dValue;
+	}
+}
+
+
+namespace AMC {
+
+	template <> std::vector<std::unique_ptr<std::vector<double>>>& CDiscreteFieldData2DInstance::getTiles<double>()
+	{
+		return m_Tiles;
+	}
+
+	template <> std::vector<std::unique_ptr<std::vector<float>>>& CDiscreteFieldData2DInstance::getTiles<float>()
+	{
+		return m_FloatTiles;
+	}
+
+}
+
+
+template <typename TValue> TValue* CDiscreteFieldData2DInstance::allocateTile(size_t nTileIndex, bool bFillWithBackground)
+{
+	auto& pTile = getTiles<TValue>().at(nTileIndex);
+	if (pTile.get() == nullptr) {
+		size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+		getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+
+		pTile = std::make_unique<std::vector<TValue>>(nTileSizeX * nTileSizeY);
+
+		// New tiles are zero initialised
+		if (bFillWithBackground && !isSameValue((TValue)m_dBackgroundValue, (TValue)0.0)) {
+			TValue* pData = pTile->data();
+			auto kernelType = getKernelType();
+			double dBackgroundValue = m_dBackgroundValue;
+			CDiscreteFieldKernels::processRows(m_nThreadCount, nTileSizeY, nTileSizeX * sizeof(TValue), [pData, kernelType, nTileSizeX, dBackgroundValue](size_t nFirstRow, size_t nRowCount) {
+				CDiscreteFieldKernels::fill(kernelType, pData + nFirstRow * nTileSizeX, nRowCount * nTileSizeX, dBackgroundValue);
+			});
+		}
+	}
+
+	return pTile->data();
+}
+
+template <typename TValue> const TValue* CDiscreteFieldData2DInstance::getRowSegment(size_t nX, size_t nY, size_t nCount, std::vector<TValue>& buffer)
+{
+	auto& tiles = getTiles<TValue>();
+
+	size_t nTileRowIndex = (nY / m_nTileSizeY) * m_nTileCountX;
+	size_t nLocalY = nY % m_nTileSizeY;
+
+	size_t nTileX = nX / m_nTileSizeX;
+	size_t nTileOriginX = nTileX * m_nTileSizeX;
+	size_t nTileSizeX = std::min(m_nTileSizeX, m_nPixelCountX - nTileOriginX);
+
+	auto& pFirstTile = tiles[nTileRowIndex + nTileX];
+	if ((pFirstTile.get() != nullptr) && (nX + nCount <= nTileOriginX + nTileSizeX))
+		return pFirstTile->data() + nLocalY * nTileSizeX + (nX - nTileOriginX);
+
+	buffer.resize(nCount);
+
+	size_t nCopiedCount = 0;
+	while (nCopiedCount < nCount) {
+		size_t nCurrentX = nX + nCopiedCount;
+		nTileX = nCurrentX / m_nTileSizeX;
+		nTileOriginX = nTileX * m_nTileSizeX;
+		nTileSizeX = std::min(m_nTileSizeX, m_nPixelCountX - nTileOriginX);
+
+		size_t nSegmentCount = std::min(nCount - nCopiedCount, nTileOriginX + nTileSizeX - nCurrentX);
+
+		auto& pTile = tiles[nTileRowIndex + nTileX];
+		if (pTile.get() != nullptr)
+			memcpy(buffer.data() + nCopiedCount, pTile->data() + nLocalY * nTileSizeX + (nCurrentX - nTileOriginX), nSegmentCount * sizeof(TValue));
+		else
+			std::fill(buffer.data() + nCopiedCount, buffer.data() + nCopiedCount + nSegmentCount, (TValue)m_dBackgroundValue);
+
+		nCopiedCount += nSegmentCount;
+	}
+
+	return buffer.data();
+}
+
+template <typename TValue> void CDiscreteFieldData2DInstance::writeValues(size_t nX, size_t nY, size_t nSizeX, size_t nSizeY, const double* pSource)
+{
+	auto& tiles = getTiles<TValue>();
+	TValue backgroundValue = (TValue)m_dBackgroundValue;
+
+	size_t nFirstTileX = nX / m_nTileSizeX;
+	size_t nFirstTileY = nY / m_nTileSizeY;
+	size_t nLastTileX = (nX + nSizeX - 1) / m_nTileSizeX;
+	size_t nLastTileY = (nY + nSizeY - 1) / m_nTileSizeY;
+
+	for (size_t nTileIndexY = nFirstTileY; nTileIndexY <= nLastTileY; nTileIndexY++) {
+		for (size_t nTileIndexX = nFirstTileX; nTileIndexX <= nLastTileX; nTileIndexX++) {
+			size_t nTileIndex = nTileIndexY * m_nTileCountX + nTileIndexX;
+
+			size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+			getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+
+			size_t nMinX = std::max(nX, nTileX);
+			size_t nMinY = std::max(nY, nTileY);
+			size_t nMaxX = std::min(nX + nSizeX, nTileX + nTileSizeX);
+			size_t nMaxY = std::min(nY + nSizeY, nTileY + nTileSizeY);
+
+			// Background values do not allocate new tiles
+			if (tiles[nTileIndex].get() == nullptr) {
+				bool bOnlyBackground = true;
+				for (size_t nCurrentY = nMinY; (nCurrentY < nMaxY) && bOnlyBackground; nCurrentY++) {
+					const double* pSourceRow = pSource + (nCurrentY - nY) * nSizeX;
+					for (size_t nCurrentX = nMinX; (nCurrentX < nMaxX) && bOnlyBackground; nCurrentX++)
+						bOnlyBackground = isSameValue((TValue)pSourceRow[nCurrentX - nX], backgroundValue);
+				}
+
+				if (bOnlyBackground)
+					continue;
+			}
+
+			bool bCoversTile = (nMinX == nTileX) && (nMinY == nTileY) && (nMaxX == nTileX + nTileSizeX) && (nMaxY == nTileY + nTileSizeY);
+			TValue* pTileData = allocateTile<TValue>(nTileIndex, !bCoversTile);
+
+			for (size_t nCurrentY = nMinY; nCurrentY < nMaxY; nCurrentY++)
+				copyValues(pTileData + (nCurrentY - nTileY) * nTileSizeX + (nMinX - nTileX), pSource + (nCurrentY - nY) * nSizeX + (nMinX - nX), nMaxX - nMinX);
+		}
+	}
+}
+
+template <typename TValue> void CDiscreteFieldData2DInstance::releaseUniformTiles()
+{
+	auto& tiles = getTiles<TValue>();
+	TValue backgroundValue = (TValue)m_dBackgroundValue;
+
+	// A single tile may be checked by several threads
+	size_t nTileCount = getTileCount();
+	std::unique_ptr<std::atomic<bool>[]> hasOtherValues(new std::atomic<bool>[nTileCount]);
+	for (size_t nTileIndex = 0; nTileIndex < nTileCount; nTileIndex++)
+		hasOtherValues[nTileIndex] = false;
+
+	processTiles(sizeof(TValue), true, [this, &tiles, &hasOtherValues, backgroundValue](size_t nTileIndex, size_t nFirstRow, size_t nRowCount) {
+		size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+		getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+
+		if (!hasOnlyValue(tiles[nTileIndex]->data() + nFirstRow * nTileSizeX, nRowCount * nTileSizeX, backgroundValue))
+			hasOtherValues[nTileIndex] = true;
+	});
+
+	for (size_t nTileIndex = 0; nTileIndex < nTileCount; nTileIndex++) {
+		if (!hasOtherValues[nTileIndex])
+			tiles[nTileIndex].reset();
+	}
+}
+
+template <typename TValue> void CDiscreteFieldData2DInstance::copyTilesFrom(CDiscreteFieldData2DInstance* pSourceField, double dDefaultValue)
+{
+	auto& tiles = getTiles<TValue>();
+	size_t nSourceCountX = pSourceField->m_nPixelCountX;
+	size_t nSourceCountY = pSourceField->m_nPixelCountY;
+
+	TValue defaultValue = (TValue)dDefaultValue;
+	bool bDefaultIsBackground = isSameValue(defaultValue, (TValue)m_dBackgroundValue);
+
+	for (size_t nTileIndex = 0; nTileIndex < getTileCount(); nTileIndex++) {
+		size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+		getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+
+		bool bHasSourceValues = (nTileX < nSourceCountX) && (nTileY < nSourceCountY) &&
+			!pSourceField->isRegionEmpty(nTileX, nTileY, std::min(nTileSizeX, nSourceCountX - nTileX), std::min(nTileSizeY, nSourceCountY - nTileY));
+		bool bHasDefaultValues = (!bDefaultIsBackground) && ((nTileX + nTileSizeX > nSourceCountX) || (nTileY + nTileSizeY > nSourceCountY));
+
+		if (bHasSourceValues || bHasDefaultValues)
+			allocateTile<TValue>(nTileIndex, false);
+	}
+
+	processTiles(sizeof(TValue) * 2, true, [this, &tiles, pSourceField, nSourceCountX, nSourceCountY, defaultValue](size_t nTileIndex, size_t nFirstRow, size_t nRowCount) {
+		size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+		getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+
+		size_t nCopyCountX = (nTileX < nSourceCountX) ? std::min(nTileSizeX, nSourceCountX - nTileX) : 0;
+
+		std::vector<TValue> rowBuffer;
+		for (size_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++) {
+			TValue* pTargetRow = tiles[nTileIndex]->data() + nRow * nTileSizeX;
+
+			size_t nCopiedCount = 0;
+			if ((nTileY + nRow < nSourceCountY) && (nCopyCountX > 0)) {
+				const TValue* pSourceRow = pSourceField->getRowSegment<TValue>(nTileX, nTileY + nRow, nCopyCountX, rowBuffer);
+				memcpy(pTargetRow, pSourceRow, nCopyCountX * sizeof(TValue));
+				nCopiedCount = nCopyCountX;
+			}
+
+			std::fill(pTargetRow + nCopiedCount, pTargetRow + nTileSizeX, defaultValue);
+		}
+	});
+}
+
+template <typename TTarget, typename TSource> void CDiscreteFieldData2DInstance::addTiles(CDiscreteFieldData2DInstance* pOtherField, double dScale, double dOffset)
+{
+	auto& tiles = getTiles<TTarget>();
+	auto& otherTiles = pOtherField->getTiles<TSource>();
+	bool bSameTileGrid = (pOtherField->m_nTileSizeX == m_nTileSizeX) && (pOtherField->m_nTileSizeY == m_nTileSizeY);
+
+	// All pixels of empty source tiles add the same value
+	double dSourceBackgroundValue = pOtherField->m_dBackgroundValue;
+	double dBackgroundSummand = (dSourceBackgroundValue * dScale) + dOffset;
+
+	for (size_t nTileIndex = 0; nTileIndex < getTileCount(); nTileIndex++) {
+		if (tiles[nTileIndex].get() == nullptr) {
+			size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+			getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+			if (!pOtherField->isRegionEmpty(nTileX, nTileY, nTileSizeX, nTileSizeY))
+				allocateTile<TTarget>(nTileIndex, true);
+		}
+	}
+
+	auto kernelType = getKernelType();
+	processTiles(sizeof(TTarget) + sizeof(TSource), true, [&](size_t nTileIndex, size_t nFirstRow, size_t nRowCount) {
+		size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+		getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+
+		TTarget* pTarget = tiles[nTileIndex]->data() + nFirstRow * nTileSizeX;
+
+		// Target * 1.0 is exact, so this matches addScaled with a constant source
+		if (pOtherField->isRegionEmpty(nTileX, nTileY, nTileSizeX, nTileSizeY)) {
+			CDiscreteFieldKernels::transform(kernelType, pTarget, nRowCount * nTileSizeX, 1.0, dBackgroundSummand);
+			return;
+		}
+
+		if (bSameTileGrid) {
+			CDiscreteFieldKernels::addScaled(kernelType, pTarget, otherTiles[nTileIndex]->data() + nFirstRow * nTileSizeX, nRowCount * nTileSizeX, dScale, dOffset);
+			return;
+		}
+
+		std::vector<TSource> rowBuffer;
+		for (size_t nRow = 0; nRow < nRowCount; nRow++) {
+			const TSource* pSource = pOtherField->getRowSegment<TSource>(nTileX, nTileY + nFirstRow + nRow, nTileSizeX, rowBuffer);
+			CDiscreteFieldKernels::addScaled(kernelType, pTarget + nRow * nTileSizeX, pSource, nTileSizeX, dScale, dOffset);
+		}
+	});
+
+	TTarget backgroundValue = (TTarget)m_dBackgroundValue;
+	TSource sourceBackgroundValue = (TSource)dSourceBackgroundValue;
+	CDiscreteFieldKernels::addScaled(eDiscreteFieldKernelType::dfkScalar, &backgroundValue, &sourceBackgroundValue, 1, dScale, dOffset);
+	m_dBackgroundValue = backgroundValue;
+}
+
+template <typename TValue> void CDiscreteFieldData2DInstance::scaleTilesDown(CDiscreteFieldData2DInstance* pNewField, uint32_t nFactorX, uint32_t nFactorY)
+{
+	auto& newTiles = pNewField->getTiles<TValue>();
+
+	// Full blocks of background pixels are averaged in the same order as the field values,
+	// so that empty tiles stay empty and still hold the exact result.
+	TValue backgroundValue = (TValue)m_dBackgroundValue;
+	double dColumnSum = 0.0;
+	for (uint32_t nRow = 0; nRow < nFactorY; nRow++)
+		dColumnSum += (double)backgroundValue;
+	double dBlockSum = 0.0;
+	for (uint32_t nColumn = 0; nColumn < nFactorX; nColumn++)
+		dBlockSum += dColumnSum;
+	pNewField->m_dBackgroundValue = (TValue)(dBlockSum / (double)((size_t)nFactorY * (size_t)nFactorX));
+
+	// Blocks at the right and bottom border may be cropped
+	bool bHasCroppedColumns = (m_nPixelCountX % nFactorX) != 0;
+	bool bHasCroppedRows = (m_nPixelCountY % nFactorY) != 0;
+
+	for (size_t nTileIndex = 0; nTileIndex < pNewField->getTileCount(); nTileIndex++) {
+		size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+		pNewField->getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+
+		size_t nSourceX = nTileX * nFactorX;
+		size_t nSourceY = nTileY * nFactorY;
+		size_t nSourceSizeX = std::min(nTileSizeX * nFactorX, m_nPixelCountX - nSourceX);
+		size_t nSourceSizeY = std::min(nTileSizeY * nFactorY, m_nPixelCountY - nSourceY);
+
+		bool bIsCropped = (bHasCroppedColumns && (nTileX + nTileSizeX == pNewField->m_nPixelCountX)) || (bHasCroppedRows && (nTileY + nTileSizeY == pNewField->m_nPixelCountY));
+		if (bIsCropped || !isRegionEmpty(nSourceX, nSourceY, nSourceSizeX, nSourceSizeY))
+			pNewField->allocateTile<TValue>(nTileIndex, false);
+	}
+
+	// Columns are summed first and rows second, which makes the result independent of the kernel type and the tiling.
+	auto kernelType = getKernelType();
+	pNewField->processTiles(sizeof(TValue) * (1 + (uint64_t)nFactorX * nFactorY), true, [&](size_t nTileIndex, size_t nFirstRow, size_t nRowCount) {
+		size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+		pNewField->getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+
+		size_t nSourceX = nTileX * nFactorX;
+		size_t nSourceSizeX = std::min(nTileSizeX * nFactorX, m_nPixelCountX - nSourceX);
+
+		std::vector<double> columnSums(nSourceSizeX);
+		std::vector<TValue> rowBuffer;
+
+		for (size_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++) {
+			std::fill(columnSums.begin(), columnSums.end(), 0.0);
+
+			size_t nFirstSourceY = (nTileY + nRow) * nFactorY;
+			size_t nSourceRowCount = std::min((size_t)nFactorY, m_nPixelCountY - nFirstSourceY);
+			for (size_t nSourceY = nFirstSourceY; nSourceY < nFirstSourceY + nSourceRowCount; nSourceY++)
+				CDiscreteFieldKernels::accumulate(kernelType, columnSums.data(), getRowSegment<TValue>(nSourceX, nSourceY, nSourceSizeX, rowBuffer), nSourceSizeX);
+
+			TValue* pTargetRow = newTiles[nTileIndex]->data() + nRow * nTileSizeX;
+			for (size_t nTargetX = 0; nTargetX < nTileSizeX; nTargetX++) {
+				size_t nFirstColumn = nTargetX * nFactorX;
+				size_t nColumnCount = std::min((size_t)nFactorX, nSourceSizeX - nFirstColumn);
+
+				double dValueSum = 0.0;
+				for (size_t nColumn = nFirstColumn; nColumn < nFirstColumn + nColumnCount; nColumn++)
+					dValueSum += columnSums[nColumn];
+
+				pTargetRow[nTargetX] = (TValue)(dValueSum / (double)(nSourceRowCount * nColumnCount));
+			}
+		}
+	});
+}
+
+template <typename TValue> void CDiscreteFieldData2DInstance::scaleTilesUp(CDiscreteFieldData2DInstance* pNewField, uint32_t nFactorX, uint32_t nFactorY)
+{
+	auto& newTiles = pNewField->getTiles<TValue>();
+	pNewField->m_dBackgroundValue = m_dBackgroundValue;
+
+	for (size_t nTileIndex = 0; nTileIndex < pNewField->getTileCount(); nTileIndex++) {
+		size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+		pNewField->getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+
+		size_t nSourceX = nTileX / nFactorX;
+		size_t nSourceY = nTileY / nFactorY;
+		size_t nSourceSizeX = (nTileX + nTileSizeX - 1) / nFactorX - nSourceX + 1;
+		size_t nSourceSizeY = (nTileY + nTileSizeY - 1) / nFactorY - nSourceY + 1;
+		if (!isRegionEmpty(nSourceX, nSourceY, nSourceSizeX, nSourceSizeY))
+			pNewField->allocateTile<TValue>(nTileIndex, false);
+	}
+
+	pNewField->processTiles(sizeof(TValue) * 2, true, [&](size_t nTileIndex, size_t nFirstRow, size_t nRowCount) {
+		size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+		pNewField->getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+
+		size_t nSourceX = nTileX / nFactorX;
+		size_t nSourceSizeX = (nTileX + nTileSizeX - 1) / nFactorX - nSourceX + 1;
+
+		std::vector<TValue> rowBuffer;
+		for (size_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++) {
+			size_t nTargetY = nTileY + nRow;
+			TValue* pTargetRow = newTiles[nTileIndex]->data() + nRow * nTileSizeX;
+
+			// Rows that come from the same source row are copied
+			if ((nRow > nFirstRow) && ((nTargetY - 1) / nFactorY == nTargetY / nFactorY)) {
+				memcpy(pTargetRow, pTargetRow - nTileSizeX, nTileSizeX * sizeof(TValue));
+				continue;
+			}
+
+			const TValue* pSourceRow = getRowSegment<TValue>(nSourceX, nTargetY / nFactorY, nSourceSizeX, rowBuffer);
+
+			// The first run may start in the middle of a source pixel
+			size_t nTargetX = 0;
+			size_t nRunEnd = std::min(nTileSizeX, (nSourceX + 1) * nFactorX - nTileX);
+			while (nTargetX < nTileSizeX) {
+				std::fill(pTargetRow + nTargetX, pTargetRow + nRunEnd, *pSourceRow);
+				pSourceRow++;
+				nTargetX = nRunEnd;
+				nRunEnd = std::min(nTileSizeX, nRunEnd + nFactorX);
+			}
+		}
+	});
+}
+
+template <typename TValue> void CDiscreteFieldData2DInstance::renderTiles(uint8_t* pTarget, const sDiscreteFieldColorScheme& colorScheme)
+{
+	auto& tiles = getTiles<TValue>();
+	auto kernelType = getKernelType();
+
+	TValue backgroundValue = (TValue)m_dBackgroundValue;
+	uint8_t backgroundColor[3];
+	CDiscreteFieldKernels::renderRGB(kernelType, &backgroundValue, backgroundColor, 1, colorScheme);
+
+	processTiles(sizeof(TValue) + 3, false, [&](size_t nTileIndex, size_t nFirstRow, size_t nRowCount) {
+		size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+		getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+
+		auto& pTile = tiles[nTileIndex];
+		for (size_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++) {
+			uint8_t* pTargetRow = pTarget + ((nTileY + nRow) * m_nPixelCountX + nTileX) * 3;
+
+			if (pTile.get() != nullptr) {
+				CDiscreteFieldKernels::renderRGB(kernelType, pTile->data() + nRow * nTileSizeX, pTargetRow, nTileSizeX, colorScheme);
+			}
+			else {
+				for (size_t nTargetX = 0; nTargetX < nTileSizeX; nTargetX++)
+					memcpy(pTargetRow + nTargetX * 3, backgroundColor, 3);
+			}
+		}
+	});
+}
+
+template <typename TValue> void CDiscreteFieldData2DInstance::renderPointTiles(double dDefaultValue, const std::vector<uint64_t>& pointTileIndices, const std::vector<uint64_t>& pointTileOffsets, const LibMCEnv::sFieldData2DPoint* pPointValuesBuffer)
+{
+	auto& tiles = getTiles<TValue>();
+	size_t nTileCount = getTileCount();
+
+	// Sample buffers are only allocated for tiles that contain points
+	std::vector<std::unique_ptr<std::vector<double>>> sampleSums(nTileCount);
+	std::vector<std::unique_ptr<std::vector<uint32_t>>> sampleCounts(nTileCount);
+
+	for (size_t nPointValueIndex = 0; nPointValueIndex < pointTileIndices.size(); nPointValueIndex++) {
+		uint64_t nTileIndex = pointTileIndices[nPointValueIndex];
+		if (nTileIndex >= nTileCount)
+			continue;
+
+		if (sampleSums[nTileIndex].get() == nullptr) {
+			size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+			getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+			sampleSums[nTileIndex] = std::make_unique<std::vector<double>>(nTileSizeX * nTileSizeY);
+			sampleCounts[nTileIndex] = std::make_unique<std::vector<uint32_t>>(nTileSizeX * nTileSizeY);
+		}
+
+		uint64_t nOffset = pointTileOffsets[nPointValueIndex];
+		(*sampleSums[nTileIndex])[nOffset] += pPointValuesBuffer[nPointValueIndex].m_Value;
+		(*sampleCounts[nTileIndex])[nOffset]++;
+	}
+
+	// All pixels without samples get the default value
+	setupTiles(m_StorageLayout);
+	m_dBackgroundValue = getStoredValue(dDefaultValue);
+
+	for (size_t nTileIndex = 0; nTileIndex < nTileCount; nTileIndex++) {
+		if (sampleSums[nTileIndex].get() != nullptr)
+			allocateTile<TValue>(nTileIndex, false);
+	}
+
+	processTiles(sizeof(TValue) + sizeof(double) + sizeof(uint32_t), true, [&](size_t nTileIndex, size_t nFirstRow, size_t nRowCount) {
+		size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+		getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+
+		TValue* pData = tiles[nTileIndex]->data();
+		const double* pSampleSums = sampleSums[nTileIndex]->data();
+		const uint32_t* pSampleCounts = sampleCounts[nTileIndex]->data();
+
+		for (size_t nOffset = nFirstRow * nTileSizeX; nOffset < (nFirstRow + nRowCount) * nTileSizeX; nOffset++) {
+			double dValue = dDefaultValue;
+			if (pSampleCounts[nOffset] != 0)
+				dValue = pSampleSums[nOffset] / (double)pSampleCounts[nOffset];
+
+			pData[nOffset] = (TValue)dValue;
+		}
+	});
+}
+
+template <typename TValue> void CDiscreteFieldData2DInstance::saveTiles(std::vector<uint8_t>& Buffer)
+{
+	auto& tiles = getTiles<TValue>();
+
+	// Streams always store double values, independent of the storage precision.
+	uint64_t nDataSize;
+	std::vector<uint32_t> storedTileIndices;
+	if (m_StorageLayout == LibMCEnv::eFieldStorageLayout::Tiled) {
+		uint64_t nStoredValueCount = 0;
+		for (size_t nTileIndex = 0; nTileIndex < getTileCount(); nTileIndex++) {
+			if (tiles[nTileIndex].get() != nullptr) {
+				storedTileIndices.push_back((uint32_t)nTileIndex);
+				nStoredValueCount += tiles[nTileIndex]->size();
+			}
+		}
+
+		nDataSize = sizeof(sDiscreteField2DStreamTileHeader) + storedTileIndices.size() * sizeof(uint32_t) + nStoredValueCount * sizeof(double);
+	}
+	else {
+		nDataSize = (uint64_t)m_nPixelCountX * (uint64_t)m_nPixelCountY * sizeof(double);
+	}
+
+	Buffer.resize(sizeof(sDiscreteField2DStreamHeader) + nDataSize);
+	sDiscreteField2DStreamHeader* header = (sDiscreteField2DStreamHeader*)Buffer.data();
+
+	memset((void*)header, 0, sizeof(sDiscreteField2DStreamHeader));
+	header->m_nFileSign = DISCRETEFIELD2D_STREAMFILESIGN;
+	header->m_nMajorVersion = DISCRETEFIELD2D_STREAMFILEMAJORVERSION;
+	header->m_nPatchVersion = DISCRETEFIELD2D_STREAMFILEPATCHVERSION;
+	header->m_nPixelCountX = (uint32_t)m_nPixelCountX;
+	header->m_nPixelCountY = (uint32_t)m_nPixelCountY;
+	header->m_dDPIX = m_dDPIX;
+	header->m_dDPIY = m_dDPIY;
+	header->m_dOriginX = m_dOriginX;
+	header->m_dOriginY = m_dOriginY;
+	header->m_nDataOffset = sizeof(sDiscreteField2DStreamHeader);
+
+	if (m_StorageLayout == LibMCEnv::eFieldStorageLayout::Tiled) {
+		header->m_nMinorVersion = DISCRETEFIELD2D_STREAMFILEMINORVERSION;
+		header->m_nStreamStorageType = DISCRETEFIELD2D_STREAMSTORAGETYPE_TILEDDATA;
+
+		sDiscreteField2DStreamTileHeader* tileHeader = (sDiscreteField2DStreamTileHeader*)&Buffer.at(header->m_nDataOffset);
+		memset((void*)tileHeader, 0, sizeof(sDiscreteField2DStreamTileHeader));
+		tileHeader->m_nTileSizeX = (uint32_t)m_nTileSizeX;
+		tileHeader->m_nTileSizeY = (uint32_t)m_nTileSizeY;
+		tileHeader->m_nStoredTileCount = (uint32_t)storedTileIndices.size();
+		tileHeader->m_dBackgroundValue = m_dBackgroundValue;
+
+		uint8_t* pTarget = (uint8_t*)tileHeader + sizeof(sDiscreteField2DStreamTileHeader);
+		if (!storedTileIndices.empty())
+			memcpy(pTarget, storedTileIndices.data(), storedTileIndices.size() * sizeof(uint32_t));
+		pTarget += storedTileIndices.size() * sizeof(uint32_t);
+
+		for (uint32_t nTileIndex : storedTileIndices) {
+			auto& tileData = *tiles[nTileIndex];
+			copyValues((double*)pTarget, tileData.data(), tileData.size());
+			pTarget += tileData.size() * sizeof(double);
+		}
+	}
+	else {
+		header->m_nMinorVersion = DISCRETEFIELD2D_STREAMFILEMINORVERSION_RAWDATA;
+		header->m_nStreamStorageType = DISCRETEFIELD2D_STREAMSTORAGETYPE_RAWDATA;
+
+		double* pTarget = (double*)&Buffer.at(header->m_nDataOffset);
+		std::vector<TValue> rowBuffer;
+		for (size_t nY = 0; nY < m_nPixelCountY; nY++)
+			copyValues(pTarget + nY * m_nPixelCountX, getRowSegment<TValue>(0, nY, m_nPixelCountX, rowBuffer), m_nPixelCountX);
+	}
+}
+
+
 PDiscreteFieldData2DInstance CDiscreteFieldData2DInstance::createFromBuffer(const std::vector<uint8_t>& Buffer)
 {
 	if (Buffer.size () < sizeof (sDiscreteField2DStreamHeader))
@@ -88,7 +657,7 @@ PDiscreteFieldData2DInstance CDiscreteFieldData2DInstance::createFromBuffer(cons
 	if (header->m_nMinorVersion > DISCRETEFIELD2D_STREAMFILEMINORVERSION)
 		throw ELibMCInterfaceException(LIBMC_ERROR_TOONEWDISCRETEFIELDFILEVERSION);
 
-	if (header->m_nStreamStorageType != DISCRETEFIELD2D_STREAMSTORAGETYPE_RAWDATA)
+	if ((header->m_nStreamStorageType != DISCRETEFIELD2D_STREAMSTORAGETYPE_RAWDATA) && (header->m_nStreamStorageType != DISCRETEFIELD2D_STREAMSTORAGETYPE_TILEDDATA))
 		throw ELibMCInterfaceException(LIBMC_ERROR_TOONEWDISCRETEFIELDSTREAMTYPE);
 
 	if (header->m_nDataOffset < sizeof(sDiscreteField2DStreamHeader))
@@ -96,30 +665,68 @@ PDiscreteFieldData2DInstance CDiscreteFieldData2DInstance::createFromBuffer(cons
 
 	auto pInstance = std::make_shared<CDiscreteFieldData2DInstance>(header->m_nPixelCountX, header->m_nPixelCountY, header->m_dDPIX, header->m_dDPIY, header->m_dOriginX, header->m_dOriginY, 0.0, false);
 
-	uint64_t nPixelCount = (uint64_t)header->m_nPixelCountX * (uint64_t)header->m_nPixelCountY;
-	if (header->m_nDataOffset + nPixelCount * sizeof (double) > Buffer.size ())
-		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDISCRETEFIELDSTREAMSIZE);
+	if (header->m_nStreamStorageType == DISCRETEFIELD2D_STREAMSTORAGETYPE_RAWDATA) {
+		uint64_t nPixelCount = (uint64_t)header->m_nPixelCountX * (uint64_t)header->m_nPixelCountY;
+		if (header->m_nDataOffset + nPixelCount * sizeof(double) > Buffer.size())
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDISCRETEFIELDSTREAMSIZE);
+
+		if (pInstance->m_Tiles.size() != 1)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDISCRETEFIELDINTERNALDATA);
 
-	auto * pDataVector = pInstance->m_Data.get ();
-	if (pDataVector == nullptr)
-		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDISCRETEFIELDINTERNALDATA);
-	if (pDataVector->size () != nPixelCount)
-		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDISCRETEFIELDINTERNALDATA);
+		double* pTarget = pInstance->allocateTile<double>(0, false);
+		memcpy(pTarget, &Buffer.at(header->m_nDataOffset), nPixelCount * sizeof(double));
 
-	double * pTargetPtr = pDataVector->data();
-	double * pSourcePtr = (double*)&Buffer.at(header->m_nDataOffset);
-	for (uint64_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
-		*pTargetPtr = *pSourcePtr;
-		pTargetPtr++;
-		pSourcePtr++;
+		return pInstance;
 	}
 
+	if (header->m_nDataOffset + sizeof(sDiscreteField2DStreamTileHeader) > Buffer.size())
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDISCRETEFIELDSTREAMSIZE);
+
+	auto tileHeader = (const sDiscreteField2DStreamTileHeader*)&Buffer.at(header->m_nDataOffset);
+	if ((tileHeader->m_nTileSizeX == 0) || (tileHeader->m_nTileSizeY == 0))
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDISCRETEFIELDBUFFER);
+
+	size_t nStreamTileSizeX = tileHeader->m_nTileSizeX;
+	size_t nStreamTileSizeY = tileHeader->m_nTileSizeY;
+	size_t nStreamTileCountX = (pInstance->m_nPixelCountX + nStreamTileSizeX - 1) / nStreamTileSizeX;
+	size_t nStreamTileCountY = (pInstance->m_nPixelCountY + nStreamTileSizeY - 1) / nStreamTileSizeY;
+	size_t nStoredTileCount = tileHeader->m_nStoredTileCount;
+
+	uint64_t nTileIndexOffset = header->m_nDataOffset + sizeof(sDiscreteField2DStreamTileHeader);
+	uint64_t nValueOffset = nTileIndexOffset + nStoredTileCount * sizeof(uint32_t);
+	if (nValueOffset > Buffer.size())
+		throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDISCRETEFIELDSTREAMSIZE);
+
+	pInstance->setupTiles(LibMCEnv::eFieldStorageLayout::Tiled);
+	pInstance->m_dBackgroundValue = tileHeader->m_dBackgroundValue;
+
+	const uint32_t* pTileIndices = (const uint32_t*)&Buffer.at(nTileIndexOffset);
+	for (size_t nStoredTile = 0; nStoredTile < nStoredTileCount; nStoredTile++) {
+		size_t nTileIndex = pTileIndices[nStoredTile];
+		if (nTileIndex >= nStreamTileCountX * nStreamTileCountY)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDISCRETEFIELDBUFFER);
+
+		size_t nTileX = (nTileIndex % nStreamTileCountX) * nStreamTileSizeX;
+		size_t nTileY = (nTileIndex / nStreamTileCountX) * nStreamTileSizeY;
+		size_t nTileSizeX = std::min(nStreamTileSizeX, pInstance->m_nPixelCountX - nTileX);
+		size_t nTileSizeY = std::min(nStreamTileSizeY, pInstance->m_nPixelCountY - nTileY);
+
+		uint64_t nTileValueCount = (uint64_t)nTileSizeX * (uint64_t)nTileSizeY;
+		if (nValueOffset + nTileValueCount * sizeof(double) > Buffer.size())
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDDISCRETEFIELDSTREAMSIZE);
+
+		// Streams from other tile sizes are regrouped into the tiles of the field.
+		pInstance->writeValues<double>(nTileX, nTileY, nTileSizeX, nTileSizeY, (const double*)&Buffer.at(nValueOffset));
+		nValueOffset += nTileValueCount * sizeof(double);
+	}
 
 	return pInstance;
 }
 
-CDiscreteFieldData2DInstance::CDiscreteFieldData2DInstance(size_t nPixelCountX, size_t nPixelCountY, double dDPIX, double dDPIY, double dOriginX, double dOriginY, double dDefaultValue, bool bDoClear)
-	: m_nPixelCountX (nPixelCountX), m_nPixelCountY (nPixelCountY), m_dDPIX (dDPIX), m_dDPIY (dDPIY), m_dOriginX (dOriginX), m_dOriginY (dOriginY)
+CDiscreteFieldData2DInstance::CDiscreteFieldData2DInstance(size_t nPixelCountX, size_t nPixelCountY, double dDPIX, double dDPIY, double dOriginX, double dOriginY, double dDefaultValue, bool bDoClear, LibMCEnv::eFieldStoragePrecision storagePrecision)
+	: m_nPixelCountX (nPixelCountX), m_nPixelCountY (nPixelCountY), m_dDPIX (dDPIX), m_dDPIY (dDPIY), m_dOriginX (dOriginX), m_dOriginY (dOriginY),
+	m_StorageLayout (LibMCEnv::eFieldStorageLayout::Dense), m_nTileSizeX (0), m_nTileSizeY (0), m_nTileCountX (0), m_nTileCountY (0), m_dBackgroundValue (0.0),
+	m_StoragePrecision (storagePrecision), m_nThreadCount (0), m_bSIMDKernelsEnabled (true)
 {
 	if (nPixelCountX <= 0)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELCOUNT);
@@ -138,20 +745,197 @@ CDiscreteFieldData2DInstance::CDiscreteFieldData2DInstance(size_t nPixelCountX,
 	if (abs(dOriginY) > DISCRETEFIELD_MAXORIGINCOORDINATE)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_ORIGINOUTOFRANGE);
 
-	m_Data = std::make_unique<std::vector<double>> ();
+	if ((storagePrecision != LibMCEnv::eFieldStoragePrecision::Float64) && (storagePrecision != LibMCEnv::eFieldStoragePrecision::Float32))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDSTORAGEPRECISION);
 
-	m_Data->resize((size_t)m_nPixelCountX * (size_t)m_nPixelCountY);
+	// Values are allocated on first write
+	setupTiles(LibMCEnv::eFieldStorageLayout::Dense);
 
 	if (bDoClear)
 		Clear(dDefaultValue);
 
 }
-		
+
 CDiscreteFieldData2DInstance::~CDiscreteFieldData2DInstance()
 {
-	
+
+}
+
+eDiscreteFieldKernelType CDiscreteFieldData2DInstance::getKernelType()
+{
+	if (m_bSIMDKernelsEnabled)
+		return CDiscreteFieldKernels::detectKernelType();
+
+	return eDiscreteFieldKernelType::dfkScalar;
+}
+
+size_t CDiscreteFieldData2DInstance::getBytesPerValue()
+{
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+		return sizeof(float);
+
+	return sizeof(double);
+}
+
+void CDiscreteFieldData2DInstance::checkDataBuffer()
+{
+	size_t nTileCount = getTileCount();
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32) {
+		if (m_FloatTiles.size() != nTileCount)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDBUFFER);
+	}
+	else {
+		if (m_Tiles.size() != nTileCount)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDBUFFER);
+	}
+}
+
+void CDiscreteFieldData2DInstance::setupTiles(LibMCEnv::eFieldStorageLayout storageLayout)
+{
+	size_t nTileSizeX;
+	size_t nTileSizeY;
+	switch (storageLayout) {
+	case LibMCEnv::eFieldStorageLayout::Dense:
+		nTileSizeX = m_nPixelCountX;
+		nTileSizeY = m_nPixelCountY;
+		break;
+
+	case LibMCEnv::eFieldStorageLayout::Tiled:
+		nTileSizeX = DISCRETEFIELD_TILESIZE;
+		nTileSizeY = DISCRETEFIELD_TILESIZE;
+		break;
+
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDSTORAGELAYOUT);
+	}
+
+	size_t nTileCountX = (m_nPixelCountX + nTileSizeX - 1) / nTileSizeX;
+	size_t nTileCountY = (m_nPixelCountY + nTileSizeY - 1) / nTileSizeY;
+	if ((uint64_t)nTileCountX * (uint64_t)nTileCountY > DISCRETEFIELD_MAXTILECOUNT)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_FIELDTILECOUNTEXCEEDSMAXIMUM);
+
+	m_StorageLayout = storageLayout;
+	m_nTileSizeX = nTileSizeX;
+	m_nTileSizeY = nTileSizeY;
+	m_nTileCountX = nTileCountX;
+	m_nTileCountY = nTileCountY;
+
+	m_Tiles.clear();
+	m_FloatTiles.clear();
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+		m_FloatTiles.resize(nTileCountX * nTileCountY);
+	else
+		m_Tiles.resize(nTileCountX * nTileCountY);
+}
+
+void CDiscreteFieldData2DInstance::takeStorage(CDiscreteFieldData2DInstance* pOtherField)
+{
+	m_nPixelCountX = pOtherField->m_nPixelCountX;
+	m_nPixelCountY = pOtherField->m_nPixelCountY;
+	m_StorageLayout = pOtherField->m_StorageLayout;
+	m_nTileSizeX = pOtherField->m_nTileSizeX;
+	m_nTileSizeY = pOtherField->m_nTileSizeY;
+	m_nTileCountX = pOtherField->m_nTileCountX;
+	m_nTileCountY = pOtherField->m_nTileCountY;
+	m_dBackgroundValue = pOtherField->m_dBackgroundValue;
+	m_StoragePrecision = pOtherField->m_StoragePrecision;
+	m_Tiles = std::move(pOtherField->m_Tiles);
+	m_FloatTiles = std::move(pOtherField->m_FloatTiles);
+
+	pOtherField->m_Tiles.clear();
+	pOtherField->m_FloatTiles.clear();
 }
 
+double CDiscreteFieldData2DInstance::getStoredValue(double dValue)
+{
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+		return (float)dValue;
+
+	return dValue;
+}
+
+size_t CDiscreteFieldData2DInstance::getTileCount()
+{
+	return m_nTileCountX * m_nTileCountY;
+}
+
+size_t CDiscreteFieldData2DInstance::getTileIndex(size_t nX, size_t nY)
+{
+	return (nY / m_nTileSizeY) * m_nTileCountX + (nX / m_nTileSizeX);
+}
+
+void CDiscreteFieldData2DInstance::getTileRegion(size_t nTileIndex, size_t& nX, size_t& nY, size_t& nSizeX, size_t& nSizeY)
+{
+	nX = (nTileIndex % m_nTileCountX) * m_nTileSizeX;
+	nY = (nTileIndex / m_nTileCountX) * m_nTileSizeY;
+	nSizeX = std::min(m_nTileSizeX, m_nPixelCountX - nX);
+	nSizeY = std::min(m_nTileSizeY, m_nPixelCountY - nY);
+}
+
+bool CDiscreteFieldData2DInstance::isTileAllocated(size_t nTileIndex)
+{
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+		return m_FloatTiles[nTileIndex].get() != nullptr;
+
+	return m_Tiles[nTileIndex].get() != nullptr;
+}
+
+bool CDiscreteFieldData2DInstance::isRegionEmpty(size_t nX, size_t nY, size_t nSizeX, size_t nSizeY)
+{
+	size_t nFirstTileX = nX / m_nTileSizeX;
+	size_t nFirstTileY = nY / m_nTileSizeY;
+	size_t nLastTileX = (nX + nSizeX - 1) / m_nTileSizeX;
+	size_t nLastTileY = (nY + nSizeY - 1) / m_nTileSizeY;
+
+	for (size_t nTileY = nFirstTileY; nTileY <= nLastTileY; nTileY++)
+		for (size_t nTileX = nFirstTileX; nTileX <= nLastTileX; nTileX++)
+			if (isTileAllocated(nTileY * m_nTileCountX + nTileX))
+				return false;
+
+	return true;
+}
+
+void CDiscreteFieldData2DInstance::processTiles(uint64_t nBytesPerPixel, bool bAllocatedTilesOnly, const std::function<void(size_t nTileIndex, size_t nFirstRow, size_t nRowCount)>& tileFunction)
+{
+	std::vector<size_t> tileIndices;
+	tileIndices.reserve(getTileCount());
+	for (size_t nTileIndex = 0; nTileIndex < getTileCount(); nTileIndex++) {
+		if ((!bAllocatedTilesOnly) || isTileAllocated(nTileIndex))
+			tileIndices.push_back(nTileIndex);
+	}
+
+	if (tileIndices.empty())
+		return;
+
+	// A single tile is split into row ranges, several tiles are distributed as a whole.
+	if (getTileCount() == 1) {
+		CDiscreteFieldKernels::processRows(m_nThreadCount, m_nPixelCountY, m_nPixelCountX * nBytesPerPixel, [&tileFunction](size_t nFirstRow, size_t nRowCount) {
+			tileFunction(0, nFirstRow, nRowCount);
+		});
+		return;
+	}
+
+	CDiscreteFieldKernels::processRows(m_nThreadCount, tileIndices.size(), m_nTileSizeX * m_nTileSizeY * nBytesPerPixel, [this, &tileIndices, &tileFunction](size_t nFirstTile, size_t nTileCount) {
+		for (size_t nIndex = nFirstTile; nIndex < nFirstTile + nTileCount; nIndex++) {
+			size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+			getTileRegion(tileIndices[nIndex], nTileX, nTileY, nTileSizeX, nTileSizeY);
+			tileFunction(tileIndices[nIndex], 0, nTileSizeY);
+		}
+	});
+}
+
+PDiscreteFieldData2DInstance CDiscreteFieldData2DInstance::createEmptyField(size_t nPixelCountX, size_t nPixelCountY, double dDPIX, double dDPIY)
+{
+	PDiscreteFieldData2DInstance pNewField = std::make_shared<CDiscreteFieldData2DInstance>(nPixelCountX, nPixelCountY, dDPIX, dDPIY, m_dOriginX, m_dOriginY, 0.0, false, m_StoragePrecision);
+	pNewField->setupTiles(m_StorageLayout);
+	pNewField->m_dBackgroundValue = m_dBackgroundValue;
+	pNewField->m_nThreadCount = m_nThreadCount;
+	pNewField->m_bSIMDKernelsEnabled = m_bSIMDKernelsEnabled;
+
+	return pNewField;
+}
+
+
 void CDiscreteFieldData2DInstance::GetDPI(double& dDPIValueX, double& dDPIValueY)
 {
 	dDPIValueX = m_dDPIX;
@@ -198,8 +982,7 @@ void CDiscreteFieldData2DInstance::GetSizeInPixels(uint32_t& nPixelCountX, uint3
 
 void CDiscreteFieldData2DInstance::ResizeField(uint32_t& nPixelCountX, uint32_t& nPixelCountY, double dDefaultValue)
 {
-	if (m_Data.get() == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDBUFFER);
+	checkDataBuffer();
 
 	if (nPixelCountX <= 0)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELCOUNT);
@@ -214,55 +997,24 @@ void CDiscreteFieldData2DInstance::ResizeField(uint32_t& nPixelCountX, uint32_t&
 		return;
 	}
 
-	auto pNewData = std::make_unique<std::vector<double>>();
-
-	pNewData->resize((size_t)nPixelCountX * (size_t)nPixelCountY);
-
-	for (uint32_t nY = 0; nY < nPixelCountY; nY++) {
-		double* pTarget = &pNewData->at((size_t)nY * (size_t)nPixelCountX);
-
-		if (nY < m_nPixelCountY) {
-			double * pSource = &m_Data->at((size_t)nY * (size_t)m_nPixelCountX);
-
-			for (uint32_t nX = 0; nX < nPixelCountX; nX++) {
-				
-				if (nX < m_nPixelCountX) {
-					*pTarget = *pSource;
-					pSource++;
-				}
-				else {
-					*pTarget = dDefaultValue;
-				}
-				pTarget++;
-			
-			}
-		}
-		else {
-
-			for (uint32_t nX = 0; nX < nPixelCountX; nX++) {
-				*pTarget = dDefaultValue;
-				pTarget++;
-			}
-
-		}
-		
-	}
+	PDiscreteFieldData2DInstance pNewField = createEmptyField(nPixelCountX, nPixelCountY, m_dDPIX, m_dDPIY);
 
-	m_Data.reset(pNewData.release ());
-	m_nPixelCountX = nPixelCountX;
-	m_nPixelCountY = nPixelCountY;
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+		pNewField->copyTilesFrom<float>(this, dDefaultValue);
+	else
+		pNewField->copyTilesFrom<double>(this, dDefaultValue);
 
+	takeStorage(pNewField.get());
 
 }
 
 void CDiscreteFieldData2DInstance::Clear(const double dValue)
 {
-	if (m_Data.get() == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDBUFFER);
+	checkDataBuffer();
 
-	for (auto iter = m_Data->begin(); iter != m_Data->end(); iter++) {
-		*iter = dValue;
-	}
+	// All tiles are released, the whole field has the background value
+	setupTiles(m_StorageLayout);
+	m_dBackgroundValue = getStoredValue(dValue);
 
 }
 
@@ -271,12 +1023,28 @@ void CDiscreteFieldData2DInstance::Clamp(const double dMinValue, const double dM
 	if (dMinValue >= dMaxValue)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCLAMPINTERVAL);
 
-	for (auto iter = m_Data->begin(); iter != m_Data->end(); iter++) {
-		auto dValue = *iter;
-		if (dValue < dMinValue)
-			*iter = dMinValue;
-		if (dValue > dMaxValue)
-			*iter = dMaxValue;
+	checkDataBuffer();
+
+	auto kernelType = getKernelType();
+	processTiles(getBytesPerValue(), true, [this, kernelType, dMinValue, dMaxValue](size_t nTileIndex, size_t nFirstRow, size_t nRowCount) {
+		size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+		getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+
+		size_t nOffset = nFirstRow * nTileSizeX;
+		size_t nCount = nRowCount * nTileSizeX;
+		if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+			CDiscreteFieldKernels::clamp(kernelType, m_FloatTiles[nTileIndex]->data() + nOffset, nCount, dMinValue, dMaxValue);
+		else
+			CDiscreteFieldKernels::clamp(kernelType, m_Tiles[nTileIndex]->data() + nOffset, nCount, dMinValue, dMaxValue);
+	});
+
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32) {
+		float fBackgroundValue = (float)m_dBackgroundValue;
+		CDiscreteFieldKernels::clamp(eDiscreteFieldKernelType::dfkScalar, &fBackgroundValue, 1, dMinValue, dMaxValue);
+		m_dBackgroundValue = fBackgroundValue;
+	}
+	else {
+		CDiscreteFieldKernels::clamp(eDiscreteFieldKernelType::dfkScalar, &m_dBackgroundValue, 1, dMinValue, dMaxValue);
 	}
 
 }
@@ -284,41 +1052,114 @@ void CDiscreteFieldData2DInstance::Clamp(const double dMinValue, const double dM
 
 double CDiscreteFieldData2DInstance::GetPixel(const uint32_t nX, const uint32_t nY)
 {
-	if (m_Data.get() == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDBUFFER);
+	checkDataBuffer();
 
 	if (nX >= m_nPixelCountX)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
 	if (nY >= m_nPixelCountY)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
 
-	size_t nAddress = (size_t)nX + (size_t)nY * (size_t)m_nPixelCountX;
-	return m_Data->at(nAddress);
+	size_t nTileIndex = getTileIndex(nX, nY);
+	size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+	getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+	size_t nOffset = ((size_t)nY - nTileY) * nTileSizeX + ((size_t)nX - nTileX);
+
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32) {
+		auto& pTile = m_FloatTiles[nTileIndex];
+		if (pTile.get() == nullptr)
+			return m_dBackgroundValue;
+		return pTile->at(nOffset);
+	}
+
+	auto& pTile = m_Tiles[nTileIndex];
+	if (pTile.get() == nullptr)
+		return m_dBackgroundValue;
+	return pTile->at(nOffset);
 }
 
 void CDiscreteFieldData2DInstance::SetPixel(const uint32_t nX, const uint32_t nY, const double dValue)
 {
-	if (m_Data.get() == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDBUFFER);
+	checkDataBuffer();
 
 	if (nX >= m_nPixelCountX)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
 	if (nY >= m_nPixelCountY)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
 
-	size_t nAddress = (size_t)nX + (size_t)nY * (size_t)m_nPixelCountX;
-	m_Data->at(nAddress) = dValue;
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+		writeValues<float>(nX, nY, 1, 1, &dValue);
+	else
+		writeValues<double>(nX, nY, 1, 1, &dValue);
 
 }
 
 void CDiscreteFieldData2DInstance::GetPixelRange(const uint32_t nXMin, const uint32_t nYMin, const uint32_t nXMax, const uint32_t nYMax, uint64_t nValueBufferSize, uint64_t* pValueNeededCount, double* pValueBuffer)
 {
-	throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_NOTIMPLEMENTED);
+	checkDataBuffer();
+
+	if (nXMin >= m_nPixelCountX)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
+	if (nYMin >= m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
+	if (nXMax >= m_nPixelCountX)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
+	if (nYMax >= m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
+	if (nXMin > nXMax)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATERANGE);
+	if (nYMin > nYMax)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATERANGE);
+
+	size_t nSizeX = (size_t)(nXMax - nXMin) + 1;
+	size_t nSizeY = (size_t)(nYMax - nYMin) + 1;
+	size_t nNeededCount = nSizeX * nSizeY;
+
+	if (pValueNeededCount != nullptr)
+		*pValueNeededCount = nNeededCount;
+
+	if (pValueBuffer != nullptr) {
+		if (nValueBufferSize < nNeededCount)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+
+		std::vector<float> floatBuffer;
+		std::vector<double> doubleBuffer;
+		for (size_t nY = 0; nY < nSizeY; nY++) {
+			if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+				copyValues(pValueBuffer + nY * nSizeX, getRowSegment<float>(nXMin, nYMin + nY, nSizeX, floatBuffer), nSizeX);
+			else
+				copyValues(pValueBuffer + nY * nSizeX, getRowSegment<double>(nXMin, nYMin + nY, nSizeX, doubleBuffer), nSizeX);
+		}
+	}
 }
 
 void CDiscreteFieldData2DInstance::SetPixelRange(const uint32_t nXMin, const uint32_t nYMin, const uint32_t nXMax, const uint32_t nYMax, const uint64_t nValueBufferSize, const double* pValueBuffer)
 {
-	throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_NOTIMPLEMENTED);
+	checkDataBuffer();
+
+	if (pValueBuffer == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+	if (nXMin >= m_nPixelCountX)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
+	if (nYMin >= m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
+	if (nXMax >= m_nPixelCountX)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
+	if (nYMax >= m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
+	if (nXMin > nXMax)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATERANGE);
+	if (nYMin > nYMax)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATERANGE);
+
+	size_t nSizeX = (size_t)(nXMax - nXMin) + 1;
+	size_t nSizeY = (size_t)(nYMax - nYMin) + 1;
+	if (nValueBufferSize != nSizeX * nSizeY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELDATACOUNT);
+
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+		writeValues<float>(nXMin, nYMin, nSizeX, nSizeY, pValueBuffer);
+	else
+		writeValues<double>(nXMin, nYMin, nSizeX, nSizeY, pValueBuffer);
 }
 
 
@@ -329,48 +1170,17 @@ PDiscreteFieldData2DInstance CDiscreteFieldData2DInstance::ScaleFieldDown(const
 	if (nFactorY == 0)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDSCALINGFACTOR);
 
+	checkDataBuffer();
+
 	size_t nNewPixelCountX = (m_nPixelCountX + (nFactorX - 1)) / nFactorX;
 	size_t nNewPixelCountY = (m_nPixelCountY + (nFactorY - 1)) / nFactorY;
 
-	PDiscreteFieldData2DInstance pNewField = std::make_shared<CDiscreteFieldData2DInstance>(nNewPixelCountX, nNewPixelCountY, m_dDPIX * (double)nFactorX, m_dDPIY * (double)nFactorX, m_dOriginX, m_dOriginY, 0.0, false);
+	PDiscreteFieldData2DInstance pNewField = createEmptyField(nNewPixelCountX, nNewPixelCountY, m_dDPIX / (double)nFactorX, m_dDPIY / (double)nFactorY);
 
-	for (uint32_t nY = 0; nY < nNewPixelCountY; nY++) {
-
-		double* pTarget = &pNewField->m_Data->at (nY * nNewPixelCountX);
-		for (uint32_t nX = 0; nX < nNewPixelCountX; nX++) {
-			double dValueSum = 0.0;
-			uint32_t nCount = 0;
-
-			for (uint32_t dY = 0; dY < nFactorY; dY++) {
-				size_t nTargetY = ((uint64_t)nY + dY);
-
-				if (nTargetY < m_nPixelCountY) {
-
-					double* pSource = &m_Data->at(nTargetY * (size_t)nFactorY * nNewPixelCountX + nX * (size_t)nFactorX);
-					size_t nTargetX = nX;
-					for (uint32_t dX = 0; dX < nFactorX; dX++) {
-						if (nTargetX < m_nPixelCountX) {
-							dValueSum += *pSource;
-							pSource++;
-							nCount++;
-						}
-						else {
-							break;
-						}
-					}
-				}
-				else {
-					break;
-				}
-			}
-
-			if (nCount == 0)
-				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INTERNALSCALINGERROR);
-
-			*pTarget = dValueSum / (double) nCount;
-			pTarget++;
-		}
-	}
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+		scaleTilesDown<float>(pNewField.get(), nFactorX, nFactorY);
+	else
+		scaleTilesDown<double>(pNewField.get(), nFactorX, nFactorY);
 
 	return pNewField;
 }
@@ -382,6 +1192,8 @@ PDiscreteFieldData2DInstance CDiscreteFieldData2DInstance::ScaleFieldUp(const ui
 	if (nFactorY == 0)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDSCALINGFACTOR);
 
+	checkDataBuffer();
+
 	size_t nNewPixelCountX = m_nPixelCountX * nFactorX;
 	size_t nNewPixelCountY = m_nPixelCountY * nFactorY;
 
@@ -390,25 +1202,12 @@ PDiscreteFieldData2DInstance CDiscreteFieldData2DInstance::ScaleFieldUp(const ui
 	if (nNewPixelCountY > DISCRETEFIELD_MAXPIXELCOUNT)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_SCALINGEXCEEDSMAXIMUMPIXELCOUNT);
 
-	PDiscreteFieldData2DInstance pNewField = std::make_shared<CDiscreteFieldData2DInstance>(nNewPixelCountX, nNewPixelCountY, m_dDPIX / (double)nFactorX, m_dDPIY / (double)nFactorX, m_dOriginX, m_dOriginY, 0.0, false);
-
-	for (uint32_t nY = 0; nY < m_nPixelCountY; nY++) {
+	PDiscreteFieldData2DInstance pNewField = createEmptyField(nNewPixelCountX, nNewPixelCountY, m_dDPIX * (double)nFactorX, m_dDPIY * (double)nFactorY);
 
-		double* pSource = &m_Data->at(nY * m_nPixelCountX);
-		for (uint32_t nX = 0; nX < m_nPixelCountX; nX++) {
-			double dValue = *pSource;
-			pSource++;
-
-			for (uint32_t dY = 0; dY < nFactorY; dY++) {
-				double* pTarget = &pNewField->m_Data->at(((size_t)nY * nFactorY + dY) * nNewPixelCountX);
-				for (uint32_t dX = 0; dX < nFactorX; dX++) {
-					*pTarget = dValue;
-					pTarget++;
-				}
-			}
-
-		}
-	}
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+		scaleTilesUp<float>(pNewField.get(), nFactorX, nFactorY);
+	else
+		scaleTilesUp<double>(pNewField.get(), nFactorX, nFactorY);
 
 	return pNewField;
 
@@ -421,9 +1220,28 @@ void CDiscreteFieldData2DInstance::DiscretizeWithMapping(const uint64_t nDiscret
 
 void CDiscreteFieldData2DInstance::TransformField(const double dScale, const double dOffset)
 {
-	for (auto iter = m_Data->begin(); iter != m_Data->end(); iter++) {
-		double dValue = *iter;
-		*iter = (dValue * dScale) + dOffset;
+	checkDataBuffer();
+
+	auto kernelType = getKernelType();
+	processTiles(getBytesPerValue(), true, [this, kernelType, dScale, dOffset](size_t nTileIndex, size_t nFirstRow, size_t nRowCount) {
+		size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+		getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+
+		size_t nOffset = nFirstRow * nTileSizeX;
+		size_t nCount = nRowCount * nTileSizeX;
+		if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+			CDiscreteFieldKernels::transform(kernelType, m_FloatTiles[nTileIndex]->data() + nOffset, nCount, dScale, dOffset);
+		else
+			CDiscreteFieldKernels::transform(kernelType, m_Tiles[nTileIndex]->data() + nOffset, nCount, dScale, dOffset);
+	});
+
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32) {
+		float fBackgroundValue = (float)m_dBackgroundValue;
+		CDiscreteFieldKernels::transform(eDiscreteFieldKernelType::dfkScalar, &fBackgroundValue, 1, dScale, dOffset);
+		m_dBackgroundValue = fBackgroundValue;
+	}
+	else {
+		CDiscreteFieldKernels::transform(eDiscreteFieldKernelType::dfkScalar, &m_dBackgroundValue, 1, dScale, dOffset);
 	}
 }
 
@@ -438,28 +1256,41 @@ void CDiscreteFieldData2DInstance::AddField(CDiscreteFieldData2DInstance* pOther
 	if (pOtherField->m_nPixelCountY != m_nPixelCountY)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDSIZE);
 
-	if (pOtherField->m_Data->size() != m_Data->size())
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INTERNALFIELDSIZEERROR);
+	checkDataBuffer();
+	pOtherField->checkDataBuffer();
+
+	bool bTargetIsFloat = (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32);
+	bool bSourceIsFloat = (pOtherField->m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32);
 
-	auto srcIter = pOtherField->m_Data->begin();
-	for (auto dstIter = m_Data->begin(); dstIter != m_Data->end();) {
-		*dstIter += (*srcIter * dScale) + dOffset;
-		srcIter++;
-		dstIter++;
+	if (bTargetIsFloat) {
+		if (bSourceIsFloat)
+			addTiles<float, float>(pOtherField, dScale, dOffset);
+		else
+			addTiles<float, double>(pOtherField, dScale, dOffset);
+	}
+	else {
+		if (bSourceIsFloat)
+			addTiles<double, float>(pOtherField, dScale, dOffset);
+		else
+			addTiles<double, double>(pOtherField, dScale, dOffset);
 	}
 }
 
 PDiscreteFieldData2DInstance CDiscreteFieldData2DInstance::Duplicate()
 {
-	PDiscreteFieldData2DInstance pNewField = std::make_shared<CDiscreteFieldData2DInstance>(m_nPixelCountX, m_nPixelCountY, m_dDPIX, m_dDPIY, m_dOriginX, m_dOriginY, 0.0, false);
-	if (pNewField->m_Data->size () != m_Data->size ())
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INTERNALFIELDSIZEERROR);
+	checkDataBuffer();
+
+	PDiscreteFieldData2DInstance pNewField = createEmptyField(m_nPixelCountX, m_nPixelCountY, m_dDPIX, m_dDPIY);
 
-	auto dstIter = pNewField->m_Data->begin();
-	for (auto srcIter = m_Data->begin(); srcIter != m_Data->end();) {
-		*dstIter = *srcIter;
-		srcIter++;
-		dstIter++;
+	for (size_t nTileIndex = 0; nTileIndex < getTileCount(); nTileIndex++) {
+		if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32) {
+			if (m_FloatTiles[nTileIndex].get() != nullptr)
+				pNewField->m_FloatTiles[nTileIndex] = std::make_unique<std::vector<float>>(*m_FloatTiles[nTileIndex]);
+		}
+		else {
+			if (m_Tiles[nTileIndex].get() != nullptr)
+				pNewField->m_Tiles[nTileIndex] = std::make_unique<std::vector<double>>(*m_Tiles[nTileIndex]);
+		}
 	}
 
 	return pNewField;
@@ -471,83 +1302,22 @@ void CDiscreteFieldData2DInstance::renderRGBImage(std::vector<uint8_t>* pPixelDa
 	if (pPixelData == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
 
-	pPixelData->resize((size_t) m_nPixelCountX * (size_t)m_nPixelCountY * 3);
-
-	double dDeltaMin = midValue - minValue;
-	double dDeltaMax = maxValue - midValue;
+	checkDataBuffer();
 
-	if (dDeltaMin < 0.0)
+	if (midValue < minValue)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCOLORRANGE);
-	if (dDeltaMax < 0.0)
+	if (maxValue < midValue)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCOLORRANGE);
 
-	size_t nPixelIndex = 0;
-
-	for (auto iter = m_Data->begin(); iter != m_Data->end(); iter++) {
-		double dValue = *iter;
-		double dFactor;
-
-		double dRed, dGreen, dBlue;
-
-		if (dValue < midValue) {
-
-			if (dDeltaMin > DISCRETEFIELD_MINVALUEDISTANCE) {
-				dFactor = (dValue - minValue) / dDeltaMin;
-			}
-			else {
-				dFactor = 0.0;
-			}
-
-			if (dFactor < 0.0)
-				dFactor = 0.0;
-
-			if (dFactor > 1.0)
-				dFactor = 1.0;
-
-			dRed = minRed * (1.0 - dFactor) + midRed * dFactor;
-			dGreen = minGreen * (1.0 - dFactor) + midGreen * dFactor;
-			dBlue = minBlue * (1.0 - dFactor) + midBlue * dFactor;
-
-
-		} else {
-
-			if (dDeltaMax > DISCRETEFIELD_MINVALUEDISTANCE) {
-				dFactor = (dValue - midValue) / dDeltaMax;
-			}
-			else {
-				dFactor = 0.0;
-			}
-
-			if (dFactor < 0.0)
-				dFactor = 0.0;
-
-			if (dFactor > 1.0)
-				dFactor = 1.0;
-
-			dRed = midRed * (1.0 - dFactor) + maxRed * dFactor;
-			dGreen = midGreen * (1.0 - dFactor) + maxGreen * dFactor;
-			dBlue = midBlue * (1.0 - dFactor) + maxBlue * dFactor;
-
-
-		}
-
-		dRed = std::clamp(dRed, 0.0, 1.0);
-		dGreen = std::clamp(dGreen, 0.0, 1.0);
-		dBlue = std::clamp(dBlue, 0.0, 1.0);
+	pPixelData->resize((size_t) m_nPixelCountX * (size_t)m_nPixelCountY * 3);
 
-		uint8_t nRed = (uint8_t) round(dRed * 255.0);
-		uint8_t nGreen = (uint8_t)round(dGreen * 255.0);
-		uint8_t nBlue = (uint8_t)round(dBlue * 255.0);
+	sDiscreteFieldColorScheme colorScheme = { minValue, midValue, maxValue, { minRed, minGreen, minBlue }, { midRed, midGreen, midBlue }, { maxRed, maxGreen, maxBlue } };
 
-		pPixelData->at(nPixelIndex * 3) = nRed;
-		pPixelData->at(nPixelIndex * 3 + 1) = nGreen;
-		pPixelData->at(nPixelIndex * 3 + 2) = nBlue;
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+		renderTiles<float>(pPixelData->data(), colorScheme);
+	else
+		renderTiles<double>(pPixelData->data(), colorScheme);
 
-		nPixelIndex++;
-	}
-
-	
-	
 }
 
 
@@ -563,188 +1333,237 @@ void CDiscreteFieldData2DInstance::renderAveragePointValues_FloorSampling(const
 	if (pPointValuesBuffer == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
 
-	std::vector<double> sampleSumBuffer;
-	sampleSumBuffer.resize(m_nPixelCountX * m_nPixelCountY);
-
-
-	std::vector<uint32_t> sampleCountBuffer;
-	sampleCountBuffer.resize(m_nPixelCountX * m_nPixelCountY);
-	for (auto& sampleCount : sampleCountBuffer)
-		sampleCount = 0;
+	checkDataBuffer();
 
+	const uint64_t nOutsideTileIndex = std::numeric_limits<uint64_t>::max();
+	size_t nPixelCountX = m_nPixelCountX;
+	size_t nPixelCountY = m_nPixelCountY;
+	double dOriginX = m_dOriginX;
+	double dOriginY = m_dOriginY;
 	double dPixelPerMMX = m_dDPIX / 25.4;
 	double dPixelPerMMY = m_dDPIY / 25.4;
 
-	auto pPointValue = pPointValuesBuffer;
-	for (size_t nPointValueIndex = 0; nPointValueIndex < nPointValuesBufferSize; nPointValueIndex++) {
-		double dPixelPositionX = (pPointValue->m_Coordinates[0] - m_dOriginX) * dPixelPerMMX;
-		double dPixelPositionY = (pPointValue->m_Coordinates[1] - m_dOriginY) * dPixelPerMMY;
-		double dValue = pPointValue->m_Value;
-
-		int64_t nRoundedPixelPositionX = (int64_t) floor(dPixelPositionX);
-		int64_t nRoundedPixelPositionY = (int64_t) floor(dPixelPositionY);
-
-		if ((nRoundedPixelPositionX >= 0) && (nRoundedPixelPositionY >= 0) &&
-			(nRoundedPixelPositionX < (int64_t) m_nPixelCountX) && (nRoundedPixelPositionY < (int64_t) m_nPixelCountY)) {
-
-			size_t nAddress = nRoundedPixelPositionX + nRoundedPixelPositionY * m_nPixelCountX;
-			auto & sampleCount = sampleCountBuffer.at (nAddress);
-			auto & sampleSum = sampleSumBuffer.at(nAddress);
-			if (sampleCount == 0) {
-				sampleSum = dValue;
-				sampleCount = 1;
-			}
-			else {
-				sampleSum += dValue;
-				sampleCount++;
+	// Tile addresses are computed in parallel. The values are summed up in point order afterwards,
+	// so that the averages do not depend on the thread count.
+	std::vector<uint64_t> pointTileIndices(nPointValuesBufferSize);
+	std::vector<uint64_t> pointTileOffsets(nPointValuesBufferSize);
+	CDiscreteFieldKernels::processRows(m_nThreadCount, nPointValuesBufferSize, sizeof(LibMCEnv::sFieldData2DPoint), [&](size_t nFirstPoint, size_t nPointCount) {
+		for (size_t nPointValueIndex = nFirstPoint; nPointValueIndex < nFirstPoint + nPointCount; nPointValueIndex++) {
+			auto pPointValue = &pPointValuesBuffer[nPointValueIndex];
+			double dPixelPositionX = (pPointValue->m_Coordinates[0] - dOriginX) * dPixelPerMMX;
+			double dPixelPositionY = (pPointValue->m_Coordinates[1] - dOriginY) * dPixelPerMMY;
+
+			uint64_t nTileIndex = nOutsideTileIndex;
+			uint64_t nTileOffset = 0;
+
+			// Negated comparisons drop NaN coordinates
+			if ((dPixelPositionX >= 0.0) && (dPixelPositionY >= 0.0) && (dPixelPositionX < (double)nPixelCountX) && (dPixelPositionY < (double)nPixelCountY)) {
+				size_t nRoundedPixelPositionX = (size_t)floor(dPixelPositionX);
+				size_t nRoundedPixelPositionY = (size_t)floor(dPixelPositionY);
+
+				size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+				nTileIndex = getTileIndex(nRoundedPixelPositionX, nRoundedPixelPositionY);
+				getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
+				nTileOffset = (nRoundedPixelPositionY - nTileY) * nTileSizeX + (nRoundedPixelPositionX - nTileX);
 			}
 
+			pointTileIndices[nPointValueIndex] = nTileIndex;
+			pointTileOffsets[nPointValueIndex] = nTileOffset;
 		}
+	});
 
-		pPointValue++;
-	}
-
-	for (uint32_t nY = 0; nY < m_nPixelCountY; nY++) {
-		for (uint32_t nX = 0; nX < m_nPixelCountX; nX++) {
-			size_t nAddress = nX + nY * m_nPixelCountX;
-			auto& sampleCount = sampleCountBuffer.at(nAddress);
-			auto& sampleSum = sampleSumBuffer.at(nAddress);
-
-			if (sampleCount == 0) {
-				SetPixel(nX, nY, dDefaultValue);
-			}
-			else {
-				SetPixel(nX, nY, sampleSum / (double)sampleCount);
-			}
-		}
-
-	}
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+		renderPointTiles<float>(dDefaultValue, pointTileIndices, pointTileOffsets, pPointValuesBuffer);
+	else
+		renderPointTiles<double>(dDefaultValue, pointTileIndices, pointTileOffsets, pPointValuesBuffer);
 
 }
 
 void CDiscreteFieldData2DInstance::saveToBuffer(std::vector<uint8_t>& Buffer)
 {
-	uint64_t nPixelCount = m_nPixelCountX * m_nPixelCountY;
-	Buffer.resize (sizeof (sDiscreteField2DStreamHeader) + nPixelCount * sizeof (double));
-	sDiscreteField2DStreamHeader* header = (sDiscreteField2DStreamHeader*)Buffer.data();
-
-	memset((void*)header, 0, sizeof(sDiscreteField2DStreamHeader));
-	header->m_nFileSign = DISCRETEFIELD2D_STREAMFILESIGN;
-	header->m_nMajorVersion = DISCRETEFIELD2D_STREAMFILEMAJORVERSION;
-	header->m_nMinorVersion = DISCRETEFIELD2D_STREAMFILEMINORVERSION;
-	header->m_nPatchVersion = DISCRETEFIELD2D_STREAMFILEPATCHVERSION;
-	header->m_nStreamStorageType = DISCRETEFIELD2D_STREAMSTORAGETYPE_RAWDATA;
-	header->m_nPixelCountX = (uint32_t) m_nPixelCountX;
-	header->m_nPixelCountY = (uint32_t) m_nPixelCountY;
-	header->m_dDPIX = m_dDPIX;
-	header->m_dDPIY = m_dDPIY;
-	header->m_dOriginX = m_dOriginX;
-	header->m_dOriginY = m_dOriginY;
-	header->m_nDataOffset = sizeof(sDiscreteField2DStreamHeader);
+	checkDataBuffer();
 
-	double* pSourcePtr = m_Data.get()->data();
-	double* pTargetPtr = (double*)&Buffer.at(header->m_nDataOffset);
-	for (uint64_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
-		*pTargetPtr = *pSourcePtr;
-		pTargetPtr++;
-		pSourcePtr++;
-	}
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+		saveTiles<float>(Buffer);
+	else
+		saveTiles<double>(Buffer);
 }
 
 void CDiscreteFieldData2DInstance::loadFromRawPixelData(const std::vector<uint8_t>& pixelData, LibMCEnv::eImagePixelFormat pixelFormat, double dBlackValue, double dWhiteValue)
 {
+	checkDataBuffer();
 
+	size_t nBytesPerPixel;
 	switch (pixelFormat) {
 	case LibMCEnv::eImagePixelFormat::GreyScale8bit:
-		if (pixelData.size() != (m_nPixelCountX * m_nPixelCountY))
-			throw eLibMCEnvImagePixelFormat(LIBMCENV_ERROR_RAWPIXELDATASIZEMISMATCH);
-
-		for (uint32_t nY = 0; nY < m_nPixelCountY; nY++) {
+		nBytesPerPixel = 1;
+		break;
 
-			double* pTarget = &m_Data->at(nY * m_nPixelCountX);
-			const uint8_t* pSource = &pixelData.at (nY * m_nPixelCountX);
-			for (uint32_t nX = 0; nX < m_nPixelCountX; nX++) {
-				double dGreyScale = (*pSource) / 255.0;
-				pSource++;
+	case LibMCEnv::eImagePixelFormat::RGB24bit:
+		nBytesPerPixel = 3;
+		break;
 
-				double dValue = (1.0 - dGreyScale) * dBlackValue + dGreyScale * dWhiteValue;
-				*pTarget = dValue;
-				pTarget++;
+	case LibMCEnv::eImagePixelFormat::RGBA32bit:
+		nBytesPerPixel = 4;
+		break;
 
-			}
-		}
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
+	}
 
+	if (pixelData.size() != (m_nPixelCountX * m_nPixelCountY * nBytesPerPixel))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_RAWPIXELDATASIZEMISMATCH);
 
+	for (size_t nTileIndex = 0; nTileIndex < getTileCount(); nTileIndex++) {
+		if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+			allocateTile<float>(nTileIndex, false);
+		else
+			allocateTile<double>(nTileIndex, false);
+	}
 
-		break;
+	processTiles(getBytesPerValue() + nBytesPerPixel, true, [&](size_t nTileIndex, size_t nFirstRow, size_t nRowCount) {
+		size_t nTileX, nTileY, nTileSizeX, nTileSizeY;
+		getTileRegion(nTileIndex, nTileX, nTileY, nTileSizeX, nTileSizeY);
 
-	case LibMCEnv::eImagePixelFormat::RGB24bit:
-		if (pixelData.size() != (m_nPixelCountX * m_nPixelCountY * 3))
-			throw eLibMCEnvImagePixelFormat(LIBMCENV_ERROR_RAWPIXELDATASIZEMISMATCH);
+		for (size_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++) {
+			const uint8_t* pSource = pixelData.data() + ((nTileY + nRow) * m_nPixelCountX + nTileX) * nBytesPerPixel;
+			if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+				loadGreyValues(pSource, m_FloatTiles[nTileIndex]->data() + nRow * nTileSizeX, nTileSizeX, nBytesPerPixel, dBlackValue, dWhiteValue);
+			else
+				loadGreyValues(pSource, m_Tiles[nTileIndex]->data() + nRow * nTileSizeX, nTileSizeX, nBytesPerPixel, dBlackValue, dWhiteValue);
+		}
+	});
 
-		for (uint32_t nY = 0; nY < m_nPixelCountY; nY++) {
+	if (m_StorageLayout == LibMCEnv::eFieldStorageLayout::Tiled)
+		Compact();
 
-			double* pTarget = &m_Data->at(nY * m_nPixelCountX);
-			const uint8_t* pSource = &pixelData.at(nY * m_nPixelCountX * 3);
-			for (uint32_t nX = 0; nX < m_nPixelCountX; nX++) {
-				int64_t nRed = *pSource; 
-				pSource++;
+}
 
-				int64_t nGreen = *pSource;
-				pSource++;
+LibMCEnv::eFieldStoragePrecision CDiscreteFieldData2DInstance::GetStoragePrecision()
+{
+	return m_StoragePrecision;
+}
 
-				int64_t nBlue = *pSource;
-				pSource++;
+void CDiscreteFieldData2DInstance::SetStoragePrecision(const LibMCEnv::eFieldStoragePrecision eStoragePrecision)
+{
+	checkDataBuffer();
 
-				double dGreyScale = (nRed + nGreen + nBlue) / (255.0 * 3);
+	if (eStoragePrecision == m_StoragePrecision)
+		return;
 
-				double dValue = (1.0 - dGreyScale) * dBlackValue + dGreyScale * dWhiteValue;
-				*pTarget = dValue;
-				pTarget++;
+	size_t nTileCount = getTileCount();
+
+	// Tiles are converted one by one to keep the peak memory low
+	switch (eStoragePrecision) {
+	case LibMCEnv::eFieldStoragePrecision::Float32:
+		m_FloatTiles.resize(nTileCount);
+		for (size_t nTileIndex = 0; nTileIndex < nTileCount; nTileIndex++) {
+			auto& pTile = m_Tiles[nTileIndex];
+			if (pTile.get() != nullptr) {
+				auto pNewTile = std::make_unique<std::vector<float>>(pTile->size());
+				copyValues(pNewTile->data(), pTile->data(), pTile->size());
+				m_FloatTiles[nTileIndex] = std::move(pNewTile);
+				pTile.reset();
+			}
+		}
+		m_Tiles.clear();
+		m_dBackgroundValue = (float)m_dBackgroundValue;
+		break;
 
+	case LibMCEnv::eFieldStoragePrecision::Float64:
+		m_Tiles.resize(nTileCount);
+		for (size_t nTileIndex = 0; nTileIndex < nTileCount; nTileIndex++) {
+			auto& pTile = m_FloatTiles[nTileIndex];
+			if (pTile.get() != nullptr) {
+				auto pNewTile = std::make_unique<std::vector<double>>(pTile->size());
+				copyValues(pNewTile->data(), pTile->data(), pTile->size());
+				m_Tiles[nTileIndex] = std::move(pNewTile);
+				pTile.reset();
 			}
 		}
+		m_FloatTiles.clear();
+		break;
 
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDSTORAGEPRECISION);
+	}
 
+	m_StoragePrecision = eStoragePrecision;
+}
 
-		break;
+LibMCEnv::eFieldStorageLayout CDiscreteFieldData2DInstance::GetStorageLayout()
+{
+	return m_StorageLayout;
+}
 
-	case LibMCEnv::eImagePixelFormat::RGBA32bit:
-		if (pixelData.size() != (m_nPixelCountX * m_nPixelCountY * 4))
-			throw eLibMCEnvImagePixelFormat(LIBMCENV_ERROR_RAWPIXELDATASIZEMISMATCH);
+void CDiscreteFieldData2DInstance::SetStorageLayout(const LibMCEnv::eFieldStorageLayout eStorageLayout)
+{
+	checkDataBuffer();
 
-		for (uint32_t nY = 0; nY < m_nPixelCountY; nY++) {
+	if ((eStorageLayout != LibMCEnv::eFieldStorageLayout::Dense) && (eStorageLayout != LibMCEnv::eFieldStorageLayout::Tiled))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDSTORAGELAYOUT);
 
-			double* pTarget = &m_Data->at(nY * m_nPixelCountX);
-			const uint8_t* pSource = &pixelData.at(nY * m_nPixelCountX * 4);
-			for (uint32_t nX = 0; nX < m_nPixelCountX; nX++) {
-				int64_t nRed = *pSource;
-				pSource++;
+	if (eStorageLayout == m_StorageLayout)
+		return;
 
-				int64_t nGreen = *pSource;
-				pSource++;
+	PDiscreteFieldData2DInstance pNewField = createEmptyField(m_nPixelCountX, m_nPixelCountY, m_dDPIX, m_dDPIY);
+	pNewField->setupTiles(eStorageLayout);
 
-				int64_t nBlue = *pSource;
-				pSource++;
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+		pNewField->copyTilesFrom<float>(this, m_dBackgroundValue);
+	else
+		pNewField->copyTilesFrom<double>(this, m_dBackgroundValue);
 
-				// Skip Alpha
-				pSource++;
+	if (eStorageLayout == LibMCEnv::eFieldStorageLayout::Tiled)
+		pNewField->Compact();
 
-				double dGreyScale = (nRed + nGreen + nBlue) / (255.0 * 3);
+	takeStorage(pNewField.get());
+}
 
-				double dValue = (1.0 - dGreyScale) * dBlackValue + dGreyScale * dWhiteValue;
-				*pTarget = dValue;
-				pTarget++;
+uint64_t CDiscreteFieldData2DInstance::GetStorageSize()
+{
+	uint64_t nStorageSize = 0;
+	for (auto& pTile : m_Tiles) {
+		if (pTile.get() != nullptr)
+			nStorageSize += pTile->size() * sizeof(double);
+	}
+	for (auto& pTile : m_FloatTiles) {
+		if (pTile.get() != nullptr)
+			nStorageSize += pTile->size() * sizeof(float);
+	}
 
-			}
-		}
+	return nStorageSize;
+}
+
+void CDiscreteFieldData2DInstance::Compact()
+{
+	checkDataBuffer();
 
+	if (m_StoragePrecision == LibMCEnv::eFieldStoragePrecision::Float32)
+		releaseUniformTiles<float>();
+	else
+		releaseUniformTiles<double>();
+}
 
+uint32_t CDiscreteFieldData2DInstance::GetThreadCount()
+{
+	return m_nThreadCount;
+}
 
-		break;
+void CDiscreteFieldData2DInstance::SetThreadCount(const uint32_t nThreadCount)
+{
+	if (nThreadCount > DISCRETEFIELDKERNELS_MAXTHREADCOUNT)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDFIELDTHREADCOUNT);
 
-	default:
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
-	}
+	m_nThreadCount = nThreadCount;
+}
+
+void CDiscreteFieldData2DInstance::SetSIMDKernelsEnabled(const bool bEnabled)
+{
+	m_bSIMDKernelsEnabled = bEnabled;
+}
 
+std::string CDiscreteFieldData2DInstance::GetSIMDKernelName()
+{
+	return CDiscreteFieldKernels::getKernelTypeName(getKernelType());
 }
@@ -38,6 +38,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <map>
 
 #include "libmcenv_types.hpp"
+#include "amc_discretefieldkernels.hpp"
 
 namespace AMC {
 
@@ -57,13 +58,88 @@ namespace AMC {
 		double m_dOriginX;
 		double m_dOriginY;
 		
-		std::unique_ptr<std::vector<double>> m_Data;
+		// Values are stored in row-major tiles of m_nTileSizeX x m_nTileSizeY pixels, tiles at the right and bottom
+		// border are cropped. Dense fields consist of a single tile. Tiles are allocated when they are written to,
+		// all pixels of an unallocated tile have the background value.
+		LibMCEnv::eFieldStorageLayout m_StorageLayout;
+		size_t m_nTileSizeX;
+		size_t m_nTileSizeY;
+		size_t m_nTileCountX;
+		size_t m_nTileCountY;
+		double m_dBackgroundValue;
+
+		// Only the tile list of the storage precision is used.
+		LibMCEnv::eFieldStoragePrecision m_StoragePrecision;
+		std::vector<std::unique_ptr<std::vector<double>>> m_Tiles;
+		std::vector<std::unique_ptr<std::vector<float>>> m_FloatTiles;
+
+		uint32_t m_nThreadCount;
+		bool m_bSIMDKernelsEnabled;
+
+		eDiscreteFieldKernelType getKernelType();
+
+		size_t getBytesPerValue();
+
+		void checkDataBuffer();
+
+		// Releases all tiles and sets up the tile grid of the given layout.
+		void setupTiles(LibMCEnv::eFieldStorageLayout storageLayout);
+
+		// Takes over size, layout and values of another field.
+		void takeStorage(CDiscreteFieldData2DInstance* pOtherField);
+
+		// Rounds a value to the storage precision.
+		double getStoredValue(double dValue);
+
+		size_t getTileCount();
+
+		size_t getTileIndex(size_t nX, size_t nY);
+
+		void getTileRegion(size_t nTileIndex, size_t& nX, size_t& nY, size_t& nSizeX, size_t& nSizeY);
+
+		bool isTileAllocated(size_t nTileIndex);
+
+		// Returns true if no tile that intersects the region is allocated.
+		bool isRegionEmpty(size_t nX, size_t nY, size_t nSizeX, size_t nSizeY);
+
+		// Calls tileFunction for row ranges of all tiles (or of all allocated tiles). Tiles are split across threads,
+		// so tileFunction must not allocate or release tiles.
+		void processTiles(uint64_t nBytesPerPixel, bool bAllocatedTilesOnly, const std::function<void(size_t nTileIndex, size_t nFirstRow, size_t nRowCount)>& tileFunction);
+
+		// Creates an empty field with the same storage layout, precision, background value and kernel settings.
+		PDiscreteFieldData2DInstance createEmptyField(size_t nPixelCountX, size_t nPixelCountY, double dDPIX, double dDPIY);
+
+		template <typename TValue> std::vector<std::unique_ptr<std::vector<TValue>>>& getTiles();
+
+		template <typename TValue> TValue* allocateTile(size_t nTileIndex, bool bFillWithBackground);
+
+		// Returns nCount values of row nY, starting at nX. The values are only copied into buffer if they span several tiles.
+		template <typename TValue> const TValue* getRowSegment(size_t nX, size_t nY, size_t nCount, std::vector<TValue>& buffer);
+
+		template <typename TValue> void writeValues(size_t nX, size_t nY, size_t nSizeX, size_t nSizeY, const double* pSource);
+
+		template <typename TValue> void releaseUniformTiles();
+
+		// Copies the overlapping values of a field with the same precision, the remaining pixels are set to dDefaultValue.
+		template <typename TValue> void copyTilesFrom(CDiscreteFieldData2DInstance* pSourceField, double dDefaultValue);
+
+		template <typename TTarget, typename TSource> void addTiles(CDiscreteFieldData2DInstance* pOtherField, double dScale, double dOffset);
+
+		template <typename TValue> void scaleTilesDown(CDiscreteFieldData2DInstance* pNewField, uint32_t nFactorX, uint32_t nFactorY);
+
+		template <typename TValue> void scaleTilesUp(CDiscreteFieldData2DInstance* pNewField, uint32_t nFactorX, uint32_t nFactorY);
+
+		template <typename TValue> void renderTiles(uint8_t* pTarget, const sDiscreteFieldColorScheme& colorScheme);
+
+		template <typename TValue> void renderPointTiles(double dDefaultValue, const std::vector<uint64_t>& pointTileIndices, const std::vector<uint64_t>& pointTileOffsets, const LibMCEnv::sFieldData2DPoint* pPointValuesBuffer);
+
+		template <typename TValue> void saveTiles(std::vector<uint8_t>& Buffer);
 
 	public:
 
 		static PDiscreteFieldData2DInstance createFromBuffer(const std::vector<uint8_t> & Buffer);
 
-		CDiscreteFieldData2DInstance(size_t nPixelCountX, size_t nPixelCountY, double dDPIX, double dDPIY, double dOriginX, double dOriginY, double dDefaultValue, bool bDoClear);
+		CDiscreteFieldData2DInstance(size_t nPixelCountX, size_t nPixelCountY, double dDPIX, double dDPIY, double dOriginX, double dOriginY, double dDefaultValue, bool bDoClear, LibMCEnv::eFieldStoragePrecision storagePrecision = LibMCEnv::eFieldStoragePrecision::Float64);
 		
 		virtual ~CDiscreteFieldData2DInstance();
 
@@ -114,6 +190,26 @@ namespace AMC {
 		void saveToBuffer (std::vector<uint8_t> & Buffer);
 
 		void loadFromRawPixelData (const std::vector<uint8_t>& pixelData, LibMCEnv::eImagePixelFormat pixelFormat, double dBlackValue, double dWhiteValue);
+
+		LibMCEnv::eFieldStoragePrecision GetStoragePrecision();
+
+		void SetStoragePrecision(const LibMCEnv::eFieldStoragePrecision eStoragePrecision);
+
+		LibMCEnv::eFieldStorageLayout GetStorageLayout();
+
+		void SetStorageLayout(const LibMCEnv::eFieldStorageLayout eStorageLayout);
+
+		uint64_t GetStorageSize();
+
+		void Compact();
+
+		uint32_t GetThreadCount();
+
+		void SetThreadCount(const uint32_t nThreadCount);
+
+		void SetSIMDKernelsEnabled(const bool bEnabled);
+
+		std::string GetSIMDKernelName();
 		
 	};
 
@@ -0,0 +1,452 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "amc_discretefieldkernels.hpp"
+#include "common_parallelblocks.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define DISCRETEFIELDKERNELS_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define DISCRETEFIELDKERNELS_TARGET_AVX2
+#else
+#define DISCRETEFIELDKERNELS_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+#define DISCRETEFIELD_MINVALUEDISTANCE 1E-6
+
+using namespace AMC;
+
+
+/*************************************************************************************************************************
+ Scalar reference kernels
+**************************************************************************************************************************/
+
+template <typename TValue> static void transformScalar(TValue* pData, size_t nCount, double dScale, double dOffset)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++)
+		pData[nIndex] = (TValue)(((double)pData[nIndex] * dScale) + dOffset);
+}
+
+template <typename TTarget, typename TSource> static void addScaledScalar(TTarget* pTarget, const TSource* pSource, size_t nCount, double dScale, double dOffset)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++)
+		pTarget[nIndex] = (TTarget)((double)pTarget[nIndex] + (((double)pSource[nIndex] * dScale) + dOffset));
+}
+
+template <typename TValue> static void clampScalar(TValue* pData, size_t nCount, double dMinValue, double dMaxValue)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		double dValue = pData[nIndex];
+		if (dValue < dMinValue)
+			pData[nIndex] = (TValue)dMinValue;
+		if (dValue > dMaxValue)
+			pData[nIndex] = (TValue)dMaxValue;
+	}
+}
+
+template <typename TSource> static void accumulateScalar(double* pSum, const TSource* pSource, size_t nCount)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++)
+		pSum[nIndex] += (double)pSource[nIndex];
+}
+
+// Rounds half away from zero like std::round. floor (y) + (y - floor (y) >= 0.5) is exact for all y in [0, 255],
+// which allows the vector kernels to reproduce it.
+static inline uint8_t colorToByte(double dColor)
+{
+	dColor = std::clamp(dColor, 0.0, 1.0);
+
+	double dScaled = dColor * 255.0;
+	double dRounded = floor(dScaled);
+	if ((dScaled - dRounded) >= 0.5)
+		dRounded += 1.0;
+
+	return (uint8_t)dRounded;
+}
+
+template <typename TValue> static void renderRGBScalar(const TValue* pData, uint8_t* pTarget, size_t nCount, const sDiscreteFieldColorScheme& colorScheme)
+{
+	double dDeltaMin = colorScheme.m_dMidValue - colorScheme.m_dMinValue;
+	double dDeltaMax = colorScheme.m_dMaxValue - colorScheme.m_dMidValue;
+
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		double dValue = pData[nIndex];
+
+		double dFactor = 0.0;
+		const double* pStartColor;
+		const double* pEndColor;
+
+		if (dValue < colorScheme.m_dMidValue) {
+			if (dDeltaMin > DISCRETEFIELD_MINVALUEDISTANCE)
+				dFactor = (dValue - colorScheme.m_dMinValue) / dDeltaMin;
+
+			pStartColor = colorScheme.m_MinColor;
+			pEndColor = colorScheme.m_MidColor;
+		}
+		else {
+			if (dDeltaMax > DISCRETEFIELD_MINVALUEDISTANCE)
+				dFactor = (dValue - colorScheme.m_dMidValue) / dDeltaMax;
+
+			pStartColor = colorScheme.m_MidColor;
+			pEndColor = colorScheme.m_MaxColor;
+		}
+
+		// NaN values are rendered with the start color
+		if (!(dFactor > 0.0))
+			dFactor = 0.0;
+		if (dFactor > 1.0)
+			dFactor = 1.0;
+
+		for (uint32_t nChannel = 0; nChannel < 3; nChannel++)
+			pTarget[nChannel] = colorToByte(pStartColor[nChannel] * (1.0 - dFactor) + pEndColor[nChannel] * dFactor);
+
+		pTarget += 3;
+	}
+}
+
+
+/*************************************************************************************************************************
+ AVX2 kernels
+**************************************************************************************************************************/
+
+#ifdef DISCRETEFIELDKERNELS_X86
+
+DISCRETEFIELDKERNELS_TARGET_AVX2 static inline __m256d loadValuesAVX2(const double* pSource)
+{
+	return _mm256_loadu_pd(pSource);
+}
+
+DISCRETEFIELDKERNELS_TARGET_AVX2 static inline __m256d loadValuesAVX2(const float* pSource)
+{
+	return _mm256_cvtps_pd(_mm_loadu_ps(pSource));
+}
+
+DISCRETEFIELDKERNELS_TARGET_AVX2 static inline void storeValuesAVX2(double* pTarget, __m256d values)
+{
+	_mm256_storeu_pd(pTarget, values);
+}
+
+DISCRETEFIELDKERNELS_TARGET_AVX2 static inline void storeValuesAVX2(float* pTarget, __m256d values)
+{
+	_mm_storeu_ps(pTarget, _mm256_cvtpd_ps(values));
+}
+
+// Multiplications and additions are kept separate, so that no fused multiply add changes the rounding.
+template <typename TValue> DISCRETEFIELDKERNELS_TARGET_AVX2 static void transformAVX2(TValue* pData, size_t nCount, double dScale, double dOffset)
+{
+	__m256d scale = _mm256_set1_pd(dScale);
+	__m256d offset = _mm256_set1_pd(dOffset);
+
+	size_t nIndex = 0;
+	for (; nIndex + 4 <= nCount; nIndex += 4) {
+		__m256d values = loadValuesAVX2(pData + nIndex);
+		storeValuesAVX2(pData + nIndex, _mm256_add_pd(_mm256_mul_pd(values, scale), offset));
+	}
+
+	transformScalar(pData + nIndex, nCount - nIndex, dScale, dOffset);
+}
+
+template <typename TTarget, typename TSource> DISCRETEFIELDKERNELS_TARGET_AVX2 static void addScaledAVX2(TTarget* pTarget, const TSource* pSource, size_t nCount, double dScale, double dOffset)
+{
+	__m256d scale = _mm256_set1_pd(dScale);
+	__m256d offset = _mm256_set1_pd(dOffset);
+
+	size_t nIndex = 0;
+	for (; nIndex + 4 <= nCount; nIndex += 4) {
+		__m256d targetValues = loadValuesAVX2(pTarget + nIndex);
+		__m256d sourceValues = loadValuesAVX2(pSource + nIndex);
+		storeValuesAVX2(pTarget + nIndex, _mm256_add_pd(targetValues, _mm256_add_pd(_mm256_mul_pd(sourceValues, scale), offset)));
+	}
+
+	addScaledScalar(pTarget + nIndex, pSource + nIndex, nCount - nIndex, dScale, dOffset);
+}
+
+// maxpd and minpd return their second operand if one of them is NaN, which keeps NaN values like the scalar kernel.
+template <typename TValue> DISCRETEFIELDKERNELS_TARGET_AVX2 static void clampAVX2(TValue* pData, size_t nCount, double dMinValue, double dMaxValue)
+{
+	__m256d minValue = _mm256_set1_pd(dMinValue);
+	__m256d maxValue = _mm256_set1_pd(dMaxValue);
+
+	size_t nIndex = 0;
+	for (; nIndex + 4 <= nCount; nIndex += 4) {
+		__m256d values = loadValuesAVX2(pData + nIndex);
+		storeValuesAVX2(pData + nIndex, _mm256_min_pd(maxValue, _mm256_max_pd(minValue, values)));
+	}
+
+	clampScalar(pData + nIndex, nCount - nIndex, dMinValue, dMaxValue);
+}
+
+template <typename TSource> DISCRETEFIELDKERNELS_TARGET_AVX2 static void accumulateAVX2(double* pSum, const TSource* pSource, size_t nCount)
+{
+	size_t nIndex = 0;
+	for (; nIndex + 4 <= nCount; nIndex += 4)
+		_mm256_storeu_pd(pSum + nIndex, _mm256_add_pd(_mm256_loadu_pd(pSum + nIndex), loadValuesAVX2(pSource + nIndex)));
+
+	accumulateScalar(pSum + nIndex, pSource + nIndex, nCount - nIndex);
+}
+
+DISCRETEFIELDKERNELS_TARGET_AVX2 static inline __m128i colorToByteAVX2(__m256d color)
+{
+	__m256d zero = _mm256_setzero_pd();
+	__m256d one = _mm256_set1_pd(1.0);
+
+	color = _mm256_min_pd(_mm256_max_pd(color, zero), one);
+
+	__m256d scaled = _mm256_mul_pd(color, _mm256_set1_pd(255.0));
+	__m256d rounded = _mm256_floor_pd(scaled);
+	__m256d roundUp = _mm256_cmp_pd(_mm256_sub_pd(scaled, rounded), _mm256_set1_pd(0.5), _CMP_GE_OQ);
+	rounded = _mm256_add_pd(rounded, _mm256_and_pd(roundUp, one));
+
+	return _mm256_cvttpd_epi32(rounded);
+}
+
+template <typename TValue> DISCRETEFIELDKERNELS_TARGET_AVX2 static void renderRGBAVX2(const TValue* pData, uint8_t* pTarget, size_t nCount, const sDiscreteFieldColorScheme& colorScheme)
+{
+	double dDeltaMin = colorScheme.m_dMidValue - colorScheme.m_dMinValue;
+	double dDeltaMax = colorScheme.m_dMaxValue - colorScheme.m_dMidValue;
+	bool bHasLowerRange = dDeltaMin > DISCRETEFIELD_MINVALUEDISTANCE;
+	bool bHasUpperRange = dDeltaMax > DISCRETEFIELD_MINVALUEDISTANCE;
+
+	__m256d zero = _mm256_setzero_pd();
+	__m256d one = _mm256_set1_pd(1.0);
+	__m256d minValue = _mm256_set1_pd(colorScheme.m_dMinValue);
+	__m256d midValue = _mm256_set1_pd(colorScheme.m_dMidValue);
+	__m256d deltaMin = _mm256_set1_pd(dDeltaMin);
+	__m256d deltaMax = _mm256_set1_pd(dDeltaMax);
+
+	__m256d minColor[3], midColor[3], maxColor[3];
+	for (uint32_t nChannel = 0; nChannel < 3; nChannel++) {
+		minColor[nChannel] = _mm256_set1_pd(colorScheme.m_MinColor[nChannel]);
+		midColor[nChannel] = _mm256_set1_pd(colorScheme.m_MidColor[nChannel]);
+		maxColor[nChannel] = _mm256_set1_pd(colorScheme.m_MaxColor[nChannel]);
+	}
+
+	// Bytes 0-3 hold red, 4-7 green and 8-11 blue of four pixels
+	__m128i interleaveMask = _mm_setr_epi8(0, 4, 8, 1, 5, 9, 2, 6, 10, 3, 7, 11, -1, -1, -1, -1);
+
+	size_t nIndex = 0;
+	for (; nIndex + 4 <= nCount; nIndex += 4) {
+		__m256d values = loadValuesAVX2(pData + nIndex);
+		__m256d isLower = _mm256_cmp_pd(values, midValue, _CMP_LT_OQ);
+
+		__m256d lowerFactor = bHasLowerRange ? _mm256_div_pd(_mm256_sub_pd(values, minValue), deltaMin) : zero;
+		__m256d upperFactor = bHasUpperRange ? _mm256_div_pd(_mm256_sub_pd(values, midValue), deltaMax) : zero;
+		__m256d factor = _mm256_blendv_pd(upperFactor, lowerFactor, isLower);
+		factor = _mm256_min_pd(_mm256_max_pd(factor, zero), one);
+		__m256d inverseFactor = _mm256_sub_pd(one, factor);
+
+		__m128i channels[3];
+		for (uint32_t nChannel = 0; nChannel < 3; nChannel++) {
+			__m256d startColor = _mm256_blendv_pd(midColor[nChannel], minColor[nChannel], isLower);
+			__m256d endColor = _mm256_blendv_pd(maxColor[nChannel], midColor[nChannel], isLower);
+			__m256d color = _mm256_add_pd(_mm256_mul_pd(startColor, inverseFactor), _mm256_mul_pd(endColor, factor));
+			channels[nChannel] = colorToByteAVX2(color);
+		}
+
+		__m128i packed = _mm_packus_epi16(_mm_packs_epi32(channels[0], channels[1]), _mm_packs_epi32(channels[2], _mm_setzero_si128()));
+		__m128i interleaved = _mm_shuffle_epi8(packed, interleaveMask);
+
+		_mm_storel_epi64((__m128i*)(pTarget + nIndex * 3), interleaved);
+		uint32_t nLastBytes = (uint32_t)_mm_extract_epi32(interleaved, 2);
+		memcpy(pTarget + nIndex * 3 + 8, &nLastBytes, 4);
+	}
+
+	renderRGBScalar(pData + nIndex, pTarget + nIndex * 3, nCount - nIndex, colorScheme);
+}
+
+static eDiscreteFieldKernelType detectKernelTypeX86()
+{
+#ifdef _MSC_VER
+	int cpuInfo[4];
+	__cpuid(cpuInfo, 0);
+	int nMaxFunctionID = cpuInfo[0];
+
+	__cpuid(cpuInfo, 1);
+	bool bHasOSXSave = (cpuInfo[2] & (1 << 27)) != 0;
+	bool bHasAVX = (cpuInfo[2] & (1 << 28)) != 0;
+
+	bool bHasAVX2 = false;
+	// AVX registers must also be saved by the operating system
+	if (bHasOSXSave && bHasAVX && (nMaxFunctionID >= 7)) {
+		if ((_xgetbv(0) & 0x6) == 0x6) {
+			__cpuidex(cpuInfo, 7, 0);
+			bHasAVX2 = (cpuInfo[1] & (1 << 5)) != 0;
+		}
+	}
+#else
+	__builtin_cpu_init();
+	bool bHasAVX2 = __builtin_cpu_supports("avx2");
+#endif
+
+	if (bHasAVX2)
+		return eDiscreteFieldKernelType::dfkAVX2;
+
+	return eDiscreteFieldKernelType::dfkScalar;
+}
+
+#endif // DISCRETEFIELDKERNELS_X86
+
+
+/*************************************************************************************************************************
+ Kernel dispatch
+**************************************************************************************************************************/
+
+#ifdef DISCRETEFIELDKERNELS_X86
+#define DISCRETEFIELDKERNELS_DISPATCH(KERNELTYPE, NAME, ...) \
+	if ((KERNELTYPE) == eDiscreteFieldKernelType::dfkAVX2) { \
+		NAME##AVX2(__VA_ARGS__); \
+		return; \
+	} \
+	NAME##Scalar(__VA_ARGS__);
+#else
+#define DISCRETEFIELDKERNELS_DISPATCH(KERNELTYPE, NAME, ...) \
+	NAME##Scalar(__VA_ARGS__);
+#endif
+
+eDiscreteFieldKernelType CDiscreteFieldKernels::detectKernelType()
+{
+#ifdef DISCRETEFIELDKERNELS_X86
+	static const eDiscreteFieldKernelType detectedKernelType = detectKernelTypeX86();
+	return detectedKernelType;
+#else
+	return eDiscreteFieldKernelType::dfkScalar;
+#endif
+}
+
+std::string CDiscreteFieldKernels::getKernelTypeName(eDiscreteFieldKernelType kernelType)
+{
+	switch (kernelType) {
+	case eDiscreteFieldKernelType::dfkAVX2: return "avx2";
+	default: return "scalar";
+	}
+}
+
+// Filling is memory bound, the compiler vectorises it for every kernel type.
+void CDiscreteFieldKernels::fill(eDiscreteFieldKernelType kernelType, double* pData, size_t nCount, double dValue)
+{
+	std::fill(pData, pData + nCount, dValue);
+}
+
+void CDiscreteFieldKernels::fill(eDiscreteFieldKernelType kernelType, float* pData, size_t nCount, double dValue)
+{
+	std::fill(pData, pData + nCount, (float)dValue);
+}
+
+void CDiscreteFieldKernels::transform(eDiscreteFieldKernelType kernelType, double* pData, size_t nCount, double dScale, double dOffset)
+{
+	DISCRETEFIELDKERNELS_DISPATCH(kernelType, transform, pData, nCount, dScale, dOffset);
+}
+
+void CDiscreteFieldKernels::transform(eDiscreteFieldKernelType kernelType, float* pData, size_t nCount, double dScale, double dOffset)
+{
+	DISCRETEFIELDKERNELS_DISPATCH(kernelType, transform, pData, nCount, dScale, dOffset);
+}
+
+void CDiscreteFieldKernels::addScaled(eDiscreteFieldKernelType kernelType, double* pTarget, const double* pSource, size_t nCount, double dScale, double dOffset)
+{
+	DISCRETEFIELDKERNELS_DISPATCH(kernelType, addScaled, pTarget, pSource, nCount, dScale, dOffset);
+}
+
+void CDiscreteFieldKernels::addScaled(eDiscreteFieldKernelType kernelType, float* pTarget, const float* pSource, size_t nCount, double dScale, double dOffset)
+{
+	DISCRETEFIELDKERNELS_DISPATCH(kernelType, addScaled, pTarget, pSource, nCount, dScale, dOffset);
+}
+
+void CDiscreteFieldKernels::addScaled(eDiscreteFieldKernelType kernelType, double* pTarget, const float* pSource, size_t nCount, double dScale, double dOffset)
+{
+	DISCRETEFIELDKERNELS_DISPATCH(kernelType, addScaled, pTarget, pSource, nCount, dScale, dOffset);
+}
+
+void CDiscreteFieldKernels::addScaled(eDiscreteFieldKernelType kernelType, float* pTarget, const double* pSource, size_t nCount, double dScale, double dOffset)
+{
+	DISCRETEFIELDKERNELS_DISPATCH(kernelType, addScaled, pTarget, pSource, nCount, dScale, dOffset);
+}
+
+void CDiscreteFieldKernels::clamp(eDiscreteFieldKernelType kernelType, double* pData, size_t nCount, double dMinValue, double dMaxValue)
+{
+	DISCRETEFIELDKERNELS_DISPATCH(kernelType, clamp, pData, nCount, dMinValue, dMaxValue);
+}
+
+void CDiscreteFieldKernels::clamp(eDiscreteFieldKernelType kernelType, float* pData, size_t nCount, double dMinValue, double dMaxValue)
+{
+	DISCRETEFIELDKERNELS_DISPATCH(kernelType, clamp, pData, nCount, dMinValue, dMaxValue);
+}
+
+void CDiscreteFieldKernels::accumulate(eDiscreteFieldKernelType kernelType, double* pSum, const double* pSource, size_t nCount)
+{
+	DISCRETEFIELDKERNELS_DISPATCH(kernelType, accumulate, pSum, pSource, nCount);
+}
+
+void CDiscreteFieldKernels::accumulate(eDiscreteFieldKernelType kernelType, double* pSum, const float* pSource, size_t nCount)
+{
+	DISCRETEFIELDKERNELS_DISPATCH(kernelType, accumulate, pSum, pSource, nCount);
+}
+
+void CDiscreteFieldKernels::renderRGB(eDiscreteFieldKernelType kernelType, const double* pData, uint8_t* pTarget, size_t nCount, const sDiscreteFieldColorScheme& colorScheme)
+{
+	DISCRETEFIELDKERNELS_DISPATCH(kernelType, renderRGB, pData, pTarget, nCount, colorScheme);
+}
+
+void CDiscreteFieldKernels::renderRGB(eDiscreteFieldKernelType kernelType, const float* pData, uint8_t* pTarget, size_t nCount, const sDiscreteFieldColorScheme& colorScheme)
+{
+	DISCRETEFIELDKERNELS_DISPATCH(kernelType, renderRGB, pData, pTarget, nCount, colorScheme);
+}
+
+void CDiscreteFieldKernels::processRows(uint32_t nThreadCount, size_t nRowCount, uint64_t nBytesPerRow, const std::function<void(size_t nFirstRow, size_t nRowCount)>& rowFunction)
+{
+	if (nRowCount == 0)
+		return;
+
+	if (nThreadCount == 0)
+		nThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+	nThreadCount = std::min(nThreadCount, (uint32_t)DISCRETEFIELDKERNELS_MAXTHREADCOUNT);
+
+	if ((uint64_t)nRowCount * nBytesPerRow < DISCRETEFIELDKERNELS_PARALLELBYTETHRESHOLD)
+		nThreadCount = 1;
+	nThreadCount = (uint32_t)std::min((size_t)nThreadCount, nRowCount / DISCRETEFIELDKERNELS_MINROWSPERTHREAD);
+
+	if (nThreadCount <= 1) {
+		rowFunction(0, nRowCount);
+		return;
+	}
+
+	AMCCommon::CParallelBlocks::processBlocks(nThreadCount, nRowCount, 1, [&rowFunction](uint32_t nBlockIndex, size_t nFirstRow, size_t nBlockRowCount) {
+		rowFunction(nFirstRow, nBlockRowCount);
+	});
+}
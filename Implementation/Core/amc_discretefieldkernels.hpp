@@ -0,0 +1,106 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMC_DISCRETEFIELDKERNELS
+#define __AMC_DISCRETEFIELDKERNELS
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <functional>
+
+// Operations that touch less memory than this are not worth spawning threads for.
+#define DISCRETEFIELDKERNELS_PARALLELBYTETHRESHOLD (4ULL * 1024ULL * 1024ULL)
+#define DISCRETEFIELDKERNELS_MINROWSPERTHREAD 16
+#define DISCRETEFIELDKERNELS_MAXTHREADCOUNT 64
+
+namespace AMC {
+
+	enum class eDiscreteFieldKernelType : int32_t {
+		dfkScalar = 0,
+		dfkAVX2 = 1
+	};
+
+	typedef struct _sDiscreteFieldColorScheme {
+		double m_dMinValue;
+		double m_dMidValue;
+		double m_dMaxValue;
+		double m_MinColor[3];
+		double m_MidColor[3];
+		double m_MaxColor[3];
+	} sDiscreteFieldColorScheme;
+
+	// Value kernels of CDiscreteFieldData2DInstance. Float values are computed in double precision and
+	// rounded once when they are stored. All kernel types return bit-identical results, the scalar
+	// kernels are the reference implementation.
+	class CDiscreteFieldKernels {
+	public:
+
+		// Returns the fastest kernel type that is supported by the current CPU.
+		static eDiscreteFieldKernelType detectKernelType();
+
+		static std::string getKernelTypeName(eDiscreteFieldKernelType kernelType);
+
+		static void fill(eDiscreteFieldKernelType kernelType, double* pData, size_t nCount, double dValue);
+		static void fill(eDiscreteFieldKernelType kernelType, float* pData, size_t nCount, double dValue);
+
+		// Value is set to Value * dScale + dOffset.
+		static void transform(eDiscreteFieldKernelType kernelType, double* pData, size_t nCount, double dScale, double dOffset);
+		static void transform(eDiscreteFieldKernelType kernelType, float* pData, size_t nCount, double dScale, double dOffset);
+
+		// Target is set to Target + (Source * dScale + dOffset).
+		static void addScaled(eDiscreteFieldKernelType kernelType, double* pTarget, const double* pSource, size_t nCount, double dScale, double dOffset);
+		static void addScaled(eDiscreteFieldKernelType kernelType, float* pTarget, const float* pSource, size_t nCount, double dScale, double dOffset);
+		static void addScaled(eDiscreteFieldKernelType kernelType, double* pTarget, const float* pSource, size_t nCount, double dScale, double dOffset);
+		static void addScaled(eDiscreteFieldKernelType kernelType, float* pTarget, const double* pSource, size_t nCount, double dScale, double dOffset);
+
+		// Values below dMinValue are set to dMinValue, values above dMaxValue are set to dMaxValue. NaN values are kept.
+		static void clamp(eDiscreteFieldKernelType kernelType, double* pData, size_t nCount, double dMinValue, double dMaxValue);
+		static void clamp(eDiscreteFieldKernelType kernelType, float* pData, size_t nCount, double dMinValue, double dMaxValue);
+
+		// Adds each source value to the sum buffer.
+		static void accumulate(eDiscreteFieldKernelType kernelType, double* pSum, const double* pSource, size_t nCount);
+		static void accumulate(eDiscreteFieldKernelType kernelType, double* pSum, const float* pSource, size_t nCount);
+
+		// Converts nCount values into RGB24 pixels. The color scheme interpolates linearly between min, mid and max.
+		static void renderRGB(eDiscreteFieldKernelType kernelType, const double* pData, uint8_t* pTarget, size_t nCount, const sDiscreteFieldColorScheme& colorScheme);
+		static void renderRGB(eDiscreteFieldKernelType kernelType, const float* pData, uint8_t* pTarget, size_t nCount, const sDiscreteFieldColorScheme& colorScheme);
+
+		// Calls rowFunction for consecutive row ranges. Large fields are split across up to nThreadCount threads
+		// (0 uses the number of hardware threads), so rowFunction must only write to memory that belongs to its own rows.
+		static void processRows(uint32_t nThreadCount, size_t nRowCount, uint64_t nBytesPerRow, const std::function<void(size_t nFirstRow, size_t nRowCount)>& rowFunction);
+
+	};
+
+}
+
+
+#endif //__AMC_DISCRETEFIELDKERNELS
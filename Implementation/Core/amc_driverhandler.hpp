@@ -113,6 +113,8 @@ namespace AMC {
 		void releaseDriverLocks (const std::string& sInstanceName);
 
 		void setTempBasePath (const std::string& sTempBasePath);
+
+		std::string getTempBasePath ();
 				
 	};
 	
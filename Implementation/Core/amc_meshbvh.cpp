@@ -0,0 +1,764 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "amc_meshbvh.hpp"
+#include "common_parallelblocks.hpp"
+#include "libmc_exceptiontypes.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <thread>
+
+#define MESHBVH_RAYEPSILON 1E-12
+
+namespace AMC {
+
+	namespace {
+
+		typedef struct _sMeshBVHBuildEntry {
+			float m_fMin[3];
+			float m_fMax[3];
+			float m_fCentroid[3];
+			uint32_t m_nFaceIndex;
+		} sMeshBVHBuildEntry;
+
+		typedef struct _sMeshBVHBounds {
+			float m_fMin[3];
+			float m_fMax[3];
+		} sMeshBVHBounds;
+
+		void boundsReset(sMeshBVHBounds& bounds)
+		{
+			for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+				bounds.m_fMin[nAxis] = std::numeric_limits<float>::max();
+				bounds.m_fMax[nAxis] = -std::numeric_limits<float>::max();
+			}
+		}
+
+		void boundsAdd(sMeshBVHBounds& bounds, const float* pMin, const float* pMax)
+		{
+			for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+				bounds.m_fMin[nAxis] = std::min(bounds.m_fMin[nAxis], pMin[nAxis]);
+				bounds.m_fMax[nAxis] = std::max(bounds.m_fMax[nAxis], pMax[nAxis]);
+			}
+		}
+
+		double boundsArea(const sMeshBVHBounds& bounds)
+		{
+			double dX = (double)bounds.m_fMax[0] - (double)bounds.m_fMin[0];
+			double dY = (double)bounds.m_fMax[1] - (double)bounds.m_fMin[1];
+			double dZ = (double)bounds.m_fMax[2] - (double)bounds.m_fMin[2];
+			if ((dX < 0.0) || (dY < 0.0) || (dZ < 0.0))
+				return 0.0;
+
+			return 2.0 * (dX * dY + dY * dZ + dZ * dX);
+		}
+
+		uint32_t getBinIndex(float fCentroid, float fCentroidMin, double dBinScale)
+		{
+			double dBin = ((double)fCentroid - (double)fCentroidMin) * dBinScale;
+			if (dBin <= 0.0)
+				return 0;
+
+			return std::min((uint32_t)dBin, (uint32_t)(MESHBVH_BINCOUNT - 1));
+		}
+
+		class CMeshBVHBuilder {
+		private:
+
+			std::vector<sMeshBVHBuildEntry>& m_Entries;
+			uint32_t m_nParallelDepth;
+
+		public:
+
+			CMeshBVHBuilder(std::vector<sMeshBVHBuildEntry>& entries, uint32_t nParallelDepth)
+				: m_Entries(entries), m_nParallelDepth(nParallelDepth)
+			{
+			}
+
+			// Builds the subtree of the given entries in depth first order. Leaves refer to entry indices.
+			void buildSubtree(size_t nFirst, size_t nCount, uint32_t nDepth, std::vector<sMeshBVHNode>& nodes)
+			{
+				size_t nNodeIndex = nodes.size();
+				nodes.push_back(sMeshBVHNode());
+
+				sMeshBVHBounds bounds;
+				sMeshBVHBounds centroidBounds;
+				boundsReset(bounds);
+				boundsReset(centroidBounds);
+				for (size_t nIndex = nFirst; nIndex < nFirst + nCount; nIndex++) {
+					auto& entry = m_Entries[nIndex];
+					boundsAdd(bounds, entry.m_fMin, entry.m_fMax);
+					boundsAdd(centroidBounds, entry.m_fCentroid, entry.m_fCentroid);
+				}
+
+				for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+					nodes[nNodeIndex].m_fMin[nAxis] = bounds.m_fMin[nAxis];
+					nodes[nNodeIndex].m_fMax[nAxis] = bounds.m_fMax[nAxis];
+				}
+				nodes[nNodeIndex].m_nChildOrFirstTriangle = (uint32_t)nFirst;
+				nodes[nNodeIndex].m_nTriangleCount = (uint32_t)nCount;
+
+				if (nCount <= MESHBVH_MINLEAFSIZE)
+					return;
+
+				size_t nLeftCount = 0;
+				if (nDepth < MESHBVH_MAXSAHDEPTH) {
+					uint32_t nSplitAxis = 0;
+					uint32_t nSplitBin = 0;
+					double dSplitCost = std::numeric_limits<double>::max();
+
+					for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+						float fExtent = centroidBounds.m_fMax[nAxis] - centroidBounds.m_fMin[nAxis];
+						if (!(fExtent > 0.0f))
+							continue;
+
+						double dBinScale = (double)MESHBVH_BINCOUNT / (double)fExtent;
+
+						size_t binCounts[MESHBVH_BINCOUNT] = {};
+						sMeshBVHBounds binBounds[MESHBVH_BINCOUNT];
+						for (auto& binBound : binBounds)
+							boundsReset(binBound);
+
+						for (size_t nIndex = nFirst; nIndex < nFirst + nCount; nIndex++) {
+							auto& entry = m_Entries[nIndex];
+							uint32_t nBin = getBinIndex(entry.m_fCentroid[nAxis], centroidBounds.m_fMin[nAxis], dBinScale);
+							binCounts[nBin]++;
+							boundsAdd(binBounds[nBin], entry.m_fMin, entry.m_fMax);
+						}
+
+						// Costs of all splits behind bin 0 to MESHBVH_BINCOUNT - 2
+						double rightCosts[MESHBVH_BINCOUNT] = {};
+						sMeshBVHBounds rightBounds;
+						boundsReset(rightBounds);
+						size_t nRightCount = 0;
+						for (uint32_t nBin = MESHBVH_BINCOUNT - 1; nBin > 0; nBin--) {
+							boundsAdd(rightBounds, binBounds[nBin].m_fMin, binBounds[nBin].m_fMax);
+							nRightCount += binCounts[nBin];
+							rightCosts[nBin - 1] = boundsArea(rightBounds) * (double)nRightCount;
+						}
+
+						sMeshBVHBounds leftBounds;
+						boundsReset(leftBounds);
+						size_t nBinLeftCount = 0;
+						for (uint32_t nBin = 0; nBin < MESHBVH_BINCOUNT - 1; nBin++) {
+							boundsAdd(leftBounds, binBounds[nBin].m_fMin, binBounds[nBin].m_fMax);
+							nBinLeftCount += binCounts[nBin];
+							if ((nBinLeftCount == 0) || (nBinLeftCount == nCount))
+								continue;
+
+							double dCost = boundsArea(leftBounds) * (double)nBinLeftCount + rightCosts[nBin];
+							if (dCost < dSplitCost) {
+								dSplitCost = dCost;
+								nSplitAxis = nAxis;
+								nSplitBin = nBin;
+							}
+						}
+					}
+
+					if (dSplitCost < std::numeric_limits<double>::max()) {
+						// A leaf costs one intersection per face, a split one traversal step plus the expected intersections
+						double dNodeArea = boundsArea(bounds);
+						double dLeafCost = (double)nCount;
+						double dInnerCost = 1.0 + ((dNodeArea > 0.0) ? (dSplitCost / dNodeArea) : (double)nCount);
+						if ((dLeafCost <= dInnerCost) && (nCount <= MESHBVH_MAXLEAFSIZE))
+							return;
+
+						float fCentroidMin = centroidBounds.m_fMin[nSplitAxis];
+						double dBinScale = (double)MESHBVH_BINCOUNT / (double)(centroidBounds.m_fMax[nSplitAxis] - fCentroidMin);
+						auto iMiddle = std::partition(m_Entries.begin() + nFirst, m_Entries.begin() + nFirst + nCount, [nSplitAxis, nSplitBin, fCentroidMin, dBinScale](const sMeshBVHBuildEntry& entry) {
+							return getBinIndex(entry.m_fCentroid[nSplitAxis], fCentroidMin, dBinScale) <= nSplitBin;
+						});
+						nLeftCount = (size_t)(iMiddle - (m_Entries.begin() + nFirst));
+					}
+				}
+
+				if (nLeftCount == 0) {
+					// All centroids coincide or the tree is too deep: split at the median of the largest extent.
+					uint32_t nMedianAxis = 0;
+					for (uint32_t nAxis = 1; nAxis < 3; nAxis++) {
+						if ((centroidBounds.m_fMax[nAxis] - centroidBounds.m_fMin[nAxis]) > (centroidBounds.m_fMax[nMedianAxis] - centroidBounds.m_fMin[nMedianAxis]))
+							nMedianAxis = nAxis;
+					}
+
+					nLeftCount = nCount / 2;
+					std::nth_element(m_Entries.begin() + nFirst, m_Entries.begin() + nFirst + nLeftCount, m_Entries.begin() + nFirst + nCount, [nMedianAxis](const sMeshBVHBuildEntry& entry1, const sMeshBVHBuildEntry& entry2) {
+						if (entry1.m_fCentroid[nMedianAxis] != entry2.m_fCentroid[nMedianAxis])
+							return entry1.m_fCentroid[nMedianAxis] < entry2.m_fCentroid[nMedianAxis];
+						return entry1.m_nFaceIndex < entry2.m_nFaceIndex;
+					});
+				}
+
+				nodes[nNodeIndex].m_nTriangleCount = 0;
+				size_t nRightFirst = nFirst + nLeftCount;
+				size_t nRightCount = nCount - nLeftCount;
+
+				if ((nDepth < m_nParallelDepth) && (nCount >= MESHBVH_MINPARALLELFACECOUNT)) {
+					// The second subtree is built on a separate thread into its own node list, which is appended afterwards.
+					// The node order is the same as for a serial build.
+					std::vector<sMeshBVHNode> rightNodes;
+					std::exception_ptr pRightException;
+					std::thread rightThread([this, nRightFirst, nRightCount, nDepth, &rightNodes, &pRightException]() {
+						try {
+							buildSubtree(nRightFirst, nRightCount, nDepth + 1, rightNodes);
+						}
+						catch (...) {
+							pRightException = std::current_exception();
+						}
+					});
+
+					try {
+						buildSubtree(nFirst, nLeftCount, nDepth + 1, nodes);
+					}
+					catch (...) {
+						rightThread.join();
+						throw;
+					}
+					rightThread.join();
+
+					if (pRightException)
+						std::rethrow_exception(pRightException);
+
+					size_t nRightOffset = nodes.size();
+					nodes[nNodeIndex].m_nChildOrFirstTriangle = (uint32_t)nRightOffset;
+					for (auto& rightNode : rightNodes) {
+						if (rightNode.m_nTriangleCount == 0)
+							rightNode.m_nChildOrFirstTriangle += (uint32_t)nRightOffset;
+						nodes.push_back(rightNode);
+					}
+				}
+				else {
+					buildSubtree(nFirst, nLeftCount, nDepth + 1, nodes);
+					nodes[nNodeIndex].m_nChildOrFirstTriangle = (uint32_t)nodes.size();
+					buildSubtree(nRightFirst, nRightCount, nDepth + 1, nodes);
+				}
+			}
+
+		};
+
+		// Distance of the ray origin to the box along the ray, or infinity if the ray misses the box within dMaxDistance.
+		double rayBoxDistance(const sMeshBVHNode& node, const double* pOrigin, const double* pDirection, const double* pInverseDirection, double dMaxDistance)
+		{
+			double dNear = 0.0;
+			double dFar = dMaxDistance;
+
+			for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+				if (pDirection[nAxis] == 0.0) {
+					if ((pOrigin[nAxis] < node.m_fMin[nAxis]) || (pOrigin[nAxis] > node.m_fMax[nAxis]))
+						return std::numeric_limits<double>::infinity();
+				}
+				else {
+					double dT1 = ((double)node.m_fMin[nAxis] - pOrigin[nAxis]) * pInverseDirection[nAxis];
+					double dT2 = ((double)node.m_fMax[nAxis] - pOrigin[nAxis]) * pInverseDirection[nAxis];
+					if (dT1 > dT2)
+						std::swap(dT1, dT2);
+
+					dNear = std::max(dNear, dT1);
+					dFar = std::min(dFar, dT2);
+					if (dNear > dFar)
+						return std::numeric_limits<double>::infinity();
+				}
+			}
+
+			return dNear;
+		}
+
+		// Moeller-Trumbore intersection. Returns the distance along the ray or a negative value.
+		double rayTriangleDistance(const sMeshBVHTriangle& triangle, const double* pOrigin, const double* pDirection)
+		{
+			double vA[3], vEdge1[3], vEdge2[3];
+			for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+				vA[nAxis] = triangle.m_fVertices[0][nAxis];
+				vEdge1[nAxis] = (double)triangle.m_fVertices[1][nAxis] - vA[nAxis];
+				vEdge2[nAxis] = (double)triangle.m_fVertices[2][nAxis] - vA[nAxis];
+			}
+
+			double vP[3] = {
+				pDirection[1] * vEdge2[2] - pDirection[2] * vEdge2[1],
+				pDirection[2] * vEdge2[0] - pDirection[0] * vEdge2[2],
+				pDirection[0] * vEdge2[1] - pDirection[1] * vEdge2[0]
+			};
+
+			double dDeterminant = vEdge1[0] * vP[0] + vEdge1[1] * vP[1] + vEdge1[2] * vP[2];
+			if (std::fabs(dDeterminant) < MESHBVH_RAYEPSILON)
+				return -1.0;
+
+			double dInverseDeterminant = 1.0 / dDeterminant;
+			double vT[3] = { pOrigin[0] - vA[0], pOrigin[1] - vA[1], pOrigin[2] - vA[2] };
+
+			double dU = (vT[0] * vP[0] + vT[1] * vP[1] + vT[2] * vP[2]) * dInverseDeterminant;
+			if ((dU < 0.0) || (dU > 1.0))
+				return -1.0;
+
+			double vQ[3] = {
+				vT[1] * vEdge1[2] - vT[2] * vEdge1[1],
+				vT[2] * vEdge1[0] - vT[0] * vEdge1[2],
+				vT[0] * vEdge1[1] - vT[1] * vEdge1[0]
+			};
+
+			double dV = (pDirection[0] * vQ[0] + pDirection[1] * vQ[1] + pDirection[2] * vQ[2]) * dInverseDeterminant;
+			if ((dV < 0.0) || (dU + dV > 1.0))
+				return -1.0;
+
+			return (vEdge2[0] * vQ[0] + vEdge2[1] * vQ[1] + vEdge2[2] * vQ[2]) * dInverseDeterminant;
+		}
+
+		bool boxOverlapsNode(const sMeshBVHNode& node, const double* pMin, const double* pMax)
+		{
+			for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+				if ((node.m_fMax[nAxis] < pMin[nAxis]) || (node.m_fMin[nAxis] > pMax[nAxis]))
+					return false;
+			}
+			return true;
+		}
+
+		// Separating axis test of a triangle against a box (Akenine-Moeller).
+		bool boxOverlapsTriangle(const sMeshBVHTriangle& triangle, const double* pCenter, const double* pHalfSize)
+		{
+			double vVertices[3][3];
+			for (uint32_t nVertex = 0; nVertex < 3; nVertex++)
+				for (uint32_t nAxis = 0; nAxis < 3; nAxis++)
+					vVertices[nVertex][nAxis] = (double)triangle.m_fVertices[nVertex][nAxis] - pCenter[nAxis];
+
+			// Box face normals
+			for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+				double dMin = std::min({ vVertices[0][nAxis], vVertices[1][nAxis], vVertices[2][nAxis] });
+				double dMax = std::max({ vVertices[0][nAxis], vVertices[1][nAxis], vVertices[2][nAxis] });
+				if ((dMin > pHalfSize[nAxis]) || (dMax < -pHalfSize[nAxis]))
+					return false;
+			}
+
+			double vEdges[3][3];
+			for (uint32_t nEdge = 0; nEdge < 3; nEdge++)
+				for (uint32_t nAxis = 0; nAxis < 3; nAxis++)
+					vEdges[nEdge][nAxis] = vVertices[(nEdge + 1) % 3][nAxis] - vVertices[nEdge][nAxis];
+
+			// Triangle normal
+			double vNormal[3] = {
+				vEdges[0][1] * vEdges[1][2] - vEdges[0][2] * vEdges[1][1],
+				vEdges[0][2] * vEdges[1][0] - vEdges[0][0] * vEdges[1][2],
+				vEdges[0][0] * vEdges[1][1] - vEdges[0][1] * vEdges[1][0]
+			};
+			double dPlaneDistance = vNormal[0] * vVertices[0][0] + vNormal[1] * vVertices[0][1] + vNormal[2] * vVertices[0][2];
+			double dPlaneRadius = pHalfSize[0] * std::fabs(vNormal[0]) + pHalfSize[1] * std::fabs(vNormal[1]) + pHalfSize[2] * std::fabs(vNormal[2]);
+			if (std::fabs(dPlaneDistance) > dPlaneRadius)
+				return false;
+
+			// Cross products of the edges with the box axes
+			for (uint32_t nEdge = 0; nEdge < 3; nEdge++) {
+				for (uint32_t nBoxAxis = 0; nBoxAxis < 3; nBoxAxis++) {
+					double vAxis[3] = { 0.0, 0.0, 0.0 };
+					uint32_t nAxis1 = (nBoxAxis + 1) % 3;
+					uint32_t nAxis2 = (nBoxAxis + 2) % 3;
+					vAxis[nAxis1] = -vEdges[nEdge][nAxis2];
+					vAxis[nAxis2] = vEdges[nEdge][nAxis1];
+
+					double dP0 = vAxis[0] * vVertices[0][0] + vAxis[1] * vVertices[0][1] + vAxis[2] * vVertices[0][2];
+					double dP1 = vAxis[0] * vVertices[1][0] + vAxis[1] * vVertices[1][1] + vAxis[2] * vVertices[1][2];
+					double dP2 = vAxis[0] * vVertices[2][0] + vAxis[1] * vVertices[2][1] + vAxis[2] * vVertices[2][2];
+					double dRadius = pHalfSize[0] * std::fabs(vAxis[0]) + pHalfSize[1] * std::fabs(vAxis[1]) + pHalfSize[2] * std::fabs(vAxis[2]);
+
+					if ((std::min({ dP0, dP1, dP2 }) > dRadius) || (std::max({ dP0, dP1, dP2 }) < -dRadius))
+						return false;
+				}
+			}
+
+			return true;
+		}
+
+		double pointBoxDistanceSquared(const sMeshBVHNode& node, const double* pPoint)
+		{
+			double dDistanceSquared = 0.0;
+			for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+				double dDelta = 0.0;
+				if (pPoint[nAxis] < node.m_fMin[nAxis])
+					dDelta = (double)node.m_fMin[nAxis] - pPoint[nAxis];
+				else if (pPoint[nAxis] > node.m_fMax[nAxis])
+					dDelta = pPoint[nAxis] - (double)node.m_fMax[nAxis];
+				dDistanceSquared += dDelta * dDelta;
+			}
+			return dDistanceSquared;
+		}
+
+		double dot3(const double* pVec1, const double* pVec2)
+		{
+			return pVec1[0] * pVec2[0] + pVec1[1] * pVec2[1] + pVec1[2] * pVec2[2];
+		}
+
+		// Closest point on a triangle by its Voronoi regions (Ericson, Real-Time Collision Detection).
+		void closestPointOnTriangle(const sMeshBVHTriangle& triangle, const double* pPoint, double* pResult)
+		{
+			double vA[3], vB[3], vC[3];
+			for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+				vA[nAxis] = triangle.m_fVertices[0][nAxis];
+				vB[nAxis] = triangle.m_fVertices[1][nAxis];
+				vC[nAxis] = triangle.m_fVertices[2][nAxis];
+			}
+
+			auto setResult = [pResult](const double* pBase, const double* pDir1, double dFactor1, const double* pDir2, double dFactor2) {
+				for (uint32_t nAxis = 0; nAxis < 3; nAxis++)
+					pResult[nAxis] = pBase[nAxis] + pDir1[nAxis] * dFactor1 + pDir2[nAxis] * dFactor2;
+			};
+
+			double vAB[3], vAC[3], vAP[3], vBP[3], vCP[3], vBC[3];
+			for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+				vAB[nAxis] = vB[nAxis] - vA[nAxis];
+				vAC[nAxis] = vC[nAxis] - vA[nAxis];
+				vAP[nAxis] = pPoint[nAxis] - vA[nAxis];
+				vBP[nAxis] = pPoint[nAxis] - vB[nAxis];
+				vCP[nAxis] = pPoint[nAxis] - vC[nAxis];
+				vBC[nAxis] = vC[nAxis] - vB[nAxis];
+			}
+
+			double dD1 = dot3(vAB, vAP);
+			double dD2 = dot3(vAC, vAP);
+			if ((dD1 <= 0.0) && (dD2 <= 0.0)) {
+				setResult(vA, vAB, 0.0, vAC, 0.0);
+				return;
+			}
+
+			double dD3 = dot3(vAB, vBP);
+			double dD4 = dot3(vAC, vBP);
+			if ((dD3 >= 0.0) && (dD4 <= dD3)) {
+				setResult(vB, vAB, 0.0, vAC, 0.0);
+				return;
+			}
+
+			double dVC = dD1 * dD4 - dD3 * dD2;
+			if ((dVC <= 0.0) && (dD1 >= 0.0) && (dD3 <= 0.0)) {
+				setResult(vA, vAB, dD1 / (dD1 - dD3), vAC, 0.0);
+				return;
+			}
+
+			double dD5 = dot3(vAB, vCP);
+			double dD6 = dot3(vAC, vCP);
+			if ((dD6 >= 0.0) && (dD5 <= dD6)) {
+				setResult(vC, vAB, 0.0, vAC, 0.0);
+				return;
+			}
+
+			double dVB = dD5 * dD2 - dD1 * dD6;
+			if ((dVB <= 0.0) && (dD2 >= 0.0) && (dD6 <= 0.0)) {
+				setResult(vA, vAB, 0.0, vAC, dD2 / (dD2 - dD6));
+				return;
+			}
+
+			double dVA = dD3 * dD6 - dD5 * dD4;
+			if ((dVA <= 0.0) && ((dD4 - dD3) >= 0.0) && ((dD5 - dD6) >= 0.0)) {
+				setResult(vB, vBC, (dD4 - dD3) / ((dD4 - dD3) + (dD5 - dD6)), vAC, 0.0);
+				return;
+			}
+
+			double dDenominator = dVA + dVB + dVC;
+			if (dDenominator == 0.0) {
+				// Degenerate triangle that did not hit any of the vertex or edge regions
+				setResult(vA, vAB, 0.0, vAC, 0.0);
+				return;
+			}
+
+			setResult(vA, vAB, dVB / dDenominator, vAC, dVC / dDenominator);
+		}
+
+	}
+
+	CMeshBVH::CMeshBVH(CMeshEntity* pMeshEntity, uint32_t nThreadCount)
+	{
+		if (pMeshEntity == nullptr)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+		size_t nFaceCount = pMeshEntity->getFaceCount();
+		if (nFaceCount == 0)
+			return;
+
+		std::vector<sMeshBVHBuildEntry> entries(nFaceCount);
+		AMCCommon::CParallelBlocks::processBlocks(nThreadCount, nFaceCount, MESHBVH_MINFACESPERTHREAD, [&](size_t nBlockIndex, size_t nFirstFace, size_t nBlockFaceCount) {
+			for (size_t nFaceIndex = nFirstFace; nFaceIndex < nFirstFace + nBlockFaceCount; nFaceIndex++) {
+				auto& face = pMeshEntity->getFace(nFaceIndex + 1);
+				auto& entry = entries[nFaceIndex];
+				entry.m_nFaceIndex = (uint32_t)nFaceIndex;
+
+				for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+					entry.m_fMin[nAxis] = std::numeric_limits<float>::max();
+					entry.m_fMax[nAxis] = -std::numeric_limits<float>::max();
+				}
+
+				for (uint32_t nCorner = 0; nCorner < 3; nCorner++) {
+					auto& node = pMeshEntity->getNode(face.m_nNodeIDs[nCorner]);
+					for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+						entry.m_fMin[nAxis] = std::min(entry.m_fMin[nAxis], node.m_fCoordinates[nAxis]);
+						entry.m_fMax[nAxis] = std::max(entry.m_fMax[nAxis], node.m_fCoordinates[nAxis]);
+					}
+				}
+
+				for (uint32_t nAxis = 0; nAxis < 3; nAxis++)
+					entry.m_fCentroid[nAxis] = (float)(0.5 * ((double)entry.m_fMin[nAxis] + (double)entry.m_fMax[nAxis]));
+			}
+		});
+
+		// Every level below the parallel depth doubles the number of threads
+		if (nThreadCount == 0)
+			nThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+		nThreadCount = std::min(nThreadCount, (uint32_t)MESHBVH_MAXTHREADCOUNT);
+		uint32_t nParallelDepth = 0;
+		while ((1u << nParallelDepth) < nThreadCount)
+			nParallelDepth++;
+
+		CMeshBVHBuilder builder(entries, nParallelDepth);
+		m_Nodes.reserve(nFaceCount);
+		builder.buildSubtree(0, nFaceCount, 0, m_Nodes);
+		m_Nodes.shrink_to_fit();
+
+		m_Triangles.resize(nFaceCount);
+		AMCCommon::CParallelBlocks::processBlocks(nThreadCount, nFaceCount, MESHBVH_MINFACESPERTHREAD, [&](size_t nBlockIndex, size_t nFirstEntry, size_t nBlockEntryCount) {
+			for (size_t nEntryIndex = nFirstEntry; nEntryIndex < nFirstEntry + nBlockEntryCount; nEntryIndex++) {
+				uint32_t nFaceID = entries[nEntryIndex].m_nFaceIndex + 1;
+				auto& face = pMeshEntity->getFace(nFaceID);
+				auto& triangle = m_Triangles[nEntryIndex];
+				triangle.m_nFaceID = nFaceID;
+
+				for (uint32_t nCorner = 0; nCorner < 3; nCorner++) {
+					auto& node = pMeshEntity->getNode(face.m_nNodeIDs[nCorner]);
+					for (uint32_t nAxis = 0; nAxis < 3; nAxis++)
+						triangle.m_fVertices[nCorner][nAxis] = node.m_fCoordinates[nAxis];
+				}
+			}
+		});
+	}
+
+	CMeshBVH::~CMeshBVH()
+	{
+
+	}
+
+	size_t CMeshBVH::getNodeCount()
+	{
+		return m_Nodes.size();
+	}
+
+	size_t CMeshBVH::getTriangleCount()
+	{
+		return m_Triangles.size();
+	}
+
+	size_t CMeshBVH::getMemoryUsage()
+	{
+		return m_Nodes.capacity() * sizeof(sMeshBVHNode) + m_Triangles.capacity() * sizeof(sMeshBVHTriangle);
+	}
+
+	bool CMeshBVH::castRay(const double* pOrigin, const double* pDirection, uint32_t& nFaceID, double& dDistance)
+	{
+		if ((pOrigin == nullptr) || (pDirection == nullptr))
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+		nFaceID = 0;
+		dDistance = 0.0;
+
+		double dLength = std::sqrt(dot3(pDirection, pDirection));
+		if (!(dLength > 0.0) || !std::isfinite(dLength))
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+		double vDirection[3];
+		double vInverseDirection[3];
+		for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+			vDirection[nAxis] = pDirection[nAxis] / dLength;
+			vInverseDirection[nAxis] = (vDirection[nAxis] != 0.0) ? (1.0 / vDirection[nAxis]) : 0.0;
+		}
+
+		if (m_Nodes.empty())
+			return false;
+
+		double dBestDistance = std::numeric_limits<double>::infinity();
+		uint32_t nBestFaceID = 0;
+
+		std::vector<uint32_t> nodeStack;
+		nodeStack.reserve(64);
+		if (std::isfinite(rayBoxDistance(m_Nodes[0], pOrigin, vDirection, vInverseDirection, dBestDistance)))
+			nodeStack.push_back(0);
+
+		while (!nodeStack.empty()) {
+			auto& node = m_Nodes[nodeStack.back()];
+			uint32_t nNodeIndex = nodeStack.back();
+			nodeStack.pop_back();
+
+			// The node might be farther away than a hit that has been found after it was pushed
+			if (!std::isfinite(rayBoxDistance(node, pOrigin, vDirection, vInverseDirection, dBestDistance)))
+				continue;
+
+			if (node.m_nTriangleCount > 0) {
+				for (uint32_t nIndex = node.m_nChildOrFirstTriangle; nIndex < node.m_nChildOrFirstTriangle + node.m_nTriangleCount; nIndex++) {
+					auto& triangle = m_Triangles[nIndex];
+					double dTriangleDistance = rayTriangleDistance(triangle, pOrigin, vDirection);
+					if ((dTriangleDistance >= 0.0) && ((dTriangleDistance < dBestDistance) || ((dTriangleDistance == dBestDistance) && (triangle.m_nFaceID < nBestFaceID)))) {
+						dBestDistance = dTriangleDistance;
+						nBestFaceID = triangle.m_nFaceID;
+					}
+				}
+			}
+			else {
+				uint32_t nChild1 = nNodeIndex + 1;
+				uint32_t nChild2 = node.m_nChildOrFirstTriangle;
+				double dDistance1 = rayBoxDistance(m_Nodes[nChild1], pOrigin, vDirection, vInverseDirection, dBestDistance);
+				double dDistance2 = rayBoxDistance(m_Nodes[nChild2], pOrigin, vDirection, vInverseDirection, dBestDistance);
+
+				// The nearer child is processed first
+				if (dDistance1 > dDistance2) {
+					std::swap(dDistance1, dDistance2);
+					std::swap(nChild1, nChild2);
+				}
+				if (std::isfinite(dDistance2))
+					nodeStack.push_back(nChild2);
+				if (std::isfinite(dDistance1))
+					nodeStack.push_back(nChild1);
+			}
+		}
+
+		if (nBestFaceID == 0)
+			return false;
+
+		nFaceID = nBestFaceID;
+		dDistance = dBestDistance;
+		return true;
+	}
+
+	void CMeshBVH::findFacesInBox(const double* pMin, const double* pMax, std::vector<uint32_t>& faceIDs)
+	{
+		if ((pMin == nullptr) || (pMax == nullptr))
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+		faceIDs.clear();
+		if (m_Nodes.empty())
+			return;
+
+		double vCenter[3];
+		double vHalfSize[3];
+		for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+			vCenter[nAxis] = 0.5 * (pMin[nAxis] + pMax[nAxis]);
+			vHalfSize[nAxis] = 0.5 * (pMax[nAxis] - pMin[nAxis]);
+		}
+
+		std::vector<uint32_t> nodeStack;
+		nodeStack.reserve(64);
+		nodeStack.push_back(0);
+
+		while (!nodeStack.empty()) {
+			uint32_t nNodeIndex = nodeStack.back();
+			auto& node = m_Nodes[nNodeIndex];
+			nodeStack.pop_back();
+
+			if (!boxOverlapsNode(node, pMin, pMax))
+				continue;
+
+			if (node.m_nTriangleCount > 0) {
+				for (uint32_t nIndex = node.m_nChildOrFirstTriangle; nIndex < node.m_nChildOrFirstTriangle + node.m_nTriangleCount; nIndex++) {
+					auto& triangle = m_Triangles[nIndex];
+					if (boxOverlapsTriangle(triangle, vCenter, vHalfSize))
+						faceIDs.push_back(triangle.m_nFaceID);
+				}
+			}
+			else {
+				nodeStack.push_back(node.m_nChildOrFirstTriangle);
+				nodeStack.push_back(nNodeIndex + 1);
+			}
+		}
+
+		std::sort(faceIDs.begin(), faceIDs.end());
+	}
+
+	bool CMeshBVH::findClosestPoint(const double* pPoint, uint32_t& nFaceID, double* pClosestPoint, double& dDistance)
+	{
+		if ((pPoint == nullptr) || (pClosestPoint == nullptr))
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+		nFaceID = 0;
+		dDistance = 0.0;
+		for (uint32_t nAxis = 0; nAxis < 3; nAxis++)
+			pClosestPoint[nAxis] = 0.0;
+
+		if (m_Nodes.empty())
+			return false;
+
+		double dBestDistanceSquared = std::numeric_limits<double>::infinity();
+		uint32_t nBestFaceID = 0;
+
+		std::vector<uint32_t> nodeStack;
+		nodeStack.reserve(64);
+		nodeStack.push_back(0);
+
+		while (!nodeStack.empty()) {
+			uint32_t nNodeIndex = nodeStack.back();
+			auto& node = m_Nodes[nNodeIndex];
+			nodeStack.pop_back();
+
+			if (pointBoxDistanceSquared(node, pPoint) > dBestDistanceSquared)
+				continue;
+
+			if (node.m_nTriangleCount > 0) {
+				for (uint32_t nIndex = node.m_nChildOrFirstTriangle; nIndex < node.m_nChildOrFirstTriangle + node.m_nTriangleCount; nIndex++) {
+					auto& triangle = m_Triangles[nIndex];
+
+					double vCandidate[3];
+					closestPointOnTriangle(triangle, pPoint, vCandidate);
+					double vDelta[3] = { vCandidate[0] - pPoint[0], vCandidate[1] - pPoint[1], vCandidate[2] - pPoint[2] };
+					double dDistanceSquared = dot3(vDelta, vDelta);
+
+					if ((dDistanceSquared < dBestDistanceSquared) || ((dDistanceSquared == dBestDistanceSquared) && (triangle.m_nFaceID < nBestFaceID))) {
+						dBestDistanceSquared = dDistanceSquared;
+						nBestFaceID = triangle.m_nFaceID;
+						for (uint32_t nAxis = 0; nAxis < 3; nAxis++)
+							pClosestPoint[nAxis] = vCandidate[nAxis];
+					}
+				}
+			}
+			else {
+				uint32_t nChild1 = nNodeIndex + 1;
+				uint32_t nChild2 = node.m_nChildOrFirstTriangle;
+				double dDistance1 = pointBoxDistanceSquared(m_Nodes[nChild1], pPoint);
+				double dDistance2 = pointBoxDistanceSquared(m_Nodes[nChild2], pPoint);
+
+				// The nearer child is processed first
+				if (dDistance1 > dDistance2) {
+					std::swap(dDistance1, dDistance2);
+					std::swap(nChild1, nChild2);
+				}
+				if (dDistance2 <= dBestDistanceSquared)
+					nodeStack.push_back(nChild2);
+				if (dDistance1 <= dBestDistanceSquared)
+					nodeStack.push_back(nChild1);
+			}
+		}
+
+		nFaceID = nBestFaceID;
+		dDistance = std::sqrt(dBestDistanceSquared);
+		return true;
+	}
+
+}
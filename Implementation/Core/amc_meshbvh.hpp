@@ -0,0 +1,112 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMC_MESHBVH
+#define __AMC_MESHBVH
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "amc_meshentity.hpp"
+
+#define MESHBVH_BINCOUNT 16
+// Nodes with at most this many faces always become leaves.
+#define MESHBVH_MINLEAFSIZE 2
+// Nodes with more faces are always split, even if the surface area heuristic prefers a leaf.
+#define MESHBVH_MAXLEAFSIZE 16
+// Below this depth, subtrees are split at the median, which bounds the depth for degenerate face distributions.
+#define MESHBVH_MAXSAHDEPTH 48
+// Subtrees with fewer faces are not worth spawning a thread for.
+#define MESHBVH_MINPARALLELFACECOUNT (16 * 1024)
+#define MESHBVH_MAXTHREADCOUNT 64
+// Faces per block when the face bounds and the triangle table are filled in parallel.
+#define MESHBVH_MINFACESPERTHREAD (64 * 1024)
+
+namespace AMC {
+
+	typedef struct _sMeshBVHNode {
+		float m_fMin[3];
+		float m_fMax[3];
+		// Inner nodes: index of the second child, the first child directly follows the node.
+		// Leaves: index of the first triangle.
+		uint32_t m_nChildOrFirstTriangle;
+		// 0 for inner nodes
+		uint32_t m_nTriangleCount;
+	} sMeshBVHNode;
+
+	typedef struct _sMeshBVHTriangle {
+		float m_fVertices[3][3];
+		uint32_t m_nFaceID;
+	} sMeshBVHTriangle;
+
+	class CMeshBVH;
+	typedef std::shared_ptr<CMeshBVH> PMeshBVH;
+
+	// Bounding volume hierarchy of the faces of a mesh entity, built with a binned surface area heuristic.
+	// The hierarchy keeps its own copy of the triangles in leaf order, so it does not depend on the entity
+	// after it has been built. All queries are read only and may run concurrently.
+	class CMeshBVH {
+	private:
+
+		std::vector<sMeshBVHNode> m_Nodes;
+		std::vector<sMeshBVHTriangle> m_Triangles;
+
+	public:
+
+		// A thread count of 0 uses all hardware threads.
+		CMeshBVH(CMeshEntity* pMeshEntity, uint32_t nThreadCount);
+
+		virtual ~CMeshBVH();
+
+		size_t getNodeCount();
+
+		size_t getTriangleCount();
+
+		size_t getMemoryUsage();
+
+		// Returns the nearest triangle hit by the ray. The direction does not need to be normalized, but must not be zero.
+		// The distance is measured along the normalized direction.
+		bool castRay(const double* pOrigin, const double* pDirection, uint32_t& nFaceID, double& dDistance);
+
+		// Returns the IDs of all faces that intersect the box or touch its boundary, in ascending order.
+		void findFacesInBox(const double* pMin, const double* pMax, std::vector<uint32_t>& faceIDs);
+
+		// Returns the point on the mesh surface closest to the given point. Returns false if the mesh has no faces.
+		bool findClosestPoint(const double* pPoint, uint32_t& nFaceID, double* pClosestPoint, double& dDistance);
+
+	};
+
+}
+
+
+#endif //__AMC_MESHBVH
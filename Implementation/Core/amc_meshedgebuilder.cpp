@@ -0,0 +1,216 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "amc_meshedgebuilder.hpp"
+#include "amc_geometryutils.hpp"
+#include "common_parallelblocks.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#define MESHEDGEBUILDER_ZEROEPSILON 1E-6
+
+namespace AMC {
+
+	sMeshVector3D CMeshEdgeBuilder::calcFaceNormal(const sMeshEntityNode& node1, const sMeshEntityNode& node2, const sMeshEntityNode& node3)
+	{
+		sMeshVector3D vPos1 = CVectorUtils::vectorMake(node1.m_fCoordinates[0], node1.m_fCoordinates[1], node1.m_fCoordinates[2]);
+		sMeshVector3D vPos2 = CVectorUtils::vectorMake(node2.m_fCoordinates[0], node2.m_fCoordinates[1], node2.m_fCoordinates[2]);
+		sMeshVector3D vPos3 = CVectorUtils::vectorMake(node3.m_fCoordinates[0], node3.m_fCoordinates[1], node3.m_fCoordinates[2]);
+
+		auto vVec1 = CVectorUtils::vectorSubtract(vPos2, vPos1);
+		auto vVec2 = CVectorUtils::vectorSubtract(vPos3, vPos1);
+
+		auto vCrossProduct = CVectorUtils::vectorCrossProduct(vVec1, vVec2);
+
+		return CVectorUtils::vectorNormalize(vCrossProduct, MESHEDGEBUILDER_ZEROEPSILON);
+	}
+
+	void CMeshEdgeBuilder::buildEdges(const std::vector<sMeshEntityNode>& nodes, const std::vector<sMeshEntityFace>& faces, std::vector<sMeshEntityEdge>& edges, uint32_t nThreadCount)
+	{
+		edges.clear();
+
+		size_t nFaceCount = faces.size();
+		if (nFaceCount == 0)
+			return;
+
+		// Keys are (smaller node ID, larger node ID) packed into the lowest bits, so that the numeric
+		// order of the keys is the lexicographic order of the node IDs. Degenerate half edges get a key
+		// with all bits set, which no valid edge can have, and are sorted to the end.
+		uint32_t nNodeBits = 1;
+		while ((nNodeBits < 32) && ((1ULL << nNodeBits) <= (uint64_t)nodes.size()))
+			nNodeBits++;
+		uint32_t nKeyBits = nNodeBits * 2;
+		uint64_t nInvalidKey = (nKeyBits >= 64) ? UINT64_MAX : ((1ULL << nKeyBits) - 1);
+
+		size_t nHalfEdgeCount = nFaceCount * 3;
+		std::vector<uint64_t> keys(nHalfEdgeCount);
+		std::vector<uint32_t> faceIDs(nHalfEdgeCount);
+
+		AMCCommon::CParallelBlocks::processBlocks(nThreadCount, nFaceCount, MESHEDGEBUILDER_MINITEMSPERTHREAD, [&](size_t nBlockIndex, size_t nFirstFace, size_t nBlockFaceCount) {
+			for (size_t nFaceIndex = nFirstFace; nFaceIndex < nFirstFace + nBlockFaceCount; nFaceIndex++) {
+				auto& face = faces[nFaceIndex];
+
+				for (uint32_t nEdgeIndex = 0; nEdgeIndex < 3; nEdgeIndex++) {
+					uint64_t nNode1 = face.m_nNodeIDs[nEdgeIndex];
+					uint64_t nNode2 = face.m_nNodeIDs[(nEdgeIndex + 1) % 3];
+					size_t nHalfEdgeIndex = nFaceIndex * 3 + nEdgeIndex;
+
+					if (nNode1 < nNode2)
+						keys[nHalfEdgeIndex] = (nNode1 << nNodeBits) | nNode2;
+					else if (nNode1 > nNode2)
+						keys[nHalfEdgeIndex] = (nNode2 << nNodeBits) | nNode1;
+					else
+						keys[nHalfEdgeIndex] = nInvalidKey;
+
+					faceIDs[nHalfEdgeIndex] = face.m_nFaceID;
+				}
+			}
+		});
+
+		sortHalfEdges(keys, faceIDs, nKeyBits, nThreadCount);
+
+		std::vector<sMeshVector3D> faceNormals(nFaceCount);
+		AMCCommon::CParallelBlocks::processBlocks(nThreadCount, nFaceCount, MESHEDGEBUILDER_MINITEMSPERTHREAD, [&](size_t nBlockIndex, size_t nFirstFace, size_t nBlockFaceCount) {
+			for (size_t nFaceIndex = nFirstFace; nFaceIndex < nFirstFace + nBlockFaceCount; nFaceIndex++) {
+				auto& face = faces[nFaceIndex];
+				faceNormals[nFaceIndex] = calcFaceNormal(nodes[face.m_nNodeIDs[0] - 1], nodes[face.m_nNodeIDs[1] - 1], nodes[face.m_nNodeIDs[2] - 1]);
+			}
+		});
+
+		// Every run of equal keys is one edge. The runs are counted per block first, so that every block
+		// knows the ID of its first edge.
+		auto isEdgeStart = [&keys, nInvalidKey](size_t nIndex) {
+			return (keys[nIndex] != nInvalidKey) && ((nIndex == 0) || (keys[nIndex] != keys[nIndex - 1]));
+		};
+
+		size_t nBlockCount = getBlockCount(nThreadCount, nHalfEdgeCount);
+		std::vector<size_t> blockEdgeStarts(nBlockCount + 1, 0);
+
+		AMCCommon::CParallelBlocks::processBlocks(nThreadCount, nHalfEdgeCount, MESHEDGEBUILDER_MINITEMSPERTHREAD, [&](size_t nBlockIndex, size_t nFirstHalfEdge, size_t nBlockHalfEdgeCount) {
+			size_t nBlockEdgeCount = 0;
+			for (size_t nIndex = nFirstHalfEdge; nIndex < nFirstHalfEdge + nBlockHalfEdgeCount; nIndex++) {
+				if (isEdgeStart(nIndex))
+					nBlockEdgeCount++;
+			}
+			blockEdgeStarts[nBlockIndex + 1] = nBlockEdgeCount;
+		});
+
+		for (size_t nBlockIndex = 0; nBlockIndex < nBlockCount; nBlockIndex++)
+			blockEdgeStarts[nBlockIndex + 1] += blockEdgeStarts[nBlockIndex];
+
+		edges.resize(blockEdgeStarts[nBlockCount]);
+
+		AMCCommon::CParallelBlocks::processBlocks(nThreadCount, nHalfEdgeCount, MESHEDGEBUILDER_MINITEMSPERTHREAD, [&](size_t nBlockIndex, size_t nFirstHalfEdge, size_t nBlockHalfEdgeCount) {
+			size_t nEdgeIndex = blockEdgeStarts[nBlockIndex];
+			uint64_t nNodeMask = (1ULL << nNodeBits) - 1;
+
+			for (size_t nIndex = nFirstHalfEdge; nIndex < nFirstHalfEdge + nBlockHalfEdgeCount; nIndex++) {
+				if (!isEdgeStart(nIndex))
+					continue;
+
+				// Runs may continue into the next block
+				size_t nRunEnd = nIndex + 1;
+				while ((nRunEnd < nHalfEdgeCount) && (keys[nRunEnd] == keys[nIndex]))
+					nRunEnd++;
+
+				auto& edge = edges[nEdgeIndex];
+				edge.m_nEdgeID = (uint32_t)(nEdgeIndex + 1);
+				edge.m_nNodeIDs[0] = (uint32_t)(keys[nIndex] >> nNodeBits);
+				edge.m_nNodeIDs[1] = (uint32_t)(keys[nIndex] & nNodeMask);
+				edge.m_nFaceIDs[0] = faceIDs[nIndex];
+				edge.m_nFaceIDs[1] = 0;
+				edge.m_nValence = (uint32_t)(nRunEnd - nIndex);
+				edge.m_nAngleInDegrees = 0;
+				edge.m_nFlags = 0;
+
+				if (edge.m_nValence > 1) {
+					edge.m_nFaceIDs[1] = faceIDs[nRunEnd - 1];
+					double dAngle = CVectorUtils::vectorAngleInDegree(faceNormals[edge.m_nFaceIDs[0] - 1], faceNormals[edge.m_nFaceIDs[1] - 1], MESHEDGEBUILDER_ZEROEPSILON);
+					edge.m_nAngleInDegrees = (uint32_t)round(dAngle);
+				}
+
+				nEdgeIndex++;
+			}
+		});
+	}
+
+	void CMeshEdgeBuilder::sortHalfEdges(std::vector<uint64_t>& keys, std::vector<uint32_t>& faceIDs, uint32_t nKeyBits, uint32_t nThreadCount)
+	{
+		// Stable LSD radix sort. Every block counts its digits, then scatters its half edges behind all
+		// smaller digits and behind the same digit of all previous blocks.
+		size_t nHalfEdgeCount = keys.size();
+		size_t nBlockCount = getBlockCount(nThreadCount, nHalfEdgeCount);
+		const size_t nBucketCount = 1ULL << MESHEDGEBUILDER_RADIXBITS;
+		const uint64_t nDigitMask = nBucketCount - 1;
+
+		std::vector<uint64_t> keyBuffer(nHalfEdgeCount);
+		std::vector<uint32_t> faceIDBuffer(nHalfEdgeCount);
+		std::vector<size_t> bucketOffsets(nBlockCount * nBucketCount);
+
+		for (uint32_t nShift = 0; nShift < nKeyBits; nShift += MESHEDGEBUILDER_RADIXBITS) {
+			std::fill(bucketOffsets.begin(), bucketOffsets.end(), 0);
+
+			AMCCommon::CParallelBlocks::processBlocks(nThreadCount, nHalfEdgeCount, MESHEDGEBUILDER_MINITEMSPERTHREAD, [&](size_t nBlockIndex, size_t nFirstHalfEdge, size_t nBlockHalfEdgeCount) {
+				size_t* pCounts = &bucketOffsets[nBlockIndex * nBucketCount];
+				for (size_t nIndex = nFirstHalfEdge; nIndex < nFirstHalfEdge + nBlockHalfEdgeCount; nIndex++)
+					pCounts[(keys[nIndex] >> nShift) & nDigitMask]++;
+			});
+
+			size_t nOffset = 0;
+			for (size_t nBucketIndex = 0; nBucketIndex < nBucketCount; nBucketIndex++) {
+				for (size_t nBlockIndex = 0; nBlockIndex < nBlockCount; nBlockIndex++) {
+					size_t& nBucketOffset = bucketOffsets[nBlockIndex * nBucketCount + nBucketIndex];
+					size_t nCount = nBucketOffset;
+					nBucketOffset = nOffset;
+					nOffset += nCount;
+				}
+			}
+
+			AMCCommon::CParallelBlocks::processBlocks(nThreadCount, nHalfEdgeCount, MESHEDGEBUILDER_MINITEMSPERTHREAD, [&](size_t nBlockIndex, size_t nFirstHalfEdge, size_t nBlockHalfEdgeCount) {
+				size_t* pOffsets = &bucketOffsets[nBlockIndex * nBucketCount];
+				for (size_t nIndex = nFirstHalfEdge; nIndex < nFirstHalfEdge + nBlockHalfEdgeCount; nIndex++) {
+					size_t nTargetIndex = pOffsets[(keys[nIndex] >> nShift) & nDigitMask]++;
+					keyBuffer[nTargetIndex] = keys[nIndex];
+					faceIDBuffer[nTargetIndex] = faceIDs[nIndex];
+				}
+			});
+
+			keys.swap(keyBuffer);
+			faceIDs.swap(faceIDBuffer);
+		}
+	}
+
+	size_t CMeshEdgeBuilder::getBlockCount(uint32_t nThreadCount, size_t nItemCount)
+	{
+		return AMCCommon::CParallelBlocks::getBlockCount(nThreadCount, nItemCount, MESHEDGEBUILDER_MINITEMSPERTHREAD);
+	}
+
+}
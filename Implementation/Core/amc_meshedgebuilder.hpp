@@ -0,0 +1,71 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMC_MESHEDGEBUILDER
+#define __AMC_MESHEDGEBUILDER
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "amc_meshentity.hpp"
+
+// Meshes with fewer half edges per thread are not worth spawning threads for.
+#define MESHEDGEBUILDER_MINITEMSPERTHREAD (64 * 1024)
+#define MESHEDGEBUILDER_RADIXBITS 11
+
+namespace AMC {
+
+	// Builds the edge topology of a triangle mesh. The half edges of all faces are keyed by their ordered
+	// node IDs and radix sorted, which groups identical edges without allocating anything per edge.
+	// Edge IDs are assigned in ascending order of the node IDs, and the faces of an edge keep the order
+	// of the face list. The first face of an edge is its first face, the second face is its last face.
+	class CMeshEdgeBuilder {
+	private:
+
+		static void sortHalfEdges(std::vector<uint64_t>& keys, std::vector<uint32_t>& faceIDs, uint32_t nKeyBits, uint32_t nThreadCount);
+
+	public:
+
+		static sMeshVector3D calcFaceNormal(const sMeshEntityNode& node1, const sMeshEntityNode& node2, const sMeshEntityNode& node3);
+
+		// All node IDs of the faces must exist. A thread count of 0 uses all hardware threads.
+		static void buildEdges(const std::vector<sMeshEntityNode>& nodes, const std::vector<sMeshEntityFace>& faces, std::vector<sMeshEntityEdge>& edges, uint32_t nThreadCount);
+
+		// Returns the number of blocks the parallel steps of buildEdges use.
+		static size_t getBlockCount(uint32_t nThreadCount, size_t nItemCount);
+
+	};
+
+}
+
+
+#endif //__AMC_MESHEDGEBUILDER
@@ -30,6 +30,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include "amc_meshhandler.hpp"
+#include "amc_meshedgebuilder.hpp"
 #include "libmc_exceptiontypes.hpp"
 #include "common_utils.hpp"
 
@@ -145,8 +146,6 @@ namespace AMC {
 		m_Nodes.resize(nVertexCount);
 		m_Faces.resize(nTriangleCount);
 
-		std::map<std::pair<uint32_t, uint32_t>, sMeshEntityEdge> edgeMap;
-
 		for (size_t nVertexIndex = 0; nVertexIndex < nVertexCount; nVertexIndex++) {
 			auto& source = vertices.at(nVertexIndex);
 			auto& target = m_Nodes.at(nVertexIndex);
@@ -162,61 +161,14 @@ namespace AMC {
 			target.m_nFaceID = (uint32_t) nTriangleIndex + 1;
 
 			for (uint32_t nNodeIndex = 0; nNodeIndex < 3; nNodeIndex++) {
-				target.m_nNodeIDs[nNodeIndex] = source.m_Indices[nNodeIndex] + 1;
-			}
+				if (source.m_Indices[nNodeIndex] >= nVertexCount)
+					throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDMESHNODEID, "invalid node id: " + std::to_string((uint64_t)source.m_Indices[nNodeIndex] + 1));
 
-			for (uint32_t nEdgeIndex = 0; nEdgeIndex < 3; nEdgeIndex++) {
-				uint32_t nNode1 = source.m_Indices[nEdgeIndex] + 1;
-				uint32_t nNode2 = source.m_Indices[(nEdgeIndex + 1) % 3] + 1;
-
-				if (nNode1 != nNode2) {
-
-					std::pair<uint32_t, uint32_t> key;
-
-					if (nNode1 < nNode2) {
-						key = std::make_pair(nNode1, nNode2);
-					}
-					else {
-						key = std::make_pair(nNode2, nNode1);
-					}
-
-					auto iIter = edgeMap.find(key);
-					if (iIter == edgeMap.end()) {
-						sMeshEntityEdge newEdge;
-						newEdge.m_nFlags = 0;
-						newEdge.m_nEdgeID = 0;
-						newEdge.m_nNodeIDs[0] = key.first;
-						newEdge.m_nNodeIDs[1] = key.second;
-						newEdge.m_nFaceIDs[0] = target.m_nFaceID;
-						newEdge.m_nFaceIDs[1] = 0;
-						newEdge.m_nValence = 1;
-					
-						edgeMap.insert(std::make_pair(key, newEdge));
-					}
-					else {
-						iIter->second.m_nFaceIDs[1] = target.m_nFaceID;
-						iIter->second.m_nValence++;
-					}
-				}
-				
-			}
-			
-		}	
-
-		m_Edges.reserve(edgeMap.size());
-		uint32_t nID = 1;
-		for (auto & edgeIter : edgeMap) {
-			auto newEdge = edgeIter.second;
-			newEdge.m_nEdgeID = nID;
-			nID++;
-
-			if ((newEdge.m_nFaceIDs[0] != 0) && (newEdge.m_nFaceIDs[1] != 0)) {
-				newEdge.m_nAngleInDegrees = (uint32_t)round(calcFaceAngleInDegree (newEdge.m_nFaceIDs[0], newEdge.m_nFaceIDs[1]));
+				target.m_nNodeIDs[nNodeIndex] = source.m_Indices[nNodeIndex] + 1;
 			}
-			
-
-			m_Edges.push_back(newEdge);
 		}
+
+		CMeshEdgeBuilder::buildEdges(m_Nodes, m_Faces, m_Edges, 0);
 	}
 
 	double CMeshEntity::calcFaceAngleInDegree(size_t nFaceID1, size_t nFaceID2)
@@ -231,20 +183,8 @@ namespace AMC {
 	sMeshVector3D CMeshEntity::calcFaceNormal(size_t nFaceID)
 	{
 		auto& face = getFace(nFaceID);
-		auto& node1 = getNode(face.m_nNodeIDs[0]);
-		auto& node2 = getNode(face.m_nNodeIDs[1]);
-		auto& node3 = getNode(face.m_nNodeIDs[2]);
-
-		sMeshVector3D vPos1 = CVectorUtils::vectorMake(node1.m_fCoordinates[0], node1.m_fCoordinates[1], node1.m_fCoordinates[2]);
-		sMeshVector3D vPos2 = CVectorUtils::vectorMake(node2.m_fCoordinates[0], node2.m_fCoordinates[1], node2.m_fCoordinates[2]);
-		sMeshVector3D vPos3 = CVectorUtils::vectorMake(node3.m_fCoordinates[0], node3.m_fCoordinates[1], node3.m_fCoordinates[2]);
-
-		auto vVec1 = CVectorUtils::vectorSubtract(vPos2, vPos1);
-		auto vVec2 = CVectorUtils::vectorSubtract(vPos3, vPos1);
-
-		auto vCrossProduct = CVectorUtils::vectorCrossProduct(vVec1, vVec2);
 
-		return CVectorUtils::vectorNormalize(vCrossProduct, MESHENTITY_ZEROEPSILON);
+		return CMeshEdgeBuilder::calcFaceNormal(getNode(face.m_nNodeIDs[0]), getNode(face.m_nNodeIDs[1]), getNode(face.m_nNodeIDs[2]));
 	}
 
 	/*void CMeshEntity::loadFrom3MFResource(Lib3MF::CWrapper* p3MFWrapper, AMC::CResourcePackage* pResourcePackage, const std::string sResourceName)
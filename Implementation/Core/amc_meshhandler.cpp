@@ -72,11 +72,17 @@ namespace AMC {
 	{
 		std::string sNormalizedUUID = AMCCommon::CUtils::normalizeUUIDString(sEntityUUID);
 		m_Entities.erase(sNormalizedUUID);
+
+		std::lock_guard<std::mutex> lockGuard(m_MeshBVHMutex);
+		m_MeshBVHs.erase(sNormalizedUUID);
 	}
 	
 	void CMeshHandler::unloadAllEntities()
 	{
 		m_Entities.clear();
+
+		std::lock_guard<std::mutex> lockGuard(m_MeshBVHMutex);
+		m_MeshBVHs.clear();
 	}
 
 	void CMeshHandler::registerEntity(PMeshEntity pMeshEntity)
@@ -93,6 +99,31 @@ namespace AMC {
 
 	}
 
+	bool CMeshHandler::hasMeshBVH(const std::string& sEntityUUID)
+	{
+		std::string sNormalizedUUID = AMCCommon::CUtils::normalizeUUIDString(sEntityUUID);
+
+		std::lock_guard<std::mutex> lockGuard(m_MeshBVHMutex);
+		return (m_MeshBVHs.find(sNormalizedUUID) != m_MeshBVHs.end());
+	}
+
+	PMeshBVH CMeshHandler::getMeshBVH(const std::string& sEntityUUID)
+	{
+		std::string sNormalizedUUID = AMCCommon::CUtils::normalizeUUIDString(sEntityUUID);
+		auto pMeshEntity = findMeshEntity(sNormalizedUUID, true);
+
+		// The lock is held during the build, so concurrent callers wait for the same index instead of building it twice.
+		std::lock_guard<std::mutex> lockGuard(m_MeshBVHMutex);
+		auto iIter = m_MeshBVHs.find(sNormalizedUUID);
+		if (iIter != m_MeshBVHs.end())
+			return iIter->second;
+
+		auto pMeshBVH = std::make_shared<CMeshBVH>(pMeshEntity.get(), 0);
+		m_MeshBVHs.insert(std::make_pair(sNormalizedUUID, pMeshBVH));
+
+		return pMeshBVH;
+	}
+
 	PMeshScene CMeshHandler::findScene(const std::string& sSceneUUID, bool bFailIfNotExistent)
 	{
 		std::string sNormalizedSceneUUID = AMCCommon::CUtils::normalizeUUIDString(sSceneUUID);
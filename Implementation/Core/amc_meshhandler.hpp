@@ -34,9 +34,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <memory>
 #include <map>
+#include <mutex>
 #include <string>
 
 #include "amc_meshentity.hpp"
+#include "amc_meshbvh.hpp"
 #include "amc_resourcepackage.hpp"
 #include "libmcdata_dynamic.hpp"
 
@@ -57,6 +59,10 @@ namespace AMC {
 
 		std::map<std::string, PMeshScene> m_Scenes;
 
+		// Spatial indices are built on first use and dropped together with their entity.
+		std::map<std::string, PMeshBVH> m_MeshBVHs;
+		std::mutex m_MeshBVHMutex;
+
 	public:
 
 		CMeshHandler();
@@ -70,6 +76,9 @@ namespace AMC {
 
 		void registerEntity(PMeshEntity pMeshEntity);
 
+		bool hasMeshBVH(const std::string& sEntityUUID);
+		PMeshBVH getMeshBVH(const std::string& sEntityUUID);
+
 		PMeshScene findScene(const std::string & sSceneUUID, bool bFailIfNotExistent);
 
 		PMeshScene createEmptyScene(bool bBoundToLoginSession);
@@ -33,10 +33,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "libmc_exceptiontypes.hpp"
 #include "common_utils.hpp"
 
+#include <cmath>
+#include <algorithm>
+
 namespace AMC {
 
 	CScatterplot::CScatterplot(const std::string& sUUID)
-		: m_sUUID (AMCCommon::CUtils::normalizeUUIDString (sUUID))
+		: m_sUUID (AMCCommon::CUtils::normalizeUUIDString (sUUID)),
+		m_dMinX (0.0), m_dMinY (0.0), m_dMaxX (0.0), m_dMaxY (0.0),
+		m_nGridSizeX (0), m_nGridSizeY (0), m_dCellSizeX (1.0), m_dCellSizeY (1.0),
+		m_bIndexIsValid (true)
 	{
 
 	}
@@ -53,7 +59,17 @@ namespace AMC {
 
 	void CScatterplot::clearData()
 	{
+		std::lock_guard<std::mutex> lockGuard(m_IndexMutex);
 		m_PointEntries.clear();
+		m_Cells.clear();
+		m_CellPointIndices.clear();
+		m_nGridSizeX = 0;
+		m_nGridSizeY = 0;
+		m_dMinX = 0.0;
+		m_dMinY = 0.0;
+		m_dMaxX = 0.0;
+		m_dMaxY = 0.0;
+		m_bIndexIsValid = true;
 	}
 
 	bool CScatterplot::isEmpty()
@@ -67,12 +83,22 @@ namespace AMC {
 	}
 
 	std::vector<sScatterplotEntry>& CScatterplot::getEntries()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_IndexMutex);
+		m_bIndexIsValid = false;
+		return m_PointEntries;
+	}
+
+	const std::vector<sScatterplotEntry>& CScatterplot::readEntries()
 	{
 		return m_PointEntries;
 	}
 
 	void CScatterplot::getBoundaries(double& dMinX, double& dMinY, double& dMaxX, double& dMaxY)
 	{
+		std::lock_guard<std::mutex> lockGuard(m_IndexMutex);
+		ensureSpatialIndex();
+
 		dMinX = m_dMinX;
 		dMinY = m_dMinY;
 		dMaxX = m_dMaxX;
@@ -80,6 +106,18 @@ namespace AMC {
 	}
 
 	void CScatterplot::computeBoundaries()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_IndexMutex);
+		computeBoundariesEx();
+	}
+
+	void CScatterplot::ensureSpatialIndex()
+	{
+		if (!m_bIndexIsValid)
+			computeBoundariesEx();
+	}
+
+	void CScatterplot::computeBoundariesEx()
 	{
 		size_t nPointCount = m_PointEntries.size();
 		if (nPointCount > 0) {
@@ -111,8 +149,192 @@ namespace AMC {
 			m_dMaxY = 0.0;
 
 		}
+
+		buildSpatialIndex();
+		m_bIndexIsValid = true;
 	}
 
-}
+	void CScatterplot::buildSpatialIndex()
+	{
+		m_Cells.clear();
+		m_CellPointIndices.clear();
+		m_nGridSizeX = 0;
+		m_nGridSizeY = 0;
 
+		size_t nPointCount = m_PointEntries.size();
+		if (nPointCount == 0)
+			return;
+
+		if (nPointCount > UINT32_MAX)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+		uint32_t nGridSize = (uint32_t)std::sqrt((double)nPointCount / AMC_SCATTERPLOT_POINTSPERCELL);
+		nGridSize = std::min<uint32_t>(std::max<uint32_t>(nGridSize, 1), AMC_SCATTERPLOT_MAXGRIDSIZE);
+
+		m_nGridSizeX = nGridSize;
+		m_nGridSizeY = nGridSize;
+		m_dCellSizeX = std::max((m_dMaxX - m_dMinX) / m_nGridSizeX, 1.0E-12);
+		m_dCellSizeY = std::max((m_dMaxY - m_dMinY) / m_nGridSizeY, 1.0E-12);
+
+		m_Cells.resize((size_t)m_nGridSizeX * m_nGridSizeY);
+		for (auto& cell : m_Cells) {
+			cell.m_nFirstPoint = 0;
+			cell.m_nPointCount = 0;
+			cell.m_dSumX = 0.0;
+			cell.m_dSumY = 0.0;
+			cell.m_dMinX = 0.0;
+			cell.m_dMinY = 0.0;
+			cell.m_dMaxX = 0.0;
+			cell.m_dMaxY = 0.0;
+		}
+
+		// Counting sort of all points into their cells
+		std::vector<uint32_t> pointCells;
+		pointCells.resize(nPointCount);
+		for (size_t nIndex = 0; nIndex < nPointCount; nIndex++) {
+			auto& point = m_PointEntries[nIndex];
+			uint32_t nCellX = std::min<uint32_t>((uint32_t)((point.m_dX - m_dMinX) / m_dCellSizeX), m_nGridSizeX - 1);
+			uint32_t nCellY = std::min<uint32_t>((uint32_t)((point.m_dY - m_dMinY) / m_dCellSizeY), m_nGridSizeY - 1);
+			uint32_t nCellIndex = nCellY * m_nGridSizeX + nCellX;
+			pointCells[nIndex] = nCellIndex;
+
+			auto& cell = m_Cells[nCellIndex];
+			if (cell.m_nPointCount == 0) {
+				cell.m_dMinX = point.m_dX;
+				cell.m_dMinY = point.m_dY;
+				cell.m_dMaxX = point.m_dX;
+				cell.m_dMaxY = point.m_dY;
+			}
+			else {
+				cell.m_dMinX = std::min(cell.m_dMinX, point.m_dX);
+				cell.m_dMinY = std::min(cell.m_dMinY, point.m_dY);
+				cell.m_dMaxX = std::max(cell.m_dMaxX, point.m_dX);
+				cell.m_dMaxY = std::max(cell.m_dMaxY, point.m_dY);
+			}
+			cell.m_nPointCount++;
+			cell.m_dSumX += point.m_dX;
+			cell.m_dSumY += point.m_dY;
+		}
+
+		uint32_t nFirstPoint = 0;
+		for (auto& cell : m_Cells) {
+			cell.m_nFirstPoint = nFirstPoint;
+			nFirstPoint += cell.m_nPointCount;
+		}
+
+		std::vector<uint32_t> cellFillCounts;
+		cellFillCounts.resize(m_Cells.size(), 0);
+		m_CellPointIndices.resize(nPointCount);
+		for (size_t nIndex = 0; nIndex < nPointCount; nIndex++) {
+			uint32_t nCellIndex = pointCells[nIndex];
+			m_CellPointIndices[(size_t)m_Cells[nCellIndex].m_nFirstPoint + cellFillCounts[nCellIndex]] = (uint32_t)nIndex;
+			cellFillCounts[nCellIndex]++;
+		}
+	}
 
+	void CScatterplot::getCellRange(double dMinX, double dMinY, double dMaxX, double dMaxY, uint32_t& nCellMinX, uint32_t& nCellMinY, uint32_t& nCellMaxX, uint32_t& nCellMaxY)
+	{
+		double dCellMinX = std::max(std::floor((dMinX - m_dMinX) / m_dCellSizeX), 0.0);
+		double dCellMinY = std::max(std::floor((dMinY - m_dMinY) / m_dCellSizeY), 0.0);
+		double dCellMaxX = std::min(std::floor((dMaxX - m_dMinX) / m_dCellSizeX), (double)(m_nGridSizeX - 1));
+		double dCellMaxY = std::min(std::floor((dMaxY - m_dMinY) / m_dCellSizeY), (double)(m_nGridSizeY - 1));
+
+		nCellMinX = (uint32_t)dCellMinX;
+		nCellMinY = (uint32_t)dCellMinY;
+		nCellMaxX = (uint32_t)std::max(dCellMaxX, 0.0);
+		nCellMaxY = (uint32_t)std::max(dCellMaxY, 0.0);
+	}
+
+	uint64_t CScatterplot::getMemoryUsageInBytes()
+	{
+		return (uint64_t)m_PointEntries.capacity() * sizeof(sScatterplotEntry)
+			+ (uint64_t)m_Cells.capacity() * sizeof(sScatterplotCell)
+			+ (uint64_t)m_CellPointIndices.capacity() * sizeof(uint32_t);
+	}
+
+	void CScatterplot::queryDensity(double dMinX, double dMinY, double dMaxX, double dMaxY, uint32_t nResolutionX, uint32_t nResolutionY, std::vector<sScatterplotDensityEntry>& densityEntries)
+	{
+		densityEntries.clear();
+
+		if (!(dMinX < dMaxX) || !(dMinY < dMaxY))
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDSCATTERPLOTVIEWPORT, m_sUUID);
+		if ((nResolutionX == 0) || (nResolutionY == 0) || (nResolutionX > AMC_SCATTERPLOT_MAXQUERYRESOLUTION) || (nResolutionY > AMC_SCATTERPLOT_MAXQUERYRESOLUTION))
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDSCATTERPLOTRESOLUTION, m_sUUID);
+
+		std::lock_guard<std::mutex> lockGuard(m_IndexMutex);
+		ensureSpatialIndex();
+
+		if (m_Cells.empty())
+			return;
+
+		// Viewport does not overlap the data
+		if ((dMaxX < m_dMinX) || (dMinX > m_dMaxX) || (dMaxY < m_dMinY) || (dMinY > m_dMaxY))
+			return;
+
+		double dBinSizeX = (dMaxX - dMinX) / nResolutionX;
+		double dBinSizeY = (dMaxY - dMinY) / nResolutionY;
+
+		std::vector<sScatterplotCell> bins;
+		bins.resize((size_t)nResolutionX * nResolutionY);
+		for (auto& bin : bins) {
+			bin.m_nPointCount = 0;
+			bin.m_dSumX = 0.0;
+			bin.m_dSumY = 0.0;
+		}
+
+		// The bin index is monotonic in the position, so all points between two positions of the same bin fall into that bin as well.
+		auto getBinX = [&](double dX) { return std::min<uint32_t>((uint32_t)((dX - dMinX) / dBinSizeX), nResolutionX - 1); };
+		auto getBinY = [&](double dY) { return std::min<uint32_t>((uint32_t)((dY - dMinY) / dBinSizeY), nResolutionY - 1); };
+
+		auto addToBin = [&](uint32_t nBinX, uint32_t nBinY, uint32_t nCount, double dSumX, double dSumY) {
+			auto& bin = bins[(size_t)nBinY * nResolutionX + nBinX];
+			bin.m_nPointCount += nCount;
+			bin.m_dSumX += dSumX;
+			bin.m_dSumY += dSumY;
+		};
+
+		uint32_t nCellMinX, nCellMinY, nCellMaxX, nCellMaxY;
+		getCellRange(dMinX, dMinY, dMaxX, dMaxY, nCellMinX, nCellMinY, nCellMaxX, nCellMaxY);
+
+		for (uint32_t nCellY = nCellMinY; nCellY <= nCellMaxY; nCellY++) {
+			for (uint32_t nCellX = nCellMinX; nCellX <= nCellMaxX; nCellX++) {
+				auto& cell = m_Cells[(size_t)nCellY * m_nGridSizeX + nCellX];
+				if (cell.m_nPointCount == 0)
+					continue;
+
+				// The bounding box of the cell points decides if the whole cell falls into one bin.
+				bool bCellIsInside = (cell.m_dMinX >= dMinX) && (cell.m_dMaxX <= dMaxX) && (cell.m_dMinY >= dMinY) && (cell.m_dMaxY <= dMaxY);
+				if (bCellIsInside) {
+					uint32_t nBinX = getBinX(cell.m_dMinX);
+					uint32_t nBinY = getBinY(cell.m_dMinY);
+					if ((nBinX == getBinX(cell.m_dMaxX)) && (nBinY == getBinY(cell.m_dMaxY))) {
+						addToBin(nBinX, nBinY, cell.m_nPointCount, cell.m_dSumX, cell.m_dSumY);
+						continue;
+					}
+				}
+
+				// Cells that straddle a bin or viewport border are binned point by point
+				auto pPointIndex = &m_CellPointIndices[cell.m_nFirstPoint];
+				for (uint32_t nIndex = 0; nIndex < cell.m_nPointCount; nIndex++) {
+					auto& point = m_PointEntries[*pPointIndex];
+					pPointIndex++;
+
+					if ((point.m_dX < dMinX) || (point.m_dX > dMaxX) || (point.m_dY < dMinY) || (point.m_dY > dMaxY))
+						continue;
+					addToBin(getBinX(point.m_dX), getBinY(point.m_dY), 1, point.m_dX, point.m_dY);
+				}
+			}
+		}
+
+		for (auto& bin : bins) {
+			if (bin.m_nPointCount > 0) {
+				sScatterplotDensityEntry entry;
+				entry.m_fX = (float)(bin.m_dSumX / bin.m_nPointCount);
+				entry.m_fY = (float)(bin.m_dSumY / bin.m_nPointCount);
+				entry.m_fCount = (float)bin.m_nPointCount;
+				densityEntries.push_back(entry);
+			}
+		}
+	}
+
+}
@@ -37,6 +37,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <string>
 #include <cstdint>
 #include <vector>
+#include <mutex>
+
+// The spatial index aims for this number of points per grid cell.
+#define AMC_SCATTERPLOT_POINTSPERCELL 16
+#define AMC_SCATTERPLOT_MAXGRIDSIZE 1024
+
+// Maximum number of aggregated bins per axis for viewport queries.
+#define AMC_SCATTERPLOT_MAXQUERYRESOLUTION 4096
 
 namespace AMC {
 
@@ -45,6 +53,23 @@ namespace AMC {
 		double m_dY;
 	} sScatterplotEntry;
 
+	typedef struct _sScatterplotCell {
+		uint32_t m_nFirstPoint;
+		uint32_t m_nPointCount;
+		double m_dSumX;
+		double m_dSumY;
+		double m_dMinX;
+		double m_dMinY;
+		double m_dMaxX;
+		double m_dMaxY;
+	} sScatterplotCell;
+
+	typedef struct _sScatterplotDensityEntry {
+		float m_fX;
+		float m_fY;
+		float m_fCount;
+	} sScatterplotDensityEntry;
+
 
 	class CScatterplot;
 	typedef std::shared_ptr<CScatterplot> PScatterplot;
@@ -61,6 +86,26 @@ namespace AMC {
 		double m_dMaxX;
 		double m_dMaxY;
 
+		// Uniform grid over the boundaries. Points are referenced cell by cell in m_CellPointIndices.
+		uint32_t m_nGridSizeX;
+		uint32_t m_nGridSizeY;
+		double m_dCellSizeX;
+		double m_dCellSizeY;
+		std::vector<sScatterplotCell> m_Cells;
+		std::vector<uint32_t> m_CellPointIndices;
+
+		// Boundaries and spatial index are outdated once the entries have been handed out for writing.
+		bool m_bIndexIsValid;
+		std::mutex m_IndexMutex;
+
+		void computeBoundariesEx();
+
+		void ensureSpatialIndex();
+
+		void buildSpatialIndex();
+
+		void getCellRange(double dMinX, double dMinY, double dMaxX, double dMaxY, uint32_t& nCellMinX, uint32_t& nCellMinY, uint32_t& nCellMaxX, uint32_t& nCellMaxY);
+
 	public:
 
 		CScatterplot(const std::string & sUUID);
@@ -75,12 +120,23 @@ namespace AMC {
 		
 		uint64_t getEntryCount();
 
+		// Returns the entries for writing. The boundaries and the spatial index are recomputed with the next query.
 		std::vector<sScatterplotEntry> & getEntries ();
 
+		const std::vector<sScatterplotEntry> & readEntries ();
+
 		void getBoundaries(double& dMinX, double& dMinY, double& dMaxX, double& dMaxY);
 
+		// Computes the boundaries and builds the spatial index.
 		void computeBoundaries();
 
+		uint64_t getMemoryUsageInBytes();
+
+		// Aggregates all points in the viewport into a grid of nResolutionX x nResolutionY bins.
+		// Every non-empty bin returns the mean position and the number of its points, row by row.
+		// Index cells whose points all fall into one bin are aggregated from the cell sums without touching the points.
+		void queryDensity(double dMinX, double dMinY, double dMaxX, double dMaxY, uint32_t nResolutionX, uint32_t nResolutionY, std::vector<sScatterplotDensityEntry>& densityEntries);
+
 
 	};
 
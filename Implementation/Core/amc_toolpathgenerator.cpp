@@ -0,0 +1,180 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "amc_toolpathgenerator.hpp"
+#include "libmc_exceptiontypes.hpp"
+#include "common_utils.hpp"
+#include "common_importstream_native.hpp"
+
+#include <random>
+#include <cmath>
+
+namespace AMC {
+
+	CToolpathGenerator::CToolpathGenerator(Lib3MF::PWrapper p3MFWrapper)
+		: m_p3MFWrapper (p3MFWrapper)
+	{
+		LibMCAssertNotNull(p3MFWrapper.get());
+	}
+
+	CToolpathGenerator::~CToolpathGenerator()
+	{
+
+	}
+
+	void CToolpathGenerator::generateToolpath(const sToolpathGeneratorParameters& parameters, const std::string& sTemporaryFileName, std::vector<uint8_t>& Buffer)
+	{
+		if ((parameters.m_nLayerCount == 0) || (parameters.m_nLayerCount > AMC_TOOLPATHGENERATOR_MAXLAYERCOUNT))
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+		if ((parameters.m_nSegmentsPerLayer == 0) || (parameters.m_nSegmentsPerLayer > AMC_TOOLPATHGENERATOR_MAXSEGMENTSPERLAYER))
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+		if ((parameters.m_nPointsPerSegment < 3) || (parameters.m_nPointsPerSegment > AMC_TOOLPATHGENERATOR_MAXPOINTSPERSEGMENT))
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+		if ((parameters.m_nProfileCount == 0) || (parameters.m_nProfileCount > AMC_TOOLPATHGENERATOR_MAXPROFILECOUNT))
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+		if (sTemporaryFileName.empty())
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
+
+		std::mt19937 randomGenerator(parameters.m_nSeed);
+		std::uniform_int_distribution<int32_t> coordinateDistribution(0, AMC_TOOLPATHGENERATOR_FIELDSIZE);
+		std::uniform_int_distribution<int32_t> radiusDistribution(AMC_TOOLPATHGENERATOR_FIELDSIZE / 100, AMC_TOOLPATHGENERATOR_FIELDSIZE / 10);
+
+		auto p3MFModel = m_p3MFWrapper->CreateModel();
+		p3MFModel->SetUnit(Lib3MF::eModelUnit::MilliMeter);
+
+		// Every toolpath part references a build item, so a single cube is added as part geometry.
+		auto pMeshObject = p3MFModel->AddMeshObject();
+		pMeshObject->SetName("synthetic part");
+		pMeshObject->SetUUID(AMCCommon::CUtils::createUUID());
+
+		float fSize = (float)(AMC_TOOLPATHGENERATOR_FIELDSIZE * AMC_TOOLPATHGENERATOR_UNITS);
+		float fHeight = (float)(parameters.m_nLayerCount * AMC_TOOLPATHGENERATOR_LAYERTHICKNESS * AMC_TOOLPATHGENERATOR_UNITS);
+		std::vector<Lib3MF::sPosition> Vertices = {
+			{ { 0.0f, 0.0f, 0.0f } }, { { fSize, 0.0f, 0.0f } }, { { fSize, fSize, 0.0f } }, { { 0.0f, fSize, 0.0f } },
+			{ { 0.0f, 0.0f, fHeight } }, { { fSize, 0.0f, fHeight } }, { { fSize, fSize, fHeight } }, { { 0.0f, fSize, fHeight } }
+		};
+		std::vector<Lib3MF::sTriangle> Triangles = {
+			{ { 2, 1, 0 } }, { { 0, 3, 2 } }, { { 4, 5, 6 } }, { { 6, 7, 4 } },
+			{ { 0, 1, 5 } }, { { 5, 4, 0 } }, { { 2, 3, 7 } }, { { 7, 6, 2 } },
+			{ { 1, 2, 6 } }, { { 6, 5, 1 } }, { { 3, 0, 4 } }, { { 4, 7, 3 } }
+		};
+		pMeshObject->SetGeometry(Vertices, Triangles);
+
+		auto pBuildItem = p3MFModel->AddBuildItem(pMeshObject.get(), m_p3MFWrapper->GetIdentityTransform());
+		pBuildItem->SetUUID(AMCCommon::CUtils::createUUID());
+
+		auto pToolpath = p3MFModel->AddToolpath(AMC_TOOLPATHGENERATOR_UNITS);
+
+		std::vector<Lib3MF::PToolpathProfile> Profiles;
+		for (uint32_t nProfileIndex = 0; nProfileIndex < parameters.m_nProfileCount; nProfileIndex++) {
+			auto pProfile = pToolpath->AddProfile("profile" + std::to_string(nProfileIndex + 1));
+			pProfile->SetParameterDoubleValue("", "laserpower", 100.0 + 25.0 * (nProfileIndex % 8));
+			pProfile->SetParameterDoubleValue("", "laserspeed", 500.0 + 250.0 * (nProfileIndex % 5));
+			pProfile->SetParameterDoubleValue("", "laserfocus", 0.1 * (nProfileIndex % 3));
+			if ((nProfileIndex % 2) == 0)
+				pProfile->SetParameterDoubleValue("", "jumpspeed", 2000.0 + 500.0 * (nProfileIndex % 4));
+			pProfile->SetParameterIntegerValue("", "laserindex", parameters.m_nLaserIndex);
+			Profiles.push_back(pProfile);
+		}
+
+		auto pWriter = p3MFModel->QueryWriter("3mf");
+
+		uint32_t nPointsPerSegment = parameters.m_nPointsPerSegment;
+		uint32_t nHatchesPerSegment = nPointsPerSegment / 2;
+
+		// Coordinates are drawn in toolpath units and written in millimeters, which Lib3MF quantises back without loss.
+		std::vector<Lib3MF::sHatch2D> Hatches;
+		std::vector<Lib3MF::sPosition2D> LoopPoints;
+
+		for (uint32_t nLayerIndex = 0; nLayerIndex < parameters.m_nLayerCount; nLayerIndex++) {
+			uint32_t nZMax = (nLayerIndex + 1) * AMC_TOOLPATHGENERATOR_LAYERTHICKNESS;
+			auto pLayer = pToolpath->AddLayer(nZMax, "/Toolpath/layer" + std::to_string(nLayerIndex + 1) + ".xml", pWriter.get());
+
+			std::vector<uint32_t> ProfileIDs;
+			for (auto pProfile : Profiles)
+				ProfileIDs.push_back(pLayer->RegisterProfile(pProfile.get()));
+			uint32_t nPartID = pLayer->RegisterBuildItem(pBuildItem.get());
+
+			for (uint32_t nSegmentIndex = 0; nSegmentIndex < parameters.m_nSegmentsPerLayer; nSegmentIndex++) {
+				uint32_t nProfileID = ProfileIDs.at(nSegmentIndex % ProfileIDs.size());
+
+				if ((nSegmentIndex % 2) == 0) {
+					Hatches.resize(nHatchesPerSegment);
+					for (auto& hatch : Hatches) {
+						int32_t nY = coordinateDistribution(randomGenerator);
+						hatch.m_Point1Coordinates[0] = coordinateDistribution(randomGenerator) * AMC_TOOLPATHGENERATOR_UNITS;
+						hatch.m_Point1Coordinates[1] = nY * AMC_TOOLPATHGENERATOR_UNITS;
+						hatch.m_Point2Coordinates[0] = coordinateDistribution(randomGenerator) * AMC_TOOLPATHGENERATOR_UNITS;
+						hatch.m_Point2Coordinates[1] = nY * AMC_TOOLPATHGENERATOR_UNITS;
+						hatch.m_Tag = 0;
+					}
+
+					pLayer->WriteHatchDataInModelUnits(nProfileID, nPartID, Hatches);
+				}
+				else {
+					int32_t nCenterX = coordinateDistribution(randomGenerator);
+					int32_t nCenterY = coordinateDistribution(randomGenerator);
+					double dRadius = (double)radiusDistribution(randomGenerator);
+
+					LoopPoints.resize(nPointsPerSegment);
+					for (uint32_t nPointIndex = 0; nPointIndex < nPointsPerSegment; nPointIndex++) {
+						double dAngle = (2.0 * 3.14159265358979323846 * nPointIndex) / nPointsPerSegment;
+						int32_t nX = nCenterX + (int32_t)round(dRadius * cos(dAngle));
+						int32_t nY = nCenterY + (int32_t)round(dRadius * sin(dAngle));
+						LoopPoints[nPointIndex].m_Coordinates[0] = (float)(nX * AMC_TOOLPATHGENERATOR_UNITS);
+						LoopPoints[nPointIndex].m_Coordinates[1] = (float)(nY * AMC_TOOLPATHGENERATOR_UNITS);
+					}
+
+					pLayer->WriteLoopInModelUnits(nProfileID, nPartID, LoopPoints);
+				}
+			}
+
+			pLayer->Finish();
+		}
+
+		pWriter->WriteToFile(sTemporaryFileName);
+
+		try {
+			AMCCommon::CImportStream_Native importStream(sTemporaryFileName);
+			Buffer.resize(importStream.retrieveSize());
+			if (Buffer.size() > 0)
+				importStream.readBuffer(Buffer.data(), Buffer.size(), true);
+		}
+		catch (...) {
+			AMCCommon::CUtils::deleteFileFromDisk(sTemporaryFileName, false);
+			throw;
+		}
+
+		AMCCommon::CUtils::deleteFileFromDisk(sTemporaryFileName, false);
+	}
+
+}
+
@@ -0,0 +1,87 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMC_TOOLPATHGENERATOR
+#define __AMC_TOOLPATHGENERATOR
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "lib3mf/lib3mf_dynamic.hpp"
+
+// Synthetic toolpaths are written in micron units, in a square field of 100mm.
+#define AMC_TOOLPATHGENERATOR_UNITS 0.001
+#define AMC_TOOLPATHGENERATOR_FIELDSIZE 100000
+#define AMC_TOOLPATHGENERATOR_LAYERTHICKNESS 30
+
+#define AMC_TOOLPATHGENERATOR_MAXLAYERCOUNT 100000
+#define AMC_TOOLPATHGENERATOR_MAXSEGMENTSPERLAYER 1000000
+#define AMC_TOOLPATHGENERATOR_MAXPOINTSPERSEGMENT 1000000
+#define AMC_TOOLPATHGENERATOR_MAXPROFILECOUNT 1024
+
+namespace AMC {
+
+	typedef struct _sToolpathGeneratorParameters {
+		uint32_t m_nLayerCount;
+		uint32_t m_nSegmentsPerLayer;
+		uint32_t m_nPointsPerSegment;
+		uint32_t m_nProfileCount;
+		uint32_t m_nLaserIndex;
+		uint32_t m_nSeed;
+	} sToolpathGeneratorParameters;
+
+	// Writes reproducible random toolpaths as 3MF, for tests and benchmarks of toolpath consumers.
+	// Even segments are hatches and odd segments are loops. Profiles alternate between having an
+	// explicit jump speed and falling back to the laser speed.
+	class CToolpathGenerator {
+	private:
+		Lib3MF::PWrapper m_p3MFWrapper;
+
+	public:
+
+		CToolpathGenerator(Lib3MF::PWrapper p3MFWrapper);
+
+		virtual ~CToolpathGenerator();
+
+		// Lib3MF streams toolpath layers only into files, so the 3MF is written to a temporary file first.
+		void generateToolpath(const sToolpathGeneratorParameters& parameters, const std::string& sTemporaryFileName, std::vector<uint8_t>& Buffer);
+
+	};
+
+	typedef std::shared_ptr<CToolpathGenerator> PToolpathGenerator;
+
+}
+
+
+#endif //__AMC_TOOLPATHGENERATOR
+
@@ -39,7 +39,7 @@ namespace AMC {
 
 
 	CToolpathHandler::CToolpathHandler(LibMCData::PDataModel pDataModel)
-		: m_pDataModel(pDataModel)
+		: m_pDataModel(pDataModel), m_nScatterplotMemoryBudget (AMC_TOOLPATH_DEFAULTSCATTERPLOTMEMORYBUDGET)
 	{
 		LibMCAssertNotNull(pDataModel.get());
 	
@@ -89,14 +89,17 @@ namespace AMC {
 	void CToolpathHandler::unloadToolpathEntity(const std::string& sStreamUUID)
 	{
 		auto pToolpathEntity = findToolpathEntity(sStreamUUID, true);
-		if (pToolpathEntity->DecRef())
+		if (pToolpathEntity->DecRef()) {
 			m_Entities.erase(sStreamUUID);
+			clearLayerTileTrees(sStreamUUID);
+		}
 	}
 
 
 	void CToolpathHandler::unloadAllEntities()
 	{
 		m_Entities.clear();
+		clearLayerTileTrees("");
 	}
 
 	void CToolpathHandler::setLibraryPath(const std::string& sLibraryName, const std::string sLibraryPath)
@@ -137,12 +140,22 @@ namespace AMC {
 		if (pScatterplot.get() == nullptr)
 			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPARAM);
 
-		m_Scatterplots.insert(std::make_pair (pScatterplot->getUUID(), pScatterplot));
+		std::lock_guard<std::mutex> lockGuard(m_ScatterplotMutex);
+
+		std::string sUUID = pScatterplot->getUUID();
+		m_Scatterplots.insert(std::make_pair (sUUID, pScatterplot));
+		m_ScatterplotUsage.remove(sUUID);
+		m_ScatterplotUsage.push_front(sUUID);
+
+		evictScatterplots(sUUID);
 	}
 
 	PScatterplot CToolpathHandler::restoreScatterplot(const std::string& sUUID, bool bMustExist)
 	{
-		auto iIter = m_Scatterplots.find(AMCCommon::CUtils::normalizeUUIDString(sUUID));
+		std::lock_guard<std::mutex> lockGuard(m_ScatterplotMutex);
+
+		std::string sNormalizedUUID = AMCCommon::CUtils::normalizeUUIDString(sUUID);
+		auto iIter = m_Scatterplots.find(sNormalizedUUID);
 		if (iIter == m_Scatterplots.end()) {
 			if (bMustExist)
 				throw ELibMCCustomException(LIBMC_ERROR_SCATTERPLOTNOTFOUND, sUUID);
@@ -150,10 +163,113 @@ namespace AMC {
 			return nullptr;
 		}
 
+		m_ScatterplotUsage.remove(sNormalizedUUID);
+		m_ScatterplotUsage.push_front(sNormalizedUUID);
+
 		return iIter->second;
 	}
 
+	void CToolpathHandler::evictScatterplots(const std::string& sUUIDToKeep)
+	{
+		// Scatterplots may be released or refilled while they are stored, so memory is measured on every call.
+		uint64_t nMemoryUsage = 0;
+		for (auto& iter : m_Scatterplots)
+			nMemoryUsage += iter.second->getMemoryUsageInBytes();
+
+		while ((nMemoryUsage > m_nScatterplotMemoryBudget) && (!m_ScatterplotUsage.empty())) {
+			std::string sUUIDToEvict = m_ScatterplotUsage.back();
+			if (sUUIDToEvict == sUUIDToKeep)
+				break;
+
+			m_ScatterplotUsage.pop_back();
+
+			auto iIter = m_Scatterplots.find(sUUIDToEvict);
+			if (iIter != m_Scatterplots.end()) {
+				nMemoryUsage -= iIter->second->getMemoryUsageInBytes();
+				m_Scatterplots.erase(iIter);
+			}
+		}
+	}
 
-}
+	void CToolpathHandler::setScatterplotMemoryBudget(uint64_t nMemoryBudgetInBytes)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_ScatterplotMutex);
+
+		m_nScatterplotMemoryBudget = nMemoryBudgetInBytes;
+		evictScatterplots("");
+	}
+
+	uint64_t CToolpathHandler::getScatterplotMemoryBudget()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_ScatterplotMutex);
+		return m_nScatterplotMemoryBudget;
+	}
+
+	uint64_t CToolpathHandler::getScatterplotMemoryUsage()
+	{
+		std::lock_guard<std::mutex> lockGuard(m_ScatterplotMutex);
+
+		uint64_t nMemoryUsage = 0;
+		for (auto& iter : m_Scatterplots)
+			nMemoryUsage += iter.second->getMemoryUsageInBytes();
 
+		return nMemoryUsage;
+	}
+
+	void CToolpathHandler::clearLayerTileTrees(const std::string& sStreamUUID)
+	{
+		std::lock_guard<std::mutex> lockGuard(m_LayerTileTreeMutex);
+
+		if (sStreamUUID.empty()) {
+			m_LayerTileTrees.clear();
+			m_LayerTileTreeUsage.clear();
+			return;
+		}
+
+		std::string sNormalizedUUID = AMCCommon::CUtils::normalizeUUIDString(sStreamUUID);
+		m_LayerTileTreeUsage.remove_if([&sNormalizedUUID](const std::pair<std::string, uint32_t>& key) {
+			return key.first == sNormalizedUUID;
+		});
+
+		auto iIter = m_LayerTileTrees.lower_bound(std::make_pair(sNormalizedUUID, (uint32_t)0));
+		while ((iIter != m_LayerTileTrees.end()) && (iIter->first.first == sNormalizedUUID))
+			iIter = m_LayerTileTrees.erase(iIter);
+	}
+
+	PToolpathLayerTileTree CToolpathHandler::retrieveLayerTileTree(CToolpathEntity* pToolpathEntity, const std::string& sStreamUUID, uint32_t nLayerIndex, bool& bTreeWasBuilt)
+	{
+		LibMCAssertNotNull(pToolpathEntity);
+		bTreeWasBuilt = false;
+
+		auto key = std::make_pair(AMCCommon::CUtils::normalizeUUIDString(sStreamUUID), nLayerIndex);
+
+		{
+			std::lock_guard<std::mutex> lockGuard(m_LayerTileTreeMutex);
+			auto iIter = m_LayerTileTrees.find(key);
+			if (iIter != m_LayerTileTrees.end()) {
+				m_LayerTileTreeUsage.remove(key);
+				m_LayerTileTreeUsage.push_front(key);
+				return iIter->second;
+			}
+		}
+
+		// Build the tree outside of the lock, as this might take a while for dense layers
+		auto pLayerData = pToolpathEntity->readLayer(nLayerIndex);
+		auto pTileTree = std::make_shared<CToolpathLayerTileTree>(pLayerData.get());
+		bTreeWasBuilt = true;
 
+		std::lock_guard<std::mutex> lockGuard(m_LayerTileTreeMutex);
+		if (m_LayerTileTrees.find(key) == m_LayerTileTrees.end()) {
+			m_LayerTileTrees.insert(std::make_pair(key, pTileTree));
+			m_LayerTileTreeUsage.push_front(key);
+
+			while (m_LayerTileTreeUsage.size() > AMC_TOOLPATH_MAXCACHEDLAYERTILETREES) {
+				m_LayerTileTrees.erase(m_LayerTileTreeUsage.back());
+				m_LayerTileTreeUsage.pop_back();
+			}
+		}
+
+		return pTileTree;
+	}
+
+}
@@ -36,11 +36,20 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <map>
 #include <string>
 #include <set>
+#include <list>
+#include <mutex>
 
 #include "amc_toolpathentity.hpp"
+#include "amc_toolpathlayertiletree.hpp"
 #include "amc_scatterplot.hpp"
 #include "libmcdata_dynamic.hpp"
 
+// Number of layer tile trees that are kept in memory for the layer view.
+#define AMC_TOOLPATH_MAXCACHEDLAYERTILETREES 16
+
+// Default memory budget of stored scatterplots. Least recently used scatterplots are evicted first.
+#define AMC_TOOLPATH_DEFAULTSCATTERPLOTMEMORYBUDGET (1024ULL * 1024ULL * 1024ULL)
+
 namespace AMC {
 
 	
@@ -60,7 +69,21 @@ namespace AMC {
 
 		std::set<std::string> m_AttachmentRelationsToRead;
 
+		std::mutex m_ScatterplotMutex;
 		std::map<std::string, PScatterplot> m_Scatterplots;
+		// Most recently used scatterplot first
+		std::list<std::string> m_ScatterplotUsage;
+		uint64_t m_nScatterplotMemoryBudget;
+
+		void evictScatterplots(const std::string& sUUIDToKeep);
+
+		std::mutex m_LayerTileTreeMutex;
+		std::map<std::pair<std::string, uint32_t>, PToolpathLayerTileTree> m_LayerTileTrees;
+		// Most recently used layer first
+		std::list<std::pair<std::string, uint32_t>> m_LayerTileTreeUsage;
+
+		// Removes the cached tile trees of a toolpath. An empty UUID removes all tile trees.
+		void clearLayerTileTrees(const std::string& sStreamUUID);
 
 	public:
 
@@ -84,6 +107,13 @@ namespace AMC {
 		void storeScatterplot (PScatterplot pScatterplot);
 		PScatterplot restoreScatterplot(const std::string & sUUID, bool bMustExist);
 
+		void setScatterplotMemoryBudget(uint64_t nMemoryBudgetInBytes);
+		uint64_t getScatterplotMemoryBudget();
+		uint64_t getScatterplotMemoryUsage();
+
+		// Returns the cached tile tree of a layer, or builds it from the toolpath entity.
+		PToolpathLayerTileTree retrieveLayerTileTree(CToolpathEntity* pToolpathEntity, const std::string& sStreamUUID, uint32_t nLayerIndex, bool & bTreeWasBuilt);
+
 	};
 
 	
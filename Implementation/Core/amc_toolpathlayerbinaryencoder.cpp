@@ -0,0 +1,234 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "amc_toolpathlayerbinaryencoder.hpp"
+#include "libmc_exceptiontypes.hpp"
+
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+namespace AMC {
+
+	template <typename T> static void appendBinaryValue(std::vector<uint8_t>& buffer, const T value)
+	{
+		size_t nOffset = buffer.size();
+		buffer.resize(nOffset + sizeof(T));
+		memcpy(&buffer[nOffset], &value, sizeof(T));
+	}
+
+	template <typename T> static void writeBinaryValueAt(std::vector<uint8_t>& buffer, size_t nOffset, const T value)
+	{
+		if (nOffset + sizeof(T) > buffer.size())
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDINDEX);
+		memcpy(&buffer[nOffset], &value, sizeof(T));
+	}
+
+	static void padBinaryToAlignment(std::vector<uint8_t>& buffer)
+	{
+		while ((buffer.size() % 4) != 0)
+			buffer.push_back(0);
+	}
+
+	static void appendAbsolutePoint(std::vector<int16_t>& pointWords, int32_t nX, int32_t nY)
+	{
+		pointWords.push_back(AMC_TOOLPATHBINARY_POINTESCAPE);
+		pointWords.push_back((int16_t)(uint16_t)((uint32_t)nX & 0xffff));
+		pointWords.push_back((int16_t)(uint16_t)((uint32_t)nX >> 16));
+		pointWords.push_back((int16_t)(uint16_t)((uint32_t)nY & 0xffff));
+		pointWords.push_back((int16_t)(uint16_t)((uint32_t)nY >> 16));
+	}
+
+	sToolpathLayerBinaryEncodingInfo CToolpathLayerBinaryEncoder::encodeLayer(CToolpathLayerTileTree* pTileTree, uint32_t nLayerIndex, int32_t nViewMinX, int32_t nViewMinY, int32_t nViewMaxX, int32_t nViewMaxY, int32_t nResolutionInUnits, bool bTreeWasBuilt, std::vector<uint8_t>& buffer)
+	{
+		LibMCAssertNotNull(pTileTree);
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+
+		std::vector<sToolpathLayerTileSelection> selection;
+		pTileTree->queryPrimitives(nViewMinX, nViewMinY, nViewMaxX, nViewMaxY, nResolutionInUnits, selection);
+
+		// Half a pixel of quantisation keeps the error below the display resolution
+		int32_t nQuantisation = std::max<int32_t>(1, nResolutionInUnits / 2);
+
+		int32_t nOriginX, nOriginY, nExtentMaxX, nExtentMaxY;
+		pTileTree->getExtents(nOriginX, nOriginY, nExtentMaxX, nExtentMaxY);
+
+		std::vector<uint32_t> tileFirstSegments;
+		std::vector<uint32_t> tileSegmentCounts;
+		std::vector<uint32_t> segmentPointCounts;
+		std::vector<uint32_t> segmentProfileIndices;
+		std::vector<uint32_t> segmentPartIDs;
+		std::vector<uint32_t> segmentLaserIndices;
+		std::vector<uint8_t> segmentTypes;
+		std::vector<int16_t> pointWords;
+		uint64_t nTotalPointCount = 0;
+
+		for (auto& tileSelection : selection) {
+
+			uint32_t nTileFirstSegment = (uint32_t)segmentPointCounts.size();
+
+			uint32_t nCurrentSegmentIndex = 0;
+			bool bSegmentIsOpen = false;
+			int32_t nLastX = 0;
+			int32_t nLastY = 0;
+
+			for (auto nPrimitiveIndex : tileSelection.m_PrimitiveIndices) {
+				auto& primitive = pTileTree->getPrimitive(nPrimitiveIndex);
+				auto& segment = pTileTree->getSegment(primitive.m_nSegmentIndex);
+				bool bIsHatch = (segment.m_Type == LibMCEnv::eToolpathSegmentType::Hatch);
+
+				// Hatch lines of the same segment within one tile are merged into one output segment
+				if ((!bSegmentIsOpen) || (!bIsHatch) || (nCurrentSegmentIndex != primitive.m_nSegmentIndex)) {
+					segmentPointCounts.push_back(0);
+					segmentProfileIndices.push_back(segment.m_nProfileIndex);
+					segmentPartIDs.push_back(segment.m_nLocalPartID);
+					segmentLaserIndices.push_back(segment.m_nLaserIndex);
+					segmentTypes.push_back((uint8_t)segment.m_Type);
+
+					nCurrentSegmentIndex = primitive.m_nSegmentIndex;
+					bSegmentIsOpen = true;
+					nLastX = 0;
+					nLastY = 0;
+				}
+
+				bool bIsFirstPoint = (segmentPointCounts.back() == 0);
+				auto pPoint = pTileTree->getPointData(primitive.m_nPointStartIndex, primitive.m_nPointCount);
+				for (uint32_t nPointIndex = 0; nPointIndex < primitive.m_nPointCount; nPointIndex++) {
+					int32_t nX = (int32_t)(((int64_t)pPoint->m_Coordinates[0] - nOriginX) / nQuantisation);
+					int32_t nY = (int32_t)(((int64_t)pPoint->m_Coordinates[1] - nOriginY) / nQuantisation);
+					pPoint++;
+
+					// Loops and polylines drop points that collapse at the requested resolution
+					if ((!bIsHatch) && (!bIsFirstPoint) && (nX == nLastX) && (nY == nLastY) && (nPointIndex + 1 < primitive.m_nPointCount))
+						continue;
+
+					int64_t nDeltaX = (int64_t)nX - nLastX;
+					int64_t nDeltaY = (int64_t)nY - nLastY;
+					if (bIsFirstPoint || (std::abs(nDeltaX) > INT16_MAX) || (std::abs(nDeltaY) > INT16_MAX)) {
+						appendAbsolutePoint(pointWords, nX, nY);
+					}
+					else {
+						pointWords.push_back((int16_t)nDeltaX);
+						pointWords.push_back((int16_t)nDeltaY);
+					}
+
+					nLastX = nX;
+					nLastY = nY;
+					bIsFirstPoint = false;
+					segmentPointCounts.back()++;
+					nTotalPointCount++;
+				}
+
+				if (!bIsHatch)
+					bSegmentIsOpen = false;
+			}
+
+			tileFirstSegments.push_back(nTileFirstSegment);
+			tileSegmentCounts.push_back((uint32_t)segmentPointCounts.size() - nTileFirstSegment);
+		}
+
+		auto& profiles = pTileTree->getProfiles();
+
+		appendBinaryValue<uint32_t>(buffer, AMC_TOOLPATHBINARY_MAGIC);
+		appendBinaryValue<uint32_t>(buffer, AMC_TOOLPATHBINARY_VERSION);
+		appendBinaryValue<uint32_t>(buffer, nLayerIndex);
+		appendBinaryValue<int32_t>(buffer, nQuantisation);
+		appendBinaryValue<double>(buffer, pTileTree->getUnits());
+		appendBinaryValue<int32_t>(buffer, nOriginX);
+		appendBinaryValue<int32_t>(buffer, nOriginY);
+		appendBinaryValue<int32_t>(buffer, nExtentMaxX);
+		appendBinaryValue<int32_t>(buffer, nExtentMaxY);
+		appendBinaryValue<uint32_t>(buffer, (uint32_t)selection.size());
+		appendBinaryValue<uint32_t>(buffer, (uint32_t)segmentPointCounts.size());
+		appendBinaryValue<uint32_t>(buffer, (uint32_t)nTotalPointCount);
+		appendBinaryValue<uint32_t>(buffer, (uint32_t)profiles.size());
+		appendBinaryValue<uint32_t>(buffer, bTreeWasBuilt ? (uint32_t)pTileTree->getBuildTimeInMicroseconds() : 0);
+		size_t nEncodingTimeOffset = buffer.size();
+		appendBinaryValue<uint32_t>(buffer, 0);
+
+		for (size_t nTileIndex = 0; nTileIndex < selection.size(); nTileIndex++) {
+			auto& node = pTileTree->getNode(selection[nTileIndex].m_nNodeIndex);
+			appendBinaryValue<uint32_t>(buffer, node.m_nLevel);
+			appendBinaryValue<uint32_t>(buffer, node.m_nTileX);
+			appendBinaryValue<uint32_t>(buffer, node.m_nTileY);
+			appendBinaryValue<uint32_t>(buffer, tileFirstSegments[nTileIndex]);
+			appendBinaryValue<uint32_t>(buffer, tileSegmentCounts[nTileIndex]);
+		}
+
+		for (auto& iter : profiles) {
+			auto& profile = iter.second;
+			appendBinaryValue<uint32_t>(buffer, profile.m_nProfileIndex);
+			appendBinaryValue<float>(buffer, (float)profile.m_dLaserPower);
+			appendBinaryValue<float>(buffer, (float)profile.m_dLaserSpeed);
+			appendBinaryValue<uint32_t>(buffer, ((profile.m_nProfileIndex + 1) * 12347328) & 0xFFFFFF);
+			appendBinaryValue<uint32_t>(buffer, (uint32_t)profile.m_sName.length());
+			for (auto cChar : profile.m_sName)
+				appendBinaryValue<char>(buffer, cChar);
+			padBinaryToAlignment(buffer);
+		}
+
+		for (auto nValue : segmentPointCounts)
+			appendBinaryValue<uint32_t>(buffer, nValue);
+		for (auto nValue : segmentProfileIndices)
+			appendBinaryValue<uint32_t>(buffer, nValue);
+		for (auto nValue : segmentPartIDs)
+			appendBinaryValue<uint32_t>(buffer, nValue);
+		for (auto nValue : segmentLaserIndices)
+			appendBinaryValue<uint32_t>(buffer, nValue);
+		for (auto nValue : segmentTypes)
+			appendBinaryValue<uint8_t>(buffer, nValue);
+		padBinaryToAlignment(buffer);
+
+		appendBinaryValue<uint32_t>(buffer, (uint32_t)pointWords.size());
+		if (!pointWords.empty()) {
+			size_t nOffset = buffer.size();
+			buffer.resize(nOffset + pointWords.size() * sizeof(int16_t));
+			memcpy(&buffer[nOffset], pointWords.data(), pointWords.size() * sizeof(int16_t));
+		}
+		padBinaryToAlignment(buffer);
+
+		auto endTime = std::chrono::high_resolution_clock::now();
+		uint64_t nEncodingTimeInMicroseconds = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count();
+		writeBinaryValueAt<uint32_t>(buffer, nEncodingTimeOffset, (uint32_t)nEncodingTimeInMicroseconds);
+
+		sToolpathLayerBinaryEncodingInfo info;
+		info.m_nTileCount = (uint32_t)selection.size();
+		info.m_nSegmentCount = (uint32_t)segmentPointCounts.size();
+		info.m_nPointCount = nTotalPointCount;
+		info.m_nEncodingTimeInMicroseconds = nEncodingTimeInMicroseconds;
+
+		return info;
+	}
+
+}
+
@@ -0,0 +1,83 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMC_TOOLPATHLAYERBINARYENCODER
+#define __AMC_TOOLPATHLAYERBINARYENCODER
+
+#include <vector>
+#include <cstdint>
+
+#include "amc_toolpathlayertiletree.hpp"
+
+#define AMC_TOOLPATHBINARY_MAGIC 0x50544D41 // "AMTP"
+#define AMC_TOOLPATHBINARY_VERSION 1
+#define AMC_TOOLPATHBINARY_POINTESCAPE (-32768)
+
+// Maximum display resolution in mm
+#define AMC_TOOLPATHBINARY_MAXRESOLUTION 1000.0
+
+namespace AMC {
+
+	typedef struct _sToolpathLayerBinaryEncodingInfo {
+		uint32_t m_nTileCount;
+		uint32_t m_nSegmentCount;
+		uint64_t m_nPointCount;
+		uint64_t m_nEncodingTimeInMicroseconds;
+	} sToolpathLayerBinaryEncodingInfo;
+
+	/*************************************************************************************************************************
+	 Binary toolpath layer format. All values are little endian and every section is padded to 4 bytes.
+
+	 Header:
+	   uint32 magic, uint32 version, uint32 layer index, int32 quantisation step (in units), double units (in mm)
+	   int32 origin X, int32 origin Y, int32 extent max X, int32 extent max Y
+	   uint32 tile count, uint32 segment count, uint32 point count, uint32 profile count
+	   uint32 tile tree build time (in microseconds, 0 if cached), uint32 encoding time (in microseconds)
+	 Tiles:    (uint32 level, uint32 tile X, uint32 tile Y, uint32 first segment, uint32 segment count) per tile
+	 Profiles: (uint32 profile index, float laser power, float laser speed, uint32 color, uint32 name length, name) per profile
+	 Segments: uint32 point count[], uint32 profile index[], uint32 part ID[], uint32 laser index[], uint8 segment type[]
+	 Points:   uint32 word count, int16 words[]
+	   Every segment starts with an escape word followed by its first point as two absolute int32.
+	   All further points are int16 deltas (dx, dy), unless they do not fit, in which case an escape word and an
+	   absolute int32 point follows. Absolute coordinates are in quantisation steps relative to the origin.
+	**************************************************************************************************************************/
+	class CToolpathLayerBinaryEncoder {
+	public:
+
+		// Appends the tiles of the tile tree that intersect the viewport (in units) to the buffer.
+		static sToolpathLayerBinaryEncodingInfo encodeLayer(CToolpathLayerTileTree* pTileTree, uint32_t nLayerIndex, int32_t nViewMinX, int32_t nViewMinY, int32_t nViewMaxX, int32_t nViewMaxY, int32_t nResolutionInUnits, bool bTreeWasBuilt, std::vector<uint8_t>& buffer);
+
+	};
+
+}
+
+
+#endif //__AMC_TOOLPATHLAYERBINARYENCODER
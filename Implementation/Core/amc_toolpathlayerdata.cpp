@@ -36,6 +36,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "amc_parametertype.hpp"
 
+#include <cstring>
+#include <limits>
+
 namespace AMC {
 
 
@@ -600,6 +603,12 @@ namespace AMC {
 				std::string sParameterValue = p3MFProfile->GetParameterValue(sParameterNamespace, sParameterName);
 
 				pLayerProfile->addValue(sParameterNamespace, sParameterName, sParameterValue);
+
+				auto valueKey = std::make_pair(sParameterNamespace, sParameterName);
+				if (m_ProfileValueIDMap.find(valueKey) == m_ProfileValueIDMap.end()) {
+					m_ProfileValueNames.push_back(valueKey);
+					m_ProfileValueIDMap.insert(std::make_pair(valueKey, (uint32_t)m_ProfileValueNames.size()));
+				}
 			}
 
 
@@ -836,6 +845,137 @@ namespace AMC {
 	}
 
 
+	void CToolpathLayerData::storeSegmentTable(uint32_t* pSegmentTypes, uint32_t* pPointOffsets, uint32_t* pLocalPartIDs, uint32_t* pProfileIDs)
+	{
+		size_t nSegmentCount = m_Segments.size();
+
+		for (size_t nSegmentIndex = 0; nSegmentIndex < nSegmentCount; nSegmentIndex++) {
+			auto& segment = m_Segments[nSegmentIndex];
+			if (pSegmentTypes != nullptr)
+				pSegmentTypes[nSegmentIndex] = (uint32_t)segment.m_Type;
+			if (pPointOffsets != nullptr)
+				pPointOffsets[nSegmentIndex] = segment.m_PointStartIndex;
+			if (pLocalPartIDs != nullptr)
+				pLocalPartIDs[nSegmentIndex] = segment.m_LocalPartID;
+			if (pProfileIDs != nullptr)
+				pProfileIDs[nSegmentIndex] = segment.m_ProfileUUID;
+		}
+
+		if (pPointOffsets != nullptr)
+			pPointOffsets[nSegmentCount] = (uint32_t)m_Points.size();
+	}
+
+	uint32_t CToolpathLayerData::findProfileValueID(const std::string& sNameSpace, const std::string& sValueName)
+	{
+		auto iIter = m_ProfileValueIDMap.find(std::make_pair(sNameSpace, sValueName));
+		if (iIter != m_ProfileValueIDMap.end())
+			return iIter->second;
+
+		return 0;
+	}
+
+	bool CToolpathLayerData::getProfileValueName(uint32_t nValueID, std::string& sNameSpace, std::string& sValueName)
+	{
+		if ((nValueID < 1) || (nValueID > m_ProfileValueNames.size()))
+			return false;
+
+		auto& valueKey = m_ProfileValueNames.at((size_t)nValueID - 1);
+		sNameSpace = valueKey.first;
+		sValueName = valueKey.second;
+		return true;
+	}
+
+	void CToolpathLayerData::storeProfileValueColumns(const std::vector<sToolpathLayerProfileColumn>& columns, double* pValueData)
+	{
+		size_t nColumnCount = columns.size();
+		if (nColumnCount == 0)
+			return;
+		LibMCAssertNotNull(pValueData);
+
+		// Profiles are shared by many segments, so every profile is only resolved once.
+		std::vector<double> profileRows((m_UUIDs.size() + 1) * nColumnCount);
+		std::vector<bool> profileIsResolved(m_UUIDs.size() + 1, false);
+
+		double* pTarget = pValueData;
+		for (auto& segment : m_Segments) {
+			uint32_t nProfileID = segment.m_ProfileUUID;
+			double* pRow = &profileRows[(size_t)nProfileID * nColumnCount];
+
+			if (!profileIsResolved[nProfileID]) {
+				PToolpathLayerProfile pProfile;
+				auto iIter = m_ProfileMap.find(getRegisteredUUID(nProfileID));
+				if (iIter != m_ProfileMap.end())
+					pProfile = iIter->second;
+
+				for (size_t nColumnIndex = 0; nColumnIndex < nColumnCount; nColumnIndex++) {
+					auto& column = columns[nColumnIndex];
+					double dValue = column.m_dDefaultValue;
+
+					if (pProfile.get() != nullptr) {
+						std::string sValueName;
+						if (pProfile->hasValue(column.m_sNameSpace, column.m_sValueName))
+							sValueName = column.m_sValueName;
+						else if ((!column.m_sFallbackValueName.empty()) && pProfile->hasValue(column.m_sNameSpace, column.m_sFallbackValueName))
+							sValueName = column.m_sFallbackValueName;
+
+						if (!sValueName.empty()) {
+							// Non-numeric values are marked with NaN, so that the caller can report them with the per-segment accessors.
+							try {
+								dValue = pProfile->getDoubleValue(column.m_sNameSpace, sValueName);
+							}
+							catch (...) {
+								dValue = std::numeric_limits<double>::quiet_NaN();
+							}
+						}
+					}
+
+					pRow[nColumnIndex] = dValue;
+				}
+
+				profileIsResolved[nProfileID] = true;
+			}
+
+			for (size_t nColumnIndex = 0; nColumnIndex < nColumnCount; nColumnIndex++)
+				pTarget[nColumnIndex] = pRow[nColumnIndex];
+			pTarget += nColumnCount;
+		}
+	}
+
+	void CToolpathLayerData::storeIntegerAttributeColumns(const uint32_t* pAttributeIDs, size_t nAttributeCount, int64_t* pValueData)
+	{
+		if (nAttributeCount == 0)
+			return;
+		LibMCAssertNotNull(pAttributeIDs);
+		LibMCAssertNotNull(pValueData);
+
+		for (size_t nAttributeIndex = 0; nAttributeIndex < nAttributeCount; nAttributeIndex++) {
+			uint32_t nAttributeID = pAttributeIDs[nAttributeIndex];
+			if ((nAttributeID < 1) || (nAttributeID > m_CustomSegmentAttributes.size()))
+				throw ELibMCCustomException(LIBMC_ERROR_INVALIDTOOLPATHATTRIBUTEID, m_sDebugName);
+			if (m_CustomSegmentAttributes.at(nAttributeID - 1)->getAttributeType() != LibMCEnv::eToolpathAttributeType::Integer)
+				throw ELibMCCustomException(LIBMC_ERROR_INVALIDTOOLPATHATTRIBUTETYPE, m_sDebugName);
+		}
+
+		int64_t* pTarget = pValueData;
+		for (auto& segment : m_Segments) {
+			for (size_t nAttributeIndex = 0; nAttributeIndex < nAttributeCount; nAttributeIndex++)
+				pTarget[nAttributeIndex] = segment.m_AttributeData[pAttributeIDs[nAttributeIndex] - 1];
+			pTarget += nAttributeCount;
+		}
+	}
+
+	uint64_t CToolpathLayerData::getTotalPointCount()
+	{
+		return m_Points.size();
+	}
+
+	void CToolpathLayerData::storeAllPointsToBufferInUnits(LibMCEnv::sPosition2D* pPositionData)
+	{
+		LibMCAssertNotNull(pPositionData);
+		if (m_Points.size() > 0)
+			memcpy(pPositionData, m_Points.data(), m_Points.size() * sizeof(LibMCEnv::sPosition2D));
+	}
+
 	std::string CToolpathLayerData::getValueNameByType(const LibMCEnv::eToolpathProfileValueType eValueType)
 	{
 		switch (eValueType) {
@@ -66,6 +66,15 @@ namespace AMC {
 		double m_dFactors[3]; // F, G and H
 	} sToolpathLayerOverride;
 
+	// Numeric profile value that is exported as one column per segment.
+	// If the value does not exist, the fallback value is used, then the default.
+	typedef struct _sToolpathLayerProfileColumn {
+		std::string m_sNameSpace;
+		std::string m_sValueName;
+		std::string m_sFallbackValueName;
+		double m_dDefaultValue;
+	} sToolpathLayerProfileColumn;
+
 	class CToolpathCustomSegmentAttribute {
 	private:
 		uint32_t m_nAttributeID;
@@ -136,6 +145,10 @@ namespace AMC {
 		std::map<std::string, uint32_t> m_UUIDMap;
 		std::map<std::string, PToolpathLayerProfile> m_ProfileMap;
 
+		// IDs of all profile value names that occur in the layer, starting with 1. Filled while loading.
+		std::map<std::pair<std::string, std::string>, uint32_t> m_ProfileValueIDMap;
+		std::vector<std::pair<std::string, std::string>> m_ProfileValueNames;
+
 		std::vector<std::pair<std::pair<std::string, std::string>, std::string>> m_CustomData;
 
 		std::string m_sDebugName;
@@ -193,6 +206,17 @@ namespace AMC {
 
 		void storeHatchOverrides(uint32_t nSegmentIndex, LibMCEnv::eToolpathProfileOverrideFactor eOverrideFactor, LibMCEnv::sHatch2DOverrides* pOverrideData);
 
+		// Bulk export of the whole layer. Output buffers must hold getSegmentCount () entries
+		// (getSegmentCount () + 1 point offsets) and may be null if not needed.
+		void storeSegmentTable(uint32_t* pSegmentTypes, uint32_t* pPointOffsets, uint32_t* pLocalPartIDs, uint32_t* pProfileIDs);
+		uint32_t findProfileValueID(const std::string& sNameSpace, const std::string& sValueName);
+		bool getProfileValueName(uint32_t nValueID, std::string& sNameSpace, std::string& sValueName);
+		void storeProfileValueColumns(const std::vector<sToolpathLayerProfileColumn>& columns, double* pValueData);
+		void storeIntegerAttributeColumns(const uint32_t* pAttributeIDs, size_t nAttributeCount, int64_t* pValueData);
+
+		uint64_t getTotalPointCount();
+		void storeAllPointsToBufferInUnits(LibMCEnv::sPosition2D* pPositionData);
+
 		static std::string getValueNameByType(const LibMCEnv::eToolpathProfileValueType eValueType);
 
 	};
@@ -0,0 +1,343 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "amc_toolpathlayertiletree.hpp"
+#include "libmc_exceptiontypes.hpp"
+
+#include <chrono>
+#include <algorithm>
+
+namespace AMC {
+
+	CToolpathLayerTileTree::CToolpathLayerTileTree(CToolpathLayerData* pLayerData)
+		: m_dUnits (1.0), m_nMinX (0), m_nMinY (0), m_nMaxX (0), m_nMaxY (0), m_nBuildTimeInMicroseconds (0)
+	{
+		LibMCAssertNotNull(pLayerData);
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+
+		m_dUnits = pLayerData->getUnits();
+		pLayerData->calculateExtents(m_nMinX, m_nMinY, m_nMaxX, m_nMaxY);
+
+		std::string sLaserPowerValueName = CToolpathLayerData::getValueNameByType(LibMCEnv::eToolpathProfileValueType::LaserPower);
+		std::string sLaserSpeedValueName = CToolpathLayerData::getValueNameByType(LibMCEnv::eToolpathProfileValueType::Speed);
+
+		uint32_t nSegmentCount = pLayerData->getSegmentCount();
+		uint64_t nTotalPointCount = 0;
+		for (uint32_t nSegmentIndex = 0; nSegmentIndex < nSegmentCount; nSegmentIndex++)
+			nTotalPointCount += pLayerData->getSegmentPointCount(nSegmentIndex);
+
+		m_Points.resize(nTotalPointCount);
+		m_Segments.resize(nSegmentCount);
+
+		// The root node spans a square over the layer extents, so that all tiles of a level have the same size.
+		int64_t nRootSize = std::max<int64_t>((int64_t)m_nMaxX - (int64_t)m_nMinX, (int64_t)m_nMaxY - (int64_t)m_nMinY) + 1;
+
+		sToolpathLayerTileNode rootNode;
+		rootNode.m_nLevel = 0;
+		rootNode.m_nTileX = 0;
+		rootNode.m_nTileY = 0;
+		rootNode.m_nMinX = m_nMinX;
+		rootNode.m_nMinY = m_nMinY;
+		rootNode.m_nMaxX = (int64_t)m_nMinX + nRootSize;
+		rootNode.m_nMaxY = (int64_t)m_nMinY + nRootSize;
+		for (uint32_t nQuadrant = 0; nQuadrant < 4; nQuadrant++)
+			rootNode.m_nChildIndices[nQuadrant] = 0;
+		m_Nodes.push_back(rootNode);
+
+		uint32_t nPointStartIndex = 0;
+		for (uint32_t nSegmentIndex = 0; nSegmentIndex < nSegmentCount; nSegmentIndex++) {
+
+			auto pProfile = pLayerData->getSegmentProfile(nSegmentIndex);
+			uint32_t nProfileIndex = pProfile->getProfileIndex();
+
+			auto pSegment = &m_Segments.at(nSegmentIndex);
+			pSegment->m_Type = pLayerData->getSegmentType(nSegmentIndex);
+			pSegment->m_nProfileIndex = nProfileIndex;
+			pSegment->m_nLocalPartID = pLayerData->getSegmentLocalPartID(nSegmentIndex);
+			pSegment->m_nLaserIndex = pLayerData->getSegmentLaserIndex(nSegmentIndex);
+
+			if (m_Profiles.find(nProfileIndex) == m_Profiles.end()) {
+				sToolpathLayerTileProfile profile;
+				profile.m_nProfileIndex = nProfileIndex;
+				profile.m_sName = pProfile->getName();
+				profile.m_dLaserPower = pProfile->getDoubleValueDef("", sLaserPowerValueName, 0.0);
+				profile.m_dLaserSpeed = pProfile->getDoubleValueDef("", sLaserSpeedValueName, 0.0);
+				m_Profiles.insert(std::make_pair(nProfileIndex, profile));
+			}
+
+			uint32_t nPointCount = pLayerData->getSegmentPointCount(nSegmentIndex);
+			if (nPointCount > 0) {
+				pLayerData->storePointsToBufferInUnits(nSegmentIndex, &m_Points.at(nPointStartIndex));
+
+				switch (pSegment->m_Type) {
+				case LibMCEnv::eToolpathSegmentType::Hatch: {
+					uint32_t nHatchCount = nPointCount / 2;
+					for (uint32_t nHatchIndex = 0; nHatchIndex < nHatchCount; nHatchIndex++)
+						addPrimitive(nSegmentIndex, nPointStartIndex + nHatchIndex * 2, 2);
+					break;
+				}
+
+				case LibMCEnv::eToolpathSegmentType::Loop:
+				case LibMCEnv::eToolpathSegmentType::Polyline:
+					addPrimitive(nSegmentIndex, nPointStartIndex, nPointCount);
+					break;
+
+				default:
+					break;
+				}
+
+				nPointStartIndex += nPointCount;
+			}
+
+		}
+
+		auto endTime = std::chrono::high_resolution_clock::now();
+		m_nBuildTimeInMicroseconds = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count();
+
+	}
+
+	CToolpathLayerTileTree::~CToolpathLayerTileTree()
+	{
+
+	}
+
+	void CToolpathLayerTileTree::addPrimitive(uint32_t nSegmentIndex, uint32_t nPointStartIndex, uint32_t nPointCount)
+	{
+		sToolpathLayerTilePrimitive primitive;
+		primitive.m_nSegmentIndex = nSegmentIndex;
+		primitive.m_nPointStartIndex = nPointStartIndex;
+		primitive.m_nPointCount = nPointCount;
+
+		auto pPoint = &m_Points.at(nPointStartIndex);
+		primitive.m_nMinX = pPoint->m_Coordinates[0];
+		primitive.m_nMinY = pPoint->m_Coordinates[1];
+		primitive.m_nMaxX = pPoint->m_Coordinates[0];
+		primitive.m_nMaxY = pPoint->m_Coordinates[1];
+
+		for (uint32_t nPointIndex = 1; nPointIndex < nPointCount; nPointIndex++) {
+			pPoint++;
+			primitive.m_nMinX = std::min(primitive.m_nMinX, pPoint->m_Coordinates[0]);
+			primitive.m_nMinY = std::min(primitive.m_nMinY, pPoint->m_Coordinates[1]);
+			primitive.m_nMaxX = std::max(primitive.m_nMaxX, pPoint->m_Coordinates[0]);
+			primitive.m_nMaxY = std::max(primitive.m_nMaxY, pPoint->m_Coordinates[1]);
+		}
+
+		uint32_t nPrimitiveIndex = (uint32_t)m_Primitives.size();
+		m_Primitives.push_back(primitive);
+
+		// Descend as long as the primitive fits completely into one quadrant
+		uint32_t nNodeIndex = 0;
+		while (m_Nodes.at(nNodeIndex).m_nLevel < AMC_TOOLPATHTILETREE_MAXLEVEL) {
+			auto& node = m_Nodes.at(nNodeIndex);
+
+			int64_t nHalfSize = (node.m_nMaxX - node.m_nMinX) / 2;
+			if (nHalfSize < AMC_TOOLPATHTILETREE_MINTILESIZE)
+				break;
+
+			int64_t nCenterX = node.m_nMinX + nHalfSize;
+			int64_t nCenterY = node.m_nMinY + nHalfSize;
+
+			uint32_t nQuadrant;
+			if (primitive.m_nMaxX < nCenterX) {
+				nQuadrant = 0;
+			}
+			else if (primitive.m_nMinX >= nCenterX) {
+				nQuadrant = 1;
+			}
+			else
+				break;
+
+			if (primitive.m_nMinY >= nCenterY) {
+				nQuadrant += 2;
+			}
+			else if (primitive.m_nMaxY >= nCenterY)
+				break;
+
+			nNodeIndex = getOrCreateChildNode(nNodeIndex, nQuadrant);
+		}
+
+		m_Nodes.at(nNodeIndex).m_PrimitiveIndices.push_back(nPrimitiveIndex);
+	}
+
+	uint32_t CToolpathLayerTileTree::getOrCreateChildNode(uint32_t nParentIndex, uint32_t nQuadrant)
+	{
+		if (nQuadrant >= 4)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDTOOLPATHTILEINDEX);
+
+		uint32_t nChildIndex = m_Nodes.at(nParentIndex).m_nChildIndices[nQuadrant];
+		if (nChildIndex != 0)
+			return nChildIndex;
+
+		// Copy the parent values, as push_back may invalidate references into the node array
+		auto parentNode = m_Nodes.at(nParentIndex);
+		int64_t nHalfSize = (parentNode.m_nMaxX - parentNode.m_nMinX) / 2;
+
+		sToolpathLayerTileNode childNode;
+		childNode.m_nLevel = parentNode.m_nLevel + 1;
+		childNode.m_nTileX = parentNode.m_nTileX * 2 + (nQuadrant & 1);
+		childNode.m_nTileY = parentNode.m_nTileY * 2 + (nQuadrant >> 1);
+		childNode.m_nMinX = ((nQuadrant & 1) != 0) ? (parentNode.m_nMinX + nHalfSize) : parentNode.m_nMinX;
+		childNode.m_nMinY = ((nQuadrant & 2) != 0) ? (parentNode.m_nMinY + nHalfSize) : parentNode.m_nMinY;
+		childNode.m_nMaxX = ((nQuadrant & 1) != 0) ? parentNode.m_nMaxX : (parentNode.m_nMinX + nHalfSize);
+		childNode.m_nMaxY = ((nQuadrant & 2) != 0) ? parentNode.m_nMaxY : (parentNode.m_nMinY + nHalfSize);
+		for (uint32_t nIndex = 0; nIndex < 4; nIndex++)
+			childNode.m_nChildIndices[nIndex] = 0;
+
+		nChildIndex = (uint32_t)m_Nodes.size();
+		m_Nodes.push_back(childNode);
+		m_Nodes.at(nParentIndex).m_nChildIndices[nQuadrant] = nChildIndex;
+
+		return nChildIndex;
+	}
+
+	double CToolpathLayerTileTree::getUnits()
+	{
+		return m_dUnits;
+	}
+
+	void CToolpathLayerTileTree::getExtents(int32_t& nMinX, int32_t& nMinY, int32_t& nMaxX, int32_t& nMaxY)
+	{
+		nMinX = m_nMinX;
+		nMinY = m_nMinY;
+		nMaxX = m_nMaxX;
+		nMaxY = m_nMaxY;
+	}
+
+	uint64_t CToolpathLayerTileTree::getBuildTimeInMicroseconds()
+	{
+		return m_nBuildTimeInMicroseconds;
+	}
+
+	uint32_t CToolpathLayerTileTree::getNodeCount()
+	{
+		return (uint32_t)m_Nodes.size();
+	}
+
+	uint32_t CToolpathLayerTileTree::getSegmentCount()
+	{
+		return (uint32_t)m_Segments.size();
+	}
+
+	uint64_t CToolpathLayerTileTree::getPointCount()
+	{
+		return m_Points.size();
+	}
+
+	const sToolpathLayerTileNode& CToolpathLayerTileTree::getNode(uint32_t nNodeIndex)
+	{
+		if (nNodeIndex >= m_Nodes.size())
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDTOOLPATHTILEINDEX, std::to_string(nNodeIndex));
+
+		return m_Nodes[nNodeIndex];
+	}
+
+	const sToolpathLayerTileSegment& CToolpathLayerTileTree::getSegment(uint32_t nSegmentIndex)
+	{
+		if (nSegmentIndex >= m_Segments.size())
+			throw ELibMCCustomException(LIBMC_ERROR_INVALIDSEGMENTINDEX, std::to_string(nSegmentIndex));
+
+		return m_Segments[nSegmentIndex];
+	}
+
+	const sToolpathLayerTilePrimitive& CToolpathLayerTileTree::getPrimitive(uint32_t nPrimitiveIndex)
+	{
+		if (nPrimitiveIndex >= m_Primitives.size())
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDINDEX);
+
+		return m_Primitives[nPrimitiveIndex];
+	}
+
+	const LibMCEnv::sPosition2D* CToolpathLayerTileTree::getPointData(uint32_t nPointStartIndex, uint32_t nPointCount)
+	{
+		if (((uint64_t)nPointStartIndex + nPointCount > m_Points.size()) || (nPointCount == 0))
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDPOINTCOUNT);
+
+		return &m_Points[nPointStartIndex];
+	}
+
+	const std::map<uint32_t, sToolpathLayerTileProfile>& CToolpathLayerTileTree::getProfiles()
+	{
+		return m_Profiles;
+	}
+
+	void CToolpathLayerTileTree::queryPrimitives(int32_t nViewMinX, int32_t nViewMinY, int32_t nViewMaxX, int32_t nViewMaxY, int32_t nResolutionInUnits, std::vector<sToolpathLayerTileSelection>& selection)
+	{
+		if ((nViewMinX > nViewMaxX) || (nViewMinY > nViewMaxY))
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDTOOLPATHVIEWPORT);
+		if (nResolutionInUnits < 0)
+			throw ELibMCInterfaceException(LIBMC_ERROR_INVALIDTOOLPATHRESOLUTION);
+
+		selection.clear();
+		queryNode(0, nViewMinX, nViewMinY, nViewMaxX, nViewMaxY, nResolutionInUnits, selection);
+	}
+
+	void CToolpathLayerTileTree::queryNode(uint32_t nNodeIndex, int32_t nViewMinX, int32_t nViewMinY, int32_t nViewMaxX, int32_t nViewMaxY, int32_t nResolutionInUnits, std::vector<sToolpathLayerTileSelection>& selection)
+	{
+		auto& node = m_Nodes.at(nNodeIndex);
+
+		if ((node.m_nMaxX < nViewMinX) || (node.m_nMinX > nViewMaxX) || (node.m_nMaxY < nViewMinY) || (node.m_nMinY > nViewMaxY))
+			return;
+
+		// All primitives below this node are smaller than the node itself
+		if ((node.m_nLevel > 0) && ((node.m_nMaxX - node.m_nMinX) < nResolutionInUnits))
+			return;
+
+		if (!node.m_PrimitiveIndices.empty()) {
+			sToolpathLayerTileSelection tileSelection;
+			tileSelection.m_nNodeIndex = nNodeIndex;
+
+			for (auto nPrimitiveIndex : node.m_PrimitiveIndices) {
+				auto& primitive = m_Primitives[nPrimitiveIndex];
+				if ((primitive.m_nMaxX < nViewMinX) || (primitive.m_nMinX > nViewMaxX) || (primitive.m_nMaxY < nViewMinY) || (primitive.m_nMinY > nViewMaxY))
+					continue;
+
+				if (nResolutionInUnits > 0) {
+					if (((primitive.m_nMaxX - primitive.m_nMinX) < nResolutionInUnits) && ((primitive.m_nMaxY - primitive.m_nMinY) < nResolutionInUnits))
+						continue;
+				}
+
+				tileSelection.m_PrimitiveIndices.push_back(nPrimitiveIndex);
+			}
+
+			if (!tileSelection.m_PrimitiveIndices.empty())
+				selection.push_back(std::move(tileSelection));
+		}
+
+		for (uint32_t nQuadrant = 0; nQuadrant < 4; nQuadrant++) {
+			uint32_t nChildIndex = node.m_nChildIndices[nQuadrant];
+			if (nChildIndex != 0)
+				queryNode(nChildIndex, nViewMinX, nViewMinY, nViewMaxX, nViewMaxY, nResolutionInUnits, selection);
+		}
+	}
+
+}
+
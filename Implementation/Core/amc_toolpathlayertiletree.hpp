@@ -0,0 +1,154 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef __AMC_TOOLPATHLAYERTILETREE
+#define __AMC_TOOLPATHLAYERTILETREE
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+
+#include "amc_toolpathlayerdata.hpp"
+
+// Maximum depth of the layer quadtree. Level 0 is the full layer extent.
+#define AMC_TOOLPATHTILETREE_MAXLEVEL 10
+
+// Tiles are not subdivided further once they are smaller than this size (in toolpath units).
+#define AMC_TOOLPATHTILETREE_MINTILESIZE 64
+
+namespace AMC {
+
+	typedef struct _sToolpathLayerTileSegment {
+		LibMCEnv::eToolpathSegmentType m_Type;
+		uint32_t m_nProfileIndex;
+		uint32_t m_nLocalPartID;
+		uint32_t m_nLaserIndex;
+	} sToolpathLayerTileSegment;
+
+	typedef struct _sToolpathLayerTileProfile {
+		uint32_t m_nProfileIndex;
+		double m_dLaserPower;
+		double m_dLaserSpeed;
+		std::string m_sName;
+	} sToolpathLayerTileProfile;
+
+	// A primitive is a single hatch line, or a complete loop or polyline.
+	typedef struct _sToolpathLayerTilePrimitive {
+		uint32_t m_nSegmentIndex;
+		uint32_t m_nPointStartIndex;
+		uint32_t m_nPointCount;
+		int32_t m_nMinX;
+		int32_t m_nMinY;
+		int32_t m_nMaxX;
+		int32_t m_nMaxY;
+	} sToolpathLayerTilePrimitive;
+
+	typedef struct _sToolpathLayerTileNode {
+		uint32_t m_nLevel;
+		uint32_t m_nTileX;
+		uint32_t m_nTileY;
+		int64_t m_nMinX;
+		int64_t m_nMinY;
+		int64_t m_nMaxX;
+		int64_t m_nMaxY;
+		uint32_t m_nChildIndices[4];
+		std::vector<uint32_t> m_PrimitiveIndices;
+	} sToolpathLayerTileNode;
+
+	typedef struct _sToolpathLayerTileSelection {
+		uint32_t m_nNodeIndex;
+		std::vector<uint32_t> m_PrimitiveIndices;
+	} sToolpathLayerTileSelection;
+
+	class CToolpathLayerTileTree;
+	typedef std::shared_ptr<CToolpathLayerTileTree> PToolpathLayerTileTree;
+
+	// Quadtree over the extents of a toolpath layer. Every primitive is stored in the smallest tile that fully
+	// contains its bounding box, so that a viewer only needs to fetch the tiles that intersect its viewport.
+	class CToolpathLayerTileTree {
+	private:
+
+		double m_dUnits;
+
+		int32_t m_nMinX;
+		int32_t m_nMinY;
+		int32_t m_nMaxX;
+		int32_t m_nMaxY;
+
+		uint64_t m_nBuildTimeInMicroseconds;
+
+		std::vector<LibMCEnv::sPosition2D> m_Points;
+		std::vector<sToolpathLayerTileSegment> m_Segments;
+		std::vector<sToolpathLayerTilePrimitive> m_Primitives;
+		std::vector<sToolpathLayerTileNode> m_Nodes;
+		std::map<uint32_t, sToolpathLayerTileProfile> m_Profiles;
+
+		void addPrimitive(uint32_t nSegmentIndex, uint32_t nPointStartIndex, uint32_t nPointCount);
+
+		uint32_t getOrCreateChildNode(uint32_t nParentIndex, uint32_t nQuadrant);
+
+		void queryNode(uint32_t nNodeIndex, int32_t nViewMinX, int32_t nViewMinY, int32_t nViewMaxX, int32_t nViewMaxY, int32_t nResolutionInUnits, std::vector<sToolpathLayerTileSelection>& selection);
+
+	public:
+
+		CToolpathLayerTileTree(CToolpathLayerData* pLayerData);
+
+		virtual ~CToolpathLayerTileTree();
+
+		double getUnits();
+
+		void getExtents(int32_t& nMinX, int32_t& nMinY, int32_t& nMaxX, int32_t& nMaxY);
+
+		uint64_t getBuildTimeInMicroseconds();
+
+		uint32_t getNodeCount();
+		uint32_t getSegmentCount();
+		uint64_t getPointCount();
+
+		const sToolpathLayerTileNode& getNode(uint32_t nNodeIndex);
+		const sToolpathLayerTileSegment& getSegment(uint32_t nSegmentIndex);
+		const sToolpathLayerTilePrimitive& getPrimitive(uint32_t nPrimitiveIndex);
+		const LibMCEnv::sPosition2D* getPointData(uint32_t nPointStartIndex, uint32_t nPointCount);
+		const std::map<uint32_t, sToolpathLayerTileProfile>& getProfiles();
+
+		// Returns all primitives that intersect the viewport (in units), grouped by tile.
+		// Tiles and primitives that are smaller than the resolution are skipped, as they would not cover a single pixel.
+		void queryPrimitives(int32_t nViewMinX, int32_t nViewMinY, int32_t nViewMaxX, int32_t nViewMaxY, int32_t nResolutionInUnits, std::vector<sToolpathLayerTileSelection>& selection);
+
+	};
+
+}
+
+
+#endif //__AMC_TOOLPATHLAYERTILETREE
+
@@ -46,6 +46,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "amc_ui_handler.hpp"
 #include "amc_resourcepackage.hpp"
 #include "amc_accesscontrol.hpp"
+#include "amc_toolpathhandler.hpp"
 
 #include "amc_api_factory.hpp"
 #include "amc_api_sessionhandler.hpp"
@@ -201,6 +202,22 @@ void CMCContext::ParseConfiguration(const std::string & sXMLString)
 
         }
 
+        auto scatterplotsNode = mainNode.child("scatterplots");
+        if (!scatterplotsNode.empty()) {
+
+            auto memoryBudgetAttrib = scatterplotsNode.attribute("memorybudget");
+            if (!memoryBudgetAttrib.empty()) {
+                // Budget is given in megabytes
+                uint64_t nMemoryBudgetInMB = memoryBudgetAttrib.as_ullong(0);
+                if (nMemoryBudgetInMB == 0)
+                    throw ELibMCCustomException(LIBMC_ERROR_INVALIDSCATTERPLOTMEMORYBUDGET, memoryBudgetAttrib.as_string());
+
+                m_pSystemState->logger()->logMessage("Setting scatterplot memory budget to " + std::to_string(nMemoryBudgetInMB) + " MB", LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
+                m_pSystemState->toolpathHandler()->setScatterplotMemoryBudget(nMemoryBudgetInMB * 1024ULL * 1024ULL);
+            }
+
+        }
+
         auto sCoreResourcePath = m_pSystemState->getLibraryResourcePath("core");
         m_pSystemState->logger()->logMessage("Loading core resources from " + sCoreResourcePath + "...", LOG_SUBSYSTEM_SYSTEM, AMC::eLogLevel::Message);
         auto pResourcePackageStream = std::make_shared<AMCCommon::CImportStream_Native>(sCoreResourcePath);
@@ -37,10 +37,15 @@ Abstract: This is a stub class definition of CDataTable
 #include "libmcenv_datatablewriteoptions.hpp"
 #include "libmcenv_datatablecsvwriteoptions.hpp"
 #include "libmcenv_datatablescatterplotoptions.hpp"
+#include "libmcenv_datatablefilter.hpp"
+#include "libmcenv_datatablesortoptions.hpp"
+#include "libmcenv_datatableaggregationoptions.hpp"
 #include "libmcenv_scatterplot.hpp"
+#include "libmcenv_datatablecodec.hpp"
 
 // Include custom headers here.
 #include "common_utils.hpp"
+#include "common_parallelblocks.hpp"
 #include <vector>
 #include <algorithm>
 #include <cstring>
@@ -75,7 +80,11 @@ struct sLibMCDataTableColumnHeader {
 	uint64_t m_nDescriptionStart;
 	uint32_t m_nDescriptionLength;
 	uint64_t m_nEntryCount;
-	uint32_t m_nReserved[8];
+	// Since stream version 1. Streams of version 0 have these fields set to zero, which means raw and uncompressed.
+	uint32_t m_nCompressionType;
+	uint64_t m_nEncodedDataSize;
+	uint64_t m_nStoredDataSize;
+	uint32_t m_nReserved[3];
 };
 
 
@@ -184,6 +193,23 @@ public:
 		}
 	}
 
+	// Replaces the values with pRawValues[i] * dScaleFactor + dOffset.
+	void copyScaledDataFrom(const int32_t* pRawValues, size_t nCount, double dScaleFactor, double dOffset, uint32_t nThreadCount)
+	{
+		m_Rows.resize(nCount);
+
+		if (nCount > 0) {
+			if (pRawValues == nullptr)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COLUMNBUFFERISNULL);
+
+			double* pRows = m_Rows.data();
+			AMCCommon::CParallelBlocks::processBlocks(nThreadCount, nCount, DATATABLE_MINROWSPERTHREAD, [&](uint32_t nBlockIndex, size_t nFirstItem, size_t nItemCount) {
+				for (size_t nIndex = nFirstItem; nIndex < nFirstItem + nItemCount; nIndex++)
+					pRows[nIndex] = (double)pRawValues[nIndex] * dScaleFactor + dOffset;
+			});
+		}
+	}
+
 	void writeCSVValue(size_t nRowIndex, std::vector<char>& buffer, size_t& nBufferPosition) override
 	{
 		if (nRowIndex < m_Rows.size()) {
@@ -248,6 +274,43 @@ public:
 		}
 	}
 
+	uint32_t encodeData(LibMCEnv::eDataTableColumnEncoding encoding, std::vector<uint8_t>& encodedData) override
+	{
+		return CDataTableColumnCodec::encodeValues(m_Rows, encoding, encodedData);
+	}
+
+	void decodeData(uint32_t nEncodingType, const uint8_t* pEncodedData, size_t nEncodedDataSize, uint64_t nEntryCount) override
+	{
+		CDataTableColumnCodec::decodeValues(nEncodingType, pEncodedData, nEncodedDataSize, nEntryCount, m_Rows);
+	}
+
+	void keepRowRange(uint64_t nFirstRow, uint64_t nRowCount) override
+	{
+		if (nFirstRow >= m_Rows.size()) {
+			m_Rows.clear();
+		}
+		else {
+			if (nRowCount < m_Rows.size() - nFirstRow)
+				m_Rows.resize((size_t)(nFirstRow + nRowCount));
+			m_Rows.erase(m_Rows.begin(), m_Rows.begin() + (size_t)nFirstRow);
+		}
+		m_Rows.shrink_to_fit();
+	}
+
+	const void* getRowData() override
+	{
+		return m_Rows.data();
+	}
+
+	void copyRowsFrom(const sDataTableColumnView& sourceColumn, const std::vector<uint32_t>& rowIndices, uint32_t nThreadCount) override
+	{
+		if (sourceColumn.m_ColumnType != getColumnType())
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCOLUMNDATATYPE);
+
+		m_Rows.resize(rowIndices.size());
+		CDataTableQuery::gatherRows(sourceColumn, rowIndices, m_Rows.data(), nThreadCount);
+	}
+
 	void fillScatterplotXCoordinates(AMC::CScatterplot* pScatterplot, double dScaleFactor, double dOffset) override
 	{
 		if (pScatterplot == nullptr)
@@ -412,6 +475,43 @@ public:
 		}
 	}
 
+	uint32_t encodeData(LibMCEnv::eDataTableColumnEncoding encoding, std::vector<uint8_t>& encodedData) override
+	{
+		return CDataTableColumnCodec::encodeValues(m_Rows, encoding, encodedData);
+	}
+
+	void decodeData(uint32_t nEncodingType, const uint8_t* pEncodedData, size_t nEncodedDataSize, uint64_t nEntryCount) override
+	{
+		CDataTableColumnCodec::decodeValues(nEncodingType, pEncodedData, nEncodedDataSize, nEntryCount, m_Rows);
+	}
+
+	void keepRowRange(uint64_t nFirstRow, uint64_t nRowCount) override
+	{
+		if (nFirstRow >= m_Rows.size()) {
+			m_Rows.clear();
+		}
+		else {
+			if (nRowCount < m_Rows.size() - nFirstRow)
+				m_Rows.resize((size_t)(nFirstRow + nRowCount));
+			m_Rows.erase(m_Rows.begin(), m_Rows.begin() + (size_t)nFirstRow);
+		}
+		m_Rows.shrink_to_fit();
+	}
+
+	const void* getRowData() override
+	{
+		return m_Rows.data();
+	}
+
+	void copyRowsFrom(const sDataTableColumnView& sourceColumn, const std::vector<uint32_t>& rowIndices, uint32_t nThreadCount) override
+	{
+		if (sourceColumn.m_ColumnType != getColumnType())
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCOLUMNDATATYPE);
+
+		m_Rows.resize(rowIndices.size());
+		CDataTableQuery::gatherRows(sourceColumn, rowIndices, m_Rows.data(), nThreadCount);
+	}
+
 	void fillScatterplotXCoordinates(AMC::CScatterplot* pScatterplot, double dScaleFactor, double dOffset) override
 	{
 		if (pScatterplot == nullptr)
@@ -567,6 +667,43 @@ public:
 		}
 	}
 
+	uint32_t encodeData(LibMCEnv::eDataTableColumnEncoding encoding, std::vector<uint8_t>& encodedData) override
+	{
+		return CDataTableColumnCodec::encodeValues(m_Rows, encoding, encodedData);
+	}
+
+	void decodeData(uint32_t nEncodingType, const uint8_t* pEncodedData, size_t nEncodedDataSize, uint64_t nEntryCount) override
+	{
+		CDataTableColumnCodec::decodeValues(nEncodingType, pEncodedData, nEncodedDataSize, nEntryCount, m_Rows);
+	}
+
+	void keepRowRange(uint64_t nFirstRow, uint64_t nRowCount) override
+	{
+		if (nFirstRow >= m_Rows.size()) {
+			m_Rows.clear();
+		}
+		else {
+			if (nRowCount < m_Rows.size() - nFirstRow)
+				m_Rows.resize((size_t)(nFirstRow + nRowCount));
+			m_Rows.erase(m_Rows.begin(), m_Rows.begin() + (size_t)nFirstRow);
+		}
+		m_Rows.shrink_to_fit();
+	}
+
+	const void* getRowData() override
+	{
+		return m_Rows.data();
+	}
+
+	void copyRowsFrom(const sDataTableColumnView& sourceColumn, const std::vector<uint32_t>& rowIndices, uint32_t nThreadCount) override
+	{
+		if (sourceColumn.m_ColumnType != getColumnType())
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCOLUMNDATATYPE);
+
+		m_Rows.resize(rowIndices.size());
+		CDataTableQuery::gatherRows(sourceColumn, rowIndices, m_Rows.data(), nThreadCount);
+	}
+
 	void fillScatterplotXCoordinates(AMC::CScatterplot* pScatterplot, double dScaleFactor, double dOffset) override
 	{
 		if (pScatterplot == nullptr)
@@ -731,6 +868,43 @@ public:
 		}
 	}
 
+	uint32_t encodeData(LibMCEnv::eDataTableColumnEncoding encoding, std::vector<uint8_t>& encodedData) override
+	{
+		return CDataTableColumnCodec::encodeValues(m_Rows, encoding, encodedData);
+	}
+
+	void decodeData(uint32_t nEncodingType, const uint8_t* pEncodedData, size_t nEncodedDataSize, uint64_t nEntryCount) override
+	{
+		CDataTableColumnCodec::decodeValues(nEncodingType, pEncodedData, nEncodedDataSize, nEntryCount, m_Rows);
+	}
+
+	void keepRowRange(uint64_t nFirstRow, uint64_t nRowCount) override
+	{
+		if (nFirstRow >= m_Rows.size()) {
+			m_Rows.clear();
+		}
+		else {
+			if (nRowCount < m_Rows.size() - nFirstRow)
+				m_Rows.resize((size_t)(nFirstRow + nRowCount));
+			m_Rows.erase(m_Rows.begin(), m_Rows.begin() + (size_t)nFirstRow);
+		}
+		m_Rows.shrink_to_fit();
+	}
+
+	const void* getRowData() override
+	{
+		return m_Rows.data();
+	}
+
+	void copyRowsFrom(const sDataTableColumnView& sourceColumn, const std::vector<uint32_t>& rowIndices, uint32_t nThreadCount) override
+	{
+		if (sourceColumn.m_ColumnType != getColumnType())
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCOLUMNDATATYPE);
+
+		m_Rows.resize(rowIndices.size());
+		CDataTableQuery::gatherRows(sourceColumn, rowIndices, m_Rows.data(), nThreadCount);
+	}
+
 	void fillScatterplotXCoordinates(AMC::CScatterplot* pScatterplot, double dScaleFactor, double dOffset) override
 	{
 		if (pScatterplot == nullptr)
@@ -894,6 +1068,43 @@ public:
 		}
 	}
 
+	uint32_t encodeData(LibMCEnv::eDataTableColumnEncoding encoding, std::vector<uint8_t>& encodedData) override
+	{
+		return CDataTableColumnCodec::encodeValues(m_Rows, encoding, encodedData);
+	}
+
+	void decodeData(uint32_t nEncodingType, const uint8_t* pEncodedData, size_t nEncodedDataSize, uint64_t nEntryCount) override
+	{
+		CDataTableColumnCodec::decodeValues(nEncodingType, pEncodedData, nEncodedDataSize, nEntryCount, m_Rows);
+	}
+
+	void keepRowRange(uint64_t nFirstRow, uint64_t nRowCount) override
+	{
+		if (nFirstRow >= m_Rows.size()) {
+			m_Rows.clear();
+		}
+		else {
+			if (nRowCount < m_Rows.size() - nFirstRow)
+				m_Rows.resize((size_t)(nFirstRow + nRowCount));
+			m_Rows.erase(m_Rows.begin(), m_Rows.begin() + (size_t)nFirstRow);
+		}
+		m_Rows.shrink_to_fit();
+	}
+
+	const void* getRowData() override
+	{
+		return m_Rows.data();
+	}
+
+	void copyRowsFrom(const sDataTableColumnView& sourceColumn, const std::vector<uint32_t>& rowIndices, uint32_t nThreadCount) override
+	{
+		if (sourceColumn.m_ColumnType != getColumnType())
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCOLUMNDATATYPE);
+
+		m_Rows.resize(rowIndices.size());
+		CDataTableQuery::gatherRows(sourceColumn, rowIndices, m_Rows.data(), nThreadCount);
+	}
+
 	void fillScatterplotXCoordinates(AMC::CScatterplot* pScatterplot, double dScaleFactor, double dOffset) override
 	{
 		if (pScatterplot == nullptr)
@@ -969,9 +1180,19 @@ void CDataTableColumn::setDescription(const std::string& sDescription)
 	m_sDescription = sDescription;
 }
 
+sDataTableColumnView CDataTableColumn::getColumnView()
+{
+	sDataTableColumnView columnView;
+	columnView.m_ColumnType = getColumnType();
+	columnView.m_pData = getRowData();
+	columnView.m_nRowCount = getRowCount();
+	return columnView;
+}
+
 
 CDataTable::CDataTable(AMC::PToolpathHandler pToolpathHandler)
-	: m_nMaxRowCount (0), m_pToolpathHandler (pToolpathHandler)
+	: m_nMaxRowCount (0), m_pToolpathHandler (pToolpathHandler), m_nThreadCount (0), m_nRevision (CDataTableQuery::newRevision ()),
+	  m_nCachedQueryRevision (0), m_nCachedTableRevision (0)
 {
 	if (pToolpathHandler.get() == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
@@ -1034,6 +1255,7 @@ PDataTableColumn CDataTable::addColumnEx(const std::string& sIdentifier, const s
 
 	m_Columns.push_back(pColumn);
 	m_ColumnMap.insert(std::make_pair (sIdentifier, pColumn));
+	m_nRevision = CDataTableQuery::newRevision();
 
 	return pColumn;
 }
@@ -1043,10 +1265,14 @@ void CDataTable::RemoveColumn(const std::string & sIdentifier)
 	auto pFoundColumn = findColumn(sIdentifier, true);
 
 	m_ColumnMap.erase(sIdentifier);
+	m_PendingColumns.erase(sIdentifier);
+	m_ScaledColumns.erase(sIdentifier);
 	m_Columns.erase(std::remove_if(m_Columns.begin(), m_Columns.end(), [pFoundColumn](PDataTableColumn & pColumn) {
 		return (pFoundColumn ==  pColumn.get ());
 	}), m_Columns.end());
 
+	updateMaxRowCount();
+
 }
 
 bool CDataTable::HasColumn(const std::string & sIdentifier)
@@ -1112,7 +1338,7 @@ void CDataTable::GetColumnInformation(const std::string & sIdentifier, std::stri
 
 void CDataTable::GetDoubleColumnValues(const std::string & sIdentifier, LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_double * pValuesBuffer)
 {
-	auto pColumn = findColumn(sIdentifier, true);
+	auto pColumn = findLoadedColumn(sIdentifier);
 
 	auto pDoubleColumn = dynamic_cast<CDataTableColumn_Double*> (pColumn);
 
@@ -1134,7 +1360,7 @@ void CDataTable::GetDoubleColumnValues(const std::string & sIdentifier, LibMCEnv
 
 void CDataTable::GetInt32ColumnValues(const std::string & sIdentifier, LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_int32 * pValuesBuffer)
 {
-	auto pColumn = findColumn(sIdentifier, true);
+	auto pColumn = findLoadedColumn(sIdentifier);
 
 	auto pInt32Column = dynamic_cast<CDataTableColumn_Int32*> (pColumn);
 
@@ -1155,7 +1381,7 @@ void CDataTable::GetInt32ColumnValues(const std::string & sIdentifier, LibMCEnv_
 
 void CDataTable::GetInt64ColumnValues(const std::string & sIdentifier, LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_int64 * pValuesBuffer)
 {
-	auto pColumn = findColumn(sIdentifier, true);
+	auto pColumn = findLoadedColumn(sIdentifier);
 
 	auto pInt64Column = dynamic_cast<CDataTableColumn_Int64*> (pColumn);
 
@@ -1176,7 +1402,7 @@ void CDataTable::GetInt64ColumnValues(const std::string & sIdentifier, LibMCEnv_
 
 void CDataTable::GetUint32ColumnValues(const std::string & sIdentifier, LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_uint32 * pValuesBuffer)
 {
-	auto pColumn = findColumn(sIdentifier, true);
+	auto pColumn = findLoadedColumn(sIdentifier);
 
 	auto pUint32Column = dynamic_cast<CDataTableColumn_Uint32*> (pColumn);
 
@@ -1197,7 +1423,7 @@ void CDataTable::GetUint32ColumnValues(const std::string & sIdentifier, LibMCEnv
 
 void CDataTable::GetUint64ColumnValues(const std::string & sIdentifier, LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_uint64 * pValuesBuffer)
 {
-	auto pColumn = findColumn(sIdentifier, true);
+	auto pColumn = findLoadedColumn(sIdentifier);
 
 	auto pUint64Column = dynamic_cast<CDataTableColumn_Uint64*> (pColumn);
 
@@ -1224,6 +1450,9 @@ void CDataTable::SetDoubleColumnValues(const std::string & sIdentifier, const Li
 	if (pDoubleColumn == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COLUMNISNOTOFTYPEDOUBLE, "column is not of type double: " + sIdentifier);
 
+	// Values that are set replace values that have not been loaded yet
+	m_PendingColumns.erase(sIdentifier);
+	m_ScaledColumns.erase(sIdentifier);
 	pDoubleColumn->copyDataFrom(pValuesBuffer, nValuesBufferSize);
 
 	updateMaxRowCount();
@@ -1237,6 +1466,9 @@ void CDataTable::SetInt32ColumnValues(const std::string & sIdentifier, const Lib
 	if (pInt32Column == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COLUMNISNOTOFTYPEINT32, "column is not of type int32: " + sIdentifier);
 
+	// Values that are set replace values that have not been loaded yet
+	m_PendingColumns.erase(sIdentifier);
+	m_ScaledColumns.erase(sIdentifier);
 	pInt32Column->copyDataFrom(pValuesBuffer, nValuesBufferSize);
 
 	updateMaxRowCount();
@@ -1250,6 +1482,9 @@ void CDataTable::SetInt64ColumnValues(const std::string & sIdentifier, const Lib
 	if (pInt64Column == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COLUMNISNOTOFTYPEINT64, "column is not of type int64: " + sIdentifier);
 
+	// Values that are set replace values that have not been loaded yet
+	m_PendingColumns.erase(sIdentifier);
+	m_ScaledColumns.erase(sIdentifier);
 	pInt64Column->copyDataFrom(pValuesBuffer, nValuesBufferSize);
 
 	updateMaxRowCount();
@@ -1263,6 +1498,9 @@ void CDataTable::SetUint32ColumnValues(const std::string & sIdentifier, const Li
 	if (pUint32Column == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COLUMNISNOTOFTYPEUINT32, "column is not of type uint32: " + sIdentifier);
 
+	// Values that are set replace values that have not been loaded yet
+	m_PendingColumns.erase(sIdentifier);
+	m_ScaledColumns.erase(sIdentifier);
 	pUint32Column->copyDataFrom(pValuesBuffer, nValuesBufferSize);
 
 	updateMaxRowCount();
@@ -1276,6 +1514,9 @@ void CDataTable::SetUint64ColumnValues(const std::string & sIdentifier, const Li
 	if (pUint64Column == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COLUMNISNOTOFTYPEUINT64, "column is not of type uint64: " + sIdentifier);
 
+	// Values that are set replace values that have not been loaded yet
+	m_PendingColumns.erase(sIdentifier);
+	m_ScaledColumns.erase(sIdentifier);
 	pUint64Column->copyDataFrom(pValuesBuffer, nValuesBufferSize);
 
 	updateMaxRowCount();
@@ -1287,9 +1528,24 @@ void CDataTable::updateMaxRowCount()
 	m_nMaxRowCount = 0;
 	for (auto& iColumn : m_Columns) {
 		size_t nRowCount = iColumn->getRowCount();
+
+		if (!m_PendingColumns.empty()) {
+			auto iPendingIter = m_PendingColumns.find(iColumn->getIdentifier());
+			if (iPendingIter != m_PendingColumns.end())
+				nRowCount = (size_t)iPendingIter->second.m_nRowCount;
+		}
+
+		if (!m_ScaledColumns.empty()) {
+			auto iScaledIter = m_ScaledColumns.find(iColumn->getIdentifier());
+			if (iScaledIter != m_ScaledColumns.end())
+				nRowCount = iScaledIter->second.m_RawValues.size();
+		}
+
 		if (nRowCount > m_nMaxRowCount)
 			m_nMaxRowCount = nRowCount;
 	}
+
+	m_nRevision = CDataTableQuery::newRevision();
 }
 
 IDataTableWriteOptions* CDataTable::CreateWriteOptions()
@@ -1323,7 +1579,8 @@ void CDataTable::WriteCSVToStream(ITempStreamWriter* pWriter, IDataTableCSVWrite
 	char cSeparator = sSeparator.at(0);
 	if ((cSeparator < DATATABLE_MINCSVSEPARATOR) || (cSeparator > DATATABLE_MAXCSVSEPARATOR))
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCSVSEPARATOR);
-	
+
+	loadAllPendingColumns();
 
 	std::stringstream sHeader;
 	auto iIter = m_Columns.begin();
@@ -1391,18 +1648,42 @@ void CDataTable::WriteDataToStream(ITempStreamWriter* pWriter, IDataTableWriteOp
 	if (pWriter == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
 
+	LibMCEnv::eDataTableCompression compression = LibMCEnv::eDataTableCompression::NoCompression;
+	uint32_t nCompressionLevel = DATATABLE_DEFAULTCOMPRESSIONLEVEL;
+	if (pOptions != nullptr) {
+		compression = pOptions->GetCompression();
+		nCompressionLevel = pOptions->GetCompressionLevel();
+	}
+
+	uint32_t nCompressionType = DATATABLE_COMPRESSIONTYPE_NONE;
+	if (compression == LibMCEnv::eDataTableCompression::ZLib)
+		nCompressionType = DATATABLE_COMPRESSIONTYPE_ZLIB;
+	if (compression == LibMCEnv::eDataTableCompression::LZ4)
+		nCompressionType = DATATABLE_COMPRESSIONTYPE_LZ4;
+
+	loadAllPendingColumns();
+
+	// Encoded columns need to be prepared up front, as the column headers contain their sizes.
+	// Raw and uncompressed columns are written directly from the column.
+	std::vector<std::vector<uint8_t>> storedColumnData;
+	storedColumnData.resize(m_Columns.size());
+
 	sLibMCDataTableStreamHeader header;
 	memset((void*)&header, 0, sizeof(header));
 
 	uint64_t currentDataStart = sizeof (header);
 	header.m_nSignature = DATATABLE_HEADERSIGNATURE;
+	header.m_nVersion = DATATABLE_STREAMVERSION;
 	header.m_nColumnTableStart = currentDataStart;
 	header.m_nColumnCount = (uint32_t)m_Columns.size();
 	pWriter->WriteData(sizeof (header), (uint8_t*)&header);
 
 	currentDataStart += m_Columns.size() * sizeof(sLibMCDataTableColumnHeader);
 
-	for (auto pColumn : m_Columns) {
+	std::vector<uint8_t> encodedData;
+
+	for (size_t nColumnIndex = 0; nColumnIndex < m_Columns.size(); nColumnIndex++) {
+		auto pColumn = m_Columns.at(nColumnIndex);
 		std::string sIdentifier = pColumn->getIdentifier();
 		std::string sDescription = pColumn->getDescription();
 
@@ -1420,14 +1701,38 @@ void CDataTable::WriteDataToStream(ITempStreamWriter* pWriter, IDataTableWriteOp
 		columnHeader.m_nEntryCount = pColumn->getRowCount();
 		columnHeader.m_nColumnDataType = (uint32_t)pColumn->getColumnType();
 		columnHeader.m_nEncodingType = (uint32_t)DATATABLE_ENCODINGTYPE_RAW;
+		columnHeader.m_nCompressionType = (uint32_t)DATATABLE_COMPRESSIONTYPE_NONE;
+		columnHeader.m_nEncodedDataSize = columnHeader.m_nEntryCount * pColumn->getEntrySizeInBytes();
+
+		LibMCEnv::eDataTableColumnEncoding encoding = LibMCEnv::eDataTableColumnEncoding::Raw;
+		if (pOptions != nullptr)
+			encoding = pOptions->GetColumnEncoding(sIdentifier);
+
+		if ((encoding != LibMCEnv::eDataTableColumnEncoding::Raw) || (compression != LibMCEnv::eDataTableCompression::NoCompression)) {
+			auto& storedData = storedColumnData.at(nColumnIndex);
+
+			columnHeader.m_nEncodingType = pColumn->encodeData(encoding, encodedData);
+			columnHeader.m_nEncodedDataSize = encodedData.size();
+
+			if ((nCompressionType != DATATABLE_COMPRESSIONTYPE_NONE) && CDataTableColumnCodec::compressData(encodedData, nCompressionType, nCompressionLevel, storedData))
+				columnHeader.m_nCompressionType = nCompressionType;
+			else
+				std::swap(storedData, encodedData);
+
+		}
+
+		columnHeader.m_nStoredDataSize = columnHeader.m_nEncodedDataSize;
+		if (columnHeader.m_nCompressionType != DATATABLE_COMPRESSIONTYPE_NONE)
+			columnHeader.m_nStoredDataSize = storedColumnData.at(nColumnIndex).size();
+
 		columnHeader.m_nColumnDataStart = currentDataStart;
-		
-		currentDataStart += columnHeader.m_nEntryCount * pColumn->getEntrySizeInBytes();
+		currentDataStart += columnHeader.m_nStoredDataSize;
 
 		pWriter->WriteData(sizeof(columnHeader), (uint8_t*)&columnHeader);
 	}
 
-	for (auto pColumn : m_Columns) {
+	for (size_t nColumnIndex = 0; nColumnIndex < m_Columns.size(); nColumnIndex++) {
+		auto pColumn = m_Columns.at(nColumnIndex);
 		std::string sIdentifier = pColumn->getIdentifier();
 		std::string sDescription = pColumn->getDescription();		
 		if (sIdentifier.size() > 0)
@@ -1435,12 +1740,26 @@ void CDataTable::WriteDataToStream(ITempStreamWriter* pWriter, IDataTableWriteOp
 		if (sDescription.size() > 0)
 			pWriter->WriteData(sDescription.length(), (const uint8_t*)sDescription.c_str());
 
-		pColumn->WriteDataToStream(pWriter);
+		auto& storedData = storedColumnData.at(nColumnIndex);
+		if (storedData.size() > 0) {
+			pWriter->WriteData(storedData.size(), storedData.data());
+
+			// Release the encoded data as early as possible
+			std::vector<uint8_t>().swap(storedData);
+		}
+		else {
+			pColumn->WriteDataToStream(pWriter);
+		}
 	}
 
 }
 
 void CDataTable::LoadFromStream(IStreamReader* pStream)
+{
+	loadFromStreamEx(pStream, std::vector<std::string>(), false, 0, 0, false);
+}
+
+void CDataTable::loadFromStreamEx(IStreamReader* pStream, const std::vector<std::string>& projectedColumns, bool bHasRowRange, uint64_t nFirstRow, uint64_t nRowCount, bool bLazyLoading)
 {
 	Clear();
 
@@ -1456,12 +1775,18 @@ void CDataTable::LoadFromStream(IStreamReader* pStream)
 	if (header.m_nSignature != DATATABLE_HEADERSIGNATURE)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLESIGNATURE);
 
+	if (header.m_nVersion > DATATABLE_STREAMVERSION)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_UNSUPPORTEDDATATABLESTREAMVERSION, "unsupported data table stream version: " + std::to_string(header.m_nVersion));
+
 	if (header.m_nColumnCount >= DATATABLE_MAXCOLUMNCOUNT)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_DATATABLEHASTOOMANYCOLUMS);
 
+	std::vector<sLibMCDataTableColumnHeader> columnHeaders;
+	std::vector<std::string> identifiers;
+	std::vector<std::string> descriptions;
+
 	if (header.m_nColumnCount > 0) {
 
-		std::vector<sLibMCDataTableColumnHeader> columnHeaders;
 		columnHeaders.resize(header.m_nColumnCount);
 
 		size_t nBufferSize = sizeof(sLibMCDataTableColumnHeader) * (size_t)header.m_nColumnCount;
@@ -1489,24 +1814,174 @@ void CDataTable::LoadFromStream(IStreamReader* pStream)
 			identifierBytes.at(columnHeader.m_nIdentifierLength) = 0;
 			descriptionBytes.at(columnHeader.m_nDescriptionLength) = 0;
 
-			std::string sIdentifier((char*)identifierBytes.data());
-			std::string sDescription((char*)descriptionBytes.data());
+			identifiers.push_back(std::string((char*)identifierBytes.data()));
+			descriptions.push_back(std::string((char*)descriptionBytes.data()));
+		}
+	}
+
+	// Projected columns are loaded in the order of the projection
+	std::vector<size_t> columnIndices;
+	if (projectedColumns.empty()) {
+		for (size_t nColumnIndex = 0; nColumnIndex < columnHeaders.size(); nColumnIndex++)
+			columnIndices.push_back(nColumnIndex);
+	}
+	else {
+		std::map<std::string, size_t> columnIndexMap;
+		for (size_t nColumnIndex = 0; nColumnIndex < identifiers.size(); nColumnIndex++)
+			columnIndexMap.insert(std::make_pair(identifiers.at(nColumnIndex), nColumnIndex));
+
+		for (auto& sProjectedColumn : projectedColumns) {
+			auto iIter = columnIndexMap.find(sProjectedColumn);
+			if (iIter == columnIndexMap.end())
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COLUMNIDENTIFIERNOTFOUND, "column identifier not found in stream: " + sProjectedColumn);
 
-			auto pColumn = addColumnEx(sIdentifier, sDescription, (LibMCEnv::eDataTableColumnType)columnHeader.m_nColumnDataType);
-			pStream->Seek(columnHeader.m_nColumnDataStart);
-			pColumn->ReadDataFromStream(pStream, columnHeader.m_nEntryCount);
-			
+			columnIndices.push_back(iIter->second);
 		}
+	}
+
+	for (size_t nColumnIndex : columnIndices) {
+		auto& columnHeader = columnHeaders.at(nColumnIndex);
+		auto& sIdentifier = identifiers.at(nColumnIndex);
+
+		sDataTablePendingColumn pendingColumn;
+		pendingColumn.m_nDataStart = columnHeader.m_nColumnDataStart;
+		pendingColumn.m_nEntryCount = columnHeader.m_nEntryCount;
+		pendingColumn.m_nStoredDataSize = columnHeader.m_nStoredDataSize;
+		pendingColumn.m_nEncodedDataSize = columnHeader.m_nEncodedDataSize;
 
-		updateMaxRowCount();
+		// Version 0 streams do not set the encoding fields. All their columns are raw.
+		pendingColumn.m_nEncodingType = DATATABLE_ENCODINGTYPE_RAW;
+		pendingColumn.m_nCompressionType = DATATABLE_COMPRESSIONTYPE_NONE;
+		if (header.m_nVersion >= 1) {
+			pendingColumn.m_nEncodingType = columnHeader.m_nEncodingType;
+			pendingColumn.m_nCompressionType = columnHeader.m_nCompressionType;
+		}
+
+		if ((pendingColumn.m_nCompressionType != DATATABLE_COMPRESSIONTYPE_NONE) && (pendingColumn.m_nCompressionType != DATATABLE_COMPRESSIONTYPE_ZLIB) && (pendingColumn.m_nCompressionType != DATATABLE_COMPRESSIONTYPE_LZ4))
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOMPRESSION, "unknown compression type of column " + sIdentifier + ": " + std::to_string(pendingColumn.m_nCompressionType));
+
+		pendingColumn.m_nFirstRow = 0;
+		pendingColumn.m_nRowCount = columnHeader.m_nEntryCount;
+		if (bHasRowRange) {
+			pendingColumn.m_nFirstRow = nFirstRow;
+			if (nFirstRow < columnHeader.m_nEntryCount)
+				pendingColumn.m_nRowCount = std::min(nRowCount, columnHeader.m_nEntryCount - nFirstRow);
+			else
+				pendingColumn.m_nRowCount = 0;
+		}
 
+		auto pColumn = addColumnEx(sIdentifier, descriptions.at(nColumnIndex), (LibMCEnv::eDataTableColumnType)columnHeader.m_nColumnDataType);
+
+		if (bLazyLoading)
+			m_PendingColumns.insert(std::make_pair(sIdentifier, pendingColumn));
+		else
+			readColumnData(pStream, pColumn.get(), pendingColumn);
+	}
+
+	if (!m_PendingColumns.empty()) {
+		IBase::AcquireBaseClassInterface(pStream);
+		m_pPendingStream = std::shared_ptr<IStreamReader>(pStream, IBase::ReleaseBaseClassInterface);
 	}
+
+	updateMaxRowCount();
+}
+
+void CDataTable::readColumnData(IStreamReader* pStream, CDataTableColumn* pColumn, const sDataTablePendingColumn& pendingColumn)
+{
+	if ((pStream == nullptr) || (pColumn == nullptr))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+	std::string sIdentifier = pColumn->getIdentifier();
+	bool bIsPartial = (pendingColumn.m_nFirstRow > 0) || (pendingColumn.m_nRowCount < pendingColumn.m_nEntryCount);
+
+	if ((pendingColumn.m_nEncodingType == DATATABLE_ENCODINGTYPE_RAW) && (pendingColumn.m_nCompressionType == DATATABLE_COMPRESSIONTYPE_NONE)) {
+		// Raw columns have fixed size entries, so only the requested rows are read.
+		if (pendingColumn.m_nRowCount > 0)
+			pStream->Seek(pendingColumn.m_nDataStart + pendingColumn.m_nFirstRow * pColumn->getEntrySizeInBytes());
+
+		pColumn->ReadDataFromStream(pStream, pendingColumn.m_nRowCount);
+	}
+	else {
+		if ((pendingColumn.m_nStoredDataSize > (uint64_t)SIZE_MAX) || (pendingColumn.m_nEncodedDataSize > (uint64_t)SIZE_MAX))
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "column data of " + sIdentifier + " is too large");
+
+		std::vector<uint8_t> storedData;
+		storedData.resize((size_t)pendingColumn.m_nStoredDataSize);
+		if (storedData.size() > 0) {
+			pStream->Seek(pendingColumn.m_nDataStart);
+			pStream->ReadData(storedData.size(), storedData.size(), nullptr, storedData.data());
+		}
+
+		if (pendingColumn.m_nCompressionType != DATATABLE_COMPRESSIONTYPE_NONE) {
+			std::vector<uint8_t> encodedData;
+			CDataTableColumnCodec::decompressData(pendingColumn.m_nCompressionType, storedData.data(), storedData.size(), (size_t)pendingColumn.m_nEncodedDataSize, encodedData);
+			pColumn->decodeData(pendingColumn.m_nEncodingType, encodedData.data(), encodedData.size(), pendingColumn.m_nEntryCount);
+		}
+		else {
+			if (pendingColumn.m_nStoredDataSize != pendingColumn.m_nEncodedDataSize)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "column data size mismatch of " + sIdentifier);
+
+			pColumn->decodeData(pendingColumn.m_nEncodingType, storedData.data(), storedData.size(), pendingColumn.m_nEntryCount);
+		}
+
+		// Encoded columns can only be decoded as a whole
+		if (bIsPartial)
+			pColumn->keepRowRange(pendingColumn.m_nFirstRow, pendingColumn.m_nRowCount);
+	}
+}
+
+void CDataTable::loadPendingColumn(CDataTableColumn* pColumn)
+{
+	if (pColumn == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+	auto iIter = m_PendingColumns.find(pColumn->getIdentifier());
+	if (iIter != m_PendingColumns.end()) {
+		if (m_pPendingStream.get() == nullptr)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+		// The column stays pending, if reading fails
+		readColumnData(m_pPendingStream.get(), pColumn, iIter->second);
+		m_PendingColumns.erase(iIter);
+
+		if (m_PendingColumns.empty())
+			m_pPendingStream.reset();
+	}
+
+	auto iScaledIter = m_ScaledColumns.find(pColumn->getIdentifier());
+	if (iScaledIter != m_ScaledColumns.end()) {
+		auto pDoubleColumn = dynamic_cast<CDataTableColumn_Double*> (pColumn);
+		if (pDoubleColumn == nullptr)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COLUMNISNOTOFTYPEDOUBLE, "column is not of type double: " + pColumn->getIdentifier());
+
+		auto& scaledColumn = iScaledIter->second;
+		pDoubleColumn->copyScaledDataFrom(scaledColumn.m_RawValues.data(), scaledColumn.m_RawValues.size(), scaledColumn.m_dScaleFactor, scaledColumn.m_dOffset, m_nThreadCount);
+		m_ScaledColumns.erase(iScaledIter);
+	}
+}
+
+void CDataTable::loadAllPendingColumns()
+{
+	if (!m_PendingColumns.empty() || !m_ScaledColumns.empty()) {
+		for (auto& pColumn : m_Columns)
+			loadPendingColumn(pColumn.get());
+	}
+}
+
+CDataTableColumn* CDataTable::findLoadedColumn(const std::string& sIdentifier)
+{
+	auto pColumn = findColumn(sIdentifier, true);
+	loadPendingColumn(pColumn);
+	return pColumn;
 }
 
 void CDataTable::Clear()
 {
 	m_Columns.clear();
 	m_ColumnMap.clear();
+	m_PendingColumns.clear();
+	m_pPendingStream.reset();
+	m_ScaledColumns.clear();
 
 	updateMaxRowCount();
 }
@@ -1537,8 +2012,8 @@ IScatterPlot* CDataTable::CalculateScatterPlot(IDataTableScatterPlotOptions* pSc
 	double dYAxisScaleFactor = pScatterPlotInput->GetYAxisScaling();
 	double dYAxisOffset = pScatterPlotInput->GetYAxisOffset();
 
-	auto pXAxisColumn = findColumn(sXAxisColumn, true);
-	auto pYAxisColumn = findColumn(sYAxisColumn, true);
+	auto pXAxisColumn = findLoadedColumn(sXAxisColumn);
+	auto pYAxisColumn = findLoadedColumn(sYAxisColumn);
 
 	auto pScatterPlotInstance = std::make_shared<AMC::CScatterplot>(sNewUUID);
 	auto& entries = pScatterPlotInstance->getEntries();
@@ -1554,3 +2029,335 @@ IScatterPlot* CDataTable::CalculateScatterPlot(IDataTableScatterPlotOptions* pSc
 	return new CScatterPlot (pScatterPlotInstance);
 }
 
+
+LibMCEnv_uint32 CDataTable::GetThreadCount()
+{
+	return m_nThreadCount;
+}
+
+void CDataTable::SetThreadCount(const LibMCEnv_uint32 nThreadCount)
+{
+	if (nThreadCount > DATATABLE_MAXTHREADCOUNT)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLETHREADCOUNT, "invalid data table thread count: " + std::to_string(nThreadCount));
+
+	m_nThreadCount = nThreadCount;
+}
+
+size_t CDataTable::getQueryRowCount()
+{
+	// Row indices of queries are 32 bit
+	if (m_nMaxRowCount > (size_t)UINT32_MAX)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_DATATABLEROWINDEXOUTOFRANGE, "data table has too many rows for queries: " + std::to_string(m_nMaxRowCount));
+
+	return m_nMaxRowCount;
+}
+
+void CDataTable::findFilteredRows(IDataTableFilter* pFilter, std::vector<uint32_t>& rowIndices)
+{
+	if (pFilter == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+	auto pFilterInstance = dynamic_cast<CDataTableFilter*> (pFilter);
+	if (pFilterInstance == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+
+	size_t nRowCount = getQueryRowCount();
+	std::vector<uint8_t> rowFlags(nRowCount, 1);
+
+	for (auto& condition : pFilterInstance->getConditions()) {
+		auto pColumn = findLoadedColumn(condition.m_sColumnIdentifier);
+		CDataTableQuery::applyCondition(pColumn->getColumnView(), condition.m_Operator, condition.m_dValue, condition.m_dUpperValue, rowFlags, m_nThreadCount);
+	}
+
+	CDataTableQuery::flagsToRowIndices(rowFlags, rowIndices);
+}
+
+void CDataTable::findSortedRows(IDataTableSortOptions* pSortOptions, std::vector<uint32_t>& rowIndices)
+{
+	if (pSortOptions == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+	auto pSortOptionsInstance = dynamic_cast<CDataTableSortOptions*> (pSortOptions);
+	if (pSortOptionsInstance == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+
+	size_t nRowCount = getQueryRowCount();
+
+	std::vector<sDataTableSortKey> sortKeys;
+	for (auto& sortColumn : pSortOptionsInstance->getSortColumns()) {
+		auto pColumn = findLoadedColumn(sortColumn.m_sColumnIdentifier);
+		sortKeys.push_back({ pColumn->getColumnView(), sortColumn.m_bDescending });
+	}
+
+	CDataTableQuery::sortRows(sortKeys, nRowCount, rowIndices, m_nThreadCount);
+}
+
+void CDataTable::writeRowIndices(uint64_t nQueryRevision, const std::function<void(std::vector<uint32_t>&)>& queryFunction, LibMCEnv_uint64 nRowIndicesBufferSize, LibMCEnv_uint64* pRowIndicesNeededCount, LibMCEnv_uint32* pRowIndicesBuffer)
+{
+	if ((m_nCachedQueryRevision != nQueryRevision) || (m_nCachedTableRevision != m_nRevision)) {
+		m_nCachedQueryRevision = 0;
+		queryFunction(m_CachedRowIndices);
+		m_nCachedQueryRevision = nQueryRevision;
+		m_nCachedTableRevision = m_nRevision;
+	}
+
+	size_t nRowIndexCount = m_CachedRowIndices.size();
+
+	if (pRowIndicesNeededCount != nullptr)
+		*pRowIndicesNeededCount = nRowIndexCount;
+
+	if (pRowIndicesBuffer != nullptr) {
+		if (nRowIndicesBufferSize < nRowIndexCount)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+
+		if (nRowIndexCount > 0)
+			memcpy(pRowIndicesBuffer, m_CachedRowIndices.data(), nRowIndexCount * sizeof(uint32_t));
+
+		// The values have been delivered, the cache is not needed anymore
+		m_CachedRowIndices.clear();
+		m_CachedRowIndices.shrink_to_fit();
+		m_nCachedQueryRevision = 0;
+	}
+}
+
+CDataTable* CDataTable::createFromRows(const std::vector<uint32_t>& rowIndices)
+{
+	loadAllPendingColumns();
+
+	auto pResultTable = std::make_unique<CDataTable>(m_pToolpathHandler);
+	pResultTable->m_nThreadCount = m_nThreadCount;
+
+	for (auto& pColumn : m_Columns) {
+		auto pNewColumn = pResultTable->addColumnEx(pColumn->getIdentifier(), pColumn->getDescription(), pColumn->getColumnType());
+		pNewColumn->copyRowsFrom(pColumn->getColumnView(), rowIndices, m_nThreadCount);
+	}
+
+	pResultTable->updateMaxRowCount();
+
+	return pResultTable.release();
+}
+
+IDataTableFilter* CDataTable::CreateFilter()
+{
+	return new CDataTableFilter();
+}
+
+void CDataTable::FindRows(IDataTableFilter* pFilter, LibMCEnv_uint64 nRowIndicesBufferSize, LibMCEnv_uint64* pRowIndicesNeededCount, LibMCEnv_uint32 * pRowIndicesBuffer)
+{
+	auto pFilterInstance = dynamic_cast<CDataTableFilter*> (pFilter);
+	if (pFilterInstance == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+
+	writeRowIndices(pFilterInstance->getRevision(), [this, pFilter](std::vector<uint32_t>& rowIndices) {
+		findFilteredRows(pFilter, rowIndices);
+	}, nRowIndicesBufferSize, pRowIndicesNeededCount, pRowIndicesBuffer);
+}
+
+IDataTable* CDataTable::FilterRows(IDataTableFilter* pFilter)
+{
+	std::vector<uint32_t> rowIndices;
+	findFilteredRows(pFilter, rowIndices);
+
+	return createFromRows(rowIndices);
+}
+
+IDataTable* CDataTable::SelectRows(const LibMCEnv_uint64 nRowIndicesBufferSize, const LibMCEnv_uint32 * pRowIndicesBuffer)
+{
+	if ((nRowIndicesBufferSize > 0) && (pRowIndicesBuffer == nullptr))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+	size_t nRowCount = getQueryRowCount();
+
+	std::vector<uint32_t> rowIndices(pRowIndicesBuffer, pRowIndicesBuffer + nRowIndicesBufferSize);
+	for (uint32_t nRowIndex : rowIndices) {
+		if (nRowIndex >= nRowCount)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_DATATABLEROWINDEXOUTOFRANGE, "data table row index out of range: " + std::to_string(nRowIndex));
+	}
+
+	return createFromRows(rowIndices);
+}
+
+IDataTableSortOptions* CDataTable::CreateSortOptions()
+{
+	return new CDataTableSortOptions();
+}
+
+void CDataTable::GetSortedRowIndices(IDataTableSortOptions* pSortOptions, LibMCEnv_uint64 nRowIndicesBufferSize, LibMCEnv_uint64* pRowIndicesNeededCount, LibMCEnv_uint32 * pRowIndicesBuffer)
+{
+	auto pSortOptionsInstance = dynamic_cast<CDataTableSortOptions*> (pSortOptions);
+	if (pSortOptionsInstance == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+
+	writeRowIndices(pSortOptionsInstance->getRevision(), [this, pSortOptions](std::vector<uint32_t>& rowIndices) {
+		findSortedRows(pSortOptions, rowIndices);
+	}, nRowIndicesBufferSize, pRowIndicesNeededCount, pRowIndicesBuffer);
+}
+
+IDataTable* CDataTable::SortRows(IDataTableSortOptions* pSortOptions)
+{
+	std::vector<uint32_t> rowIndices;
+	findSortedRows(pSortOptions, rowIndices);
+
+	return createFromRows(rowIndices);
+}
+
+IDataTableAggregationOptions* CDataTable::CreateAggregationOptions()
+{
+	return new CDataTableAggregationOptions();
+}
+
+IDataTable* CDataTable::Aggregate(IDataTableAggregationOptions* pAggregationOptions)
+{
+	if (pAggregationOptions == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+	auto pAggregationOptionsInstance = dynamic_cast<CDataTableAggregationOptions*> (pAggregationOptions);
+	if (pAggregationOptionsInstance == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+
+	size_t nRowCount = getQueryRowCount();
+
+	auto& groupColumnIdentifiers = pAggregationOptionsInstance->getGroupColumns();
+	auto& aggregations = pAggregationOptionsInstance->getAggregations();
+
+	std::vector<CDataTableColumn*> groupColumns;
+	std::vector<sDataTableColumnView> groupColumnViews;
+	for (auto& sGroupColumnIdentifier : groupColumnIdentifiers) {
+		auto pColumn = findLoadedColumn(sGroupColumnIdentifier);
+		groupColumns.push_back(pColumn);
+		groupColumnViews.push_back(pColumn->getColumnView());
+	}
+
+	std::vector<CDataTableColumn*> aggregationColumns;
+	for (auto& aggregation : aggregations)
+		aggregationColumns.push_back(findLoadedColumn(aggregation.m_sColumnIdentifier));
+
+	std::vector<uint32_t> sortedRowIndices;
+	std::vector<size_t> groupStarts;
+	CDataTableQuery::groupRows(groupColumnViews, nRowCount, sortedRowIndices, groupStarts, m_nThreadCount);
+	size_t nGroupCount = groupStarts.size() - 1;
+
+	auto pResultTable = std::make_unique<CDataTable>(m_pToolpathHandler);
+	pResultTable->m_nThreadCount = m_nThreadCount;
+
+	// Group columns contain the key of every group, taken from its first row. Without group columns,
+	// there is one group, which might be empty.
+	std::vector<uint32_t> firstRowIndices;
+	if (!groupColumns.empty()) {
+		firstRowIndices.resize(nGroupCount);
+		for (size_t nGroupIndex = 0; nGroupIndex < nGroupCount; nGroupIndex++)
+			firstRowIndices[nGroupIndex] = sortedRowIndices.at(groupStarts.at(nGroupIndex));
+	}
+
+	for (auto pGroupColumn : groupColumns) {
+		auto pNewColumn = pResultTable->addColumnEx(pGroupColumn->getIdentifier(), pGroupColumn->getDescription(), pGroupColumn->getColumnType());
+		pNewColumn->copyRowsFrom(pGroupColumn->getColumnView(), firstRowIndices, m_nThreadCount);
+	}
+
+	std::vector<double> results;
+	for (size_t nAggregationIndex = 0; nAggregationIndex < aggregations.size(); nAggregationIndex++) {
+		auto& aggregation = aggregations.at(nAggregationIndex);
+		auto pColumn = aggregationColumns.at(nAggregationIndex);
+
+		CDataTableQuery::aggregateGroups(pColumn->getColumnView(), nRowCount, aggregation.m_Aggregation, sortedRowIndices, groupStarts, results, m_nThreadCount);
+
+		std::string sAggregationName;
+		switch (aggregation.m_Aggregation) {
+		case LibMCEnv::eDataTableAggregation::Count: sAggregationName = "Count"; break;
+		case LibMCEnv::eDataTableAggregation::Sum: sAggregationName = "Sum"; break;
+		case LibMCEnv::eDataTableAggregation::Minimum: sAggregationName = "Minimum"; break;
+		case LibMCEnv::eDataTableAggregation::Maximum: sAggregationName = "Maximum"; break;
+		case LibMCEnv::eDataTableAggregation::Mean: sAggregationName = "Mean"; break;
+		default:
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLEAGGREGATION);
+		}
+		std::string sDescription = sAggregationName + " of " + aggregation.m_sColumnIdentifier;
+
+		if (aggregation.m_Aggregation == LibMCEnv::eDataTableAggregation::Count) {
+			auto pNewColumn = pResultTable->addColumnEx(aggregation.m_sResultIdentifier, sDescription, LibMCEnv::eDataTableColumnType::Uint64Column);
+
+			std::vector<uint64_t> counts(nGroupCount);
+			for (size_t nGroupIndex = 0; nGroupIndex < nGroupCount; nGroupIndex++)
+				counts[nGroupIndex] = groupStarts.at(nGroupIndex + 1) - groupStarts.at(nGroupIndex);
+
+			dynamic_cast<CDataTableColumn_Uint64*> (pNewColumn.get())->copyDataFrom(counts.data(), counts.size());
+		}
+		else {
+			auto pNewColumn = pResultTable->addColumnEx(aggregation.m_sResultIdentifier, sDescription, LibMCEnv::eDataTableColumnType::DoubleColumn);
+			dynamic_cast<CDataTableColumn_Double*> (pNewColumn.get())->copyDataFrom(results.data(), results.size());
+		}
+	}
+
+	pResultTable->updateMaxRowCount();
+
+	return pResultTable.release();
+}
+
+void CDataTable::AddWindowStatisticColumn(const std::string & sColumnIdentifier, const std::string & sResultIdentifier, const std::string & sDescription, const LibMCEnv::eDataTableWindowStatistic eStatistic, const LibMCEnv_uint32 nWindowSize)
+{
+	auto pColumn = findLoadedColumn(sColumnIdentifier);
+
+	// The column is only added after the statistic succeeded
+	std::vector<double> results;
+	CDataTableQuery::computeWindowStatistic(pColumn->getColumnView(), m_nMaxRowCount, eStatistic, nWindowSize, results, m_nThreadCount);
+
+	auto pNewColumn = addColumnEx(sResultIdentifier, sDescription, LibMCEnv::eDataTableColumnType::DoubleColumn);
+	dynamic_cast<CDataTableColumn_Double*> (pNewColumn.get())->copyDataFrom(results.data(), results.size());
+
+	updateMaxRowCount();
+}
+
+IDataTableLoadOptions* CDataTable::CreateLoadOptions()
+{
+	return new CDataTableLoadOptions();
+}
+
+void CDataTable::LoadFromStreamWithOptions(IStreamReader* pStream, IDataTableLoadOptions* pOptions)
+{
+	if (pOptions == nullptr) {
+		loadFromStreamEx(pStream, std::vector<std::string>(), false, 0, 0, true);
+	}
+	else {
+		auto pOptionsInstance = dynamic_cast<CDataTableLoadOptions*> (pOptions);
+		if (pOptionsInstance == nullptr)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCAST);
+
+		loadFromStreamEx(pStream, pOptionsInstance->getColumns(), pOptionsInstance->HasRowRange(), pOptionsInstance->GetFirstRow(), pOptionsInstance->GetRowCount(), pOptionsInstance->GetLazyLoading());
+	}
+}
+
+bool CDataTable::IsColumnLoaded(const std::string & sIdentifier)
+{
+	findColumn(sIdentifier, true);
+	return (m_PendingColumns.find(sIdentifier) == m_PendingColumns.end()) && (m_ScaledColumns.find(sIdentifier) == m_ScaledColumns.end());
+}
+
+void CDataTable::AddScaledInt32Column(const std::string & sIdentifier, const std::string & sDescription, const LibMCEnv_double dScaleFactor, const LibMCEnv_double dOffset)
+{
+	addColumnEx(sIdentifier, sDescription, LibMCEnv::eDataTableColumnType::DoubleColumn);
+
+	sDataTableScaledColumn scaledColumn;
+	scaledColumn.m_dScaleFactor = dScaleFactor;
+	scaledColumn.m_dOffset = dOffset;
+	m_ScaledColumns.insert(std::make_pair(sIdentifier, scaledColumn));
+}
+
+void CDataTable::AppendScaledInt32ColumnValues(const std::string & sIdentifier, const LibMCEnv_uint64 nValuesBufferSize, const LibMCEnv_int32 * pValuesBuffer)
+{
+	findColumn(sIdentifier, true);
+
+	// Columns, whose double values have been computed already, can not be appended to
+	auto iScaledIter = m_ScaledColumns.find(sIdentifier);
+	if (iScaledIter == m_ScaledColumns.end())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COLUMNISNOTSCALEDINT32, "column is not a scaled int32 column: " + sIdentifier);
+
+	if (nValuesBufferSize > 0) {
+		if (pValuesBuffer == nullptr)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COLUMNBUFFERISNULL);
+
+		auto& rawValues = iScaledIter->second.m_RawValues;
+		rawValues.insert(rawValues.end(), pValuesBuffer, pValuesBuffer + nValuesBufferSize);
+	}
+
+	updateMaxRowCount();
+}
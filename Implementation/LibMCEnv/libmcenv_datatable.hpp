@@ -47,7 +47,10 @@ Abstract: This is the class declaration of CDataTable
 
 // Include custom headers here.
 #include <map>
+#include <functional>
 #include "amc_scatterplot.hpp"
+#include "libmcenv_datatablequery.hpp"
+#include "libmcenv_datatableloadoptions.hpp"
 
 namespace LibMCEnv {
 namespace Impl {
@@ -91,15 +94,49 @@ public:
 
 	virtual void ReadDataFromStream(IStreamReader* pReader, uint64_t nEntryCount) = 0;
 
+	// Encodes the column values into a buffer and returns the DATATABLE_ENCODINGTYPE_* that has been used.
+	virtual uint32_t encodeData(LibMCEnv::eDataTableColumnEncoding encoding, std::vector<uint8_t>& encodedData) = 0;
+
+	virtual void decodeData(uint32_t nEncodingType, const uint8_t* pEncodedData, size_t nEncodedDataSize, uint64_t nEntryCount) = 0;
+
+	// Drops all rows outside of the given range. The range may exceed the row count.
+	virtual void keepRowRange(uint64_t nFirstRow, uint64_t nRowCount) = 0;
+
 	virtual size_t getEntrySizeInBytes() = 0;
 
 	virtual void fillScatterplotXCoordinates (AMC::CScatterplot* pScatterplot, double dScaleFactor, double dOffset) = 0;
 
 	virtual void fillScatterplotYCoordinates(AMC::CScatterplot* pScatterplot, double dScaleFactor, double dOffset) = 0;
+
+	virtual const void* getRowData() = 0;
+
+	// Replaces the values with the given rows of a column of the same type.
+	virtual void copyRowsFrom(const sDataTableColumnView& sourceColumn, const std::vector<uint32_t>& rowIndices, uint32_t nThreadCount) = 0;
+
+	sDataTableColumnView getColumnView();
 };
 
 typedef std::shared_ptr<CDataTableColumn> PDataTableColumn;
 
+// Stream location of a column, whose values have not been read yet.
+struct sDataTablePendingColumn {
+	uint64_t m_nDataStart;
+	uint64_t m_nEntryCount;
+	uint64_t m_nStoredDataSize;
+	uint64_t m_nEncodedDataSize;
+	uint32_t m_nEncodingType;
+	uint32_t m_nCompressionType;
+	uint64_t m_nFirstRow;
+	uint64_t m_nRowCount;
+};
+
+// Raw values of a double column, that are converted with m_dScaleFactor and m_dOffset on first access.
+struct sDataTableScaledColumn {
+	std::vector<int32_t> m_RawValues;
+	double m_dScaleFactor;
+	double m_dOffset;
+};
+
 
 class CDataTable : public virtual IDataTable, public virtual CBase {
 private:
@@ -112,12 +149,53 @@ private:
 	std::map<std::string, PDataTableColumn> m_ColumnMap;
 	std::vector<PDataTableColumn> m_Columns;
 
+	// Number of threads for queries, 0 uses all hardware threads
+	uint32_t m_nThreadCount;
+
+	// Changes with every modification of the columns
+	uint64_t m_nRevision;
+
+	// Row indices of the last query. The wrappers request the indices twice, first for the size and then for the values.
+	std::vector<uint32_t> m_CachedRowIndices;
+	uint64_t m_nCachedQueryRevision;
+	uint64_t m_nCachedTableRevision;
+
+	// Lazily loaded columns and the stream they are read from. The stream is co-owned until all columns are loaded.
+	std::map<std::string, sDataTablePendingColumn> m_PendingColumns;
+	std::shared_ptr<IStreamReader> m_pPendingStream;
+
+	// Scaled int32 columns, whose double values have not been computed yet.
+	std::map<std::string, sDataTableScaledColumn> m_ScaledColumns;
+
 	void updateMaxRowCount ();
 
 	CDataTableColumn* findColumn(const std::string& sIdentifier, bool bMustExist);
 
+	// Finds a column and reads its values, if they have not been loaded yet.
+	CDataTableColumn* findLoadedColumn(const std::string& sIdentifier);
+
+	void loadPendingColumn(CDataTableColumn* pColumn);
+
+	void loadAllPendingColumns();
+
+	void readColumnData(IStreamReader* pStream, CDataTableColumn* pColumn, const sDataTablePendingColumn& pendingColumn);
+
+	// Reads the column directory of a stream. An empty projection loads all columns in stream order.
+	void loadFromStreamEx(IStreamReader* pStream, const std::vector<std::string>& projectedColumns, bool bHasRowRange, uint64_t nFirstRow, uint64_t nRowCount, bool bLazyLoading);
+
 	PDataTableColumn addColumnEx(const std::string& sIdentifier, const std::string& sDescription, const LibMCEnv::eDataTableColumnType eColumnType);
 
+	size_t getQueryRowCount();
+
+	void findFilteredRows(IDataTableFilter* pFilter, std::vector<uint32_t>& rowIndices);
+
+	void findSortedRows(IDataTableSortOptions* pSortOptions, std::vector<uint32_t>& rowIndices);
+
+	void writeRowIndices(uint64_t nQueryRevision, const std::function<void(std::vector<uint32_t>&)>& queryFunction, LibMCEnv_uint64 nRowIndicesBufferSize, LibMCEnv_uint64* pRowIndicesNeededCount, LibMCEnv_uint32* pRowIndicesBuffer);
+
+	// Creates a table with the same columns, containing the given rows.
+	CDataTable* createFromRows(const std::vector<uint32_t>& rowIndices);
+
 public:
 
 	static CDataTable* makeFromStream (IStreamReader * pStreamReader, AMC::PToolpathHandler pToolpathHandler);
@@ -180,6 +258,40 @@ public:
 
 	IScatterPlot* CalculateScatterPlot(IDataTableScatterPlotOptions* pScatterPlotInput) override;
 
+	LibMCEnv_uint32 GetThreadCount() override;
+
+	void SetThreadCount(const LibMCEnv_uint32 nThreadCount) override;
+
+	IDataTableFilter* CreateFilter() override;
+
+	void FindRows(IDataTableFilter* pFilter, LibMCEnv_uint64 nRowIndicesBufferSize, LibMCEnv_uint64* pRowIndicesNeededCount, LibMCEnv_uint32 * pRowIndicesBuffer) override;
+
+	IDataTable* FilterRows(IDataTableFilter* pFilter) override;
+
+	IDataTable* SelectRows(const LibMCEnv_uint64 nRowIndicesBufferSize, const LibMCEnv_uint32 * pRowIndicesBuffer) override;
+
+	IDataTableSortOptions* CreateSortOptions() override;
+
+	void GetSortedRowIndices(IDataTableSortOptions* pSortOptions, LibMCEnv_uint64 nRowIndicesBufferSize, LibMCEnv_uint64* pRowIndicesNeededCount, LibMCEnv_uint32 * pRowIndicesBuffer) override;
+
+	IDataTable* SortRows(IDataTableSortOptions* pSortOptions) override;
+
+	IDataTableAggregationOptions* CreateAggregationOptions() override;
+
+	IDataTable* Aggregate(IDataTableAggregationOptions* pAggregationOptions) override;
+
+	void AddWindowStatisticColumn(const std::string & sColumnIdentifier, const std::string & sResultIdentifier, const std::string & sDescription, const LibMCEnv::eDataTableWindowStatistic eStatistic, const LibMCEnv_uint32 nWindowSize) override;
+
+	IDataTableLoadOptions* CreateLoadOptions() override;
+
+	void LoadFromStreamWithOptions(IStreamReader* pStream, IDataTableLoadOptions* pOptions) override;
+
+	bool IsColumnLoaded(const std::string & sIdentifier) override;
+
+	void AddScaledInt32Column(const std::string & sIdentifier, const std::string & sDescription, const LibMCEnv_double dScaleFactor, const LibMCEnv_double dOffset) override;
+
+	void AppendScaledInt32ColumnValues(const std::string & sIdentifier, const LibMCEnv_uint64 nValuesBufferSize, const LibMCEnv_int32 * pValuesBuffer) override;
+
 };
 
 } // namespace Impl
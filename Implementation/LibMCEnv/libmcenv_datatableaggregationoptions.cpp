@@ -0,0 +1,165 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract: This is a stub class definition of CDataTableAggregationOptions
+
+*/
+
+#include "libmcenv_datatableaggregationoptions.hpp"
+#include "libmcenv_interfaceexception.hpp"
+
+// Include custom headers here.
+#include "common_utils.hpp"
+
+using namespace LibMCEnv::Impl;
+
+namespace {
+
+	void checkColumnIdentifier(const std::string & sIdentifier)
+	{
+		if (sIdentifier.empty())
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COLUMNIDENTIFIEREMPTY);
+
+		if (!AMCCommon::CUtils::stringIsValidAlphanumericNameString(sIdentifier))
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCOLUMNIDENTIFIER, "invalid column identifier: " + sIdentifier);
+	}
+
+}
+
+/*************************************************************************************************************************
+ Class definition of CDataTableAggregationOptions 
+**************************************************************************************************************************/
+
+CDataTableAggregationOptions::CDataTableAggregationOptions()
+{
+
+}
+
+CDataTableAggregationOptions::~CDataTableAggregationOptions()
+{
+
+}
+
+sDataTableAggregationEntry& CDataTableAggregationOptions::getAggregation(const LibMCEnv_uint32 nIndex)
+{
+	if (nIndex >= m_Aggregations.size())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLEQUERYINDEX, "invalid aggregation index: " + std::to_string(nIndex));
+
+	return m_Aggregations.at(nIndex);
+}
+
+void CDataTableAggregationOptions::checkNewResultIdentifier(const std::string & sIdentifier)
+{
+	checkColumnIdentifier(sIdentifier);
+
+	for (auto& sGroupColumn : m_GroupColumns)
+		if (sGroupColumn == sIdentifier)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_DUPLICATECOLUMNIDENTIFIER, "duplicate column identifier: " + sIdentifier);
+
+	for (auto& aggregation : m_Aggregations)
+		if (aggregation.m_sResultIdentifier == sIdentifier)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_DUPLICATECOLUMNIDENTIFIER, "duplicate column identifier: " + sIdentifier);
+}
+
+void CDataTableAggregationOptions::AddGroupColumn(const std::string & sColumnIdentifier)
+{
+	checkNewResultIdentifier(sColumnIdentifier);
+	m_GroupColumns.push_back(sColumnIdentifier);
+}
+
+LibMCEnv_uint32 CDataTableAggregationOptions::GetGroupColumnCount()
+{
+	return (uint32_t)m_GroupColumns.size();
+}
+
+std::string CDataTableAggregationOptions::GetGroupColumn(const LibMCEnv_uint32 nIndex)
+{
+	if (nIndex >= m_GroupColumns.size())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLEQUERYINDEX, "invalid group column index: " + std::to_string(nIndex));
+
+	return m_GroupColumns.at(nIndex);
+}
+
+void CDataTableAggregationOptions::AddAggregation(const std::string & sResultIdentifier, const std::string & sColumnIdentifier, const LibMCEnv::eDataTableAggregation eAggregation)
+{
+	checkColumnIdentifier(sColumnIdentifier);
+	checkNewResultIdentifier(sResultIdentifier);
+
+	switch (eAggregation) {
+	case LibMCEnv::eDataTableAggregation::Count:
+	case LibMCEnv::eDataTableAggregation::Sum:
+	case LibMCEnv::eDataTableAggregation::Minimum:
+	case LibMCEnv::eDataTableAggregation::Maximum:
+	case LibMCEnv::eDataTableAggregation::Mean:
+		break;
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLEAGGREGATION, "invalid data table aggregation: " + std::to_string((int)eAggregation));
+	}
+
+	sDataTableAggregationEntry aggregation;
+	aggregation.m_sResultIdentifier = sResultIdentifier;
+	aggregation.m_sColumnIdentifier = sColumnIdentifier;
+	aggregation.m_Aggregation = eAggregation;
+	m_Aggregations.push_back(aggregation);
+}
+
+LibMCEnv_uint32 CDataTableAggregationOptions::GetAggregationCount()
+{
+	return (uint32_t)m_Aggregations.size();
+}
+
+std::string CDataTableAggregationOptions::GetAggregationResultIdentifier(const LibMCEnv_uint32 nIndex)
+{
+	return getAggregation(nIndex).m_sResultIdentifier;
+}
+
+std::string CDataTableAggregationOptions::GetAggregationColumn(const LibMCEnv_uint32 nIndex)
+{
+	return getAggregation(nIndex).m_sColumnIdentifier;
+}
+
+LibMCEnv::eDataTableAggregation CDataTableAggregationOptions::GetAggregationType(const LibMCEnv_uint32 nIndex)
+{
+	return getAggregation(nIndex).m_Aggregation;
+}
+
+void CDataTableAggregationOptions::Clear()
+{
+	m_GroupColumns.clear();
+	m_Aggregations.clear();
+}
+
+const std::vector<std::string>& CDataTableAggregationOptions::getGroupColumns()
+{
+	return m_GroupColumns;
+}
+
+const std::vector<sDataTableAggregationEntry>& CDataTableAggregationOptions::getAggregations()
+{
+	return m_Aggregations;
+}
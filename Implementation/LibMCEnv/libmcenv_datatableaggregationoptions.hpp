@@ -0,0 +1,111 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract: This is the class declaration of CDataTableAggregationOptions
+
+*/
+
+
+#ifndef __LIBMCENV_DATATABLEAGGREGATIONOPTIONS
+#define __LIBMCENV_DATATABLEAGGREGATIONOPTIONS
+
+#include "libmcenv_interfaces.hpp"
+
+// Parent classes
+#include "libmcenv_base.hpp"
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4250)
+#endif
+
+// Include custom headers here.
+#include <vector>
+
+
+namespace LibMCEnv {
+namespace Impl {
+
+struct sDataTableAggregationEntry {
+	std::string m_sResultIdentifier;
+	std::string m_sColumnIdentifier;
+	LibMCEnv::eDataTableAggregation m_Aggregation;
+};
+
+/*************************************************************************************************************************
+ Class declaration of CDataTableAggregationOptions 
+**************************************************************************************************************************/
+
+class CDataTableAggregationOptions : public virtual IDataTableAggregationOptions, public virtual CBase {
+private:
+
+	std::vector<std::string> m_GroupColumns;
+
+	std::vector<sDataTableAggregationEntry> m_Aggregations;
+
+	sDataTableAggregationEntry& getAggregation(const LibMCEnv_uint32 nIndex);
+
+	// Result identifiers are the group columns and the aggregation results, and must be unique
+	void checkNewResultIdentifier(const std::string & sIdentifier);
+
+public:
+
+	CDataTableAggregationOptions();
+
+	virtual ~CDataTableAggregationOptions();
+
+	void AddGroupColumn(const std::string & sColumnIdentifier) override;
+
+	LibMCEnv_uint32 GetGroupColumnCount() override;
+
+	std::string GetGroupColumn(const LibMCEnv_uint32 nIndex) override;
+
+	void AddAggregation(const std::string & sResultIdentifier, const std::string & sColumnIdentifier, const LibMCEnv::eDataTableAggregation eAggregation) override;
+
+	LibMCEnv_uint32 GetAggregationCount() override;
+
+	std::string GetAggregationResultIdentifier(const LibMCEnv_uint32 nIndex) override;
+
+	std::string GetAggregationColumn(const LibMCEnv_uint32 nIndex) override;
+
+	LibMCEnv::eDataTableAggregation GetAggregationType(const LibMCEnv_uint32 nIndex) override;
+
+	void Clear() override;
+
+	const std::vector<std::string>& getGroupColumns();
+
+	const std::vector<sDataTableAggregationEntry>& getAggregations();
+
+};
+
+} // namespace Impl
+} // namespace LibMCEnv
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+#endif // __LIBMCENV_DATATABLEAGGREGATIONOPTIONS
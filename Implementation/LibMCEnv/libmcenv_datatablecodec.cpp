@@ -0,0 +1,698 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: Column encodings and compression of binary data table streams
+
+*/
+
+#include "libmcenv_datatablecodec.hpp"
+#include "libmcenv_interfaceexception.hpp"
+
+#include "amc_constants.hpp"
+#include "Libraries/zlib/zlib.h"
+#include "Libraries/lz4/lz4.h"
+#include "Libraries/lz4/lz4hc.h"
+
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <climits>
+#include <type_traits>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+using namespace LibMCEnv::Impl;
+
+namespace {
+
+	// Largest magnitude up to which every integer is exactly representable as double.
+	const double DATATABLECODEC_MAXEXACTINTEGER = 9007199254740992.0;
+
+	uint64_t valueToWord(double dValue)
+	{
+		uint64_t nWord;
+		memcpy(&nWord, &dValue, sizeof(nWord));
+		return nWord;
+	}
+
+	uint64_t valueToWord(int32_t nValue)
+	{
+		return (uint64_t)(int64_t)nValue;
+	}
+
+	uint64_t valueToWord(uint32_t nValue)
+	{
+		return nValue;
+	}
+
+	uint64_t valueToWord(int64_t nValue)
+	{
+		return (uint64_t)nValue;
+	}
+
+	uint64_t valueToWord(uint64_t nValue)
+	{
+		return nValue;
+	}
+
+	template <typename T> T wordToValue(uint64_t nWord)
+	{
+		return (T)nWord;
+	}
+
+	template <> double wordToValue<double>(uint64_t nWord)
+	{
+		double dValue;
+		memcpy(&dValue, &nWord, sizeof(dValue));
+		return dValue;
+	}
+
+	uint32_t countLeadingZeros(uint64_t nWord)
+	{
+#ifdef _MSC_VER
+		unsigned long nIndex;
+		_BitScanReverse64(&nIndex, nWord);
+		return 63 - (uint32_t)nIndex;
+#else
+		return (uint32_t)__builtin_clzll(nWord);
+#endif
+	}
+
+	uint32_t countTrailingZeros(uint64_t nWord)
+	{
+#ifdef _MSC_VER
+		unsigned long nIndex;
+		_BitScanForward64(&nIndex, nWord);
+		return (uint32_t)nIndex;
+#else
+		return (uint32_t)__builtin_ctzll(nWord);
+#endif
+	}
+
+	uint64_t encodeZigZag(uint64_t nWord)
+	{
+		return (nWord << 1) ^ (uint64_t)((int64_t)nWord >> 63);
+	}
+
+	uint64_t decodeZigZag(uint64_t nZigZag)
+	{
+		return (nZigZag >> 1) ^ (0 - (nZigZag & 1));
+	}
+
+	void writeVarUint(std::vector<uint8_t>& buffer, uint64_t nValue)
+	{
+		while (nValue >= 0x80) {
+			buffer.push_back((uint8_t)(nValue | 0x80));
+			nValue >>= 7;
+		}
+		buffer.push_back((uint8_t)nValue);
+	}
+
+	uint64_t readVarUint(const uint8_t* pData, size_t nDataSize, size_t& nPosition)
+	{
+		uint64_t nValue = 0;
+		for (uint32_t nShift = 0; nShift < 64; nShift += 7) {
+			if (nPosition >= nDataSize)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "variable length integer exceeds column data");
+
+			uint8_t nByte = pData[nPosition];
+			nPosition++;
+
+			nValue |= (uint64_t)(nByte & 0x7f) << nShift;
+			if ((nByte & 0x80) == 0)
+				return nValue;
+		}
+
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "variable length integer is too long");
+	}
+
+	// Writes bits MSB first. Single writes are limited to 32 bits, so that the pending bits always fit into the accumulator.
+	class CBitWriter {
+	private:
+		std::vector<uint8_t>& m_Buffer;
+		uint64_t m_nAccumulator;
+		uint32_t m_nBitCount;
+
+	public:
+		CBitWriter(std::vector<uint8_t>& buffer)
+			: m_Buffer(buffer), m_nAccumulator(0), m_nBitCount(0)
+		{
+		}
+
+		void writeBits(uint64_t nBits, uint32_t nBitCount)
+		{
+			if (nBitCount > 32) {
+				writeBits(nBits >> 32, nBitCount - 32);
+				nBitCount = 32;
+			}
+
+			m_nAccumulator = (m_nAccumulator << nBitCount) | (nBits & ((1ULL << nBitCount) - 1));
+			m_nBitCount += nBitCount;
+
+			while (m_nBitCount >= 8) {
+				m_nBitCount -= 8;
+				m_Buffer.push_back((uint8_t)(m_nAccumulator >> m_nBitCount));
+			}
+		}
+
+		void flush()
+		{
+			if (m_nBitCount > 0) {
+				m_Buffer.push_back((uint8_t)(m_nAccumulator << (8 - m_nBitCount)));
+				m_nBitCount = 0;
+			}
+		}
+	};
+
+	class CBitReader {
+	private:
+		const uint8_t* m_pData;
+		size_t m_nDataSize;
+		size_t m_nPosition;
+		uint64_t m_nAccumulator;
+		uint32_t m_nBitCount;
+
+	public:
+		CBitReader(const uint8_t* pData, size_t nDataSize)
+			: m_pData(pData), m_nDataSize(nDataSize), m_nPosition(0), m_nAccumulator(0), m_nBitCount(0)
+		{
+		}
+
+		uint64_t readBits(uint32_t nBitCount)
+		{
+			if (nBitCount > 32) {
+				uint64_t nHighBits = readBits(nBitCount - 32);
+				return (nHighBits << 32) | readBits(32);
+			}
+
+			while (m_nBitCount < nBitCount) {
+				if (m_nPosition >= m_nDataSize)
+					throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "bit stream exceeds column data");
+
+				m_nAccumulator = (m_nAccumulator << 8) | m_pData[m_nPosition];
+				m_nPosition++;
+				m_nBitCount += 8;
+			}
+
+			m_nBitCount -= nBitCount;
+			return (m_nAccumulator >> m_nBitCount) & ((1ULL << nBitCount) - 1);
+		}
+
+		bool isAtEnd()
+		{
+			return m_nPosition == m_nDataSize;
+		}
+	};
+
+	// Converts the bit patterns of a double column into integer words. Returns false, if a value is not an integer that can be
+	// restored exactly. Negative zero is rejected as well, as it would be restored as positive zero.
+	bool convertDoubleWordsToIntegerWords(const std::vector<uint64_t>& doubleWords, std::vector<uint64_t>& integerWords)
+	{
+		integerWords.resize(doubleWords.size());
+		for (size_t nIndex = 0; nIndex < doubleWords.size(); nIndex++) {
+			double dValue = wordToValue<double>(doubleWords[nIndex]);
+			if (!((dValue >= -DATATABLECODEC_MAXEXACTINTEGER) && (dValue <= DATATABLECODEC_MAXEXACTINTEGER)))
+				return false;
+			if (dValue != std::trunc(dValue))
+				return false;
+			if ((dValue == 0.0) && std::signbit(dValue))
+				return false;
+
+			integerWords[nIndex] = (uint64_t)(int64_t)dValue;
+		}
+
+		return true;
+	}
+
+	// Delta: zigzag coded first value, followed by the zigzag coded differences to the previous value.
+	// Delta of delta: as delta, but the differences are coded relative to the previous difference.
+	void encodeDelta(const std::vector<uint64_t>& words, bool bDeltaOfDelta, std::vector<uint8_t>& encodedData)
+	{
+		encodedData.clear();
+		if (words.empty())
+			return;
+
+		encodedData.reserve(words.size() * 2 + 16);
+		writeVarUint(encodedData, encodeZigZag(words[0]));
+
+		uint64_t nPreviousDelta = 0;
+		for (size_t nIndex = 1; nIndex < words.size(); nIndex++) {
+			uint64_t nDelta = words[nIndex] - words[nIndex - 1];
+			if (bDeltaOfDelta) {
+				writeVarUint(encodedData, encodeZigZag(nDelta - nPreviousDelta));
+				nPreviousDelta = nDelta;
+			}
+			else {
+				writeVarUint(encodedData, encodeZigZag(nDelta));
+			}
+		}
+	}
+
+	void decodeDelta(const uint8_t* pData, size_t nDataSize, bool bDeltaOfDelta, std::vector<uint64_t>& words)
+	{
+		// Every entry takes at least one byte
+		if (words.size() > nDataSize)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "delta encoded column is too short");
+
+		size_t nPosition = 0;
+		if (!words.empty()) {
+			words[0] = decodeZigZag(readVarUint(pData, nDataSize, nPosition));
+
+			uint64_t nPreviousDelta = 0;
+			for (size_t nIndex = 1; nIndex < words.size(); nIndex++) {
+				uint64_t nDelta = decodeZigZag(readVarUint(pData, nDataSize, nPosition));
+				if (bDeltaOfDelta) {
+					nDelta += nPreviousDelta;
+					nPreviousDelta = nDelta;
+				}
+
+				words[nIndex] = words[nIndex - 1] + nDelta;
+			}
+		}
+
+		if (nPosition != nDataSize)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "delta encoded column has trailing data");
+	}
+
+	// Run length: pairs of run length and value. The value is stored with the size of the column type, little endian.
+	void encodeRunLength(const std::vector<uint64_t>& words, uint32_t nValueSize, std::vector<uint8_t>& encodedData)
+	{
+		encodedData.clear();
+
+		size_t nRunStart = 0;
+		while (nRunStart < words.size()) {
+			uint64_t nValue = words[nRunStart];
+			size_t nRunEnd = nRunStart + 1;
+			while ((nRunEnd < words.size()) && (words[nRunEnd] == nValue))
+				nRunEnd++;
+
+			writeVarUint(encodedData, nRunEnd - nRunStart);
+			for (uint32_t nByteIndex = 0; nByteIndex < nValueSize; nByteIndex++)
+				encodedData.push_back((uint8_t)(nValue >> (nByteIndex * 8)));
+
+			nRunStart = nRunEnd;
+		}
+	}
+
+	void decodeRunLength(const uint8_t* pData, size_t nDataSize, uint32_t nValueSize, std::vector<uint64_t>& words)
+	{
+		size_t nPosition = 0;
+		size_t nWordIndex = 0;
+		while (nPosition < nDataSize) {
+			uint64_t nRunLength = readVarUint(pData, nDataSize, nPosition);
+			if ((nRunLength == 0) || (nRunLength > words.size() - nWordIndex))
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "invalid run length");
+			if (nDataSize - nPosition < nValueSize)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "run length value exceeds column data");
+
+			uint64_t nValue = 0;
+			for (uint32_t nByteIndex = 0; nByteIndex < nValueSize; nByteIndex++)
+				nValue |= (uint64_t)pData[nPosition + nByteIndex] << (nByteIndex * 8);
+			nPosition += nValueSize;
+
+			std::fill(words.begin() + nWordIndex, words.begin() + (nWordIndex + (size_t)nRunLength), nValue);
+			nWordIndex += (size_t)nRunLength;
+		}
+
+		if (nWordIndex != words.size())
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "run length encoded column is too short");
+	}
+
+	// Gorilla XOR encoding. The first word is stored with 64 bits. Every following word is XORed with its predecessor:
+	//   0                 - XOR is zero, the value repeats.
+	//   10 <bits>         - the meaningful bits fit into the window of the previous value and are stored with its width.
+	//   11 <6> <6> <bits> - count of leading zeros, width minus one, then the meaningful bits. Sets a new window.
+	// In contrast to the original paper, the leading zero count is not capped at 31, as 6 bits are used for it.
+	void encodeXOR(const std::vector<uint64_t>& words, std::vector<uint8_t>& encodedData)
+	{
+		encodedData.clear();
+		if (words.empty())
+			return;
+
+		encodedData.reserve(words.size() * 2 + 16);
+		CBitWriter writer(encodedData);
+		writer.writeBits(words[0], 64);
+
+		uint32_t nWindowLeadingZeros = 64;
+		uint32_t nWindowTrailingZeros = 0;
+
+		for (size_t nIndex = 1; nIndex < words.size(); nIndex++) {
+			uint64_t nXOR = words[nIndex] ^ words[nIndex - 1];
+			if (nXOR == 0) {
+				writer.writeBits(0, 1);
+				continue;
+			}
+
+			uint32_t nLeadingZeros = countLeadingZeros(nXOR);
+			uint32_t nTrailingZeros = countTrailingZeros(nXOR);
+
+			if ((nLeadingZeros >= nWindowLeadingZeros) && (nTrailingZeros >= nWindowTrailingZeros)) {
+				writer.writeBits(2, 2);
+				writer.writeBits(nXOR >> nWindowTrailingZeros, 64 - nWindowLeadingZeros - nWindowTrailingZeros);
+			}
+			else {
+				uint32_t nMeaningfulBits = 64 - nLeadingZeros - nTrailingZeros;
+				writer.writeBits(3, 2);
+				writer.writeBits(nLeadingZeros, 6);
+				writer.writeBits(nMeaningfulBits - 1, 6);
+				writer.writeBits(nXOR >> nTrailingZeros, nMeaningfulBits);
+
+				nWindowLeadingZeros = nLeadingZeros;
+				nWindowTrailingZeros = nTrailingZeros;
+			}
+		}
+
+		writer.flush();
+	}
+
+	void decodeXOR(const uint8_t* pData, size_t nDataSize, std::vector<uint64_t>& words)
+	{
+		// Every entry takes at least one bit
+		if (words.size() > nDataSize * 8)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "XOR encoded column is too short");
+
+		CBitReader reader(pData, nDataSize);
+		if (!words.empty()) {
+			words[0] = reader.readBits(64);
+
+			uint32_t nWindowLeadingZeros = 64;
+			uint32_t nWindowTrailingZeros = 0;
+
+			for (size_t nIndex = 1; nIndex < words.size(); nIndex++) {
+				uint64_t nXOR = 0;
+
+				if (reader.readBits(1) != 0) {
+					if (reader.readBits(1) != 0) {
+						uint32_t nLeadingZeros = (uint32_t)reader.readBits(6);
+						uint32_t nMeaningfulBits = (uint32_t)reader.readBits(6) + 1;
+						if (nLeadingZeros + nMeaningfulBits > 64)
+							throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "invalid XOR window");
+
+						nWindowLeadingZeros = nLeadingZeros;
+						nWindowTrailingZeros = 64 - nLeadingZeros - nMeaningfulBits;
+					}
+					else {
+						if (nWindowLeadingZeros >= 64)
+							throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "XOR window is not set");
+					}
+
+					nXOR = reader.readBits(64 - nWindowLeadingZeros - nWindowTrailingZeros) << nWindowTrailingZeros;
+				}
+
+				words[nIndex] = words[nIndex - 1] ^ nXOR;
+			}
+		}
+
+		if (!reader.isAtEnd())
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "XOR encoded column has trailing data");
+	}
+
+}
+
+
+template <typename T> uint32_t CDataTableColumnCodec::encodeValues(const std::vector<T>& values, LibMCEnv::eDataTableColumnEncoding encoding, std::vector<uint8_t>& encodedData)
+{
+	encodedData.clear();
+
+	switch (encoding) {
+		case LibMCEnv::eDataTableColumnEncoding::Raw:
+		case LibMCEnv::eDataTableColumnEncoding::Delta:
+		case LibMCEnv::eDataTableColumnEncoding::DeltaOfDelta:
+		case LibMCEnv::eDataTableColumnEncoding::RunLength:
+		case LibMCEnv::eDataTableColumnEncoding::XOR:
+		case LibMCEnv::eDataTableColumnEncoding::Automatic:
+			break;
+		default:
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNENCODING);
+	}
+
+	size_t nRawSize = values.size() * sizeof(T);
+
+	if (encoding != LibMCEnv::eDataTableColumnEncoding::Raw) {
+
+		std::vector<uint64_t> words;
+		words.resize(values.size());
+		for (size_t nIndex = 0; nIndex < values.size(); nIndex++)
+			words[nIndex] = valueToWord(values[nIndex]);
+
+		// Delta encodings work on integers. Double columns only qualify, if all values are integers.
+		std::vector<uint64_t> doubleIntegerWords;
+		const std::vector<uint64_t>* pIntegerWords = &words;
+		if (std::is_floating_point<T>::value) {
+			if (!convertDoubleWordsToIntegerWords(words, doubleIntegerWords))
+				pIntegerWords = nullptr;
+			else
+				pIntegerWords = &doubleIntegerWords;
+		}
+
+		switch (encoding) {
+			case LibMCEnv::eDataTableColumnEncoding::Delta:
+			case LibMCEnv::eDataTableColumnEncoding::DeltaOfDelta:
+				if (pIntegerWords != nullptr) {
+					bool bDeltaOfDelta = (encoding == LibMCEnv::eDataTableColumnEncoding::DeltaOfDelta);
+					encodeDelta(*pIntegerWords, bDeltaOfDelta, encodedData);
+					return bDeltaOfDelta ? DATATABLE_ENCODINGTYPE_DELTAOFDELTA : DATATABLE_ENCODINGTYPE_DELTA;
+				}
+
+				encodeXOR(words, encodedData);
+				return DATATABLE_ENCODINGTYPE_XOR;
+
+			case LibMCEnv::eDataTableColumnEncoding::RunLength:
+				encodeRunLength(words, sizeof(T), encodedData);
+				return DATATABLE_ENCODINGTYPE_RUNLENGTH;
+
+			case LibMCEnv::eDataTableColumnEncoding::XOR:
+				encodeXOR(words, encodedData);
+				return DATATABLE_ENCODINGTYPE_XOR;
+
+			default: {
+				// Automatic, raw data is only kept if no encoding is smaller
+				uint32_t nBestEncodingType = DATATABLE_ENCODINGTYPE_RAW;
+				std::vector<uint8_t> candidateData;
+
+				auto selectCandidate = [&](uint32_t nEncodingType) {
+					size_t nBestSize = (nBestEncodingType == DATATABLE_ENCODINGTYPE_RAW) ? nRawSize : encodedData.size();
+					if (candidateData.size() < nBestSize) {
+						std::swap(candidateData, encodedData);
+						nBestEncodingType = nEncodingType;
+					}
+				};
+
+				encodeRunLength(words, sizeof(T), candidateData);
+				selectCandidate(DATATABLE_ENCODINGTYPE_RUNLENGTH);
+
+				if (pIntegerWords != nullptr) {
+					encodeDelta(*pIntegerWords, false, candidateData);
+					selectCandidate(DATATABLE_ENCODINGTYPE_DELTA);
+					encodeDelta(*pIntegerWords, true, candidateData);
+					selectCandidate(DATATABLE_ENCODINGTYPE_DELTAOFDELTA);
+				}
+
+				encodeXOR(words, candidateData);
+				selectCandidate(DATATABLE_ENCODINGTYPE_XOR);
+
+				if (nBestEncodingType != DATATABLE_ENCODINGTYPE_RAW)
+					return nBestEncodingType;
+
+				break;
+			}
+		}
+	}
+
+	encodedData.resize(nRawSize);
+	if (nRawSize > 0)
+		memcpy(encodedData.data(), values.data(), nRawSize);
+
+	return DATATABLE_ENCODINGTYPE_RAW;
+}
+
+template <typename T> void CDataTableColumnCodec::decodeValues(uint32_t nEncodingType, const uint8_t* pEncodedData, size_t nEncodedDataSize, uint64_t nEntryCount, std::vector<T>& values)
+{
+	if ((pEncodedData == nullptr) && (nEncodedDataSize > 0))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+	if (nEntryCount > (uint64_t)(SIZE_MAX / sizeof(uint64_t)))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "invalid entry count");
+
+	if (nEncodingType == DATATABLE_ENCODINGTYPE_RAW) {
+		if (nEncodedDataSize != nEntryCount * sizeof(T))
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "raw column size does not match entry count");
+
+		values.resize((size_t)nEntryCount);
+		if (nEncodedDataSize > 0)
+			memcpy(values.data(), pEncodedData, nEncodedDataSize);
+		return;
+	}
+
+	std::vector<uint64_t> words;
+
+	switch (nEncodingType) {
+		case DATATABLE_ENCODINGTYPE_DELTA:
+		case DATATABLE_ENCODINGTYPE_DELTAOFDELTA:
+			if (nEntryCount > nEncodedDataSize)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "delta encoded column is too short");
+
+			words.resize((size_t)nEntryCount);
+			decodeDelta(pEncodedData, nEncodedDataSize, (nEncodingType == DATATABLE_ENCODINGTYPE_DELTAOFDELTA), words);
+
+			if (std::is_floating_point<T>::value) {
+				for (auto& nWord : words)
+					nWord = valueToWord((double)(int64_t)nWord);
+			}
+			break;
+
+		case DATATABLE_ENCODINGTYPE_RUNLENGTH:
+			words.resize((size_t)nEntryCount);
+			decodeRunLength(pEncodedData, nEncodedDataSize, sizeof(T), words);
+			break;
+
+		case DATATABLE_ENCODINGTYPE_XOR:
+			if (nEntryCount / 8 > nEncodedDataSize)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "XOR encoded column is too short");
+
+			words.resize((size_t)nEntryCount);
+			decodeXOR(pEncodedData, nEncodedDataSize, words);
+			break;
+
+		default:
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNENCODING, "unknown column encoding type " + std::to_string(nEncodingType));
+	}
+
+	values.resize((size_t)nEntryCount);
+	for (size_t nIndex = 0; nIndex < values.size(); nIndex++)
+		values[nIndex] = wordToValue<T>(words[nIndex]);
+}
+
+bool CDataTableColumnCodec::compressData(const std::vector<uint8_t>& data, uint32_t nCompressionType, uint32_t nCompressionLevel, std::vector<uint8_t>& compressedData)
+{
+	if (nCompressionLevel > DATATABLE_MAXCOMPRESSIONLEVEL)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOMPRESSIONLEVEL);
+
+	compressedData.clear();
+
+	// uLong is 32 bit on Windows and LZ4 takes int sizes. Larger columns are stored uncompressed.
+	if (data.empty() || (data.size() > (size_t)LZ4_MAX_INPUT_SIZE))
+		return false;
+
+	size_t nCompressedSize = 0;
+
+	switch (nCompressionType) {
+	case DATATABLE_COMPRESSIONTYPE_ZLIB: {
+		uLongf nZLibCompressedSize = compressBound((uLong)data.size());
+		compressedData.resize(nZLibCompressedSize);
+
+		int nResult = compress2(compressedData.data(), &nZLibCompressedSize, data.data(), (uLong)data.size(), (int)nCompressionLevel);
+		if (nResult != Z_OK)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COULDNOTCOMPRESSDATATABLECOLUMN, "zlib error " + std::to_string(nResult));
+
+		nCompressedSize = nZLibCompressedSize;
+		break;
+	}
+
+	case DATATABLE_COMPRESSIONTYPE_LZ4: {
+		int nBound = LZ4_compressBound((int)data.size());
+		compressedData.resize((size_t)nBound);
+
+		int nResult;
+		if (nCompressionLevel < DATATABLE_MINLZ4HCCOMPRESSIONLEVEL)
+			nResult = LZ4_compress_default((const char*)data.data(), (char*)compressedData.data(), (int)data.size(), nBound);
+		else
+			nResult = LZ4_compress_HC((const char*)data.data(), (char*)compressedData.data(), (int)data.size(), nBound, (int)nCompressionLevel);
+
+		if (nResult <= 0)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COULDNOTCOMPRESSDATATABLECOLUMN, "lz4 error " + std::to_string(nResult));
+
+		nCompressedSize = (size_t)nResult;
+		break;
+	}
+
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOMPRESSION, "invalid compression type: " + std::to_string(nCompressionType));
+	}
+
+	if (nCompressedSize >= data.size()) {
+		compressedData.clear();
+		return false;
+	}
+
+	compressedData.resize(nCompressedSize);
+	return true;
+}
+
+void CDataTableColumnCodec::decompressData(uint32_t nCompressionType, const uint8_t* pCompressedData, size_t nCompressedDataSize, size_t nDataSize, std::vector<uint8_t>& data)
+{
+	if (pCompressedData == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+	if ((nCompressedDataSize > (size_t)LZ4_MAX_INPUT_SIZE) || (nDataSize > (size_t)LZ4_MAX_INPUT_SIZE))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "compressed column is too large");
+
+	data.resize(nDataSize);
+
+	switch (nCompressionType) {
+	case DATATABLE_COMPRESSIONTYPE_ZLIB: {
+		uLongf nUncompressedSize = (uLongf)nDataSize;
+		int nResult = uncompress(data.data(), &nUncompressedSize, pCompressedData, (uLong)nCompressedDataSize);
+		if ((nResult != Z_OK) || (nUncompressedSize != nDataSize))
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "could not decompress column data");
+		break;
+	}
+
+	case DATATABLE_COMPRESSIONTYPE_LZ4: {
+		// LZ4_decompress_safe never writes beyond the target buffer, even for corrupt input.
+		int nResult = LZ4_decompress_safe((const char*)pCompressedData, (char*)data.data(), (int)nCompressedDataSize, (int)nDataSize);
+		if ((nResult < 0) || ((size_t)nResult != nDataSize))
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA, "could not decompress column data");
+		break;
+	}
+
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOMPRESSION, "invalid compression type: " + std::to_string(nCompressionType));
+	}
+}
+
+namespace LibMCEnv {
+namespace Impl {
+
+	template uint32_t CDataTableColumnCodec::encodeValues<double>(const std::vector<double>& values, LibMCEnv::eDataTableColumnEncoding encoding, std::vector<uint8_t>& encodedData);
+	template uint32_t CDataTableColumnCodec::encodeValues<int32_t>(const std::vector<int32_t>& values, LibMCEnv::eDataTableColumnEncoding encoding, std::vector<uint8_t>& encodedData);
+	template uint32_t CDataTableColumnCodec::encodeValues<uint32_t>(const std::vector<uint32_t>& values, LibMCEnv::eDataTableColumnEncoding encoding, std::vector<uint8_t>& encodedData);
+	template uint32_t CDataTableColumnCodec::encodeValues<int64_t>(const std::vector<int64_t>& values, LibMCEnv::eDataTableColumnEncoding encoding, std::vector<uint8_t>& encodedData);
+	template uint32_t CDataTableColumnCodec::encodeValues<uint64_t>(const std::vector<uint64_t>& values, LibMCEnv::eDataTableColumnEncoding encoding, std::vector<uint8_t>& encodedData);
+
+	template void CDataTableColumnCodec::decodeValues<double>(uint32_t nEncodingType, const uint8_t* pEncodedData, size_t nEncodedDataSize, uint64_t nEntryCount, std::vector<double>& values);
+	template void CDataTableColumnCodec::decodeValues<int32_t>(uint32_t nEncodingType, const uint8_t* pEncodedData, size_t nEncodedDataSize, uint64_t nEntryCount, std::vector<int32_t>& values);
+	template void CDataTableColumnCodec::decodeValues<uint32_t>(uint32_t nEncodingType, const uint8_t* pEncodedData, size_t nEncodedDataSize, uint64_t nEntryCount, std::vector<uint32_t>& values);
+	template void CDataTableColumnCodec::decodeValues<int64_t>(uint32_t nEncodingType, const uint8_t* pEncodedData, size_t nEncodedDataSize, uint64_t nEntryCount, std::vector<int64_t>& values);
+	template void CDataTableColumnCodec::decodeValues<uint64_t>(uint32_t nEncodingType, const uint8_t* pEncodedData, size_t nEncodedDataSize, uint64_t nEntryCount, std::vector<uint64_t>& values);
+
+} // namespace Impl
+} // namespace LibMCEnv
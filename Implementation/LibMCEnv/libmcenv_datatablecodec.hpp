@@ -0,0 +1,73 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: Column encodings and compression of binary data table streams
+
+*/
+
+
+#ifndef __LIBMCENV_DATATABLECODEC
+#define __LIBMCENV_DATATABLECODEC
+
+#include "libmcenv_types.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace LibMCEnv {
+namespace Impl {
+
+	// Encodes and decodes the values of a single data table column. Every encoding is lossless.
+	// Integer values are handled as 64 bit words (sign extended for signed columns), so that the integer
+	// column types share one code path. Double values use their bit pattern, except for the delta encodings,
+	// which are only applied if all values of the column are integers of at most 53 bits.
+	class CDataTableColumnCodec {
+	public:
+
+		// Encodes the values with the given encoding and returns the DATATABLE_ENCODINGTYPE_* that has actually been used.
+		// Automatic tries all applicable encodings and keeps the smallest result.
+		template <typename T> static uint32_t encodeValues(const std::vector<T>& values, LibMCEnv::eDataTableColumnEncoding encoding, std::vector<uint8_t>& encodedData);
+
+		// Decodes exactly nEntryCount values. Throws LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA if the data is inconsistent.
+		template <typename T> static void decodeValues(uint32_t nEncodingType, const uint8_t* pEncodedData, size_t nEncodedDataSize, uint64_t nEntryCount, std::vector<T>& values);
+
+		// Compresses with one of the DATATABLE_COMPRESSIONTYPE_* methods.
+		// Returns false, if the compressed data would not be smaller than the input.
+		static bool compressData(const std::vector<uint8_t>& data, uint32_t nCompressionType, uint32_t nCompressionLevel, std::vector<uint8_t>& compressedData);
+
+		// Throws LIBMCENV_ERROR_INVALIDDATATABLECOLUMNDATA if the data does not decompress to exactly nDataSize bytes.
+		static void decompressData(uint32_t nCompressionType, const uint8_t* pCompressedData, size_t nCompressedDataSize, size_t nDataSize, std::vector<uint8_t>& data);
+
+	};
+
+} // namespace Impl
+} // namespace LibMCEnv
+
+#endif // __LIBMCENV_DATATABLECODEC
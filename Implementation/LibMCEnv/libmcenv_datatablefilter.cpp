@@ -0,0 +1,136 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract: This is a stub class definition of CDataTableFilter
+
+*/
+
+#include "libmcenv_datatablefilter.hpp"
+#include "libmcenv_interfaceexception.hpp"
+#include "libmcenv_datatablequery.hpp"
+
+// Include custom headers here.
+#include "common_utils.hpp"
+
+using namespace LibMCEnv::Impl;
+
+/*************************************************************************************************************************
+ Class definition of CDataTableFilter 
+**************************************************************************************************************************/
+
+CDataTableFilter::CDataTableFilter()
+	: m_nRevision (CDataTableQuery::newRevision ())
+{
+
+}
+
+CDataTableFilter::~CDataTableFilter()
+{
+
+}
+
+sDataTableFilterCondition& CDataTableFilter::getCondition(const LibMCEnv_uint32 nIndex)
+{
+	if (nIndex >= m_Conditions.size())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLEQUERYINDEX, "invalid filter condition index: " + std::to_string(nIndex));
+
+	return m_Conditions.at(nIndex);
+}
+
+void CDataTableFilter::AddCondition(const std::string & sColumnIdentifier, const LibMCEnv::eDataTableFilterOperator eOperator, const LibMCEnv_double dValue, const LibMCEnv_double dUpperValue)
+{
+	if (sColumnIdentifier.empty())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COLUMNIDENTIFIEREMPTY);
+
+	if (!AMCCommon::CUtils::stringIsValidAlphanumericNameString(sColumnIdentifier))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCOLUMNIDENTIFIER, "invalid column identifier: " + sColumnIdentifier);
+
+	switch (eOperator) {
+	case LibMCEnv::eDataTableFilterOperator::Equal:
+	case LibMCEnv::eDataTableFilterOperator::NotEqual:
+	case LibMCEnv::eDataTableFilterOperator::Less:
+	case LibMCEnv::eDataTableFilterOperator::LessOrEqual:
+	case LibMCEnv::eDataTableFilterOperator::Greater:
+	case LibMCEnv::eDataTableFilterOperator::GreaterOrEqual:
+	case LibMCEnv::eDataTableFilterOperator::InRange:
+	case LibMCEnv::eDataTableFilterOperator::OutsideRange:
+		break;
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLEFILTEROPERATOR, "invalid data table filter operator: " + std::to_string((int)eOperator));
+	}
+
+	sDataTableFilterCondition condition;
+	condition.m_sColumnIdentifier = sColumnIdentifier;
+	condition.m_Operator = eOperator;
+	condition.m_dValue = dValue;
+	condition.m_dUpperValue = dUpperValue;
+	m_Conditions.push_back(condition);
+
+	m_nRevision = CDataTableQuery::newRevision();
+}
+
+LibMCEnv_uint32 CDataTableFilter::GetConditionCount()
+{
+	return (uint32_t)m_Conditions.size();
+}
+
+std::string CDataTableFilter::GetConditionColumn(const LibMCEnv_uint32 nIndex)
+{
+	return getCondition(nIndex).m_sColumnIdentifier;
+}
+
+LibMCEnv::eDataTableFilterOperator CDataTableFilter::GetConditionOperator(const LibMCEnv_uint32 nIndex)
+{
+	return getCondition(nIndex).m_Operator;
+}
+
+LibMCEnv_double CDataTableFilter::GetConditionValue(const LibMCEnv_uint32 nIndex)
+{
+	return getCondition(nIndex).m_dValue;
+}
+
+LibMCEnv_double CDataTableFilter::GetConditionUpperValue(const LibMCEnv_uint32 nIndex)
+{
+	return getCondition(nIndex).m_dUpperValue;
+}
+
+void CDataTableFilter::Clear()
+{
+	m_Conditions.clear();
+	m_nRevision = CDataTableQuery::newRevision();
+}
+
+const std::vector<sDataTableFilterCondition>& CDataTableFilter::getConditions()
+{
+	return m_Conditions;
+}
+
+uint64_t CDataTableFilter::getRevision()
+{
+	return m_nRevision;
+}
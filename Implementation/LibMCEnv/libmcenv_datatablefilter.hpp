@@ -0,0 +1,106 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract: This is the class declaration of CDataTableFilter
+
+*/
+
+
+#ifndef __LIBMCENV_DATATABLEFILTER
+#define __LIBMCENV_DATATABLEFILTER
+
+#include "libmcenv_interfaces.hpp"
+
+// Parent classes
+#include "libmcenv_base.hpp"
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4250)
+#endif
+
+// Include custom headers here.
+#include <vector>
+
+
+namespace LibMCEnv {
+namespace Impl {
+
+struct sDataTableFilterCondition {
+	std::string m_sColumnIdentifier;
+	LibMCEnv::eDataTableFilterOperator m_Operator;
+	double m_dValue;
+	double m_dUpperValue;
+};
+
+/*************************************************************************************************************************
+ Class declaration of CDataTableFilter 
+**************************************************************************************************************************/
+
+class CDataTableFilter : public virtual IDataTableFilter, public virtual CBase {
+private:
+
+	std::vector<sDataTableFilterCondition> m_Conditions;
+
+	// Changes with every modification of the conditions
+	uint64_t m_nRevision;
+
+	sDataTableFilterCondition& getCondition(const LibMCEnv_uint32 nIndex);
+
+public:
+
+	CDataTableFilter();
+
+	virtual ~CDataTableFilter();
+
+	void AddCondition(const std::string & sColumnIdentifier, const LibMCEnv::eDataTableFilterOperator eOperator, const LibMCEnv_double dValue, const LibMCEnv_double dUpperValue) override;
+
+	LibMCEnv_uint32 GetConditionCount() override;
+
+	std::string GetConditionColumn(const LibMCEnv_uint32 nIndex) override;
+
+	LibMCEnv::eDataTableFilterOperator GetConditionOperator(const LibMCEnv_uint32 nIndex) override;
+
+	LibMCEnv_double GetConditionValue(const LibMCEnv_uint32 nIndex) override;
+
+	LibMCEnv_double GetConditionUpperValue(const LibMCEnv_uint32 nIndex) override;
+
+	void Clear() override;
+
+	const std::vector<sDataTableFilterCondition>& getConditions();
+
+	uint64_t getRevision();
+
+};
+
+} // namespace Impl
+} // namespace LibMCEnv
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+#endif // __LIBMCENV_DATATABLEFILTER
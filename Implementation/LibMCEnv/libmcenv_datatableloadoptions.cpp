@@ -0,0 +1,136 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is a stub class definition of CDataTableLoadOptions
+
+*/
+
+#include "libmcenv_datatableloadoptions.hpp"
+#include "libmcenv_interfaceexception.hpp"
+
+// Include custom headers here.
+#include "common_utils.hpp"
+
+using namespace LibMCEnv::Impl;
+
+/*************************************************************************************************************************
+ Class definition of CDataTableLoadOptions 
+**************************************************************************************************************************/
+
+CDataTableLoadOptions::CDataTableLoadOptions()
+	: m_bHasRowRange (false), m_nFirstRow (0), m_nRowCount (0), m_bLazyLoading (true)
+{
+
+}
+
+CDataTableLoadOptions::~CDataTableLoadOptions()
+{
+
+}
+
+void CDataTableLoadOptions::AddColumn(const std::string & sColumnIdentifier)
+{
+	if (sColumnIdentifier.empty())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COLUMNIDENTIFIEREMPTY);
+
+	if (!AMCCommon::CUtils::stringIsValidAlphanumericNameString(sColumnIdentifier))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCOLUMNIDENTIFIER, "invalid column identifier: " + sColumnIdentifier);
+
+	if (m_ColumnSet.find(sColumnIdentifier) != m_ColumnSet.end())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_DUPLICATECOLUMNIDENTIFIER, "duplicate column identifier: " + sColumnIdentifier);
+
+	m_Columns.push_back(sColumnIdentifier);
+	m_ColumnSet.insert(sColumnIdentifier);
+}
+
+LibMCEnv_uint32 CDataTableLoadOptions::GetColumnCount()
+{
+	return (uint32_t)m_Columns.size();
+}
+
+std::string CDataTableLoadOptions::GetColumn(const LibMCEnv_uint32 nIndex)
+{
+	if (nIndex >= m_Columns.size())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLEQUERYINDEX, "invalid load column index: " + std::to_string(nIndex));
+
+	return m_Columns.at(nIndex);
+}
+
+void CDataTableLoadOptions::ClearColumns()
+{
+	m_Columns.clear();
+	m_ColumnSet.clear();
+}
+
+void CDataTableLoadOptions::SetRowRange(const LibMCEnv_uint64 nFirstRow, const LibMCEnv_uint64 nRowCount)
+{
+	if (nRowCount > UINT64_MAX - nFirstRow)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLEROWRANGE, "invalid data table row range: " + std::to_string(nFirstRow) + "/" + std::to_string(nRowCount));
+
+	m_bHasRowRange = true;
+	m_nFirstRow = nFirstRow;
+	m_nRowCount = nRowCount;
+}
+
+bool CDataTableLoadOptions::HasRowRange()
+{
+	return m_bHasRowRange;
+}
+
+LibMCEnv_uint64 CDataTableLoadOptions::GetFirstRow()
+{
+	return m_nFirstRow;
+}
+
+LibMCEnv_uint64 CDataTableLoadOptions::GetRowCount()
+{
+	return m_nRowCount;
+}
+
+void CDataTableLoadOptions::ClearRowRange()
+{
+	m_bHasRowRange = false;
+	m_nFirstRow = 0;
+	m_nRowCount = 0;
+}
+
+void CDataTableLoadOptions::SetLazyLoading(const bool bLazyLoading)
+{
+	m_bLazyLoading = bLazyLoading;
+}
+
+bool CDataTableLoadOptions::GetLazyLoading()
+{
+	return m_bLazyLoading;
+}
+
+const std::vector<std::string>& CDataTableLoadOptions::getColumns()
+{
+	return m_Columns;
+}
@@ -0,0 +1,111 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is the class declaration of CDataTableLoadOptions
+
+*/
+
+
+#ifndef __LIBMCENV_DATATABLELOADOPTIONS
+#define __LIBMCENV_DATATABLELOADOPTIONS
+
+#include "libmcenv_interfaces.hpp"
+
+// Parent classes
+#include "libmcenv_base.hpp"
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4250)
+#endif
+
+// Include custom headers here.
+#include <vector>
+#include <set>
+
+
+namespace LibMCEnv {
+namespace Impl {
+
+
+/*************************************************************************************************************************
+ Class declaration of CDataTableLoadOptions 
+**************************************************************************************************************************/
+
+class CDataTableLoadOptions : public virtual IDataTableLoadOptions, public virtual CBase {
+private:
+
+	// Projected columns in the order they have been added. An empty list loads all columns.
+	std::vector<std::string> m_Columns;
+	std::set<std::string> m_ColumnSet;
+
+	bool m_bHasRowRange;
+	uint64_t m_nFirstRow;
+	uint64_t m_nRowCount;
+
+	bool m_bLazyLoading;
+
+public:
+
+	CDataTableLoadOptions();
+
+	virtual ~CDataTableLoadOptions();
+
+	void AddColumn(const std::string & sColumnIdentifier) override;
+
+	LibMCEnv_uint32 GetColumnCount() override;
+
+	std::string GetColumn(const LibMCEnv_uint32 nIndex) override;
+
+	void ClearColumns() override;
+
+	void SetRowRange(const LibMCEnv_uint64 nFirstRow, const LibMCEnv_uint64 nRowCount) override;
+
+	bool HasRowRange() override;
+
+	LibMCEnv_uint64 GetFirstRow() override;
+
+	LibMCEnv_uint64 GetRowCount() override;
+
+	void ClearRowRange() override;
+
+	void SetLazyLoading(const bool bLazyLoading) override;
+
+	bool GetLazyLoading() override;
+
+	const std::vector<std::string>& getColumns();
+
+};
+
+} // namespace Impl
+} // namespace LibMCEnv
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+#endif // __LIBMCENV_DATATABLELOADOPTIONS
@@ -0,0 +1,760 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: Filter, sort, group and window kernels on data table columns
+
+*/
+
+#include "libmcenv_datatablequery.hpp"
+#include "libmcenv_interfaceexception.hpp"
+
+#include "amc_constants.hpp"
+#include "common_parallelblocks.hpp"
+
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <numeric>
+#include <atomic>
+#include <type_traits>
+
+using namespace LibMCEnv::Impl;
+
+namespace {
+
+	const uint64_t DATATABLEQUERY_SIGNBIT = 0x8000000000000000ULL;
+
+	// Calls function with a typed pointer to the values of the column.
+	template <typename F> void dispatchColumn(const sDataTableColumnView& column, F function)
+	{
+		switch (column.m_ColumnType) {
+		case LibMCEnv::eDataTableColumnType::DoubleColumn:
+			function((const double*)column.m_pData);
+			break;
+		case LibMCEnv::eDataTableColumnType::Int32Column:
+			function((const int32_t*)column.m_pData);
+			break;
+		case LibMCEnv::eDataTableColumnType::Int64Column:
+			function((const int64_t*)column.m_pData);
+			break;
+		case LibMCEnv::eDataTableColumnType::Uint32Column:
+			function((const uint32_t*)column.m_pData);
+			break;
+		case LibMCEnv::eDataTableColumnType::Uint64Column:
+			function((const uint64_t*)column.m_pData);
+			break;
+		default:
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCOLUMNDATATYPE);
+		}
+	}
+
+	template <typename T> T typeMinimum()
+	{
+		if (std::is_floating_point<T>::value)
+			return -std::numeric_limits<T>::infinity();
+		return std::numeric_limits<T>::lowest();
+	}
+
+	template <typename T> T typeMaximum()
+	{
+		if (std::is_floating_point<T>::value)
+			return std::numeric_limits<T>::infinity();
+		return std::numeric_limits<T>::max();
+	}
+
+	// Smallest value of T that is greater or equal to dValue. Returns false, if there is none. dValue MUST not be NaN.
+	template <typename T> bool ceilToType(double dValue, T& result)
+	{
+		if constexpr (std::is_floating_point<T>::value) {
+			result = dValue;
+			return true;
+		}
+		else {
+			// First integer that does not fit into T anymore
+			const double dLimit = std::ldexp(1.0, std::numeric_limits<T>::digits);
+			if (dValue <= (double)std::numeric_limits<T>::min()) {
+				result = std::numeric_limits<T>::min();
+				return true;
+			}
+
+			double dCeil = std::ceil(dValue);
+			if (dCeil >= dLimit)
+				return false;
+
+			result = (T)dCeil;
+			return true;
+		}
+	}
+
+	// Largest value of T that is less or equal to dValue. Returns false, if there is none. dValue MUST not be NaN.
+	template <typename T> bool floorToType(double dValue, T& result)
+	{
+		if constexpr (std::is_floating_point<T>::value) {
+			result = dValue;
+			return true;
+		}
+		else {
+			const double dLimit = std::ldexp(1.0, std::numeric_limits<T>::digits);
+			if (dValue < (double)std::numeric_limits<T>::min())
+				return false;
+
+			if (dValue >= dLimit) {
+				result = std::numeric_limits<T>::max();
+				return true;
+			}
+
+			result = (T)std::floor(dValue);
+			return true;
+		}
+	}
+
+	template <typename T> T nextBelow(T value)
+	{
+		if constexpr (std::is_floating_point<T>::value)
+			return std::nextafter(value, -std::numeric_limits<T>::infinity());
+		else
+			return value - 1;
+	}
+
+	template <typename T> T nextAbove(T value)
+	{
+		if constexpr (std::is_floating_point<T>::value)
+			return std::nextafter(value, std::numeric_limits<T>::infinity());
+		else
+			return value + 1;
+	}
+
+	// Every condition is evaluated as an inclusive value range. A row matches if its value is within the range,
+	// or outside of it for the inverted operators. NaN values are never within a range.
+	template <typename T> struct sConditionRange {
+		bool m_bEmpty;
+		bool m_bInvert;
+		T m_Lower;
+		T m_Upper;
+	};
+
+	template <typename T> sConditionRange<T> makeConditionRange(LibMCEnv::eDataTableFilterOperator filterOperator, double dValue, double dUpperValue)
+	{
+		sConditionRange<T> range;
+		range.m_bEmpty = false;
+		range.m_bInvert = (filterOperator == LibMCEnv::eDataTableFilterOperator::NotEqual) || (filterOperator == LibMCEnv::eDataTableFilterOperator::OutsideRange);
+		range.m_Lower = typeMinimum<T>();
+		range.m_Upper = typeMaximum<T>();
+
+		bool bHasUpperValue = (filterOperator == LibMCEnv::eDataTableFilterOperator::InRange) || (filterOperator == LibMCEnv::eDataTableFilterOperator::OutsideRange);
+		if (std::isnan(dValue) || (bHasUpperValue && std::isnan(dUpperValue))) {
+			range.m_bEmpty = true;
+			return range;
+		}
+
+		T bound;
+		switch (filterOperator) {
+		case LibMCEnv::eDataTableFilterOperator::Equal:
+		case LibMCEnv::eDataTableFilterOperator::NotEqual:
+			range.m_bEmpty = !(ceilToType(dValue, range.m_Lower) && floorToType(dValue, range.m_Upper));
+			break;
+
+		case LibMCEnv::eDataTableFilterOperator::Less:
+			// All values are less, if there is no value greater or equal to the threshold
+			if (ceilToType(dValue, bound)) {
+				if (bound == typeMinimum<T>())
+					range.m_bEmpty = true;
+				else
+					range.m_Upper = nextBelow(bound);
+			}
+			break;
+
+		case LibMCEnv::eDataTableFilterOperator::LessOrEqual:
+			range.m_bEmpty = !floorToType(dValue, range.m_Upper);
+			break;
+
+		case LibMCEnv::eDataTableFilterOperator::Greater:
+			// All values are greater, if there is no value less or equal to the threshold
+			if (floorToType(dValue, bound)) {
+				if (bound == typeMaximum<T>())
+					range.m_bEmpty = true;
+				else
+					range.m_Lower = nextAbove(bound);
+			}
+			break;
+
+		case LibMCEnv::eDataTableFilterOperator::GreaterOrEqual:
+			range.m_bEmpty = !ceilToType(dValue, range.m_Lower);
+			break;
+
+		case LibMCEnv::eDataTableFilterOperator::InRange:
+		case LibMCEnv::eDataTableFilterOperator::OutsideRange:
+			range.m_bEmpty = !(ceilToType(dValue, range.m_Lower) && floorToType(dUpperValue, range.m_Upper));
+			break;
+
+		default:
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLEFILTEROPERATOR);
+		}
+
+		if (!range.m_bEmpty && (range.m_Lower > range.m_Upper))
+			range.m_bEmpty = true;
+
+		return range;
+	}
+
+	template <typename T> void applyConditionRange(const T* pValues, size_t nFirstRow, size_t nRowCount, const sConditionRange<T>& range, uint8_t* pRowFlags)
+	{
+		const T lower = range.m_Lower;
+		const T upper = range.m_Upper;
+		const uint8_t nInvert = range.m_bInvert ? 1 : 0;
+
+		// Branch free, so that the compiler can vectorise the loop
+		for (size_t nIndex = nFirstRow; nIndex < nFirstRow + nRowCount; nIndex++) {
+			const T value = pValues[nIndex];
+			uint8_t nInRange = (uint8_t)((value >= lower) & (value <= upper));
+			pRowFlags[nIndex] &= (uint8_t)(nInRange ^ nInvert);
+		}
+	}
+
+	// Maps values to unsigned integers with the same order, so that all column types share one radix sort.
+	// NaN maps to the largest key in both directions, negative zero maps to the key of positive zero.
+	inline uint64_t orderKey(double dValue, bool bDescending)
+	{
+		if (std::isnan(dValue))
+			return UINT64_MAX;
+
+		if (dValue == 0.0)
+			dValue = 0.0;
+
+		uint64_t nBits;
+		memcpy(&nBits, &dValue, sizeof(nBits));
+
+		uint64_t nKey = (nBits & DATATABLEQUERY_SIGNBIT) ? ~nBits : (nBits | DATATABLEQUERY_SIGNBIT);
+		return bDescending ? ~nKey : nKey;
+	}
+
+	inline uint64_t orderKey(int32_t nValue, bool bDescending)
+	{
+		uint64_t nKey = ((uint64_t)(int64_t)nValue) ^ DATATABLEQUERY_SIGNBIT;
+		return bDescending ? ~nKey : nKey;
+	}
+
+	inline uint64_t orderKey(int64_t nValue, bool bDescending)
+	{
+		uint64_t nKey = ((uint64_t)nValue) ^ DATATABLEQUERY_SIGNBIT;
+		return bDescending ? ~nKey : nKey;
+	}
+
+	inline uint64_t orderKey(uint32_t nValue, bool bDescending)
+	{
+		uint64_t nKey = nValue;
+		return bDescending ? ~nKey : nKey;
+	}
+
+	inline uint64_t orderKey(uint64_t nValue, bool bDescending)
+	{
+		return bDescending ? ~nValue : nValue;
+	}
+
+	// Computes the order keys of a column in the given row order.
+	void computeOrderKeys(const sDataTableColumnView& column, const std::vector<uint32_t>& rowIndices, bool bDescending, std::vector<uint64_t>& keys, uint32_t nThreadCount)
+	{
+		keys.resize(rowIndices.size());
+		uint64_t* pKeys = keys.data();
+		const uint32_t* pRowIndices = rowIndices.data();
+		size_t nStoredRowCount = column.m_nRowCount;
+
+		dispatchColumn(column, [&](auto pValues) {
+			typedef typename std::remove_const<typename std::remove_pointer<decltype(pValues)>::type>::type T;
+
+			AMCCommon::CParallelBlocks::processBlocks(nThreadCount, rowIndices.size(), DATATABLE_MINROWSPERTHREAD, [&](uint32_t nBlockIndex, size_t nFirstItem, size_t nItemCount) {
+				for (size_t nIndex = nFirstItem; nIndex < nFirstItem + nItemCount; nIndex++) {
+					uint32_t nRowIndex = pRowIndices[nIndex];
+					T value = (nRowIndex < nStoredRowCount) ? pValues[nRowIndex] : (T)0;
+					pKeys[nIndex] = orderKey(value, bDescending);
+				}
+			});
+		});
+	}
+
+	// Stable LSD radix sort of key and row index pairs with 8 bit digits. Digits that are equal for all keys are skipped.
+	// Every block of items gets its own histogram. The target offsets are assigned block after block within each digit,
+	// so the result is the same for every block count.
+	void radixSortPairs(std::vector<uint64_t>& keys, std::vector<uint32_t>& rowIndices, uint32_t nThreadCount)
+	{
+		size_t nCount = keys.size();
+		if (nCount < 2)
+			return;
+
+		uint64_t nFirstKey = keys[0];
+		uint64_t nDifferentBits = 0;
+		for (uint64_t nKey : keys)
+			nDifferentBits |= (nKey ^ nFirstKey);
+
+		if (nDifferentBits == 0)
+			return;
+
+		uint32_t nBlockCount = AMCCommon::CParallelBlocks::getBlockCount(nThreadCount, nCount, DATATABLE_MINROWSPERTHREAD);
+
+		std::vector<uint64_t> keyBuffer(nCount);
+		std::vector<uint32_t> rowIndexBuffer(nCount);
+		std::vector<size_t> blockOffsets((size_t)nBlockCount * 256);
+
+		for (uint32_t nShift = 0; nShift < 64; nShift += 8) {
+			if (((nDifferentBits >> nShift) & 0xff) == 0)
+				continue;
+
+			const uint64_t* pKeys = keys.data();
+			const uint32_t* pRowIndices = rowIndices.data();
+			uint64_t* pKeyBuffer = keyBuffer.data();
+			uint32_t* pRowIndexBuffer = rowIndexBuffer.data();
+
+			std::fill(blockOffsets.begin(), blockOffsets.end(), 0);
+
+			AMCCommon::CParallelBlocks::processBlocks(nThreadCount, nCount, DATATABLE_MINROWSPERTHREAD, [&](uint32_t nBlockIndex, size_t nFirstItem, size_t nItemCount) {
+				size_t* pCounts = &blockOffsets[(size_t)nBlockIndex * 256];
+				for (size_t nIndex = nFirstItem; nIndex < nFirstItem + nItemCount; nIndex++)
+					pCounts[(pKeys[nIndex] >> nShift) & 0xff]++;
+			});
+
+			size_t nOffset = 0;
+			for (uint32_t nDigit = 0; nDigit < 256; nDigit++) {
+				for (uint32_t nBlockIndex = 0; nBlockIndex < nBlockCount; nBlockIndex++) {
+					size_t& nEntry = blockOffsets[(size_t)nBlockIndex * 256 + nDigit];
+					size_t nDigitCount = nEntry;
+					nEntry = nOffset;
+					nOffset += nDigitCount;
+				}
+			}
+
+			AMCCommon::CParallelBlocks::processBlocks(nThreadCount, nCount, DATATABLE_MINROWSPERTHREAD, [&](uint32_t nBlockIndex, size_t nFirstItem, size_t nItemCount) {
+				size_t* pOffsets = &blockOffsets[(size_t)nBlockIndex * 256];
+				for (size_t nIndex = nFirstItem; nIndex < nFirstItem + nItemCount; nIndex++) {
+					uint64_t nKey = pKeys[nIndex];
+					size_t nTarget = pOffsets[(nKey >> nShift) & 0xff]++;
+					pKeyBuffer[nTarget] = nKey;
+					pRowIndexBuffer[nTarget] = pRowIndices[nIndex];
+				}
+			});
+
+			keys.swap(keyBuffer);
+			rowIndices.swap(rowIndexBuffer);
+		}
+	}
+
+	// Window aggregates that are combined from partial aggregates of neighbouring row ranges. Combine always
+	// takes the older rows first. Sums follow the IEEE rules for infinities and NaN.
+	struct sWindowSumPolicy {
+		typedef double Aggregate;
+		static double make(double dValue) { return dValue; }
+		static double combine(double dOlder, double dNewer) { return dOlder + dNewer; }
+		static double result(double dSum, size_t nCount) { return dSum; }
+	};
+
+	struct sWindowMeanPolicy : public sWindowSumPolicy {
+		static double result(double dSum, size_t nCount) { return dSum / (double)nCount; }
+	};
+
+	struct sWindowMinimumPolicy {
+		typedef double Aggregate;
+		static double make(double dValue) { return dValue; }
+		static double combine(double dOlder, double dNewer)
+		{
+			if (std::isnan(dOlder) || std::isnan(dNewer))
+				return std::numeric_limits<double>::quiet_NaN();
+			return std::min(dOlder, dNewer);
+		}
+		static double result(double dMinimum, size_t nCount) { return dMinimum; }
+	};
+
+	struct sWindowMaximumPolicy {
+		typedef double Aggregate;
+		static double make(double dValue) { return dValue; }
+		static double combine(double dOlder, double dNewer)
+		{
+			if (std::isnan(dOlder) || std::isnan(dNewer))
+				return std::numeric_limits<double>::quiet_NaN();
+			return std::max(dOlder, dNewer);
+		}
+		static double result(double dMaximum, size_t nCount) { return dMaximum; }
+	};
+
+	// Count, mean and sum of squared deviations, merged with the pairwise update of Chan et al.
+	// This stays precise for values with a large offset, like timestamps.
+	struct sWindowMoments {
+		double m_dCount;
+		double m_dMean;
+		double m_dSquaredDeviations;
+		bool m_bHasNonFiniteValue;
+	};
+
+	struct sWindowStandardDeviationPolicy {
+		typedef sWindowMoments Aggregate;
+
+		static sWindowMoments make(double dValue)
+		{
+			bool bIsFinite = std::isfinite(dValue);
+			return { 1.0, bIsFinite ? dValue : 0.0, 0.0, !bIsFinite };
+		}
+
+		static sWindowMoments combine(const sWindowMoments& older, const sWindowMoments& newer)
+		{
+			double dCount = older.m_dCount + newer.m_dCount;
+			double dDelta = newer.m_dMean - older.m_dMean;
+			sWindowMoments moments;
+			moments.m_dCount = dCount;
+			moments.m_dMean = older.m_dMean + dDelta * (newer.m_dCount / dCount);
+			moments.m_dSquaredDeviations = older.m_dSquaredDeviations + newer.m_dSquaredDeviations + dDelta * dDelta * (older.m_dCount * newer.m_dCount / dCount);
+			moments.m_bHasNonFiniteValue = older.m_bHasNonFiniteValue || newer.m_bHasNonFiniteValue;
+			return moments;
+		}
+
+		static double result(const sWindowMoments& moments, size_t nCount)
+		{
+			if (moments.m_bHasNonFiniteValue)
+				return std::numeric_limits<double>::quiet_NaN();
+			if (nCount < 2)
+				return 0.0;
+			return std::sqrt(std::max(moments.m_dSquaredDeviations, 0.0) / (double)(nCount - 1));
+		}
+	};
+
+	// Computes the trailing window of the rows nFirstRow to nEndRow. The rows are split into chunks of nWindowSize
+	// rows, starting at row 0. Every window consists of a suffix of one chunk and a prefix of the next, so it is
+	// combined from one suffix and one prefix aggregate, without ever removing values again. Each result only depends
+	// on its own chunks, and not on the block of rows it is computed in.
+	template <typename TPolicy, typename F> void computeWindowAggregates(F valueOf, size_t nFirstRow, size_t nEndRow, size_t nWindowSize, double* pResults)
+	{
+		typedef typename TPolicy::Aggregate Aggregate;
+
+		size_t nFirstWindowRow = (nFirstRow + 1 >= nWindowSize) ? (nFirstRow + 1 - nWindowSize) : 0;
+		size_t nRangeStart = (nFirstWindowRow / nWindowSize) * nWindowSize;
+		size_t nSuffixEnd = std::max(((nEndRow - 1) / nWindowSize) * nWindowSize, nRangeStart);
+
+		std::vector<Aggregate> prefixAggregates(nEndRow - nRangeStart);
+		for (size_t nRow = nRangeStart; nRow < nEndRow; nRow++) {
+			Aggregate aggregate = TPolicy::make(valueOf(nRow));
+			if (nRow % nWindowSize != 0)
+				aggregate = TPolicy::combine(prefixAggregates[nRow - nRangeStart - 1], aggregate);
+			prefixAggregates[nRow - nRangeStart] = aggregate;
+		}
+
+		// Only complete chunks before the chunk of the last row need suffixes
+		std::vector<Aggregate> suffixAggregates(nSuffixEnd - nRangeStart);
+		for (size_t nRow = nSuffixEnd; nRow > nRangeStart; nRow--) {
+			Aggregate aggregate = TPolicy::make(valueOf(nRow - 1));
+			if (nRow % nWindowSize != 0)
+				aggregate = TPolicy::combine(aggregate, suffixAggregates[nRow - nRangeStart]);
+			suffixAggregates[nRow - 1 - nRangeStart] = aggregate;
+		}
+
+		for (size_t nRow = nFirstRow; nRow < nEndRow; nRow++) {
+			size_t nCount = std::min(nRow + 1, nWindowSize);
+
+			// Windows that start with a chunk are a prefix of that chunk
+			if ((nRow + 1 < nWindowSize) || ((nRow + 1) % nWindowSize == 0)) {
+				pResults[nRow] = TPolicy::result(prefixAggregates[nRow - nRangeStart], nCount);
+			}
+			else {
+				size_t nWindowStart = nRow + 1 - nWindowSize;
+				pResults[nRow] = TPolicy::result(TPolicy::combine(suffixAggregates[nWindowStart - nRangeStart], prefixAggregates[nRow - nRangeStart]), nCount);
+			}
+		}
+	}
+
+}
+
+
+uint64_t CDataTableQuery::newRevision()
+{
+	static std::atomic<uint64_t> s_nRevisionCounter(0);
+	return ++s_nRevisionCounter;
+}
+
+void CDataTableQuery::applyCondition(const sDataTableColumnView& column, LibMCEnv::eDataTableFilterOperator filterOperator, double dValue, double dUpperValue, std::vector<uint8_t>& rowFlags, uint32_t nThreadCount)
+{
+	size_t nRowCount = rowFlags.size();
+	size_t nStoredRowCount = std::min(column.m_nRowCount, nRowCount);
+	uint8_t* pRowFlags = rowFlags.data();
+
+	dispatchColumn(column, [&](auto pValues) {
+		typedef typename std::remove_const<typename std::remove_pointer<decltype(pValues)>::type>::type T;
+
+		sConditionRange<T> range = makeConditionRange<T>(filterOperator, dValue, dUpperValue);
+		if (range.m_bEmpty) {
+			if (!range.m_bInvert)
+				std::fill(rowFlags.begin(), rowFlags.end(), (uint8_t)0);
+			return;
+		}
+
+		AMCCommon::CParallelBlocks::processBlocks(nThreadCount, nStoredRowCount, DATATABLE_MINROWSPERTHREAD, [&](uint32_t nBlockIndex, size_t nFirstItem, size_t nItemCount) {
+			applyConditionRange<T>(pValues, nFirstItem, nItemCount, range, pRowFlags);
+		});
+
+		// Rows that are not stored in the column have the value 0
+		if (nStoredRowCount < nRowCount) {
+			T zeroValue = (T)0;
+			bool bZeroInRange = (zeroValue >= range.m_Lower) && (zeroValue <= range.m_Upper);
+			uint8_t nZeroMatches = (bZeroInRange != range.m_bInvert) ? 1 : 0;
+			for (size_t nRowIndex = nStoredRowCount; nRowIndex < nRowCount; nRowIndex++)
+				pRowFlags[nRowIndex] &= nZeroMatches;
+		}
+	});
+}
+
+void CDataTableQuery::flagsToRowIndices(const std::vector<uint8_t>& rowFlags, std::vector<uint32_t>& rowIndices)
+{
+	size_t nMatchCount = 0;
+	for (uint8_t nFlag : rowFlags)
+		nMatchCount += nFlag;
+
+	// Writes every row index and only advances on matches, which avoids a branch per row
+	rowIndices.resize(nMatchCount + 1);
+	uint32_t* pRowIndices = rowIndices.data();
+	size_t nWritePosition = 0;
+	for (size_t nRowIndex = 0; nRowIndex < rowFlags.size(); nRowIndex++) {
+		pRowIndices[nWritePosition] = (uint32_t)nRowIndex;
+		nWritePosition += rowFlags[nRowIndex];
+	}
+
+	rowIndices.resize(nMatchCount);
+}
+
+void CDataTableQuery::gatherRows(const sDataTableColumnView& column, const std::vector<uint32_t>& rowIndices, void* pTarget, uint32_t nThreadCount)
+{
+	if (rowIndices.empty())
+		return;
+
+	if (pTarget == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COLUMNBUFFERISNULL);
+
+	const uint32_t* pRowIndices = rowIndices.data();
+	size_t nStoredRowCount = column.m_nRowCount;
+
+	dispatchColumn(column, [&](auto pValues) {
+		typedef typename std::remove_const<typename std::remove_pointer<decltype(pValues)>::type>::type T;
+		T* pTargetValues = (T*)pTarget;
+
+		AMCCommon::CParallelBlocks::processBlocks(nThreadCount, rowIndices.size(), DATATABLE_MINROWSPERTHREAD, [&](uint32_t nBlockIndex, size_t nFirstItem, size_t nItemCount) {
+			for (size_t nIndex = nFirstItem; nIndex < nFirstItem + nItemCount; nIndex++) {
+				uint32_t nRowIndex = pRowIndices[nIndex];
+				pTargetValues[nIndex] = (nRowIndex < nStoredRowCount) ? pValues[nRowIndex] : (T)0;
+			}
+		});
+	});
+}
+
+void CDataTableQuery::sortRows(const std::vector<sDataTableSortKey>& sortKeys, size_t nRowCount, std::vector<uint32_t>& rowIndices, uint32_t nThreadCount)
+{
+	rowIndices.resize(nRowCount);
+	std::iota(rowIndices.begin(), rowIndices.end(), (uint32_t)0);
+
+	// Stable sorts from the last to the first key order the rows by all keys
+	std::vector<uint64_t> keys;
+	for (size_t nKeyIndex = sortKeys.size(); nKeyIndex > 0; nKeyIndex--) {
+		auto& sortKey = sortKeys.at(nKeyIndex - 1);
+		computeOrderKeys(sortKey.m_Column, rowIndices, sortKey.m_bDescending, keys, nThreadCount);
+		radixSortPairs(keys, rowIndices, nThreadCount);
+	}
+}
+
+void CDataTableQuery::groupRows(const std::vector<sDataTableColumnView>& groupColumns, size_t nRowCount, std::vector<uint32_t>& sortedRowIndices, std::vector<size_t>& groupStarts, uint32_t nThreadCount)
+{
+	groupStarts.clear();
+
+	// Without group columns, all rows form one group, even if there are no rows
+	if (groupColumns.empty()) {
+		sortedRowIndices.resize(nRowCount);
+		std::iota(sortedRowIndices.begin(), sortedRowIndices.end(), (uint32_t)0);
+		groupStarts.push_back(0);
+		groupStarts.push_back(nRowCount);
+		return;
+	}
+
+	std::vector<sDataTableSortKey> sortKeys;
+	for (auto& groupColumn : groupColumns)
+		sortKeys.push_back({ groupColumn, false });
+
+	sortRows(sortKeys, nRowCount, sortedRowIndices, nThreadCount);
+
+	// A group starts where any of the keys differs from the previous row
+	std::vector<uint8_t> groupStartFlags(nRowCount, 0);
+	if (nRowCount > 0)
+		groupStartFlags[0] = 1;
+
+	std::vector<uint64_t> keys;
+	for (auto& groupColumn : groupColumns) {
+		computeOrderKeys(groupColumn, sortedRowIndices, false, keys, nThreadCount);
+		for (size_t nIndex = 1; nIndex < nRowCount; nIndex++)
+			groupStartFlags[nIndex] |= (uint8_t)(keys[nIndex] != keys[nIndex - 1]);
+	}
+
+	for (size_t nIndex = 0; nIndex < nRowCount; nIndex++) {
+		if (groupStartFlags[nIndex])
+			groupStarts.push_back(nIndex);
+	}
+	groupStarts.push_back(nRowCount);
+}
+
+void CDataTableQuery::aggregateGroups(const sDataTableColumnView& column, size_t nRowCount, LibMCEnv::eDataTableAggregation aggregation, const std::vector<uint32_t>& sortedRowIndices, const std::vector<size_t>& groupStarts, std::vector<double>& results, uint32_t nThreadCount)
+{
+	switch (aggregation) {
+	case LibMCEnv::eDataTableAggregation::Count:
+	case LibMCEnv::eDataTableAggregation::Sum:
+	case LibMCEnv::eDataTableAggregation::Minimum:
+	case LibMCEnv::eDataTableAggregation::Maximum:
+	case LibMCEnv::eDataTableAggregation::Mean:
+		break;
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLEAGGREGATION);
+	}
+
+	if (groupStarts.empty())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+	size_t nGroupCount = groupStarts.size() - 1;
+	results.resize(nGroupCount);
+	double* pResults = results.data();
+	const uint32_t* pRowIndices = sortedRowIndices.data();
+	size_t nStoredRowCount = std::min(column.m_nRowCount, nRowCount);
+
+	// Groups are distributed over the threads, every group is aggregated by one thread in row order
+	uint32_t nGroupThreadCount = (nRowCount < 2 * DATATABLE_MINROWSPERTHREAD) ? 1 : nThreadCount;
+
+	dispatchColumn(column, [&](auto pValues) {
+
+		AMCCommon::CParallelBlocks::processBlocks(nGroupThreadCount, nGroupCount, 1, [&](uint32_t nBlockIndex, size_t nFirstItem, size_t nItemCount) {
+			for (size_t nGroupIndex = nFirstItem; nGroupIndex < nFirstItem + nItemCount; nGroupIndex++) {
+				size_t nStart = groupStarts[nGroupIndex];
+				size_t nEnd = groupStarts[nGroupIndex + 1];
+
+				if (aggregation == LibMCEnv::eDataTableAggregation::Count) {
+					pResults[nGroupIndex] = (double)(nEnd - nStart);
+					continue;
+				}
+
+				if (nStart == nEnd) {
+					pResults[nGroupIndex] = (aggregation == LibMCEnv::eDataTableAggregation::Sum) ? 0.0 : std::numeric_limits<double>::quiet_NaN();
+					continue;
+				}
+
+				auto valueOf = [&](size_t nIndex) -> double {
+					uint32_t nRowIndex = pRowIndices[nIndex];
+					return (nRowIndex < nStoredRowCount) ? (double)pValues[nRowIndex] : 0.0;
+				};
+
+				double dResult;
+				switch (aggregation) {
+				case LibMCEnv::eDataTableAggregation::Minimum:
+				case LibMCEnv::eDataTableAggregation::Maximum: {
+					bool bMaximum = (aggregation == LibMCEnv::eDataTableAggregation::Maximum);
+					dResult = valueOf(nStart);
+					for (size_t nIndex = nStart; nIndex < nEnd; nIndex++) {
+						double dValue = valueOf(nIndex);
+						if (std::isnan(dValue)) {
+							dResult = dValue;
+							break;
+						}
+						dResult = bMaximum ? std::max(dResult, dValue) : std::min(dResult, dValue);
+					}
+					break;
+				}
+
+				default: {
+					double dSum = 0.0;
+					for (size_t nIndex = nStart; nIndex < nEnd; nIndex++)
+						dSum += valueOf(nIndex);
+
+					if (aggregation == LibMCEnv::eDataTableAggregation::Mean)
+						dResult = dSum / (double)(nEnd - nStart);
+					else
+						dResult = dSum;
+					break;
+				}
+				}
+
+				pResults[nGroupIndex] = dResult;
+			}
+		});
+	});
+}
+
+void CDataTableQuery::computeWindowStatistic(const sDataTableColumnView& column, size_t nRowCount, LibMCEnv::eDataTableWindowStatistic statistic, size_t nWindowSize, std::vector<double>& results, uint32_t nThreadCount)
+{
+	switch (statistic) {
+	case LibMCEnv::eDataTableWindowStatistic::Sum:
+	case LibMCEnv::eDataTableWindowStatistic::Mean:
+	case LibMCEnv::eDataTableWindowStatistic::Minimum:
+	case LibMCEnv::eDataTableWindowStatistic::Maximum:
+	case LibMCEnv::eDataTableWindowStatistic::StandardDeviation:
+		break;
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLEWINDOWSTATISTIC);
+	}
+
+	if (nWindowSize < 1)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLEWINDOWSIZE);
+
+	results.resize(nRowCount);
+	double* pResults = results.data();
+	size_t nStoredRowCount = std::min(column.m_nRowCount, nRowCount);
+
+	// The rows are processed in blocks, which bounds the memory of the partial aggregates. Blocks hold at least one
+	// window, so that the aggregates of the preceding chunks are not computed more than twice.
+	size_t nBlockSize = std::max((size_t)DATATABLE_WINDOWBLOCKSIZE, nWindowSize);
+	size_t nBlockCount = (nRowCount + nBlockSize - 1) / nBlockSize;
+
+	dispatchColumn(column, [&](auto pValues) {
+		auto valueOf = [pValues, nStoredRowCount](size_t nRowIndex) -> double {
+			return (nRowIndex < nStoredRowCount) ? (double)pValues[nRowIndex] : 0.0;
+		};
+
+		AMCCommon::CParallelBlocks::processBlocks(nThreadCount, nBlockCount, 1, [&](uint32_t nBlockIndex, size_t nFirstItem, size_t nItemCount) {
+			for (size_t nWindowBlock = nFirstItem; nWindowBlock < nFirstItem + nItemCount; nWindowBlock++) {
+				size_t nFirstRow = nWindowBlock * nBlockSize;
+				size_t nEndRow = std::min(nRowCount, nFirstRow + nBlockSize);
+
+				switch (statistic) {
+				case LibMCEnv::eDataTableWindowStatistic::Sum:
+					computeWindowAggregates<sWindowSumPolicy>(valueOf, nFirstRow, nEndRow, nWindowSize, pResults);
+					break;
+				case LibMCEnv::eDataTableWindowStatistic::Mean:
+					computeWindowAggregates<sWindowMeanPolicy>(valueOf, nFirstRow, nEndRow, nWindowSize, pResults);
+					break;
+				case LibMCEnv::eDataTableWindowStatistic::Minimum:
+					computeWindowAggregates<sWindowMinimumPolicy>(valueOf, nFirstRow, nEndRow, nWindowSize, pResults);
+					break;
+				case LibMCEnv::eDataTableWindowStatistic::Maximum:
+					computeWindowAggregates<sWindowMaximumPolicy>(valueOf, nFirstRow, nEndRow, nWindowSize, pResults);
+					break;
+				default:
+					computeWindowAggregates<sWindowStandardDeviationPolicy>(valueOf, nFirstRow, nEndRow, nWindowSize, pResults);
+					break;
+				}
+			}
+		});
+	});
+}
+
@@ -0,0 +1,98 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: Filter, sort, group and window kernels on data table columns
+
+*/
+
+
+#ifndef __LIBMCENV_DATATABLEQUERY
+#define __LIBMCENV_DATATABLEQUERY
+
+#include "libmcenv_types.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace LibMCEnv {
+namespace Impl {
+
+	// Read only view of the values of a data table column. Rows from m_nRowCount up to the row count
+	// of the table are not stored and read as 0, like in the column getters of the data table.
+	struct sDataTableColumnView {
+		LibMCEnv::eDataTableColumnType m_ColumnType;
+		const void* m_pData;
+		size_t m_nRowCount;
+	};
+
+	struct sDataTableSortKey {
+		sDataTableColumnView m_Column;
+		bool m_bDescending;
+	};
+
+	// Query kernels on data table columns. They work on the column vectors directly and split large tables
+	// into blocks of rows that are processed on up to nThreadCount threads. The block layout never changes
+	// the result, so all results are identical for every thread count.
+	class CDataTableQuery {
+	public:
+
+		// Returns a new, globally unique revision number. Used to tag table and option states.
+		static uint64_t newRevision();
+
+		// Clears the flag of every row that does not fulfil the condition. Has one flag per table row.
+		// Integer columns are compared exactly, thresholds are rounded to the matching integer range.
+		static void applyCondition(const sDataTableColumnView& column, LibMCEnv::eDataTableFilterOperator filterOperator, double dValue, double dUpperValue, std::vector<uint8_t>& rowFlags, uint32_t nThreadCount);
+
+		static void flagsToRowIndices(const std::vector<uint8_t>& rowFlags, std::vector<uint32_t>& rowIndices);
+
+		// Writes the values of the given rows to pTarget, which holds rowIndices.size () values of the column type.
+		// Row indices MUST be smaller than the row count of the table.
+		static void gatherRows(const sDataTableColumnView& column, const std::vector<uint32_t>& rowIndices, void* pTarget, uint32_t nThreadCount);
+
+		// Returns the row order of a stable sort. NaN values are sorted to the end for both directions, negative
+		// and positive zero are equal.
+		static void sortRows(const std::vector<sDataTableSortKey>& sortKeys, size_t nRowCount, std::vector<uint32_t>& rowIndices, uint32_t nThreadCount);
+
+		// Sorts the rows ascending by the group columns. Returns the sorted row order and the start of every group
+		// within it, followed by the row count as terminating entry.
+		static void groupRows(const std::vector<sDataTableColumnView>& groupColumns, size_t nRowCount, std::vector<uint32_t>& sortedRowIndices, std::vector<size_t>& groupStarts, uint32_t nThreadCount);
+
+		// Computes one value per group, summing in row order within each group.
+		static void aggregateGroups(const sDataTableColumnView& column, size_t nRowCount, LibMCEnv::eDataTableAggregation aggregation, const std::vector<uint32_t>& sortedRowIndices, const std::vector<size_t>& groupStarts, std::vector<double>& results, uint32_t nThreadCount);
+
+		// Computes a statistic over the trailing nWindowSize rows of every row.
+		static void computeWindowStatistic(const sDataTableColumnView& column, size_t nRowCount, LibMCEnv::eDataTableWindowStatistic statistic, size_t nWindowSize, std::vector<double>& results, uint32_t nThreadCount);
+
+	};
+
+} // namespace Impl
+} // namespace LibMCEnv
+
+#endif // __LIBMCENV_DATATABLEQUERY
@@ -0,0 +1,110 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract: This is a stub class definition of CDataTableSortOptions
+
+*/
+
+#include "libmcenv_datatablesortoptions.hpp"
+#include "libmcenv_interfaceexception.hpp"
+#include "libmcenv_datatablequery.hpp"
+
+// Include custom headers here.
+#include "common_utils.hpp"
+
+using namespace LibMCEnv::Impl;
+
+/*************************************************************************************************************************
+ Class definition of CDataTableSortOptions 
+**************************************************************************************************************************/
+
+CDataTableSortOptions::CDataTableSortOptions()
+	: m_nRevision (CDataTableQuery::newRevision ())
+{
+
+}
+
+CDataTableSortOptions::~CDataTableSortOptions()
+{
+
+}
+
+sDataTableSortColumn& CDataTableSortOptions::getSortColumn(const LibMCEnv_uint32 nIndex)
+{
+	if (nIndex >= m_SortColumns.size())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLEQUERYINDEX, "invalid sort column index: " + std::to_string(nIndex));
+
+	return m_SortColumns.at(nIndex);
+}
+
+void CDataTableSortOptions::AddSortColumn(const std::string & sColumnIdentifier, const bool bDescending)
+{
+	if (sColumnIdentifier.empty())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COLUMNIDENTIFIEREMPTY);
+
+	if (!AMCCommon::CUtils::stringIsValidAlphanumericNameString(sColumnIdentifier))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDCOLUMNIDENTIFIER, "invalid column identifier: " + sColumnIdentifier);
+
+	sDataTableSortColumn sortColumn;
+	sortColumn.m_sColumnIdentifier = sColumnIdentifier;
+	sortColumn.m_bDescending = bDescending;
+	m_SortColumns.push_back(sortColumn);
+
+	m_nRevision = CDataTableQuery::newRevision();
+}
+
+LibMCEnv_uint32 CDataTableSortOptions::GetSortColumnCount()
+{
+	return (uint32_t)m_SortColumns.size();
+}
+
+std::string CDataTableSortOptions::GetSortColumn(const LibMCEnv_uint32 nIndex)
+{
+	return getSortColumn(nIndex).m_sColumnIdentifier;
+}
+
+bool CDataTableSortOptions::GetSortColumnDescending(const LibMCEnv_uint32 nIndex)
+{
+	return getSortColumn(nIndex).m_bDescending;
+}
+
+void CDataTableSortOptions::Clear()
+{
+	m_SortColumns.clear();
+	m_nRevision = CDataTableQuery::newRevision();
+}
+
+const std::vector<sDataTableSortColumn>& CDataTableSortOptions::getSortColumns()
+{
+	return m_SortColumns;
+}
+
+uint64_t CDataTableSortOptions::getRevision()
+{
+	return m_nRevision;
+}
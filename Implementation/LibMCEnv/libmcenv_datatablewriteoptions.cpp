@@ -35,6 +35,7 @@ Abstract: This is a stub class definition of CDataTableWriteOptions
 #include "libmcenv_interfaceexception.hpp"
 
 // Include custom headers here.
+#include "amc_constants.hpp"
 
 
 using namespace LibMCEnv::Impl;
@@ -45,7 +46,7 @@ using namespace LibMCEnv::Impl;
 
 CDataTableWriteOptions::CDataTableWriteOptions()
 {
-
+    ResetToDefaults();
 }
 
 CDataTableWriteOptions::~CDataTableWriteOptions()
@@ -53,3 +54,91 @@ CDataTableWriteOptions::~CDataTableWriteOptions()
 
 }
 
+void CDataTableWriteOptions::checkEncoding(const LibMCEnv::eDataTableColumnEncoding eEncoding)
+{
+    switch (eEncoding) {
+        case LibMCEnv::eDataTableColumnEncoding::Raw:
+        case LibMCEnv::eDataTableColumnEncoding::Delta:
+        case LibMCEnv::eDataTableColumnEncoding::DeltaOfDelta:
+        case LibMCEnv::eDataTableColumnEncoding::RunLength:
+        case LibMCEnv::eDataTableColumnEncoding::XOR:
+        case LibMCEnv::eDataTableColumnEncoding::Automatic:
+            break;
+        default:
+            throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOLUMNENCODING, "invalid data table column encoding: " + std::to_string((int32_t)eEncoding));
+    }
+}
+
+void CDataTableWriteOptions::ResetToDefaults()
+{
+    m_DefaultEncoding = LibMCEnv::eDataTableColumnEncoding::Raw;
+    m_ColumnEncodings.clear();
+    m_Compression = LibMCEnv::eDataTableCompression::NoCompression;
+    m_nCompressionLevel = DATATABLE_DEFAULTCOMPRESSIONLEVEL;
+}
+
+LibMCEnv::eDataTableColumnEncoding CDataTableWriteOptions::GetDefaultEncoding()
+{
+    return m_DefaultEncoding;
+}
+
+void CDataTableWriteOptions::SetDefaultEncoding(const LibMCEnv::eDataTableColumnEncoding eEncoding)
+{
+    checkEncoding(eEncoding);
+    m_DefaultEncoding = eEncoding;
+}
+
+LibMCEnv::eDataTableColumnEncoding CDataTableWriteOptions::GetColumnEncoding(const std::string & sIdentifier)
+{
+    auto iIter = m_ColumnEncodings.find(sIdentifier);
+    if (iIter != m_ColumnEncodings.end())
+        return iIter->second;
+
+    return m_DefaultEncoding;
+}
+
+void CDataTableWriteOptions::SetColumnEncoding(const std::string & sIdentifier, const LibMCEnv::eDataTableColumnEncoding eEncoding)
+{
+    if (sIdentifier.empty())
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_EMPTYDATATABLEIDENTIFIER);
+
+    checkEncoding(eEncoding);
+    m_ColumnEncodings[sIdentifier] = eEncoding;
+}
+
+void CDataTableWriteOptions::ClearColumnEncodings()
+{
+    m_ColumnEncodings.clear();
+}
+
+LibMCEnv::eDataTableCompression CDataTableWriteOptions::GetCompression()
+{
+    return m_Compression;
+}
+
+void CDataTableWriteOptions::SetCompression(const LibMCEnv::eDataTableCompression eCompression)
+{
+    switch (eCompression) {
+        case LibMCEnv::eDataTableCompression::NoCompression:
+        case LibMCEnv::eDataTableCompression::ZLib:
+        case LibMCEnv::eDataTableCompression::LZ4:
+            m_Compression = eCompression;
+            break;
+        default:
+            throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOMPRESSION, "invalid data table compression: " + std::to_string((int32_t)eCompression));
+    }
+}
+
+LibMCEnv_uint32 CDataTableWriteOptions::GetCompressionLevel()
+{
+    return m_nCompressionLevel;
+}
+
+void CDataTableWriteOptions::SetCompressionLevel(const LibMCEnv_uint32 nCompressionLevel)
+{
+    if (nCompressionLevel > DATATABLE_MAXCOMPRESSIONLEVEL)
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDDATATABLECOMPRESSIONLEVEL, "invalid data table compression level: " + std::to_string(nCompressionLevel));
+
+    m_nCompressionLevel = nCompressionLevel;
+}
+
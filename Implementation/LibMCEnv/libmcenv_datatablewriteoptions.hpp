@@ -45,6 +45,8 @@ Abstract: This is the class declaration of CDataTableWriteOptions
 #endif
 
 // Include custom headers here.
+#include <map>
+#include <string>
 
 
 namespace LibMCEnv {
@@ -58,7 +60,13 @@ namespace Impl {
 class CDataTableWriteOptions : public virtual IDataTableWriteOptions, public virtual CBase {
 private:
 
+    LibMCEnv::eDataTableColumnEncoding m_DefaultEncoding;
+    std::map<std::string, LibMCEnv::eDataTableColumnEncoding> m_ColumnEncodings;
 
+    LibMCEnv::eDataTableCompression m_Compression;
+    uint32_t m_nCompressionLevel;
+
+    static void checkEncoding(const LibMCEnv::eDataTableColumnEncoding eEncoding);
 
 public:
 
@@ -66,6 +74,26 @@ public:
 
     virtual ~CDataTableWriteOptions();
 
+	void ResetToDefaults() override;
+
+	LibMCEnv::eDataTableColumnEncoding GetDefaultEncoding() override;
+
+	void SetDefaultEncoding(const LibMCEnv::eDataTableColumnEncoding eEncoding) override;
+
+	LibMCEnv::eDataTableColumnEncoding GetColumnEncoding(const std::string & sIdentifier) override;
+
+	void SetColumnEncoding(const std::string & sIdentifier, const LibMCEnv::eDataTableColumnEncoding eEncoding) override;
+
+	void ClearColumnEncodings() override;
+
+	LibMCEnv::eDataTableCompression GetCompression() override;
+
+	void SetCompression(const LibMCEnv::eDataTableCompression eCompression) override;
+
+	LibMCEnv_uint32 GetCompressionLevel() override;
+
+	void SetCompressionLevel(const LibMCEnv_uint32 nCompressionLevel) override;
+
 };
 
 } // namespace Impl
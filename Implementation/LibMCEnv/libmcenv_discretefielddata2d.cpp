@@ -205,3 +205,52 @@ IDiscreteFieldData2D * CDiscreteFieldData2D::Duplicate()
 	return new CDiscreteFieldData2D(pNewField);
 }
 
+LibMCEnv::eFieldStoragePrecision CDiscreteFieldData2D::GetStoragePrecision()
+{
+	return m_pDiscreteFieldDataInstance->GetStoragePrecision();
+}
+
+void CDiscreteFieldData2D::SetStoragePrecision(const LibMCEnv::eFieldStoragePrecision eStoragePrecision)
+{
+	m_pDiscreteFieldDataInstance->SetStoragePrecision(eStoragePrecision);
+}
+
+LibMCEnv::eFieldStorageLayout CDiscreteFieldData2D::GetStorageLayout()
+{
+	return m_pDiscreteFieldDataInstance->GetStorageLayout();
+}
+
+void CDiscreteFieldData2D::SetStorageLayout(const LibMCEnv::eFieldStorageLayout eStorageLayout)
+{
+	m_pDiscreteFieldDataInstance->SetStorageLayout(eStorageLayout);
+}
+
+LibMCEnv_uint64 CDiscreteFieldData2D::GetStorageSize()
+{
+	return m_pDiscreteFieldDataInstance->GetStorageSize();
+}
+
+void CDiscreteFieldData2D::Compact()
+{
+	m_pDiscreteFieldDataInstance->Compact();
+}
+
+LibMCEnv_uint32 CDiscreteFieldData2D::GetThreadCount()
+{
+	return m_pDiscreteFieldDataInstance->GetThreadCount();
+}
+
+void CDiscreteFieldData2D::SetThreadCount(const LibMCEnv_uint32 nThreadCount)
+{
+	m_pDiscreteFieldDataInstance->SetThreadCount(nThreadCount);
+}
+
+void CDiscreteFieldData2D::SetSIMDKernelsEnabled(const bool bEnabled)
+{
+	m_pDiscreteFieldDataInstance->SetSIMDKernelsEnabled(bEnabled);
+}
+
+std::string CDiscreteFieldData2D::GetSIMDKernelName()
+{
+	return m_pDiscreteFieldDataInstance->GetSIMDKernelName();
+}
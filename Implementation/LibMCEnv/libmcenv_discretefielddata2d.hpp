@@ -112,6 +112,26 @@ public:
 
 	IDiscreteFieldData2D * Duplicate() override;
 
+	LibMCEnv::eFieldStoragePrecision GetStoragePrecision() override;
+
+	void SetStoragePrecision(const LibMCEnv::eFieldStoragePrecision eStoragePrecision) override;
+
+	LibMCEnv::eFieldStorageLayout GetStorageLayout() override;
+
+	void SetStorageLayout(const LibMCEnv::eFieldStorageLayout eStorageLayout) override;
+
+	LibMCEnv_uint64 GetStorageSize() override;
+
+	void Compact() override;
+
+	LibMCEnv_uint32 GetThreadCount() override;
+
+	void SetThreadCount(const LibMCEnv_uint32 nThreadCount) override;
+
+	void SetSIMDKernelsEnabled(const bool bEnabled) override;
+
+	std::string GetSIMDKernelName() override;
+
 };
 
 } // namespace Impl
@@ -37,11 +37,14 @@ Abstract: This is a stub class definition of CImageData
 #include "libmcenv_jpegimagedata.hpp"
 #include "libmcenv_pngimagestoreoptions.hpp"
 #include "libmcenv_jpegimagestoreoptions.hpp"
+#include "libmcenv_imagekernels.hpp"
+#include "libmcenv_pngencoder.hpp"
 
 // Include custom headers here.
 #include "Libraries/LodePNG/lodepng.h"
 
 #include <cmath>
+#include <cstring>
 #include <turbojpeg.h>
 
 using namespace LibMCEnv::Impl;
@@ -109,7 +112,7 @@ CImageData* CImageData::createFromPNG(const uint8_t* pBuffer, uint64_t nBufferSi
 			pSource += 4; // Skip Alpha
 		}
 
-		return new CImageData(convertedPixelBuffer.release(), width, height, dDPIValueX, dDPIValueY, eImagePixelFormat::RGB24bit, false);
+		return new CImageData(convertedPixelBuffer.release(), width, height, dDPIValueX, dDPIValueY, eImagePixelFormat::RGB16bit, false);
 	}
 
 	case eImagePixelFormat::GreyScale8bit:
@@ -345,6 +348,14 @@ CImageData::CImageData(std::vector<uint8_t>* pPixelData, const uint32_t nPixelCo
 				Clear(0x00ffffffUL);
 			break;
 
+		case eImagePixelFormat::RGB16bit:
+			if (m_PixelData->size() != (size_t)nPixelCountX * (size_t)nPixelCountY * 2)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELMEMORYSIZE);
+
+			if (bDoClear)
+				Clear(0x00ffffffUL);
+			break;
+
 		default: 
 			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
 
@@ -413,209 +424,289 @@ IPNGImageStoreOptions* CImageData::CreatePNGOptions()
 	return new CPNGImageStoreOptions();
 }
 
-uint32_t CImageData::encodeBlackWhitePalettePNG(std::vector<uint8_t>& pngBuffer, std::vector<uint8_t>& imageBuffer, uint32_t imageSizeX, uint32_t imageSizeY)
+// The 2 and 4 bit write functions pack pixels LSB first, PNG expects the leftmost pixel in the most significant bits.
+static void reversePackedPixelOrder(uint8_t* pData, size_t nSize, uint32_t nBitsPerPixel)
 {
+	uint8_t reversedBytes[256];
+	uint32_t nPixelMask = (1u << nBitsPerPixel) - 1;
+	for (uint32_t nByte = 0; nByte < 256; nByte++) {
+		uint32_t nReversed = 0;
+		for (uint32_t nShift = 0; nShift < 8; nShift += nBitsPerPixel)
+			nReversed |= ((nByte >> nShift) & nPixelMask) << (8 - nBitsPerPixel - nShift);
+		reversedBytes[nByte] = (uint8_t)nReversed;
+	}
 
-	lodepng::State state;
-
-	// Configure the color type to palette and set bit depth to 1
-	state.info_png.color.colortype = LCT_PALETTE;
-	state.info_png.color.bitdepth = 1;
-	state.info_raw.colortype = LCT_PALETTE;
-	state.info_raw.bitdepth = 1;
-
-	// Define the palette (black and white)
-	lodepng_palette_add(&state.info_png.color, 0, 0, 0, 255); // Black
-	lodepng_palette_add(&state.info_png.color, 255, 255, 255, 255); // White
-
-	// Ensure raw info also has the palette
-	lodepng_palette_add(&state.info_raw, 0, 0, 0, 255); // Black
-	lodepng_palette_add(&state.info_raw, 255, 255, 255, 255); // White
-
-	state.encoder.auto_convert = false;
-
-	// Encode the image
-	return lodepng::encode(pngBuffer, imageBuffer, imageSizeX, imageSizeY, state);
+	for (size_t nIndex = 0; nIndex < nSize; nIndex++)
+		pData[nIndex] = reversedBytes[pData[nIndex]];
 }
 
-
-IPNGImageData* CImageData::CreatePNGImage(IPNGImageStoreOptions* pPNGStorageOptions)
+void CImageData::encodePNGWithLodePNG(std::vector<uint8_t>& pngBuffer, LibMCEnv::ePNGStorageFormat pngStorageFormat, uint32_t nCompressionLevel, LibMCEnv::ePNGFilterStrategy filterStrategy)
 {
-	unsigned int errorCode = 0;
-
-	if (m_PixelData.get() == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
-	if ((m_nPixelCountX == 0) || (m_nPixelCountY == 0))
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
-
-	// Retrieve optional storage format
-	LibMCEnv::ePNGStorageFormat pngStorageFormat = LibMCEnv::ePNGStorageFormat::RGB24bit;
-	if (pPNGStorageOptions != nullptr)
-		pngStorageFormat = pPNGStorageOptions->GetStorageFormat();
-
-
-	std::vector<uint8_t> convertedPixelData;
 	uint64_t nTotalPixelCount = (uint64_t)m_nPixelCountX * (uint64_t)m_nPixelCountY;
 
-	std::unique_ptr<CPNGImageData> pResult (new CPNGImageData (m_nPixelCountX, m_nPixelCountY));
-
-	switch (m_PixelFormat) {
-	case eImagePixelFormat::GreyScale8bit:
+	std::vector<uint8_t> convertedPixelData;
+	const std::vector<uint8_t>* pRawPixelData = &convertedPixelData;
 
-		switch (pngStorageFormat) {
-			case LibMCEnv::ePNGStorageFormat::BlackWhite1bit: {
-				convertedPixelData.resize(nTotalPixelCount);
-				writeToRawMemoryEx_BlackWhite1bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
-				errorCode = encodeBlackWhitePalettePNG(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY);
+	// LodePNG may pick a smaller color type for the PNG if it can store the image losslessly
+	lodepng::State state;
 
-				break;
-			}
+	if (nCompressionLevel == 0) {
+		state.encoder.zlibsettings.btype = 0;
+	}
+	else if (nCompressionLevel < 4) {
+		state.encoder.zlibsettings.lazymatching = 0;
+	}
+	else if (nCompressionLevel > 6) {
+		state.encoder.zlibsettings.windowsize = 32768;
+		state.encoder.zlibsettings.nicematch = 258;
+	}
 
-			case LibMCEnv::ePNGStorageFormat::GreyScale1bit:
-				convertedPixelData.resize(nTotalPixelCount);
-				writeToRawMemoryEx_BlackWhite1bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
-				errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY, LCT_GREY, 1);
-				break;
-
-			case LibMCEnv::ePNGStorageFormat::GreyScale2bit:
-				convertedPixelData.resize(nTotalPixelCount);
-				writeToRawMemoryEx_GreyScale2bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
-				errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY, LCT_GREY, 2);
-				break;
-
-			case LibMCEnv::ePNGStorageFormat::GreyScale4bit:
-				convertedPixelData.resize(nTotalPixelCount);
-				writeToRawMemoryEx_GreyScale4bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
-				errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY, LCT_GREY, 4);
-				break;
-
-			case LibMCEnv::ePNGStorageFormat::GreyScale8bit:
-				errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), *m_PixelData, m_nPixelCountX, m_nPixelCountY, LCT_GREY, 8);
-				break;
-
-			case LibMCEnv::ePNGStorageFormat::RGB24bit:
-				convertedPixelData.resize(nTotalPixelCount * 3);
-				writeToRawMemoryEx_RGBA32bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX * 3);
-				errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY, LCT_RGB, 8);
-				break;
-
-			case LibMCEnv::ePNGStorageFormat::RGBA32bit:
-				convertedPixelData.resize(nTotalPixelCount * 4);
-				writeToRawMemoryEx_RGBA32bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX * 4);
-				errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY, LCT_RGBA, 8);
-				break;
-
-			default:
-				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPNGEXPORTFORMAT);
+	switch (filterStrategy) {
+	case LibMCEnv::ePNGFilterStrategy::NoFilter: state.encoder.filter_strategy = LFS_ZERO; break;
+	case LibMCEnv::ePNGFilterStrategy::Sub: state.encoder.filter_strategy = LFS_ONE; break;
+	case LibMCEnv::ePNGFilterStrategy::Up: state.encoder.filter_strategy = LFS_TWO; break;
+	case LibMCEnv::ePNGFilterStrategy::Adaptive: state.encoder.filter_strategy = LFS_MINSUM; break;
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPNGFILTERSTRATEGY);
+	}
+	// Only the adaptive strategy leaves palette and sub-byte images unfiltered
+	state.encoder.filter_palette_zero = (filterStrategy == LibMCEnv::ePNGFilterStrategy::Adaptive);
+
+	switch (pngStorageFormat) {
+	case LibMCEnv::ePNGStorageFormat::BlackWhite1bit:
+		// Palette with black and white entries, in the PNG and in the raw data
+		state.info_png.color.colortype = LCT_PALETTE;
+		state.info_png.color.bitdepth = 1;
+		state.info_raw.colortype = LCT_PALETTE;
+		state.info_raw.bitdepth = 1;
+		lodepng_palette_add(&state.info_png.color, 0, 0, 0, 255);
+		lodepng_palette_add(&state.info_png.color, 255, 255, 255, 255);
+		lodepng_palette_add(&state.info_raw, 0, 0, 0, 255);
+		lodepng_palette_add(&state.info_raw, 255, 255, 255, 255);
+		state.encoder.auto_convert = false;
+
+		// LodePNG expects sub-byte raw data without padding at the end of the scanlines
+		convertedPixelData.resize((nTotalPixelCount + 7) / 8);
+		writeToRawMemoryEx_BlackWhite1bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
+		break;
 
-		}
+	case LibMCEnv::ePNGStorageFormat::GreyScale1bit:
+		state.info_png.color.colortype = LCT_GREY;
+		state.info_png.color.bitdepth = 1;
+		state.info_raw.colortype = LCT_GREY;
+		state.info_raw.bitdepth = 1;
 
+		convertedPixelData.resize((nTotalPixelCount + 7) / 8);
+		writeToRawMemoryEx_BlackWhite1bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
 		break;
-	case eImagePixelFormat::RGB24bit:
 
-		switch (pngStorageFormat) {
-		case LibMCEnv::ePNGStorageFormat::BlackWhite1bit:
+	case LibMCEnv::ePNGStorageFormat::GreyScale2bit:
+	case LibMCEnv::ePNGStorageFormat::GreyScale4bit:
+		// LodePNG keeps the most significant bits of 8 bit grey values, which is the same quantisation as in writeToRawMemoryEx_GreyScale2bit/4bit.
+		state.info_png.color.colortype = LCT_GREY;
+		state.info_png.color.bitdepth = (pngStorageFormat == LibMCEnv::ePNGStorageFormat::GreyScale2bit) ? 2 : 4;
+		state.info_raw.colortype = LCT_GREY;
+		state.info_raw.bitdepth = 8;
+		state.encoder.auto_convert = false;
+
+		if (m_PixelFormat == eImagePixelFormat::GreyScale8bit) {
+			pRawPixelData = m_PixelData.get();
+		}
+		else {
 			convertedPixelData.resize(nTotalPixelCount);
-			writeToRawMemoryEx_BlackWhite1bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
-			errorCode = encodeBlackWhitePalettePNG(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY);
-			break;
+			writeToRawMemoryEx_GreyScale8bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
+		}
+		break;
 
-		case LibMCEnv::ePNGStorageFormat::GreyScale1bit:
-			convertedPixelData.resize(nTotalPixelCount);
-			writeToRawMemoryEx_BlackWhite1bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
-			errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY, LCT_GREY, 1);
-			break;
+	case LibMCEnv::ePNGStorageFormat::GreyScale8bit:
+		state.info_png.color.colortype = LCT_GREY;
+		state.info_png.color.bitdepth = 8;
+		state.info_raw.colortype = LCT_GREY;
+		state.info_raw.bitdepth = 8;
 
-		case LibMCEnv::ePNGStorageFormat::GreyScale2bit:
+		if (m_PixelFormat == eImagePixelFormat::GreyScale8bit) {
+			pRawPixelData = m_PixelData.get();
+		}
+		else {
 			convertedPixelData.resize(nTotalPixelCount);
-			writeToRawMemoryEx_GreyScale2bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
-			errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY, LCT_GREY, 2);
-			break;
+			writeToRawMemoryEx_GreyScale8bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
+		}
+		break;
 
-		case LibMCEnv::ePNGStorageFormat::GreyScale4bit:
-			convertedPixelData.resize(nTotalPixelCount);
-			writeToRawMemoryEx_GreyScale4bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
-			errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY, LCT_GREY, 4);
-			break;
+	case LibMCEnv::ePNGStorageFormat::RGB24bit:
+		state.info_png.color.colortype = LCT_RGB;
+		state.info_png.color.bitdepth = 8;
+		state.info_raw.colortype = LCT_RGB;
+		state.info_raw.bitdepth = 8;
 
-		case LibMCEnv::ePNGStorageFormat::GreyScale8bit:	
-			convertedPixelData.resize(nTotalPixelCount);
-			writeToRawMemoryEx_GreyScale8bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
-			errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY, LCT_GREY, 8);
-			break;
+		if (m_PixelFormat == eImagePixelFormat::RGB24bit) {
+			pRawPixelData = m_PixelData.get();
+		}
+		else {
+			convertedPixelData.resize(nTotalPixelCount * 3);
+			writeToRawMemoryEx_RGB24bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX * 3);
+		}
+		break;
 
-		case LibMCEnv::ePNGStorageFormat::RGB24bit:
-			errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), *m_PixelData, m_nPixelCountX, m_nPixelCountY, LCT_RGB, 8);
-			break;
+	case LibMCEnv::ePNGStorageFormat::RGBA32bit:
+		state.info_png.color.colortype = LCT_RGBA;
+		state.info_png.color.bitdepth = 8;
+		state.info_raw.colortype = LCT_RGBA;
+		state.info_raw.bitdepth = 8;
 
-		case LibMCEnv::ePNGStorageFormat::RGBA32bit:
+		if (m_PixelFormat == eImagePixelFormat::RGBA32bit) {
+			pRawPixelData = m_PixelData.get();
+		}
+		else {
 			convertedPixelData.resize(nTotalPixelCount * 4);
 			writeToRawMemoryEx_RGBA32bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX * 4);
-			errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY, LCT_RGBA, 8);
-			break;
+		}
+		break;
 
-		default:
-			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPNGEXPORTFORMAT);
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPNGEXPORTFORMAT);
+	}
 
-		}		
-		break;
+	unsigned int errorCode = lodepng::encode(pngBuffer, *pRawPixelData, m_nPixelCountX, m_nPixelCountY, state);
+	if (errorCode) {
+		std::string sErrorMessage(lodepng_error_text(errorCode));
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COULDNOTCOMPRESSPNGIMAGE, sErrorMessage);
+	}
+}
 
-	case eImagePixelFormat::RGBA32bit:
-		switch (pngStorageFormat) {
-		case LibMCEnv::ePNGStorageFormat::BlackWhite1bit:
-			convertedPixelData.resize(nTotalPixelCount);
-			writeToRawMemoryEx_BlackWhite1bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
-			errorCode = encodeBlackWhitePalettePNG(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY);
-			break;
+void CImageData::encodePNGWithZLib(std::vector<uint8_t>& pngBuffer, LibMCEnv::ePNGStorageFormat pngStorageFormat, uint32_t nCompressionLevel, LibMCEnv::ePNGFilterStrategy filterStrategy, uint32_t nThreadCount)
+{
+	ePNGColorType colorType;
+	uint32_t nBitDepth;
+	switch (pngStorageFormat) {
+	case LibMCEnv::ePNGStorageFormat::BlackWhite1bit: colorType = ePNGColorType::pctPalette; nBitDepth = 1; break;
+	case LibMCEnv::ePNGStorageFormat::GreyScale1bit: colorType = ePNGColorType::pctGreyScale; nBitDepth = 1; break;
+	case LibMCEnv::ePNGStorageFormat::GreyScale2bit: colorType = ePNGColorType::pctGreyScale; nBitDepth = 2; break;
+	case LibMCEnv::ePNGStorageFormat::GreyScale4bit: colorType = ePNGColorType::pctGreyScale; nBitDepth = 4; break;
+	case LibMCEnv::ePNGStorageFormat::GreyScale8bit: colorType = ePNGColorType::pctGreyScale; nBitDepth = 8; break;
+	case LibMCEnv::ePNGStorageFormat::RGB24bit: colorType = ePNGColorType::pctRGB; nBitDepth = 8; break;
+	case LibMCEnv::ePNGStorageFormat::RGBA32bit: colorType = ePNGColorType::pctRGBA; nBitDepth = 8; break;
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPNGEXPORTFORMAT);
+	}
 
-		case LibMCEnv::ePNGStorageFormat::GreyScale1bit:
-			convertedPixelData.resize(nTotalPixelCount);
-			writeToRawMemoryEx_BlackWhite1bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
-			errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY, LCT_GREY, 1);
-			break;
+	CPNGEncoder encoder(m_nPixelCountX, m_nPixelCountY, colorType, nBitDepth);
+	encoder.setCompressionLevel(nCompressionLevel);
+	encoder.setFilterStrategy(filterStrategy);
+	encoder.setThreadCount(nThreadCount);
+	if (colorType == ePNGColorType::pctPalette) {
+		encoder.addPaletteEntry(0, 0, 0);
+		encoder.addPaletteEntry(255, 255, 255);
+	}
 
-		case LibMCEnv::ePNGStorageFormat::GreyScale2bit:
-			convertedPixelData.resize(nTotalPixelCount);
-			writeToRawMemoryEx_GreyScale2bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
-			errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY, LCT_GREY, 2);
-			break;
+	// The encoder needs byte aligned scanlines. Images that are already in the target format are passed without copy.
+	size_t nScanlineSize = encoder.getScanlineSize();
+	std::vector<uint8_t> scanlineData;
+	const uint8_t* pScanlines = nullptr;
 
-		case LibMCEnv::ePNGStorageFormat::GreyScale4bit:
-			convertedPixelData.resize(nTotalPixelCount);
-			writeToRawMemoryEx_GreyScale4bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
-			errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY, LCT_GREY, 4);
-			break;
+	switch (pngStorageFormat) {
+	case LibMCEnv::ePNGStorageFormat::BlackWhite1bit:
+	case LibMCEnv::ePNGStorageFormat::GreyScale1bit:
+		scanlineData.resize(nScanlineSize * m_nPixelCountY);
+		writeToRawMemoryEx_BlackWhite1bit(0, 0, m_nPixelCountX, m_nPixelCountY, scanlineData.data(), (uint32_t)(nScanlineSize * 8));
+		break;
 
-		case LibMCEnv::ePNGStorageFormat::GreyScale8bit:
-			convertedPixelData.resize(nTotalPixelCount);
-			writeToRawMemoryEx_GreyScale8bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX);
-			errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY, LCT_GREY, 8);
-			break;
+	case LibMCEnv::ePNGStorageFormat::GreyScale2bit:
+		scanlineData.resize(nScanlineSize * m_nPixelCountY);
+		writeToRawMemoryEx_GreyScale2bit(0, 0, m_nPixelCountX, m_nPixelCountY, scanlineData.data(), (uint32_t)nScanlineSize);
+		reversePackedPixelOrder(scanlineData.data(), scanlineData.size(), 2);
+		break;
 
-		case LibMCEnv::ePNGStorageFormat::RGB24bit:
-			convertedPixelData.resize(nTotalPixelCount * 3);
-			writeToRawMemoryEx_RGB24bit(0, 0, m_nPixelCountX, m_nPixelCountY, convertedPixelData.data(), m_nPixelCountX * 3);
-			errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), convertedPixelData, m_nPixelCountX, m_nPixelCountY, LCT_RGB, 8);
-			break;
+	case LibMCEnv::ePNGStorageFormat::GreyScale4bit:
+		scanlineData.resize(nScanlineSize * m_nPixelCountY);
+		writeToRawMemoryEx_GreyScale4bit(0, 0, m_nPixelCountX, m_nPixelCountY, scanlineData.data(), (uint32_t)nScanlineSize);
+		reversePackedPixelOrder(scanlineData.data(), scanlineData.size(), 4);
+		break;
 
-		case LibMCEnv::ePNGStorageFormat::RGBA32bit:
-			errorCode = lodepng::encode(pResult->getPNGStreamBuffer(), *m_PixelData, m_nPixelCountX, m_nPixelCountY, LCT_RGBA, 8);
-			break;
+	case LibMCEnv::ePNGStorageFormat::GreyScale8bit:
+		if (m_PixelFormat == eImagePixelFormat::GreyScale8bit) {
+			pScanlines = m_PixelData->data();
+		}
+		else {
+			scanlineData.resize(nScanlineSize * m_nPixelCountY);
+			writeToRawMemoryEx_GreyScale8bit(0, 0, m_nPixelCountX, m_nPixelCountY, scanlineData.data(), (uint32_t)nScanlineSize);
+		}
+		break;
 
-		default:
-			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPNGEXPORTFORMAT);
+	case LibMCEnv::ePNGStorageFormat::RGB24bit:
+		if (m_PixelFormat == eImagePixelFormat::RGB24bit) {
+			pScanlines = m_PixelData->data();
+		}
+		else {
+			scanlineData.resize(nScanlineSize * m_nPixelCountY);
+			writeToRawMemoryEx_RGB24bit(0, 0, m_nPixelCountX, m_nPixelCountY, scanlineData.data(), (uint32_t)nScanlineSize);
+		}
+		break;
 
+	case LibMCEnv::ePNGStorageFormat::RGBA32bit:
+		if (m_PixelFormat == eImagePixelFormat::RGBA32bit) {
+			pScanlines = m_PixelData->data();
+		}
+		else {
+			scanlineData.resize(nScanlineSize * m_nPixelCountY);
+			writeToRawMemoryEx_RGBA32bit(0, 0, m_nPixelCountX, m_nPixelCountY, scanlineData.data(), (uint32_t)nScanlineSize);
 		}
 		break;
 
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPNGEXPORTFORMAT);
+	}
+
+	if (pScanlines == nullptr)
+		pScanlines = scanlineData.data();
+
+	encoder.encode(pScanlines, pngBuffer);
+}
+
+
+IPNGImageData* CImageData::CreatePNGImage(IPNGImageStoreOptions* pPNGStorageOptions)
+{
+	if (m_PixelData.get() == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
+	if ((m_nPixelCountX == 0) || (m_nPixelCountY == 0))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
+
+	switch (m_PixelFormat) {
+	case eImagePixelFormat::GreyScale8bit:
+	case eImagePixelFormat::RGB24bit:
+	case eImagePixelFormat::RGBA32bit:
+		break;
 	default:
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
+	}
 
+	// Retrieve optional storage options
+	LibMCEnv::ePNGStorageFormat pngStorageFormat = LibMCEnv::ePNGStorageFormat::RGB24bit;
+	LibMCEnv::ePNGEncoderBackend encoderBackend = LibMCEnv::ePNGEncoderBackend::ZLib;
+	LibMCEnv::ePNGFilterStrategy filterStrategy = LibMCEnv::ePNGFilterStrategy::Adaptive;
+	uint32_t nCompressionLevel = PNGIMAGESTOREOPTIONS_DEFAULTCOMPRESSIONLEVEL;
+	uint32_t nThreadCount = 0;
+	if (pPNGStorageOptions != nullptr) {
+		pngStorageFormat = pPNGStorageOptions->GetStorageFormat();
+		encoderBackend = pPNGStorageOptions->GetEncoderBackend();
+		filterStrategy = pPNGStorageOptions->GetFilterStrategy();
+		nCompressionLevel = pPNGStorageOptions->GetCompressionLevel();
+		nThreadCount = pPNGStorageOptions->GetThreadCount();
 	}
 
-	if (errorCode) {
-		std::string sErrorMessage (lodepng_error_text(errorCode));
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COULDNOTCOMPRESSPNGIMAGE, sErrorMessage);
+	std::unique_ptr<CPNGImageData> pResult (new CPNGImageData (m_nPixelCountX, m_nPixelCountY));
+
+	switch (encoderBackend) {
+	case LibMCEnv::ePNGEncoderBackend::LodePNG:
+		encodePNGWithLodePNG(pResult->getPNGStreamBuffer(), pngStorageFormat, nCompressionLevel, filterStrategy);
+		break;
+
+	case LibMCEnv::ePNGEncoderBackend::ZLib:
+		encodePNGWithZLib(pResult->getPNGStreamBuffer(), pngStorageFormat, nCompressionLevel, filterStrategy, nThreadCount);
+		break;
+
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPNGENCODERBACKEND);
 	}
 
 	if (pResult->getPNGStreamBuffer().empty())
@@ -705,6 +796,20 @@ void CImageData::Clear(const LibMCEnv_uint32 nValue)
 			break;
 		}
 
+		// The value is given as 24 bit RGB and is reduced to 5 bit red, 6 bit green and 5 bit blue.
+		case eImagePixelFormat::RGB16bit: {
+			uint32_t nRed = (nValue & 0xff);
+			uint32_t nGreen = ((nValue >> 8) & 0xff);
+			uint32_t nBlue = ((nValue >> 16) & 0xff);
+			uint32_t nColor = ((nBlue & 0xF8) << 8) | ((nGreen & 0xFC) << 3) | (nRed >> 3);
+
+			for (auto iter = m_PixelData->begin(); iter != m_PixelData->end();) {
+				*iter = (uint8_t)(nColor & 0xff); iter++;
+				*iter = (uint8_t)(nColor >> 8); iter++;
+			}
+			break;
+		}
+
 	}
 
 
@@ -917,12 +1022,6 @@ void CImageData::GetPixels(const LibMCEnv_uint32 nStartX, const LibMCEnv_uint32
 	if (m_PixelData.get() == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
 
-	if (pValueBuffer == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
-
-	if (m_PixelData.get() == nullptr)
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
-
 	if (nCountX <= 0)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELCOUNT);
 	if (nCountY <= 0)
@@ -1081,7 +1180,8 @@ void CImageData::SetPixelsFromRawYUY2Data(const LibMCEnv_uint64 nYUY2DataBufferS
 	if (nTotalPixelCount == 0)
 		return;
 
-	if ((m_nPixelCountX % 2 != 0) || (m_nPixelCountY % 2 != 0))
+	// The data is one stream of macro pixels. For odd widths, they span two rows.
+	if (nTotalPixelCount % 2 != 0)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_YUY2PIXELCOUNTMUSTBEAMULTIPLEOF2);
 
 	if (m_PixelData.get() == nullptr)
@@ -1101,6 +1201,30 @@ void CImageData::SetPixelsFromRawYUY2Data(const LibMCEnv_uint64 nYUY2DataBufferS
 }
 
 
+// Converts the pixels nFirstPixel to nFirstPixel + nPixelCount - 1 of a YUY2 stream with pairFunction. The range may start or end
+// in the middle of a macro pixel, if the image width is odd. Those macro pixels are converted into a temporary buffer.
+static void convertYUY2PixelRange(const uint8_t* pSource, uint8_t* pTarget, size_t nFirstPixel, size_t nPixelCount, size_t nBytesPerPixel, const std::function<void(const uint8_t* pPairSource, uint8_t* pPairTarget, size_t nPairCount)>& pairFunction)
+{
+	uint8_t splitPairBuffer[8];
+	size_t nPixel = nFirstPixel;
+	size_t nEndPixel = nFirstPixel + nPixelCount;
+
+	if ((nPixel < nEndPixel) && (nPixel % 2 != 0)) {
+		pairFunction(&pSource[(nPixel - 1) * 2], splitPairBuffer, 1);
+		memcpy(&pTarget[nPixel * nBytesPerPixel], &splitPairBuffer[nBytesPerPixel], nBytesPerPixel);
+		nPixel++;
+	}
+
+	size_t nPairCount = (nEndPixel - nPixel) / 2;
+	pairFunction(&pSource[nPixel * 2], &pTarget[nPixel * nBytesPerPixel], nPairCount);
+	nPixel += nPairCount * 2;
+
+	if (nPixel < nEndPixel) {
+		pairFunction(&pSource[nPixel * 2], splitPairBuffer, 1);
+		memcpy(&pTarget[nPixel * nBytesPerPixel], splitPairBuffer, nBytesPerPixel);
+	}
+}
+
 void CImageData::convertFromYUY2_GreyScale8bit(const uint8_t* pSource)
 {
 	if (pSource == nullptr)
@@ -1108,42 +1232,15 @@ void CImageData::convertFromYUY2_GreyScale8bit(const uint8_t* pSource)
 	if (m_PixelData == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
 
+	eImageKernelType kernelType = CImageKernels::detectKernelType();
 	uint8_t* pTarget = m_PixelData->data();
+	size_t nPixelCountX = m_nPixelCountX;
 
-	uint64_t byteIndex = 0;
-	uint64_t byteCount = (uint64_t)m_nPixelCountX * (uint64_t)m_nPixelCountY * 2;
-	for (uint64_t byteIndex = 0; byteIndex < byteCount; byteIndex += 4) {
-
-		// Read the YUY2 data (2 pixels per 4 bytes)
-		uint8_t Y1 = pSource[byteIndex];
-		uint8_t U = pSource[byteIndex + 1];
-		uint8_t Y2 = pSource[byteIndex + 2];
-		uint8_t V = pSource[byteIndex + 3];
-
-		// Convert YUV to RGB for two pixels
-		for (int j = 0; j < 2; j++) {
-			uint8_t Y = (j == 0) ? Y1 : Y2;
-
-			// YUV to RGB conversion formulas
-			int C = Y - 16;
-			int D = U - 128;
-			int E = V - 128;
-
-			int R = (298 * C + 409 * E + 128) >> 8;
-			int G = (298 * C - 100 * D - 208 * E + 128) >> 8;
-			int B = (298 * C + 516 * D + 128) >> 8;
-
-			// Clamp RGB values to [0, 255]
-			R = std::min(255, std::max(0, R));
-			G = std::min(255, std::max(0, G));
-			B = std::min(255, std::max(0, B));
-
-			// Average computation
-			int nAverage = (R + G + B) / 3;
-
-			*pTarget = (uint8_t)nAverage; pTarget++;
-		}
-	}
+	CImageKernels::processRows(m_nPixelCountY, (uint64_t)nPixelCountX * 3, [&](uint32_t nFirstRow, uint32_t nRowCount) {
+		convertYUY2PixelRange(pSource, pTarget, nFirstRow * nPixelCountX, nRowCount * nPixelCountX, 1, [&](const uint8_t* pPairSource, uint8_t* pPairTarget, size_t nPairCount) {
+			CImageKernels::convertYUY2ToGrey(kernelType, pPairSource, pPairTarget, nPairCount);
+		});
+	});
 }
 
 void CImageData::convertFromYUY2_RGB16bit(const uint8_t* pSource)
@@ -1183,7 +1280,7 @@ void CImageData::convertFromYUY2_RGB16bit(const uint8_t* pSource)
 			G = std::min(255, std::max(0, G));
 			B = std::min(255, std::max(0, B));
 
-			*pTarget = ((B & 0xF8) << 8) | ((G & 0xFC) << 3) | (R >> 3);
+			*pTarget = ((B & 0xF8) << 8) | ((G & 0xFC) << 3) | (R >> 3); pTarget++;
 		}
 	}
 }
@@ -1195,41 +1292,15 @@ void CImageData::convertFromYUY2_RGB24bit(const uint8_t* pSource)
 	if (m_PixelData == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
 
+	eImageKernelType kernelType = CImageKernels::detectKernelType();
 	uint8_t* pTarget = m_PixelData->data();
+	size_t nPixelCountX = m_nPixelCountX;
 
-	uint64_t byteIndex = 0;
-	uint64_t byteCount = (uint64_t) m_nPixelCountX * (uint64_t) m_nPixelCountY * 2;
-	for (uint64_t byteIndex = 0; byteIndex < byteCount; byteIndex += 4) {
-
-		// Read the YUY2 data (2 pixels per 4 bytes)
-		uint8_t Y1 = pSource[byteIndex];
-		uint8_t U = pSource[byteIndex + 1];
-		uint8_t Y2 = pSource[byteIndex + 2];
-		uint8_t V = pSource[byteIndex + 3];
-
-		// Convert YUV to RGB for two pixels
-		for (int j = 0; j < 2; j++) {
-			uint8_t Y = (j == 0) ? Y1 : Y2;
-
-			// YUV to RGB conversion formulas
-			int C = Y - 16;
-			int D = U - 128;
-			int E = V - 128;
-
-			int R = (298 * C + 409 * E + 128) >> 8;
-			int G = (298 * C - 100 * D - 208 * E + 128) >> 8;
-			int B = (298 * C + 516 * D + 128) >> 8;
-
-			// Clamp RGB values to [0, 255]
-			R = std::min(255, std::max(0, R));
-			G = std::min(255, std::max(0, G));
-			B = std::min(255, std::max(0, B));
-
-			*pTarget = (uint8_t)R; pTarget++;
-			*pTarget = (uint8_t)G; pTarget++;
-			*pTarget = (uint8_t)B; pTarget++;
-		}
-	}
+	CImageKernels::processRows(m_nPixelCountY, (uint64_t)nPixelCountX * 5, [&](uint32_t nFirstRow, uint32_t nRowCount) {
+		convertYUY2PixelRange(pSource, pTarget, nFirstRow * nPixelCountX, nRowCount * nPixelCountX, 3, [&](const uint8_t* pPairSource, uint8_t* pPairTarget, size_t nPairCount) {
+			CImageKernels::convertYUY2ToRGB24(kernelType, pPairSource, pPairTarget, nPairCount);
+		});
+	});
 }
 
 void CImageData::convertFromYUY2_RGBA32bit(const uint8_t* pSource)
@@ -1239,42 +1310,15 @@ void CImageData::convertFromYUY2_RGBA32bit(const uint8_t* pSource)
 	if (m_PixelData == nullptr)
 		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
 
+	eImageKernelType kernelType = CImageKernels::detectKernelType();
 	uint8_t* pTarget = m_PixelData->data();
+	size_t nPixelCountX = m_nPixelCountX;
 
-	uint64_t byteIndex = 0;
-	uint64_t byteCount = (uint64_t)m_nPixelCountX * (uint64_t)m_nPixelCountY * 2;
-	for (uint64_t byteIndex = 0; byteIndex < byteCount; byteIndex += 4) {
-
-		// Read the YUY2 data (2 pixels per 4 bytes)
-		uint8_t Y1 = pSource[byteIndex];
-		uint8_t U = pSource[byteIndex + 1];
-		uint8_t Y2 = pSource[byteIndex + 2];
-		uint8_t V = pSource[byteIndex + 3];
-
-		// Convert YUV to RGB for two pixels
-		for (int j = 0; j < 2; j++) {
-			uint8_t Y = (j == 0) ? Y1 : Y2;
-
-			// YUV to RGB conversion formulas
-			int C = Y - 16;
-			int D = U - 128;
-			int E = V - 128;
-
-			int R = (298 * C + 409 * E + 128) >> 8;
-			int G = (298 * C - 100 * D - 208 * E + 128) >> 8;
-			int B = (298 * C + 516 * D + 128) >> 8;
-
-			// Clamp RGB values to [0, 255]
-			R = std::min(255, std::max(0, R));
-			G = std::min(255, std::max(0, G));
-			B = std::min(255, std::max(0, B));
-
-			*pTarget = (uint8_t)R; pTarget++;
-			*pTarget = (uint8_t)G; pTarget++;
-			*pTarget = (uint8_t)B; pTarget++;
-			*pTarget = 255; pTarget++;
-		}
-	}
+	CImageKernels::processRows(m_nPixelCountY, (uint64_t)nPixelCountX * 6, [&](uint32_t nFirstRow, uint32_t nRowCount) {
+		convertYUY2PixelRange(pSource, pTarget, nFirstRow * nPixelCountX, nRowCount * nPixelCountX, 4, [&](const uint8_t* pPairSource, uint8_t* pPairTarget, size_t nPairCount) {
+			CImageKernels::convertYUY2ToRGBA32(kernelType, pPairSource, pPairTarget, nPairCount);
+		});
+	});
 }
 
 
@@ -1308,46 +1352,28 @@ void CImageData::writeToRawMemoryEx_BlackWhite1bit(uint32_t nStartX, uint32_t nS
 
 	switch (m_PixelFormat) {
 	case eImagePixelFormat::GreyScale8bit: {
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelSourceAddress = nLineAddress;
-			uint8_t* pPixelTargetPtr = &pTarget[nLineBitPosition / 8];
-			size_t nPixelTargetBitPosition = nLineBitPosition % 8;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint8_t nGrayValue = m_PixelData->at(nPixelSourceAddress);
-				nPixelSourceAddress++;
-
-				uint32_t nPixelTargetMod = nPixelTargetBitPosition % 8;
-				nPixelTargetBitPosition++;
-
-				uint8_t nBlackWhiteMask = 0;
-				if (nGrayValue >= 128)
-					nBlackWhiteMask = 1 << (7 - nPixelTargetMod);
-
-				if (nPixelTargetMod == 0) {
-					*pPixelTargetPtr = nBlackWhiteMask;
-
-				}
-				else {
-					*pPixelTargetPtr |= nBlackWhiteMask;
-				}
-
-				if (nPixelTargetMod == 7)
-					pPixelTargetPtr++;
-
-			}
-
-			nLineBitPosition += nYLinePixelOffset;
-			nLineAddress += m_nPixelCountX;
-		}
-
-
-		break;
-	}
-
-
-	case eImagePixelFormat::RGB16bit: {
+		eImageKernelType kernelType = CImageKernels::detectKernelType();
+		const uint8_t* pSource = &m_PixelData->data()[nLineAddress];
+		size_t nPixelCountX = m_nPixelCountX;
+
+		auto packRows = [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++) {
+				size_t nRowBitPosition = (size_t)nRow * nYLinePixelOffset;
+				CImageKernels::packBlackWhite1bit(kernelType, &pSource[nRow * nPixelCountX], &pTarget[nRowBitPosition / 8], (uint32_t)(nRowBitPosition % 8), nCountX);
+			}
+		};
+
+		// Rows may only be packed in parallel if they do not share any target bytes
+		if (((nYLinePixelOffset % 8) == 0) && (nYLinePixelOffset >= nCountX))
+			CImageKernels::processRows(nCountY, nCountX, packRows);
+		else
+			packRows(0, nCountY);
+
+		break;
+	}
+
+
+	case eImagePixelFormat::RGB16bit: {
 		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
 
 			size_t nPixelSourceAddress = nLineAddress;
@@ -1504,35 +1530,19 @@ void CImageData::writeToRawMemoryEx_GreyScale2bit(uint32_t nStartX, uint32_t nSt
 
 	switch (m_PixelFormat) {
 	case eImagePixelFormat::GreyScale8bit: {
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint8_t nGrayValue = m_PixelData->at(nPixelAddress);
-				nPixelAddress++;
-
-				uint8_t nGrayValue2bit = nGrayValue / 64;
-
-				uint32_t nColumnMod = nColumn % 4;
-				if (nColumnMod == 0) {
-					*pPixelPtr = nGrayValue2bit;
-
-				}
-				else {
-					*pPixelPtr |= nGrayValue2bit << (nColumnMod * 2);
-				}
+		eImageKernelType kernelType = CImageKernels::detectKernelType();
+		const uint8_t* pSource = &m_PixelData->data()[nLineAddress];
+		size_t nPixelCountX = m_nPixelCountX;
 
-				if (nColumnMod == 3)
-					pPixelPtr++;
-
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += m_nPixelCountX;
-		}
+		auto packRows = [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::packGreyScale2bit(kernelType, &pSource[nRow * nPixelCountX], &pTarget[(size_t)nRow * nYLineOffset], nCountX);
+		};
 
+		if (nYLineOffset >= ((uint64_t)nCountX + 3) / 4)
+			CImageKernels::processRows(nCountY, nCountX, packRows);
+		else
+			packRows(0, nCountY);
 
 		break;
 	}
@@ -1677,29 +1687,19 @@ void CImageData::writeToRawMemoryEx_GreyScale4bit(uint32_t nStartX, uint32_t nSt
 
 	switch (m_PixelFormat) {
 	case eImagePixelFormat::GreyScale8bit: {
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint8_t nGrayValue4Bit = m_PixelData->at(nPixelAddress) / 16;
-				nPixelAddress++;
+		eImageKernelType kernelType = CImageKernels::detectKernelType();
+		const uint8_t* pSource = &m_PixelData->data()[nLineAddress];
+		size_t nPixelCountX = m_nPixelCountX;
 
-				if (nColumn % 2 == 0) {
-					*pPixelPtr = nGrayValue4Bit;
-				}
-				else {
-					*pPixelPtr |= (nGrayValue4Bit << 4);
-					pPixelPtr++;
-
-				}
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += m_nPixelCountX;
-		}
+		auto packRows = [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::packGreyScale4bit(kernelType, &pSource[nRow * nPixelCountX], &pTarget[(size_t)nRow * nYLineOffset], nCountX);
+		};
 
+		if (nYLineOffset >= ((uint64_t)nCountX + 1) / 2)
+			CImageKernels::processRows(nCountY, nCountX, packRows);
+		else
+			packRows(0, nCountY);
 
 		break;
 	}
@@ -1829,21 +1829,12 @@ void CImageData::writeToRawMemoryEx_GreyScale8bit(uint32_t nStartX, uint32_t nSt
 	switch (m_PixelFormat) {
 	case eImagePixelFormat::GreyScale8bit: {
 		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				*pPixelPtr = m_PixelData->at(nPixelAddress);
-				nPixelAddress++;
-				pPixelPtr++;
-			}
+			memcpy(pLinePtr, &m_PixelData->data()[nLineAddress], nCountX);
 
 			pLinePtr += nYLineOffset;
 			nLineAddress += m_nPixelCountX;
 		}
 
-		
 		break;
 	}
 
@@ -1878,49 +1869,37 @@ void CImageData::writeToRawMemoryEx_GreyScale8bit(uint32_t nStartX, uint32_t nSt
 	}
 
 	case eImagePixelFormat::RGB24bit: {
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
+		eImageKernelType kernelType = CImageKernels::detectKernelType();
+		const uint8_t* pSource = &m_PixelData->data()[nLineAddress * 3];
+		size_t nPixelCountX = m_nPixelCountX;
 
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
+		auto reduceRows = [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::reduceRGB24ToGrey(kernelType, &pSource[nRow * nPixelCountX * 3], &pTarget[(size_t)nRow * nYLineOffset], nCountX);
+		};
 
-				uint8_t nGray = (uint8_t)((nRed + nGreen + nBlue) / 3);
-				*pPixelPtr = nGray;
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t) m_nPixelCountX * 3;
-		}
+		if (nYLineOffset >= nCountX)
+			CImageKernels::processRows(nCountY, (uint64_t)nCountX * 3, reduceRows);
+		else
+			reduceRows(0, nCountY);
 
 		break;
 	}
 
 	case eImagePixelFormat::RGBA32bit: {
-		size_t nPixelAddress = nLineAddress;
-		uint8_t* pPixelPtr = pLinePtr;
+		eImageKernelType kernelType = CImageKernels::detectKernelType();
+		const uint8_t* pSource = &m_PixelData->data()[nLineAddress * 4];
+		size_t nPixelCountX = m_nPixelCountX;
 
-		for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-			uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-			uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-			uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-			nPixelAddress++; // Ignore alpha
-
-			uint8_t nGray = (uint8_t)((nRed + nGreen + nBlue) / 3);
-			*pPixelPtr = nGray;
+		auto reduceRows = [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::reduceRGBA32ToGrey(kernelType, &pSource[nRow * nPixelCountX * 4], &pTarget[(size_t)nRow * nYLineOffset], nCountX);
+		};
 
-			pPixelPtr++;
-		}
-
-		pLinePtr += nYLineOffset;
-		nLineAddress += (size_t)m_nPixelCountX * 4;
+		if (nYLineOffset >= nCountX)
+			CImageKernels::processRows(nCountY, (uint64_t)nCountX * 4, reduceRows);
+		else
+			reduceRows(0, nCountY);
 
 		break;
 	}
@@ -1956,106 +1935,70 @@ void CImageData::writeToRawMemoryEx_RGB16bit(uint32_t nStartX, uint32_t nStartY,
 
 	switch (m_PixelFormat) {
 	case eImagePixelFormat::GreyScale8bit: {
-		size_t nLineAddress = (size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX;
+		const uint8_t* pSource = &m_PixelData->data()[((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX)];
+		size_t nPixelCountX = m_nPixelCountX;
 
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint16_t* pPixelPtr = (uint16_t*)pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint32_t nGrayValue = m_PixelData->at(nPixelAddress);
-				nPixelAddress++;
-
-				*pPixelPtr = ((nGrayValue & 0xF8) << 8) | ((nGrayValue & 0xFC) << 3) | (nGrayValue >> 3);
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += m_nPixelCountX;
-		}
+		auto convertRows = [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::packGreyToRGB16(&pSource[nRow * nPixelCountX], &pLinePtr[(size_t)nRow * nYLineOffset], nCountX);
+		};
 
+		if (nYLineOffset >= (uint64_t)nCountX * 2)
+			CImageKernels::processRows(nCountY, (uint64_t)nCountX * 2, convertRows);
+		else
+			convertRows(0, nCountY);
 
 		break;
 	}
 
 
 	case eImagePixelFormat::RGB16bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 2;
+		const uint8_t* pSource = &m_PixelData->data()[((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 2];
+		size_t nPixelCountX = m_nPixelCountX;
 
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
+		auto convertRows = [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::convertRGB16ToNative(&pSource[nRow * nPixelCountX * 2], &pLinePtr[(size_t)nRow * nYLineOffset], nCountX);
+		};
 
-			size_t nPixelAddress = nLineAddress;
-			uint16_t* pPixelPtr = (uint16_t*)pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nLow = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nHigh = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint16_t nColor = nLow | (nHigh << 8);
-
-				*pPixelPtr = nColor;
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 2;
-		}
+		if (nYLineOffset >= (uint64_t)nCountX * 2)
+			CImageKernels::processRows(nCountY, (uint64_t)nCountX * 2, convertRows);
+		else
+			convertRows(0, nCountY);
 
 		break;
 	}
 
 	case eImagePixelFormat::RGB24bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 3;
+		const uint8_t* pSource = &m_PixelData->data()[((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 3];
+		size_t nPixelCountX = m_nPixelCountX;
 
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
+		auto convertRows = [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::packRGB24ToRGB16(&pSource[nRow * nPixelCountX * 3], &pLinePtr[(size_t)nRow * nYLineOffset], nCountX);
+		};
 
-			size_t nPixelAddress = nLineAddress;
-			uint16_t* pPixelPtr = (uint16_t*)pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-
-				*pPixelPtr = ((nBlue & 0xF8) << 8) | ((nGreen & 0xFC) << 3) | (nRed >> 3);
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
+		if (nYLineOffset >= (uint64_t)nCountX * 2)
+			CImageKernels::processRows(nCountY, (uint64_t)nCountX * 2, convertRows);
+		else
+			convertRows(0, nCountY);
 
 		break;
 	}
 
 	case eImagePixelFormat::RGBA32bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 4;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint16_t* pPixelPtr = (uint16_t*)pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
+		const uint8_t* pSource = &m_PixelData->data()[((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 4];
+		size_t nPixelCountX = m_nPixelCountX;
 
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				nPixelAddress++; // alpha
+		auto convertRows = [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::packRGBA32ToRGB16(&pSource[nRow * nPixelCountX * 4], &pLinePtr[(size_t)nRow * nYLineOffset], nCountX);
+		};
 
-				*pPixelPtr = ((nBlue & 0xF8) << 8) | ((nGreen & 0xFC) << 3) | (nRed >> 3);
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
+		if (nYLineOffset >= (uint64_t)nCountX * 2)
+			CImageKernels::processRows(nCountY, (uint64_t)nCountX * 2, convertRows);
+		else
+			convertRows(0, nCountY);
 
 		break;
 	}
@@ -2091,106 +2034,72 @@ void CImageData::writeToRawMemoryEx_RGB24bit(uint32_t nStartX, uint32_t nStartY,
 
 	switch (m_PixelFormat) {
 	case eImagePixelFormat::GreyScale8bit: {
-		size_t nLineAddress = (size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
+		eImageKernelType kernelType = CImageKernels::detectKernelType();
+		const uint8_t* pSource = &m_PixelData->data()[(size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX];
+		size_t nPixelCountX = m_nPixelCountX;
 
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint8_t nGrayValue = m_PixelData->at(nPixelAddress);
-				nPixelAddress++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += m_nPixelCountX;
-		}
+		auto expandRows = [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::expandGreyToRGB24(kernelType, &pSource[nRow * nPixelCountX], &pLinePtr[(size_t)nRow * nYLineOffset], nCountX);
+		};
 
+		if (nYLineOffset >= (uint64_t)nCountX * 3)
+			CImageKernels::processRows(nCountY, (uint64_t)nCountX * 3, expandRows);
+		else
+			expandRows(0, nCountY);
 
 		break;
 	}
 
 
 	case eImagePixelFormat::RGB16bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 2;
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
+		const uint8_t* pSource = &m_PixelData->data()[((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 2];
+		size_t nPixelCountX = m_nPixelCountX;
 
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
+		auto convertRows = [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::expandRGB16ToRGB24(&pSource[nRow * nPixelCountX * 2], &pLinePtr[(size_t)nRow * nYLineOffset], nCountX);
+		};
 
-				uint32_t nLow = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nHigh = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint16_t nColor = nLow | (nHigh << 8);
-
-				uint32_t nRed = (nColor & 0x1f) << 3;
-				uint32_t nGreen = ((nColor >> 5) & 0x3f) << 2;
-				uint32_t nBlue = ((nColor >> 11) & 0x1f) << 3;
-
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 2;
-		}
+		if (nYLineOffset >= (uint64_t)nCountX * 3)
+			CImageKernels::processRows(nCountY, (uint64_t)nCountX * 3, convertRows);
+		else
+			convertRows(0, nCountY);
 
 		break;
 	}
 
 	case eImagePixelFormat::RGB24bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 3;
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
+		const uint8_t* pSource = &m_PixelData->data()[((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 3];
+		size_t nPixelCountX = m_nPixelCountX;
 
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
+		auto convertRows = [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				memcpy(&pLinePtr[(size_t)nRow * nYLineOffset], &pSource[nRow * nPixelCountX * 3], (size_t)nCountX * 3);
+		};
 
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;				
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
+		if (nYLineOffset >= (uint64_t)nCountX * 3)
+			CImageKernels::processRows(nCountY, (uint64_t)nCountX * 3, convertRows);
+		else
+			convertRows(0, nCountY);
 
 		break;
 	}
 
 	case eImagePixelFormat::RGBA32bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 4;
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
+		eImageKernelType kernelType = CImageKernels::detectKernelType();
+		const uint8_t* pSource = &m_PixelData->data()[((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 4];
+		size_t nPixelCountX = m_nPixelCountX;
 
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
+		auto convertRows = [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::reduceRGBA32ToRGB24(kernelType, &pSource[nRow * nPixelCountX * 4], &pLinePtr[(size_t)nRow * nYLineOffset], nCountX);
+		};
 
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				nPixelAddress++; // alpha
-
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
+		if (nYLineOffset >= (uint64_t)nCountX * 3)
+			CImageKernels::processRows(nCountY, (uint64_t)nCountX * 3, convertRows);
+		else
+			convertRows(0, nCountY);
 
 		break;
 	}
@@ -2226,117 +2135,72 @@ void CImageData::writeToRawMemoryEx_RGBA32bit(uint32_t nStartX, uint32_t nStartY
 
 	switch (m_PixelFormat) {
 	case eImagePixelFormat::GreyScale8bit: {
-		size_t nLineAddress = (size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint8_t nGrayValue = m_PixelData->at(nPixelAddress);
-				nPixelAddress++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-				*pPixelPtr = nGrayValue;  pPixelPtr++;
-				*pPixelPtr = 255;  pPixelPtr++;
-			}
+		eImageKernelType kernelType = CImageKernels::detectKernelType();
+		const uint8_t* pSource = &m_PixelData->data()[(size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX];
+		size_t nPixelCountX = m_nPixelCountX;
 
-			pLinePtr += nYLineOffset;
-			nLineAddress += m_nPixelCountX;
-		}
+		auto expandRows = [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::expandGreyToRGBA32(kernelType, &pSource[nRow * nPixelCountX], &pLinePtr[(size_t)nRow * nYLineOffset], nCountX);
+		};
 
+		if (nYLineOffset >= (uint64_t)nCountX * 4)
+			CImageKernels::processRows(nCountY, (uint64_t)nCountX * 4, expandRows);
+		else
+			expandRows(0, nCountY);
 
 		break;
 	}
 
 
 	case eImagePixelFormat::RGB16bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 2;
+		const uint8_t* pSource = &m_PixelData->data()[((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 2];
+		size_t nPixelCountX = m_nPixelCountX;
 
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
+		auto convertRows = [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::expandRGB16ToRGBA32(&pSource[nRow * nPixelCountX * 2], &pLinePtr[(size_t)nRow * nYLineOffset], nCountX);
+		};
 
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nLow = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nHigh = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint16_t nColor = nLow | (nHigh << 8);
-
-				uint32_t nRed = (nColor & 0x1f) << 3;
-				uint32_t nGreen = ((nColor >> 5) & 0x3f) << 2;
-				uint32_t nBlue = ((nColor >> 11) & 0x1f) << 3;
-
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;
-				*pPixelPtr = 255;  pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 2;
-		}
+		if (nYLineOffset >= (uint64_t)nCountX * 4)
+			CImageKernels::processRows(nCountY, (uint64_t)nCountX * 4, convertRows);
+		else
+			convertRows(0, nCountY);
 
 		break;
 	}
 
 	case eImagePixelFormat::RGB24bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 3;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
+		eImageKernelType kernelType = CImageKernels::detectKernelType();
+		const uint8_t* pSource = &m_PixelData->data()[((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 3];
+		size_t nPixelCountX = m_nPixelCountX;
 
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
+		auto convertRows = [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::expandRGB24ToRGBA32(kernelType, &pSource[nRow * nPixelCountX * 3], &pLinePtr[(size_t)nRow * nYLineOffset], nCountX);
+		};
 
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;
-				*pPixelPtr = 255;  pPixelPtr++;
-
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
+		if (nYLineOffset >= (uint64_t)nCountX * 4)
+			CImageKernels::processRows(nCountY, (uint64_t)nCountX * 4, convertRows);
+		else
+			convertRows(0, nCountY);
 
 		break;
 	}
 
 	case eImagePixelFormat::RGBA32bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 4;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-
-				uint32_t nRed = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nGreen = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				uint32_t nBlue = m_PixelData->at(nPixelAddress); nPixelAddress++;
-				nPixelAddress++; // alpha
+		const uint8_t* pSource = &m_PixelData->data()[((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 4];
+		size_t nPixelCountX = m_nPixelCountX;
 
-				*pPixelPtr = nRed; pPixelPtr++;
-				*pPixelPtr = nGreen; pPixelPtr++;
-				*pPixelPtr = nBlue; pPixelPtr++;
-				*pPixelPtr = 255;  pPixelPtr++;
+		auto convertRows = [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				memcpy(&pLinePtr[(size_t)nRow * nYLineOffset], &pSource[nRow * nPixelCountX * 4], (size_t)nCountX * 4);
+		};
 
-				pPixelPtr++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 4;
-		}
+		if (nYLineOffset >= (uint64_t)nCountX * 4)
+			CImageKernels::processRows(nCountY, (uint64_t)nCountX * 4, convertRows);
+		else
+			convertRows(0, nCountY);
 
 		break;
 	}
@@ -2376,85 +2240,133 @@ void CImageData::readFromRawMemoryEx_GreyScale8bit(uint32_t nStartX, uint32_t nS
 		size_t nLineAddress = (size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX;
 
 		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			const uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn	 = 0; nColumn < nCountX; nColumn++) {
-				m_PixelData->at(nPixelAddress) = *pPixelPtr;
-				nPixelAddress++;
-				pPixelPtr++;
-			}
+			memcpy(&m_PixelData->data()[nLineAddress], pLinePtr, nCountX);
 
 			pLinePtr += nYLineOffset;
 			nLineAddress += m_nPixelCountX;
 		}
 
-
 		break;
 	}
 	case eImagePixelFormat::RGB24bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 3;
+		eImageKernelType kernelType = CImageKernels::detectKernelType();
+		uint8_t* pTarget = &m_PixelData->data()[((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 3];
+		size_t nPixelCountX = m_nPixelCountX;
 
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
+		CImageKernels::processRows(nCountY, (uint64_t)nCountX * 3, [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::expandGreyToRGB24(kernelType, &pLinePtr[(size_t)nRow * nYLineOffset], &pTarget[nRow * nPixelCountX * 3], nCountX);
+		});
 
-			size_t nPixelAddress = nLineAddress;
-			const uint8_t* pPixelPtr = pLinePtr;
+		break;
+	}
+	case eImagePixelFormat::RGBA32bit: {
+		eImageKernelType kernelType = CImageKernels::detectKernelType();
+		uint8_t* pTarget = &m_PixelData->data()[((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 4];
+		size_t nPixelCountX = m_nPixelCountX;
 
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint8_t nValue = *pPixelPtr;
+		CImageKernels::processRows(nCountY, (uint64_t)nCountX * 4, [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::expandGreyToRGBA32(kernelType, &pLinePtr[(size_t)nRow * nYLineOffset], &pTarget[nRow * nPixelCountX * 4], nCountX);
+		});
 
-				m_PixelData->at(nPixelAddress) = nValue; nPixelAddress++;
-				m_PixelData->at(nPixelAddress) = nValue; nPixelAddress++;
-				m_PixelData->at(nPixelAddress) = nValue; nPixelAddress++;
+		break;
+	}
 
-				pPixelPtr++;
-			}
 
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
 
-		break;
 	}
-	case eImagePixelFormat::RGBA32bit: {
-		size_t nLineAddress = ((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 3;
 
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
 
-			size_t nPixelAddress = nLineAddress;
-			const uint8_t* pPixelPtr = pLinePtr;
+}
 
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint8_t nValue = *pPixelPtr;
+void CImageData::readFromRawMemoryEx_RGB16bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, const  uint8_t* pSource, uint32_t nYLineOffset)
+{
+	if ((nCountX <= 0) || (nCountY <= 0))
+		return;
 
-				m_PixelData->at(nPixelAddress) = nValue; nPixelAddress++;
-				m_PixelData->at(nPixelAddress) = nValue; nPixelAddress++;
-				m_PixelData->at(nPixelAddress) = nValue; nPixelAddress++;
-				m_PixelData->at(nPixelAddress) = 255; nPixelAddress++;
+	if (m_PixelData.get() == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
+	if (pSource == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDIMAGEBUFFER);
 
-				pPixelPtr++;
+	if (nStartX >= m_nPixelCountX)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
+	if (nStartY >= m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
+	if (((uint64_t)nStartX + nCountX) > m_nPixelCountX)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDXCOORDINATE);
+	if (((uint64_t)nStartY + nCountY) > m_nPixelCountY)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDYCOORDINATE);
+
+	const uint8_t* pLinePtr = pSource;
+
+	switch (m_PixelFormat) {
+	case eImagePixelFormat::GreyScale8bit: {
+		uint8_t* pTarget = &m_PixelData->data()[(size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX];
+		size_t nPixelCountX = m_nPixelCountX;
+
+		CImageKernels::processRows(nCountY, (uint64_t)nCountX * 2, [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++) {
+				const uint8_t* pPixelPtr = &pLinePtr[(size_t)nRow * nYLineOffset];
+				uint8_t* pTargetPtr = &pTarget[nRow * nPixelCountX];
+
+				for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
+					uint32_t nColor = (uint32_t)pPixelPtr[0] | ((uint32_t)pPixelPtr[1] << 8);
+					uint32_t nRed = (nColor & 0x1f) << 3;
+					uint32_t nGreen = ((nColor >> 5) & 0x3f) << 2;
+					uint32_t nBlue = ((nColor >> 11) & 0x1f) << 3;
+
+					*pTargetPtr = (uint8_t)((nRed + nGreen + nBlue) / 3);
+					pPixelPtr += 2;
+					pTargetPtr++;
+				}
 			}
+		});
 
-			pLinePtr += nYLineOffset;
-			nLineAddress += (size_t)m_nPixelCountX * 3;
-		}
+		break;
+	}
+	case eImagePixelFormat::RGB16bit: {
+		uint8_t* pTarget = &m_PixelData->data()[((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 2];
+		size_t nPixelCountX = m_nPixelCountX;
+
+		CImageKernels::processRows(nCountY, (uint64_t)nCountX * 2, [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::convertRGB16ToNative(&pLinePtr[(size_t)nRow * nYLineOffset], &pTarget[nRow * nPixelCountX * 2], nCountX);
+		});
 
 		break;
 	}
+	case eImagePixelFormat::RGB24bit: {
+		uint8_t* pTarget = &m_PixelData->data()[((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 3];
+		size_t nPixelCountX = m_nPixelCountX;
 
+		CImageKernels::processRows(nCountY, (uint64_t)nCountX * 3, [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::expandRGB16ToRGB24(&pLinePtr[(size_t)nRow * nYLineOffset], &pTarget[nRow * nPixelCountX * 3], nCountX);
+		});
 
-	default:
-		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
+		break;
+	}
+	case eImagePixelFormat::RGBA32bit: {
+		uint8_t* pTarget = &m_PixelData->data()[((size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX) * 4];
+		size_t nPixelCountX = m_nPixelCountX;
+
+		CImageKernels::processRows(nCountY, (uint64_t)nCountX * 4, [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::expandRGB16ToRGBA32(&pLinePtr[(size_t)nRow * nYLineOffset], &pTarget[nRow * nPixelCountX * 4], nCountX);
+		});
 
+		break;
 	}
 
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELFORMAT);
 
-}
+	}
 
-void CImageData::readFromRawMemoryEx_RGB16bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, const  uint8_t* pSource, uint32_t nYLineOffset)
-{
-	throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_NOTIMPLEMENTED);
 }
 
 void CImageData::readFromRawMemoryEx_RGB24bit(uint32_t nStartX, uint32_t nStartY, uint32_t nCountX, uint32_t nCountY, const uint8_t* pSource, uint32_t nYLineOffset)
@@ -2480,25 +2392,14 @@ void CImageData::readFromRawMemoryEx_RGB24bit(uint32_t nStartX, uint32_t nStartY
 
 	switch (m_PixelFormat) {
 	case eImagePixelFormat::GreyScale8bit: {
-		size_t nLineAddress = (size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			const uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint32_t nRed = *pPixelPtr; pPixelPtr++;
-				uint32_t nGreen = *pPixelPtr; pPixelPtr++;
-				uint32_t nBlue = *pPixelPtr; pPixelPtr++;
-				m_PixelData->at(nPixelAddress) = (nRed + nGreen + nBlue) / 2;
-				nPixelAddress++;				
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += m_nPixelCountX;
-		}
+		eImageKernelType kernelType = CImageKernels::detectKernelType();
+		uint8_t* pTarget = &m_PixelData->data()[(size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX];
+		size_t nPixelCountX = m_nPixelCountX;
 
+		CImageKernels::processRows(nCountY, (uint64_t)nCountX * 3, [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::reduceRGB24ToGrey(kernelType, &pLinePtr[(size_t)nRow * nYLineOffset], &pTarget[nRow * nPixelCountX], nCountX);
+		});
 
 		break;
 	}
@@ -2583,26 +2484,14 @@ void CImageData::readFromRawMemoryEx_RGBA32bit(uint32_t nStartX, uint32_t nStart
 
 	switch (m_PixelFormat) {
 	case eImagePixelFormat::GreyScale8bit: {
-		size_t nLineAddress = (size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX;
-
-		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
-
-			size_t nPixelAddress = nLineAddress;
-			const uint8_t* pPixelPtr = pLinePtr;
-
-			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
-				uint32_t nRed = *pPixelPtr; pPixelPtr++;
-				uint32_t nGreen = *pPixelPtr; pPixelPtr++;
-				uint32_t nBlue = *pPixelPtr; pPixelPtr++;
-				pPixelPtr++; // alpha
-				m_PixelData->at(nPixelAddress) = (nRed + nGreen + nBlue) / 2;
-				nPixelAddress++;
-			}
-
-			pLinePtr += nYLineOffset;
-			nLineAddress += m_nPixelCountX;
-		}
-
+		eImageKernelType kernelType = CImageKernels::detectKernelType();
+		uint8_t* pTarget = &m_PixelData->data()[(size_t)nStartX + (size_t)nStartY * (size_t)m_nPixelCountX];
+		size_t nPixelCountX = m_nPixelCountX;
+
+		CImageKernels::processRows(nCountY, (uint64_t)nCountX * 4, [&](uint32_t nFirstRow, uint32_t nRowCount) {
+			for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++)
+				CImageKernels::reduceRGBA32ToGrey(kernelType, &pLinePtr[(size_t)nRow * nYLineOffset], &pTarget[nRow * nPixelCountX], nCountX);
+		});
 
 		break;
 	}
@@ -91,7 +91,8 @@ private:
 	void convertFromYUY2_RGB24bit(const uint8_t* pSource);
 	void convertFromYUY2_RGBA32bit(const uint8_t* pSource);
 
-	uint32_t encodeBlackWhitePalettePNG(std::vector<uint8_t>& pngBuffer, std::vector<uint8_t>& imageBuffer, uint32_t imageSizeX, uint32_t imageSizeY);
+	void encodePNGWithLodePNG(std::vector<uint8_t>& pngBuffer, LibMCEnv::ePNGStorageFormat pngStorageFormat, uint32_t nCompressionLevel, LibMCEnv::ePNGFilterStrategy filterStrategy);
+	void encodePNGWithZLib(std::vector<uint8_t>& pngBuffer, LibMCEnv::ePNGStorageFormat pngStorageFormat, uint32_t nCompressionLevel, LibMCEnv::ePNGFilterStrategy filterStrategy, uint32_t nThreadCount);
 
 protected:
 
@@ -0,0 +1,1374 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: Row conversion kernels of CImageData
+
+*/
+
+#include "libmcenv_imagekernels.hpp"
+#include "common_parallelblocks.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define IMAGEKERNELS_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define IMAGEKERNELS_TARGET_AVX2
+#define IMAGEKERNELS_TARGET_SSE2
+#else
+#define IMAGEKERNELS_TARGET_AVX2 __attribute__((target("avx2")))
+#define IMAGEKERNELS_TARGET_SSE2 __attribute__((target("sse2")))
+#endif
+#endif
+
+// Horizontal byte additions are only available on 64 bit ARM.
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define IMAGEKERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+using namespace LibMCEnv::Impl;
+
+
+/*************************************************************************************************************************
+ Scalar reference kernels
+**************************************************************************************************************************/
+
+static inline void convertYUVToRGB(int nY, int nU, int nV, int& nRed, int& nGreen, int& nBlue)
+{
+	int C = nY - 16;
+	int D = nU - 128;
+	int E = nV - 128;
+
+	nRed = std::min(255, std::max(0, (298 * C + 409 * E + 128) >> 8));
+	nGreen = std::min(255, std::max(0, (298 * C - 100 * D - 208 * E + 128) >> 8));
+	nBlue = std::min(255, std::max(0, (298 * C + 516 * D + 128) >> 8));
+}
+
+static void packBlackWhite1bitScalar(const uint8_t* pSource, uint8_t* pTarget, uint32_t nTargetBitOffset, size_t nCount)
+{
+	uint32_t nBit = nTargetBitOffset;
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		uint8_t nMask = 0;
+		if (pSource[nIndex] >= 128)
+			nMask = (uint8_t)(0x80 >> nBit);
+
+		if (nBit == 0)
+			*pTarget = nMask;
+		else
+			*pTarget |= nMask;
+
+		nBit++;
+		if (nBit == 8) {
+			nBit = 0;
+			pTarget++;
+		}
+	}
+}
+
+static void packGreyScale2bitScalar(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		uint8_t nValue = pSource[nIndex] / 64;
+		size_t nMod = nIndex % 4;
+		if (nMod == 0)
+			pTarget[nIndex / 4] = nValue;
+		else
+			pTarget[nIndex / 4] |= (uint8_t)(nValue << (nMod * 2));
+	}
+}
+
+static void packGreyScale4bitScalar(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		uint8_t nValue = pSource[nIndex] / 16;
+		if (nIndex % 2 == 0)
+			pTarget[nIndex / 2] = nValue;
+		else
+			pTarget[nIndex / 2] |= (uint8_t)(nValue << 4);
+	}
+}
+
+static void expandGreyToRGB24Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		uint8_t nValue = pSource[nIndex];
+		pTarget[0] = nValue;
+		pTarget[1] = nValue;
+		pTarget[2] = nValue;
+		pTarget += 3;
+	}
+}
+
+static void expandGreyToRGBA32Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		uint8_t nValue = pSource[nIndex];
+		pTarget[0] = nValue;
+		pTarget[1] = nValue;
+		pTarget[2] = nValue;
+		pTarget[3] = 255;
+		pTarget += 4;
+	}
+}
+
+static void reduceRGB24ToGreyScalar(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		uint32_t nSum = (uint32_t)pSource[0] + (uint32_t)pSource[1] + (uint32_t)pSource[2];
+		pTarget[nIndex] = (uint8_t)(nSum / 3);
+		pSource += 3;
+	}
+}
+
+static void reduceRGBA32ToGreyScalar(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		uint32_t nSum = (uint32_t)pSource[0] + (uint32_t)pSource[1] + (uint32_t)pSource[2];
+		pTarget[nIndex] = (uint8_t)(nSum / 3);
+		pSource += 4;
+	}
+}
+
+static void expandRGB24ToRGBA32Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		pTarget[0] = pSource[0];
+		pTarget[1] = pSource[1];
+		pTarget[2] = pSource[2];
+		pTarget[3] = 255;
+		pSource += 3;
+		pTarget += 4;
+	}
+}
+
+static void reduceRGBA32ToRGB24Scalar(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		pTarget[0] = pSource[0];
+		pTarget[1] = pSource[1];
+		pTarget[2] = pSource[2];
+		pSource += 4;
+		pTarget += 3;
+	}
+}
+
+static inline uint16_t packRGB16(uint32_t nRed, uint32_t nGreen, uint32_t nBlue)
+{
+	return (uint16_t)(((nBlue & 0xF8) << 8) | ((nGreen & 0xFC) << 3) | (nRed >> 3));
+}
+
+static inline void storeRGB16(uint8_t* pTarget, uint16_t nColor)
+{
+	memcpy(pTarget, &nColor, sizeof(nColor));
+}
+
+static void convertYUY2ToGreyScalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPairCount)
+{
+	for (size_t nPair = 0; nPair < nPairCount; nPair++) {
+		int nRed, nGreen, nBlue;
+		convertYUVToRGB(pSource[0], pSource[1], pSource[3], nRed, nGreen, nBlue);
+		pTarget[0] = (uint8_t)((nRed + nGreen + nBlue) / 3);
+		convertYUVToRGB(pSource[2], pSource[1], pSource[3], nRed, nGreen, nBlue);
+		pTarget[1] = (uint8_t)((nRed + nGreen + nBlue) / 3);
+
+		pSource += 4;
+		pTarget += 2;
+	}
+}
+
+static void convertYUY2ToRGBScalar(const uint8_t* pSource, uint8_t* pTarget, size_t nPairCount, bool bAlpha)
+{
+	for (size_t nPair = 0; nPair < nPairCount; nPair++) {
+		for (int j = 0; j < 2; j++) {
+			int nRed, nGreen, nBlue;
+			convertYUVToRGB(pSource[j * 2], pSource[1], pSource[3], nRed, nGreen, nBlue);
+			*pTarget = (uint8_t)nRed; pTarget++;
+			*pTarget = (uint8_t)nGreen; pTarget++;
+			*pTarget = (uint8_t)nBlue; pTarget++;
+			if (bAlpha) {
+				*pTarget = 255; pTarget++;
+			}
+		}
+
+		pSource += 4;
+	}
+}
+
+
+/*************************************************************************************************************************
+ SSE2 and AVX2 kernels
+**************************************************************************************************************************/
+
+#ifdef IMAGEKERNELS_X86
+
+// x / 3 == (x * 0xAAAB) >> 17 holds for all x < 2^17. The sums of three 8 bit channels are at most 765.
+#define IMAGEKERNELS_DIVIDEBY3FACTOR ((int16_t) 0xAAAB)
+
+IMAGEKERNELS_TARGET_SSE2 static inline __m128i makeCoefficientPairSSE2(int16_t nLow, int16_t nHigh)
+{
+	return _mm_set1_epi32((int32_t)(((uint32_t)(uint16_t)nHigh << 16) | (uint32_t)(uint16_t)nLow));
+}
+
+IMAGEKERNELS_TARGET_SSE2 static void packBlackWhite1bitSSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	// Values of 128 or more are negative as signed bytes. The weighted mask bytes of each
+	// half are distinct powers of two, so their sum is the MSB first bit pattern.
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i weights = _mm_set_epi8(1, 2, 4, 8, 16, 32, 64, (char)128, 1, 2, 4, 8, 16, 32, 64, (char)128);
+
+	size_t nIndex = 0;
+	for (; nIndex + 16 <= nCount; nIndex += 16) {
+		__m128i values = _mm_loadu_si128((const __m128i*) &pSource[nIndex]);
+		__m128i sums = _mm_sad_epu8(_mm_and_si128(_mm_cmplt_epi8(values, zero), weights), zero);
+
+		pTarget[nIndex / 8] = (uint8_t)_mm_cvtsi128_si32(sums);
+		pTarget[nIndex / 8 + 1] = (uint8_t)_mm_extract_epi16(sums, 4);
+	}
+
+	packBlackWhite1bitScalar(&pSource[nIndex], &pTarget[nIndex / 8], 0, nCount - nIndex);
+}
+
+IMAGEKERNELS_TARGET_SSE2 static __m128i packGreyScale2bitQuadSSE2(__m128i values)
+{
+	// Combine neighbouring 2 bit values in 16 bit lanes first, then in 32 bit lanes.
+	__m128i values2bit = _mm_and_si128(_mm_srli_epi16(values, 6), _mm_set1_epi8(0x03));
+	__m128i values4bit = _mm_and_si128(_mm_or_si128(values2bit, _mm_srli_epi16(values2bit, 6)), _mm_set1_epi16(0x000f));
+	return _mm_and_si128(_mm_or_si128(values4bit, _mm_srli_epi32(values4bit, 12)), _mm_set1_epi32(0x000000ff));
+}
+
+IMAGEKERNELS_TARGET_SSE2 static void packGreyScale2bitSSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	size_t nIndex = 0;
+	for (; nIndex + 64 <= nCount; nIndex += 64) {
+		__m128i packed0 = packGreyScale2bitQuadSSE2(_mm_loadu_si128((const __m128i*) &pSource[nIndex]));
+		__m128i packed1 = packGreyScale2bitQuadSSE2(_mm_loadu_si128((const __m128i*) &pSource[nIndex + 16]));
+		__m128i packed2 = packGreyScale2bitQuadSSE2(_mm_loadu_si128((const __m128i*) &pSource[nIndex + 32]));
+		__m128i packed3 = packGreyScale2bitQuadSSE2(_mm_loadu_si128((const __m128i*) &pSource[nIndex + 48]));
+
+		__m128i packed = _mm_packus_epi16(_mm_packs_epi32(packed0, packed1), _mm_packs_epi32(packed2, packed3));
+		_mm_storeu_si128((__m128i*) &pTarget[nIndex / 4], packed);
+	}
+
+	packGreyScale2bitScalar(&pSource[nIndex], &pTarget[nIndex / 4], nCount - nIndex);
+}
+
+IMAGEKERNELS_TARGET_SSE2 static __m128i packGreyScale4bitPairSSE2(__m128i values)
+{
+	__m128i values4bit = _mm_and_si128(_mm_srli_epi16(values, 4), _mm_set1_epi8(0x0f));
+	return _mm_and_si128(_mm_or_si128(values4bit, _mm_srli_epi16(values4bit, 4)), _mm_set1_epi16(0x00ff));
+}
+
+IMAGEKERNELS_TARGET_SSE2 static void packGreyScale4bitSSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	size_t nIndex = 0;
+	for (; nIndex + 32 <= nCount; nIndex += 32) {
+		__m128i packed0 = packGreyScale4bitPairSSE2(_mm_loadu_si128((const __m128i*) &pSource[nIndex]));
+		__m128i packed1 = packGreyScale4bitPairSSE2(_mm_loadu_si128((const __m128i*) &pSource[nIndex + 16]));
+		_mm_storeu_si128((__m128i*) &pTarget[nIndex / 2], _mm_packus_epi16(packed0, packed1));
+	}
+
+	packGreyScale4bitScalar(&pSource[nIndex], &pTarget[nIndex / 2], nCount - nIndex);
+}
+
+IMAGEKERNELS_TARGET_SSE2 static void expandGreyToRGBA32SSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	const __m128i alpha = _mm_set1_epi8((char)0xff);
+
+	size_t nIndex = 0;
+	for (; nIndex + 16 <= nCount; nIndex += 16) {
+		__m128i values = _mm_loadu_si128((const __m128i*) &pSource[nIndex]);
+		__m128i greyGreyLow = _mm_unpacklo_epi8(values, values);
+		__m128i greyAlphaLow = _mm_unpacklo_epi8(values, alpha);
+		__m128i greyGreyHigh = _mm_unpackhi_epi8(values, values);
+		__m128i greyAlphaHigh = _mm_unpackhi_epi8(values, alpha);
+
+		__m128i* pTargetVector = (__m128i*) &pTarget[nIndex * 4];
+		_mm_storeu_si128(pTargetVector, _mm_unpacklo_epi16(greyGreyLow, greyAlphaLow));
+		_mm_storeu_si128(pTargetVector + 1, _mm_unpackhi_epi16(greyGreyLow, greyAlphaLow));
+		_mm_storeu_si128(pTargetVector + 2, _mm_unpacklo_epi16(greyGreyHigh, greyAlphaHigh));
+		_mm_storeu_si128(pTargetVector + 3, _mm_unpackhi_epi16(greyGreyHigh, greyAlphaHigh));
+	}
+
+	expandGreyToRGBA32Scalar(&pSource[nIndex], &pTarget[nIndex * 4], nCount - nIndex);
+}
+
+IMAGEKERNELS_TARGET_SSE2 static __m128i sumRGBX32SSE2(__m128i values)
+{
+	const __m128i mask = _mm_set1_epi32(0xff);
+	__m128i sum = _mm_add_epi32(_mm_and_si128(values, mask), _mm_and_si128(_mm_srli_epi32(values, 8), mask));
+	return _mm_add_epi32(sum, _mm_and_si128(_mm_srli_epi32(values, 16), mask));
+}
+
+IMAGEKERNELS_TARGET_SSE2 static __m128i divideBy3SSE2(__m128i values)
+{
+	return _mm_srli_epi16(_mm_mulhi_epu16(values, _mm_set1_epi16(IMAGEKERNELS_DIVIDEBY3FACTOR)), 1);
+}
+
+IMAGEKERNELS_TARGET_SSE2 static void reduceRGBA32ToGreySSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	size_t nIndex = 0;
+	for (; nIndex + 16 <= nCount; nIndex += 16) {
+		const __m128i* pSourceVector = (const __m128i*) &pSource[nIndex * 4];
+		__m128i sums0 = _mm_packs_epi32(sumRGBX32SSE2(_mm_loadu_si128(pSourceVector)), sumRGBX32SSE2(_mm_loadu_si128(pSourceVector + 1)));
+		__m128i sums1 = _mm_packs_epi32(sumRGBX32SSE2(_mm_loadu_si128(pSourceVector + 2)), sumRGBX32SSE2(_mm_loadu_si128(pSourceVector + 3)));
+
+		_mm_storeu_si128((__m128i*) &pTarget[nIndex], _mm_packus_epi16(divideBy3SSE2(sums0), divideBy3SSE2(sums1)));
+	}
+
+	reduceRGBA32ToGreyScalar(&pSource[nIndex * 4], &pTarget[nIndex], nCount - nIndex);
+}
+
+// Converts 8 pixels of YUY2 data into clamped 16 bit red, green and blue values.
+// Every lane computes exactly the integer formula of convertYUVToRGB.
+IMAGEKERNELS_TARGET_SSE2 static void convertYUY2OctSSE2(__m128i values, __m128i& red, __m128i& green, __m128i& blue)
+{
+	__m128i luma = _mm_and_si128(values, _mm_set1_epi16(0x00ff));
+	__m128i chroma = _mm_srli_epi16(values, 8);
+
+	// Every pair of pixels shares one U and one V value
+	__m128i chromaU = _mm_and_si128(chroma, _mm_set1_epi32(0x0000ffff));
+	chromaU = _mm_or_si128(chromaU, _mm_slli_epi32(chromaU, 16));
+	__m128i chromaV = _mm_srli_epi32(chroma, 16);
+	chromaV = _mm_or_si128(chromaV, _mm_slli_epi32(chromaV, 16));
+
+	__m128i C = _mm_sub_epi16(luma, _mm_set1_epi16(16));
+	__m128i D = _mm_sub_epi16(chromaU, _mm_set1_epi16(128));
+	__m128i E = _mm_sub_epi16(chromaV, _mm_set1_epi16(128));
+	__m128i one = _mm_set1_epi16(1);
+
+	__m128i CELow = _mm_unpacklo_epi16(C, E);
+	__m128i CEHigh = _mm_unpackhi_epi16(C, E);
+	__m128i CDLow = _mm_unpacklo_epi16(C, D);
+	__m128i CDHigh = _mm_unpackhi_epi16(C, D);
+	__m128i EOneLow = _mm_unpacklo_epi16(E, one);
+	__m128i EOneHigh = _mm_unpackhi_epi16(E, one);
+
+	__m128i rounding = _mm_set1_epi32(128);
+	__m128i redFactors = makeCoefficientPairSSE2(298, 409);
+	__m128i greenFactors = makeCoefficientPairSSE2(298, -100);
+	__m128i greenFactorsE = makeCoefficientPairSSE2(-208, 128);
+	__m128i blueFactors = makeCoefficientPairSSE2(298, 516);
+
+	__m128i redLow = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(CELow, redFactors), rounding), 8);
+	__m128i redHigh = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(CEHigh, redFactors), rounding), 8);
+	__m128i greenLow = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(CDLow, greenFactors), _mm_madd_epi16(EOneLow, greenFactorsE)), 8);
+	__m128i greenHigh = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(CDHigh, greenFactors), _mm_madd_epi16(EOneHigh, greenFactorsE)), 8);
+	__m128i blueLow = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(CDLow, blueFactors), rounding), 8);
+	__m128i blueHigh = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(CDHigh, blueFactors), rounding), 8);
+
+	// All unclamped values are within [-277, 534], so the signed 16 bit packing does not saturate.
+	__m128i zero = _mm_setzero_si128();
+	__m128i maxValue = _mm_set1_epi16(255);
+	red = _mm_min_epi16(_mm_max_epi16(_mm_packs_epi32(redLow, redHigh), zero), maxValue);
+	green = _mm_min_epi16(_mm_max_epi16(_mm_packs_epi32(greenLow, greenHigh), zero), maxValue);
+	blue = _mm_min_epi16(_mm_max_epi16(_mm_packs_epi32(blueLow, blueHigh), zero), maxValue);
+}
+
+IMAGEKERNELS_TARGET_SSE2 static void convertYUY2ToGreySSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nPairCount)
+{
+	size_t nPair = 0;
+	for (; nPair + 4 <= nPairCount; nPair += 4) {
+		__m128i red, green, blue;
+		convertYUY2OctSSE2(_mm_loadu_si128((const __m128i*) &pSource[nPair * 4]), red, green, blue);
+
+		__m128i grey = divideBy3SSE2(_mm_add_epi16(_mm_add_epi16(red, green), blue));
+		_mm_storel_epi64((__m128i*) &pTarget[nPair * 2], _mm_packus_epi16(grey, grey));
+	}
+
+	convertYUY2ToGreyScalar(&pSource[nPair * 4], &pTarget[nPair * 2], nPairCount - nPair);
+}
+
+IMAGEKERNELS_TARGET_SSE2 static void convertYUY2ToRGBSSE2(const uint8_t* pSource, uint8_t* pTarget, size_t nPairCount, bool bAlpha)
+{
+	size_t nPixelSize = bAlpha ? 4 : 3;
+	__m128i alpha = _mm_set1_epi16((short)0xff00);
+
+	size_t nPair = 0;
+	for (; nPair + 4 <= nPairCount; nPair += 4) {
+		__m128i red, green, blue;
+		convertYUY2OctSSE2(_mm_loadu_si128((const __m128i*) &pSource[nPair * 4]), red, green, blue);
+
+		__m128i redGreen = _mm_or_si128(red, _mm_slli_epi16(green, 8));
+		__m128i blueAlpha = _mm_or_si128(blue, alpha);
+		__m128i pixels0 = _mm_unpacklo_epi16(redGreen, blueAlpha);
+		__m128i pixels1 = _mm_unpackhi_epi16(redGreen, blueAlpha);
+
+		uint8_t* pPixelTarget = &pTarget[nPair * 2 * nPixelSize];
+		if (bAlpha) {
+			_mm_storeu_si128((__m128i*) pPixelTarget, pixels0);
+			_mm_storeu_si128((__m128i*) (pPixelTarget + 16), pixels1);
+		}
+		else {
+			// SSE2 has no byte shuffle, so the alpha channel is dropped while copying.
+			uint8_t pixelBuffer[32];
+			_mm_storeu_si128((__m128i*) pixelBuffer, pixels0);
+			_mm_storeu_si128((__m128i*) (pixelBuffer + 16), pixels1);
+			for (uint32_t nPixel = 0; nPixel < 8; nPixel++)
+				memcpy(&pPixelTarget[nPixel * 3], &pixelBuffer[nPixel * 4], 3);
+		}
+	}
+
+	convertYUY2ToRGBScalar(&pSource[nPair * 4], &pTarget[nPair * 2 * nPixelSize], nPairCount - nPair, bAlpha);
+}
+
+IMAGEKERNELS_TARGET_AVX2 static void packBlackWhite1bitAVX2(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	// Reversing each group of 8 bytes lets the sign bit mask come out MSB first.
+	const __m256i reverseGroups = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+	size_t nIndex = 0;
+	for (; nIndex + 32 <= nCount; nIndex += 32) {
+		__m256i values = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*) &pSource[nIndex]), reverseGroups);
+		uint32_t nBits = (uint32_t)_mm256_movemask_epi8(values);
+
+		pTarget[nIndex / 8] = (uint8_t)nBits;
+		pTarget[nIndex / 8 + 1] = (uint8_t)(nBits >> 8);
+		pTarget[nIndex / 8 + 2] = (uint8_t)(nBits >> 16);
+		pTarget[nIndex / 8 + 3] = (uint8_t)(nBits >> 24);
+	}
+
+	packBlackWhite1bitScalar(&pSource[nIndex], &pTarget[nIndex / 8], 0, nCount - nIndex);
+}
+
+IMAGEKERNELS_TARGET_AVX2 static __m256i packGreyScale2bitOctAVX2(__m256i values)
+{
+	__m256i values2bit = _mm256_and_si256(_mm256_srli_epi16(values, 6), _mm256_set1_epi8(0x03));
+	__m256i values4bit = _mm256_and_si256(_mm256_or_si256(values2bit, _mm256_srli_epi16(values2bit, 6)), _mm256_set1_epi16(0x000f));
+	return _mm256_and_si256(_mm256_or_si256(values4bit, _mm256_srli_epi32(values4bit, 12)), _mm256_set1_epi32(0x000000ff));
+}
+
+IMAGEKERNELS_TARGET_AVX2 static void packGreyScale2bitAVX2(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	// AVX2 packs within 128 bit lanes, so the 32 bit groups need to be put back in order.
+	const __m256i lanePermutation = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+	size_t nIndex = 0;
+	for (; nIndex + 128 <= nCount; nIndex += 128) {
+		__m256i packed0 = packGreyScale2bitOctAVX2(_mm256_loadu_si256((const __m256i*) &pSource[nIndex]));
+		__m256i packed1 = packGreyScale2bitOctAVX2(_mm256_loadu_si256((const __m256i*) &pSource[nIndex + 32]));
+		__m256i packed2 = packGreyScale2bitOctAVX2(_mm256_loadu_si256((const __m256i*) &pSource[nIndex + 64]));
+		__m256i packed3 = packGreyScale2bitOctAVX2(_mm256_loadu_si256((const __m256i*) &pSource[nIndex + 96]));
+
+		__m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(packed0, packed1), _mm256_packs_epi32(packed2, packed3));
+		_mm256_storeu_si256((__m256i*) &pTarget[nIndex / 4], _mm256_permutevar8x32_epi32(packed, lanePermutation));
+	}
+
+	packGreyScale2bitScalar(&pSource[nIndex], &pTarget[nIndex / 4], nCount - nIndex);
+}
+
+IMAGEKERNELS_TARGET_AVX2 static __m256i packGreyScale4bitQuadAVX2(__m256i values)
+{
+	__m256i values4bit = _mm256_and_si256(_mm256_srli_epi16(values, 4), _mm256_set1_epi8(0x0f));
+	return _mm256_and_si256(_mm256_or_si256(values4bit, _mm256_srli_epi16(values4bit, 4)), _mm256_set1_epi16(0x00ff));
+}
+
+IMAGEKERNELS_TARGET_AVX2 static void packGreyScale4bitAVX2(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	size_t nIndex = 0;
+	for (; nIndex + 64 <= nCount; nIndex += 64) {
+		__m256i packed0 = packGreyScale4bitQuadAVX2(_mm256_loadu_si256((const __m256i*) &pSource[nIndex]));
+		__m256i packed1 = packGreyScale4bitQuadAVX2(_mm256_loadu_si256((const __m256i*) &pSource[nIndex + 32]));
+
+		__m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(packed0, packed1), 0xd8);
+		_mm256_storeu_si256((__m256i*) &pTarget[nIndex / 2], packed);
+	}
+
+	packGreyScale4bitScalar(&pSource[nIndex], &pTarget[nIndex / 2], nCount - nIndex);
+}
+
+IMAGEKERNELS_TARGET_AVX2 static void expandGreyToRGB24AVX2(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	const __m128i shuffle0 = _mm_setr_epi8(0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5);
+	const __m128i shuffle1 = _mm_setr_epi8(5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10);
+	const __m128i shuffle2 = _mm_setr_epi8(10, 11, 11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 15);
+
+	size_t nIndex = 0;
+	for (; nIndex + 16 <= nCount; nIndex += 16) {
+		__m128i values = _mm_loadu_si128((const __m128i*) &pSource[nIndex]);
+
+		__m128i* pTargetVector = (__m128i*) &pTarget[nIndex * 3];
+		_mm_storeu_si128(pTargetVector, _mm_shuffle_epi8(values, shuffle0));
+		_mm_storeu_si128(pTargetVector + 1, _mm_shuffle_epi8(values, shuffle1));
+		_mm_storeu_si128(pTargetVector + 2, _mm_shuffle_epi8(values, shuffle2));
+	}
+
+	expandGreyToRGB24Scalar(&pSource[nIndex], &pTarget[nIndex * 3], nCount - nIndex);
+}
+
+// Loads 16 bytes per 4 pixels, so the last pixels are left to the scalar loop
+IMAGEKERNELS_TARGET_AVX2 static void expandRGB24ToRGBA32AVX2(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	const __m256i shuffle = _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+	const __m256i alpha = _mm256_set1_epi32((int32_t)0xff000000);
+
+	size_t nIndex = 0;
+	for (; nIndex + 10 <= nCount; nIndex += 8) {
+		__m128i low = _mm_loadu_si128((const __m128i*) &pSource[nIndex * 3]);
+		__m128i high = _mm_loadu_si128((const __m128i*) &pSource[nIndex * 3 + 12]);
+		__m256i values = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+		_mm256_storeu_si256((__m256i*) &pTarget[nIndex * 4], _mm256_or_si256(_mm256_shuffle_epi8(values, shuffle), alpha));
+	}
+
+	expandRGB24ToRGBA32Scalar(&pSource[nIndex * 3], &pTarget[nIndex * 4], nCount - nIndex);
+}
+
+IMAGEKERNELS_TARGET_AVX2 static void reduceRGBA32ToRGB24AVX2(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	const __m256i shuffle = _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+	const __m256i permutation = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+	size_t nIndex = 0;
+	for (; nIndex + 8 <= nCount; nIndex += 8) {
+		__m256i values = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*) &pSource[nIndex * 4]), shuffle);
+		values = _mm256_permutevar8x32_epi32(values, permutation);
+
+		// 24 bytes per 8 pixels
+		_mm_storeu_si128((__m128i*) &pTarget[nIndex * 3], _mm256_castsi256_si128(values));
+		_mm_storel_epi64((__m128i*) &pTarget[nIndex * 3 + 16], _mm256_extracti128_si256(values, 1));
+	}
+
+	reduceRGBA32ToRGB24Scalar(&pSource[nIndex * 4], &pTarget[nIndex * 3], nCount - nIndex);
+}
+
+IMAGEKERNELS_TARGET_AVX2 static void expandGreyToRGBA32AVX2(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	const __m256i alpha = _mm256_set1_epi32((int32_t)0xff000000);
+
+	size_t nIndex = 0;
+	for (; nIndex + 8 <= nCount; nIndex += 8) {
+		__m256i values = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) &pSource[nIndex]));
+		__m256i pixels = _mm256_or_si256(_mm256_or_si256(values, _mm256_slli_epi32(values, 8)), _mm256_or_si256(_mm256_slli_epi32(values, 16), alpha));
+		_mm256_storeu_si256((__m256i*) &pTarget[nIndex * 4], pixels);
+	}
+
+	expandGreyToRGBA32Scalar(&pSource[nIndex], &pTarget[nIndex * 4], nCount - nIndex);
+}
+
+IMAGEKERNELS_TARGET_AVX2 static __m256i sumRGBX32AVX2(__m256i values)
+{
+	const __m256i mask = _mm256_set1_epi32(0xff);
+	__m256i sum = _mm256_add_epi32(_mm256_and_si256(values, mask), _mm256_and_si256(_mm256_srli_epi32(values, 8), mask));
+	return _mm256_add_epi32(sum, _mm256_and_si256(_mm256_srli_epi32(values, 16), mask));
+}
+
+IMAGEKERNELS_TARGET_AVX2 static void storeGreyFromSumsAVX2(__m256i sums0, __m256i sums1, uint8_t* pTarget)
+{
+	// AVX2 packs within 128 bit lanes, so the result needs to be put back in order.
+	__m256i sums = _mm256_permute4x64_epi64(_mm256_packs_epi32(sums0, sums1), 0xd8);
+	__m256i grey = _mm256_srli_epi16(_mm256_mulhi_epu16(sums, _mm256_set1_epi16(IMAGEKERNELS_DIVIDEBY3FACTOR)), 1);
+	_mm_storeu_si128((__m128i*) pTarget, _mm_packus_epi16(_mm256_castsi256_si128(grey), _mm256_extracti128_si256(grey, 1)));
+}
+
+IMAGEKERNELS_TARGET_AVX2 static void reduceRGB24ToGreyAVX2(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	// Spreads 4 RGB pixels into 32 bit lanes, the unused byte is cleared.
+	const __m128i spreadPixels = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+
+	size_t nIndex = 0;
+	for (; nIndex + 16 <= nCount; nIndex += 16) {
+		const __m128i* pSourceVector = (const __m128i*) &pSource[nIndex * 3];
+		__m128i bytes0 = _mm_loadu_si128(pSourceVector);
+		__m128i bytes1 = _mm_loadu_si128(pSourceVector + 1);
+		__m128i bytes2 = _mm_loadu_si128(pSourceVector + 2);
+
+		__m128i pixels0 = _mm_shuffle_epi8(bytes0, spreadPixels);
+		__m128i pixels1 = _mm_shuffle_epi8(_mm_alignr_epi8(bytes1, bytes0, 12), spreadPixels);
+		__m128i pixels2 = _mm_shuffle_epi8(_mm_alignr_epi8(bytes2, bytes1, 8), spreadPixels);
+		__m128i pixels3 = _mm_shuffle_epi8(_mm_srli_si128(bytes2, 4), spreadPixels);
+
+		__m256i sums0 = sumRGBX32AVX2(_mm256_inserti128_si256(_mm256_castsi128_si256(pixels0), pixels1, 1));
+		__m256i sums1 = sumRGBX32AVX2(_mm256_inserti128_si256(_mm256_castsi128_si256(pixels2), pixels3, 1));
+		storeGreyFromSumsAVX2(sums0, sums1, &pTarget[nIndex]);
+	}
+
+	reduceRGB24ToGreyScalar(&pSource[nIndex * 3], &pTarget[nIndex], nCount - nIndex);
+}
+
+IMAGEKERNELS_TARGET_AVX2 static void reduceRGBA32ToGreyAVX2(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	size_t nIndex = 0;
+	for (; nIndex + 16 <= nCount; nIndex += 16) {
+		const __m256i* pSourceVector = (const __m256i*) &pSource[nIndex * 4];
+		__m256i sums0 = sumRGBX32AVX2(_mm256_loadu_si256(pSourceVector));
+		__m256i sums1 = sumRGBX32AVX2(_mm256_loadu_si256(pSourceVector + 1));
+		storeGreyFromSumsAVX2(sums0, sums1, &pTarget[nIndex]);
+	}
+
+	reduceRGBA32ToGreyScalar(&pSource[nIndex * 4], &pTarget[nIndex], nCount - nIndex);
+}
+
+IMAGEKERNELS_TARGET_AVX2 static inline __m256i makeCoefficientPairAVX2(int16_t nLow, int16_t nHigh)
+{
+	return _mm256_set1_epi32((int32_t)(((uint32_t)(uint16_t)nHigh << 16) | (uint32_t)(uint16_t)nLow));
+}
+
+// Same as convertYUY2OctSSE2 for 16 pixels. All operations stay within their 128 bit lane,
+// so lane 0 holds pixels 0 to 7 and lane 1 holds pixels 8 to 15.
+IMAGEKERNELS_TARGET_AVX2 static void convertYUY2HexAVX2(__m256i values, __m256i& red, __m256i& green, __m256i& blue)
+{
+	__m256i luma = _mm256_and_si256(values, _mm256_set1_epi16(0x00ff));
+	__m256i chroma = _mm256_srli_epi16(values, 8);
+
+	__m256i chromaU = _mm256_and_si256(chroma, _mm256_set1_epi32(0x0000ffff));
+	chromaU = _mm256_or_si256(chromaU, _mm256_slli_epi32(chromaU, 16));
+	__m256i chromaV = _mm256_srli_epi32(chroma, 16);
+	chromaV = _mm256_or_si256(chromaV, _mm256_slli_epi32(chromaV, 16));
+
+	__m256i C = _mm256_sub_epi16(luma, _mm256_set1_epi16(16));
+	__m256i D = _mm256_sub_epi16(chromaU, _mm256_set1_epi16(128));
+	__m256i E = _mm256_sub_epi16(chromaV, _mm256_set1_epi16(128));
+	__m256i one = _mm256_set1_epi16(1);
+
+	__m256i CELow = _mm256_unpacklo_epi16(C, E);
+	__m256i CEHigh = _mm256_unpackhi_epi16(C, E);
+	__m256i CDLow = _mm256_unpacklo_epi16(C, D);
+	__m256i CDHigh = _mm256_unpackhi_epi16(C, D);
+	__m256i EOneLow = _mm256_unpacklo_epi16(E, one);
+	__m256i EOneHigh = _mm256_unpackhi_epi16(E, one);
+
+	__m256i rounding = _mm256_set1_epi32(128);
+	__m256i redFactors = makeCoefficientPairAVX2(298, 409);
+	__m256i greenFactors = makeCoefficientPairAVX2(298, -100);
+	__m256i greenFactorsE = makeCoefficientPairAVX2(-208, 128);
+	__m256i blueFactors = makeCoefficientPairAVX2(298, 516);
+
+	__m256i redLow = _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(CELow, redFactors), rounding), 8);
+	__m256i redHigh = _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(CEHigh, redFactors), rounding), 8);
+	__m256i greenLow = _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(CDLow, greenFactors), _mm256_madd_epi16(EOneLow, greenFactorsE)), 8);
+	__m256i greenHigh = _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(CDHigh, greenFactors), _mm256_madd_epi16(EOneHigh, greenFactorsE)), 8);
+	__m256i blueLow = _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(CDLow, blueFactors), rounding), 8);
+	__m256i blueHigh = _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(CDHigh, blueFactors), rounding), 8);
+
+	__m256i zero = _mm256_setzero_si256();
+	__m256i maxValue = _mm256_set1_epi16(255);
+	red = _mm256_min_epi16(_mm256_max_epi16(_mm256_packs_epi32(redLow, redHigh), zero), maxValue);
+	green = _mm256_min_epi16(_mm256_max_epi16(_mm256_packs_epi32(greenLow, greenHigh), zero), maxValue);
+	blue = _mm256_min_epi16(_mm256_max_epi16(_mm256_packs_epi32(blueLow, blueHigh), zero), maxValue);
+}
+
+IMAGEKERNELS_TARGET_AVX2 static void convertYUY2ToGreyAVX2(const uint8_t* pSource, uint8_t* pTarget, size_t nPairCount)
+{
+	size_t nPair = 0;
+	for (; nPair + 8 <= nPairCount; nPair += 8) {
+		__m256i red, green, blue;
+		convertYUY2HexAVX2(_mm256_loadu_si256((const __m256i*) &pSource[nPair * 4]), red, green, blue);
+
+		__m256i sums = _mm256_add_epi16(_mm256_add_epi16(red, green), blue);
+		__m256i grey = _mm256_srli_epi16(_mm256_mulhi_epu16(sums, _mm256_set1_epi16(IMAGEKERNELS_DIVIDEBY3FACTOR)), 1);
+		__m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(grey, grey), 0x08);
+		_mm_storeu_si128((__m128i*) &pTarget[nPair * 2], _mm256_castsi256_si128(packed));
+	}
+
+	convertYUY2ToGreyScalar(&pSource[nPair * 4], &pTarget[nPair * 2], nPairCount - nPair);
+}
+
+IMAGEKERNELS_TARGET_AVX2 static void convertYUY2ToRGBAVX2(const uint8_t* pSource, uint8_t* pTarget, size_t nPairCount, bool bAlpha)
+{
+	size_t nPixelSize = bAlpha ? 4 : 3;
+	const __m256i alpha = _mm256_set1_epi16((short)0xff00);
+	const __m256i dropAlpha = _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+	size_t nPair = 0;
+	for (; nPair + 8 <= nPairCount; nPair += 8) {
+		__m256i red, green, blue;
+		convertYUY2HexAVX2(_mm256_loadu_si256((const __m256i*) &pSource[nPair * 4]), red, green, blue);
+
+		__m256i redGreen = _mm256_or_si256(red, _mm256_slli_epi16(green, 8));
+		__m256i blueAlpha = _mm256_or_si256(blue, alpha);
+		__m256i pixelsLow = _mm256_unpacklo_epi16(redGreen, blueAlpha);
+		__m256i pixelsHigh = _mm256_unpackhi_epi16(redGreen, blueAlpha);
+		__m256i pixels0 = _mm256_permute2x128_si256(pixelsLow, pixelsHigh, 0x20);
+		__m256i pixels1 = _mm256_permute2x128_si256(pixelsLow, pixelsHigh, 0x31);
+
+		uint8_t* pPixelTarget = &pTarget[nPair * 2 * nPixelSize];
+		if (bAlpha) {
+			_mm256_storeu_si256((__m256i*) pPixelTarget, pixels0);
+			_mm256_storeu_si256((__m256i*) (pPixelTarget + 32), pixels1);
+		}
+		else {
+			// Each 16 byte store leaves 4 undefined bytes, which are overwritten by the next one.
+			__m256i packed0 = _mm256_shuffle_epi8(pixels0, dropAlpha);
+			__m256i packed1 = _mm256_shuffle_epi8(pixels1, dropAlpha);
+			_mm_storeu_si128((__m128i*) pPixelTarget, _mm256_castsi256_si128(packed0));
+			_mm_storeu_si128((__m128i*) (pPixelTarget + 12), _mm256_extracti128_si256(packed0, 1));
+			_mm_storeu_si128((__m128i*) (pPixelTarget + 24), _mm256_castsi256_si128(packed1));
+
+			uint8_t pixelBuffer[16];
+			_mm_storeu_si128((__m128i*) pixelBuffer, _mm256_extracti128_si256(packed1, 1));
+			memcpy(pPixelTarget + 36, pixelBuffer, 12);
+		}
+	}
+
+	convertYUY2ToRGBScalar(&pSource[nPair * 4], &pTarget[nPair * 2 * nPixelSize], nPairCount - nPair, bAlpha);
+}
+
+static eImageKernelType detectKernelTypeX86()
+{
+#ifdef _MSC_VER
+	int cpuInfo[4];
+	__cpuid(cpuInfo, 0);
+	int nMaxFunctionID = cpuInfo[0];
+
+	__cpuid(cpuInfo, 1);
+	bool bHasSSE2 = (cpuInfo[3] & (1 << 26)) != 0;
+	bool bHasOSXSave = (cpuInfo[2] & (1 << 27)) != 0;
+	bool bHasAVX = (cpuInfo[2] & (1 << 28)) != 0;
+
+	bool bHasAVX2 = false;
+	// AVX registers must also be saved by the operating system
+	if (bHasOSXSave && bHasAVX && (nMaxFunctionID >= 7)) {
+		if ((_xgetbv(0) & 0x6) == 0x6) {
+			__cpuidex(cpuInfo, 7, 0);
+			bHasAVX2 = (cpuInfo[1] & (1 << 5)) != 0;
+		}
+	}
+#else
+	__builtin_cpu_init();
+	bool bHasSSE2 = __builtin_cpu_supports("sse2");
+	bool bHasAVX2 = __builtin_cpu_supports("avx2");
+#endif
+
+	if (bHasAVX2)
+		return eImageKernelType::ikAVX2;
+	if (bHasSSE2)
+		return eImageKernelType::ikSSE2;
+
+	return eImageKernelType::ikScalar;
+}
+
+#endif // IMAGEKERNELS_X86
+
+
+/*************************************************************************************************************************
+ NEON kernels
+**************************************************************************************************************************/
+
+#ifdef IMAGEKERNELS_NEON
+
+static inline uint8x8_t divideBy3NEON(uint16x8_t values)
+{
+	// x / 3 == (x * 0xAAAB) >> 17 holds for all x < 2^17.
+	const uint16x4_t factor = vdup_n_u16(0xAAAB);
+	uint16x4_t low = vmovn_u32(vshrq_n_u32(vmull_u16(vget_low_u16(values), factor), 17));
+	uint16x4_t high = vmovn_u32(vshrq_n_u32(vmull_u16(vget_high_u16(values), factor), 17));
+	return vmovn_u16(vcombine_u16(low, high));
+}
+
+static void packBlackWhite1bitNEON(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	static const uint8_t weightValues[16] = { 128, 64, 32, 16, 8, 4, 2, 1, 128, 64, 32, 16, 8, 4, 2, 1 };
+	const uint8x16_t weights = vld1q_u8(weightValues);
+	const uint8x16_t threshold = vdupq_n_u8(128);
+
+	size_t nIndex = 0;
+	for (; nIndex + 16 <= nCount; nIndex += 16) {
+		uint8x16_t bits = vandq_u8(vcgeq_u8(vld1q_u8(&pSource[nIndex]), threshold), weights);
+		pTarget[nIndex / 8] = vaddv_u8(vget_low_u8(bits));
+		pTarget[nIndex / 8 + 1] = vaddv_u8(vget_high_u8(bits));
+	}
+
+	packBlackWhite1bitScalar(&pSource[nIndex], &pTarget[nIndex / 8], 0, nCount - nIndex);
+}
+
+static void packGreyScale2bitNEON(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	size_t nIndex = 0;
+	for (; nIndex + 64 <= nCount; nIndex += 64) {
+		uint8x16x4_t values = vld4q_u8(&pSource[nIndex]);
+		uint8x16_t packed = vorrq_u8(vshrq_n_u8(values.val[0], 6), vshlq_n_u8(vshrq_n_u8(values.val[1], 6), 2));
+		packed = vorrq_u8(packed, vshlq_n_u8(vshrq_n_u8(values.val[2], 6), 4));
+		packed = vorrq_u8(packed, vandq_u8(values.val[3], vdupq_n_u8(0xc0)));
+		vst1q_u8(&pTarget[nIndex / 4], packed);
+	}
+
+	packGreyScale2bitScalar(&pSource[nIndex], &pTarget[nIndex / 4], nCount - nIndex);
+}
+
+static void packGreyScale4bitNEON(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	size_t nIndex = 0;
+	for (; nIndex + 32 <= nCount; nIndex += 32) {
+		uint8x16x2_t values = vld2q_u8(&pSource[nIndex]);
+		vst1q_u8(&pTarget[nIndex / 2], vorrq_u8(vshrq_n_u8(values.val[0], 4), vandq_u8(values.val[1], vdupq_n_u8(0xf0))));
+	}
+
+	packGreyScale4bitScalar(&pSource[nIndex], &pTarget[nIndex / 2], nCount - nIndex);
+}
+
+static void expandGreyToRGB24NEON(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	size_t nIndex = 0;
+	for (; nIndex + 16 <= nCount; nIndex += 16) {
+		uint8x16_t values = vld1q_u8(&pSource[nIndex]);
+		uint8x16x3_t pixels;
+		pixels.val[0] = values;
+		pixels.val[1] = values;
+		pixels.val[2] = values;
+		vst3q_u8(&pTarget[nIndex * 3], pixels);
+	}
+
+	expandGreyToRGB24Scalar(&pSource[nIndex], &pTarget[nIndex * 3], nCount - nIndex);
+}
+
+static void expandGreyToRGBA32NEON(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	size_t nIndex = 0;
+	for (; nIndex + 16 <= nCount; nIndex += 16) {
+		uint8x16_t values = vld1q_u8(&pSource[nIndex]);
+		uint8x16x4_t pixels;
+		pixels.val[0] = values;
+		pixels.val[1] = values;
+		pixels.val[2] = values;
+		pixels.val[3] = vdupq_n_u8(255);
+		vst4q_u8(&pTarget[nIndex * 4], pixels);
+	}
+
+	expandGreyToRGBA32Scalar(&pSource[nIndex], &pTarget[nIndex * 4], nCount - nIndex);
+}
+
+static void reduceRGB24ToGreyNEON(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	size_t nIndex = 0;
+	for (; nIndex + 8 <= nCount; nIndex += 8) {
+		uint8x8x3_t pixels = vld3_u8(&pSource[nIndex * 3]);
+		uint16x8_t sums = vaddw_u8(vaddl_u8(pixels.val[0], pixels.val[1]), pixels.val[2]);
+		vst1_u8(&pTarget[nIndex], divideBy3NEON(sums));
+	}
+
+	reduceRGB24ToGreyScalar(&pSource[nIndex * 3], &pTarget[nIndex], nCount - nIndex);
+}
+
+static void reduceRGBA32ToGreyNEON(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	size_t nIndex = 0;
+	for (; nIndex + 8 <= nCount; nIndex += 8) {
+		uint8x8x4_t pixels = vld4_u8(&pSource[nIndex * 4]);
+		uint16x8_t sums = vaddw_u8(vaddl_u8(pixels.val[0], pixels.val[1]), pixels.val[2]);
+		vst1_u8(&pTarget[nIndex], divideBy3NEON(sums));
+	}
+
+	reduceRGBA32ToGreyScalar(&pSource[nIndex * 4], &pTarget[nIndex], nCount - nIndex);
+}
+
+// Returns clamp((nFactorC * C + nFactorD * D + nFactorE * E + 128) >> 8) for 8 pixels.
+static inline uint8x8_t convertYUVChannelNEON(int16x8_t C, int16x8_t D, int16x8_t E, int16_t nFactorC, int16_t nFactorD, int16_t nFactorE)
+{
+	const int32x4_t rounding = vdupq_n_s32(128);
+
+	int32x4_t low = vmlal_n_s16(vmlal_n_s16(vmull_n_s16(vget_low_s16(C), nFactorC), vget_low_s16(D), nFactorD), vget_low_s16(E), nFactorE);
+	int32x4_t high = vmlal_n_s16(vmlal_n_s16(vmull_n_s16(vget_high_s16(C), nFactorC), vget_high_s16(D), nFactorD), vget_high_s16(E), nFactorE);
+
+	int16x8_t values = vcombine_s16(vmovn_s32(vshrq_n_s32(vaddq_s32(low, rounding), 8)), vmovn_s32(vshrq_n_s32(vaddq_s32(high, rounding), 8)));
+	return vqmovun_s16(values);
+}
+
+static inline void convertYUVOctNEON(uint8x8_t luma, int16x8_t D, int16x8_t E, uint8x8_t& red, uint8x8_t& green, uint8x8_t& blue)
+{
+	int16x8_t C = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(luma)), vdupq_n_s16(16));
+
+	red = convertYUVChannelNEON(C, D, E, 298, 0, 409);
+	green = convertYUVChannelNEON(C, D, E, 298, -100, -208);
+	blue = convertYUVChannelNEON(C, D, E, 298, 516, 0);
+}
+
+static void convertYUY2ToGreyNEON(const uint8_t* pSource, uint8_t* pTarget, size_t nPairCount)
+{
+	size_t nPair = 0;
+	for (; nPair + 8 <= nPairCount; nPair += 8) {
+		// Lanes are Y0, U, Y1, V of 8 macro pixels
+		uint8x8x4_t values = vld4_u8(&pSource[nPair * 4]);
+		int16x8_t D = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(values.val[1])), vdupq_n_s16(128));
+		int16x8_t E = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(values.val[3])), vdupq_n_s16(128));
+
+		uint8x8x2_t grey;
+		for (int j = 0; j < 2; j++) {
+			uint8x8_t red, green, blue;
+			convertYUVOctNEON(values.val[j * 2], D, E, red, green, blue);
+			grey.val[j] = divideBy3NEON(vaddw_u8(vaddl_u8(red, green), blue));
+		}
+
+		vst2_u8(&pTarget[nPair * 2], grey);
+	}
+
+	convertYUY2ToGreyScalar(&pSource[nPair * 4], &pTarget[nPair * 2], nPairCount - nPair);
+}
+
+static void convertYUY2ToRGBNEON(const uint8_t* pSource, uint8_t* pTarget, size_t nPairCount, bool bAlpha)
+{
+	size_t nPixelSize = bAlpha ? 4 : 3;
+
+	size_t nPair = 0;
+	for (; nPair + 8 <= nPairCount; nPair += 8) {
+		uint8x8x4_t values = vld4_u8(&pSource[nPair * 4]);
+		int16x8_t D = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(values.val[1])), vdupq_n_s16(128));
+		int16x8_t E = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(values.val[3])), vdupq_n_s16(128));
+
+		uint8x8_t red0, green0, blue0, red1, green1, blue1;
+		convertYUVOctNEON(values.val[0], D, E, red0, green0, blue0);
+		convertYUVOctNEON(values.val[2], D, E, red1, green1, blue1);
+
+		// Interleave even and odd pixels
+		uint8x8x2_t red = vzip_u8(red0, red1);
+		uint8x8x2_t green = vzip_u8(green0, green1);
+		uint8x8x2_t blue = vzip_u8(blue0, blue1);
+
+		uint8_t* pPixelTarget = &pTarget[nPair * 2 * nPixelSize];
+		for (int j = 0; j < 2; j++) {
+			if (bAlpha) {
+				uint8x8x4_t pixels;
+				pixels.val[0] = red.val[j];
+				pixels.val[1] = green.val[j];
+				pixels.val[2] = blue.val[j];
+				pixels.val[3] = vdup_n_u8(255);
+				vst4_u8(&pPixelTarget[j * 32], pixels);
+			}
+			else {
+				uint8x8x3_t pixels;
+				pixels.val[0] = red.val[j];
+				pixels.val[1] = green.val[j];
+				pixels.val[2] = blue.val[j];
+				vst3_u8(&pPixelTarget[j * 24], pixels);
+			}
+		}
+	}
+
+	convertYUY2ToRGBScalar(&pSource[nPair * 4], &pTarget[nPair * 2 * nPixelSize], nPairCount - nPair, bAlpha);
+}
+
+static void expandRGB24ToRGBA32NEON(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	size_t nIndex = 0;
+	for (; nIndex + 16 <= nCount; nIndex += 16) {
+		uint8x16x3_t values = vld3q_u8(&pSource[nIndex * 3]);
+		uint8x16x4_t pixels;
+		pixels.val[0] = values.val[0];
+		pixels.val[1] = values.val[1];
+		pixels.val[2] = values.val[2];
+		pixels.val[3] = vdupq_n_u8(255);
+		vst4q_u8(&pTarget[nIndex * 4], pixels);
+	}
+
+	expandRGB24ToRGBA32Scalar(&pSource[nIndex * 3], &pTarget[nIndex * 4], nCount - nIndex);
+}
+
+static void reduceRGBA32ToRGB24NEON(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	size_t nIndex = 0;
+	for (; nIndex + 16 <= nCount; nIndex += 16) {
+		uint8x16x4_t values = vld4q_u8(&pSource[nIndex * 4]);
+		uint8x16x3_t pixels;
+		pixels.val[0] = values.val[0];
+		pixels.val[1] = values.val[1];
+		pixels.val[2] = values.val[2];
+		vst3q_u8(&pTarget[nIndex * 3], pixels);
+	}
+
+	reduceRGBA32ToRGB24Scalar(&pSource[nIndex * 4], &pTarget[nIndex * 3], nCount - nIndex);
+}
+
+#endif // IMAGEKERNELS_NEON
+
+
+/*************************************************************************************************************************
+ Class definition of CImageKernels
+**************************************************************************************************************************/
+
+eImageKernelType CImageKernels::detectKernelType()
+{
+#if defined(IMAGEKERNELS_X86)
+	static const eImageKernelType detectedKernelType = detectKernelTypeX86();
+	return detectedKernelType;
+#elif defined(IMAGEKERNELS_NEON)
+	// NEON is mandatory on 64 bit ARM
+	return eImageKernelType::ikNEON;
+#else
+	return eImageKernelType::ikScalar;
+#endif
+}
+
+std::string CImageKernels::getKernelTypeName(eImageKernelType kernelType)
+{
+	switch (kernelType) {
+	case eImageKernelType::ikSSE2: return "sse2";
+	case eImageKernelType::ikAVX2: return "avx2";
+	case eImageKernelType::ikNEON: return "neon";
+	default: return "scalar";
+	}
+}
+
+void CImageKernels::packBlackWhite1bit(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, uint32_t nTargetBitOffset, size_t nCount)
+{
+	// Fill up a partial first byte, the vector kernels start byte aligned.
+	if (nTargetBitOffset != 0) {
+		size_t nHeadCount = std::min(nCount, (size_t)(8 - nTargetBitOffset));
+		packBlackWhite1bitScalar(pSource, pTarget, nTargetBitOffset, nHeadCount);
+		pSource += nHeadCount;
+		pTarget++;
+		nCount -= nHeadCount;
+	}
+
+	switch (kernelType) {
+#ifdef IMAGEKERNELS_X86
+	case eImageKernelType::ikSSE2:
+		packBlackWhite1bitSSE2(pSource, pTarget, nCount);
+		break;
+	case eImageKernelType::ikAVX2:
+		packBlackWhite1bitAVX2(pSource, pTarget, nCount);
+		break;
+#endif
+#ifdef IMAGEKERNELS_NEON
+	case eImageKernelType::ikNEON:
+		packBlackWhite1bitNEON(pSource, pTarget, nCount);
+		break;
+#endif
+	default:
+		packBlackWhite1bitScalar(pSource, pTarget, 0, nCount);
+		break;
+	}
+}
+
+void CImageKernels::packGreyScale2bit(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	switch (kernelType) {
+#ifdef IMAGEKERNELS_X86
+	case eImageKernelType::ikSSE2:
+		packGreyScale2bitSSE2(pSource, pTarget, nCount);
+		break;
+	case eImageKernelType::ikAVX2:
+		packGreyScale2bitAVX2(pSource, pTarget, nCount);
+		break;
+#endif
+#ifdef IMAGEKERNELS_NEON
+	case eImageKernelType::ikNEON:
+		packGreyScale2bitNEON(pSource, pTarget, nCount);
+		break;
+#endif
+	default:
+		packGreyScale2bitScalar(pSource, pTarget, nCount);
+		break;
+	}
+}
+
+void CImageKernels::packGreyScale4bit(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	switch (kernelType) {
+#ifdef IMAGEKERNELS_X86
+	case eImageKernelType::ikSSE2:
+		packGreyScale4bitSSE2(pSource, pTarget, nCount);
+		break;
+	case eImageKernelType::ikAVX2:
+		packGreyScale4bitAVX2(pSource, pTarget, nCount);
+		break;
+#endif
+#ifdef IMAGEKERNELS_NEON
+	case eImageKernelType::ikNEON:
+		packGreyScale4bitNEON(pSource, pTarget, nCount);
+		break;
+#endif
+	default:
+		packGreyScale4bitScalar(pSource, pTarget, nCount);
+		break;
+	}
+}
+
+void CImageKernels::expandGreyToRGB24(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	switch (kernelType) {
+#ifdef IMAGEKERNELS_X86
+	// There is no SSE2 byte shuffle, the scalar loop is as fast.
+	case eImageKernelType::ikAVX2:
+		expandGreyToRGB24AVX2(pSource, pTarget, nCount);
+		break;
+#endif
+#ifdef IMAGEKERNELS_NEON
+	case eImageKernelType::ikNEON:
+		expandGreyToRGB24NEON(pSource, pTarget, nCount);
+		break;
+#endif
+	default:
+		expandGreyToRGB24Scalar(pSource, pTarget, nCount);
+		break;
+	}
+}
+
+void CImageKernels::expandGreyToRGBA32(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	switch (kernelType) {
+#ifdef IMAGEKERNELS_X86
+	case eImageKernelType::ikSSE2:
+		expandGreyToRGBA32SSE2(pSource, pTarget, nCount);
+		break;
+	case eImageKernelType::ikAVX2:
+		expandGreyToRGBA32AVX2(pSource, pTarget, nCount);
+		break;
+#endif
+#ifdef IMAGEKERNELS_NEON
+	case eImageKernelType::ikNEON:
+		expandGreyToRGBA32NEON(pSource, pTarget, nCount);
+		break;
+#endif
+	default:
+		expandGreyToRGBA32Scalar(pSource, pTarget, nCount);
+		break;
+	}
+}
+
+void CImageKernels::reduceRGB24ToGrey(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	switch (kernelType) {
+#ifdef IMAGEKERNELS_X86
+	case eImageKernelType::ikAVX2:
+		reduceRGB24ToGreyAVX2(pSource, pTarget, nCount);
+		break;
+#endif
+#ifdef IMAGEKERNELS_NEON
+	case eImageKernelType::ikNEON:
+		reduceRGB24ToGreyNEON(pSource, pTarget, nCount);
+		break;
+#endif
+	default:
+		reduceRGB24ToGreyScalar(pSource, pTarget, nCount);
+		break;
+	}
+}
+
+void CImageKernels::reduceRGBA32ToGrey(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	switch (kernelType) {
+#ifdef IMAGEKERNELS_X86
+	case eImageKernelType::ikSSE2:
+		reduceRGBA32ToGreySSE2(pSource, pTarget, nCount);
+		break;
+	case eImageKernelType::ikAVX2:
+		reduceRGBA32ToGreyAVX2(pSource, pTarget, nCount);
+		break;
+#endif
+#ifdef IMAGEKERNELS_NEON
+	case eImageKernelType::ikNEON:
+		reduceRGBA32ToGreyNEON(pSource, pTarget, nCount);
+		break;
+#endif
+	default:
+		reduceRGBA32ToGreyScalar(pSource, pTarget, nCount);
+		break;
+	}
+}
+
+void CImageKernels::expandRGB24ToRGBA32(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	switch (kernelType) {
+#ifdef IMAGEKERNELS_X86
+	// There is no SSE2 byte shuffle, the scalar loop is as fast.
+	case eImageKernelType::ikAVX2:
+		expandRGB24ToRGBA32AVX2(pSource, pTarget, nCount);
+		break;
+#endif
+#ifdef IMAGEKERNELS_NEON
+	case eImageKernelType::ikNEON:
+		expandRGB24ToRGBA32NEON(pSource, pTarget, nCount);
+		break;
+#endif
+	default:
+		expandRGB24ToRGBA32Scalar(pSource, pTarget, nCount);
+		break;
+	}
+}
+
+void CImageKernels::reduceRGBA32ToRGB24(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	switch (kernelType) {
+#ifdef IMAGEKERNELS_X86
+	case eImageKernelType::ikAVX2:
+		reduceRGBA32ToRGB24AVX2(pSource, pTarget, nCount);
+		break;
+#endif
+#ifdef IMAGEKERNELS_NEON
+	case eImageKernelType::ikNEON:
+		reduceRGBA32ToRGB24NEON(pSource, pTarget, nCount);
+		break;
+#endif
+	default:
+		reduceRGBA32ToRGB24Scalar(pSource, pTarget, nCount);
+		break;
+	}
+}
+
+void CImageKernels::convertRGB16ToNative(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		storeRGB16(pTarget, (uint16_t)((uint32_t)pSource[0] | ((uint32_t)pSource[1] << 8)));
+		pSource += 2;
+		pTarget += 2;
+	}
+}
+
+void CImageKernels::packGreyToRGB16(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		storeRGB16(pTarget, packRGB16(pSource[nIndex], pSource[nIndex], pSource[nIndex]));
+		pTarget += 2;
+	}
+}
+
+void CImageKernels::packRGB24ToRGB16(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		storeRGB16(pTarget, packRGB16(pSource[0], pSource[1], pSource[2]));
+		pSource += 3;
+		pTarget += 2;
+	}
+}
+
+void CImageKernels::packRGBA32ToRGB16(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		storeRGB16(pTarget, packRGB16(pSource[0], pSource[1], pSource[2]));
+		pSource += 4;
+		pTarget += 2;
+	}
+}
+
+void CImageKernels::expandRGB16ToRGB24(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		uint32_t nColor = (uint32_t)pSource[0] | ((uint32_t)pSource[1] << 8);
+		pTarget[0] = (uint8_t)((nColor & 0x1f) << 3);
+		pTarget[1] = (uint8_t)(((nColor >> 5) & 0x3f) << 2);
+		pTarget[2] = (uint8_t)(((nColor >> 11) & 0x1f) << 3);
+		pSource += 2;
+		pTarget += 3;
+	}
+}
+
+void CImageKernels::expandRGB16ToRGBA32(const uint8_t* pSource, uint8_t* pTarget, size_t nCount)
+{
+	for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+		uint32_t nColor = (uint32_t)pSource[0] | ((uint32_t)pSource[1] << 8);
+		pTarget[0] = (uint8_t)((nColor & 0x1f) << 3);
+		pTarget[1] = (uint8_t)(((nColor >> 5) & 0x3f) << 2);
+		pTarget[2] = (uint8_t)(((nColor >> 11) & 0x1f) << 3);
+		pTarget[3] = 255;
+		pSource += 2;
+		pTarget += 4;
+	}
+}
+
+void CImageKernels::convertYUY2ToGrey(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nPairCount)
+{
+	switch (kernelType) {
+#ifdef IMAGEKERNELS_X86
+	case eImageKernelType::ikSSE2:
+		convertYUY2ToGreySSE2(pSource, pTarget, nPairCount);
+		break;
+	case eImageKernelType::ikAVX2:
+		convertYUY2ToGreyAVX2(pSource, pTarget, nPairCount);
+		break;
+#endif
+#ifdef IMAGEKERNELS_NEON
+	case eImageKernelType::ikNEON:
+		convertYUY2ToGreyNEON(pSource, pTarget, nPairCount);
+		break;
+#endif
+	default:
+		convertYUY2ToGreyScalar(pSource, pTarget, nPairCount);
+		break;
+	}
+}
+
+void CImageKernels::convertYUY2ToRGB24(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nPairCount)
+{
+	switch (kernelType) {
+#ifdef IMAGEKERNELS_X86
+	case eImageKernelType::ikSSE2:
+		convertYUY2ToRGBSSE2(pSource, pTarget, nPairCount, false);
+		break;
+	case eImageKernelType::ikAVX2:
+		convertYUY2ToRGBAVX2(pSource, pTarget, nPairCount, false);
+		break;
+#endif
+#ifdef IMAGEKERNELS_NEON
+	case eImageKernelType::ikNEON:
+		convertYUY2ToRGBNEON(pSource, pTarget, nPairCount, false);
+		break;
+#endif
+	default:
+		convertYUY2ToRGBScalar(pSource, pTarget, nPairCount, false);
+		break;
+	}
+}
+
+void CImageKernels::convertYUY2ToRGBA32(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nPairCount)
+{
+	switch (kernelType) {
+#ifdef IMAGEKERNELS_X86
+	case eImageKernelType::ikSSE2:
+		convertYUY2ToRGBSSE2(pSource, pTarget, nPairCount, true);
+		break;
+	case eImageKernelType::ikAVX2:
+		convertYUY2ToRGBAVX2(pSource, pTarget, nPairCount, true);
+		break;
+#endif
+#ifdef IMAGEKERNELS_NEON
+	case eImageKernelType::ikNEON:
+		convertYUY2ToRGBNEON(pSource, pTarget, nPairCount, true);
+		break;
+#endif
+	default:
+		convertYUY2ToRGBScalar(pSource, pTarget, nPairCount, true);
+		break;
+	}
+}
+
+void CImageKernels::processRows(uint32_t nRowCount, uint64_t nBytesPerRow, const std::function<void(uint32_t nFirstRow, uint32_t nRowCount)>& rowFunction)
+{
+	if (nRowCount == 0)
+		return;
+
+	uint32_t nThreadCount = 1;
+	if ((uint64_t)nRowCount * nBytesPerRow >= IMAGEKERNELS_PARALLELBYTETHRESHOLD) {
+		nThreadCount = std::thread::hardware_concurrency();
+		nThreadCount = std::min(nThreadCount, (uint32_t)IMAGEKERNELS_MAXTHREADCOUNT);
+		nThreadCount = std::min(nThreadCount, nRowCount / IMAGEKERNELS_MINROWSPERTHREAD);
+	}
+
+	if (nThreadCount <= 1) {
+		rowFunction(0, nRowCount);
+		return;
+	}
+
+	AMCCommon::CParallelBlocks::processBlocks(nThreadCount, nRowCount, 1, [&rowFunction](uint32_t nBlockIndex, size_t nFirstRow, size_t nBlockRowCount) {
+		rowFunction((uint32_t)nFirstRow, (uint32_t)nBlockRowCount);
+	});
+}
@@ -0,0 +1,121 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: Row conversion kernels of CImageData
+
+*/
+
+
+#ifndef __LIBMCENV_IMAGEKERNELS
+#define __LIBMCENV_IMAGEKERNELS
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <functional>
+
+// Conversions that touch less memory than this are not worth spawning threads for.
+#define IMAGEKERNELS_PARALLELBYTETHRESHOLD (4ULL * 1024ULL * 1024ULL)
+#define IMAGEKERNELS_MINROWSPERTHREAD 16
+#define IMAGEKERNELS_MAXTHREADCOUNT 16
+
+namespace LibMCEnv {
+namespace Impl {
+
+	enum class eImageKernelType : int32_t {
+		ikScalar = 0,
+		ikSSE2 = 1,
+		ikAVX2 = 2,
+		ikNEON = 3
+	};
+
+	// Row conversions between pixel formats. All kernel types return bit-identical results,
+	// the scalar kernels are the reference implementation.
+	class CImageKernels {
+	public:
+
+		// Returns the fastest kernel type that is supported by the current CPU.
+		static eImageKernelType detectKernelType();
+
+		static std::string getKernelTypeName(eImageKernelType kernelType);
+
+		// Thresholds nCount grey values at 128 and packs them MSB first into pTarget, starting at bit nTargetBitOffset (0 to 7).
+		// Bits in front of nTargetBitOffset are kept, the remaining bits of the last byte are cleared.
+		static void packBlackWhite1bit(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, uint32_t nTargetBitOffset, size_t nCount);
+
+		// Packs nCount grey values into 2 bit values, LSB first.
+		static void packGreyScale2bit(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nCount);
+
+		// Packs nCount grey values into 4 bit values, LSB first.
+		static void packGreyScale4bit(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nCount);
+
+		static void expandGreyToRGB24(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nCount);
+
+		// Alpha is set to 255.
+		static void expandGreyToRGBA32(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nCount);
+
+		// Grey value is (R + G + B) / 3.
+		static void reduceRGB24ToGrey(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nCount);
+
+		// Grey value is (R + G + B) / 3, alpha is ignored.
+		static void reduceRGBA32ToGrey(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nCount);
+
+		// Alpha is set to 255.
+		static void expandRGB24ToRGBA32(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nCount);
+
+		// Alpha is dropped.
+		static void reduceRGBA32ToRGB24(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nCount);
+
+		// 16 bit pixels are stored low byte first in the source and written in native byte order to pTarget, which does not need to be aligned.
+		// The 5 bit red value is stored in the lowest bits. Conversions from and to 16 bit pixels do not have vector paths, the loops are
+		// simple enough to be vectorized by the compiler.
+		static void convertRGB16ToNative(const uint8_t* pSource, uint8_t* pTarget, size_t nCount);
+		static void packGreyToRGB16(const uint8_t* pSource, uint8_t* pTarget, size_t nCount);
+		static void packRGB24ToRGB16(const uint8_t* pSource, uint8_t* pTarget, size_t nCount);
+		static void packRGBA32ToRGB16(const uint8_t* pSource, uint8_t* pTarget, size_t nCount);
+		static void expandRGB16ToRGB24(const uint8_t* pSource, uint8_t* pTarget, size_t nCount);
+
+		// Alpha is set to 255.
+		static void expandRGB16ToRGBA32(const uint8_t* pSource, uint8_t* pTarget, size_t nCount);
+
+		// Converts nPairCount YUY2 macro pixels (4 bytes each) into 2 * nPairCount target pixels.
+		static void convertYUY2ToGrey(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nPairCount);
+		static void convertYUY2ToRGB24(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nPairCount);
+		static void convertYUY2ToRGBA32(eImageKernelType kernelType, const uint8_t* pSource, uint8_t* pTarget, size_t nPairCount);
+
+		// Calls rowFunction for consecutive row ranges. Large images are split across threads, so
+		// rowFunction must only write to memory that belongs to its own rows.
+		static void processRows(uint32_t nRowCount, uint64_t nBytesPerRow, const std::function<void(uint32_t nFirstRow, uint32_t nRowCount)>& rowFunction);
+
+	};
+
+} // namespace Impl
+} // namespace LibMCEnv
+
+#endif // __LIBMCENV_IMAGEKERNELS
@@ -39,6 +39,9 @@ using namespace LibMCEnv::Impl;
 
 #include "common_utils.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 /*************************************************************************************************************************
  Class definition of CMeshObject 
 **************************************************************************************************************************/
@@ -107,6 +110,21 @@ AMC::PMeshEntity CMeshObject::getMeshEntity()
     return pMeshEntity;
 }
 
+AMC::PMeshBVH CMeshObject::getMeshBVH()
+{
+    if (m_pNonPersistentMeshEntity.get() != nullptr) {
+        if (m_pNonPersistentMeshBVH.get() == nullptr)
+            m_pNonPersistentMeshBVH = std::make_shared<AMC::CMeshBVH>(m_pNonPersistentMeshEntity.get(), 0);
+
+        return m_pNonPersistentMeshBVH;
+    }
+
+    if (!m_pMeshHandler->hasMeshEntity(m_sMeshUUID))
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_MESHISNOTREGISTERED, "mesh is not registered: " + m_sMeshUUID);
+
+    return m_pMeshHandler->getMeshBVH(m_sMeshUUID);
+}
+
 
 bool CMeshObject::IsManifold()
 {
@@ -175,6 +193,80 @@ void CMeshObject::GetAllTriangles(LibMCEnv_uint64 nTrianglesBufferSize, LibMCEnv
     getMeshEntity()->getAllTriangles(nTrianglesBufferSize, pTrianglesNeededCount, pTrianglesBuffer);
 }
 
+void CMeshObject::BuildSpatialIndex()
+{
+    getMeshBVH();
+}
+
+bool CMeshObject::HasSpatialIndex()
+{
+    if (m_pNonPersistentMeshEntity.get() != nullptr)
+        return (m_pNonPersistentMeshBVH.get() != nullptr);
+
+    return m_pMeshHandler->hasMeshBVH(m_sMeshUUID);
+}
+
+bool CMeshObject::CastRay(const LibMCEnv_double dOriginX, const LibMCEnv_double dOriginY, const LibMCEnv_double dOriginZ, const LibMCEnv_double dDirectionX, const LibMCEnv_double dDirectionY, const LibMCEnv_double dDirectionZ, LibMCEnv_uint32& nTriangleID, LibMCEnv_double& dDistance)
+{
+    double origin[3] = { dOriginX, dOriginY, dOriginZ };
+    double direction[3] = { dDirectionX, dDirectionY, dDirectionZ };
+
+    for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+        if (!std::isfinite(origin[nAxis]))
+            throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM, "invalid ray origin");
+        if (!std::isfinite(direction[nAxis]))
+            throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDRAYDIRECTION);
+    }
+
+    double dDirectionLength = std::sqrt(dDirectionX * dDirectionX + dDirectionY * dDirectionY + dDirectionZ * dDirectionZ);
+    if (!(dDirectionLength > 0.0) || !std::isfinite(dDirectionLength))
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDRAYDIRECTION);
+
+    return getMeshBVH()->castRay(origin, direction, nTriangleID, dDistance);
+}
+
+void CMeshObject::FindTrianglesInBox(const LibMCEnv_double dMinX, const LibMCEnv_double dMinY, const LibMCEnv_double dMinZ, const LibMCEnv_double dMaxX, const LibMCEnv_double dMaxY, const LibMCEnv_double dMaxZ, LibMCEnv_uint64 nTriangleIDsBufferSize, LibMCEnv_uint64* pTriangleIDsNeededCount, LibMCEnv_uint32* pTriangleIDsBuffer)
+{
+    double boxMin[3] = { dMinX, dMinY, dMinZ };
+    double boxMax[3] = { dMaxX, dMaxY, dMaxZ };
+
+    for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+        if (!std::isfinite(boxMin[nAxis]) || !std::isfinite(boxMax[nAxis]) || (boxMin[nAxis] > boxMax[nAxis]))
+            throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDBOUNDINGBOX);
+    }
+
+    std::vector<uint32_t> triangleIDs;
+    getMeshBVH()->findFacesInBox(boxMin, boxMax, triangleIDs);
+
+    if (pTriangleIDsNeededCount != nullptr)
+        *pTriangleIDsNeededCount = triangleIDs.size();
+
+    if ((pTriangleIDsBuffer != nullptr) && (!triangleIDs.empty())) {
+        if (nTriangleIDsBufferSize < triangleIDs.size())
+            throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+
+        std::copy(triangleIDs.begin(), triangleIDs.end(), pTriangleIDsBuffer);
+    }
+}
+
+bool CMeshObject::FindClosestPoint(const LibMCEnv_double dX, const LibMCEnv_double dY, const LibMCEnv_double dZ, LibMCEnv_uint32& nTriangleID, LibMCEnv_double& dClosestX, LibMCEnv_double& dClosestY, LibMCEnv_double& dClosestZ, LibMCEnv_double& dDistance)
+{
+    double point[3] = { dX, dY, dZ };
+    for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+        if (!std::isfinite(point[nAxis]))
+            throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM, "invalid query point");
+    }
+
+    double closestPoint[3];
+    bool bFound = getMeshBVH()->findClosestPoint(point, nTriangleID, closestPoint, dDistance);
+
+    dClosestX = closestPoint[0];
+    dClosestY = closestPoint[1];
+    dClosestZ = closestPoint[2];
+
+    return bFound;
+}
+
 bool CMeshObject::IsPersistent()
 {
     return (m_pNonPersistentMeshEntity.get() == nullptr);
@@ -185,6 +277,7 @@ IPersistentMeshObject* CMeshObject::MakePersistent(const bool bBoundToLoginSessi
     if (m_pNonPersistentMeshEntity.get() != nullptr) {
         auto pMeshEntityToRegister = m_pNonPersistentMeshEntity;
         m_pNonPersistentMeshEntity = nullptr;
+        m_pNonPersistentMeshBVH = nullptr;
 
         m_pMeshHandler->registerEntity(pMeshEntityToRegister);
 
@@ -62,9 +62,12 @@ private:
     std::string m_sMeshUUID;
 
 	AMC::PMeshEntity m_pNonPersistentMeshEntity;
+	AMC::PMeshBVH m_pNonPersistentMeshBVH;
 
     AMC::PMeshEntity getMeshEntity();
 
+	AMC::PMeshBVH getMeshBVH();
+
 public:
 
     CMeshObject(AMC::PMeshHandler pMeshHandler, const std::string & sMeshUUID);
@@ -106,6 +109,16 @@ public:
 	void GetTriangleIDs(LibMCEnv_uint64 nTriangleIDsBufferSize, LibMCEnv_uint64* pTriangleIDsNeededCount, LibMCEnv_uint32* pTriangleIDsBuffer) override;
 
 	void GetAllTriangles(LibMCEnv_uint64 nTrianglesBufferSize, LibMCEnv_uint64* pTrianglesNeededCount, LibMCEnv::sMeshTriangle3D* pTrianglesBuffer) override;
+
+	void BuildSpatialIndex() override;
+
+	bool HasSpatialIndex() override;
+
+	bool CastRay(const LibMCEnv_double dOriginX, const LibMCEnv_double dOriginY, const LibMCEnv_double dOriginZ, const LibMCEnv_double dDirectionX, const LibMCEnv_double dDirectionY, const LibMCEnv_double dDirectionZ, LibMCEnv_uint32& nTriangleID, LibMCEnv_double& dDistance) override;
+
+	void FindTrianglesInBox(const LibMCEnv_double dMinX, const LibMCEnv_double dMinY, const LibMCEnv_double dMinZ, const LibMCEnv_double dMaxX, const LibMCEnv_double dMaxY, const LibMCEnv_double dMaxZ, LibMCEnv_uint64 nTriangleIDsBufferSize, LibMCEnv_uint64* pTriangleIDsNeededCount, LibMCEnv_uint32* pTriangleIDsBuffer) override;
+
+	bool FindClosestPoint(const LibMCEnv_double dX, const LibMCEnv_double dY, const LibMCEnv_double dZ, LibMCEnv_uint32& nTriangleID, LibMCEnv_double& dClosestX, LibMCEnv_double& dClosestY, LibMCEnv_double& dClosestZ, LibMCEnv_double& dDistance) override;
 	
 	bool IsPersistent() override;
 
@@ -0,0 +1,448 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: zlib based PNG encoder with optional multi-threaded compression
+
+*/
+
+#include "libmcenv_pngencoder.hpp"
+#include "libmcenv_interfaceexception.hpp"
+#include "common_parallelblocks.hpp"
+
+#include "Libraries/zlib/zlib.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+using namespace LibMCEnv::Impl;
+
+static const uint8_t PNGENCODER_SIGNATURE[8] = { 0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A };
+
+#define PNGENCODER_FILTERTYPECOUNT 5
+#define PNGENCODER_FILTERNONE 0
+#define PNGENCODER_FILTERSUB 1
+#define PNGENCODER_FILTERUP 2
+#define PNGENCODER_FILTERAVERAGE 3
+#define PNGENCODER_FILTERPAETH 4
+
+static uint8_t paethPredictor(int32_t nLeft, int32_t nAbove, int32_t nUpperLeft)
+{
+	int32_t nEstimate = nLeft + nAbove - nUpperLeft;
+	int32_t nDistanceLeft = abs(nEstimate - nLeft);
+	int32_t nDistanceAbove = abs(nEstimate - nAbove);
+	int32_t nDistanceUpperLeft = abs(nEstimate - nUpperLeft);
+
+	if ((nDistanceLeft <= nDistanceAbove) && (nDistanceLeft <= nDistanceUpperLeft))
+		return (uint8_t)nLeft;
+	if (nDistanceAbove <= nDistanceUpperLeft)
+		return (uint8_t)nAbove;
+	return (uint8_t)nUpperLeft;
+}
+
+static void applyFilter(uint32_t nFilterType, const uint8_t* pScanline, const uint8_t* pPreviousScanline, uint8_t* pTarget, size_t nScanlineSize, size_t nByteDistance)
+{
+	switch (nFilterType) {
+	case PNGENCODER_FILTERNONE:
+		memcpy(pTarget, pScanline, nScanlineSize);
+		break;
+
+	case PNGENCODER_FILTERSUB:
+		for (size_t nIndex = 0; nIndex < nByteDistance; nIndex++)
+			pTarget[nIndex] = pScanline[nIndex];
+		for (size_t nIndex = nByteDistance; nIndex < nScanlineSize; nIndex++)
+			pTarget[nIndex] = (uint8_t)(pScanline[nIndex] - pScanline[nIndex - nByteDistance]);
+		break;
+
+	case PNGENCODER_FILTERUP:
+		for (size_t nIndex = 0; nIndex < nScanlineSize; nIndex++)
+			pTarget[nIndex] = (uint8_t)(pScanline[nIndex] - pPreviousScanline[nIndex]);
+		break;
+
+	case PNGENCODER_FILTERAVERAGE:
+		for (size_t nIndex = 0; nIndex < nByteDistance; nIndex++)
+			pTarget[nIndex] = (uint8_t)(pScanline[nIndex] - (pPreviousScanline[nIndex] >> 1));
+		for (size_t nIndex = nByteDistance; nIndex < nScanlineSize; nIndex++)
+			pTarget[nIndex] = (uint8_t)(pScanline[nIndex] - (((uint32_t)pScanline[nIndex - nByteDistance] + pPreviousScanline[nIndex]) >> 1));
+		break;
+
+	case PNGENCODER_FILTERPAETH:
+		for (size_t nIndex = 0; nIndex < nByteDistance; nIndex++)
+			pTarget[nIndex] = (uint8_t)(pScanline[nIndex] - pPreviousScanline[nIndex]);
+		for (size_t nIndex = nByteDistance; nIndex < nScanlineSize; nIndex++)
+			pTarget[nIndex] = (uint8_t)(pScanline[nIndex] - paethPredictor(pScanline[nIndex - nByteDistance], pPreviousScanline[nIndex], pPreviousScanline[nIndex - nByteDistance]));
+		break;
+
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPNGFILTERSTRATEGY);
+	}
+}
+
+// Sum of the filtered bytes interpreted as signed values. Lower sums usually compress better.
+static uint64_t sumOfAbsoluteDifferences(const uint8_t* pFilteredData, size_t nSize)
+{
+	uint64_t nSum = 0;
+	for (size_t nIndex = 0; nIndex < nSize; nIndex++)
+		nSum += (uint64_t)abs((int32_t)(int8_t)pFilteredData[nIndex]);
+	return nSum;
+}
+
+
+CPNGEncoder::CPNGEncoder(uint32_t nPixelCountX, uint32_t nPixelCountY, ePNGColorType colorType, uint32_t nBitDepth)
+	: m_nPixelCountX(nPixelCountX),
+	m_nPixelCountY(nPixelCountY),
+	m_ColorType(colorType),
+	m_nBitDepth(nBitDepth),
+	m_nCompressionLevel(6),
+	m_FilterStrategy(LibMCEnv::ePNGFilterStrategy::Adaptive),
+	m_nThreadCount(0)
+{
+	if ((nPixelCountX == 0) || (nPixelCountY == 0) || (nPixelCountX > 0x7fffffff) || (nPixelCountY > 0x7fffffff))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPIXELSIZE);
+
+	bool bValidBitDepth = false;
+	switch (colorType) {
+	case ePNGColorType::pctGreyScale:
+		bValidBitDepth = (nBitDepth == 1) || (nBitDepth == 2) || (nBitDepth == 4) || (nBitDepth == 8);
+		break;
+	case ePNGColorType::pctPalette:
+		bValidBitDepth = (nBitDepth == 1) || (nBitDepth == 2) || (nBitDepth == 4) || (nBitDepth == 8);
+		break;
+	case ePNGColorType::pctRGB:
+	case ePNGColorType::pctRGBA:
+		bValidBitDepth = (nBitDepth == 8);
+		break;
+	}
+
+	if (!bValidBitDepth)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPNGEXPORTFORMAT);
+}
+
+void CPNGEncoder::setCompressionLevel(uint32_t nCompressionLevel)
+{
+	if (nCompressionLevel > Z_BEST_COMPRESSION)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPNGCOMPRESSIONLEVEL);
+
+	m_nCompressionLevel = nCompressionLevel;
+}
+
+void CPNGEncoder::setFilterStrategy(LibMCEnv::ePNGFilterStrategy filterStrategy)
+{
+	m_FilterStrategy = filterStrategy;
+}
+
+void CPNGEncoder::setThreadCount(uint32_t nThreadCount)
+{
+	m_nThreadCount = nThreadCount;
+}
+
+void CPNGEncoder::addPaletteEntry(uint8_t nRed, uint8_t nGreen, uint8_t nBlue)
+{
+	if (m_Palette.size() >= ((size_t)1 << m_nBitDepth))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPNGEXPORTFORMAT);
+
+	m_Palette.push_back({ nRed, nGreen, nBlue });
+}
+
+uint32_t CPNGEncoder::getChannelCount()
+{
+	switch (m_ColorType) {
+	case ePNGColorType::pctRGB: return 3;
+	case ePNGColorType::pctRGBA: return 4;
+	default: return 1;
+	}
+}
+
+uint32_t CPNGEncoder::getFilterByteDistance()
+{
+	return std::max((uint32_t)1, (getChannelCount() * m_nBitDepth) / 8);
+}
+
+size_t CPNGEncoder::getScanlineSize()
+{
+	return ((size_t)m_nPixelCountX * getChannelCount() * m_nBitDepth + 7) / 8;
+}
+
+void CPNGEncoder::filterScanline(const uint8_t* pScanline, const uint8_t* pPreviousScanline, uint8_t* pTarget, std::vector<uint8_t>& candidateBuffer)
+{
+	size_t nScanlineSize = getScanlineSize();
+	size_t nByteDistance = getFilterByteDistance();
+
+	uint32_t nFilterType;
+	switch (m_FilterStrategy) {
+	case LibMCEnv::ePNGFilterStrategy::NoFilter:
+		nFilterType = PNGENCODER_FILTERNONE;
+		break;
+
+	case LibMCEnv::ePNGFilterStrategy::Sub:
+		nFilterType = PNGENCODER_FILTERSUB;
+		break;
+
+	case LibMCEnv::ePNGFilterStrategy::Up:
+		nFilterType = PNGENCODER_FILTERUP;
+		break;
+
+	case LibMCEnv::ePNGFilterStrategy::Adaptive: {
+		// As recommended by the PNG specification, palette and sub-byte images are not filtered.
+		if ((m_ColorType == ePNGColorType::pctPalette) || (m_nBitDepth < 8)) {
+			nFilterType = PNGENCODER_FILTERNONE;
+			break;
+		}
+
+		candidateBuffer.resize(nScanlineSize * PNGENCODER_FILTERTYPECOUNT);
+
+		uint64_t nBestSum = UINT64_MAX;
+		nFilterType = PNGENCODER_FILTERNONE;
+		for (uint32_t nCandidate = 0; nCandidate < PNGENCODER_FILTERTYPECOUNT; nCandidate++) {
+			uint8_t* pCandidate = &candidateBuffer[nCandidate * nScanlineSize];
+			applyFilter(nCandidate, pScanline, pPreviousScanline, pCandidate, nScanlineSize, nByteDistance);
+
+			uint64_t nSum = sumOfAbsoluteDifferences(pCandidate, nScanlineSize);
+			if (nSum < nBestSum) {
+				nBestSum = nSum;
+				nFilterType = nCandidate;
+			}
+
+			// A zero sum can not be improved. This skips the expensive filters for repeated rows.
+			if (nBestSum == 0)
+				break;
+		}
+
+		pTarget[0] = (uint8_t)nFilterType;
+		memcpy(&pTarget[1], &candidateBuffer[nFilterType * nScanlineSize], nScanlineSize);
+		return;
+	}
+
+	default:
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPNGFILTERSTRATEGY);
+	}
+
+	pTarget[0] = (uint8_t)nFilterType;
+	applyFilter(nFilterType, pScanline, pPreviousScanline, &pTarget[1], nScanlineSize, nByteDistance);
+}
+
+void CPNGEncoder::filterScanlines(const uint8_t* pScanlines, uint32_t nFirstRow, uint32_t nRowCount, uint8_t* pTarget, std::vector<uint8_t>& candidateBuffer)
+{
+	size_t nScanlineSize = getScanlineSize();
+
+	// The first scanline is filtered against a row of zeros
+	std::vector<uint8_t> zeroScanline;
+	if (nFirstRow == 0)
+		zeroScanline.resize(nScanlineSize, 0);
+
+	for (uint32_t nRow = nFirstRow; nRow < nFirstRow + nRowCount; nRow++) {
+		const uint8_t* pScanline = &pScanlines[(size_t)nRow * nScanlineSize];
+		const uint8_t* pPreviousScanline = (nRow > 0) ? (pScanline - nScanlineSize) : zeroScanline.data();
+
+		filterScanline(pScanline, pPreviousScanline, &pTarget[(size_t)(nRow - nFirstRow) * (nScanlineSize + 1)], candidateBuffer);
+	}
+}
+
+uint32_t CPNGEncoder::compressStripe(const uint8_t* pScanlines, uint32_t nFirstRow, uint32_t nRowCount, bool bIsLastStripe, std::vector<uint8_t>& compressedData)
+{
+	size_t nFilteredRowSize = getScanlineSize() + 1;
+	std::vector<uint8_t> candidateBuffer;
+	std::vector<uint8_t> filteredData;
+
+	z_stream stream;
+	memset(&stream, 0, sizeof(stream));
+	// Negative window bits create a raw deflate stream without zlib header and checksum
+	if (deflateInit2(&stream, (int)m_nCompressionLevel, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COULDNOTCOMPRESSPNGIMAGE, "could not initialise deflate stream");
+
+	try {
+		// Prime the window with the end of the previous stripe, so that stripes compress almost as well as a single stream.
+		if (nFirstRow > 0) {
+			uint32_t nDictionaryRowCount = (uint32_t)std::min((size_t)nFirstRow, (PNGENCODER_DICTIONARYSIZE + nFilteredRowSize - 1) / nFilteredRowSize);
+			filteredData.resize(nDictionaryRowCount * nFilteredRowSize);
+			filterScanlines(pScanlines, nFirstRow - nDictionaryRowCount, nDictionaryRowCount, filteredData.data(), candidateBuffer);
+
+			size_t nDictionarySize = std::min(filteredData.size(), (size_t)PNGENCODER_DICTIONARYSIZE);
+			if (deflateSetDictionary(&stream, &filteredData[filteredData.size() - nDictionarySize], (uInt)nDictionarySize) != Z_OK)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COULDNOTCOMPRESSPNGIMAGE, "could not set deflate dictionary");
+		}
+
+		uint32_t nRowsPerChunk = (uint32_t)std::max((size_t)1, PNGENCODER_CHUNKSIZE / nFilteredRowSize);
+		filteredData.resize(std::min(nRowsPerChunk, nRowCount) * nFilteredRowSize);
+
+		compressedData.resize((nRowCount * nFilteredRowSize) / 8 + 4096);
+		size_t nCompressedSize = 0;
+
+		uint32_t nAdler32 = (uint32_t)adler32(0, Z_NULL, 0);
+
+		for (uint32_t nChunkRow = 0; nChunkRow < nRowCount; nChunkRow += nRowsPerChunk) {
+			uint32_t nChunkRowCount = std::min(nRowsPerChunk, nRowCount - nChunkRow);
+			size_t nChunkSize = nChunkRowCount * nFilteredRowSize;
+			filterScanlines(pScanlines, nFirstRow + nChunkRow, nChunkRowCount, filteredData.data(), candidateBuffer);
+			nAdler32 = (uint32_t)adler32(nAdler32, filteredData.data(), (uInt)nChunkSize);
+
+			// Stripes that are followed by another stripe end with a sync flush, which aligns the stream to a byte boundary
+			int nFlush = Z_NO_FLUSH;
+			if (nChunkRow + nChunkRowCount >= nRowCount)
+				nFlush = bIsLastStripe ? Z_FINISH : Z_SYNC_FLUSH;
+
+			stream.next_in = filteredData.data();
+			stream.avail_in = (uInt)nChunkSize;
+
+			do {
+				if (nCompressedSize == compressedData.size())
+					compressedData.resize(compressedData.size() * 2);
+
+				size_t nAvailableSize = std::min(compressedData.size() - nCompressedSize, (size_t)UINT32_MAX);
+				stream.next_out = &compressedData[nCompressedSize];
+				stream.avail_out = (uInt)nAvailableSize;
+
+				if (deflate(&stream, nFlush) == Z_STREAM_ERROR)
+					throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COULDNOTCOMPRESSPNGIMAGE, "deflate failed");
+
+				nCompressedSize += nAvailableSize - stream.avail_out;
+			} while (stream.avail_out == 0);
+
+			if (stream.avail_in != 0)
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_COULDNOTCOMPRESSPNGIMAGE, "deflate did not consume all input");
+		}
+
+		compressedData.resize(nCompressedSize);
+		deflateEnd(&stream);
+
+		return nAdler32;
+	}
+	catch (...) {
+		deflateEnd(&stream);
+		throw;
+	}
+}
+
+void CPNGEncoder::writeUInt32(std::vector<uint8_t>& stream, uint32_t nValue)
+{
+	stream.push_back((uint8_t)(nValue >> 24));
+	stream.push_back((uint8_t)(nValue >> 16));
+	stream.push_back((uint8_t)(nValue >> 8));
+	stream.push_back((uint8_t)nValue);
+}
+
+void CPNGEncoder::writeChunk(std::vector<uint8_t>& stream, const char* pChunkType, const uint8_t* pData, size_t nDataSize)
+{
+	writeUInt32(stream, (uint32_t)nDataSize);
+
+	size_t nTypeAddress = stream.size();
+	stream.insert(stream.end(), pChunkType, pChunkType + 4);
+	if (nDataSize > 0)
+		stream.insert(stream.end(), pData, pData + nDataSize);
+
+	// The CRC covers chunk type and chunk data
+	uint32_t nCRC32 = (uint32_t)crc32(0, &stream[nTypeAddress], (uInt)(nDataSize + 4));
+	writeUInt32(stream, nCRC32);
+}
+
+void CPNGEncoder::encode(const uint8_t* pScanlines, std::vector<uint8_t>& pngStream)
+{
+	if (pScanlines == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+	if ((m_ColorType == ePNGColorType::pctPalette) && m_Palette.empty())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPNGEXPORTFORMAT);
+
+	size_t nFilteredRowSize = getScanlineSize() + 1;
+
+	uint32_t nRowsPerStripe = m_nPixelCountY;
+	if (m_nThreadCount != 1)
+		nRowsPerStripe = (uint32_t)std::max((size_t)1, std::min((size_t)m_nPixelCountY, PNGENCODER_STRIPESIZE / nFilteredRowSize));
+	uint32_t nStripeCount = (m_nPixelCountY + nRowsPerStripe - 1) / nRowsPerStripe;
+
+	std::vector<std::vector<uint8_t>> stripeData(nStripeCount);
+	std::vector<uint32_t> stripeAdler32(nStripeCount, 0);
+
+	AMCCommon::CParallelBlocks::processBlocks(m_nThreadCount, nStripeCount, 1, [&](uint32_t nBlockIndex, size_t nFirstStripe, size_t nBlockStripeCount) {
+		for (uint32_t nStripe = (uint32_t)nFirstStripe; nStripe < (uint32_t)(nFirstStripe + nBlockStripeCount); nStripe++) {
+			uint32_t nFirstRow = nStripe * nRowsPerStripe;
+			uint32_t nRowCount = std::min(nRowsPerStripe, m_nPixelCountY - nFirstRow);
+			stripeAdler32[nStripe] = compressStripe(pScanlines, nFirstRow, nRowCount, (nStripe + 1 == nStripeCount), stripeData[nStripe]);
+		}
+	});
+
+	// zlib header for a deflate stream with 32k window, the level hint is the same as zlib would write.
+	uint8_t nCompressionMethod = 0x78;
+	uint8_t nLevelFlags;
+	if (m_nCompressionLevel < 2)
+		nLevelFlags = 0;
+	else if (m_nCompressionLevel < 6)
+		nLevelFlags = 1;
+	else if (m_nCompressionLevel == 6)
+		nLevelFlags = 2;
+	else
+		nLevelFlags = 3;
+	uint8_t nFlags = (uint8_t)(nLevelFlags << 6);
+	nFlags += (uint8_t)(31 - (((uint32_t)nCompressionMethod * 256 + nFlags) % 31));
+
+	uint32_t nAdler32 = stripeAdler32[0];
+	for (uint32_t nStripe = 1; nStripe < nStripeCount; nStripe++) {
+		uint32_t nRowCount = std::min(nRowsPerStripe, m_nPixelCountY - nStripe * nRowsPerStripe);
+		nAdler32 = (uint32_t)adler32_combine(nAdler32, stripeAdler32[nStripe], (z_off_t)(nRowCount * nFilteredRowSize));
+	}
+
+	size_t nZLibStreamSize = 6;
+	for (auto& compressedData : stripeData)
+		nZLibStreamSize += compressedData.size();
+
+	std::vector<uint8_t> zlibStream;
+	zlibStream.reserve(nZLibStreamSize);
+	zlibStream.push_back(nCompressionMethod);
+	zlibStream.push_back(nFlags);
+	for (auto& compressedData : stripeData) {
+		zlibStream.insert(zlibStream.end(), compressedData.begin(), compressedData.end());
+		std::vector<uint8_t>().swap(compressedData);
+	}
+	writeUInt32(zlibStream, nAdler32);
+
+	pngStream.clear();
+	pngStream.reserve(zlibStream.size() + (zlibStream.size() / PNGENCODER_MAXIDATCHUNKSIZE + 1) * 12 + m_Palette.size() * 3 + 64);
+	pngStream.insert(pngStream.end(), std::begin(PNGENCODER_SIGNATURE), std::end(PNGENCODER_SIGNATURE));
+
+	std::vector<uint8_t> headerData;
+	writeUInt32(headerData, m_nPixelCountX);
+	writeUInt32(headerData, m_nPixelCountY);
+	headerData.push_back((uint8_t)m_nBitDepth);
+	headerData.push_back((uint8_t)m_ColorType);
+	headerData.push_back(0); // Compression method deflate
+	headerData.push_back(0); // Filter method adaptive
+	headerData.push_back(0); // No interlacing
+	writeChunk(pngStream, "IHDR", headerData.data(), headerData.size());
+
+	if (m_ColorType == ePNGColorType::pctPalette) {
+		std::vector<uint8_t> paletteData;
+		for (auto& paletteEntry : m_Palette)
+			paletteData.insert(paletteData.end(), paletteEntry.begin(), paletteEntry.end());
+		writeChunk(pngStream, "PLTE", paletteData.data(), paletteData.size());
+	}
+
+	for (size_t nOffset = 0; nOffset < zlibStream.size(); nOffset += PNGENCODER_MAXIDATCHUNKSIZE)
+		writeChunk(pngStream, "IDAT", &zlibStream[nOffset], std::min(zlibStream.size() - nOffset, (size_t)PNGENCODER_MAXIDATCHUNKSIZE));
+
+	writeChunk(pngStream, "IEND", nullptr, 0);
+}
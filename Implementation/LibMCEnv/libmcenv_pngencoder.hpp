@@ -0,0 +1,119 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the Autodesk Inc. nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS' AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: zlib based PNG encoder with optional multi-threaded compression
+
+*/
+
+
+#ifndef __LIBMCENV_PNGENCODER
+#define __LIBMCENV_PNGENCODER
+
+#include "libmcenv_types.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <array>
+
+// Number of filtered scanline bytes that are compressed as one independent stripe.
+#define PNGENCODER_STRIPESIZE (1024 * 1024)
+// Scanline bytes that are filtered and compressed per deflate call.
+#define PNGENCODER_CHUNKSIZE (256 * 1024)
+// Size of the deflate window. Every stripe is primed with this much data of its predecessor.
+#define PNGENCODER_DICTIONARYSIZE 32768
+#define PNGENCODER_MAXIDATCHUNKSIZE (1024 * 1024)
+
+namespace LibMCEnv {
+namespace Impl {
+
+	enum class ePNGColorType : uint8_t {
+		pctGreyScale = 0,
+		pctRGB = 2,
+		pctPalette = 3,
+		pctRGBA = 6
+	};
+
+	// Writes a PNG stream from unfiltered, byte aligned scanlines. The scanlines are filtered and compressed in
+	// stripes of PNGENCODER_STRIPESIZE bytes. Each stripe is a raw deflate stream that ends on a byte boundary,
+	// so the stripes can be compressed on separate threads and concatenated into one zlib stream (as pigz does).
+	// The output only depends on the encoder settings, not on the number of threads, as long as more than one thread is used.
+	class CPNGEncoder {
+	private:
+		uint32_t m_nPixelCountX;
+		uint32_t m_nPixelCountY;
+		ePNGColorType m_ColorType;
+		uint32_t m_nBitDepth;
+
+		uint32_t m_nCompressionLevel;
+		LibMCEnv::ePNGFilterStrategy m_FilterStrategy;
+		uint32_t m_nThreadCount;
+
+		std::vector<std::array<uint8_t, 3>> m_Palette;
+
+		uint32_t getChannelCount();
+
+		// Distance in bytes to the corresponding byte of the previous pixel, as used by the Sub, Average and Paeth filters.
+		uint32_t getFilterByteDistance();
+
+		void filterScanline(const uint8_t* pScanline, const uint8_t* pPreviousScanline, uint8_t* pTarget, std::vector<uint8_t>& candidateBuffer);
+
+		void filterScanlines(const uint8_t* pScanlines, uint32_t nFirstRow, uint32_t nRowCount, uint8_t* pTarget, std::vector<uint8_t>& candidateBuffer);
+
+		// Compresses the rows of a stripe into a raw deflate stream. Returns the adler32 checksum of the filtered rows.
+		uint32_t compressStripe(const uint8_t* pScanlines, uint32_t nFirstRow, uint32_t nRowCount, bool bIsLastStripe, std::vector<uint8_t>& compressedData);
+
+		static void writeUInt32(std::vector<uint8_t>& stream, uint32_t nValue);
+		static void writeChunk(std::vector<uint8_t>& stream, const char* pChunkType, const uint8_t* pData, size_t nDataSize);
+
+	public:
+
+		CPNGEncoder(uint32_t nPixelCountX, uint32_t nPixelCountY, ePNGColorType colorType, uint32_t nBitDepth);
+
+		void setCompressionLevel(uint32_t nCompressionLevel);
+
+		void setFilterStrategy(LibMCEnv::ePNGFilterStrategy filterStrategy);
+
+		// 0 uses the number of hardware threads. 1 compresses the image as one single deflate stream.
+		void setThreadCount(uint32_t nThreadCount);
+
+		void addPaletteEntry(uint8_t nRed, uint8_t nGreen, uint8_t nBlue);
+
+		// Bytes per unfiltered scanline, without the filter type byte.
+		size_t getScanlineSize();
+
+		// pScanlines must contain all rows, getScanlineSize() bytes each. Sub-byte pixels are packed MSB first.
+		void encode(const uint8_t* pScanlines, std::vector<uint8_t>& pngStream);
+
+	};
+
+} // namespace Impl
+} // namespace LibMCEnv
+
+#endif // __LIBMCENV_PNGENCODER
@@ -41,7 +41,11 @@ using namespace LibMCEnv::Impl;
 **************************************************************************************************************************/
 
 CPNGImageStoreOptions::CPNGImageStoreOptions()
-    : m_PNGStorageFormat (LibMCEnv::ePNGStorageFormat::Unknown)
+    : m_PNGStorageFormat (LibMCEnv::ePNGStorageFormat::Unknown),
+    m_nCompressionLevel (PNGIMAGESTOREOPTIONS_DEFAULTCOMPRESSIONLEVEL),
+    m_FilterStrategy (LibMCEnv::ePNGFilterStrategy::Unknown),
+    m_EncoderBackend (LibMCEnv::ePNGEncoderBackend::Unknown),
+    m_nThreadCount (0)
 {
     ResetToDefaults();
     
@@ -55,6 +59,10 @@ CPNGImageStoreOptions::~CPNGImageStoreOptions()
 void CPNGImageStoreOptions::ResetToDefaults()
 {
     m_PNGStorageFormat = LibMCEnv::ePNGStorageFormat::RGB24bit;
+    m_nCompressionLevel = PNGIMAGESTOREOPTIONS_DEFAULTCOMPRESSIONLEVEL;
+    m_FilterStrategy = LibMCEnv::ePNGFilterStrategy::Adaptive;
+    m_EncoderBackend = LibMCEnv::ePNGEncoderBackend::ZLib;
+    m_nThreadCount = 0;
 }
 
 LibMCEnv::ePNGStorageFormat CPNGImageStoreOptions::GetStorageFormat()
@@ -67,3 +75,61 @@ void CPNGImageStoreOptions::SetStorageFormat(const LibMCEnv::ePNGStorageFormat e
     m_PNGStorageFormat = ePNGStorageFormat;
 }
 
+LibMCEnv_uint32 CPNGImageStoreOptions::GetCompressionLevel()
+{
+    return m_nCompressionLevel;
+}
+
+void CPNGImageStoreOptions::SetCompressionLevel(const LibMCEnv_uint32 nCompressionLevel)
+{
+    if (nCompressionLevel > PNGIMAGESTOREOPTIONS_MAXCOMPRESSIONLEVEL)
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPNGCOMPRESSIONLEVEL, "invalid PNG compression level: " + std::to_string(nCompressionLevel));
+
+    m_nCompressionLevel = nCompressionLevel;
+}
+
+LibMCEnv::ePNGFilterStrategy CPNGImageStoreOptions::GetFilterStrategy()
+{
+    return m_FilterStrategy;
+}
+
+void CPNGImageStoreOptions::SetFilterStrategy(const LibMCEnv::ePNGFilterStrategy eFilterStrategy)
+{
+    switch (eFilterStrategy) {
+    case LibMCEnv::ePNGFilterStrategy::NoFilter:
+    case LibMCEnv::ePNGFilterStrategy::Sub:
+    case LibMCEnv::ePNGFilterStrategy::Up:
+    case LibMCEnv::ePNGFilterStrategy::Adaptive:
+        m_FilterStrategy = eFilterStrategy;
+        break;
+    default:
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPNGFILTERSTRATEGY);
+    }
+}
+
+LibMCEnv::ePNGEncoderBackend CPNGImageStoreOptions::GetEncoderBackend()
+{
+    return m_EncoderBackend;
+}
+
+void CPNGImageStoreOptions::SetEncoderBackend(const LibMCEnv::ePNGEncoderBackend eEncoderBackend)
+{
+    switch (eEncoderBackend) {
+    case LibMCEnv::ePNGEncoderBackend::LodePNG:
+    case LibMCEnv::ePNGEncoderBackend::ZLib:
+        m_EncoderBackend = eEncoderBackend;
+        break;
+    default:
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPNGENCODERBACKEND);
+    }
+}
+
+LibMCEnv_uint32 CPNGImageStoreOptions::GetThreadCount()
+{
+    return m_nThreadCount;
+}
+
+void CPNGImageStoreOptions::SetThreadCount(const LibMCEnv_uint32 nThreadCount)
+{
+    m_nThreadCount = nThreadCount;
+}
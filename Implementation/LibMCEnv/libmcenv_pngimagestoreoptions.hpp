@@ -46,6 +46,9 @@ Abstract: This is the class declaration of CPNGImageStoreOptions
 
 // Include custom headers here.
 
+#define PNGIMAGESTOREOPTIONS_DEFAULTCOMPRESSIONLEVEL 6
+#define PNGIMAGESTOREOPTIONS_MAXCOMPRESSIONLEVEL 9
+
 
 namespace LibMCEnv {
 namespace Impl {
@@ -58,6 +61,10 @@ namespace Impl {
 class CPNGImageStoreOptions : public virtual IPNGImageStoreOptions, public virtual CBase {
 private:
     LibMCEnv::ePNGStorageFormat m_PNGStorageFormat;
+    uint32_t m_nCompressionLevel;
+    LibMCEnv::ePNGFilterStrategy m_FilterStrategy;
+    LibMCEnv::ePNGEncoderBackend m_EncoderBackend;
+    uint32_t m_nThreadCount;
 
 public:
 
@@ -71,6 +78,22 @@ public:
 
 	void SetStorageFormat(const LibMCEnv::ePNGStorageFormat ePNGStorageFormat) override;
 
+	LibMCEnv_uint32 GetCompressionLevel() override;
+
+	void SetCompressionLevel(const LibMCEnv_uint32 nCompressionLevel) override;
+
+	LibMCEnv::ePNGFilterStrategy GetFilterStrategy() override;
+
+	void SetFilterStrategy(const LibMCEnv::ePNGFilterStrategy eFilterStrategy) override;
+
+	LibMCEnv::ePNGEncoderBackend GetEncoderBackend() override;
+
+	void SetEncoderBackend(const LibMCEnv::ePNGEncoderBackend eEncoderBackend) override;
+
+	LibMCEnv_uint32 GetThreadCount() override;
+
+	void SetThreadCount(const LibMCEnv_uint32 nThreadCount) override;
+
 };
 
 } // namespace Impl
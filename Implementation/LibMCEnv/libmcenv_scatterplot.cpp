@@ -67,7 +67,7 @@ LibMCEnv_uint32 CScatterPlot::GetPointCount()
 
 void CScatterPlot::GetPointPosition(const LibMCEnv_uint32 nPointIndex, LibMCEnv_double & dX, LibMCEnv_double & dY)
 {
-    auto& entries = m_pScatterplotInstance->getEntries();
+    auto& entries = m_pScatterplotInstance->readEntries();
     if (nPointIndex >= entries.size())
         throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDSCATTERPLOTPOINTINDEX, "Invalid scatter plot point index: " + std::to_string(nPointIndex));
     
@@ -81,6 +81,44 @@ void CScatterPlot::GetBoundaries(LibMCEnv_double & dMinX, LibMCEnv_double & dMin
     m_pScatterplotInstance->getBoundaries(dMinX, dMinY, dMaxX, dMaxY);
 }
 
+void CScatterPlot::QueryDensity(const LibMCEnv_double dMinX, const LibMCEnv_double dMinY, const LibMCEnv_double dMaxX, const LibMCEnv_double dMaxY, const LibMCEnv_uint32 nResolutionX, const LibMCEnv_uint32 nResolutionY, LibMCEnv_uint64 nPositionsBufferSize, LibMCEnv_uint64* pPositionsNeededCount, LibMCEnv::sFloatPosition2D * pPositionsBuffer, LibMCEnv_uint64 nCountsBufferSize, LibMCEnv_uint64* pCountsNeededCount, LibMCEnv_uint32 * pCountsBuffer)
+{
+    if (!(dMinX < dMaxX) || !(dMinY < dMaxY))
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDSCATTERPLOTVIEWPORT);
+    if ((nResolutionX == 0) || (nResolutionY == 0) || (nResolutionX > AMC_SCATTERPLOT_MAXQUERYRESOLUTION) || (nResolutionY > AMC_SCATTERPLOT_MAXQUERYRESOLUTION))
+        throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDSCATTERPLOTRESOLUTION);
+
+    std::vector<AMC::sScatterplotDensityEntry> densityEntries;
+    m_pScatterplotInstance->queryDensity(dMinX, dMinY, dMaxX, dMaxY, nResolutionX, nResolutionY, densityEntries);
+
+    uint64_t nEntryCount = densityEntries.size();
+    if (pPositionsNeededCount != nullptr)
+        *pPositionsNeededCount = nEntryCount;
+    if (pCountsNeededCount != nullptr)
+        *pCountsNeededCount = nEntryCount;
+
+    if (pPositionsBuffer != nullptr) {
+        if (nPositionsBufferSize < nEntryCount)
+            throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+
+        for (auto& entry : densityEntries) {
+            pPositionsBuffer->m_Coordinates[0] = entry.m_fX;
+            pPositionsBuffer->m_Coordinates[1] = entry.m_fY;
+            pPositionsBuffer++;
+        }
+    }
+
+    if (pCountsBuffer != nullptr) {
+        if (nCountsBufferSize < nEntryCount)
+            throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+
+        for (auto& entry : densityEntries) {
+            *pCountsBuffer = (uint32_t)entry.m_fCount;
+            pCountsBuffer++;
+        }
+    }
+}
+
 void CScatterPlot::Release()
 {
     m_pScatterplotInstance->clearData();
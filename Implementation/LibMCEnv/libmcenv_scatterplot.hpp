@@ -75,6 +75,8 @@ public:
 
 	void GetBoundaries(LibMCEnv_double & dMinX, LibMCEnv_double & dMinY, LibMCEnv_double & dMaxX, LibMCEnv_double & dMaxY) override;
 
+	void QueryDensity(const LibMCEnv_double dMinX, const LibMCEnv_double dMinY, const LibMCEnv_double dMaxX, const LibMCEnv_double dMaxY, const LibMCEnv_uint32 nResolutionX, const LibMCEnv_uint32 nResolutionY, LibMCEnv_uint64 nPositionsBufferSize, LibMCEnv_uint64* pPositionsNeededCount, LibMCEnv::sFloatPosition2D * pPositionsBuffer, LibMCEnv_uint64 nCountsBufferSize, LibMCEnv_uint64* pCountsNeededCount, LibMCEnv_uint32 * pCountsBuffer) override;
+
 	void Release() override;
 
 };
@@ -99,11 +99,31 @@ IModelDataComponentInstance * CSceneHandler::Load3MFFromResource(const std::stri
 
 IModelDataComponentInstance * CSceneHandler::Load3MFFromMemory(const LibMCEnv_uint64 nDataBufferSize, const LibMCEnv_uint8 * pDataBuffer)
 {
-	throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_NOTIMPLEMENTED);
+	if ((nDataBufferSize == 0) || (pDataBuffer == nullptr))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+	auto pModel = m_pLib3MFWrapper->CreateModel();
+	auto pReader = pModel->QueryReader("3mf");
+	pReader->ReadFromBuffer(Lib3MF::CInputVector<Lib3MF_uint8>(pDataBuffer, (size_t)nDataBufferSize));
+
+	return new CModelDataComponentInstance(pModel, m_pMeshHandler);
 }
 
 IModelDataComponentInstance * CSceneHandler::Load3MFFromStream(IStreamReader* pReaderInstance)
 {
-	throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_NOTIMPLEMENTED);
+	if (pReaderInstance == nullptr)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+	uint64_t nStreamSize = pReaderInstance->GetSize();
+	if (nStreamSize == 0)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+	std::vector<uint8_t> Buffer;
+	Buffer.resize(nStreamSize);
+
+	uint64_t nNeededCount = 0;
+	pReaderInstance->ReadAllData(Buffer.size(), &nNeededCount, Buffer.data());
+
+	return Load3MFFromMemory(Buffer.size(), Buffer.data());
 }
 
@@ -67,6 +67,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "amc_meshhandler.hpp"
 #include "amc_alerthandler.hpp"
 #include "amc_dataserieshandler.hpp"
+#include "amc_toolpathgenerator.hpp"
 
 #include "common_chrono.hpp"
 #include <thread> 
@@ -236,6 +237,38 @@ void CStateEnvironment::UnloadAllToolpathes()
 	m_pSystemState->toolpathHandler()->unloadAllEntities();
 }
 
+IToolpathAccessor* CStateEnvironment::CreateSyntheticToolpath(const std::string& sName, const LibMCEnv_uint32 nLayerCount, const LibMCEnv_uint32 nSegmentsPerLayer, const LibMCEnv_uint32 nPointsPerSegment, const LibMCEnv_uint32 nProfileCount, const LibMCEnv_uint32 nLaserIndex, const LibMCEnv_uint32 nSeed)
+{
+	if (sName.empty())
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_EMPTYTOOLPATHNAME);
+
+	auto pToolpathHandler = m_pSystemState->getToolpathHandlerInstance();
+
+	AMC::sToolpathGeneratorParameters parameters;
+	parameters.m_nLayerCount = nLayerCount;
+	parameters.m_nSegmentsPerLayer = nSegmentsPerLayer;
+	parameters.m_nPointsPerSegment = nPointsPerSegment;
+	parameters.m_nProfileCount = nProfileCount;
+	parameters.m_nLaserIndex = nLaserIndex;
+	parameters.m_nSeed = nSeed;
+
+	std::string sTemporaryFileName = AMCCommon::CUtils::findTemporaryFileName(m_pSystemState->driverHandler()->getTempBasePath(), "amcf_", ".3mf", 1024);
+
+	std::vector<uint8_t> Buffer;
+	AMC::CToolpathGenerator generator(pToolpathHandler->getLib3MFWrapper());
+	generator.generateToolpath(parameters, sTemporaryFileName, Buffer);
+
+	std::string sUserUUID = AMCCommon::CUtils::createEmptyUUID();
+	auto pStreamWriter = std::make_unique<CTempStreamWriter>(m_pSystemState->getDataModelInstance(), sName, "application/3mf", sUserUUID, m_pSystemState->getGlobalChronoInstance());
+	pStreamWriter->WriteData(Buffer.size(), Buffer.data());
+	pStreamWriter->Finish();
+
+	std::string sStreamUUID = pStreamWriter->GetUUID();
+	pToolpathHandler->loadToolpathEntity(sStreamUUID);
+
+	return new CToolpathAccessor(sStreamUUID, AMCCommon::CUtils::createEmptyUUID(), pToolpathHandler, m_pSystemState->getMeshHandlerInstance());
+}
+
 
 
 void CStateEnvironment::GetDriverLibrary(const std::string& sDriverName, std::string& sDriverType, LibMCEnv_pvoid& pDriverLookup)
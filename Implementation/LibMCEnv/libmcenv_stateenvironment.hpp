@@ -99,6 +99,8 @@ public:
 
 	void UnloadAllToolpathes() override;
 
+	IToolpathAccessor* CreateSyntheticToolpath(const std::string& sName, const LibMCEnv_uint32 nLayerCount, const LibMCEnv_uint32 nSegmentsPerLayer, const LibMCEnv_uint32 nPointsPerSegment, const LibMCEnv_uint32 nProfileCount, const LibMCEnv_uint32 nLaserIndex, const LibMCEnv_uint32 nSeed) override;
+
 	void GetDriverLibrary(const std::string& sDriverName, std::string& sDriverType, LibMCEnv_pvoid& pDriverLookup) override;
 
 	void CreateDriverAccess(const std::string& sDriverName, LibMCEnv_pvoid& pDriverHandle) override;
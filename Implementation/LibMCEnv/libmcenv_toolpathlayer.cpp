@@ -34,6 +34,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "libmcenv_xmldocumentnode.hpp"
 
 #include "amc_toolpathlayerdata.hpp"
+#include "amc_toolpathlayertiletree.hpp"
+#include "amc_toolpathlayerbinaryencoder.hpp"
 #include "amc_parametertype.hpp"
 // Include custom headers here.
 #include "Common/common_utils.hpp"
@@ -474,3 +476,132 @@ void CToolpathLayer::CalculateExtentsInMM(LibMCEnv_double& dMinX, LibMCEnv_doubl
 	dMaxY = nMaxY * dUnits;
 
 }
+
+LibMCEnv_uint32 CToolpathLayer::FindProfileValueID(const std::string& sNamespace, const std::string& sValueName)
+{
+	return m_pToolpathLayerData->findProfileValueID(sNamespace, sValueName);
+}
+
+void CToolpathLayer::ExportSegmentTable(LibMCEnv_uint64 nSegmentTypesBufferSize, LibMCEnv_uint64* pSegmentTypesNeededCount, LibMCEnv_uint32* pSegmentTypesBuffer, LibMCEnv_uint64 nPointOffsetsBufferSize, LibMCEnv_uint64* pPointOffsetsNeededCount, LibMCEnv_uint32* pPointOffsetsBuffer, LibMCEnv_uint64 nLocalPartIDsBufferSize, LibMCEnv_uint64* pLocalPartIDsNeededCount, LibMCEnv_uint32* pLocalPartIDsBuffer, LibMCEnv_uint64 nProfileIDsBufferSize, LibMCEnv_uint64* pProfileIDsNeededCount, LibMCEnv_uint32* pProfileIDsBuffer)
+{
+	uint64_t nSegmentCount = m_pToolpathLayerData->getSegmentCount();
+
+	if (pSegmentTypesNeededCount != nullptr)
+		*pSegmentTypesNeededCount = nSegmentCount;
+	if (pPointOffsetsNeededCount != nullptr)
+		*pPointOffsetsNeededCount = nSegmentCount + 1;
+	if (pLocalPartIDsNeededCount != nullptr)
+		*pLocalPartIDsNeededCount = nSegmentCount;
+	if (pProfileIDsNeededCount != nullptr)
+		*pProfileIDsNeededCount = nSegmentCount;
+
+	if ((pSegmentTypesBuffer != nullptr) && (nSegmentTypesBufferSize < nSegmentCount))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+	if ((pPointOffsetsBuffer != nullptr) && (nPointOffsetsBufferSize < nSegmentCount + 1))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+	if ((pLocalPartIDsBuffer != nullptr) && (nLocalPartIDsBufferSize < nSegmentCount))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+	if ((pProfileIDsBuffer != nullptr) && (nProfileIDsBufferSize < nSegmentCount))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+
+	m_pToolpathLayerData->storeSegmentTable(pSegmentTypesBuffer, pPointOffsetsBuffer, pLocalPartIDsBuffer, pProfileIDsBuffer);
+}
+
+void CToolpathLayer::ExportProfileValueColumns(const LibMCEnv_uint64 nColumnsBufferSize, const LibMCEnv::sToolpathProfileValueColumn* pColumnsBuffer, LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_double* pValuesBuffer)
+{
+	if ((nColumnsBufferSize > 0) && (pColumnsBuffer == nullptr))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+	std::vector<AMC::sToolpathLayerProfileColumn> columns;
+	columns.resize((size_t)nColumnsBufferSize);
+
+	for (size_t nColumnIndex = 0; nColumnIndex < columns.size(); nColumnIndex++) {
+		auto& columnSpec = pColumnsBuffer[nColumnIndex];
+		auto& column = columns.at(nColumnIndex);
+		column.m_dDefaultValue = columnSpec.m_DefaultValue;
+
+		auto eValueType = (LibMCEnv::eToolpathProfileValueType)columnSpec.m_ValueType;
+		if (eValueType == LibMCEnv::eToolpathProfileValueType::Custom) {
+			// Value ID 0 is not contained in any profile and always exports the default.
+			if ((columnSpec.m_ValueID != 0) && !m_pToolpathLayerData->getProfileValueName(columnSpec.m_ValueID, column.m_sNameSpace, column.m_sValueName))
+				throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPROFILEVALUEID, std::to_string(columnSpec.m_ValueID));
+		}
+		else {
+			column.m_sValueName = AMC::CToolpathLayerData::getValueNameByType(eValueType);
+
+			// Same fallback as GetSegmentProfileTypedValue
+			if (eValueType == LibMCEnv::eToolpathProfileValueType::JumpSpeed)
+				column.m_sFallbackValueName = AMC::CToolpathLayerData::getValueNameByType(LibMCEnv::eToolpathProfileValueType::Speed);
+		}
+	}
+
+	uint64_t nNeededValueCount = (uint64_t)m_pToolpathLayerData->getSegmentCount() * columns.size();
+	if (pValuesNeededCount != nullptr)
+		*pValuesNeededCount = nNeededValueCount;
+
+	if (pValuesBuffer != nullptr) {
+		if (nValuesBufferSize < nNeededValueCount)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+
+		m_pToolpathLayerData->storeProfileValueColumns(columns, pValuesBuffer);
+	}
+}
+
+void CToolpathLayer::ExportSegmentIntegerAttributes(const LibMCEnv_uint64 nAttributeIDsBufferSize, const LibMCEnv_uint32* pAttributeIDsBuffer, LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_int64* pValuesBuffer)
+{
+	if ((nAttributeIDsBufferSize > 0) && (pAttributeIDsBuffer == nullptr))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDPARAM);
+
+	uint64_t nNeededValueCount = (uint64_t)m_pToolpathLayerData->getSegmentCount() * nAttributeIDsBufferSize;
+	if (pValuesNeededCount != nullptr)
+		*pValuesNeededCount = nNeededValueCount;
+
+	if (pValuesBuffer != nullptr) {
+		if (nValuesBufferSize < nNeededValueCount)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+
+		m_pToolpathLayerData->storeIntegerAttributeColumns(pAttributeIDsBuffer, (size_t)nAttributeIDsBufferSize, pValuesBuffer);
+	}
+}
+
+void CToolpathLayer::ExportPointData(LibMCEnv_uint64 nPointDataBufferSize, LibMCEnv_uint64* pPointDataNeededCount, LibMCEnv::sPosition2D* pPointDataBuffer)
+{
+	uint64_t nNeededPointCount = m_pToolpathLayerData->getTotalPointCount();
+	if (pPointDataNeededCount != nullptr)
+		*pPointDataNeededCount = nNeededPointCount;
+
+	if (pPointDataBuffer != nullptr) {
+		if (nPointDataBufferSize < nNeededPointCount)
+			throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_BUFFERTOOSMALL);
+
+		m_pToolpathLayerData->storeAllPointsToBufferInUnits(pPointDataBuffer);
+	}
+}
+
+void CToolpathLayer::EncodeBinaryTiles(const LibMCEnv_double dResolutionInMM, LibMCEnv_uint64& nEncodedSize, LibMCEnv_uint32& nTileCount, LibMCEnv_uint64& nPointCount, LibMCEnv_uint64& nTreeBuildTimeInMicroseconds, LibMCEnv_uint64& nEncodingTimeInMicroseconds)
+{
+	if ((dResolutionInMM < 0.0) || (dResolutionInMM > AMC_TOOLPATHBINARY_MAXRESOLUTION))
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_INVALIDTOOLPATHRESOLUTION);
+
+	AMC::CToolpathLayerTileTree tileTree(m_pToolpathLayerData.get());
+
+	int32_t nMinX, nMinY, nMaxX, nMaxY;
+	tileTree.getExtents(nMinX, nMinY, nMaxX, nMaxY);
+
+	double dUnits = tileTree.getUnits();
+	if (dUnits <= 0.0)
+		throw ELibMCEnvInterfaceException(LIBMCENV_ERROR_UNITSAREOUTOFRANGE);
+
+	int32_t nResolutionInUnits = (int32_t)(dResolutionInMM / dUnits);
+
+	// The layer does not know its index within the toolpath, so the header carries layer index 0.
+	std::vector<uint8_t> buffer;
+	auto info = AMC::CToolpathLayerBinaryEncoder::encodeLayer(&tileTree, 0, nMinX, nMinY, nMaxX, nMaxY, nResolutionInUnits, true, buffer);
+
+	nEncodedSize = buffer.size();
+	nTileCount = info.m_nTileCount;
+	nPointCount = info.m_nPointCount;
+	nTreeBuildTimeInMicroseconds = tileTree.getBuildTimeInMicroseconds();
+	nEncodingTimeInMicroseconds = info.m_nEncodingTimeInMicroseconds;
+}
+
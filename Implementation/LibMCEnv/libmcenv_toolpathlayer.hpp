@@ -157,6 +157,18 @@ public:
 
 	void CalculateExtentsInMM(LibMCEnv_double& dMinX, LibMCEnv_double& dMinY, LibMCEnv_double& dMaxX, LibMCEnv_double& dMaxY) override;
 
+	LibMCEnv_uint32 FindProfileValueID(const std::string& sNamespace, const std::string& sValueName) override;
+
+	void ExportSegmentTable(LibMCEnv_uint64 nSegmentTypesBufferSize, LibMCEnv_uint64* pSegmentTypesNeededCount, LibMCEnv_uint32* pSegmentTypesBuffer, LibMCEnv_uint64 nPointOffsetsBufferSize, LibMCEnv_uint64* pPointOffsetsNeededCount, LibMCEnv_uint32* pPointOffsetsBuffer, LibMCEnv_uint64 nLocalPartIDsBufferSize, LibMCEnv_uint64* pLocalPartIDsNeededCount, LibMCEnv_uint32* pLocalPartIDsBuffer, LibMCEnv_uint64 nProfileIDsBufferSize, LibMCEnv_uint64* pProfileIDsNeededCount, LibMCEnv_uint32* pProfileIDsBuffer) override;
+
+	void ExportProfileValueColumns(const LibMCEnv_uint64 nColumnsBufferSize, const LibMCEnv::sToolpathProfileValueColumn* pColumnsBuffer, LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_double* pValuesBuffer) override;
+
+	void ExportSegmentIntegerAttributes(const LibMCEnv_uint64 nAttributeIDsBufferSize, const LibMCEnv_uint32* pAttributeIDsBuffer, LibMCEnv_uint64 nValuesBufferSize, LibMCEnv_uint64* pValuesNeededCount, LibMCEnv_int64* pValuesBuffer) override;
+
+	void ExportPointData(LibMCEnv_uint64 nPointDataBufferSize, LibMCEnv_uint64* pPointDataNeededCount, LibMCEnv::sPosition2D* pPointDataBuffer) override;
+
+	void EncodeBinaryTiles(const LibMCEnv_double dResolutionInMM, LibMCEnv_uint64 & nEncodedSize, LibMCEnv_uint32 & nTileCount, LibMCEnv_uint64 & nPointCount, LibMCEnv_uint64 & nTreeBuildTimeInMicroseconds, LibMCEnv_uint64 & nEncodingTimeInMicroseconds) override;
+
 };
 
 } // namespace Impl
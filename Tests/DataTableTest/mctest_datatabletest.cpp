@@ -0,0 +1,1062 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "libmcplugin_impl.hpp"
+
+using namespace LibMCPlugin::Impl;
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+
+/*************************************************************************************************************************
+ Import functionality for Driver into current plugin
+**************************************************************************************************************************/
+__NODRIVERIMPORT
+
+
+#define DATATABLETEST_ROWCOUNT 200000
+#define DATATABLETEST_MIMETYPE "application/amcf-datatable"
+
+// The spatial index of a scatter plot has at most this many cells per axis.
+#define DATATABLETEST_MAXINDEXGRIDSIZE 1024
+
+/*************************************************************************************************************************
+ Helper functions
+**************************************************************************************************************************/
+template <typename T> static void compareValues(const std::vector<T>& actual, const std::vector<T>& expected, const std::string& sContext)
+{
+	if (actual.size() != expected.size())
+		throw std::runtime_error(sContext + ": row count mismatch (" + std::to_string(actual.size()) + " != " + std::to_string(expected.size()) + ")");
+
+	// Bitwise comparison, so that NaN and negative zero have to survive the round trip as well
+	for (size_t nIndex = 0; nIndex < actual.size(); nIndex++) {
+		if (memcmp(&actual[nIndex], &expected[nIndex], sizeof(T)) != 0)
+			throw std::runtime_error(sContext + ": value mismatch in row " + std::to_string(nIndex));
+	}
+}
+
+// Typical columns of a scanner recording: a timestamp with jitter, slowly moving positions, a laser power that changes
+// rarely, an integer valued sample counter, signed sensor values and raw noise that does not compress at all.
+struct sTestColumns {
+	std::vector<uint64_t> m_Timestamps;
+	std::vector<double> m_Positions;
+	std::vector<double> m_Power;
+	std::vector<double> m_Counter;
+	std::vector<int32_t> m_Sensor;
+	std::vector<int64_t> m_Offsets;
+	std::vector<uint32_t> m_Status;
+	std::vector<double> m_Noise;
+};
+
+static void createTestColumns(sTestColumns& columns, size_t nRowCount)
+{
+	uint32_t nState = 12345;
+	auto nextRandom = [&nState]() {
+		nState = nState * 1664525 + 1013904223;
+		return nState >> 8;
+	};
+
+	double dPosition = 0.0;
+	for (size_t nIndex = 0; nIndex < nRowCount; nIndex++) {
+		columns.m_Timestamps.push_back(1700000000000000ULL + nIndex * 10 + ((nextRandom() % 7) == 0 ? 1 : 0));
+
+		dPosition += 0.001 * std::sin((double)nIndex * 1.0E-4);
+		columns.m_Positions.push_back(std::round(dPosition * 1000.0) / 1000.0);
+
+		columns.m_Power.push_back((nIndex < nRowCount / 2) ? 350.0 : 200.0);
+		columns.m_Counter.push_back((double)(nIndex / 3));
+		columns.m_Sensor.push_back((int32_t)(1000.0 * std::sin((double)nIndex * 0.001)) + (int32_t)(nextRandom() % 5) - 2);
+		columns.m_Offsets.push_back(-(int64_t)nIndex * 1000000007LL);
+		columns.m_Status.push_back((nIndex % 1000 == 999) ? 2 : 1);
+		columns.m_Noise.push_back((double)nextRandom() / 16777216.0 - 0.5);
+	}
+
+	// Values that only survive a bitwise exact encoding
+	if (nRowCount >= 4) {
+		columns.m_Noise.at(0) = -0.0;
+		columns.m_Noise.at(1) = std::nan("");
+		columns.m_Noise.at(2) = INFINITY;
+		columns.m_Counter.at(nRowCount - 1) = -0.0;
+	}
+}
+
+static void fillTestTable(LibMCEnv::PDataTable pDataTable, const sTestColumns& columns)
+{
+	pDataTable->AddColumn("timestamp", "Timestamp in microseconds", LibMCEnv::eDataTableColumnType::Uint64Column);
+	pDataTable->AddColumn("position", "Position in mm", LibMCEnv::eDataTableColumnType::DoubleColumn);
+	pDataTable->AddColumn("power", "Laser power in W", LibMCEnv::eDataTableColumnType::DoubleColumn);
+	pDataTable->AddColumn("counter", "Sample counter", LibMCEnv::eDataTableColumnType::DoubleColumn);
+	pDataTable->AddColumn("sensor", "Sensor value", LibMCEnv::eDataTableColumnType::Int32Column);
+	pDataTable->AddColumn("offset", "Offset", LibMCEnv::eDataTableColumnType::Int64Column);
+	pDataTable->AddColumn("status", "Status", LibMCEnv::eDataTableColumnType::Uint32Column);
+	pDataTable->AddColumn("noise", "Noise", LibMCEnv::eDataTableColumnType::DoubleColumn);
+	pDataTable->AddColumn("empty", "Column without rows", LibMCEnv::eDataTableColumnType::DoubleColumn);
+
+	pDataTable->SetUint64ColumnValues("timestamp", columns.m_Timestamps);
+	pDataTable->SetDoubleColumnValues("position", columns.m_Positions);
+	pDataTable->SetDoubleColumnValues("power", columns.m_Power);
+	pDataTable->SetDoubleColumnValues("counter", columns.m_Counter);
+	pDataTable->SetInt32ColumnValues("sensor", columns.m_Sensor);
+	pDataTable->SetInt64ColumnValues("offset", columns.m_Offsets);
+	pDataTable->SetUint32ColumnValues("status", columns.m_Status);
+	pDataTable->SetDoubleColumnValues("noise", columns.m_Noise);
+}
+
+static void compareTestTable(LibMCEnv::PDataTable pDataTable, const sTestColumns& columns, const std::string& sContext)
+{
+	if (pDataTable->GetColumnCount() != 9)
+		throw std::runtime_error(sContext + ": column count mismatch");
+
+	std::string sDescription;
+	LibMCEnv::eDataTableColumnType columnType;
+	pDataTable->GetColumnInformation("sensor", sDescription, columnType);
+	if ((sDescription != "Sensor value") || (columnType != LibMCEnv::eDataTableColumnType::Int32Column))
+		throw std::runtime_error(sContext + ": column information mismatch");
+
+	std::vector<uint64_t> uint64Values;
+	std::vector<int64_t> int64Values;
+	std::vector<uint32_t> uint32Values;
+	std::vector<int32_t> int32Values;
+	std::vector<double> doubleValues;
+
+	pDataTable->GetUint64ColumnValues("timestamp", uint64Values);
+	compareValues(uint64Values, columns.m_Timestamps, sContext + " timestamp");
+	pDataTable->GetDoubleColumnValues("position", doubleValues);
+	compareValues(doubleValues, columns.m_Positions, sContext + " position");
+	pDataTable->GetDoubleColumnValues("power", doubleValues);
+	compareValues(doubleValues, columns.m_Power, sContext + " power");
+	pDataTable->GetDoubleColumnValues("counter", doubleValues);
+	compareValues(doubleValues, columns.m_Counter, sContext + " counter");
+	pDataTable->GetInt32ColumnValues("sensor", int32Values);
+	compareValues(int32Values, columns.m_Sensor, sContext + " sensor");
+	pDataTable->GetInt64ColumnValues("offset", int64Values);
+	compareValues(int64Values, columns.m_Offsets, sContext + " offset");
+	pDataTable->GetUint32ColumnValues("status", uint32Values);
+	compareValues(uint32Values, columns.m_Status, sContext + " status");
+	pDataTable->GetDoubleColumnValues("noise", doubleValues);
+	compareValues(doubleValues, columns.m_Noise, sContext + " noise");
+}
+
+// Writes the table with the given options, loads it into a new table and returns the stream size.
+static uint64_t writeAndReload(LibMCEnv::PStateEnvironment pStateEnvironment, LibMCEnv::PDataTable pDataTable, LibMCEnv::PDataTableWriteOptions pOptions, LibMCEnv::PDataTable & pLoadedTable)
+{
+	auto pWriter = pStateEnvironment->CreateTemporaryStream("datatabletest", DATATABLETEST_MIMETYPE);
+	pDataTable->WriteDataToStream(pWriter, pOptions);
+	uint64_t nStreamSize = pWriter->GetSize();
+
+	auto pReader = pWriter->GetStreamReader();
+	pLoadedTable = pStateEnvironment->CreateDataTable();
+	pLoadedTable->LoadFromStream(pReader);
+
+	return nStreamSize;
+}
+
+
+// Points of a melt pool recording: three dense clusters on a sparse uniform background.
+static void createScatterPlotPoints(std::vector<double>& xValues, std::vector<double>& yValues, size_t nPointCount)
+{
+	uint32_t nState = 54321;
+	auto nextUniform = [&nState]() {
+		nState = nState * 1664525 + 1013904223;
+		return ((double)(nState >> 8) + 0.5) / 16777216.0;
+	};
+
+	const double clusterCenters[3][2] = { { 40.0, 30.0 }, { 120.0, 90.0 }, { 200.0, 60.0 } };
+	const double clusterSigmas[3] = { 2.0, 8.0, 0.5 };
+
+	for (size_t nIndex = 0; nIndex < nPointCount; nIndex++) {
+		uint32_t nCluster = (uint32_t)(nIndex % 4);
+		if (nCluster < 3) {
+			// Box-Muller transform
+			double dRadius = std::sqrt(-2.0 * std::log(nextUniform())) * clusterSigmas[nCluster];
+			double dAngle = 6.283185307179586 * nextUniform();
+			xValues.push_back(clusterCenters[nCluster][0] + dRadius * std::cos(dAngle));
+			yValues.push_back(clusterCenters[nCluster][1] + dRadius * std::sin(dAngle));
+		}
+		else {
+			xValues.push_back(250.0 * nextUniform());
+			yValues.push_back(150.0 * nextUniform());
+		}
+	}
+}
+
+static uint32_t getDensityBinIndex(double dValue, double dMin, double dBinSize, uint32_t nResolution)
+{
+	return std::min<uint32_t>((uint32_t)((dValue - dMin) / dBinSize), nResolution - 1);
+}
+
+
+/*************************************************************************************************************************
+ Class definition of CTestData
+**************************************************************************************************************************/
+class CTestData : public virtual CPluginData {
+protected:
+
+public:
+
+};
+
+/*************************************************************************************************************************
+ Class definition of CTestState
+**************************************************************************************************************************/
+typedef CState<CTestData> CTestState;
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Init
+**************************************************************************************************************************/
+class CTestState_Init : public virtual CTestState {
+public:
+
+	CTestState_Init(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "init";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		pStateEnvironment->SetNextState("encoding");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Encoding
+**************************************************************************************************************************/
+class CTestState_Encoding : public virtual CTestState {
+public:
+
+	CTestState_Encoding(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "encoding";
+	}
+
+	static void checkOptions(LibMCEnv::PDataTableWriteOptions pOptions)
+	{
+		if ((pOptions->GetDefaultEncoding() != LibMCEnv::eDataTableColumnEncoding::Raw) || (pOptions->GetCompression() != LibMCEnv::eDataTableCompression::NoCompression) || (pOptions->GetCompressionLevel() != 6))
+			throw std::runtime_error("unexpected default write options");
+
+		pOptions->SetDefaultEncoding(LibMCEnv::eDataTableColumnEncoding::XOR);
+		pOptions->SetColumnEncoding("timestamp", LibMCEnv::eDataTableColumnEncoding::Delta);
+		if ((pOptions->GetColumnEncoding("timestamp") != LibMCEnv::eDataTableColumnEncoding::Delta) || (pOptions->GetColumnEncoding("position") != LibMCEnv::eDataTableColumnEncoding::XOR))
+			throw std::runtime_error("column encoding does not fall back to default encoding");
+
+		pOptions->ClearColumnEncodings();
+		if (pOptions->GetColumnEncoding("timestamp") != LibMCEnv::eDataTableColumnEncoding::XOR)
+			throw std::runtime_error("column encodings have not been cleared");
+
+		bool bInvalidLevelFailed = false;
+		try {
+			pOptions->SetCompressionLevel(10);
+		}
+		catch (LibMCEnv::ELibMCEnvException & Exception) {
+			bInvalidLevelFailed = (Exception.getErrorCode() == LIBMCENV_ERROR_INVALIDDATATABLECOMPRESSIONLEVEL);
+		}
+		if (!bInvalidLevelFailed)
+			throw std::runtime_error("invalid compression level has been accepted");
+
+		pOptions->ResetToDefaults();
+		if (pOptions->GetDefaultEncoding() != LibMCEnv::eDataTableColumnEncoding::Raw)
+			throw std::runtime_error("options have not been reset");
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		sTestColumns columns;
+		createTestColumns(columns, DATATABLETEST_ROWCOUNT);
+
+		auto pDataTable = pStateEnvironment->CreateDataTable();
+		fillTestTable(pDataTable, columns);
+
+		checkOptions(pDataTable->CreateWriteOptions());
+
+		LibMCEnv::PDataTable pLoadedTable;
+		uint64_t nRawSize = writeAndReload(pStateEnvironment, pDataTable, pDataTable->CreateWriteOptions(), pLoadedTable);
+		compareTestTable(pLoadedTable, columns, "raw");
+		pStateEnvironment->LogMessage("Raw data table stream: " + std::to_string(nRawSize) + " bytes");
+
+		struct sEncodingCase {
+			std::string m_sName;
+			LibMCEnv::eDataTableColumnEncoding m_Encoding;
+			LibMCEnv::eDataTableCompression m_Compression;
+			uint32_t m_nCompressionLevel;
+		};
+
+		std::vector<sEncodingCase> encodingCases = {
+			{ "delta", LibMCEnv::eDataTableColumnEncoding::Delta, LibMCEnv::eDataTableCompression::NoCompression, 6 },
+			{ "delta of delta", LibMCEnv::eDataTableColumnEncoding::DeltaOfDelta, LibMCEnv::eDataTableCompression::NoCompression, 6 },
+			{ "run length", LibMCEnv::eDataTableColumnEncoding::RunLength, LibMCEnv::eDataTableCompression::NoCompression, 6 },
+			{ "xor", LibMCEnv::eDataTableColumnEncoding::XOR, LibMCEnv::eDataTableCompression::NoCompression, 6 },
+			{ "automatic", LibMCEnv::eDataTableColumnEncoding::Automatic, LibMCEnv::eDataTableCompression::NoCompression, 6 },
+			{ "raw + zlib", LibMCEnv::eDataTableColumnEncoding::Raw, LibMCEnv::eDataTableCompression::ZLib, 6 },
+			{ "automatic + zlib", LibMCEnv::eDataTableColumnEncoding::Automatic, LibMCEnv::eDataTableCompression::ZLib, 6 },
+			{ "raw + lz4", LibMCEnv::eDataTableColumnEncoding::Raw, LibMCEnv::eDataTableCompression::LZ4, 1 },
+			{ "automatic + lz4", LibMCEnv::eDataTableColumnEncoding::Automatic, LibMCEnv::eDataTableCompression::LZ4, 1 },
+			{ "automatic + lz4 hc", LibMCEnv::eDataTableColumnEncoding::Automatic, LibMCEnv::eDataTableCompression::LZ4, 9 }
+		};
+
+		for (auto& encodingCase : encodingCases) {
+			auto pOptions = pDataTable->CreateWriteOptions();
+			pOptions->SetDefaultEncoding(encodingCase.m_Encoding);
+			pOptions->SetCompression(encodingCase.m_Compression);
+			pOptions->SetCompressionLevel(encodingCase.m_nCompressionLevel);
+
+			uint64_t nStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+			uint64_t nStreamSize = writeAndReload(pStateEnvironment, pDataTable, pOptions, pLoadedTable);
+			uint64_t nDuration = pStateEnvironment->GetGlobalTimerInMicroseconds() - nStartTime;
+
+			compareTestTable(pLoadedTable, columns, encodingCase.m_sName);
+
+			pStateEnvironment->LogMessage("Data table stream (" + encodingCase.m_sName + "): " + std::to_string(nStreamSize) + " bytes (" +
+				std::to_string(nStreamSize * 100 / nRawSize) + "% of raw), write and load " + std::to_string(nDuration / 1000) + "ms");
+		}
+
+		// Column specific encodings on top of a default
+		auto pMixedOptions = pDataTable->CreateWriteOptions();
+		pMixedOptions->SetDefaultEncoding(LibMCEnv::eDataTableColumnEncoding::XOR);
+		pMixedOptions->SetColumnEncoding("timestamp", LibMCEnv::eDataTableColumnEncoding::DeltaOfDelta);
+		pMixedOptions->SetColumnEncoding("power", LibMCEnv::eDataTableColumnEncoding::RunLength);
+		pMixedOptions->SetColumnEncoding("noise", LibMCEnv::eDataTableColumnEncoding::Raw);
+		pMixedOptions->SetColumnEncoding("doesnotexist", LibMCEnv::eDataTableColumnEncoding::Delta);
+		pMixedOptions->SetCompression(LibMCEnv::eDataTableCompression::ZLib);
+		pMixedOptions->SetCompressionLevel(1);
+		uint64_t nMixedSize = writeAndReload(pStateEnvironment, pDataTable, pMixedOptions, pLoadedTable);
+		compareTestTable(pLoadedTable, columns, "mixed");
+		pStateEnvironment->LogMessage("Data table stream (mixed): " + std::to_string(nMixedSize) + " bytes");
+
+		// Tables without rows and without columns
+		auto pEmptyTable = pStateEnvironment->CreateDataTable();
+		auto pEmptyOptions = pEmptyTable->CreateWriteOptions();
+		pEmptyOptions->SetDefaultEncoding(LibMCEnv::eDataTableColumnEncoding::Automatic);
+		pEmptyOptions->SetCompression(LibMCEnv::eDataTableCompression::ZLib);
+		writeAndReload(pStateEnvironment, pEmptyTable, pEmptyOptions, pLoadedTable);
+		if (pLoadedTable->GetColumnCount() != 0)
+			throw std::runtime_error("empty table has columns after reload");
+
+		pEmptyTable->AddColumn("empty", "", LibMCEnv::eDataTableColumnType::Int64Column);
+		writeAndReload(pStateEnvironment, pEmptyTable, pEmptyOptions, pLoadedTable);
+		if ((pLoadedTable->GetColumnCount() != 1) || (pLoadedTable->GetRowCount() != 0))
+			throw std::runtime_error("table without rows does not reload");
+
+		pStateEnvironment->SetNextState("query");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Query
+**************************************************************************************************************************/
+class CTestState_Query : public virtual CTestState {
+public:
+
+	CTestState_Query(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "query";
+	}
+
+	static void checkFilter(LibMCEnv::PDataTable pDataTable, const sTestColumns& columns)
+	{
+		auto pFilter = pDataTable->CreateFilter();
+		pFilter->AddCondition("power", LibMCEnv::eDataTableFilterOperator::Equal, 350.0, 0.0);
+		pFilter->AddCondition("status", LibMCEnv::eDataTableFilterOperator::NotEqual, 2.0, 0.0);
+		pFilter->AddCondition("sensor", LibMCEnv::eDataTableFilterOperator::InRange, -500.5, 500.0);
+
+		std::vector<uint32_t> expectedRows;
+		for (size_t nIndex = 0; nIndex < columns.m_Power.size(); nIndex++) {
+			if ((columns.m_Power[nIndex] == 350.0) && (columns.m_Status[nIndex] != 2) && (columns.m_Sensor[nIndex] >= -500) && (columns.m_Sensor[nIndex] <= 500))
+				expectedRows.push_back((uint32_t)nIndex);
+		}
+
+		std::vector<uint32_t> rowIndices;
+		pDataTable->FindRows(pFilter, rowIndices);
+		compareValues(rowIndices, expectedRows, "filter");
+
+		auto pFilteredTable = pDataTable->FilterRows(pFilter);
+		if ((pFilteredTable->GetRowCount() != expectedRows.size()) || (pFilteredTable->GetColumnCount() != pDataTable->GetColumnCount()))
+			throw std::runtime_error("filtered table has wrong size");
+
+		std::vector<uint64_t> timestamps;
+		pFilteredTable->GetUint64ColumnValues("timestamp", timestamps);
+		for (size_t nIndex = 0; nIndex < expectedRows.size(); nIndex++) {
+			if (timestamps[nIndex] != columns.m_Timestamps[expectedRows[nIndex]])
+				throw std::runtime_error("filtered table has wrong values");
+		}
+
+		// Integer columns compare exactly against thresholds that are not integers
+		pFilter->Clear();
+		pFilter->AddCondition("offset", LibMCEnv::eDataTableFilterOperator::Greater, -1000000007.5, 0.0);
+		pDataTable->FindRows(pFilter, rowIndices);
+		if ((rowIndices.size() != 2) || (rowIndices[0] != 0) || (rowIndices[1] != 1))
+			throw std::runtime_error("integer filter mismatch");
+	}
+
+	static void checkSort(LibMCEnv::PDataTable pDataTable, const sTestColumns& columns)
+	{
+		auto pSortOptions = pDataTable->CreateSortOptions();
+		pSortOptions->AddSortColumn("sensor", true);
+		pSortOptions->AddSortColumn("timestamp", false);
+
+		std::vector<uint32_t> expectedRows(columns.m_Sensor.size());
+		for (size_t nIndex = 0; nIndex < expectedRows.size(); nIndex++)
+			expectedRows[nIndex] = (uint32_t)nIndex;
+		std::stable_sort(expectedRows.begin(), expectedRows.end(), [&columns](uint32_t nRow1, uint32_t nRow2) {
+			return columns.m_Sensor[nRow1] > columns.m_Sensor[nRow2];
+		});
+
+		std::vector<uint32_t> rowIndices;
+		pDataTable->GetSortedRowIndices(pSortOptions, rowIndices);
+		compareValues(rowIndices, expectedRows, "sort");
+
+		auto pSortedTable = pDataTable->SortRows(pSortOptions);
+		std::vector<int32_t> sensorValues;
+		pSortedTable->GetInt32ColumnValues("sensor", sensorValues);
+		if (!std::is_sorted(sensorValues.begin(), sensorValues.end(), [](int32_t nValue1, int32_t nValue2) { return nValue1 > nValue2; }))
+			throw std::runtime_error("sorted table is not sorted");
+
+		// Results must not depend on the thread count
+		uint32_t nThreadCount = pDataTable->GetThreadCount();
+		pDataTable->SetThreadCount(1);
+		std::vector<uint32_t> singleThreadedRowIndices;
+		pDataTable->GetSortedRowIndices(pSortOptions, singleThreadedRowIndices);
+		pDataTable->SetThreadCount(nThreadCount);
+		compareValues(singleThreadedRowIndices, rowIndices, "single threaded sort");
+
+		auto pSelectedTable = pDataTable->SelectRows(rowIndices);
+		std::vector<int32_t> selectedSensorValues;
+		pSelectedTable->GetInt32ColumnValues("sensor", selectedSensorValues);
+		compareValues(selectedSensorValues, sensorValues, "select rows");
+	}
+
+	static void checkAggregation(LibMCEnv::PDataTable pDataTable, const sTestColumns& columns)
+	{
+		auto pAggregationOptions = pDataTable->CreateAggregationOptions();
+		pAggregationOptions->AddGroupColumn("status");
+		pAggregationOptions->AddGroupColumn("power");
+		pAggregationOptions->AddAggregation("rows", "timestamp", LibMCEnv::eDataTableAggregation::Count);
+		pAggregationOptions->AddAggregation("maxsensor", "sensor", LibMCEnv::eDataTableAggregation::Maximum);
+		pAggregationOptions->AddAggregation("meanstatus", "status", LibMCEnv::eDataTableAggregation::Mean);
+
+		auto pResultTable = pDataTable->Aggregate(pAggregationOptions);
+		if ((pResultTable->GetRowCount() != 4) || (pResultTable->GetColumnCount() != 5))
+			throw std::runtime_error("unexpected aggregation result size");
+
+		// Groups are sorted ascending by status and then power
+		std::vector<uint32_t> statusValues;
+		std::vector<double> powerValues;
+		std::vector<uint64_t> rowCounts;
+		std::vector<double> meanStatusValues;
+		pResultTable->GetUint32ColumnValues("status", statusValues);
+		pResultTable->GetDoubleColumnValues("power", powerValues);
+		pResultTable->GetUint64ColumnValues("rows", rowCounts);
+		pResultTable->GetDoubleColumnValues("meanstatus", meanStatusValues);
+
+		uint64_t nTotalRowCount = 0;
+		for (size_t nGroupIndex = 0; nGroupIndex < 4; nGroupIndex++) {
+			uint32_t nExpectedStatus = (nGroupIndex < 2) ? 1 : 2;
+			double dExpectedPower = (nGroupIndex % 2 == 0) ? 200.0 : 350.0;
+			if ((statusValues[nGroupIndex] != nExpectedStatus) || (powerValues[nGroupIndex] != dExpectedPower) || (meanStatusValues[nGroupIndex] != (double)nExpectedStatus))
+				throw std::runtime_error("unexpected aggregation group " + std::to_string(nGroupIndex));
+			nTotalRowCount += rowCounts[nGroupIndex];
+		}
+
+		if (nTotalRowCount != columns.m_Status.size())
+			throw std::runtime_error("aggregation groups do not cover the table");
+	}
+
+	static void checkWindowStatistics(LibMCEnv::PDataTable pDataTable, const sTestColumns& columns)
+	{
+		const uint32_t nWindowSize = 100;
+		pDataTable->AddWindowStatisticColumn("position", "meanposition", "Mean position", LibMCEnv::eDataTableWindowStatistic::Mean, nWindowSize);
+		pDataTable->AddWindowStatisticColumn("timestamp", "maxtimestamp", "Latest timestamp", LibMCEnv::eDataTableWindowStatistic::Maximum, nWindowSize);
+
+		std::vector<double> meanPositions;
+		std::vector<double> maxTimestamps;
+		pDataTable->GetDoubleColumnValues("meanposition", meanPositions);
+		pDataTable->GetDoubleColumnValues("maxtimestamp", maxTimestamps);
+
+		for (size_t nRowIndex : { (size_t)0, (size_t)50, (size_t)99, (size_t)12345, columns.m_Positions.size() - 1 }) {
+			size_t nFirstRow = (nRowIndex + 1 >= nWindowSize) ? (nRowIndex + 1 - nWindowSize) : 0;
+			double dSum = 0.0;
+			for (size_t nIndex = nFirstRow; nIndex <= nRowIndex; nIndex++)
+				dSum += columns.m_Positions[nIndex];
+			double dMean = dSum / (double)(nRowIndex - nFirstRow + 1);
+
+			if (std::fabs(meanPositions[nRowIndex] - dMean) > 1.0E-9)
+				throw std::runtime_error("window mean mismatch in row " + std::to_string(nRowIndex));
+			if (maxTimestamps[nRowIndex] != (double)columns.m_Timestamps[nRowIndex])
+				throw std::runtime_error("window maximum mismatch in row " + std::to_string(nRowIndex));
+		}
+
+		bool bInvalidWindowFailed = false;
+		try {
+			pDataTable->AddWindowStatisticColumn("position", "invalidwindow", "", LibMCEnv::eDataTableWindowStatistic::Sum, 0);
+		}
+		catch (LibMCEnv::ELibMCEnvException& Exception) {
+			bInvalidWindowFailed = (Exception.getErrorCode() == LIBMCENV_ERROR_INVALIDDATATABLEWINDOWSIZE);
+		}
+		if (!bInvalidWindowFailed || pDataTable->HasColumn("invalidwindow"))
+			throw std::runtime_error("invalid window size has been accepted");
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		sTestColumns columns;
+		createTestColumns(columns, DATATABLETEST_ROWCOUNT);
+
+		auto pDataTable = pStateEnvironment->CreateDataTable();
+		fillTestTable(pDataTable, columns);
+		pDataTable->SetThreadCount(4);
+
+		uint64_t nStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+
+		checkFilter(pDataTable, columns);
+		checkSort(pDataTable, columns);
+		checkAggregation(pDataTable, columns);
+		checkWindowStatistics(pDataTable, columns);
+
+		uint64_t nDuration = pStateEnvironment->GetGlobalTimerInMicroseconds() - nStartTime;
+		pStateEnvironment->LogMessage("Data table queries: " + std::to_string(nDuration / 1000) + "ms");
+
+		pStateEnvironment->SetNextState("loading");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Loading
+**************************************************************************************************************************/
+class CTestState_Loading : public virtual CTestState {
+public:
+
+	CTestState_Loading(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "loading";
+	}
+
+	template <typename T> static std::vector<T> getRowRange(const std::vector<T>& values, size_t nFirstRow, size_t nRowCount)
+	{
+		return std::vector<T>(values.begin() + nFirstRow, values.begin() + nFirstRow + nRowCount);
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		sTestColumns columns;
+		createTestColumns(columns, DATATABLETEST_ROWCOUNT);
+
+		auto pDataTable = pStateEnvironment->CreateDataTable();
+		fillTestTable(pDataTable, columns);
+
+		// Raw columns are read partially, encoded columns are decoded and trimmed
+		auto pWriteOptions = pDataTable->CreateWriteOptions();
+		pWriteOptions->SetDefaultEncoding(LibMCEnv::eDataTableColumnEncoding::Raw);
+		pWriteOptions->SetColumnEncoding("timestamp", LibMCEnv::eDataTableColumnEncoding::DeltaOfDelta);
+		pWriteOptions->SetCompression(LibMCEnv::eDataTableCompression::NoCompression);
+
+		auto pWriter = pStateEnvironment->CreateTemporaryStream("datatabletest", DATATABLETEST_MIMETYPE);
+		pDataTable->WriteDataToStream(pWriter, pWriteOptions);
+		auto pReader = pWriter->GetStreamReader();
+
+		const size_t nFirstRow = 1000;
+		const size_t nRowCount = 5000;
+
+		auto pLoadOptions = pDataTable->CreateLoadOptions();
+		pLoadOptions->AddColumn("sensor");
+		pLoadOptions->AddColumn("timestamp");
+		pLoadOptions->SetRowRange(nFirstRow, nRowCount);
+		if (!pLoadOptions->GetLazyLoading() || (pLoadOptions->GetColumnCount() != 2) || (pLoadOptions->GetColumn(1) != "timestamp"))
+			throw std::runtime_error("unexpected load options");
+
+		auto pLoadedTable = pStateEnvironment->CreateDataTable();
+		pLoadedTable->LoadFromStreamWithOptions(pReader, pLoadOptions);
+
+		if ((pLoadedTable->GetColumnCount() != 2) || (pLoadedTable->GetRowCount() != nRowCount) || (pLoadedTable->GetColumnIdentifier(0) != "sensor") || pLoadedTable->HasColumn("noise"))
+			throw std::runtime_error("unexpected projected table");
+		if (pLoadedTable->IsColumnLoaded("sensor") || pLoadedTable->IsColumnLoaded("timestamp"))
+			throw std::runtime_error("lazy columns have been loaded up front");
+
+		std::vector<int32_t> sensorValues;
+		pLoadedTable->GetInt32ColumnValues("sensor", sensorValues);
+		compareValues(sensorValues, getRowRange(columns.m_Sensor, nFirstRow, nRowCount), "projected sensor");
+		if (!pLoadedTable->IsColumnLoaded("sensor") || pLoadedTable->IsColumnLoaded("timestamp"))
+			throw std::runtime_error("lazy column has not been loaded on access");
+
+		std::vector<uint64_t> timestampValues;
+		pLoadedTable->GetUint64ColumnValues("timestamp", timestampValues);
+		compareValues(timestampValues, getRowRange(columns.m_Timestamps, nFirstRow, nRowCount), "projected timestamp");
+
+		// Ranges that exceed the stream are cut off
+		pLoadOptions->ClearColumns();
+		pLoadOptions->SetRowRange(DATATABLETEST_ROWCOUNT - 10, 100);
+		pLoadOptions->SetLazyLoading(false);
+		pLoadedTable->LoadFromStreamWithOptions(pReader, pLoadOptions);
+		if ((pLoadedTable->GetColumnCount() != 8) || (pLoadedTable->GetRowCount() != 10) || !pLoadedTable->IsColumnLoaded("noise"))
+			throw std::runtime_error("unexpected eagerly loaded table");
+
+		bool bMissingColumnFailed = false;
+		pLoadOptions->AddColumn("doesnotexist");
+		try {
+			pLoadedTable->LoadFromStreamWithOptions(pReader, pLoadOptions);
+		}
+		catch (LibMCEnv::ELibMCEnvException& Exception) {
+			bMissingColumnFailed = (Exception.getErrorCode() == LIBMCENV_ERROR_COLUMNIDENTIFIERNOTFOUND);
+		}
+		if (!bMissingColumnFailed)
+			throw std::runtime_error("missing projected column has been accepted");
+
+		pStateEnvironment->SetNextState("scaledcolumns");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_ScaledColumns
+**************************************************************************************************************************/
+class CTestState_ScaledColumns : public virtual CTestState {
+public:
+
+	CTestState_ScaledColumns(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "scaledcolumns";
+	}
+
+	static bool appendFails(LibMCEnv::PDataTable pDataTable, const std::string& sIdentifier, const std::vector<int32_t>& values)
+	{
+		try {
+			pDataTable->AppendScaledInt32ColumnValues(sIdentifier, values);
+		}
+		catch (LibMCEnv::ELibMCEnvException& Exception) {
+			return (Exception.getErrorCode() == LIBMCENV_ERROR_COLUMNISNOTSCALEDINT32);
+		}
+		return false;
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		sTestColumns columns;
+		createTestColumns(columns, DATATABLETEST_ROWCOUNT);
+
+		const double dScaleFactor = 1.0 / 1024.0;
+		const double dOffset = -2.5;
+
+		std::vector<double> expectedValues;
+		for (int32_t nValue : columns.m_Sensor)
+			expectedValues.push_back((double)nValue * dScaleFactor + dOffset);
+
+		// Raw values are appended in chunks, like recordings are retrieved from a device
+		auto pDataTable = pStateEnvironment->CreateDataTable();
+		pDataTable->AddScaledInt32Column("scaled", "Scaled sensor value", dScaleFactor, dOffset);
+		pDataTable->AddScaledInt32Column("copy", "Scaled sensor value", dScaleFactor, dOffset);
+		pDataTable->AddColumn("plain", "Plain double column", LibMCEnv::eDataTableColumnType::DoubleColumn);
+
+		const size_t nChunkSize = 70000;
+		for (size_t nFirstRow = 0; nFirstRow < columns.m_Sensor.size(); nFirstRow += nChunkSize) {
+			std::vector<int32_t> chunk(columns.m_Sensor.begin() + nFirstRow, columns.m_Sensor.begin() + std::min(nFirstRow + nChunkSize, columns.m_Sensor.size()));
+			pDataTable->AppendScaledInt32ColumnValues("scaled", chunk);
+			pDataTable->AppendScaledInt32ColumnValues("copy", chunk);
+		}
+
+		std::string sDescription;
+		LibMCEnv::eDataTableColumnType columnType;
+		pDataTable->GetColumnInformation("scaled", sDescription, columnType);
+		if ((pDataTable->GetRowCount() != DATATABLETEST_ROWCOUNT) || (columnType != LibMCEnv::eDataTableColumnType::DoubleColumn))
+			throw std::runtime_error("unexpected scaled column");
+		if (pDataTable->IsColumnLoaded("scaled") || !pDataTable->IsColumnLoaded("plain"))
+			throw std::runtime_error("scaled column has been computed up front");
+
+		std::vector<double> doubleValues;
+		pDataTable->GetDoubleColumnValues("scaled", doubleValues);
+		compareValues(doubleValues, expectedValues, "scaled");
+		if (!pDataTable->IsColumnLoaded("scaled") || pDataTable->IsColumnLoaded("copy"))
+			throw std::runtime_error("scaled column has not been computed on access");
+
+		if (!appendFails(pDataTable, "scaled", columns.m_Sensor) || !appendFails(pDataTable, "plain", columns.m_Sensor))
+			throw std::runtime_error("values have been appended to a computed column");
+
+		// Writing computes the remaining columns
+		auto pLoadedTable = pStateEnvironment->CreateDataTable();
+		writeAndReload(pStateEnvironment, pDataTable, pDataTable->CreateWriteOptions(), pLoadedTable);
+		if (!pDataTable->IsColumnLoaded("copy"))
+			throw std::runtime_error("scaled column has not been computed for writing");
+
+		pLoadedTable->GetDoubleColumnValues("copy", doubleValues);
+		compareValues(doubleValues, expectedValues, "written scaled");
+
+		pStateEnvironment->SetNextState("scatterplot");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_ScatterPlot
+**************************************************************************************************************************/
+class CTestState_ScatterPlot : public virtual CTestState {
+public:
+
+	CTestState_ScatterPlot(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "scatterplot";
+	}
+
+	// Compares a density query bin by bin with a brute force binning of all points.
+	static void checkDensityQuery(LibMCEnv::PStateEnvironment pStateEnvironment, LibMCEnv::PScatterPlot pScatterPlot, const std::vector<double>& xValues, const std::vector<double>& yValues,
+		const std::string& sContext, double dMinX, double dMinY, double dMaxX, double dMaxY, uint32_t nResolutionX, uint32_t nResolutionY)
+	{
+		std::vector<LibMCEnv::sFloatPosition2D> positions;
+		std::vector<uint32_t> counts;
+
+		uint64_t nQueryStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+		pScatterPlot->QueryDensity(dMinX, dMinY, dMaxX, dMaxY, nResolutionX, nResolutionY, positions, counts);
+		uint64_t nQueryEndTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+
+		if (positions.size() != counts.size())
+			throw std::runtime_error(sContext + ": position and count arrays differ in size");
+
+		double dBinSizeX = (dMaxX - dMinX) / nResolutionX;
+		double dBinSizeY = (dMaxY - dMinY) / nResolutionY;
+
+		std::vector<uint32_t> bruteForceCounts;
+		std::vector<double> bruteForceSumsX;
+		std::vector<double> bruteForceSumsY;
+		bruteForceCounts.resize((size_t)nResolutionX * nResolutionY, 0);
+		bruteForceSumsX.resize(bruteForceCounts.size(), 0.0);
+		bruteForceSumsY.resize(bruteForceCounts.size(), 0.0);
+		uint64_t nBruteForceTotal = 0;
+		double dBruteForceSumX = 0.0;
+		double dBruteForceSumY = 0.0;
+
+		uint64_t nBruteForceStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+		for (size_t nIndex = 0; nIndex < xValues.size(); nIndex++) {
+			double dX = xValues[nIndex];
+			double dY = yValues[nIndex];
+			if ((dX < dMinX) || (dX > dMaxX) || (dY < dMinY) || (dY > dMaxY))
+				continue;
+
+			size_t nBinIndex = (size_t)getDensityBinIndex(dY, dMinY, dBinSizeY, nResolutionY) * nResolutionX + getDensityBinIndex(dX, dMinX, dBinSizeX, nResolutionX);
+			bruteForceCounts[nBinIndex]++;
+			bruteForceSumsX[nBinIndex] += dX;
+			bruteForceSumsY[nBinIndex] += dY;
+			nBruteForceTotal++;
+			dBruteForceSumX += dX;
+			dBruteForceSumY += dY;
+		}
+		uint64_t nBruteForceEndTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+
+		uint64_t nQueryTotal = 0;
+		double dQuerySumX = 0.0;
+		double dQuerySumY = 0.0;
+		for (size_t nEntryIndex = 0; nEntryIndex < positions.size(); nEntryIndex++) {
+			uint32_t nCount = counts[nEntryIndex];
+			if (nCount == 0)
+				throw std::runtime_error(sContext + ": empty density entry " + std::to_string(nEntryIndex));
+
+			nQueryTotal += nCount;
+			dQuerySumX += positions[nEntryIndex].m_Coordinates[0] * nCount;
+			dQuerySumY += positions[nEntryIndex].m_Coordinates[1] * nCount;
+		}
+
+		if (nQueryTotal != nBruteForceTotal)
+			throw std::runtime_error(sContext + ": " + std::to_string(nQueryTotal) + " points found instead of " + std::to_string(nBruteForceTotal));
+
+		// Mean positions are sent as floats
+		double dTolerance = std::max(std::max(std::fabs(dMinX), std::fabs(dMaxX)), std::max(std::fabs(dMinY), std::fabs(dMaxY))) * 1.0E-6;
+
+		if (nBruteForceTotal > 0) {
+			if ((std::fabs(dQuerySumX / nQueryTotal - dBruteForceSumX / nBruteForceTotal) > dTolerance) || (std::fabs(dQuerySumY / nQueryTotal - dBruteForceSumY / nBruteForceTotal) > dTolerance))
+				throw std::runtime_error(sContext + ": centroid of the density entries differs from the centroid of the points");
+		}
+
+		// Every non-empty bin must be returned in row order, with the mean position of its points
+		size_t nEntryIndex = 0;
+		for (size_t nBinIndex = 0; nBinIndex < bruteForceCounts.size(); nBinIndex++) {
+			uint32_t nBruteForceCount = bruteForceCounts[nBinIndex];
+			if (nBruteForceCount == 0)
+				continue;
+
+			std::string sBinName = "bin " + std::to_string(nBinIndex % nResolutionX) + "/" + std::to_string(nBinIndex / nResolutionX);
+			if (nEntryIndex >= counts.size())
+				throw std::runtime_error(sContext + ": " + sBinName + " is missing");
+			if (counts[nEntryIndex] != nBruteForceCount)
+				throw std::runtime_error(sContext + ": " + sBinName + " has " + std::to_string(counts[nEntryIndex]) + " points instead of " + std::to_string(nBruteForceCount));
+
+			auto& position = positions[nEntryIndex];
+			if ((std::fabs(position.m_Coordinates[0] - bruteForceSumsX[nBinIndex] / nBruteForceCount) > dTolerance) || (std::fabs(position.m_Coordinates[1] - bruteForceSumsY[nBinIndex] / nBruteForceCount) > dTolerance))
+				throw std::runtime_error(sContext + ": " + sBinName + " has a wrong mean position");
+
+			nEntryIndex++;
+		}
+
+		if (nEntryIndex != counts.size())
+			throw std::runtime_error(sContext + ": " + std::to_string(counts.size() - nEntryIndex) + " additional density entries");
+
+		pStateEnvironment->LogMessage(sContext + ": " + std::to_string(positions.size()) + " bins with " + std::to_string(nQueryTotal) + " points, query: " + std::to_string(nQueryEndTime - nQueryStartTime)
+			+ " microseconds, brute force: " + std::to_string(nBruteForceEndTime - nBruteForceStartTime) + " microseconds");
+	}
+
+	static bool queryFails(LibMCEnv::PScatterPlot pScatterPlot, double dMinX, double dMinY, double dMaxX, double dMaxY, uint32_t nResolutionX, uint32_t nResolutionY, LibMCEnvResult nExpectedError)
+	{
+		std::vector<LibMCEnv::sFloatPosition2D> positions;
+		std::vector<uint32_t> counts;
+		try {
+			pScatterPlot->QueryDensity(dMinX, dMinY, dMaxX, dMaxY, nResolutionX, nResolutionY, positions, counts);
+		}
+		catch (LibMCEnv::ELibMCEnvException& Exception) {
+			return (Exception.getErrorCode() == nExpectedError);
+		}
+		return false;
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		std::vector<double> xValues;
+		std::vector<double> yValues;
+		createScatterPlotPoints(xValues, yValues, DATATABLETEST_ROWCOUNT);
+
+		auto pDataTable = pStateEnvironment->CreateDataTable();
+		pDataTable->AddColumn("x", "X position in mm", LibMCEnv::eDataTableColumnType::DoubleColumn);
+		pDataTable->AddColumn("y", "Y position in mm", LibMCEnv::eDataTableColumnType::DoubleColumn);
+		pDataTable->SetDoubleColumnValues("x", xValues);
+		pDataTable->SetDoubleColumnValues("y", yValues);
+
+		auto pOptions = pDataTable->CreateScatterPlotOptions();
+		pOptions->SetXAxisColumn("x", 1.0, 0.0);
+		pOptions->SetYAxisColumn("y", 1.0, 0.0);
+
+		// Calculating the scatter plot builds the spatial index
+		uint64_t nStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+		auto pScatterPlot = pDataTable->CalculateScatterPlot(pOptions);
+		uint64_t nEndTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+		pStateEnvironment->LogMessage("Calculated scatter plot of " + std::to_string(pScatterPlot->GetPointCount()) + " points in " + std::to_string(nEndTime - nStartTime) + " microseconds");
+
+		if (pScatterPlot->GetPointCount() != xValues.size())
+			throw std::runtime_error("scatter plot point count mismatch");
+
+		double dMinX, dMinY, dMaxX, dMaxY;
+		pScatterPlot->GetBoundaries(dMinX, dMinY, dMaxX, dMaxY);
+		double dSizeX = dMaxX - dMinX;
+		double dSizeY = dMaxY - dMinY;
+
+		// Bins below a cell of the finest possible index grid are always filled point by point
+		uint32_t nFineResolution = DATATABLETEST_MAXINDEXGRIDSIZE * 2;
+
+		checkDensityQuery(pStateEnvironment, pScatterPlot, xValues, yValues, "Full view, 64x64 bins", dMinX, dMinY, dMaxX, dMaxY, 64, 64);
+		checkDensityQuery(pStateEnvironment, pScatterPlot, xValues, yValues, "Full view, 100x60 bins", dMinX, dMinY, dMaxX, dMaxY, 100, 60);
+		checkDensityQuery(pStateEnvironment, pScatterPlot, xValues, yValues, "Full view, 7x3 bins", dMinX, dMinY, dMaxX, dMaxY, 7, 3);
+		checkDensityQuery(pStateEnvironment, pScatterPlot, xValues, yValues, "Full view, fine bins", dMinX, dMinY, dMaxX, dMaxY, nFineResolution, 256);
+		checkDensityQuery(pStateEnvironment, pScatterPlot, xValues, yValues, "Zoomed into cluster", 115.0, 85.0, 115.0 + dSizeX / 20.0, 85.0 + dSizeY / 20.0, 100, 100);
+		checkDensityQuery(pStateEnvironment, pScatterPlot, xValues, yValues, "Partially outside", dMinX + dSizeX * 0.6, dMinY - dSizeY * 0.3, dMaxX + dSizeX * 0.4, dMaxY - dSizeY * 0.2, 48, 48);
+		checkDensityQuery(pStateEnvironment, pScatterPlot, xValues, yValues, "Shifted grid", dMinX + dSizeX * 0.0123, dMinY - dSizeY * 0.0071, dMaxX - dSizeX * 0.0311, dMaxY + dSizeY * 0.0057, 37, 29);
+		checkDensityQuery(pStateEnvironment, pScatterPlot, xValues, yValues, "Outside", dMaxX + 1.0, dMaxY + 1.0, dMaxX + 2.0, dMaxY + 2.0, 16, 16);
+
+		if (!queryFails(pScatterPlot, dMinX, dMinY, dMaxX, dMaxY, 0, 64, LIBMCENV_ERROR_INVALIDSCATTERPLOTRESOLUTION))
+			throw std::runtime_error("density query accepted an invalid resolution");
+		if (!queryFails(pScatterPlot, dMaxX, dMinY, dMinX, dMaxY, 64, 64, LIBMCENV_ERROR_INVALIDSCATTERPLOTVIEWPORT))
+			throw std::runtime_error("density query accepted an invalid viewport");
+
+		// Releasing the points must not leave a stale index behind
+		pScatterPlot->Release();
+		if (pScatterPlot->GetPointCount() != 0)
+			throw std::runtime_error("released scatter plot still has points");
+
+		std::vector<LibMCEnv::sFloatPosition2D> positions;
+		std::vector<uint32_t> counts;
+		pScatterPlot->QueryDensity(dMinX, dMinY, dMaxX, dMaxY, 64, 64, positions, counts);
+		if (!positions.empty() || !counts.empty())
+			throw std::runtime_error("released scatter plot still returns density entries");
+
+		pStateEnvironment->SetNextState("success");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Success
+**************************************************************************************************************************/
+class CTestState_Success : public virtual CTestState {
+public:
+
+	CTestState_Success(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "success";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		pStateEnvironment->SetNextState("success");
+
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_FatalError
+**************************************************************************************************************************/
+class CTestState_FatalError : public virtual CTestState {
+public:
+
+	CTestState_FatalError(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "fatalerror";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		pStateEnvironment->SetNextState("fatalerror");
+	}
+
+};
+
+
+
+/*************************************************************************************************************************
+ Class definition of CStateFactory
+**************************************************************************************************************************/
+
+CStateFactory::CStateFactory(const std::string& sInstanceName)
+{
+	m_pPluginData = std::make_shared<CTestData>();
+}
+
+IState* CStateFactory::CreateState(const std::string& sStateName)
+{
+
+	IState* pStateInstance = nullptr;
+
+	if (createStateInstanceByName<CTestState_Init>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_Encoding>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_Query>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_Loading>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_ScaledColumns>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+
+	if (createStateInstanceByName<CTestState_ScatterPlot>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_Success>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_FatalError>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDSTATENAME);
+
+}
+
+
@@ -34,6 +34,8 @@ using namespace LibMCPlugin::Impl;
 
 #include <iostream>
 #include <fstream>
+#include <cmath>
+#include <algorithm>
 
 
 /*************************************************************************************************************************
@@ -42,6 +44,168 @@ using namespace LibMCPlugin::Impl;
 __NODRIVERIMPORT
 
 
+#define FIELDDATA2DTEST_DPI 254.0
+
+/*************************************************************************************************************************
+ Helper functions
+**************************************************************************************************************************/
+// Deterministic pseudo random values in [dMinValue, dMaxValue), so that failures are reproducible.
+static void fillPattern(std::vector<double>& buffer, uint32_t nSeed, double dMinValue, double dMaxValue)
+{
+	uint32_t nState = nSeed;
+	for (auto& dValue : buffer) {
+		nState = nState * 1664525 + 1013904223;
+		dValue = dMinValue + (dMaxValue - dMinValue) * ((nState >> 8) / 16777216.0);
+	}
+}
+
+static LibMCEnv::PDiscreteFieldData2D createPatternField(LibMCEnv::PStateEnvironment pStateEnvironment, uint32_t nSizeX, uint32_t nSizeY, uint32_t nSeed)
+{
+	std::vector<double> values((size_t)nSizeX * nSizeY);
+	fillPattern(values, nSeed, -5.0, 25.0);
+
+	auto pField = pStateEnvironment->CreateDiscreteField2D(nSizeX, nSizeY, FIELDDATA2DTEST_DPI, FIELDDATA2DTEST_DPI, 1.0, 2.0, 0.0);
+	pField->SetPixelRange(0, 0, nSizeX - 1, nSizeY - 1, values);
+	return pField;
+}
+
+static std::vector<double> getFieldValues(LibMCEnv::PDiscreteFieldData2D pField)
+{
+	uint32_t nSizeX = 0;
+	uint32_t nSizeY = 0;
+	pField->GetSizeInPixels(nSizeX, nSizeY);
+
+	std::vector<double> values;
+	pField->GetPixelRange(0, 0, nSizeX - 1, nSizeY - 1, values);
+	return values;
+}
+
+static void compareValues(const std::vector<double>& actual, const std::vector<double>& expected, double dTolerance, const std::string& sContext)
+{
+	if (actual.size() != expected.size())
+		throw std::runtime_error(sContext + ": value count mismatch (" + std::to_string(actual.size()) + " != " + std::to_string(expected.size()) + ")");
+
+	for (size_t nIndex = 0; nIndex < actual.size(); nIndex++) {
+		double dTolerableDifference = dTolerance * std::max(1.0, std::abs(expected[nIndex]));
+		if (!(std::abs(actual[nIndex] - expected[nIndex]) <= dTolerableDifference))
+			throw std::runtime_error(sContext + ": value mismatch at index " + std::to_string(nIndex) + " (" + std::to_string(actual[nIndex]) + " != " + std::to_string(expected[nIndex]) + ")");
+	}
+}
+
+typedef struct _sFieldOperationResults {
+	std::vector<double> m_TransformedValues;
+	std::vector<double> m_ScaledDownValues;
+	std::vector<double> m_ScaledUpValues;
+	std::vector<double> m_AverageValues;
+	std::vector<uint8_t> m_RGBValues;
+} sFieldOperationResults;
+
+// Runs all field operations with the given storage precision and kernel settings.
+static sFieldOperationResults runFieldOperations(LibMCEnv::PStateEnvironment pStateEnvironment, uint32_t nSizeX, uint32_t nSizeY, LibMCEnv::eFieldStoragePrecision storagePrecision, bool bSIMDKernelsEnabled, uint32_t nThreadCount)
+{
+	sFieldOperationResults results;
+
+	auto pField = createPatternField(pStateEnvironment, nSizeX, nSizeY, 1);
+	pField->SetStoragePrecision(storagePrecision);
+	pField->SetSIMDKernelsEnabled(bSIMDKernelsEnabled);
+	pField->SetThreadCount(nThreadCount);
+
+	auto pOtherField = createPatternField(pStateEnvironment, nSizeX, nSizeY, 2);
+	pOtherField->SetStoragePrecision(storagePrecision);
+
+	pField->TransformField(1.7, -0.3);
+	pField->AddField(pOtherField, 0.9, 0.1);
+	pField->Clamp(-2.0, 30.0);
+	results.m_TransformedValues = getFieldValues(pField);
+
+	results.m_ScaledDownValues = getFieldValues(pField->ScaleFieldDown(3, 2));
+	results.m_ScaledUpValues = getFieldValues(pField->ScaleFieldUp(2, 3));
+
+	LibMCEnv::sColorRGB minColor = { 0.0, 0.0, 1.0 };
+	LibMCEnv::sColorRGB midColor = { 0.0, 1.0, 0.0 };
+	LibMCEnv::sColorRGB maxColor = { 1.0, 0.0, 0.0 };
+	auto pImage = pField->RenderToImageRaw(0.0, minColor, 8.0, midColor, 16.0, maxColor);
+	pImage->GetPixelRange(0, 0, nSizeX - 1, nSizeY - 1, results.m_RGBValues);
+
+	// Points cover the field and a margin around it
+	std::vector<double> coordinates(200000);
+	fillPattern(coordinates, 3, -1.0, 1.0);
+	double dSizeX = 0.0;
+	double dSizeY = 0.0;
+	pField->GetSizeInMM(dSizeX, dSizeY);
+
+	std::vector<LibMCEnv::sFieldData2DPoint> points(coordinates.size() / 2);
+	for (size_t nIndex = 0; nIndex < points.size(); nIndex++) {
+		points[nIndex].m_Coordinates[0] = 1.0 + coordinates[nIndex * 2] * 0.1 + (nIndex % 1000) * dSizeX / 1000.0;
+		points[nIndex].m_Coordinates[1] = 2.0 + coordinates[nIndex * 2 + 1] * 0.1 + (nIndex / 1000) * dSizeY / 100.0;
+		points[nIndex].m_Value = coordinates[nIndex * 2] * 10.0;
+	}
+	pField->RenderAveragePointValues(-1.0, LibMCEnv::eFieldSamplingMode::FloorCoordinate, 1.0, 1.0, points);
+	results.m_AverageValues = getFieldValues(pField);
+
+	return results;
+}
+
+
+// Creates a field with the background value and a few patches of pattern values.
+static LibMCEnv::PDiscreteFieldData2D createSparseField(LibMCEnv::PStateEnvironment pStateEnvironment, uint32_t nSizeX, uint32_t nSizeY, uint32_t nSeed, double dBackgroundValue, LibMCEnv::eFieldStorageLayout storageLayout)
+{
+	auto pField = pStateEnvironment->CreateDiscreteField2D(nSizeX, nSizeY, FIELDDATA2DTEST_DPI, FIELDDATA2DTEST_DPI, 1.0, 2.0, dBackgroundValue);
+	pField->SetStorageLayout(storageLayout);
+
+	std::vector<double> patchPositions(12);
+	fillPattern(patchPositions, nSeed, 0.0, 1.0);
+	for (size_t nPatch = 0; nPatch < patchPositions.size() / 4; nPatch++) {
+		uint32_t nPatchSizeX = 1 + (uint32_t)(patchPositions[nPatch * 4] * 300.0);
+		uint32_t nPatchSizeY = 1 + (uint32_t)(patchPositions[nPatch * 4 + 1] * 300.0);
+		uint32_t nPatchX = (uint32_t)(patchPositions[nPatch * 4 + 2] * (nSizeX - nPatchSizeX));
+		uint32_t nPatchY = (uint32_t)(patchPositions[nPatch * 4 + 3] * (nSizeY - nPatchSizeY));
+
+		std::vector<double> values((size_t)nPatchSizeX * nPatchSizeY);
+		fillPattern(values, nSeed + (uint32_t)nPatch, -5.0, 25.0);
+		pField->SetPixelRange(nPatchX, nPatchY, nPatchX + nPatchSizeX - 1, nPatchY + nPatchSizeY - 1, values);
+	}
+
+	pField->SetPixel(nSizeX - 1, nSizeY - 1, 7.25);
+	return pField;
+}
+
+// Runs all field operations on sparse fields with the given storage layouts.
+static sFieldOperationResults runSparseFieldOperations(LibMCEnv::PStateEnvironment pStateEnvironment, uint32_t nSizeX, uint32_t nSizeY, LibMCEnv::eFieldStorageLayout storageLayout, LibMCEnv::eFieldStorageLayout otherStorageLayout)
+{
+	sFieldOperationResults results;
+
+	auto pField = createSparseField(pStateEnvironment, nSizeX, nSizeY, 1, 0.0, storageLayout);
+	auto pOtherField = createSparseField(pStateEnvironment, nSizeX, nSizeY, 2, 1.5, otherStorageLayout);
+
+	pField->TransformField(1.7, -0.3);
+	pField->AddField(pOtherField, 0.9, 0.1);
+	pField->Clamp(-2.0, 30.0);
+	results.m_TransformedValues = getFieldValues(pField);
+
+	// 5 x 7 does not divide the field size, so the border blocks are cropped
+	results.m_ScaledDownValues = getFieldValues(pField->ScaleFieldDown(5, 7));
+	results.m_ScaledUpValues = getFieldValues(pField->ScaleFieldUp(2, 3));
+
+	LibMCEnv::sColorRGB minColor = { 0.0, 0.0, 1.0 };
+	LibMCEnv::sColorRGB midColor = { 0.0, 1.0, 0.0 };
+	LibMCEnv::sColorRGB maxColor = { 1.0, 0.0, 0.0 };
+	auto pImage = pField->RenderToImageRaw(0.0, minColor, 8.0, midColor, 16.0, maxColor);
+	pImage->GetPixelRange(0, 0, nSizeX - 1, nSizeY - 1, results.m_RGBValues);
+
+	// Points only cover a stripe of the field
+	std::vector<LibMCEnv::sFieldData2DPoint> points(10000);
+	for (size_t nIndex = 0; nIndex < points.size(); nIndex++) {
+		points[nIndex].m_Coordinates[0] = 1.0 + (nIndex % 100) * 0.3;
+		points[nIndex].m_Coordinates[1] = 2.0 + (nIndex / 100) * 0.05;
+		points[nIndex].m_Value = (double)(nIndex % 17);
+	}
+	pField->RenderAveragePointValues(-1.0, LibMCEnv::eFieldSamplingMode::FloorCoordinate, 1.0, 1.0, points);
+	results.m_AverageValues = getFieldValues(pField);
+
+	return results;
+}
+
 /*************************************************************************************************************************
  Class definition of CPLCData
 **************************************************************************************************************************/
@@ -100,10 +264,8 @@ public:
 		LibMCEnv::sColorRGB maxColor = { 1.0, 0.0, 0.0 };
 
 		auto pImage = pFieldData->RenderToImageRaw(0.0, minColor, 8.0, midColor, 16.0, maxColor);
-		pImage->EncodePNG();
-
 		std::vector<uint8_t> pngData;
-		pImage->GetEncodedPNGData(pngData);
+		pImage->CreatePNGImage(nullptr)->GetPNGDataStream(pngData);
 
 		std::ofstream pngStream("output.png", std::ios::binary | std::ios::out);
 		if (pngData.size() > 0)		
@@ -111,6 +273,290 @@ public:
 		pngStream.close();
 
 
+		pStateEnvironment->SetNextState("kernels");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Kernels
+**************************************************************************************************************************/
+class CTestState_Kernels : public virtual CTestState {
+public:
+
+	CTestState_Kernels(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "kernels";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		// Odd sizes, so that the vector kernels and the row partitions have remainders
+		const uint32_t nSizeX = 1237;
+		const uint32_t nSizeY = 611;
+
+		for (auto storagePrecision : { LibMCEnv::eFieldStoragePrecision::Float64, LibMCEnv::eFieldStoragePrecision::Float32 }) {
+			std::string sPrecisionName = (storagePrecision == LibMCEnv::eFieldStoragePrecision::Float64) ? "Float64" : "Float32";
+
+			// Scalar kernels on a single thread are the reference
+			auto referenceResults = runFieldOperations(pStateEnvironment, nSizeX, nSizeY, storagePrecision, false, 1);
+
+			for (uint32_t nThreadCount : { 1, 3, 0 }) {
+				auto results = runFieldOperations(pStateEnvironment, nSizeX, nSizeY, storagePrecision, true, nThreadCount);
+				std::string sContext = sPrecisionName + " with " + std::to_string(nThreadCount) + " threads";
+
+				compareValues(results.m_TransformedValues, referenceResults.m_TransformedValues, 0.0, "TransformField, AddField and Clamp, " + sContext);
+				compareValues(results.m_ScaledDownValues, referenceResults.m_ScaledDownValues, 0.0, "ScaleFieldDown, " + sContext);
+				compareValues(results.m_ScaledUpValues, referenceResults.m_ScaledUpValues, 0.0, "ScaleFieldUp, " + sContext);
+				compareValues(results.m_AverageValues, referenceResults.m_AverageValues, 0.0, "RenderAveragePointValues, " + sContext);
+				if (results.m_RGBValues != referenceResults.m_RGBValues)
+					throw std::runtime_error("RenderToImageRaw mismatch, " + sContext);
+			}
+
+			if (storagePrecision == LibMCEnv::eFieldStoragePrecision::Float64) {
+				// Check the reference against a plain computation of the same operations
+				auto pField = createPatternField(pStateEnvironment, nSizeX, nSizeY, 1);
+				auto values = getFieldValues(pField);
+				auto otherValues = getFieldValues(createPatternField(pStateEnvironment, nSizeX, nSizeY, 2));
+				for (size_t nIndex = 0; nIndex < values.size(); nIndex++)
+					values[nIndex] = std::min(std::max(values[nIndex] * 1.7 - 0.3 + (otherValues[nIndex] * 0.9 + 0.1), -2.0), 30.0);
+				compareValues(referenceResults.m_TransformedValues, values, 1.0E-12, "TransformField, AddField and Clamp reference");
+
+				uint32_t nScaledSizeX = (nSizeX + 2) / 3;
+				uint32_t nScaledSizeY = (nSizeY + 1) / 2;
+				std::vector<double> scaledDownValues((size_t)nScaledSizeX * nScaledSizeY);
+				for (uint32_t nY = 0; nY < nScaledSizeY; nY++) {
+					for (uint32_t nX = 0; nX < nScaledSizeX; nX++) {
+						double dSum = 0.0;
+						uint32_t nCount = 0;
+						for (uint32_t nSourceY = nY * 2; nSourceY < std::min(nY * 2 + 2, nSizeY); nSourceY++) {
+							for (uint32_t nSourceX = nX * 3; nSourceX < std::min(nX * 3 + 3, nSizeX); nSourceX++) {
+								dSum += values[(size_t)nSourceY * nSizeX + nSourceX];
+								nCount++;
+							}
+						}
+						scaledDownValues[(size_t)nY * nScaledSizeX + nX] = dSum / nCount;
+					}
+				}
+				compareValues(referenceResults.m_ScaledDownValues, scaledDownValues, 1.0E-12, "ScaleFieldDown reference");
+
+				for (uint32_t nY = 0; nY < nSizeY * 3; nY++) {
+					for (uint32_t nX = 0; nX < nSizeX * 2; nX++) {
+						if (referenceResults.m_ScaledUpValues[(size_t)nY * nSizeX * 2 + nX] != values[(size_t)(nY / 3) * nSizeX + nX / 2])
+							throw std::runtime_error("ScaleFieldUp reference mismatch at " + std::to_string(nX) + "/" + std::to_string(nY));
+					}
+				}
+
+				// Scaled fields keep their size in mm
+				double dScaledDPIX = 0.0;
+				double dScaledDPIY = 0.0;
+				pField->ScaleFieldDown(3, 2)->GetDPI(dScaledDPIX, dScaledDPIY);
+				if ((dScaledDPIX != FIELDDATA2DTEST_DPI / 3.0) || (dScaledDPIY != FIELDDATA2DTEST_DPI / 2.0))
+					throw std::runtime_error("invalid DPI of scaled down field");
+				pField->ScaleFieldUp(2, 3)->GetDPI(dScaledDPIX, dScaledDPIY);
+				if ((dScaledDPIX != FIELDDATA2DTEST_DPI * 2.0) || (dScaledDPIY != FIELDDATA2DTEST_DPI * 3.0))
+					throw std::runtime_error("invalid DPI of scaled up field");
+			}
+			else {
+				// Float32 storage rounds each stored value to single precision
+				auto doubleResults = runFieldOperations(pStateEnvironment, nSizeX, nSizeY, LibMCEnv::eFieldStoragePrecision::Float64, false, 1);
+				compareValues(referenceResults.m_TransformedValues, doubleResults.m_TransformedValues, 1.0E-5, "Float32 against Float64 storage");
+				compareValues(referenceResults.m_ScaledDownValues, doubleResults.m_ScaledDownValues, 1.0E-5, "Float32 against Float64 storage after ScaleFieldDown");
+			}
+
+			pStateEnvironment->LogMessage(sPrecisionName + " field operations match the reference.");
+		}
+
+		auto pField = pStateEnvironment->CreateDiscreteField2D(16, 16, FIELDDATA2DTEST_DPI, FIELDDATA2DTEST_DPI, 0.0, 0.0, 1.0);
+		pStateEnvironment->LogMessage("Field kernels: " + pField->GetSIMDKernelName());
+
+		pStateEnvironment->SetNextState("tiles");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Tiles
+**************************************************************************************************************************/
+class CTestState_Tiles : public virtual CTestState {
+public:
+
+	CTestState_Tiles(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "tiles";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		const uint32_t nSizeX = 1237;
+		const uint32_t nSizeY = 611;
+
+		// Dense storage is the reference, tiled fields must return identical values
+		auto referenceResults = runSparseFieldOperations(pStateEnvironment, nSizeX, nSizeY, LibMCEnv::eFieldStorageLayout::Dense, LibMCEnv::eFieldStorageLayout::Dense);
+
+		for (auto otherStorageLayout : { LibMCEnv::eFieldStorageLayout::Tiled, LibMCEnv::eFieldStorageLayout::Dense }) {
+			auto results = runSparseFieldOperations(pStateEnvironment, nSizeX, nSizeY, LibMCEnv::eFieldStorageLayout::Tiled, otherStorageLayout);
+			std::string sContext = (otherStorageLayout == LibMCEnv::eFieldStorageLayout::Tiled) ? "tiled with tiled field" : "tiled with dense field";
+
+			compareValues(results.m_TransformedValues, referenceResults.m_TransformedValues, 0.0, "TransformField, AddField and Clamp, " + sContext);
+			compareValues(results.m_ScaledDownValues, referenceResults.m_ScaledDownValues, 0.0, "ScaleFieldDown, " + sContext);
+			compareValues(results.m_ScaledUpValues, referenceResults.m_ScaledUpValues, 0.0, "ScaleFieldUp, " + sContext);
+			compareValues(results.m_AverageValues, referenceResults.m_AverageValues, 0.0, "RenderAveragePointValues, " + sContext);
+			if (results.m_RGBValues != referenceResults.m_RGBValues)
+				throw std::runtime_error("RenderToImageRaw mismatch, " + sContext);
+		}
+
+		// Resizing keeps the background of existing tiles and fills new pixels with the default value
+		auto pResizedField = createSparseField(pStateEnvironment, 10, 10, 3, 2.0, LibMCEnv::eFieldStorageLayout::Tiled);
+		pResizedField->SetPixel(3, 4, 9.0);
+		pResizedField->ResizeField(600, 5, -1.0);
+		if ((pResizedField->GetPixel(3, 4) != 9.0) || (pResizedField->GetPixel(10, 0) != -1.0) || (pResizedField->GetPixel(599, 4) != -1.0))
+			throw std::runtime_error("invalid values of resized tiled field");
+
+		pStateEnvironment->LogMessage("Tiled field operations match the dense reference.");
+
+		// Full platform of 2 m x 2 m at 0.05 mm resolution with a 100 mm x 100 mm part footprint.
+		// Dense storage would need 12.8 GB.
+		const uint32_t nPlatformSize = 40000;
+		const uint32_t nPartSize = 2000;
+		const uint32_t nPartPosition = 10000;
+
+		std::vector<double> partValues((size_t)nPartSize * nPartSize);
+		fillPattern(partValues, 4, 0.0, 300.0);
+
+		uint64_t nStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+
+		auto pPlatformField = pStateEnvironment->CreateDiscreteField2D(nPlatformSize, nPlatformSize, FIELDDATA2DTEST_DPI, FIELDDATA2DTEST_DPI, 0.0, 0.0, 0.0);
+		pPlatformField->SetStorageLayout(LibMCEnv::eFieldStorageLayout::Tiled);
+		pPlatformField->SetPixelRange(nPartPosition, nPartPosition, nPartPosition + nPartSize - 1, nPartPosition + nPartSize - 1, partValues);
+
+		auto pOtherPlatformField = pPlatformField->Duplicate();
+		pPlatformField->TransformField(2.0, 1.0);
+		pPlatformField->AddField(pOtherPlatformField, 1.0, 0.0);
+		pPlatformField->Clamp(0.0, 1000.0);
+		auto pScaledField = pPlatformField->ScaleFieldDown(4, 4)->ScaleFieldUp(2, 2);
+
+		uint64_t nDuration = pStateEnvironment->GetGlobalTimerInMicroseconds() - nStartTime;
+
+		uint64_t nStorageSize = pPlatformField->GetStorageSize() + pOtherPlatformField->GetStorageSize() + pScaledField->GetStorageSize();
+		pStateEnvironment->LogMessage("Tiled platform fields: " + std::to_string(nStorageSize / (1024 * 1024)) + " MB allocated, operations took " + std::to_string(nDuration / 1000) + " ms");
+
+		// The part covers 8 x 8 tiles, or 9 x 9 tiles if it is not aligned
+		if (nStorageSize > 3 * 81 * 256 * 256 * sizeof(double))
+			throw std::runtime_error("tiled platform fields allocate too much memory");
+
+		if ((pPlatformField->GetPixel(0, 0) != 1.0) || (pPlatformField->GetPixel(nPartPosition, nPartPosition) != (partValues[0] * 2.0 + 1.0) + (partValues[0] * 1.0 + 0.0)))
+			throw std::runtime_error("invalid values of tiled platform field");
+
+		pPlatformField->Clear(0.0);
+		if (pPlatformField->GetStorageSize() != 0)
+			throw std::runtime_error("Clear did not release the tiles");
+
+		pStateEnvironment->SetNextState("benchmark");
+	}
+
+};
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Benchmark
+**************************************************************************************************************************/
+class CTestState_Benchmark : public virtual CTestState {
+public:
+
+	CTestState_Benchmark(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "benchmark";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		// 125 mm x 125 mm at 0.05 mm resolution
+		const uint32_t nSizeX = 2500;
+		const uint32_t nSizeY = 2500;
+
+		struct sBenchmarkCase {
+			std::string m_sName;
+			LibMCEnv::eFieldStoragePrecision m_StoragePrecision;
+			bool m_bSIMDKernelsEnabled;
+			uint32_t m_nThreadCount;
+		};
+
+		std::vector<sBenchmarkCase> benchmarkCases = {
+			{ "scalar, 1 thread, Float64", LibMCEnv::eFieldStoragePrecision::Float64, false, 1 },
+			{ "simd, 1 thread, Float64", LibMCEnv::eFieldStoragePrecision::Float64, true, 1 },
+			{ "simd, all threads, Float64", LibMCEnv::eFieldStoragePrecision::Float64, true, 0 },
+			{ "simd, all threads, Float32", LibMCEnv::eFieldStoragePrecision::Float32, true, 0 }
+		};
+
+		LibMCEnv::sColorRGB minColor = { 0.0, 0.0, 1.0 };
+		LibMCEnv::sColorRGB midColor = { 0.0, 1.0, 0.0 };
+		LibMCEnv::sColorRGB maxColor = { 1.0, 0.0, 0.0 };
+
+		for (auto& benchmarkCase : benchmarkCases) {
+			auto pField = createPatternField(pStateEnvironment, nSizeX, nSizeY, 1);
+			pField->SetStoragePrecision(benchmarkCase.m_StoragePrecision);
+			pField->SetSIMDKernelsEnabled(benchmarkCase.m_bSIMDKernelsEnabled);
+			pField->SetThreadCount(benchmarkCase.m_nThreadCount);
+
+			auto pOtherField = createPatternField(pStateEnvironment, nSizeX, nSizeY, 2);
+			pOtherField->SetStoragePrecision(benchmarkCase.m_StoragePrecision);
+
+			std::string sTimings;
+			uint64_t nStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+			auto addTiming = [&](const std::string& sOperation) {
+				uint64_t nEndTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+				sTimings += " " + sOperation + " " + std::to_string((nEndTime - nStartTime) / 1000) + " ms";
+				nStartTime = nEndTime;
+			};
+
+			pField->TransformField(1.1, 0.2);
+			addTiming("transform");
+			pField->AddField(pOtherField, 0.5, 0.0);
+			addTiming("add");
+			pField->Clamp(0.0, 20.0);
+			addTiming("clamp");
+			pField->ScaleFieldDown(4, 4);
+			addTiming("scaledown");
+			pField->ScaleFieldUp(2, 2);
+			addTiming("scaleup");
+			pField->RenderToImageRaw(0.0, minColor, 8.0, midColor, 16.0, maxColor);
+			addTiming("render");
+
+			pStateEnvironment->LogMessage("Field benchmark (" + benchmarkCase.m_sName + "):" + sTimings);
+		}
+
 		pStateEnvironment->SetNextState("success");
 	}
 
@@ -192,6 +638,15 @@ IState* CStateFactory::CreateState(const std::string& sStateName)
 		return pStateInstance;
 
 
+	if (createStateInstanceByName<CTestState_Kernels>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_Tiles>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_Benchmark>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
 	if (createStateInstanceByName<CTestState_Success>(sStateName, pStateInstance, m_pPluginData))
 		return pStateInstance;
 
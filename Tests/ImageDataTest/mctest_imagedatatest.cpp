@@ -0,0 +1,1011 @@
+/*++
+
+Copyright (C) 2024 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "libmcplugin_impl.hpp"
+
+using namespace LibMCPlugin::Impl;
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+
+/*************************************************************************************************************************
+ Import functionality for Driver into current plugin
+**************************************************************************************************************************/
+__NODRIVERIMPORT
+
+
+#define IMAGEDATATEST_DPI 100.0
+
+/*************************************************************************************************************************
+ Helper functions
+**************************************************************************************************************************/
+// Deterministic pseudo random byte pattern, so that failures are reproducible.
+static void fillPattern(std::vector<uint8_t>& buffer, uint32_t nSeed)
+{
+	uint32_t nState = nSeed;
+	for (auto& nValue : buffer) {
+		nState = nState * 1664525 + 1013904223;
+		nValue = (uint8_t)(nState >> 24);
+	}
+}
+
+static uint8_t clampColor(int32_t nValue)
+{
+	if (nValue < 0)
+		return 0;
+	if (nValue > 255)
+		return 255;
+	return (uint8_t)nValue;
+}
+
+// Reference YUV to RGB conversion of a single pixel.
+static void convertYUVToRGB(uint8_t nY, uint8_t nU, uint8_t nV, uint8_t& nRed, uint8_t& nGreen, uint8_t& nBlue)
+{
+	int32_t nC = (int32_t)nY - 16;
+	int32_t nD = (int32_t)nU - 128;
+	int32_t nE = (int32_t)nV - 128;
+
+	nRed = clampColor((298 * nC + 409 * nE + 128) >> 8);
+	nGreen = clampColor((298 * nC - 100 * nD - 208 * nE + 128) >> 8);
+	nBlue = clampColor((298 * nC + 516 * nD + 128) >> 8);
+}
+
+static void compareBuffers(const std::vector<uint8_t>& actual, const std::vector<uint8_t>& expected, const std::string& sContext)
+{
+	if (actual.size() != expected.size())
+		throw std::runtime_error(sContext + ": buffer size mismatch (" + std::to_string(actual.size()) + " != " + std::to_string(expected.size()) + ")");
+
+	auto iMismatch = std::mismatch(actual.begin(), actual.end(), expected.begin());
+	if (iMismatch.first != actual.end()) {
+		size_t nIndex = (size_t)(iMismatch.first - actual.begin());
+		throw std::runtime_error(sContext + ": value mismatch at byte " + std::to_string(nIndex) + " (" + std::to_string(*iMismatch.first) + " != " + std::to_string(*iMismatch.second) + ")");
+	}
+}
+
+static uint32_t getBytesPerPixel(LibMCEnv::eImagePixelFormat pixelFormat)
+{
+	switch (pixelFormat) {
+	case LibMCEnv::eImagePixelFormat::GreyScale8bit: return 1;
+	case LibMCEnv::eImagePixelFormat::RGB16bit: return 2;
+	case LibMCEnv::eImagePixelFormat::RGB24bit: return 3;
+	case LibMCEnv::eImagePixelFormat::RGBA32bit: return 4;
+	default:
+		throw std::runtime_error("invalid pixel format");
+	}
+}
+
+static std::string getPixelFormatName(LibMCEnv::eImagePixelFormat pixelFormat)
+{
+	switch (pixelFormat) {
+	case LibMCEnv::eImagePixelFormat::GreyScale8bit: return "grey";
+	case LibMCEnv::eImagePixelFormat::RGB16bit: return "RGB16";
+	case LibMCEnv::eImagePixelFormat::RGB24bit: return "RGB24";
+	case LibMCEnv::eImagePixelFormat::RGBA32bit: return "RGBA32";
+	default:
+		throw std::runtime_error("invalid pixel format");
+	}
+}
+
+// Reference decoding of a single pixel. RGB16 stores red in the lowest 5 bits and blue in the highest 5 bits.
+static void decodePixel(LibMCEnv::eImagePixelFormat pixelFormat, const uint8_t* pPixel, uint8_t* pRGBA)
+{
+	switch (pixelFormat) {
+	case LibMCEnv::eImagePixelFormat::RGB16bit: {
+		uint32_t nColor = (uint32_t)pPixel[0] | ((uint32_t)pPixel[1] << 8);
+		pRGBA[0] = (uint8_t)((nColor & 0x1f) << 3);
+		pRGBA[1] = (uint8_t)(((nColor >> 5) & 0x3f) << 2);
+		pRGBA[2] = (uint8_t)(((nColor >> 11) & 0x1f) << 3);
+		pRGBA[3] = 255;
+		break;
+	}
+	case LibMCEnv::eImagePixelFormat::RGB24bit:
+		pRGBA[0] = pPixel[0];
+		pRGBA[1] = pPixel[1];
+		pRGBA[2] = pPixel[2];
+		pRGBA[3] = 255;
+		break;
+	case LibMCEnv::eImagePixelFormat::RGBA32bit:
+		pRGBA[0] = pPixel[0];
+		pRGBA[1] = pPixel[1];
+		pRGBA[2] = pPixel[2];
+		pRGBA[3] = pPixel[3];
+		break;
+	default:
+		throw std::runtime_error("invalid pixel format");
+	}
+}
+
+// Reference encoding of a single pixel. RGB16 values are stored little endian.
+static void encodePixel(LibMCEnv::eImagePixelFormat pixelFormat, const uint8_t* pRGBA, uint8_t* pPixel)
+{
+	switch (pixelFormat) {
+	case LibMCEnv::eImagePixelFormat::RGB16bit: {
+		uint32_t nColor = (((uint32_t)pRGBA[2] & 0xF8) << 8) | (((uint32_t)pRGBA[1] & 0xFC) << 3) | ((uint32_t)pRGBA[0] >> 3);
+		pPixel[0] = (uint8_t)(nColor & 0xff);
+		pPixel[1] = (uint8_t)(nColor >> 8);
+		break;
+	}
+	case LibMCEnv::eImagePixelFormat::RGB24bit:
+		pPixel[0] = pRGBA[0];
+		pPixel[1] = pRGBA[1];
+		pPixel[2] = pRGBA[2];
+		break;
+	case LibMCEnv::eImagePixelFormat::RGBA32bit:
+		pPixel[0] = pRGBA[0];
+		pPixel[1] = pRGBA[1];
+		pPixel[2] = pRGBA[2];
+		pPixel[3] = pRGBA[3];
+		break;
+	default:
+		throw std::runtime_error("invalid pixel format");
+	}
+}
+
+
+
+/*************************************************************************************************************************
+ Class definition of CTestData
+**************************************************************************************************************************/
+class CTestData : public virtual CPluginData {
+protected:
+
+public:
+
+};
+
+/*************************************************************************************************************************
+ Class definition of CTestState
+**************************************************************************************************************************/
+typedef CState<CTestData> CTestState;
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Init
+**************************************************************************************************************************/
+class CTestState_Init : public virtual CTestState {
+public:
+
+	CTestState_Init(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "init";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		pStateEnvironment->SetNextState("conversion");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Conversion
+**************************************************************************************************************************/
+class CTestState_Conversion : public virtual CTestState {
+public:
+
+	CTestState_Conversion(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "conversion";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		// Odd sizes make sure that the vectorized kernels have to handle a scalar tail in every row.
+		const uint32_t nSizeX = 1021;
+		const uint32_t nSizeY = 67;
+		const size_t nPixelCount = (size_t)nSizeX * nSizeY;
+
+		std::vector<uint8_t> greyValues(nPixelCount);
+		fillPattern(greyValues, 1);
+
+		auto pGreyImage = pStateEnvironment->CreateEmptyImage(nSizeX, nSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+		pGreyImage->SetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::GreyScale8bit, greyValues);
+
+		std::vector<uint8_t> actual;
+		pGreyImage->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::GreyScale8bit, actual);
+		compareBuffers(actual, greyValues, "grey to grey");
+
+		std::vector<uint8_t> expectedRGB(nPixelCount * 3);
+		std::vector<uint8_t> expectedRGBA(nPixelCount * 4);
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			uint8_t nGrey = greyValues.at(nIndex);
+			expectedRGB.at(nIndex * 3) = nGrey;
+			expectedRGB.at(nIndex * 3 + 1) = nGrey;
+			expectedRGB.at(nIndex * 3 + 2) = nGrey;
+			expectedRGBA.at(nIndex * 4) = nGrey;
+			expectedRGBA.at(nIndex * 4 + 1) = nGrey;
+			expectedRGBA.at(nIndex * 4 + 2) = nGrey;
+			expectedRGBA.at(nIndex * 4 + 3) = 255;
+		}
+
+		pGreyImage->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGB24bit, actual);
+		compareBuffers(actual, expectedRGB, "grey to RGB24");
+
+		pGreyImage->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGBA32bit, actual);
+		compareBuffers(actual, expectedRGBA, "grey to RGBA32");
+
+		// Sub rectangle with unaligned start
+		const uint32_t nStartX = 13;
+		const uint32_t nStartY = 7;
+		const uint32_t nCountX = 517;
+		const uint32_t nCountY = 31;
+		std::vector<uint8_t> expectedSubRGBA((size_t)nCountX * nCountY * 4);
+		for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
+			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
+				uint8_t nGrey = greyValues.at((size_t)(nStartY + nRow) * nSizeX + nStartX + nColumn);
+				size_t nTargetIndex = ((size_t)nRow * nCountX + nColumn) * 4;
+				expectedSubRGBA.at(nTargetIndex) = nGrey;
+				expectedSubRGBA.at(nTargetIndex + 1) = nGrey;
+				expectedSubRGBA.at(nTargetIndex + 2) = nGrey;
+				expectedSubRGBA.at(nTargetIndex + 3) = 255;
+			}
+		}
+		pGreyImage->GetPixels(nStartX, nStartY, nCountX, nCountY, LibMCEnv::eImagePixelFormat::RGBA32bit, actual);
+		compareBuffers(actual, expectedSubRGBA, "grey to RGBA32 sub rectangle");
+
+		// Colour images reduced to grey
+		std::vector<uint8_t> rgbValues(nPixelCount * 3);
+		std::vector<uint8_t> rgbaValues(nPixelCount * 4);
+		fillPattern(rgbValues, 2);
+		fillPattern(rgbaValues, 3);
+
+		std::vector<uint8_t> expectedGreyFromRGB(nPixelCount);
+		std::vector<uint8_t> expectedGreyFromRGBA(nPixelCount);
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			expectedGreyFromRGB.at(nIndex) = (uint8_t)(((uint32_t)rgbValues.at(nIndex * 3) + rgbValues.at(nIndex * 3 + 1) + rgbValues.at(nIndex * 3 + 2)) / 3);
+			expectedGreyFromRGBA.at(nIndex) = (uint8_t)(((uint32_t)rgbaValues.at(nIndex * 4) + rgbaValues.at(nIndex * 4 + 1) + rgbaValues.at(nIndex * 4 + 2)) / 3);
+		}
+
+		auto pRGBImage = pStateEnvironment->CreateEmptyImage(nSizeX, nSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::RGB24bit);
+		pRGBImage->SetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGB24bit, rgbValues);
+		pRGBImage->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::GreyScale8bit, actual);
+		compareBuffers(actual, expectedGreyFromRGB, "RGB24 to grey");
+
+		auto pRGBAImage = pStateEnvironment->CreateEmptyImage(nSizeX, nSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::RGBA32bit);
+		pRGBAImage->SetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGBA32bit, rgbaValues);
+		pRGBAImage->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::GreyScale8bit, actual);
+		compareBuffers(actual, expectedGreyFromRGBA, "RGBA32 to grey");
+
+		std::vector<uint8_t> expectedSubGrey((size_t)nCountX * nCountY);
+		for (uint32_t nRow = 0; nRow < nCountY; nRow++)
+			for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++)
+				expectedSubGrey.at((size_t)nRow * nCountX + nColumn) = expectedGreyFromRGBA.at((size_t)(nStartY + nRow) * nSizeX + nStartX + nColumn);
+		pRGBAImage->GetPixels(nStartX, nStartY, nCountX, nCountY, LibMCEnv::eImagePixelFormat::GreyScale8bit, actual);
+		compareBuffers(actual, expectedSubGrey, "RGBA32 to grey sub rectangle");
+
+		// Colour values written into a grey image and grey values written into a colour image
+		auto pGreyTarget = pStateEnvironment->CreateEmptyImage(nSizeX, nSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+		pGreyTarget->SetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGB24bit, rgbValues);
+		pGreyTarget->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::GreyScale8bit, actual);
+		compareBuffers(actual, expectedGreyFromRGB, "set RGB24 into grey");
+
+		auto pRGBATarget = pStateEnvironment->CreateEmptyImage(nSizeX, nSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::RGBA32bit);
+		pRGBATarget->SetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::GreyScale8bit, greyValues);
+		pRGBATarget->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGBA32bit, actual);
+		compareBuffers(actual, expectedRGBA, "set grey into RGBA32");
+
+		pStateEnvironment->LogMessage("Pixel format conversions match the reference.");
+
+		// 1 bit packing is verified through a PNG round trip.
+		const uint32_t nPNGSizeX = 1024;
+		const uint32_t nPNGSizeY = 67;
+		std::vector<uint8_t> pngGreyValues((size_t)nPNGSizeX * nPNGSizeY);
+		fillPattern(pngGreyValues, 4);
+
+		std::vector<uint8_t> expectedThreshold(pngGreyValues.size());
+		for (size_t nIndex = 0; nIndex < pngGreyValues.size(); nIndex++)
+			expectedThreshold.at(nIndex) = (pngGreyValues.at(nIndex) >= 128) ? 255 : 0;
+
+		auto pPNGSource = pStateEnvironment->CreateEmptyImage(nPNGSizeX, nPNGSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+		pPNGSource->SetPixels(0, 0, nPNGSizeX, nPNGSizeY, LibMCEnv::eImagePixelFormat::GreyScale8bit, pngGreyValues);
+
+		auto pImageLoader = pStateEnvironment->CreateImageLoader();
+
+		std::vector<LibMCEnv::ePNGStorageFormat> bitFormats = { LibMCEnv::ePNGStorageFormat::GreyScale1bit, LibMCEnv::ePNGStorageFormat::BlackWhite1bit };
+		for (auto storageFormat : bitFormats) {
+			auto pOptions = pPNGSource->CreatePNGOptions();
+			pOptions->SetStorageFormat(storageFormat);
+
+			auto pPNGImage = pPNGSource->CreatePNGImage(pOptions);
+			std::vector<uint8_t> pngData;
+			pPNGImage->GetPNGDataStream(pngData);
+
+			auto pLoadedImage = pImageLoader->LoadPNGImage(pngData, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+			pLoadedImage->GetPixels(0, 0, nPNGSizeX, nPNGSizeY, LibMCEnv::eImagePixelFormat::GreyScale8bit, actual);
+			compareBuffers(actual, expectedThreshold, "1 bit PNG round trip (format " + std::to_string((int32_t)storageFormat) + ")");
+		}
+
+		pStateEnvironment->LogMessage("1 bit PNG round trips match the reference.");
+
+		pStateEnvironment->SetNextState("rgb16");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_RGB16
+**************************************************************************************************************************/
+class CTestState_RGB16 : public virtual CTestState {
+public:
+
+	CTestState_RGB16(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "rgb16";
+	}
+
+	// Packs a 24 bit clear value, red in the lowest byte, the same way as the reference encoding.
+	static std::vector<uint8_t> createRGB16ClearValues(uint32_t nValue, size_t nPixelCount)
+	{
+		uint8_t RGBA[4] = { (uint8_t)(nValue & 0xff), (uint8_t)((nValue >> 8) & 0xff), (uint8_t)((nValue >> 16) & 0xff), 255 };
+		uint8_t Pixel[2];
+		encodePixel(LibMCEnv::eImagePixelFormat::RGB16bit, RGBA, Pixel);
+
+		std::vector<uint8_t> values(nPixelCount * 2);
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			values.at(nIndex * 2) = Pixel[0];
+			values.at(nIndex * 2 + 1) = Pixel[1];
+		}
+		return values;
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		const uint32_t nSizeX = 333;
+		const uint32_t nSizeY = 41;
+		const size_t nPixelCount = (size_t)nSizeX * nSizeY;
+
+		std::vector<uint8_t> actual;
+
+		// New images are cleared to white
+		auto pImage = pStateEnvironment->CreateEmptyImage(nSizeX, nSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::RGB16bit);
+		if (pImage->GetPixelFormat() != LibMCEnv::eImagePixelFormat::RGB16bit)
+			throw std::runtime_error("RGB16 image has a wrong pixel format");
+		pImage->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGB16bit, actual);
+		compareBuffers(actual, createRGB16ClearValues(0x00ffffffUL, nPixelCount), "RGB16 empty image");
+
+		// Clear keeps the upper 5, 6 and 5 bits of red, green and blue
+		for (uint32_t nClearValue : { 0x00000000UL, 0x00123456UL, 0x00ff00ffUL, 0x0007fcf8UL }) {
+			pImage->Clear(nClearValue);
+			pImage->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGB16bit, actual);
+			compareBuffers(actual, createRGB16ClearValues(nClearValue, nPixelCount), "RGB16 clear with " + std::to_string(nClearValue));
+		}
+
+		// Setting RGB16 pixels must read them back unchanged
+		std::vector<uint8_t> rgb16Values(nPixelCount * 2);
+		fillPattern(rgb16Values, 11);
+		pImage->SetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGB16bit, rgb16Values);
+		pImage->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGB16bit, actual);
+		compareBuffers(actual, rgb16Values, "RGB16 set pixels");
+
+		// PNG round trip: an RGB24 image is loaded as RGB16 and expanded again
+		std::vector<uint8_t> rgbValues(nPixelCount * 3);
+		fillPattern(rgbValues, 12);
+		std::vector<uint8_t> expectedRGB16(nPixelCount * 2);
+		std::vector<uint8_t> expectedRGB(nPixelCount * 3);
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			uint8_t RGBA[4];
+			decodePixel(LibMCEnv::eImagePixelFormat::RGB24bit, &rgbValues.at(nIndex * 3), RGBA);
+			encodePixel(LibMCEnv::eImagePixelFormat::RGB16bit, RGBA, &expectedRGB16.at(nIndex * 2));
+			decodePixel(LibMCEnv::eImagePixelFormat::RGB16bit, &expectedRGB16.at(nIndex * 2), RGBA);
+			encodePixel(LibMCEnv::eImagePixelFormat::RGB24bit, RGBA, &expectedRGB.at(nIndex * 3));
+		}
+
+		auto pRGBImage = pStateEnvironment->CreateEmptyImage(nSizeX, nSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::RGB24bit);
+		pRGBImage->SetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGB24bit, rgbValues);
+
+		auto pOptions = pRGBImage->CreatePNGOptions();
+		pOptions->SetStorageFormat(LibMCEnv::ePNGStorageFormat::RGB24bit);
+		std::vector<uint8_t> pngData;
+		pRGBImage->CreatePNGImage(pOptions)->GetPNGDataStream(pngData);
+
+		auto pImageLoader = pStateEnvironment->CreateImageLoader();
+		auto pLoadedImage = pImageLoader->LoadPNGImage(pngData, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::RGB16bit);
+		if (pLoadedImage->GetPixelFormat() != LibMCEnv::eImagePixelFormat::RGB16bit)
+			throw std::runtime_error("PNG has not been loaded as RGB16 image");
+
+		pLoadedImage->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGB16bit, actual);
+		compareBuffers(actual, expectedRGB16, "RGB16 PNG round trip");
+		pLoadedImage->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGB24bit, actual);
+		compareBuffers(actual, expectedRGB, "RGB16 PNG round trip as RGB24");
+
+		pStateEnvironment->LogMessage("RGB16 images match the reference.");
+
+		pStateEnvironment->SetNextState("rawmemory");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_RawMemory
+**************************************************************************************************************************/
+class CTestState_RawMemory : public virtual CTestState {
+public:
+
+	CTestState_RawMemory(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "rawmemory";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		const uint32_t nSizeX = 1021;
+		const uint32_t nSizeY = 67;
+		const uint32_t nStartX = 13;
+		const uint32_t nStartY = 7;
+		const uint32_t nCountX = 517;
+		const uint32_t nCountY = 31;
+		const uint8_t nPaddingValue = 0xA5;
+
+		std::vector<LibMCEnv::eImagePixelFormat> PixelFormats = { LibMCEnv::eImagePixelFormat::RGB16bit, LibMCEnv::eImagePixelFormat::RGB24bit, LibMCEnv::eImagePixelFormat::RGBA32bit };
+
+		// Line paddings of 0 bytes, an odd number of bytes and a full cache line. The padding must stay untouched.
+		std::vector<uint32_t> LinePaddings = { 0, 5, 64 };
+
+		uint32_t nSeed = 10;
+		for (auto sourceFormat : PixelFormats) {
+			uint32_t nSourceBytesPerPixel = getBytesPerPixel(sourceFormat);
+			std::vector<uint8_t> sourceValues((size_t)nSizeX * nSizeY * nSourceBytesPerPixel);
+			fillPattern(sourceValues, nSeed++);
+
+			// SetPixels stores RGBA32 values as opaque pixels, so the source alpha is set to 255 as well.
+			if (sourceFormat == LibMCEnv::eImagePixelFormat::RGBA32bit) {
+				for (size_t nIndex = 3; nIndex < sourceValues.size(); nIndex += 4)
+					sourceValues.at(nIndex) = 255;
+			}
+
+			auto pSourceImage = pStateEnvironment->CreateEmptyImage(nSizeX, nSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, sourceFormat);
+			pSourceImage->SetPixels(0, 0, nSizeX, nSizeY, sourceFormat, sourceValues);
+
+			for (auto targetFormat : PixelFormats) {
+				uint32_t nTargetBytesPerPixel = getBytesPerPixel(targetFormat);
+
+				for (auto nLinePadding : LinePaddings) {
+					uint32_t nYLineOffset = nCountX * nTargetBytesPerPixel + nLinePadding;
+					std::string sContext = "WriteToRawMemory " + getPixelFormatName(sourceFormat) + " to " + getPixelFormatName(targetFormat) + " with line offset " + std::to_string(nYLineOffset);
+
+					std::vector<uint8_t> expected((size_t)nYLineOffset * nCountY, nPaddingValue);
+					for (uint32_t nRow = 0; nRow < nCountY; nRow++) {
+						for (uint32_t nColumn = 0; nColumn < nCountX; nColumn++) {
+							size_t nSourceIndex = ((size_t)(nStartY + nRow) * nSizeX + nStartX + nColumn) * nSourceBytesPerPixel;
+							size_t nTargetIndex = (size_t)nRow * nYLineOffset + (size_t)nColumn * nTargetBytesPerPixel;
+
+							uint8_t RGBA[4];
+							decodePixel(sourceFormat, &sourceValues.at(nSourceIndex), RGBA);
+							encodePixel(targetFormat, RGBA, &expected.at(nTargetIndex));
+						}
+					}
+
+					std::vector<uint8_t> actual((size_t)nYLineOffset * nCountY, nPaddingValue);
+					pSourceImage->WriteToRawMemory(nStartX, nStartY, nCountX, nCountY, targetFormat, (LibMCEnv_pvoid)actual.data(), nYLineOffset);
+					compareBuffers(actual, expected, sContext);
+				}
+			}
+		}
+
+		pStateEnvironment->LogMessage("Raw memory writes of all RGB16, RGB24 and RGBA32 pairs match the reference.");
+
+		pStateEnvironment->SetNextState("yuy2");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_YUY2
+**************************************************************************************************************************/
+class CTestState_YUY2 : public virtual CTestState {
+public:
+
+	CTestState_YUY2(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "yuy2";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		// Odd widths split macro pixels across rows. The largest image is converted on multiple threads,
+		// so that macro pixels are also split between the row ranges of two threads.
+		std::vector<std::pair<uint32_t, uint32_t>> ImageSizes = { { 646, 37 }, { 645, 38 }, { 1, 2 }, { 1201, 1198 } };
+
+		auto pImageLoader = pStateEnvironment->CreateImageLoader();
+
+		for (auto& imageSize : ImageSizes) {
+			const uint32_t nSizeX = imageSize.first;
+			const uint32_t nSizeY = imageSize.second;
+			const size_t nPixelCount = (size_t)nSizeX * nSizeY;
+			const std::string sSizeName = std::to_string(nSizeX) + "x" + std::to_string(nSizeY);
+
+			std::vector<uint8_t> yuy2Values(nPixelCount * 2);
+			fillPattern(yuy2Values, 5);
+
+			// The first macro pixels cover the extremes of the value range, which exercise the clamping.
+			const uint8_t extremeValues[16] = { 0, 0, 255, 255, 255, 255, 0, 0, 16, 128, 235, 128, 255, 0, 0, 255 };
+			std::copy_n(std::begin(extremeValues), std::min(sizeof(extremeValues), yuy2Values.size()), yuy2Values.begin());
+
+			std::vector<uint8_t> expectedGrey(nPixelCount);
+			std::vector<uint8_t> expectedRGB(nPixelCount * 3);
+			std::vector<uint8_t> expectedRGBA(nPixelCount * 4);
+			for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+				size_t nPairAddress = (nIndex / 2) * 4;
+				uint8_t nY = yuy2Values.at(nPairAddress + (nIndex % 2) * 2);
+				uint8_t nU = yuy2Values.at(nPairAddress + 1);
+				uint8_t nV = yuy2Values.at(nPairAddress + 3);
+
+				uint8_t nRed, nGreen, nBlue;
+				convertYUVToRGB(nY, nU, nV, nRed, nGreen, nBlue);
+
+				expectedGrey.at(nIndex) = (uint8_t)(((uint32_t)nRed + nGreen + nBlue) / 3);
+				expectedRGB.at(nIndex * 3) = nRed;
+				expectedRGB.at(nIndex * 3 + 1) = nGreen;
+				expectedRGB.at(nIndex * 3 + 2) = nBlue;
+				expectedRGBA.at(nIndex * 4) = nRed;
+				expectedRGBA.at(nIndex * 4 + 1) = nGreen;
+				expectedRGBA.at(nIndex * 4 + 2) = nBlue;
+				expectedRGBA.at(nIndex * 4 + 3) = 255;
+			}
+
+			std::vector<uint8_t> actual;
+
+			auto pGreyImage = pImageLoader->CreateImageFromRawYUY2Data(yuy2Values, nSizeX, nSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+			pGreyImage->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::GreyScale8bit, actual);
+			compareBuffers(actual, expectedGrey, "YUY2 to grey, " + sSizeName);
+
+			auto pRGBImage = pImageLoader->CreateImageFromRawYUY2Data(yuy2Values, nSizeX, nSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::RGB24bit);
+			pRGBImage->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGB24bit, actual);
+			compareBuffers(actual, expectedRGB, "YUY2 to RGB24, " + sSizeName);
+
+			auto pRGBAImage = pImageLoader->CreateImageFromRawYUY2Data(yuy2Values, nSizeX, nSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::RGBA32bit);
+			pRGBAImage->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGBA32bit, actual);
+			compareBuffers(actual, expectedRGBA, "YUY2 to RGBA32, " + sSizeName);
+
+			// Every pixel of a RGB16 conversion must be written, not only the first one.
+			std::vector<uint8_t> expectedRGB16(nPixelCount * 2);
+			for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+				uint16_t nColor = ((expectedRGB.at(nIndex * 3 + 2) & 0xF8) << 8) | ((expectedRGB.at(nIndex * 3 + 1) & 0xFC) << 3) | (expectedRGB.at(nIndex * 3) >> 3);
+				expectedRGB16.at(nIndex * 2) = (uint8_t)(nColor & 0xff);
+				expectedRGB16.at(nIndex * 2 + 1) = (uint8_t)(nColor >> 8);
+			}
+
+			auto pRGB16Image = pImageLoader->CreateImageFromRawYUY2Data(yuy2Values, nSizeX, nSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::RGB16bit);
+			pRGB16Image->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGB16bit, actual);
+			compareBuffers(actual, expectedRGB16, "YUY2 to RGB16, " + sSizeName);
+		}
+
+		pStateEnvironment->LogMessage("YUY2 conversions match the reference.");
+
+		pStateEnvironment->SetNextState("pngencoding");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_PNGEncoding
+**************************************************************************************************************************/
+class CTestState_PNGEncoding : public virtual CTestState {
+public:
+
+	CTestState_PNGEncoding(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "pngencoding";
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		// Odd width, so that sub-byte scanlines end with padding bits
+		const uint32_t nSizeX = 1021;
+		const uint32_t nSizeY = 67;
+		const size_t nPixelCount = (size_t)nSizeX * nSizeY;
+
+		std::vector<uint8_t> greyValues(nPixelCount);
+		fillPattern(greyValues, 8);
+		std::vector<uint8_t> rgbaValues(nPixelCount * 4);
+		fillPattern(rgbaValues, 9);
+
+		std::vector<uint8_t> rgbValues(nPixelCount * 3);
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++)
+			std::copy(&rgbaValues.at(nIndex * 4), &rgbaValues.at(nIndex * 4) + 3, &rgbValues.at(nIndex * 3));
+
+		auto pGreyImage = pStateEnvironment->CreateEmptyImage(nSizeX, nSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+		pGreyImage->SetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::GreyScale8bit, greyValues);
+		auto pRGBAImage = pStateEnvironment->CreateEmptyImage(nSizeX, nSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::RGBA32bit);
+		pRGBAImage->SetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGBA32bit, rgbaValues);
+
+		// Expected grey values after quantisation to the PNG bit depth
+		std::vector<uint8_t> expected1bit(nPixelCount), expected2bit(nPixelCount), expected4bit(nPixelCount);
+		for (size_t nIndex = 0; nIndex < nPixelCount; nIndex++) {
+			uint8_t nGrey = greyValues.at(nIndex);
+			expected1bit.at(nIndex) = (nGrey >= 128) ? 255 : 0;
+			expected2bit.at(nIndex) = (uint8_t)((nGrey / 64) * 85);
+			expected4bit.at(nIndex) = (uint8_t)((nGrey / 16) * 17);
+		}
+
+		struct sFormatCase {
+			LibMCEnv::ePNGStorageFormat m_StorageFormat;
+			LibMCEnv::eImagePixelFormat m_LoadFormat;
+			bool m_bFromColorImage;
+			const std::vector<uint8_t>* m_pExpected;
+		};
+
+		std::vector<sFormatCase> formatCases = {
+			{ LibMCEnv::ePNGStorageFormat::BlackWhite1bit, LibMCEnv::eImagePixelFormat::GreyScale8bit, false, &expected1bit },
+			{ LibMCEnv::ePNGStorageFormat::GreyScale1bit, LibMCEnv::eImagePixelFormat::GreyScale8bit, false, &expected1bit },
+			{ LibMCEnv::ePNGStorageFormat::GreyScale2bit, LibMCEnv::eImagePixelFormat::GreyScale8bit, false, &expected2bit },
+			{ LibMCEnv::ePNGStorageFormat::GreyScale4bit, LibMCEnv::eImagePixelFormat::GreyScale8bit, false, &expected4bit },
+			{ LibMCEnv::ePNGStorageFormat::GreyScale8bit, LibMCEnv::eImagePixelFormat::GreyScale8bit, false, &greyValues },
+			{ LibMCEnv::ePNGStorageFormat::RGB24bit, LibMCEnv::eImagePixelFormat::RGB24bit, true, &rgbValues },
+			{ LibMCEnv::ePNGStorageFormat::RGBA32bit, LibMCEnv::eImagePixelFormat::RGBA32bit, true, &rgbaValues }
+		};
+
+		struct sEncoderCase {
+			LibMCEnv::ePNGEncoderBackend m_EncoderBackend;
+			LibMCEnv::ePNGFilterStrategy m_FilterStrategy;
+			uint32_t m_nCompressionLevel;
+			uint32_t m_nThreadCount;
+		};
+
+		std::vector<sEncoderCase> encoderCases = {
+			{ LibMCEnv::ePNGEncoderBackend::LodePNG, LibMCEnv::ePNGFilterStrategy::Adaptive, 6, 0 },
+			{ LibMCEnv::ePNGEncoderBackend::ZLib, LibMCEnv::ePNGFilterStrategy::NoFilter, 0, 1 },
+			{ LibMCEnv::ePNGEncoderBackend::ZLib, LibMCEnv::ePNGFilterStrategy::Sub, 1, 1 },
+			{ LibMCEnv::ePNGEncoderBackend::ZLib, LibMCEnv::ePNGFilterStrategy::Up, 6, 4 },
+			{ LibMCEnv::ePNGEncoderBackend::ZLib, LibMCEnv::ePNGFilterStrategy::Adaptive, 9, 0 }
+		};
+
+		auto pImageLoader = pStateEnvironment->CreateImageLoader();
+		std::vector<uint8_t> actual;
+
+		for (auto& formatCase : formatCases) {
+			for (auto& encoderCase : encoderCases) {
+				auto pSourceImage = formatCase.m_bFromColorImage ? pRGBAImage : pGreyImage;
+
+				auto pOptions = pSourceImage->CreatePNGOptions();
+				pOptions->SetStorageFormat(formatCase.m_StorageFormat);
+				pOptions->SetEncoderBackend(encoderCase.m_EncoderBackend);
+				pOptions->SetFilterStrategy(encoderCase.m_FilterStrategy);
+				pOptions->SetCompressionLevel(encoderCase.m_nCompressionLevel);
+				pOptions->SetThreadCount(encoderCase.m_nThreadCount);
+
+				std::vector<uint8_t> pngData;
+				pSourceImage->CreatePNGImage(pOptions)->GetPNGDataStream(pngData);
+
+				auto pLoadedImage = pImageLoader->LoadPNGImage(pngData, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, formatCase.m_LoadFormat);
+				pLoadedImage->GetPixels(0, 0, nSizeX, nSizeY, formatCase.m_LoadFormat, actual);
+
+				compareBuffers(actual, *formatCase.m_pExpected, "PNG round trip (format " + std::to_string((int32_t)formatCase.m_StorageFormat) +
+					", encoder " + std::to_string((int32_t)encoderCase.m_EncoderBackend) + ", filter " + std::to_string((int32_t)encoderCase.m_FilterStrategy) + ")");
+			}
+		}
+
+		// Images that need more than one stripe must give the same result with any number of threads.
+		const uint32_t nLargeSizeX = 2048;
+		const uint32_t nLargeSizeY = 1536;
+		std::vector<uint8_t> largeGreyValues((size_t)nLargeSizeX * nLargeSizeY);
+		fillPattern(largeGreyValues, 10);
+		auto pLargeImage = pStateEnvironment->CreateEmptyImage(nLargeSizeX, nLargeSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+		pLargeImage->SetPixels(0, 0, nLargeSizeX, nLargeSizeY, LibMCEnv::eImagePixelFormat::GreyScale8bit, largeGreyValues);
+
+		std::vector<uint8_t> referencePNGData;
+		for (uint32_t nThreadCount : { 2, 3, 0 }) {
+			auto pOptions = pLargeImage->CreatePNGOptions();
+			pOptions->SetStorageFormat(LibMCEnv::ePNGStorageFormat::GreyScale8bit);
+			pOptions->SetThreadCount(nThreadCount);
+
+			std::vector<uint8_t> pngData;
+			pLargeImage->CreatePNGImage(pOptions)->GetPNGDataStream(pngData);
+			if (referencePNGData.empty())
+				referencePNGData = pngData;
+			compareBuffers(pngData, referencePNGData, "striped PNG stream with " + std::to_string(nThreadCount) + " threads");
+		}
+
+		auto pLoadedLargeImage = pImageLoader->LoadPNGImage(referencePNGData, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+		pLoadedLargeImage->GetPixels(0, 0, nLargeSizeX, nLargeSizeY, LibMCEnv::eImagePixelFormat::GreyScale8bit, actual);
+		compareBuffers(actual, largeGreyValues, "striped PNG round trip");
+
+		pStateEnvironment->LogMessage("PNG round trips match the reference.");
+
+		pStateEnvironment->SetNextState("benchmark");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Benchmark
+**************************************************************************************************************************/
+class CTestState_Benchmark : public virtual CTestState {
+public:
+
+	CTestState_Benchmark(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "benchmark";
+	}
+
+	static std::string formatThroughput(uint64_t nPixelCount, uint64_t nDurationInMicroseconds)
+	{
+		double dMegaPixelsPerSecond = (double)nPixelCount / (double)std::max(nDurationInMicroseconds, (uint64_t)1);
+		return std::to_string(nDurationInMicroseconds / 1000) + "ms (" + std::to_string((uint64_t)dMegaPixelsPerSecond) + " MPixel/s)";
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		const uint32_t nSizeX = 3840;
+		const uint32_t nSizeY = 2160;
+		const uint32_t nIterations = 10;
+		const uint64_t nTotalPixelCount = (uint64_t)nSizeX * nSizeY * nIterations;
+
+		std::vector<uint8_t> greyValues((size_t)nSizeX * nSizeY);
+		fillPattern(greyValues, 6);
+
+		auto pGreyImage = pStateEnvironment->CreateEmptyImage(nSizeX, nSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+		pGreyImage->SetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::GreyScale8bit, greyValues);
+
+		std::vector<uint8_t> buffer;
+
+		uint64_t nStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+		for (uint32_t nIteration = 0; nIteration < nIterations; nIteration++)
+			pGreyImage->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGBA32bit, buffer);
+		pStateEnvironment->LogMessage("Grey to RGBA32: " + formatThroughput(nTotalPixelCount, pStateEnvironment->GetGlobalTimerInMicroseconds() - nStartTime));
+
+		auto pRGBAImage = pStateEnvironment->CreateEmptyImage(nSizeX, nSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::RGBA32bit);
+		pRGBAImage->SetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::RGBA32bit, buffer);
+
+		nStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+		for (uint32_t nIteration = 0; nIteration < nIterations; nIteration++)
+			pRGBAImage->GetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::GreyScale8bit, buffer);
+		pStateEnvironment->LogMessage("RGBA32 to grey: " + formatThroughput(nTotalPixelCount, pStateEnvironment->GetGlobalTimerInMicroseconds() - nStartTime));
+
+		std::vector<uint8_t> yuy2Values((size_t)nSizeX * nSizeY * 2);
+		fillPattern(yuy2Values, 7);
+
+		nStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+		for (uint32_t nIteration = 0; nIteration < nIterations; nIteration++)
+			pRGBAImage->SetPixelsFromRawYUY2Data(yuy2Values);
+		pStateEnvironment->LogMessage("YUY2 to RGBA32: " + formatThroughput(nTotalPixelCount, pStateEnvironment->GetGlobalTimerInMicroseconds() - nStartTime));
+
+		// PNG export of a layer like image, comparing time and size of the encoders
+		std::vector<uint8_t> layerValues((size_t)nSizeX * nSizeY);
+		for (uint32_t nY = 0; nY < nSizeY; nY++)
+			for (uint32_t nX = 0; nX < nSizeX; nX++)
+				layerValues.at((size_t)nY * nSizeX + nX) = ((nX / 37 + nY / 53) % 3 == 0) ? 255 : 0;
+		auto pLayerImage = pStateEnvironment->CreateEmptyImage(nSizeX, nSizeY, IMAGEDATATEST_DPI, IMAGEDATATEST_DPI, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+		pLayerImage->SetPixels(0, 0, nSizeX, nSizeY, LibMCEnv::eImagePixelFormat::GreyScale8bit, layerValues);
+
+		for (auto storageFormat : { LibMCEnv::ePNGStorageFormat::BlackWhite1bit, LibMCEnv::ePNGStorageFormat::GreyScale8bit }) {
+			for (auto encoderBackend : { LibMCEnv::ePNGEncoderBackend::LodePNG, LibMCEnv::ePNGEncoderBackend::ZLib }) {
+				for (uint32_t nCompressionLevel : { 1, 6 }) {
+					for (uint32_t nThreadCount : { 1, 0 }) {
+						// LodePNG does not use threads
+						if ((encoderBackend == LibMCEnv::ePNGEncoderBackend::LodePNG) && (nThreadCount != 1))
+							continue;
+
+						auto pOptions = pLayerImage->CreatePNGOptions();
+						pOptions->SetStorageFormat(storageFormat);
+						pOptions->SetEncoderBackend(encoderBackend);
+						pOptions->SetCompressionLevel(nCompressionLevel);
+						pOptions->SetThreadCount(nThreadCount);
+
+						nStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+						auto pPNGImage = pLayerImage->CreatePNGImage(pOptions);
+						uint64_t nDuration = pStateEnvironment->GetGlobalTimerInMicroseconds() - nStartTime;
+
+						std::vector<uint8_t> pngData;
+						pPNGImage->GetPNGDataStream(pngData);
+
+						pStateEnvironment->LogMessage("PNG export (format " + std::to_string((int32_t)storageFormat) + ", " +
+							((encoderBackend == LibMCEnv::ePNGEncoderBackend::LodePNG) ? "LodePNG" : "ZLib") +
+							", level " + std::to_string(nCompressionLevel) + ", threads " + std::to_string(nThreadCount) + "): " +
+							formatThroughput((uint64_t)nSizeX * nSizeY, nDuration) + ", " + std::to_string(pngData.size()) + " bytes");
+					}
+				}
+			}
+		}
+
+		pStateEnvironment->SetNextState("success");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Success
+**************************************************************************************************************************/
+class CTestState_Success : public virtual CTestState {
+public:
+
+	CTestState_Success(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "success";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		pStateEnvironment->SetNextState("success");
+
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_FatalError
+**************************************************************************************************************************/
+class CTestState_FatalError : public virtual CTestState {
+public:
+
+	CTestState_FatalError(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "fatalerror";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		pStateEnvironment->SetNextState("fatalerror");
+	}
+
+};
+
+
+
+/*************************************************************************************************************************
+ Class definition of CStateFactory
+**************************************************************************************************************************/
+
+CStateFactory::CStateFactory(const std::string& sInstanceName)
+{
+	m_pPluginData = std::make_shared<CTestData>();
+}
+
+IState* CStateFactory::CreateState(const std::string& sStateName)
+{
+
+	IState* pStateInstance = nullptr;
+
+	if (createStateInstanceByName<CTestState_Init>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_Conversion>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_RGB16>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_RawMemory>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_YUY2>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_PNGEncoding>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_Benchmark>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+
+	if (createStateInstanceByName<CTestState_Success>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_FatalError>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDSTATENAME);
+
+}
+
+
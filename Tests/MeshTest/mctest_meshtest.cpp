@@ -0,0 +1,719 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "libmcplugin_impl.hpp"
+
+using namespace LibMCPlugin::Impl;
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+
+/*************************************************************************************************************************
+ Import functionality for Driver into current plugin
+**************************************************************************************************************************/
+__NODRIVERIMPORT
+
+
+#define MESHTEST_MAJORRADIUS 40.0
+#define MESHTEST_MINORRADIUS 10.0
+#define MESHTEST_WRITEBUFFERSIZE (1024 * 1024)
+
+#define MESHTEST_QUERYCOUNT 500
+#define MESHTEST_DISTANCETOLERANCE 1.0E-4
+#define MESHTEST_BOXTOLERANCE 1.0E-4
+
+/*************************************************************************************************************************
+ Helper functions
+**************************************************************************************************************************/
+
+// Torus with nRingCount x nSideCount vertices and two triangles per quad. An open torus omits the quads that close
+// the tube along its sides, which leaves two boundary loops. bFlipOneTriangle reverses the orientation of triangle 0.
+typedef struct _sTestTorus {
+	uint32_t m_nRingCount;
+	uint32_t m_nSideCount;
+	bool m_bOpen;
+	bool m_bFlipOneTriangle;
+} sTestTorus;
+
+static uint32_t getTorusTriangleCount(const sTestTorus& torus)
+{
+	uint32_t nSideQuadCount = torus.m_bOpen ? (torus.m_nSideCount - 1) : torus.m_nSideCount;
+	return torus.m_nRingCount * nSideQuadCount * 2;
+}
+
+class CTest3MFWriter {
+private:
+	LibMCEnv::PTempStreamWriter m_pEntryWriter;
+	std::string m_sBuffer;
+
+public:
+
+	CTest3MFWriter(LibMCEnv::PTempStreamWriter pEntryWriter)
+		: m_pEntryWriter(pEntryWriter)
+	{
+		m_sBuffer.reserve(MESHTEST_WRITEBUFFERSIZE + 256);
+	}
+
+	void write(const std::string& sData)
+	{
+		m_sBuffer.append(sData);
+		if (m_sBuffer.size() >= MESHTEST_WRITEBUFFERSIZE)
+			flush();
+	}
+
+	void flush()
+	{
+		if (!m_sBuffer.empty())
+			m_pEntryWriter->WriteString(m_sBuffer);
+		m_sBuffer.clear();
+	}
+};
+
+static LibMCEnv::PStreamReader createTorus3MF(LibMCEnv::PStateEnvironment pStateEnvironment, const std::string& sName, const sTestTorus& torus)
+{
+	auto pZIPWriter = pStateEnvironment->CreateZIPStream(sName + ".3mf");
+
+	auto pContentTypes = pZIPWriter->CreateZIPEntry("[Content_Types].xml");
+	pContentTypes->WriteString("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<Types xmlns=\"http://schemas.openxmlformats.org/package/2006/content-types\">"
+		"<Default Extension=\"rels\" ContentType=\"application/vnd.openxmlformats-package.relationships+xml\"/>"
+		"<Default Extension=\"model\" ContentType=\"application/vnd.ms-package.3dmanufacturing-3dmodel+xml\"/></Types>");
+
+	auto pRelationships = pZIPWriter->CreateZIPEntry("_rels/.rels");
+	pRelationships->WriteString("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">"
+		"<Relationship Target=\"/3D/3dmodel.model\" Id=\"rel0\" Type=\"http://schemas.microsoft.com/3dmanufacturing/2013/01/3dmodel\"/></Relationships>");
+
+	CTest3MFWriter modelWriter(pZIPWriter->CreateZIPEntry("3D/3dmodel.model"));
+	modelWriter.write("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<model unit=\"millimeter\" xml:lang=\"en-US\" xmlns=\"http://schemas.microsoft.com/3dmanufacturing/core/2015/02\">"
+		"<resources><object id=\"1\" name=\"" + sName + "\" type=\"model\"><mesh><vertices>");
+
+	const double dPi = 3.14159265358979323846;
+	for (uint32_t nRing = 0; nRing < torus.m_nRingCount; nRing++) {
+		double dU = 2.0 * dPi * nRing / torus.m_nRingCount;
+		for (uint32_t nSide = 0; nSide < torus.m_nSideCount; nSide++) {
+			double dV = 2.0 * dPi * nSide / torus.m_nSideCount;
+			double dRadius = MESHTEST_MAJORRADIUS + MESHTEST_MINORRADIUS * cos(dV);
+			modelWriter.write("<vertex x=\"" + std::to_string(dRadius * cos(dU)) + "\" y=\"" + std::to_string(dRadius * sin(dU)) + "\" z=\"" + std::to_string(MESHTEST_MINORRADIUS * sin(dV)) + "\"/>");
+		}
+	}
+
+	modelWriter.write("</vertices><triangles>");
+
+	uint32_t nSideQuadCount = torus.m_bOpen ? (torus.m_nSideCount - 1) : torus.m_nSideCount;
+	bool bFirstTriangle = true;
+	for (uint32_t nRing = 0; nRing < torus.m_nRingCount; nRing++) {
+		uint32_t nNextRing = (nRing + 1) % torus.m_nRingCount;
+		for (uint32_t nSide = 0; nSide < nSideQuadCount; nSide++) {
+			uint32_t nNextSide = (nSide + 1) % torus.m_nSideCount;
+			uint32_t nA = nRing * torus.m_nSideCount + nSide;
+			uint32_t nB = nNextRing * torus.m_nSideCount + nSide;
+			uint32_t nC = nNextRing * torus.m_nSideCount + nNextSide;
+			uint32_t nD = nRing * torus.m_nSideCount + nNextSide;
+
+			if (bFirstTriangle && torus.m_bFlipOneTriangle)
+				modelWriter.write("<triangle v1=\"" + std::to_string(nA) + "\" v2=\"" + std::to_string(nC) + "\" v3=\"" + std::to_string(nB) + "\"/>");
+			else
+				modelWriter.write("<triangle v1=\"" + std::to_string(nA) + "\" v2=\"" + std::to_string(nB) + "\" v3=\"" + std::to_string(nC) + "\"/>");
+			modelWriter.write("<triangle v1=\"" + std::to_string(nA) + "\" v2=\"" + std::to_string(nC) + "\" v3=\"" + std::to_string(nD) + "\"/>");
+			bFirstTriangle = false;
+		}
+	}
+
+	modelWriter.write("</triangles></mesh></object></resources><build><item objectid=\"1\"/></build></model>");
+	modelWriter.flush();
+
+	return pZIPWriter->GetStreamReader();
+}
+
+// Loads the single solid of a 3MF stream and measures the 3MF parsing and the mesh topology build separately.
+static LibMCEnv::PMeshObject loadTestMesh(LibMCEnv::PStateEnvironment pStateEnvironment, LibMCEnv::PStreamReader pStreamReader, double& dParseTime, double& dTopologyTime)
+{
+	auto pSceneHandler = pStateEnvironment->CreateSceneHandler();
+
+	auto startTime = std::chrono::steady_clock::now();
+	auto pModelData = pSceneHandler->Load3MFFromStream(pStreamReader);
+	auto parsedTime = std::chrono::steady_clock::now();
+
+	if (pModelData->GetSolidCount() != 1)
+		throw std::runtime_error("3MF has " + std::to_string(pModelData->GetSolidCount()) + " solids instead of 1");
+
+	auto pMeshObject = pModelData->GetSolidMesh(0)->CreateCopiedMesh();
+	auto endTime = std::chrono::steady_clock::now();
+
+	dParseTime = std::chrono::duration<double, std::milli>(parsedTime - startTime).count();
+	dTopologyTime = std::chrono::duration<double, std::milli>(endTime - parsedTime).count();
+
+	return pMeshObject;
+}
+
+/*************************************************************************************************************************
+ Brute force reference queries
+**************************************************************************************************************************/
+
+class CBruteForceMesh {
+private:
+	std::vector<std::vector<double>> m_Triangles;
+	std::vector<uint32_t> m_TriangleIDs;
+
+	static double dot(const double* pA, const double* pB)
+	{
+		return pA[0] * pB[0] + pA[1] * pB[1] + pA[2] * pB[2];
+	}
+
+	static void cross(const double* pA, const double* pB, double* pResult)
+	{
+		pResult[0] = pA[1] * pB[2] - pA[2] * pB[1];
+		pResult[1] = pA[2] * pB[0] - pA[0] * pB[2];
+		pResult[2] = pA[0] * pB[1] - pA[1] * pB[0];
+	}
+
+	// Separating axis test with the three box normals, the triangle normal and the nine edge cross products.
+	static bool triangleOverlapsBox(const double* pTriangle, const double* pCenter, const double* pHalfSize)
+	{
+		double vVertices[3][3];
+		double vEdges[3][3];
+		for (uint32_t nVertex = 0; nVertex < 3; nVertex++)
+			for (uint32_t nAxis = 0; nAxis < 3; nAxis++)
+				vVertices[nVertex][nAxis] = pTriangle[nVertex * 3 + nAxis] - pCenter[nAxis];
+		for (uint32_t nEdge = 0; nEdge < 3; nEdge++)
+			for (uint32_t nAxis = 0; nAxis < 3; nAxis++)
+				vEdges[nEdge][nAxis] = vVertices[(nEdge + 1) % 3][nAxis] - vVertices[nEdge][nAxis];
+
+		std::vector<std::vector<double>> Axes = { { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 } };
+		std::vector<double> normal(3);
+		cross(vEdges[0], vEdges[1], normal.data());
+		Axes.push_back(normal);
+		for (uint32_t nEdge = 0; nEdge < 3; nEdge++) {
+			for (uint32_t nBoxAxis = 0; nBoxAxis < 3; nBoxAxis++) {
+				std::vector<double> axis(3);
+				cross(vEdges[nEdge], Axes[nBoxAxis].data(), axis.data());
+				Axes.push_back(axis);
+			}
+		}
+
+		for (auto& axis : Axes) {
+			if (dot(axis.data(), axis.data()) < 1.0E-20)
+				continue;
+
+			double dProjection0 = dot(axis.data(), vVertices[0]);
+			double dProjection1 = dot(axis.data(), vVertices[1]);
+			double dProjection2 = dot(axis.data(), vVertices[2]);
+			double dMin = std::min(dProjection0, std::min(dProjection1, dProjection2));
+			double dMax = std::max(dProjection0, std::max(dProjection1, dProjection2));
+			double dRadius = pHalfSize[0] * fabs(axis[0]) + pHalfSize[1] * fabs(axis[1]) + pHalfSize[2] * fabs(axis[2]);
+			if ((dMin > dRadius) || (dMax < -dRadius))
+				return false;
+		}
+
+		return true;
+	}
+
+	// Closest point on a triangle by Voronoi region classification (Ericson, Real-Time Collision Detection 5.1.5).
+	static void closestPointOnTriangle(const double* pTriangle, const double* pPoint, double* pResult)
+	{
+		const double* pA = &pTriangle[0];
+		const double* pB = &pTriangle[3];
+		const double* pC = &pTriangle[6];
+		double vAB[3], vAC[3], vAP[3], vBP[3], vCP[3];
+		for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+			vAB[nAxis] = pB[nAxis] - pA[nAxis];
+			vAC[nAxis] = pC[nAxis] - pA[nAxis];
+			vAP[nAxis] = pPoint[nAxis] - pA[nAxis];
+			vBP[nAxis] = pPoint[nAxis] - pB[nAxis];
+			vCP[nAxis] = pPoint[nAxis] - pC[nAxis];
+		}
+
+		double dD1 = dot(vAB, vAP), dD2 = dot(vAC, vAP);
+		double dD3 = dot(vAB, vBP), dD4 = dot(vAC, vBP);
+		double dD5 = dot(vAB, vCP), dD6 = dot(vAC, vCP);
+		double dVA = dD3 * dD6 - dD5 * dD4;
+		double dVB = dD5 * dD2 - dD1 * dD6;
+		double dVC = dD1 * dD4 - dD3 * dD2;
+
+		double dU = 0.0, dV = 0.0;
+		if ((dD1 <= 0.0) && (dD2 <= 0.0)) {
+		}
+		else if ((dD3 >= 0.0) && (dD4 <= dD3)) {
+			dU = 1.0;
+		}
+		else if ((dVC <= 0.0) && (dD1 >= 0.0) && (dD3 <= 0.0)) {
+			dU = dD1 / (dD1 - dD3);
+		}
+		else if ((dD6 >= 0.0) && (dD5 <= dD6)) {
+			dV = 1.0;
+		}
+		else if ((dVB <= 0.0) && (dD2 >= 0.0) && (dD6 <= 0.0)) {
+			dV = dD2 / (dD2 - dD6);
+		}
+		else if ((dVA <= 0.0) && ((dD4 - dD3) >= 0.0) && ((dD5 - dD6) >= 0.0)) {
+			dV = (dD4 - dD3) / ((dD4 - dD3) + (dD5 - dD6));
+			dU = 1.0 - dV;
+		}
+		else {
+			double dDenominator = 1.0 / (dVA + dVB + dVC);
+			dU = dVB * dDenominator;
+			dV = dVC * dDenominator;
+		}
+
+		for (uint32_t nAxis = 0; nAxis < 3; nAxis++)
+			pResult[nAxis] = pA[nAxis] + dU * vAB[nAxis] + dV * vAC[nAxis];
+	}
+
+public:
+
+	CBruteForceMesh(LibMCEnv::PMeshObject pMeshObject)
+	{
+		std::vector<LibMCEnv::sMeshVertex3D> Vertices;
+		std::vector<LibMCEnv::sMeshTriangle3D> Triangles;
+		pMeshObject->GetAllVertices(Vertices);
+		pMeshObject->GetAllTriangles(Triangles);
+
+		// Vertex IDs are 1-based and contiguous
+		for (auto& triangle : Triangles) {
+			std::vector<double> coordinates(9);
+			for (uint32_t nCorner = 0; nCorner < 3; nCorner++) {
+				auto& vertex = Vertices.at(triangle.m_Vertices[nCorner] - 1);
+				for (uint32_t nAxis = 0; nAxis < 3; nAxis++)
+					coordinates[nCorner * 3 + nAxis] = vertex.m_Coordinates[nAxis];
+			}
+			m_Triangles.push_back(coordinates);
+			m_TriangleIDs.push_back(triangle.m_TriangleID);
+		}
+	}
+
+	// Double sided Moeller-Trumbore intersection against every triangle. The distance is measured along the normalized direction.
+	bool castRay(const double* pOrigin, const double* pDirection, double& dDistance)
+	{
+		double dLength = sqrt(dot(pDirection, pDirection));
+		double vDirection[3] = { pDirection[0] / dLength, pDirection[1] / dLength, pDirection[2] / dLength };
+
+		bool bHit = false;
+		for (auto& triangle : m_Triangles) {
+			double vEdge1[3], vEdge2[3], vT[3], vP[3], vQ[3];
+			for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+				vEdge1[nAxis] = triangle[3 + nAxis] - triangle[nAxis];
+				vEdge2[nAxis] = triangle[6 + nAxis] - triangle[nAxis];
+				vT[nAxis] = pOrigin[nAxis] - triangle[nAxis];
+			}
+
+			cross(vDirection, vEdge2, vP);
+			double dDeterminant = dot(vEdge1, vP);
+			if (fabs(dDeterminant) < 1.0E-12)
+				continue;
+
+			double dU = dot(vT, vP) / dDeterminant;
+			if ((dU < 0.0) || (dU > 1.0))
+				continue;
+
+			cross(vT, vEdge1, vQ);
+			double dV = dot(vDirection, vQ) / dDeterminant;
+			if ((dV < 0.0) || (dU + dV > 1.0))
+				continue;
+
+			double dTriangleDistance = dot(vEdge2, vQ) / dDeterminant;
+			if ((dTriangleDistance >= 0.0) && (!bHit || (dTriangleDistance < dDistance))) {
+				dDistance = dTriangleDistance;
+				bHit = true;
+			}
+		}
+
+		return bHit;
+	}
+
+	// Returns the IDs of all triangles that overlap the box, with the box grown or shrunk by dTolerance.
+	void findTrianglesInBox(const double* pMin, const double* pMax, double dTolerance, std::vector<uint32_t>& TriangleIDs)
+	{
+		double vCenter[3], vHalfSize[3];
+		for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+			vCenter[nAxis] = 0.5 * (pMin[nAxis] + pMax[nAxis]);
+			vHalfSize[nAxis] = std::max(0.5 * (pMax[nAxis] - pMin[nAxis]) + dTolerance, 0.0);
+		}
+
+		TriangleIDs.clear();
+		for (size_t nIndex = 0; nIndex < m_Triangles.size(); nIndex++) {
+			if (triangleOverlapsBox(m_Triangles[nIndex].data(), vCenter, vHalfSize))
+				TriangleIDs.push_back(m_TriangleIDs[nIndex]);
+		}
+	}
+
+	double findClosestDistance(const double* pPoint)
+	{
+		double dMinDistance = -1.0;
+		for (auto& triangle : m_Triangles) {
+			double vClosest[3];
+			closestPointOnTriangle(triangle.data(), pPoint, vClosest);
+			double vDelta[3] = { vClosest[0] - pPoint[0], vClosest[1] - pPoint[1], vClosest[2] - pPoint[2] };
+			double dDistance = sqrt(dot(vDelta, vDelta));
+			if ((dMinDistance < 0.0) || (dDistance < dMinDistance))
+				dMinDistance = dDistance;
+		}
+
+		return dMinDistance;
+	}
+
+};
+
+/*************************************************************************************************************************
+ Class definition of CTestData
+**************************************************************************************************************************/
+class CTestData : public virtual CPluginData {
+public:
+
+};
+
+/*************************************************************************************************************************
+ Class definition of CTestState
+**************************************************************************************************************************/
+typedef CState<CTestData> CTestState;
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Init
+**************************************************************************************************************************/
+class CTestState_Init : public virtual CTestState {
+public:
+
+	CTestState_Init(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "init";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		pStateEnvironment->LogMessage("Initializing...");
+
+		pStateEnvironment->SetNextState("loading");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Loading
+**************************************************************************************************************************/
+class CTestState_Loading : public virtual CTestState {
+public:
+
+	CTestState_Loading(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "loading";
+	}
+
+	void checkTopology(LibMCEnv::PMeshObject pMeshObject, const std::string& sName, const sTestTorus& torus, bool bExpectManifold, bool bExpectOriented)
+	{
+		uint32_t nExpectedVertexCount = torus.m_nRingCount * torus.m_nSideCount;
+		uint32_t nExpectedTriangleCount = getTorusTriangleCount(torus);
+
+		if (pMeshObject->GetVertexCount() != nExpectedVertexCount)
+			throw std::runtime_error(sName + ": mesh has " + std::to_string(pMeshObject->GetVertexCount()) + " vertices instead of " + std::to_string(nExpectedVertexCount));
+		if (pMeshObject->GetTriangleCount() != nExpectedTriangleCount)
+			throw std::runtime_error(sName + ": mesh has " + std::to_string(pMeshObject->GetTriangleCount()) + " triangles instead of " + std::to_string(nExpectedTriangleCount));
+
+		if (pMeshObject->IsManifold() != bExpectManifold)
+			throw std::runtime_error(sName + ": unexpected manifold flag");
+		if (pMeshObject->IsOriented() != bExpectOriented)
+			throw std::runtime_error(sName + ": unexpected orientation flag");
+		if (pMeshObject->IsWatertight() != (bExpectManifold && bExpectOriented))
+			throw std::runtime_error(sName + ": unexpected watertight flag");
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		// Load times across mesh sizes, from 20K to 980K triangles.
+		std::vector<sTestTorus> Tori = { { 100, 100, false, false }, { 300, 300, false, false }, { 700, 700, false, false } };
+		for (auto& torus : Tori) {
+			std::string sName = "torus" + std::to_string(getTorusTriangleCount(torus));
+			auto pStreamReader = createTorus3MF(pStateEnvironment, sName, torus);
+
+			double dParseTime, dTopologyTime;
+			auto pMeshObject = loadTestMesh(pStateEnvironment, pStreamReader, dParseTime, dTopologyTime);
+			checkTopology(pMeshObject, sName, torus, true, true);
+
+			pStateEnvironment->LogMessage(sName + ": " + std::to_string(pMeshObject->GetTriangleCount()) + " triangles, 3MF size: " + std::to_string(pStreamReader->GetSize()) +
+				" bytes, 3MF parsing: " + std::to_string(dParseTime) + " ms, mesh topology: " + std::to_string(dTopologyTime) + " ms");
+		}
+
+		// Boundary edges have a valence of 1, a flipped triangle shares its edges against the orientation of its neighbours.
+		sTestTorus openTorus = { 60, 40, true, false };
+		double dParseTime, dTopologyTime;
+		checkTopology(loadTestMesh(pStateEnvironment, createTorus3MF(pStateEnvironment, "opentorus", openTorus), dParseTime, dTopologyTime), "opentorus", openTorus, false, true);
+
+		sTestTorus flippedTorus = { 60, 40, false, true };
+		checkTopology(loadTestMesh(pStateEnvironment, createTorus3MF(pStateEnvironment, "flippedtorus", flippedTorus), dParseTime, dTopologyTime), "flippedtorus", flippedTorus, true, false);
+
+		pStateEnvironment->SetNextState("spatialqueries");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_SpatialQueries
+**************************************************************************************************************************/
+class CTestState_SpatialQueries : public virtual CTestState {
+public:
+
+	CTestState_SpatialQueries(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "spatialqueries";
+	}
+
+	static double millisecondsSince(std::chrono::steady_clock::time_point startTime)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		sTestTorus torus = { 200, 120, false, false };
+		double dParseTime, dTopologyTime;
+		auto pMeshObject = loadTestMesh(pStateEnvironment, createTorus3MF(pStateEnvironment, "querytorus", torus), dParseTime, dTopologyTime);
+		CBruteForceMesh bruteForceMesh(pMeshObject);
+
+		if (pMeshObject->HasSpatialIndex())
+			throw std::runtime_error("spatial index exists before it has been built");
+
+		auto buildStartTime = std::chrono::steady_clock::now();
+		pMeshObject->BuildSpatialIndex();
+		double dBuildTime = millisecondsSince(buildStartTime);
+
+		if (!pMeshObject->HasSpatialIndex())
+			throw std::runtime_error("spatial index does not exist after it has been built");
+
+		pStateEnvironment->LogMessage("BVH build: " + std::to_string(pMeshObject->GetTriangleCount()) + " triangles in " + std::to_string(dBuildTime) + " ms");
+
+		std::mt19937 randomGenerator(4711);
+		std::uniform_real_distribution<double> unitDistribution(-1.0, 1.0);
+		std::uniform_real_distribution<double> halfSizeDistribution(0.5, 8.0);
+		double dExtent = MESHTEST_MAJORRADIUS + MESHTEST_MINORRADIUS;
+
+		// Rays start outside of the torus and aim at points around its center, so that some pass through the hole.
+		double dRayTime = 0.0, dBruteForceRayTime = 0.0;
+		uint32_t nRayHitCount = 0;
+		for (uint32_t nQuery = 0; nQuery < MESHTEST_QUERYCOUNT; nQuery++) {
+			double vOrigin[3] = { 2.0 * dExtent * unitDistribution(randomGenerator), 2.0 * dExtent * unitDistribution(randomGenerator), 2.0 * dExtent };
+			double vDirection[3] = { dExtent * unitDistribution(randomGenerator) - vOrigin[0], dExtent * unitDistribution(randomGenerator) - vOrigin[1], MESHTEST_MINORRADIUS * unitDistribution(randomGenerator) - vOrigin[2] };
+
+			uint32_t nTriangleID = 0;
+			double dDistance = 0.0;
+			auto startTime = std::chrono::steady_clock::now();
+			bool bHit = pMeshObject->CastRay(vOrigin[0], vOrigin[1], vOrigin[2], vDirection[0], vDirection[1], vDirection[2], nTriangleID, dDistance);
+			dRayTime += millisecondsSince(startTime);
+
+			double dBruteForceDistance = 0.0;
+			startTime = std::chrono::steady_clock::now();
+			bool bBruteForceHit = bruteForceMesh.castRay(vOrigin, vDirection, dBruteForceDistance);
+			dBruteForceRayTime += millisecondsSince(startTime);
+
+			if (bHit != bBruteForceHit)
+				throw std::runtime_error("CastRay hit mismatch in query " + std::to_string(nQuery));
+			if (bHit) {
+				if (fabs(dDistance - dBruteForceDistance) > MESHTEST_DISTANCETOLERANCE)
+					throw std::runtime_error("CastRay distance mismatch in query " + std::to_string(nQuery) + ": " + std::to_string(dDistance) + " instead of " + std::to_string(dBruteForceDistance));
+				nRayHitCount++;
+			}
+		}
+
+		// Every triangle that overlaps the shrunk box must be found, and every triangle found must overlap the grown box.
+		double dBoxTime = 0.0, dBruteForceBoxTime = 0.0;
+		uint64_t nBoxTriangleCount = 0;
+		for (uint32_t nQuery = 0; nQuery < MESHTEST_QUERYCOUNT; nQuery++) {
+			double vCenter[3] = { dExtent * unitDistribution(randomGenerator), dExtent * unitDistribution(randomGenerator), MESHTEST_MINORRADIUS * unitDistribution(randomGenerator) };
+			double vMin[3], vMax[3];
+			for (uint32_t nAxis = 0; nAxis < 3; nAxis++) {
+				double dHalfSize = halfSizeDistribution(randomGenerator);
+				vMin[nAxis] = vCenter[nAxis] - dHalfSize;
+				vMax[nAxis] = vCenter[nAxis] + dHalfSize;
+			}
+
+			std::vector<uint32_t> TriangleIDs;
+			auto startTime = std::chrono::steady_clock::now();
+			pMeshObject->FindTrianglesInBox(vMin[0], vMin[1], vMin[2], vMax[0], vMax[1], vMax[2], TriangleIDs);
+			dBoxTime += millisecondsSince(startTime);
+
+			std::vector<uint32_t> InnerTriangleIDs, OuterTriangleIDs;
+			startTime = std::chrono::steady_clock::now();
+			bruteForceMesh.findTrianglesInBox(vMin, vMax, -MESHTEST_BOXTOLERANCE, InnerTriangleIDs);
+			dBruteForceBoxTime += millisecondsSince(startTime);
+			bruteForceMesh.findTrianglesInBox(vMin, vMax, MESHTEST_BOXTOLERANCE, OuterTriangleIDs);
+
+			std::sort(TriangleIDs.begin(), TriangleIDs.end());
+			if (!std::includes(TriangleIDs.begin(), TriangleIDs.end(), InnerTriangleIDs.begin(), InnerTriangleIDs.end()))
+				throw std::runtime_error("FindTrianglesInBox misses triangles in query " + std::to_string(nQuery));
+			if (!std::includes(OuterTriangleIDs.begin(), OuterTriangleIDs.end(), TriangleIDs.begin(), TriangleIDs.end()))
+				throw std::runtime_error("FindTrianglesInBox returns triangles outside of the box in query " + std::to_string(nQuery));
+
+			nBoxTriangleCount += TriangleIDs.size();
+		}
+
+		double dClosestPointTime = 0.0, dBruteForceClosestPointTime = 0.0;
+		for (uint32_t nQuery = 0; nQuery < MESHTEST_QUERYCOUNT; nQuery++) {
+			double vPoint[3] = { 1.2 * dExtent * unitDistribution(randomGenerator), 1.2 * dExtent * unitDistribution(randomGenerator), 2.0 * MESHTEST_MINORRADIUS * unitDistribution(randomGenerator) };
+
+			uint32_t nTriangleID = 0;
+			double dClosestX, dClosestY, dClosestZ, dDistance;
+			auto startTime = std::chrono::steady_clock::now();
+			bool bFound = pMeshObject->FindClosestPoint(vPoint[0], vPoint[1], vPoint[2], nTriangleID, dClosestX, dClosestY, dClosestZ, dDistance);
+			dClosestPointTime += millisecondsSince(startTime);
+
+			startTime = std::chrono::steady_clock::now();
+			double dBruteForceDistance = bruteForceMesh.findClosestDistance(vPoint);
+			dBruteForceClosestPointTime += millisecondsSince(startTime);
+
+			if (!bFound)
+				throw std::runtime_error("FindClosestPoint found no point in query " + std::to_string(nQuery));
+			if (fabs(dDistance - dBruteForceDistance) > MESHTEST_DISTANCETOLERANCE)
+				throw std::runtime_error("FindClosestPoint distance mismatch in query " + std::to_string(nQuery) + ": " + std::to_string(dDistance) + " instead of " + std::to_string(dBruteForceDistance));
+
+			double dPointDistance = sqrt((dClosestX - vPoint[0]) * (dClosestX - vPoint[0]) + (dClosestY - vPoint[1]) * (dClosestY - vPoint[1]) + (dClosestZ - vPoint[2]) * (dClosestZ - vPoint[2]));
+			if (fabs(dPointDistance - dDistance) > MESHTEST_DISTANCETOLERANCE)
+				throw std::runtime_error("FindClosestPoint returns a point that is not at the returned distance in query " + std::to_string(nQuery));
+		}
+
+		pStateEnvironment->LogMessage("CastRay: " + std::to_string(MESHTEST_QUERYCOUNT) + " queries, " + std::to_string(nRayHitCount) + " hits, BVH: " + std::to_string(dRayTime) + " ms, brute force: " + std::to_string(dBruteForceRayTime) + " ms");
+		pStateEnvironment->LogMessage("FindTrianglesInBox: " + std::to_string(MESHTEST_QUERYCOUNT) + " queries, " + std::to_string(nBoxTriangleCount) + " triangles, BVH: " + std::to_string(dBoxTime) + " ms, brute force: " + std::to_string(dBruteForceBoxTime) + " ms");
+		pStateEnvironment->LogMessage("FindClosestPoint: " + std::to_string(MESHTEST_QUERYCOUNT) + " queries, BVH: " + std::to_string(dClosestPointTime) + " ms, brute force: " + std::to_string(dBruteForceClosestPointTime) + " ms");
+
+		pStateEnvironment->SetNextState("success");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Success
+**************************************************************************************************************************/
+class CTestState_Success : public virtual CTestState {
+public:
+
+	CTestState_Success(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "success";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		pStateEnvironment->SetNextState("success");
+
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_FatalError
+**************************************************************************************************************************/
+class CTestState_FatalError : public virtual CTestState {
+public:
+
+	CTestState_FatalError(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "fatalerror";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		pStateEnvironment->SetNextState("fatalerror");
+	}
+
+};
+
+
+
+/*************************************************************************************************************************
+ Class definition of CStateFactory
+**************************************************************************************************************************/
+
+CStateFactory::CStateFactory(const std::string& sInstanceName)
+{
+	m_pPluginData = std::make_shared<CTestData>();
+}
+
+IState* CStateFactory::CreateState(const std::string& sStateName)
+{
+
+	IState* pStateInstance = nullptr;
+
+	if (createStateInstanceByName<CTestState_Init>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_Loading>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_SpatialQueries>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_Success>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_FatalError>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDSTATENAME);
+
+}
+
+
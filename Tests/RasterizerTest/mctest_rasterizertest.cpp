@@ -35,6 +35,7 @@ using namespace LibMCPlugin::Impl;
 
 #include <iostream>
 #include <fstream>
+#include <cmath>
 
 
 /*************************************************************************************************************************
@@ -119,6 +120,380 @@ public:
 			pngStream.write((const char*)pngData.data(), pngData.size());
 		pngStream.close();
 
+		pStateEnvironment->SetNextState("benchmark");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CRasterizerState_Benchmark
+**************************************************************************************************************************/
+class CRasterizerState_Benchmark : public virtual CRasterizerState {
+public:
+
+	CRasterizerState_Benchmark(const std::string& sStateName, PPluginData pPluginData)
+		: CRasterizerState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "benchmark";
+	}
+
+	void calculateImage(LibMCEnv::PStateEnvironment pStateEnvironment, PDriver_Rasterizer pDriver, LibMCDriver_Rasterizer::PLayerObject pLayer, uint32_t nThreadCount, std::vector<uint8_t>& pixelBuffer)
+	{
+		auto pRasterizer = pDriver->RegisterInstance("benchmark_" + std::to_string(nThreadCount), 3840, 2160, 10, 10);
+		pRasterizer->SetSamplingParameters(128, 4);
+		pRasterizer->SetSubsampling(8, 8);
+		pRasterizer->SetThreadCount(nThreadCount);
+		pRasterizer->AddLayer(pLayer);
+
+		auto pImage = pStateEnvironment->CreateEmptyImage(3840, 2160, 10, 10, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+
+		uint64_t nStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+		pRasterizer->CalculateImage(pImage, true);
+		uint64_t nEndTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+
+		pStateEnvironment->LogMessage("Rasterized 3840x2160 image with " + std::to_string(nThreadCount) + " thread(s) in " + std::to_string((nEndTime - nStartTime) / 1000) + "ms");
+
+		pImage->GetPixels(0, 0, 3840, 2160, LibMCEnv::eImagePixelFormat::GreyScale8bit, pixelBuffer);
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		auto pDriver = m_pPluginData->acquireRasterizer(pStateEnvironment);
+		auto pLayer = pDriver->CreateEmptyLayer();
+
+		// A grid of rotated squares, to spread the work evenly across all block rows.
+		for (uint32_t nIndexY = 0; nIndexY < 40; nIndexY++) {
+			for (uint32_t nIndexX = 0; nIndexX < 70; nIndexX++) {
+				double dCenterX = 27.0 + nIndexX * 54.0;
+				double dCenterY = 27.0 + nIndexY * 54.0;
+				double dAngle = (nIndexX * 7 + nIndexY * 13) * 0.01;
+				double dRadius = 22.0;
+
+				std::vector<LibMCDriver_Rasterizer::sPosition2D> PointsBuffer;
+				for (uint32_t nCorner = 0; nCorner < 4; nCorner++) {
+					double dCornerAngle = dAngle + nCorner * 1.5707963267948966;
+					PointsBuffer.push_back({ dCenterX + dRadius * cos(dCornerAngle), dCenterY + dRadius * sin(dCornerAngle) });
+				}
+
+				pLayer->AddEntity(PointsBuffer, LibMCDriver_Rasterizer::eGeometryType::SolidGeometry);
+			}
+		}
+
+		std::vector<uint8_t> referencePixels;
+		calculateImage(pStateEnvironment, pDriver, pLayer, 1, referencePixels);
+
+		// 0 uses all available hardware threads
+		std::vector<uint32_t> threadCounts = { 2, 4, 8, 0 };
+		for (auto nThreadCount : threadCounts) {
+			std::vector<uint8_t> pixels;
+			calculateImage(pStateEnvironment, pDriver, pLayer, nThreadCount, pixels);
+
+			if (pixels != referencePixels)
+				throw std::runtime_error("parallel rasterization differs from single threaded result with " + std::to_string(nThreadCount) + " threads");
+		}
+
+		pStateEnvironment->SetNextState("kernelregression");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CRasterizerState_KernelRegression
+**************************************************************************************************************************/
+class CRasterizerState_KernelRegression : public virtual CRasterizerState {
+public:
+
+	CRasterizerState_KernelRegression(const std::string& sStateName, PPluginData pPluginData)
+		: CRasterizerState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "kernelregression";
+	}
+
+	void calculateImage(LibMCEnv::PStateEnvironment pStateEnvironment, PDriver_Rasterizer pDriver, std::vector<LibMCDriver_Rasterizer::PLayerObject>& layers, bool bAntialiased, bool bSIMDKernels, std::vector<uint8_t>& pixelBuffer)
+	{
+		// The image size is not a multiple of the block size, to cover partial border blocks
+		auto pRasterizer = pDriver->RegisterInstance("regression_" + std::to_string(bAntialiased) + "_" + std::to_string(bSIMDKernels), 1013, 757, 20, 20);
+		pRasterizer->SetSamplingParameters(128, 32);
+		pRasterizer->SetSubsampling(4, 4);
+		pRasterizer->SetSIMDKernelsEnabled(bSIMDKernels);
+		for (auto pLayer : layers)
+			pRasterizer->AddLayer(pLayer);
+
+		auto pImage = pStateEnvironment->CreateEmptyImage(1013, 757, 20, 20, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+		pRasterizer->CalculateImage(pImage, bAntialiased);
+
+		pImage->GetPixels(0, 0, 1013, 757, LibMCEnv::eImagePixelFormat::GreyScale8bit, pixelBuffer);
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		auto pDriver = m_pPluginData->acquireRasterizer(pStateEnvironment);
+
+		// Three overlapping reference layers, so that the coverage needs to be divided by a non-power of two.
+		std::vector<LibMCDriver_Rasterizer::PLayerObject> layers;
+		for (uint32_t nLayerIndex = 0; nLayerIndex < 3; nLayerIndex++) {
+			auto pLayer = pDriver->CreateEmptyLayer();
+
+			for (uint32_t nShapeIndex = 0; nShapeIndex < 12; nShapeIndex++) {
+				double dCenterX = 120.0 + (nShapeIndex % 4) * 240.0 + nLayerIndex * 17.0;
+				double dCenterY = 120.0 + (nShapeIndex / 4) * 240.0 + nLayerIndex * 11.0;
+				double dRadius = 70.0 + nLayerIndex * 25.0;
+				uint32_t nCornerCount = 3 + nShapeIndex % 6;
+
+				std::vector<LibMCDriver_Rasterizer::sPosition2D> PointsBuffer;
+				for (uint32_t nCorner = 0; nCorner < nCornerCount; nCorner++) {
+					double dCornerAngle = 0.3 * nLayerIndex + nCorner * 6.283185307179586 / nCornerCount;
+					PointsBuffer.push_back({ dCenterX + dRadius * cos(dCornerAngle), dCenterY + dRadius * sin(dCornerAngle) });
+				}
+
+				pLayer->AddEntity(PointsBuffer, LibMCDriver_Rasterizer::eGeometryType::SolidGeometry);
+			}
+
+			layers.push_back(pLayer);
+		}
+
+		auto pInfoInstance = pDriver->RegisterInstance("regression_info", 1013, 757, 20, 20);
+		pStateEnvironment->LogMessage("Span kernels: " + pInfoInstance->GetSIMDKernelName());
+
+		for (auto bAntialiased : { true, false }) {
+			std::vector<uint8_t> scalarPixels;
+			std::vector<uint8_t> simdPixels;
+			calculateImage(pStateEnvironment, pDriver, layers, bAntialiased, false, scalarPixels);
+			calculateImage(pStateEnvironment, pDriver, layers, bAntialiased, true, simdPixels);
+
+			if (simdPixels != scalarPixels)
+				throw std::runtime_error("vectorized span kernels differ from scalar reference kernels");
+		}
+
+		pStateEnvironment->SetNextState("streaming");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CRasterizerState_Streaming
+**************************************************************************************************************************/
+class CRasterizerState_Streaming : public virtual CRasterizerState {
+public:
+
+	CRasterizerState_Streaming(const std::string& sStateName, PPluginData pPluginData)
+		: CRasterizerState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "streaming";
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		auto pDriver = m_pPluginData->acquireRasterizer(pStateEnvironment);
+
+		const uint32_t nLayerCount = 20;
+		auto pSliceStack = pDriver->CreateSliceStack(nLayerCount, 0.05, 0.0);
+		for (uint32_t nLayerIndex = 0; nLayerIndex < nLayerCount; nLayerIndex++) {
+			auto pLayer = pSliceStack->GetLayer(nLayerIndex);
+
+			for (uint32_t nShapeIndex = 0; nShapeIndex < 200; nShapeIndex++) {
+				double dCenterX = 50.0 + (nShapeIndex % 20) * 95.0;
+				double dCenterY = 50.0 + (nShapeIndex / 20) * 100.0;
+				double dAngle = nLayerIndex * 0.05 + nShapeIndex * 0.1;
+
+				std::vector<LibMCDriver_Rasterizer::sPosition2D> PointsBuffer;
+				for (uint32_t nCorner = 0; nCorner < 16; nCorner++) {
+					double dCornerAngle = dAngle + nCorner * 0.39269908169872414;
+					double dRadius = (nCorner % 2) ? 20.0 : 40.0;
+					PointsBuffer.push_back({ dCenterX + dRadius * cos(dCornerAngle), dCenterY + dRadius * sin(dCornerAngle) });
+				}
+
+				pLayer->AddEntity(PointsBuffer, LibMCDriver_Rasterizer::eGeometryType::SolidGeometry);
+			}
+		}
+
+		// One rasterizer for the whole stack, so that the line buffers are reused from layer to layer.
+		auto pRasterizer = pDriver->RegisterInstance("streaming", 1920, 1080, 20, 20);
+		pRasterizer->SetSubsampling(4, 4);
+
+		std::vector<uint8_t> lastLayerPixels;
+		for (uint32_t nLayerIndex = 0; nLayerIndex < nLayerCount; nLayerIndex++) {
+			pRasterizer->ClearLayers();
+			pRasterizer->AddSliceStackLayer(pSliceStack, nLayerIndex);
+
+			auto pImage = pStateEnvironment->CreateEmptyImage(1920, 1080, 20, 20, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+			pRasterizer->CalculateImage(pImage, true);
+
+			uint32_t nStatisticsLayerCount = 0;
+			uint64_t nLineCount = 0;
+			uint32_t nAllocationCount = 0;
+			uint64_t nDurationInMicroseconds = 0;
+			pRasterizer->GetCalculationStatistics(nStatisticsLayerCount, nLineCount, nAllocationCount, nDurationInMicroseconds);
+
+			pStateEnvironment->LogMessage("Layer " + std::to_string(nLayerIndex) + ": " + std::to_string(nLineCount) + " lines, " + std::to_string(nAllocationCount) + " allocations, " + std::to_string(nDurationInMicroseconds) + " microseconds");
+
+			if (nLayerIndex + 1 == nLayerCount)
+				pImage->GetPixels(0, 0, 1920, 1080, LibMCEnv::eImagePixelFormat::GreyScale8bit, lastLayerPixels);
+		}
+
+		// Streaming the layer must give the same result as adding a layer object
+		auto pReferenceRasterizer = pDriver->RegisterInstance("streaming_reference", 1920, 1080, 20, 20);
+		pReferenceRasterizer->SetSubsampling(4, 4);
+		pReferenceRasterizer->AddLayer(pSliceStack->GetLayer(nLayerCount - 1));
+
+		auto pReferenceImage = pStateEnvironment->CreateEmptyImage(1920, 1080, 20, 20, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+		pReferenceRasterizer->CalculateImage(pReferenceImage, true);
+
+		std::vector<uint8_t> referencePixels;
+		pReferenceImage->GetPixels(0, 0, 1920, 1080, LibMCEnv::eImagePixelFormat::GreyScale8bit, referencePixels);
+
+		if (referencePixels != lastLayerPixels)
+			throw std::runtime_error("streamed slice stack layer differs from layer object");
+
+		pStateEnvironment->SetNextState("toolpathstreaming");
+	}
+
+};
+
+
+
+/*************************************************************************************************************************
+ Class definition of CRasterizerState_ToolpathStreaming
+**************************************************************************************************************************/
+class CRasterizerState_ToolpathStreaming : public virtual CRasterizerState {
+public:
+
+	CRasterizerState_ToolpathStreaming(const std::string& sStateName, PPluginData pPluginData)
+		: CRasterizerState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "toolpathstreaming";
+	}
+
+	// Copies the loops of a toolpath layer into a layer object, as a rasterizer client had to do before AddToolpathLayer.
+	static LibMCDriver_Rasterizer::PLayerObject copyLoopsToLayerObject(PDriver_Rasterizer pDriver, LibMCEnv::PToolpathLayer pToolpathLayer)
+	{
+		auto pLayer = pDriver->CreateEmptyLayer();
+		double dUnits = pToolpathLayer->GetUnits();
+
+		std::vector<LibMCEnv::sPosition2D> ToolpathPoints;
+		std::vector<LibMCDriver_Rasterizer::sPosition2D> PointsBuffer;
+
+		uint32_t nSegmentCount = pToolpathLayer->GetSegmentCount();
+		for (uint32_t nSegmentIndex = 0; nSegmentIndex < nSegmentCount; nSegmentIndex++) {
+			if (!pToolpathLayer->SegmentIsLoop(nSegmentIndex))
+				continue;
+
+			pToolpathLayer->GetSegmentPointData(nSegmentIndex, ToolpathPoints);
+
+			PointsBuffer.clear();
+			for (auto& point : ToolpathPoints)
+				PointsBuffer.push_back({ point.m_Coordinates[0] * dUnits, point.m_Coordinates[1] * dUnits });
+
+			pLayer->AddEntity(PointsBuffer, LibMCDriver_Rasterizer::eGeometryType::SolidGeometry);
+		}
+
+		return pLayer;
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		auto pDriver = m_pPluginData->acquireRasterizer(pStateEnvironment);
+
+		// Even segments are hatches and odd segments are loops in a 100mm x 100mm field. Hatches must be ignored.
+		auto pToolpath = pStateEnvironment->CreateSyntheticToolpath("rasterizertest", 5, 2000, 64, 3, 0, 3030);
+
+		// 254 DPI is 0.1mm per pixel, so the image covers the whole field.
+		auto pStreamingRasterizer = pDriver->RegisterInstance("toolpathstreaming", 1000, 1000, 254, 254);
+		pStreamingRasterizer->SetSubsampling(4, 4);
+
+		auto pReferenceRasterizer = pDriver->RegisterInstance("toolpathstreaming_reference", 1000, 1000, 254, 254);
+		pReferenceRasterizer->SetSubsampling(4, 4);
+
+		for (uint32_t nLayerIndex = 0; nLayerIndex < pToolpath->GetLayerCount(); nLayerIndex++) {
+			auto pToolpathLayer = pToolpath->LoadLayer(nLayerIndex);
+
+			uint64_t nStreamingStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+			pStreamingRasterizer->ClearLayers();
+			pStreamingRasterizer->AddToolpathLayer(pToolpathLayer);
+
+			auto pImage = pStateEnvironment->CreateEmptyImage(1000, 1000, 254, 254, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+			pStreamingRasterizer->CalculateImage(pImage, true);
+			uint64_t nStreamingEndTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+
+			uint32_t nStatisticsLayerCount = 0;
+			uint64_t nLineCount = 0;
+			uint32_t nAllocationCount = 0;
+			uint64_t nDurationInMicroseconds = 0;
+			pStreamingRasterizer->GetCalculationStatistics(nStatisticsLayerCount, nLineCount, nAllocationCount, nDurationInMicroseconds);
+
+			if ((nStatisticsLayerCount != 1) || (nLineCount == 0))
+				throw std::runtime_error("toolpath layer " + std::to_string(nLayerIndex) + " did not stream any lines");
+
+			uint64_t nReferenceStartTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+			pReferenceRasterizer->ClearLayers();
+			pReferenceRasterizer->AddLayer(copyLoopsToLayerObject(pDriver, pToolpathLayer));
+
+			auto pReferenceImage = pStateEnvironment->CreateEmptyImage(1000, 1000, 254, 254, LibMCEnv::eImagePixelFormat::GreyScale8bit);
+			pReferenceRasterizer->CalculateImage(pReferenceImage, true);
+			uint64_t nReferenceEndTime = pStateEnvironment->GetGlobalTimerInMicroseconds();
+
+			pStateEnvironment->LogMessage("Toolpath layer " + std::to_string(nLayerIndex) + ": " + std::to_string(nLineCount) + " lines, " + std::to_string(nAllocationCount) + " allocations, streamed in "
+				+ std::to_string(nStreamingEndTime - nStreamingStartTime) + " microseconds, via layer object in " + std::to_string(nReferenceEndTime - nReferenceStartTime) + " microseconds");
+
+			std::vector<uint8_t> pixels;
+			pImage->GetPixels(0, 0, 1000, 1000, LibMCEnv::eImagePixelFormat::GreyScale8bit, pixels);
+
+			std::vector<uint8_t> referencePixels;
+			pReferenceImage->GetPixels(0, 0, 1000, 1000, LibMCEnv::eImagePixelFormat::GreyScale8bit, referencePixels);
+
+			if (pixels != referencePixels)
+				throw std::runtime_error("streamed toolpath layer " + std::to_string(nLayerIndex) + " differs from layer object");
+
+			// Both paths reserve the line buffer from the expected line count, so they must allocate equally often.
+			uint32_t nReferenceLayerCount = 0;
+			uint64_t nReferenceLineCount = 0;
+			uint32_t nReferenceAllocationCount = 0;
+			uint64_t nReferenceDuration = 0;
+			pReferenceRasterizer->GetCalculationStatistics(nReferenceLayerCount, nReferenceLineCount, nReferenceAllocationCount, nReferenceDuration);
+
+			if (nLineCount != nReferenceLineCount)
+				throw std::runtime_error("streamed toolpath layer " + std::to_string(nLayerIndex) + " has " + std::to_string(nLineCount) + " lines instead of " + std::to_string(nReferenceLineCount));
+			if (nAllocationCount != nReferenceAllocationCount)
+				throw std::runtime_error("streamed toolpath layer " + std::to_string(nLayerIndex) + " needed " + std::to_string(nAllocationCount) + " allocations instead of " + std::to_string(nReferenceAllocationCount));
+		}
+
+		pStateEnvironment->UnloadAllToolpathes();
+
 		pStateEnvironment->SetNextState("success");
 	}
 
@@ -199,6 +574,18 @@ IState* CStateFactory::CreateState(const std::string& sStateName)
 	if (createStateInstanceByName<CRasterizerState_Init>(sStateName, pStateInstance, m_pPluginData))
 		return pStateInstance;
 
+	if (createStateInstanceByName<CRasterizerState_Benchmark>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CRasterizerState_KernelRegression>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CRasterizerState_Streaming>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+
+	if (createStateInstanceByName<CRasterizerState_ToolpathStreaming>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
 
 	if (createStateInstanceByName<CRasterizerState_Success>(sStateName, pStateInstance, m_pPluginData))
 		return pStateInstance;
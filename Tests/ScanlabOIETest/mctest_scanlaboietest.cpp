@@ -414,6 +414,119 @@ public:
 
 
 
+		pStateEnvironment->SetNextState("streaming");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Streaming
+**************************************************************************************************************************/
+class CTestState_Streaming : public virtual CTestState {
+public:
+
+	CTestState_Streaming(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "streaming";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		auto pOIEDriver = m_pPluginData->acquireOIE(pStateEnvironment);
+		auto pRTC6Driver = m_pPluginData->acquireRTC6(pStateEnvironment);
+		auto pRTCContext = pRTC6Driver->GetContext();
+
+		pStateEnvironment->LogMessage("Reconnecting device for recording stream test..");
+		auto pDevice = pOIEDriver->FindDevice("oie1");
+		pDevice->Connect("sluser", "sluser");
+		pDevice->StartAppByMinorVersion("AIB", 3, 2);
+
+		pDevice->StartRecordingStream(LibMCDriver_ScanLabOIE::eRecordingStreamCompression::LZ4, 1);
+		if (!pDevice->RecordingStreamIsActive())
+			throw std::runtime_error("recording stream is not active");
+
+		pRTC6Driver->SetOIERecordingMode(LibMCDriver_ScanLab::eOIERecordingMode::OIEEnableAndContinuousMeasurement);
+		pRTCContext->SetStartList(1, 0);
+		pRTCContext->EnableOIE();
+		pRTCContext->StartOIEMeasurement();
+
+		std::vector<LibMCDriver_ScanLab::sPoint2D> ContourPoints;
+		for (int32_t nIndex = 0; nIndex < 1000; nIndex++) {
+			float T = (float)(nIndex - 500) / 500.0f * 3.14159f;
+			ContourPoints.push_back(LibMCDriver_ScanLab::sPoint2D{ nIndex * 0.05f, sin(T) * 20.0f });
+		}
+
+		for (uint32_t nRepetition = 1; nRepetition <= 4; nRepetition++)
+			pRTCContext->DrawPolylineOIE(ContourPoints, 10.0, 100.0, 50.0, 0.0, nRepetition);
+
+		pRTCContext->StopOIEMeasurement();
+		pRTCContext->DisableOIE();
+		pRTCContext->SetEndOfList();
+		pRTCContext->ExecuteList(1, 0);
+
+		bool bBusy = true;
+		while (bBusy) {
+			uint32_t nPosition = 0;
+			pRTCContext->GetStatus(bBusy, nPosition);
+			std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		}
+
+		// Rethrows any error of the background writer.
+		pDevice->StopRecordingStream();
+		if (pDevice->RecordingStreamIsActive())
+			throw std::runtime_error("recording stream is still active");
+
+		LibMCDriver_ScanLabOIE_uint64 nRecordCount = 0;
+		LibMCDriver_ScanLabOIE_uint64 nChunkCount = 0;
+		LibMCDriver_ScanLabOIE_uint64 nUncompressedSize = 0;
+		LibMCDriver_ScanLabOIE_uint64 nStreamSize = 0;
+		LibMCDriver_ScanLabOIE_uint64 nDroppedRecordCount = 0;
+		pDevice->GetRecordingStreamStatistics(nRecordCount, nChunkCount, nUncompressedSize, nStreamSize, nDroppedRecordCount);
+
+		pStateEnvironment->LogMessage("Streamed " + std::to_string(nRecordCount) + " records in " + std::to_string(nChunkCount) + " chunks (" + std::to_string(nStreamSize) + " of " + std::to_string(nUncompressedSize) + " bytes)");
+
+		if (nRecordCount == 0)
+			throw std::runtime_error("no records have been streamed");
+		if (nDroppedRecordCount != 0)
+			throw std::runtime_error("recording stream dropped " + std::to_string(nDroppedRecordCount) + " records");
+		if (nChunkCount == 0)
+			throw std::runtime_error("recording stream has no chunks");
+
+		// Streamed records are not kept in memory.
+		auto pRemainingRecording = pDevice->RetrieveCurrentRecording();
+		if (pRemainingRecording->GetRecordCount() != 0)
+			throw std::runtime_error("streamed records have not been released");
+
+		auto pStreamedRecording = pDevice->LoadRecordingStream();
+		if (pStreamedRecording->GetRecordCount() != nRecordCount)
+			throw std::runtime_error("recording stream record count mismatch");
+
+		std::vector<uint32_t> PacketNumbersBuffer;
+		std::vector<int32_t> SignalsBuffer;
+		pStreamedRecording->GetAllPacketNumbers(PacketNumbersBuffer);
+		pStreamedRecording->GetAllSensorSignals(0, SignalsBuffer);
+		if ((PacketNumbersBuffer.size() != nRecordCount) || (SignalsBuffer.size() != nRecordCount))
+			throw std::runtime_error("retrieved invalid recording stream data");
+
+		// The stream must hold the records in the order they have been received.
+		for (size_t nRecordIndex = 1; nRecordIndex < PacketNumbersBuffer.size(); nRecordIndex++) {
+			if (PacketNumbersBuffer[nRecordIndex] < PacketNumbersBuffer[nRecordIndex - 1])
+				throw std::runtime_error("recording stream packet numbers are out of order at record " + std::to_string(nRecordIndex));
+		}
+
+		pDevice->StopApp();
+		pDevice->Disconnect();
+
 		pStateEnvironment->SetNextState("success");
 	}
 
@@ -494,6 +607,9 @@ IState* CStateFactory::CreateState(const std::string& sStateName)
 	if (createStateInstanceByName<CTestState_Init>(sStateName, pStateInstance, m_pPluginData))
 		return pStateInstance;
 
+	if (createStateInstanceByName<CTestState_Streaming>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
 
 	if (createStateInstanceByName<CTestState_Success>(sStateName, pStateInstance, m_pPluginData))
 		return pStateInstance;
@@ -0,0 +1,576 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "libmcplugin_impl.hpp"
+#include "libmcdriver_scanlab_dynamic.hpp"
+
+using namespace LibMCPlugin::Impl;
+
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <map>
+
+
+#define SCANLABRTCTEST_SERIALNUMBER 4242
+#define SCANLABRTCTEST_MAXLASERPOWER 500.0
+#define SCANLABRTCTEST_EMULATIONTIMEFACTOR 0.02
+#define SCANLABRTCTEST_STREAMINGCHUNKSIZE 1024
+#define SCANLABRTCTEST_MULTICARDSCANNERCOUNT 2
+#define SCANLABRTCTEST_COMPILETHREADCOUNT 4
+#define SCANLABRTCTEST_MAXCACHEDLAYERS 8
+
+/*************************************************************************************************************************
+ Import functionality for Driver into current plugin
+**************************************************************************************************************************/
+LIBMC_IMPORTDRIVERCLASSES(ScanLab, ScanLab_RTC6)
+LIBMC_IMPORTDRIVERCLASSES(ScanLab, ScanLab_RTC6xN)
+
+
+/*************************************************************************************************************************
+ Class definition of CTestData
+**************************************************************************************************************************/
+class CTestData : public virtual CPluginData {
+protected:
+	// We need to globally store driver wrappers in the plugin
+	PDriverCast_ScanLab_RTC6 m_DriverCast_ScanLab_RTC6;
+	PDriverCast_ScanLab_RTC6xN m_DriverCast_ScanLab_RTC6xN;
+
+public:
+
+	PDriver_ScanLab_RTC6 acquireRTC6(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		return m_DriverCast_ScanLab_RTC6.acquireDriver(pStateEnvironment, "scanlab_rtc6");
+	}
+
+	PDriver_ScanLab_RTC6xN acquireRTC6xN(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		return m_DriverCast_ScanLab_RTC6xN.acquireDriver(pStateEnvironment, "scanlab_rtc6x2");
+	}
+
+};
+
+/*************************************************************************************************************************
+ Class definition of CTestState
+**************************************************************************************************************************/
+typedef CState<CTestData> CTestState;
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Init
+**************************************************************************************************************************/
+class CTestState_Init : public virtual CTestState {
+public:
+
+	CTestState_Init(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "init";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		auto pDriver = m_pPluginData->acquireRTC6(pStateEnvironment);
+
+		pStateEnvironment->LogMessage("Loading emulated SDK");
+		pDriver->LoadEmulatedSDK(SCANLABRTCTEST_SERIALNUMBER);
+		if (!pDriver->IsSDKEmulated())
+			throw std::runtime_error("SDK is not emulated");
+
+		pDriver->Initialise("", "", 1000, SCANLABRTCTEST_SERIALNUMBER);
+		pDriver->ConfigureLaserMode(LibMCDriver_ScanLab::eLaserMode::YAG5, LibMCDriver_ScanLab::eLaserPort::Port16bitDigital, SCANLABRTCTEST_MAXLASERPOWER, false, false, true, true, false, false);
+
+		// The layer export only compares list output, so the emulated lists finish immediately.
+		pDriver->SetEmulationTimeFactor(0.0);
+
+		pStateEnvironment->SetNextState("layerexport");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_LayerExport
+**************************************************************************************************************************/
+class CTestState_LayerExport : public virtual CTestState {
+public:
+
+	CTestState_LayerExport(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "layerexport";
+	}
+
+	// Reference for the bulk export that AddLayerToList writes from: every value is queried separately with the per segment accessors.
+	double checkLayerExport(LibMCEnv::PToolpathLayer pLayer, uint32_t nLayerIndex)
+	{
+		std::string sLayerName = "layer " + std::to_string(nLayerIndex);
+		auto startTime = std::chrono::steady_clock::now();
+
+		std::vector<LibMCEnv::sToolpathProfileValueColumn> Columns;
+		for (auto valueType : { LibMCEnv::eToolpathProfileValueType::JumpSpeed, LibMCEnv::eToolpathProfileValueType::Speed, LibMCEnv::eToolpathProfileValueType::LaserPower, LibMCEnv::eToolpathProfileValueType::LaserFocus })
+			Columns.push_back({ (uint32_t)valueType, 0, std::nan("") });
+		Columns.push_back({ (uint32_t)LibMCEnv::eToolpathProfileValueType::Custom, pLayer->FindProfileValueID("", "laserindex"), -1.0 });
+
+		std::vector<uint32_t> SegmentTypes;
+		std::vector<uint32_t> PointOffsets;
+		std::vector<uint32_t> LocalPartIDs;
+		std::vector<uint32_t> ProfileIDs;
+		std::vector<double> ProfileValues;
+		std::vector<LibMCEnv::sPosition2D> Points;
+		pLayer->ExportSegmentTable(SegmentTypes, PointOffsets, LocalPartIDs, ProfileIDs);
+		pLayer->ExportProfileValueColumns(Columns, ProfileValues);
+		pLayer->ExportPointData(Points);
+
+		double dExportTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+		uint32_t nSegmentCount = pLayer->GetSegmentCount();
+		if ((SegmentTypes.size() != nSegmentCount) || (PointOffsets.size() != (size_t)nSegmentCount + 1) || (LocalPartIDs.size() != nSegmentCount) || (ProfileIDs.size() != nSegmentCount))
+			throw std::runtime_error(sLayerName + ": segment table does not match the segment count");
+		if ((ProfileValues.size() != (size_t)nSegmentCount * Columns.size()) || (PointOffsets[nSegmentCount] != Points.size()))
+			throw std::runtime_error(sLayerName + ": export has an invalid size");
+
+		std::map<uint32_t, std::string> ProfileUUIDs;
+		for (uint32_t nSegmentIndex = 0; nSegmentIndex < nSegmentCount; nSegmentIndex++) {
+			std::string sSegmentName = sLayerName + ", segment " + std::to_string(nSegmentIndex);
+
+			LibMCEnv::eToolpathSegmentType segmentType;
+			uint32_t nPointCount;
+			pLayer->GetSegmentInfo(nSegmentIndex, segmentType, nPointCount);
+			if ((SegmentTypes[nSegmentIndex] != (uint32_t)segmentType) || (PointOffsets[nSegmentIndex + 1] - PointOffsets[nSegmentIndex] != nPointCount))
+				throw std::runtime_error(sSegmentName + ": type or point count differs");
+			if (LocalPartIDs[nSegmentIndex] != pLayer->GetSegmentLocalPartID(nSegmentIndex))
+				throw std::runtime_error(sSegmentName + ": local part ID differs");
+
+			// Profile IDs are only local to the export, but segments with the same ID must share the profile.
+			std::string sProfileUUID = pLayer->GetSegmentProfileUUID(nSegmentIndex);
+			auto iProfile = ProfileUUIDs.insert(std::make_pair(ProfileIDs[nSegmentIndex], sProfileUUID));
+			if (iProfile.first->second != sProfileUUID)
+				throw std::runtime_error(sSegmentName + ": profile ID is shared with another profile");
+
+			const double* pValues = &ProfileValues[(size_t)nSegmentIndex * Columns.size()];
+			for (size_t nColumnIndex = 0; nColumnIndex + 1 < Columns.size(); nColumnIndex++) {
+				double dReferenceValue = pLayer->GetSegmentProfileTypedValue(nSegmentIndex, (LibMCEnv::eToolpathProfileValueType)Columns[nColumnIndex].m_ValueType);
+				if (pValues[nColumnIndex] != dReferenceValue)
+					throw std::runtime_error(sSegmentName + ": profile value " + std::to_string(nColumnIndex) + " is " + std::to_string(pValues[nColumnIndex]) + " instead of " + std::to_string(dReferenceValue));
+			}
+
+			double dLaserIndex = pLayer->GetSegmentProfileDoubleValueDef(nSegmentIndex, "", "laserindex", -1.0);
+			if (pValues[Columns.size() - 1] != dLaserIndex)
+				throw std::runtime_error(sSegmentName + ": laser index is " + std::to_string(pValues[Columns.size() - 1]) + " instead of " + std::to_string(dLaserIndex));
+
+			std::vector<LibMCEnv::sPosition2D> SegmentPoints;
+			pLayer->GetSegmentPointData(nSegmentIndex, SegmentPoints);
+			for (uint32_t nPointIndex = 0; nPointIndex < nPointCount; nPointIndex++) {
+				auto& point = Points[(size_t)PointOffsets[nSegmentIndex] + nPointIndex];
+				if ((point.m_Coordinates[0] != SegmentPoints[nPointIndex].m_Coordinates[0]) || (point.m_Coordinates[1] != SegmentPoints[nPointIndex].m_Coordinates[1]))
+					throw std::runtime_error(sSegmentName + ": point " + std::to_string(nPointIndex) + " differs");
+			}
+		}
+
+		return dExportTime;
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		auto pDriver = m_pPluginData->acquireRTC6(pStateEnvironment);
+		auto pContext = pDriver->GetContext();
+
+		// All profiles are assigned to laser index 0, which is the default laser index of the context.
+		auto pToolpath = pStateEnvironment->CreateSyntheticToolpath("scanlabrtctest", 3, 400, 24, 5, 0, 1234);
+		std::string sStreamUUID = pToolpath->GetStorageUUID();
+
+		for (uint32_t nLayerIndex = 0; nLayerIndex < pToolpath->GetLayerCount(); nLayerIndex++) {
+			double dExportTime = checkLayerExport(pToolpath->LoadLayer(nLayerIndex), nLayerIndex);
+
+			pDriver->DrawLayer(sStreamUUID, nLayerIndex);
+
+			uint64_t nCommandCount = 0;
+			uint64_t nCommandHash = 0;
+			double dMarkTime, dJumpTime, dExecutionTime;
+			pContext->GetEmulationStatistics(nCommandCount, nCommandHash, dMarkTime, dJumpTime, dExecutionTime);
+
+			pStateEnvironment->LogMessage("Layer " + std::to_string(nLayerIndex) + ": " + std::to_string(nCommandCount) + " list commands, bulk export: " + std::to_string(dExportTime) + " ms");
+
+			if ((nCommandCount == 0) || (dMarkTime <= 0.0))
+				throw std::runtime_error("layer " + std::to_string(nLayerIndex) + " did not mark any list commands");
+		}
+
+		pStateEnvironment->UnloadAllToolpathes();
+
+		pStateEnvironment->SetNextState("compilation");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Compilation
+**************************************************************************************************************************/
+class CTestState_Compilation : public virtual CTestState {
+public:
+
+	CTestState_Compilation(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "compilation";
+	}
+
+	// Draws a layer and returns the emulated list output. The emulation statistics are reset by DrawLayer.
+	double drawLayer(PDriver_ScanLab_RTC6 pDriver, const std::string& sStreamUUID, uint32_t nLayerIndex, uint64_t& nListCommandCount, uint64_t& nListCommandHash)
+	{
+		auto pContext = pDriver->GetContext();
+
+		auto startTime = std::chrono::steady_clock::now();
+		pDriver->DrawLayer(sStreamUUID, nLayerIndex);
+		double dDrawTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+		double dMarkTime, dJumpTime, dExecutionTime;
+		pContext->GetEmulationStatistics(nListCommandCount, nListCommandHash, dMarkTime, dJumpTime, dExecutionTime);
+
+		return dDrawTime;
+	}
+
+	void checkLayer(LibMCEnv::PStateEnvironment pStateEnvironment, PDriver_ScanLab_RTC6 pDriver, const std::string& sStreamUUID, uint32_t nLayerIndex, const std::string& sMode, uint64_t nReferenceCommandCount, uint64_t nReferenceCommandHash)
+	{
+		uint64_t nCommandCount = 0;
+		uint64_t nCommandHash = 0;
+		double dDrawTime = drawLayer(pDriver, sStreamUUID, nLayerIndex, nCommandCount, nCommandHash);
+
+		pStateEnvironment->LogMessage("Layer " + std::to_string(nLayerIndex) + ", " + sMode + ": " + std::to_string(nCommandCount) + " list commands, draw time: " + std::to_string(dDrawTime) + " ms");
+
+		if ((nCommandCount != nReferenceCommandCount) || (nCommandHash != nReferenceCommandHash))
+			throw std::runtime_error(sMode + ": list commands of layer " + std::to_string(nLayerIndex) + " differ from the direct export (" + std::to_string(nCommandCount) + " instead of " + std::to_string(nReferenceCommandCount) + " commands)");
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		auto pDriver = m_pPluginData->acquireRTC6(pStateEnvironment);
+		auto pContext = pDriver->GetContext();
+
+		// Large enough to be compiled in several ranges.
+		auto pToolpath = pStateEnvironment->CreateSyntheticToolpath("scanlabrtccompilation", 2, 2000, 24, 5, 0, 2468);
+		std::string sStreamUUID = pToolpath->GetStorageUUID();
+		uint32_t nLayerCount = pToolpath->GetLayerCount();
+
+		std::vector<uint64_t> ReferenceCommandCounts;
+		std::vector<uint64_t> ReferenceCommandHashes;
+		for (uint32_t nLayerIndex = 0; nLayerIndex < nLayerCount; nLayerIndex++) {
+			uint64_t nCommandCount = 0;
+			uint64_t nCommandHash = 0;
+			double dDrawTime = drawLayer(pDriver, sStreamUUID, nLayerIndex, nCommandCount, nCommandHash);
+			pStateEnvironment->LogMessage("Layer " + std::to_string(nLayerIndex) + ", direct: " + std::to_string(nCommandCount) + " list commands, draw time: " + std::to_string(dDrawTime) + " ms");
+
+			if (nCommandCount == 0)
+				throw std::runtime_error("layer " + std::to_string(nLayerIndex) + " did not write any list commands");
+
+			ReferenceCommandCounts.push_back(nCommandCount);
+			ReferenceCommandHashes.push_back(nCommandHash);
+		}
+
+		pContext->EnableCommandStreamCompilation(SCANLABRTCTEST_COMPILETHREADCOUNT, SCANLABRTCTEST_MAXCACHEDLAYERS);
+
+		uint32_t nCompiledLayerCount, nCacheHitCount;
+		uint64_t nLastCommandCount;
+		double dLastCompileTime;
+
+		for (uint32_t nLayerIndex = 0; nLayerIndex < nLayerCount; nLayerIndex++)
+			checkLayer(pStateEnvironment, pDriver, sStreamUUID, nLayerIndex, "compiled", ReferenceCommandCounts[nLayerIndex], ReferenceCommandHashes[nLayerIndex]);
+
+		pContext->GetCommandStreamStatistics(nCompiledLayerCount, nCacheHitCount, nLastCommandCount, dLastCompileTime);
+		if ((nCompiledLayerCount != nLayerCount) || (nCacheHitCount != 0))
+			throw std::runtime_error("compiled " + std::to_string(nCompiledLayerCount) + " layers with " + std::to_string(nCacheHitCount) + " cache hits, expected " + std::to_string(nLayerCount) + " layers without cache hits");
+
+		for (uint32_t nLayerIndex = 0; nLayerIndex < nLayerCount; nLayerIndex++)
+			checkLayer(pStateEnvironment, pDriver, sStreamUUID, nLayerIndex, "cached", ReferenceCommandCounts[nLayerIndex], ReferenceCommandHashes[nLayerIndex]);
+
+		pContext->GetCommandStreamStatistics(nCompiledLayerCount, nCacheHitCount, nLastCommandCount, dLastCompileTime);
+		if ((nCompiledLayerCount != nLayerCount) || (nCacheHitCount != nLayerCount))
+			throw std::runtime_error("compiled " + std::to_string(nCompiledLayerCount) + " layers with " + std::to_string(nCacheHitCount) + " cache hits, expected " + std::to_string(nLayerCount) + " layers from the cache");
+
+		// A laser power calibration is only applied by the direct export, so the layer must not be compiled.
+		pContext->SetLinearLaserPowerCalibration(5.0, 0.9);
+		checkLayer(pStateEnvironment, pDriver, sStreamUUID, 0, "calibrated", ReferenceCommandCounts[0], ReferenceCommandHashes[0]);
+		pContext->ClearLaserPowerCalibration();
+
+		pContext->GetCommandStreamStatistics(nCompiledLayerCount, nCacheHitCount, nLastCommandCount, dLastCompileTime);
+		if ((nCompiledLayerCount != nLayerCount) || (nCacheHitCount != nLayerCount))
+			throw std::runtime_error("layer with laser power calibration has been compiled");
+
+		pContext->DisableCommandStreamCompilation();
+
+		pStateEnvironment->UnloadAllToolpathes();
+
+		pStateEnvironment->SetNextState("emulation");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Emulation
+**************************************************************************************************************************/
+class CTestState_Emulation : public virtual CTestState {
+public:
+
+	CTestState_Emulation(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "emulation";
+	}
+
+	// Draws a layer and checks that DrawLayer has waited for the busy time of the emulated card.
+	void drawLayer(LibMCEnv::PStateEnvironment pStateEnvironment, PDriver_ScanLab_RTC6 pDriver, const std::string& sStreamUUID, const std::string& sMode)
+	{
+		auto startTime = std::chrono::steady_clock::now();
+		pDriver->DrawLayer(sStreamUUID, 0);
+		double dDrawTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+		int64_t nListCommands = pStateEnvironment->GetIntegerParameter("rtc6state", "emulation_list_commands");
+		double dCommandsPerSecond = pStateEnvironment->GetDoubleParameter("rtc6state", "emulation_commands_per_second");
+		double dMarkTime = pStateEnvironment->GetDoubleParameter("rtc6state", "emulation_mark_time");
+		double dJumpTime = pStateEnvironment->GetDoubleParameter("rtc6state", "emulation_jump_time");
+		double dExecutionTime = pStateEnvironment->GetDoubleParameter("rtc6state", "emulation_execution_time");
+
+		pStateEnvironment->LogMessage(sMode + ": " + std::to_string(nListCommands) + " list commands, " + std::to_string(dCommandsPerSecond) + " commands per second, mark time: " + std::to_string(dMarkTime) +
+			" ms, jump time: " + std::to_string(dJumpTime) + " ms, execution time: " + std::to_string(dExecutionTime) + " ms, draw time: " + std::to_string(dDrawTime) + " ms");
+
+		if ((nListCommands == 0) || (dExecutionTime <= 0.0))
+			throw std::runtime_error(sMode + ": layer did not execute on the emulated card");
+
+		double dBusyTime = dExecutionTime * SCANLABRTCTEST_EMULATIONTIMEFACTOR;
+		if (dDrawTime < dBusyTime)
+			throw std::runtime_error(sMode + ": DrawLayer returned after " + std::to_string(dDrawTime) + " ms, before the emulated card has been busy for " + std::to_string(dBusyTime) + " ms");
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		auto pDriver = m_pPluginData->acquireRTC6(pStateEnvironment);
+
+		pDriver->SetEmulationTimeFactor(SCANLABRTCTEST_EMULATIONTIMEFACTOR);
+
+		auto pToolpath = pStateEnvironment->CreateSyntheticToolpath("scanlabrtcemulation", 1, 40, 12, 3, 0, 4321);
+		std::string sStreamUUID = pToolpath->GetStorageUUID();
+
+		drawLayer(pStateEnvironment, pDriver, sStreamUUID, "Single list");
+
+		// With streaming, the second list is chained by an auto change while the first one is busy.
+		pDriver->EnableListStreaming(SCANLABRTCTEST_STREAMINGCHUNKSIZE);
+		drawLayer(pStateEnvironment, pDriver, sStreamUUID, "List streaming");
+		pDriver->DisableListStreaming();
+
+		pStateEnvironment->UnloadAllToolpathes();
+
+		pStateEnvironment->SetNextState("multicard");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_MultiCard
+**************************************************************************************************************************/
+class CTestState_MultiCard : public virtual CTestState {
+public:
+
+	CTestState_MultiCard(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "multicard";
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		auto pDriver = m_pPluginData->acquireRTC6xN(pStateEnvironment);
+
+		// Card 1 is owned by the single card driver, the scanners use the emulated cards 2 and 3.
+		pDriver->LoadEmulatedSDK(SCANLABRTCTEST_SERIALNUMBER);
+		for (uint32_t nScannerIndex = 1; nScannerIndex <= SCANLABRTCTEST_MULTICARDSCANNERCOUNT; nScannerIndex++) {
+			uint32_t nSerialNumber = SCANLABRTCTEST_SERIALNUMBER + nScannerIndex;
+			pDriver->InitialiseScanner(nScannerIndex, "", "", 1000, nSerialNumber, nScannerIndex);
+			pDriver->ConfigureLaserMode(nScannerIndex, LibMCDriver_ScanLab::eLaserMode::YAG5, LibMCDriver_ScanLab::eLaserPort::Port16bitDigital, SCANLABRTCTEST_MAXLASERPOWER, false, false, true, true, false, false);
+
+			if (pDriver->GetSerialNumber(nScannerIndex) != nSerialNumber)
+				throw std::runtime_error("scanner " + std::to_string(nScannerIndex) + " acquired card with serial number " + std::to_string(pDriver->GetSerialNumber(nScannerIndex)));
+
+			pDriver->GetContext(nScannerIndex)->ResetEmulationStatistics();
+		}
+
+		// Only the first scanner owns laser index 1, the data is not assigned to the second one.
+		auto pToolpath = pStateEnvironment->CreateSyntheticToolpath("scanlabrtcmulticard", 1, 40, 12, 3, 1, 5678);
+		pDriver->DrawLayerParallel(pToolpath->GetStorageUUID(), 0, false);
+
+		double dLayerLatency, dStartSkew;
+		pDriver->GetLayerDispatchStatistics(dLayerLatency, dStartSkew);
+		pStateEnvironment->LogMessage("Layer latency: " + std::to_string(dLayerLatency) + " ms, start skew: " + std::to_string(dStartSkew) + " ms");
+
+		for (uint32_t nScannerIndex = 1; nScannerIndex <= SCANLABRTCTEST_MULTICARDSCANNERCOUNT; nScannerIndex++) {
+			uint64_t nListCommandCount, nListCommandHash;
+			double dMarkTime, dJumpTime, dExecutionTime;
+			pDriver->GetContext(nScannerIndex)->GetEmulationStatistics(nListCommandCount, nListCommandHash, dMarkTime, dJumpTime, dExecutionTime);
+
+			double dListBuildTime, dStartDelay, dScannerExecutionTime;
+			pDriver->GetScannerDispatchStatistics(nScannerIndex, dListBuildTime, dStartDelay, dScannerExecutionTime);
+
+			pStateEnvironment->LogMessage("Scanner " + std::to_string(nScannerIndex) + ": " + std::to_string(nListCommandCount) + " list commands, emulated execution time: " + std::to_string(dExecutionTime) +
+				" ms, list build time: " + std::to_string(dListBuildTime) + " ms, execution time: " + std::to_string(dScannerExecutionTime) + " ms");
+
+			if ((nScannerIndex == 1) && (dMarkTime <= 0.0))
+				throw std::runtime_error("scanner 1 did not mark its laser data");
+			if ((nScannerIndex != 1) && (dMarkTime > 0.0))
+				throw std::runtime_error("scanner " + std::to_string(nScannerIndex) + " marked data of another laser");
+		}
+
+		pStateEnvironment->UnloadAllToolpathes();
+
+		pStateEnvironment->SetNextState("success");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Success
+**************************************************************************************************************************/
+class CTestState_Success : public virtual CTestState {
+public:
+
+	CTestState_Success(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "success";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		pStateEnvironment->SetNextState("success");
+
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_FatalError
+**************************************************************************************************************************/
+class CTestState_FatalError : public virtual CTestState {
+public:
+
+	CTestState_FatalError(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "fatalerror";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		pStateEnvironment->SetNextState("fatalerror");
+	}
+
+};
+
+
+
+/*************************************************************************************************************************
+ Class definition of CStateFactory
+**************************************************************************************************************************/
+
+CStateFactory::CStateFactory(const std::string& sInstanceName)
+{
+	m_pPluginData = std::make_shared<CTestData>();
+}
+
+IState* CStateFactory::CreateState(const std::string& sStateName)
+{
+
+	IState* pStateInstance = nullptr;
+
+	if (createStateInstanceByName<CTestState_Init>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_LayerExport>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_Compilation>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_Emulation>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_MultiCard>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_Success>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_FatalError>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDSTATENAME);
+
+}
+
+
@@ -38,6 +38,9 @@ using namespace LibMCPlugin::Impl;
 #include <chrono>
 #include <thread>
 #include <cmath>
+#include <random>
+#include <sstream>
+#include <algorithm>
 
 
 /*************************************************************************************************************************
@@ -46,6 +49,9 @@ using namespace LibMCPlugin::Impl;
 LIBMC_IMPORTDRIVERCLASSES(ScanLabSMC, ScanLabSMC)
 
 
+#define SIMULATIONTEST_LINECOUNT 200000
+
+
 /*************************************************************************************************************************
  Class definition of CTestData
 **************************************************************************************************************************/
@@ -54,6 +60,8 @@ protected:
 	// We need to globally store driver wrappers in the plugin
 	PDriverCast_ScanLabSMC m_DriverCast_ScanLab_SMC;
 
+	LibMCDriver_ScanLabSMC::PSMCContext m_pContext;
+
 public:
 
 	PDriver_ScanLabSMC acquireSMC (LibMCEnv::PStateEnvironment pStateEnvironment)
@@ -61,6 +69,18 @@ public:
 		return m_DriverCast_ScanLab_SMC.acquireDriver(pStateEnvironment, "scanlab_smc");
 	}
 
+	void setContext(LibMCDriver_ScanLabSMC::PSMCContext pContext)
+	{
+		m_pContext = pContext;
+	}
+
+	LibMCDriver_ScanLabSMC::PSMCContext getContext()
+	{
+		if (m_pContext.get() == nullptr)
+			throw std::runtime_error("SMC context has not been created");
+		return m_pContext;
+	}
+
 };
 
 /*************************************************************************************************************************
@@ -100,6 +120,7 @@ public:
 		//pConfiguration->SetFirmwareResources("rtc6eth", "rtc6rbf", "rtc6dat");
 
 		auto pContext = pDriver->CreateContext("smccontext", pConfiguration);
+		m_pPluginData->setContext(pContext);
 
 		std::vector<LibMCDriver_ScanLabSMC::sHatch2D> Hatches;
 
@@ -134,14 +155,274 @@ public:
 
 		pStateEnvironment->LogMessage("Execute done");
 
+		pStateEnvironment->SetNextState("asyncexecution");
+	}
+
+};
 
 
-		pStateEnvironment->SetNextState("success");
+
+/*************************************************************************************************************************
+ Class definition of CTestState_AsyncExecution
+**************************************************************************************************************************/
+class CTestState_AsyncExecution : public virtual CTestState {
+public:
+
+	CTestState_AsyncExecution(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "asyncexecution";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		auto pContext = m_pPluginData->getContext();
+
+		std::vector<LibMCDriver_ScanLabSMC::sHatch2D> Hatches;
+		for (uint32_t nIndex = 0; nIndex < 100; nIndex++) {
+			Hatches.push_back({ 10.0f, nIndex + 10.0f, 50.0f, nIndex + 10.0f });
+		}
+
+		auto pFirstJob = pContext->BeginJob(0.0, 0.0, LibMCDriver_ScanLabSMC::eBlendMode::MaxAccuracy);
+		pFirstJob->DrawHatches(Hatches, 2000.0, 2000.0, 10.0, 0.0);
+		pFirstJob->Finalize();
+		pFirstJob->Execute(false);
+
+		// BeginJob waits until the first job has been started, so the second job is built while the first one is executing.
+		auto pSecondJob = pContext->BeginJob(0.0, 0.0, LibMCDriver_ScanLabSMC::eBlendMode::MaxAccuracy);
+		pSecondJob->DrawHatches(Hatches, 2000.0, 2000.0, 10.0, 0.0);
+		pSecondJob->Finalize();
+		pSecondJob->Execute(false);
+
+		// The third job can only be begun after the second job has been started, which is after the first one has finished.
+		auto pThirdJob = pContext->BeginJob(0.0, 0.0, LibMCDriver_ScanLabSMC::eBlendMode::MaxAccuracy);
+		if (pFirstJob->IsExecuting())
+			throw std::runtime_error("Third job has been begun before the second job was started");
+
+		pThirdJob->DrawHatches(Hatches, 2000.0, 2000.0, 10.0, 0.0);
+		pThirdJob->Finalize();
+		pThirdJob->Execute(false);
+
+		std::vector<LibMCDriver_ScanLabSMC::PSMCJob> Jobs = { pFirstJob, pSecondJob, pThirdJob };
+		for (size_t nJobIndex = 0; nJobIndex < Jobs.size(); nJobIndex++) {
+			auto pJob = Jobs.at(nJobIndex);
+
+			while (!pJob->WaitForCompletion(100)) {
+				if (pStateEnvironment->CheckForTermination())
+					throw std::runtime_error("Termination requested during execution");
+			}
+
+			double dPreparationTime, dQueueTime, dExecutionTime, dOverlapTime;
+			pJob->GetExecutionStatistics(dPreparationTime, dQueueTime, dExecutionTime, dOverlapTime);
+
+			pStateEnvironment->LogMessage("Job " + std::to_string(nJobIndex + 1) + " done (preparation: " + std::to_string(dPreparationTime) + " ms, queue: " + std::to_string(dQueueTime) + " ms, overlap: " + std::to_string(dOverlapTime) + " ms, execution: " + std::to_string(dExecutionTime) + " ms)");
+		}
+
+		pStateEnvironment->SetNextState("simulationparser");
 	}
 
 };
 
 
+/*************************************************************************************************************************
+ Class definition of CTestState_SimulationParser
+**************************************************************************************************************************/
+class CTestState_SimulationParser : public virtual CTestState {
+public:
+
+	typedef struct _sReferenceEntry {
+		double m_dTimestamp;
+		double m_dX;
+		double m_dY;
+		int32_t m_nLaserToggle;
+		double m_dActiveChannel1;
+		double m_dActiveChannel2;
+		int32_t m_nCommandIndex;
+	} sReferenceEntry;
+
+	CTestState_SimulationParser(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "simulationparser";
+	}
+
+	static std::string formatValue(const char* pFormat, double dValue)
+	{
+		char buffer[64];
+		snprintf(buffer, sizeof(buffer), pFormat, dValue);
+		return buffer;
+	}
+
+	// Synthetic simulation file of one scan device. Values alternate between several number formats. Some lines have
+	// laser delays, of which 12.75 is longer than the time step and needs the entries to be reordered by timestamp.
+	static std::string createSimulationFile(bool bCRLF)
+	{
+		std::mt19937 randomGenerator(1234);
+		std::uniform_real_distribution<double> positionDistribution(-100.0, 100.0);
+		std::uniform_real_distribution<double> channelDistribution(0.0, 1.0);
+		std::vector<std::string> Formats = { "%+.17g", "%+.6f", "%+.3e", "%+.0f" };
+		std::string sLineEnd = bCRLF ? "\r\n" : "\n";
+
+		std::string sFile = "<!--Simulation output Version=\"1.0\" ScanDevices=\"1\" Stage=\"None\" StageDelay=\"0\"-->" + sLineEnd;
+		for (uint32_t nLine = 0; nLine < SIMULATIONTEST_LINECOUNT; nLine++) {
+			const char* pFormat = Formats[nLine % Formats.size()].c_str();
+			std::string sLine = formatValue(pFormat, positionDistribution(randomGenerator)) + ";" + formatValue(pFormat, positionDistribution(randomGenerator)) + ";";
+
+			if ((nLine % 7) == 0)
+				sLine += "2;1.25;12.75;";
+			else
+				sLine += "0;";
+
+			if ((nLine % 11) == 0)
+				sLine += "1;3.5;";
+			else
+				sLine += "0;";
+
+			sLine += std::to_string(nLine % 3 == 0 ? 1 : 0) + ";" + formatValue("%.17g", channelDistribution(randomGenerator)) + ";" + formatValue("%.4f", channelDistribution(randomGenerator)) + ";" + std::to_string(nLine / 4);
+			if ((nLine % 5) == 0)
+				sLine += ";";
+
+			sFile += sLine + sLineEnd;
+		}
+
+		return sFile;
+	}
+
+	// Line by line parser with std::stod, as the SMC driver used before the simulation files have been parsed in parallel.
+	static void parseReference(const std::string& sFile, std::vector<sReferenceEntry>& Entries)
+	{
+		std::istringstream file(sFile);
+		std::string line;
+		double timestamp = 0;
+		int numberOfCoordinates = 0;
+		int scanDevices = 0;
+		int stages = 0;
+
+		while (std::getline(file, line)) {
+			if (line.empty())
+				continue;
+
+			if (line.rfind("<!--Simulation output", 0) == 0) {
+				std::istringstream iss(line);
+				std::string item;
+				while (iss >> item) {
+					if (item.find("ScanDevices") == 0) {
+						scanDevices = std::stoi(item.substr(13, item.size() - 14));
+					}
+					else if (item.find("Stage") == 0 && item.find("StageDelay") != 0) {
+						std::string stagesRaw = item.substr(7, item.size() - 8);
+						stages = (stagesRaw == "None") ? 0 : std::stoi(stagesRaw.substr(5));
+					}
+				}
+				numberOfCoordinates = scanDevices * 2 + stages * 2;
+			}
+
+			if (line[0] == '+' || line[0] == '-') {
+				std::istringstream iss(line);
+				std::string token;
+				std::vector<std::string> data;
+				while (std::getline(iss, token, ';'))
+					data.push_back(token);
+
+				if (data.size() > 3) {
+					int numLaserOnDelays = std::stoi(data[numberOfCoordinates]);
+					int numLaserOffDelays = std::stoi(data[numberOfCoordinates + 1 + numLaserOnDelays]);
+
+					sReferenceEntry newEntry;
+					newEntry.m_dX = std::stod(data[0]);
+					newEntry.m_dY = std::stod(data[1]);
+					newEntry.m_nLaserToggle = std::stoi(data[numberOfCoordinates + 2 + numLaserOnDelays + numLaserOffDelays]);
+					newEntry.m_dActiveChannel1 = std::stod(data[numberOfCoordinates + 3 + numLaserOnDelays + numLaserOffDelays]);
+					newEntry.m_dActiveChannel2 = std::stod(data[numberOfCoordinates + 4 + numLaserOnDelays + numLaserOffDelays]);
+					newEntry.m_nCommandIndex = std::stoi(data[numberOfCoordinates + 5 + numLaserOnDelays + numLaserOffDelays]);
+
+					double tempTimestamp = timestamp + 10;
+					for (int i = 0; i < numLaserOnDelays; i++) {
+						newEntry.m_dTimestamp = tempTimestamp + std::stod(data[numberOfCoordinates + 1 + i]);
+						Entries.push_back(newEntry);
+					}
+					for (int i = 0; i < numLaserOffDelays; i++) {
+						newEntry.m_dTimestamp = tempTimestamp + std::stod(data[numberOfCoordinates + 2 + numLaserOnDelays + i]);
+						Entries.push_back(newEntry);
+					}
+					if (numLaserOnDelays == 0 && numLaserOffDelays == 0) {
+						newEntry.m_dTimestamp = tempTimestamp;
+						Entries.push_back(newEntry);
+					}
+					timestamp = tempTimestamp;
+				}
+			}
+		}
+
+		// All timestamps of the synthetic file are distinct, so the order does not depend on the sort algorithm.
+		std::sort(Entries.begin(), Entries.end(),
+			[](const sReferenceEntry& x, const sReferenceEntry& y) { return x.m_dTimestamp < y.m_dTimestamp; });
+	}
+
+	template <typename T> static void checkColumn(const std::string& sColumnName, const std::vector<T>& Values, const std::vector<sReferenceEntry>& Entries, T sReferenceEntry::* pMember)
+	{
+		if (Values.size() != Entries.size())
+			throw std::runtime_error("simulation column " + sColumnName + " has " + std::to_string(Values.size()) + " values instead of " + std::to_string(Entries.size()));
+
+		for (size_t nIndex = 0; nIndex < Values.size(); nIndex++) {
+			if (Values[nIndex] != Entries[nIndex].*pMember)
+				throw std::runtime_error("simulation column " + sColumnName + " differs from the reference in row " + std::to_string(nIndex));
+		}
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		auto pDriver = m_pPluginData->acquireSMC(pStateEnvironment);
+
+		std::vector<bool> LineEndings = { false, true };
+		for (auto bCRLF : LineEndings) {
+			std::string sFile = createSimulationFile(bCRLF);
+			std::string sName = bCRLF ? "CRLF" : "LF";
+
+			auto startTime = std::chrono::steady_clock::now();
+			std::vector<sReferenceEntry> Entries;
+			parseReference(sFile, Entries);
+			double dReferenceTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+			auto pDataTable = pStateEnvironment->CreateDataTable();
+			startTime = std::chrono::steady_clock::now();
+			pDriver->LoadSimulationFileData(LibMCDriver_ScanLabSMC::CInputVector<uint8_t>((const uint8_t*)sFile.data(), sFile.size()), pDataTable);
+			double dParserTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+			std::vector<double> DoubleValues;
+			std::vector<int32_t> Int32Values;
+			pDataTable->GetDoubleColumnValues("timestamp", DoubleValues);
+			checkColumn<double>("timestamp", DoubleValues, Entries, &sReferenceEntry::m_dTimestamp);
+			pDataTable->GetDoubleColumnValues("x", DoubleValues);
+			checkColumn<double>("x", DoubleValues, Entries, &sReferenceEntry::m_dX);
+			pDataTable->GetDoubleColumnValues("y", DoubleValues);
+			checkColumn<double>("y", DoubleValues, Entries, &sReferenceEntry::m_dY);
+			pDataTable->GetInt32ColumnValues("laseron", Int32Values);
+			checkColumn<int32_t>("laseron", Int32Values, Entries, &sReferenceEntry::m_nLaserToggle);
+			pDataTable->GetDoubleColumnValues("active1", DoubleValues);
+			checkColumn<double>("active1", DoubleValues, Entries, &sReferenceEntry::m_dActiveChannel1);
+			pDataTable->GetDoubleColumnValues("active2", DoubleValues);
+			checkColumn<double>("active2", DoubleValues, Entries, &sReferenceEntry::m_dActiveChannel2);
+			pDataTable->GetInt32ColumnValues("cmdindex", Int32Values);
+			checkColumn<int32_t>("cmdindex", Int32Values, Entries, &sReferenceEntry::m_nCommandIndex);
+
+			pStateEnvironment->LogMessage("Simulation file (" + sName + ", " + std::to_string(sFile.size()) + " bytes, " + std::to_string(Entries.size()) + " entries): reference parser: " + std::to_string(dReferenceTime) + " ms, driver parser: " + std::to_string(dParserTime) + " ms");
+		}
+
+		pStateEnvironment->SetNextState("success");
+	}
+
+};
+
 
 /*************************************************************************************************************************
  Class definition of CTestState_Success
@@ -216,6 +497,12 @@ IState* CStateFactory::CreateState(const std::string& sStateName)
 	if (createStateInstanceByName<CTestState_Init>(sStateName, pStateInstance, m_pPluginData))
 		return pStateInstance;
 
+	if (createStateInstanceByName<CTestState_AsyncExecution>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_SimulationParser>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
 
 	if (createStateInstanceByName<CTestState_Success>(sStateName, pStateInstance, m_pPluginData))
 		return pStateInstance;
@@ -0,0 +1,274 @@
+/*++
+
+Copyright (C) 2025 Autodesk Inc.
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+	* Redistributions of source code must retain the above copyright
+	  notice, this list of conditions and the following disclaimer.
+	* Redistributions in binary form must reproduce the above copyright
+	  notice, this list of conditions and the following disclaimer in the
+	  documentation and/or other materials provided with the distribution.
+	* Neither the name of the Autodesk Inc. nor the
+	  names of its contributors may be used to endorse or promote products
+	  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL AUTODESK INC. BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "libmcplugin_impl.hpp"
+
+using namespace LibMCPlugin::Impl;
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+
+
+/*************************************************************************************************************************
+ Import functionality for Driver into current plugin
+**************************************************************************************************************************/
+__NODRIVERIMPORT
+
+
+#define TOOLPATHTEST_LAYERCOUNT 2
+#define TOOLPATHTEST_POINTSPERSEGMENT 24
+#define TOOLPATHTEST_PROFILECOUNT 5
+#define TOOLPATHTEST_SEED 2604
+
+/*************************************************************************************************************************
+ Class definition of CTestData
+**************************************************************************************************************************/
+class CTestData : public virtual CPluginData {
+public:
+
+};
+
+/*************************************************************************************************************************
+ Class definition of CTestState
+**************************************************************************************************************************/
+typedef CState<CTestData> CTestState;
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Init
+**************************************************************************************************************************/
+class CTestState_Init : public virtual CTestState {
+public:
+
+	CTestState_Init(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "init";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		pStateEnvironment->LogMessage("Initializing...");
+
+		pStateEnvironment->SetNextState("binaryencoding");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_BinaryEncoding
+**************************************************************************************************************************/
+class CTestState_BinaryEncoding : public virtual CTestState {
+public:
+
+	CTestState_BinaryEncoding(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "binaryencoding";
+	}
+
+	// Encodes one layer at the given resolution and logs bytes and milliseconds, next to the 8 bytes per point
+	// that the points take as absolute int32 pairs.
+	static void encodeLayer(LibMCEnv::PStateEnvironment pStateEnvironment, LibMCEnv::PToolpathLayer pLayer, const std::string& sLayerName, double dResolutionInMM, uint64_t nLayerPointCount, uint64_t& nEncodedSize, uint64_t& nEncodedPointCount)
+	{
+		uint32_t nTileCount = 0;
+		uint64_t nTreeBuildTimeInMicroseconds = 0;
+		uint64_t nEncodingTimeInMicroseconds = 0;
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		pLayer->EncodeBinaryTiles(dResolutionInMM, nEncodedSize, nTileCount, nEncodedPointCount, nTreeBuildTimeInMicroseconds, nEncodingTimeInMicroseconds);
+		auto endTime = std::chrono::high_resolution_clock::now();
+		double dCallTimeInMS = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+		if ((nEncodedSize == 0) || (nTileCount == 0))
+			throw std::runtime_error(sLayerName + " did not encode any tiles at resolution " + std::to_string(dResolutionInMM) + " mm");
+		if (nEncodedPointCount > nLayerPointCount)
+			throw std::runtime_error(sLayerName + " encoded " + std::to_string(nEncodedPointCount) + " points, but the layer only has " + std::to_string(nLayerPointCount));
+
+		double dBytesPerPoint = (nEncodedPointCount > 0) ? ((double)nEncodedSize / (double)nEncodedPointCount) : 0.0;
+
+		pStateEnvironment->LogMessage(sLayerName + " at " + std::to_string(dResolutionInMM) + " mm: " + std::to_string(nEncodedSize) + " bytes (" + std::to_string(nLayerPointCount * 8) + " bytes as int32 points), "
+			+ std::to_string(nTileCount) + " tiles, " + std::to_string(nEncodedPointCount) + " points, " + std::to_string(dBytesPerPoint) + " bytes per point, "
+			+ "tree build: " + std::to_string(nTreeBuildTimeInMicroseconds / 1000.0) + " ms, encoding: " + std::to_string(nEncodingTimeInMicroseconds / 1000.0) + " ms, call: " + std::to_string(dCallTimeInMS) + " ms");
+	}
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		std::vector<uint32_t> segmentsPerLayer = { 200, 2000, 20000 };
+
+		for (auto nSegmentCount : segmentsPerLayer) {
+
+			auto pToolpath = pStateEnvironment->CreateSyntheticToolpath("toolpathtest" + std::to_string(nSegmentCount), TOOLPATHTEST_LAYERCOUNT, nSegmentCount, TOOLPATHTEST_POINTSPERSEGMENT, TOOLPATHTEST_PROFILECOUNT, 0, TOOLPATHTEST_SEED);
+
+			for (uint32_t nLayerIndex = 0; nLayerIndex < pToolpath->GetLayerCount(); nLayerIndex++) {
+				auto pLayer = pToolpath->LoadLayer(nLayerIndex);
+				std::string sLayerName = std::to_string(nSegmentCount) + " segments, layer " + std::to_string(nLayerIndex);
+
+				uint64_t nLayerPointCount = 0;
+				uint64_t nHatchPointCount = 0;
+				uint32_t nLayerSegmentCount = pLayer->GetSegmentCount();
+				for (uint32_t nSegmentIndex = 0; nSegmentIndex < nLayerSegmentCount; nSegmentIndex++) {
+					nLayerPointCount += pLayer->GetSegmentPointCount(nSegmentIndex);
+					nHatchPointCount += (uint64_t)pLayer->GetSegmentHatchCount(nSegmentIndex) * 2;
+				}
+
+				uint64_t nFullSize = 0;
+				uint64_t nFullPointCount = 0;
+				encodeLayer(pStateEnvironment, pLayer, sLayerName, 0.0, nLayerPointCount, nFullSize, nFullPointCount);
+
+				// Without a resolution no primitive is skipped, and only repeated loop points may be dropped.
+				if (nFullPointCount < nHatchPointCount)
+					throw std::runtime_error(sLayerName + " encoded only " + std::to_string(nFullPointCount) + " points, but has " + std::to_string(nHatchPointCount) + " hatch points");
+
+				uint64_t nPreviousSize = nFullSize;
+				uint64_t nPreviousPointCount = nFullPointCount;
+				for (double dResolutionInMM : { 0.1, 1.0 }) {
+					uint64_t nEncodedSize = 0;
+					uint64_t nEncodedPointCount = 0;
+					encodeLayer(pStateEnvironment, pLayer, sLayerName, dResolutionInMM, nLayerPointCount, nEncodedSize, nEncodedPointCount);
+
+					if ((nEncodedSize > nPreviousSize) || (nEncodedPointCount > nPreviousPointCount))
+						throw std::runtime_error(sLayerName + " got larger at resolution " + std::to_string(dResolutionInMM) + " mm");
+
+					nPreviousSize = nEncodedSize;
+					nPreviousPointCount = nEncodedPointCount;
+				}
+			}
+		}
+
+		pStateEnvironment->UnloadAllToolpathes();
+
+		pStateEnvironment->SetNextState("success");
+	}
+
+};
+
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_Success
+**************************************************************************************************************************/
+class CTestState_Success : public virtual CTestState {
+public:
+
+	CTestState_Success(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "success";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+
+		pStateEnvironment->SetNextState("success");
+
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CTestState_FatalError
+**************************************************************************************************************************/
+class CTestState_FatalError : public virtual CTestState {
+public:
+
+	CTestState_FatalError(const std::string& sStateName, PPluginData pPluginData)
+		: CTestState(getStateName(), sStateName, pPluginData)
+	{
+	}
+
+	static const std::string getStateName()
+	{
+		return "fatalerror";
+	}
+
+
+	void Execute(LibMCEnv::PStateEnvironment pStateEnvironment)
+	{
+		if (pStateEnvironment.get() == nullptr)
+			throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDPARAM);
+
+		pStateEnvironment->SetNextState("fatalerror");
+	}
+
+};
+
+
+/*************************************************************************************************************************
+ Class definition of CStateFactory
+**************************************************************************************************************************/
+
+CStateFactory::CStateFactory(const std::string& sInstanceName)
+{
+	m_pPluginData = std::make_shared<CTestData>();
+}
+
+IState* CStateFactory::CreateState(const std::string& sStateName)
+{
+
+	IState* pStateInstance = nullptr;
+
+	if (createStateInstanceByName<CTestState_Init>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_BinaryEncoding>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_Success>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	if (createStateInstanceByName<CTestState_FatalError>(sStateName, pStateInstance, m_pPluginData))
+		return pStateInstance;
+
+	throw ELibMCPluginInterfaceException(LIBMCPLUGIN_ERROR_INVALIDSTATENAME);
+
+}
+
+